@@ -89,6 +89,8 @@ def main():
     ap.add_argument('--no-unit-testing', action='store_false',
                     dest='unit_testing',
                     help='disable unit testing')
+    ap.add_argument('--benchmarks', action='store_true',
+                    help='build benchmarks')
     ap.add_argument('--docs', action='store_true',
                     help='build documentation')
     ap.add_argument('--wipe', action='store_true',
@@ -121,6 +123,8 @@ def main():
         build_opts.append('-Db_coverage=true')
     if args.python:
         build_opts.append('-Dpython=true')
+    if args.benchmarks:
+        build_opts.append('-Dbenchmarks=true')
     if args.docs:
         build_opts.append('-Ddocs=true')
     if sanitize:
@@ -1291,8 +1291,9 @@ BitwuzlaTerm bitwuzla_get_value(Bitwuzla *bitwuzla, BitwuzlaTerm term);
  * Print the current input formula.
  *
  * @param bitwuzla The Bitwuzla instance.
- * @param format The output format for printing the formula. Currently, only
- *               `"smt2"` for the SMT-LIB v2 format is supported.
+ * @param format The output format for printing the formula. Either `"smt2"`
+ *               for the SMT-LIB v2 format, or `"binary"` for a binary DAG
+ *               snapshot.
  * @param file The file to print the formula to.
  */
 void bitwuzla_print_formula(Bitwuzla *bitwuzla, const char *format, FILE *file);
@@ -36,6 +36,9 @@ class Terminator;
 namespace option {
 class Options;
 }
+namespace parser::binary {
+class Parser;
+}
 }  // namespace bzla
 
 namespace bitwuzla {
@@ -374,6 +377,7 @@ class Sort;
 class Term
 {
   friend Bitwuzla;
+  friend bzla::parser::binary::Parser;
   friend bool operator==(const Term &, const Term &);
   friend bool operator!=(const Term &, const Term &);
   friend std::ostream &operator<<(std::ostream &, const Term &);
@@ -983,7 +987,14 @@ class Terminator
 /* Bitwuzla                                                                   */
 /* -------------------------------------------------------------------------- */
 
-/** The Bitwuzla solver instance. */
+/**
+ * The Bitwuzla solver instance.
+ *
+ * @note Terms and sorts are managed per thread. Independent solver instances
+ *       can be used concurrently on separate threads, but a solver instance
+ *       and the terms and sorts it is used with must be created and used on
+ *       the same thread.
+ */
 class Bitwuzla
 {
  public:
@@ -1142,8 +1153,10 @@ class Bitwuzla
    * Print the current input formula to the given output stream.
    *
    * @param out    The output stream.
-   * @param format The output format for printing the formula. Currently, only
-   *               `"smt2"` for the SMT-LIB v2 format is supported.
+   * @param format The output format for printing the formula. Either
+   *               `"smt2"` for the SMT-LIB v2 format, or `"binary"` for a
+   *               binary DAG snapshot that can be loaded much faster than
+   *               SMT-LIB v2 input (see `parser::Parser`).
    */
   void print_formula(std::ostream &out,
                      const std::string &format = "smt2") const;
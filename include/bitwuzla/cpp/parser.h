@@ -33,7 +33,9 @@ class Parser
    * @param options     The configuration options for the Bitwuzla instance
    *                    (created by the parser).
    * @param infile_name The name of the input file.
-   * @param language    The format of the input file.
+   * @param language    The format of the input file, either `"smt2"`,
+   *                    `"btor2"` or `"binary"` (a binary DAG snapshot as
+   *                    printed by `Bitwuzla::print_formula()`).
    */
   Parser(Options &options,
          const std::string &infile_name,
@@ -45,7 +47,9 @@ class Parser
    *                    (created by the parser).
    * @param infile_name The name of the input file.
    * @param infile      The input file.
-   * @param language    The format of the input file.
+   * @param language    The format of the input file, either `"smt2"`,
+   *                    `"btor2"` or `"binary"` (a binary DAG snapshot as
+   *                    printed by `Bitwuzla::print_formula()`).
    */
   Parser(Options &options,
          const std::string &infile_name,
@@ -90,6 +90,58 @@ enum ENUM(Option)
 
   /* ---------------- Bitwuzla-specific Options ----------------------------- */
 
+  /*! **AIG optimization level.**
+   *
+   * Configure the two-level AIG rewriting (Brummayer and Biere) applied
+   * when bit-blasting to AIGs.
+   *
+   * Values:
+   * * **0**: no rewriting
+   * * **1**: local rules (neutrality, boundedness, idempotence,
+   *          contradiction)
+   * * **2**: two-level contradiction, subsumption, idempotence and
+   *          resolution rules
+   * * **3**: two-level substitution rules
+   * * **4**: two-level idempotence rules over two AND gates [**default**]
+   *
+   *  @warning This is an expert option to configure the bit-blasting engine.
+   */
+  EVALUE(AIG_OPT_LEVEL),
+  /*! **AIG rewriting.**
+   *
+   * Balance and rewrite the AIGs of assertions before encoding them to CNF.
+   * AND gates are replaced by smaller structures for the functions of their
+   * 4-input cuts.
+   *
+   * Values:
+   *  * **true**: enable
+   *  * **false**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure the bit-blasting engine.
+   */
+  EVALUE(AIG_REWRITE),
+  /*! **Maximum number of AND gates processed by AIG rewriting.**
+   *
+   * Assertions are not rewritten once the given number of AND gates was
+   * processed in total.
+   *
+   * Values:
+   *  * An unsigned integer value, 0 for no limit. [**default**: 0]
+   *
+   *  @warning This is an expert option to configure the bit-blasting engine.
+   */
+  EVALUE(AIG_REWRITE_MAX_ANDS),
+  /*! **Time limit for AIG rewriting in milliseconds.**
+   *
+   * Assertions are not rewritten once the given time was spent on AIG
+   * rewriting in total.
+   *
+   * Values:
+   *  * An unsigned integer value, 0 for no limit. [**default**: 0]
+   *
+   *  @warning This is an expert option to configure the bit-blasting engine.
+   */
+  EVALUE(AIG_REWRITE_TIME_LIMIT),
   /*! **Configure the bit-vector solver engine.**
    *
    * Values:
@@ -99,6 +151,31 @@ enum ENUM(Option)
    *                 propagation-based local search.
    */
   EVALUE(BV_SOLVER),
+  /*! **Bit-blasting encoding of unsigned division and remainder.**
+   *
+   * Values:
+   *  * **restoring**: Restoring divider. [**default**]
+   *  * **non-restoring**: Non-restoring divider, adds or subtracts the
+   *                       divisor in each step depending on the sign of the
+   *                       partial remainder.
+   *
+   *  @warning This is an expert option to configure the bit-blasting engine.
+   */
+  EVALUE(DIV_ENCODING),
+  /*! **Bit-blasting encoding of multiplication.**
+   *
+   * Values:
+   *  * **array**: Array of ripple-carry adders. [**default**]
+   *  * **dadda**: Dadda tree of full and half adders.
+   *  * **karatsuba**: Karatsuba multiplication of the lower halves of the
+   *                   operands and Dadda trees, reduces the number of AND
+   *                   gates for large bit-widths.
+   *  * **auto**: Array for bit-widths < 32, Dadda tree for bit-widths < 64
+   *              and Karatsuba otherwise.
+   *
+   *  @warning This is an expert option to configure the bit-blasting engine.
+   */
+  EVALUE(MUL_ENCODING),
   /*! **Rewrite level.**
    *
    * Values:
@@ -1094,7 +1094,8 @@ bitwuzla_print_formula(Bitwuzla *bitwuzla, const char *format, FILE *file)
   BITWUZLA_CHECK_NOT_NULL(file);
   std::stringstream ss;
   bitwuzla->d_bitwuzla->print_formula(ss, format);
-  fprintf(file, "%s", ss.str().c_str());
+  const std::string& str = ss.str();
+  fwrite(str.data(), 1, str.size(), file);
   BITWUZLA_TRY_CATCH_END;
 }
 
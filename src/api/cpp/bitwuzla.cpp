@@ -11,6 +11,7 @@
 #include <bitwuzla/cpp/bitwuzla.h>
 
 #include <array>
+#include <mutex>
 #include <type_traits>
 
 #include "api/checks.h"
@@ -22,6 +23,7 @@
 #include "node/node_utils.h"
 #include "node/unordered_node_ref_set.h"
 #include "option/option.h"
+#include "printer/binary_printer.h"
 #include "printer/printer.h"
 #include "solver/fp/floating_point.h"
 #include "solver/fp/rounding_mode.h"
@@ -54,9 +56,18 @@ using remove_const_ref = typename std::remove_const<typename std::remove_referen
 static const std::unordered_map<Option, bzla::option::Option> *s_internal_options = nullptr;
 static decltype(*s_internal_options) get_s_internal_options() {
   /** Map api options to internal options. */
-  if (!s_internal_options) {
+  static std::once_flag init;
+  std::call_once(init, [] {
     s_internal_options = new remove_const_ref<decltype(*s_internal_options)> {
+        {Option::AIG_OPT_LEVEL, bzla::option::Option::AIG_OPT_LEVEL},
+        {Option::AIG_REWRITE, bzla::option::Option::AIG_REWRITE},
+        {Option::AIG_REWRITE_MAX_ANDS,
+         bzla::option::Option::AIG_REWRITE_MAX_ANDS},
+        {Option::AIG_REWRITE_TIME_LIMIT,
+         bzla::option::Option::AIG_REWRITE_TIME_LIMIT},
         {Option::BV_SOLVER, bzla::option::Option::BV_SOLVER},
+        {Option::DIV_ENCODING, bzla::option::Option::DIV_ENCODING},
+        {Option::MUL_ENCODING, bzla::option::Option::MUL_ENCODING},
         {Option::LOGLEVEL, bzla::option::Option::LOG_LEVEL},
         {Option::PRODUCE_MODELS, bzla::option::Option::PRODUCE_MODELS},
         {Option::PRODUCE_UNSAT_ASSUMPTIONS,
@@ -108,41 +119,44 @@ static decltype(*s_internal_options) get_s_internal_options() {
         {Option::DBG_CHECK_UNSAT_CORE,
          bzla::option::Option::DBG_CHECK_UNSAT_CORE},
     };
-  }
+  });
   return *s_internal_options;
 }
 
 static const std::unordered_map<bzla::option::Option, Option> *s_options = nullptr;
 static decltype(*s_options) get_s_options() {
-  if (!s_options) {
+  static std::once_flag init;
+  std::call_once(init, [] {
     auto *tmp = new remove_const_ref<decltype(*s_options)>();
     _init_reverse(get_s_internal_options(), *tmp);
     s_options = tmp;
-  };
+  });
   return *s_options;
 }
 
 /** Map api result to internal result. */
 static const std::unordered_map<Result, bzla::Result> *s_internal_results = nullptr;
 static decltype(*s_internal_results) get_s_internal_results() {
-  if (!s_internal_results) {
+  static std::once_flag init;
+  std::call_once(init, [] {
     s_internal_results = new remove_const_ref<decltype(*s_internal_results)> {
       {Result::SAT, bzla::Result::SAT},
       {Result::UNSAT, bzla::Result::UNSAT},
       {Result::UNKNOWN, bzla::Result::UNKNOWN},
     };
-  }
+  });
   return *s_internal_results;
 };
 
 /** Map internal result to api result. */
 static const std::unordered_map<bzla::Result, Result> *s_results = nullptr;
 static decltype(*s_results) get_s_results() {
-  if (!s_results) {
+  static std::once_flag init;
+  std::call_once(init, [] {
     auto *tmp = new remove_const_ref<decltype(*s_results)>();
     _init_reverse(get_s_internal_results(), *tmp);
     s_results = tmp;
-  }
+  });
   return *s_results;
 }
 
@@ -150,7 +164,8 @@ static decltype(*s_results) get_s_results() {
 static const std::unordered_map<RoundingMode, bzla::RoundingMode>
     *s_internal_rms = nullptr;
 static decltype(*s_internal_rms) get_s_internal_rms() {
-  if (!s_internal_rms) {
+  static std::once_flag init;
+  std::call_once(init, [] {
     s_internal_rms = new remove_const_ref<decltype(*s_internal_rms)> {
         {RoundingMode::RNA, bzla::RoundingMode::RNA},
         {RoundingMode::RNE, bzla::RoundingMode::RNE},
@@ -158,25 +173,27 @@ static decltype(*s_internal_rms) get_s_internal_rms() {
         {RoundingMode::RTP, bzla::RoundingMode::RTP},
         {RoundingMode::RTZ, bzla::RoundingMode::RTZ},
     };
-  }
+  });
   return *s_internal_rms;
 }
 
 /** Map internal rounding mode to api rounding mode. */
 static const std::unordered_map<bzla::RoundingMode, RoundingMode> *s_rms = nullptr;
 static decltype(*s_rms) get_s_rms() {
-  if (!s_rms) {
+  static std::once_flag init;
+  std::call_once(init, [] {
     auto *tmp = new remove_const_ref<decltype(*s_rms)>();
     _init_reverse(get_s_internal_rms(), *tmp);
     s_rms = tmp;
-  }
+  });
   return *s_rms;
 }
 
 /** Map api node kind to internal node kind. */
 static const std::unordered_map<Kind, bzla::node::Kind> *s_internal_kinds = nullptr;
 static decltype(*s_internal_kinds) get_s_internal_kinds() {
-  if (!s_internal_kinds) {
+  static std::once_flag init;
+  std::call_once(init, [] {
     s_internal_kinds = new remove_const_ref<decltype(*s_internal_kinds)> {
       {Kind::CONSTANT, bzla::node::Kind::CONSTANT},
       {Kind::CONST_ARRAY, bzla::node::Kind::CONST_ARRAY},
@@ -284,18 +301,19 @@ static decltype(*s_internal_kinds) get_s_internal_kinds() {
       {Kind::FP_TO_SBV, bzla::node::Kind::FP_TO_SBV},
       {Kind::FP_TO_UBV, bzla::node::Kind::FP_TO_UBV},
     };
-  }
+  });
   return *s_internal_kinds;
 }
 
 /** Map internal node kind to api node kind. */
 static const std::unordered_map<bzla::node::Kind, Kind> *s_kinds = nullptr;
 static decltype(*s_kinds) get_s_kinds() {
-  if (!s_kinds) {
+  static std::once_flag init;
+  std::call_once(init, [] {
     auto *tmp = new remove_const_ref<decltype(*s_kinds)>();
     _init_reverse(get_s_internal_kinds(), *tmp);
     s_kinds = tmp;
-  }
+  });
   return *s_kinds;
 }
 
@@ -1505,8 +1523,16 @@ void
 Bitwuzla::print_formula(std::ostream &out, const std::string &format) const
 {
   BITWUZLA_CHECK_STR_NOT_EMPTY(format);
-  BITWUZLA_CHECK(format == "smt2") << "invalid format, expected 'smt2'";
-  bzla::Printer::print_formula(out, d_ctx->assertions());
+  BITWUZLA_CHECK(format == "smt2" || format == "binary")
+      << "invalid format, expected 'smt2' or 'binary'";
+  if (format == "binary")
+  {
+    bzla::BinaryPrinter::print_formula(out, d_ctx->assertions());
+  }
+  else
+  {
+    bzla::Printer::print_formula(out, d_ctx->assertions());
+  }
 }
 
 std::map<std::string, std::string>
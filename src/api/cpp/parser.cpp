@@ -13,6 +13,7 @@
 #include <bitwuzla/cpp/parser.h>
 
 #include "api/checks.h"
+#include "parser/binary/parser.h"
 #include "parser/btor2/parser.h"
 
 namespace bitwuzla::parser {
@@ -24,16 +25,21 @@ Parser::Parser(Options &options,
                const std::string &language)
 {
   BITWUZLA_CHECK_STR_NOT_EMPTY(infile_name);
-  BITWUZLA_CHECK(language == "smt2" || language == "btor2")
-      << "invalid input language, expected 'smt2' or 'btor2'";
+  BITWUZLA_CHECK(language == "smt2" || language == "btor2"
+                 || language == "binary")
+      << "invalid input language, expected 'smt2', 'btor2' or 'binary'";
   if (language == "smt2")
   {
     d_parser.reset(new bzla::parser::smt2::Parser(options, infile_name));
   }
-  else
+  else if (language == "btor2")
   {
     d_parser.reset(new bzla::parser::btor2::Parser(options, infile_name));
   }
+  else
+  {
+    d_parser.reset(new bzla::parser::binary::Parser(options, infile_name));
+  }
   BITWUZLA_CHECK(d_parser->error_msg().empty()) << d_parser->error_msg();
 }
 
@@ -43,18 +49,24 @@ Parser::Parser(Options &options,
                const std::string &language)
 {
   BITWUZLA_CHECK_STR_NOT_EMPTY(infile_name);
-  BITWUZLA_CHECK(language == "smt2" || language == "btor2")
-      << "invalid input language, expected 'smt2' or 'btor2'";
+  BITWUZLA_CHECK(language == "smt2" || language == "btor2"
+                 || language == "binary")
+      << "invalid input language, expected 'smt2', 'btor2' or 'binary'";
   if (language == "smt2")
   {
     d_parser.reset(
         new bzla::parser::smt2::Parser(options, infile_name, infile));
   }
-  else
+  else if (language == "btor2")
   {
     d_parser.reset(
         new bzla::parser::btor2::Parser(options, infile_name, infile));
   }
+  else
+  {
+    d_parser.reset(
+        new bzla::parser::binary::Parser(options, infile_name, infile));
+  }
   BITWUZLA_CHECK(d_parser->error_msg().empty()) << d_parser->error_msg();
 }
 
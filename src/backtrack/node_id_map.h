@@ -0,0 +1,79 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_BACKTRACK_NODE_ID_MAP_H_INCLUDED
+#define BZLA_BACKTRACK_NODE_ID_MAP_H_INCLUDED
+
+#include <cassert>
+#include <functional>
+#include <vector>
+
+#include "backtrack/backtrackable.h"
+#include "node/node_id_map.h"
+
+namespace bzla::backtrack {
+
+template <class T>
+class NodeIdMap : public Backtrackable
+{
+ public:
+  NodeIdMap() = delete;
+  NodeIdMap(BacktrackManager* mgr) : Backtrackable(mgr) {}
+
+  /* --- node::NodeIdMap interface ------------------------------------------ */
+
+  std::size_t size() const { return d_data.size(); }
+
+  bool empty() const { return d_data.empty(); }
+
+  auto find(const Node& key) const { return d_data.find(key); }
+
+  std::size_t count(const Node& key) const { return d_data.count(key); }
+
+  template <class... Args>
+  auto emplace(const Node& key, Args&&... args)
+  {
+    auto [it, inserted] = d_data.emplace(key, std::forward<Args>(args)...);
+    if (inserted)
+    {
+      d_keys.emplace_back(it->first);
+    }
+    return std::make_pair(it, inserted);
+  }
+
+  auto begin() const { return d_data.begin(); }
+
+  auto end() const { return d_data.end(); }
+
+  /* --- Backtrackable interface -------------------------------------------- */
+
+  void push() override { d_control.push_back(d_keys.size()); }
+
+  void pop() override
+  {
+    assert(!d_control.empty());
+    std::size_t pop_to = d_control.back();
+    assert(pop_to <= d_keys.size());
+    d_control.pop_back();
+
+    while (d_keys.size() > pop_to)
+    {
+      d_data.erase(d_keys.back());
+      d_keys.pop_back();
+    }
+  }
+
+ private:
+  node::NodeIdMap<T> d_data;
+  std::vector<std::reference_wrapper<const Node>> d_keys;
+};
+
+}  // namespace bzla::backtrack
+#endif
@@ -0,0 +1,84 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_BACKTRACK_NODE_ID_SET_H_INCLUDED
+#define BZLA_BACKTRACK_NODE_ID_SET_H_INCLUDED
+
+#include <cassert>
+#include <functional>
+#include <vector>
+
+#include "backtrack/backtrackable.h"
+#include "node/node_id_set.h"
+#include "util/memory.h"
+
+namespace bzla::backtrack {
+
+class NodeIdSet : public Backtrackable
+{
+ public:
+  NodeIdSet() = delete;
+  NodeIdSet(BacktrackManager* mgr) : Backtrackable(mgr) {}
+
+  /* --- node::NodeIdSet interface ------------------------------------------ */
+
+  std::size_t size() const { return d_data.size(); }
+
+  bool empty() const { return d_data.empty(); }
+
+  auto find(const Node& node) const { return d_data.find(node); }
+
+  std::size_t count(const Node& node) const { return d_data.count(node); }
+
+  auto insert(const Node& node)
+  {
+    auto [it, inserted] = d_data.insert(node);
+    if (inserted)
+    {
+      d_values.emplace_back(*it);
+    }
+    return std::make_pair(it, inserted);
+  }
+
+  auto begin() const { return d_data.begin(); }
+
+  auto end() const { return d_data.end(); }
+
+  /** @return The number of bytes allocated by this container. */
+  std::size_t memory_usage() const
+  {
+    return d_data.memory_usage() + util::memory_usage(d_values);
+  }
+
+  /* --- Backtrackable interface -------------------------------------------- */
+
+  void push() override { d_control.push_back(d_values.size()); }
+
+  void pop() override
+  {
+    assert(!d_control.empty());
+    std::size_t pop_to = d_control.back();
+    assert(pop_to <= d_values.size());
+    d_control.pop_back();
+
+    while (d_values.size() > pop_to)
+    {
+      d_data.erase(d_values.back());
+      d_values.pop_back();
+    }
+  }
+
+ private:
+  node::NodeIdSet d_data;
+  std::vector<std::reference_wrapper<const Node>> d_values;
+};
+
+}  // namespace bzla::backtrack
+#endif
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "backtrack/backtrackable.h"
+#include "util/memory.h"
 
 namespace bzla::backtrack {
 
@@ -49,6 +50,12 @@ class unordered_map : public Backtrackable
 
   auto end() const { return d_data.end(); }
 
+  /** @return The number of bytes allocated by this container. */
+  std::size_t memory_usage() const
+  {
+    return util::memory_usage(d_data) + util::memory_usage(d_keys);
+  }
+
   /* --- Backtrackable interface -------------------------------------------- */
 
   void push() override { d_control.push_back(d_keys.size()); }
@@ -10,21 +10,22 @@
 
 #include "bitblast/aig/aig_cnf.h"
 
-#include <functional>
+#include <unordered_set>
 
 namespace bzla::bb {
 
 void
 AigCnfEncoder::encode(const AigNode& node, bool top_level)
 {
+  d_mgr.inc_ref(node);
   if (top_level)
   {
     std::unordered_set<int64_t> cache;
-    std::vector<std::reference_wrapper<const AigNode>> visit{node};
-    std::vector<std::reference_wrapper<const AigNode>> children;
+    std::vector<AigNode> visit{node};
+    std::vector<AigNode> children;
     do
     {
-      const AigNode& cur = visit.back();
+      AigNode cur = visit.back();
       visit.pop_back();
 
       auto [it, inserted] = cache.insert(cur.get_id());
@@ -33,10 +34,10 @@ AigCnfEncoder::encode(const AigNode& node, bool top_level)
         continue;
       }
 
-      if (cur.is_and() && !cur.is_negated())
+      if (d_mgr.is_and(cur) && !cur.is_negated())
       {
-        visit.push_back(cur[1]);
-        visit.push_back(cur[0]);
+        visit.push_back(d_mgr.get_child(cur, 1));
+        visit.push_back(d_mgr.get_child(cur, 0));
       }
       else
       {
@@ -85,49 +86,54 @@ AigCnfEncoder::statistics() const
   return d_statistics;
 }
 
+size_t
+AigCnfEncoder::memory_usage() const
+{
+  return d_aig_encoded.capacity() / 8;
+}
+
 void
 AigCnfEncoder::_encode(const AigNode& aig)
 {
-  std::vector<const AigNode*> visit;
-  std::unordered_set<const AigNode*> cache;
-  visit.push_back(&aig);
+  // Pairs of AIG node and flag indicating whether its children were visited.
+  std::vector<std::pair<AigNode, bool>> visit;
+  visit.emplace_back(aig, false);
   do
   {
-    auto cur = visit.back();
-    resize(*cur);
+    auto& [cur, expanded] = visit.back();
+    resize(cur);
 
-    if (is_encoded(*cur))
+    if (is_encoded(cur))
     {
       visit.pop_back();
       continue;
     }
 
-    if (cur->is_true() || cur->is_false() || cur->is_const())
+    if (cur.is_true() || cur.is_false() || d_mgr.is_const(cur))
     {
-      visit.pop_back();
-      set_encoded(*cur);
-      if (cur->is_true() || cur->is_false())
+      set_encoded(cur);
+      if (cur.is_true() || cur.is_false())
       {
-        d_sat_solver.add_clause({std::abs(cur->get_id())});
+        d_sat_solver.add_clause({std::abs(cur.get_id())});
         ++d_statistics.num_clauses;
         ++d_statistics.num_literals;
       }
+      visit.pop_back();
     }
     else
     {
-      assert(cur->is_and());
-
-      auto [it, inserted] = cache.insert(cur);
+      assert(d_mgr.is_and(cur));
 
-      if (inserted)
+      if (!expanded)
       {
-        visit.push_back(&(*cur)[0]);
-        visit.push_back(&(*cur)[1]);
+        expanded     = true;
+        AigNode node = cur;
+        visit.emplace_back(d_mgr.get_child(node, 0), false);
+        visit.emplace_back(d_mgr.get_child(node, 1), false);
       }
       else
       {
-        visit.pop_back();
-        set_encoded(*cur);
+        set_encoded(cur);
 
         // TODO: and optimization: collect all children and encode one big and
         // TODO: xor optimization: use native xor encoding
@@ -137,9 +143,10 @@ AigCnfEncoder::_encode(const AigNode& aig)
         //
         // x <-> a /\ b --> (~x \/ a) /\ (~x \/ b) /\ (x \/ ~a \/ ~b)
 
-        auto x = std::abs(cur->get_id());
-        auto a = (*cur)[0].get_id();
-        auto b = (*cur)[1].get_id();
+        auto x = std::abs(cur.get_id());
+        auto a = d_mgr.get_child(cur, 0).get_id();
+        auto b = d_mgr.get_child(cur, 1).get_id();
+        visit.pop_back();
 
         d_sat_solver.add_clause({-x, a});
         d_sat_solver.add_clause({-x, b});
@@ -45,10 +45,17 @@ class AigCnfEncoder
     uint64_t num_literals = 0;  // Number of added literals
   };
 
-  AigCnfEncoder(SatInterface& sat_solver) : d_sat_solver(sat_solver){};
+  /**
+   * Constructor.
+   * @param mgr The AIG manager of the nodes to encode.
+   * @param sat_solver The SAT solver to add the clauses to.
+   */
+  AigCnfEncoder(AigManager& mgr, SatInterface& sat_solver)
+      : d_mgr(mgr), d_sat_solver(sat_solver){};
 
   /**
-   * Recursively encodes AIG node to CNF.
+   * Recursively encodes AIG node to CNF. The node is referenced in the AIG
+   * manager, encoded nodes are not released on garbage collection.
    *
    * @param node The AIG node to encode.
    * @param top_level Indicates whether given node is at the top level, which
@@ -61,6 +68,12 @@ class AigCnfEncoder
   /** @return CNF statistics. */
   const Statistics& statistics() const;
 
+  /**
+   * @return The number of bytes allocated by the encoder. Does not include
+   *         the memory required by the SAT solver for the encoded clauses.
+   */
+  size_t memory_usage() const;
+
  private:
   /** Encode AIG to CNF. */
   void _encode(const AigNode& node);
@@ -71,6 +84,8 @@ class AigCnfEncoder
   /** Mark `aig` as encoded. */
   void set_encoded(const AigNode& aig);
 
+  /** The associated AIG manager. */
+  AigManager& d_mgr;
   /** Maps AIG id to flag that indicates whether the AIG was already encoded. */
   std::vector<bool> d_aig_encoded;
   /** SAT solver. */
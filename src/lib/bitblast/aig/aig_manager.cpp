@@ -10,12 +10,16 @@
 
 #include "bitblast/aig/aig_manager.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
 namespace bzla::bb {
 
 bool
 operator==(const AigNode& a, const AigNode& b)
 {
-  return a.get_id() == b.get_id();
+  return a.get_lit() == b.get_lit();
 }
 
 bool
@@ -24,290 +28,99 @@ operator<(const AigNode& a, const AigNode& b)
   return a.get_id() < b.get_id();
 }
 
-/**
- * AigNodeData storing all node data.
- */
-class AigNodeData
-{
-  friend AigManager;
-  friend class AigNode;
-  friend class AigNodeUniqueTable;
-
- public:
-  AigNodeData() = delete;
-  ~AigNodeData() { assert(d_refs == 0); }
-
-  void inc_refs() { ++d_refs; }
-  void dec_refs()
-  {
-    assert(d_refs > 0);
-    --d_refs;
-    if (d_refs == 0)
-    {
-      d_mgr->garbage_collect(this);
-    }
-  }
-
- private:
-  AigNodeData(AigManager* mgr) : d_mgr(mgr) {}
-  AigNodeData(AigManager* mgr, const AigNode& left, const AigNode& right)
-      : d_mgr(mgr), d_left(left), d_right(right)
-  {
-  }
-
-  /** Pointer to AIG Manager to allow automatic deletion. */
-  AigManager* d_mgr = nullptr;
-
-  /** AIG node id. */
-  int64_t d_id = 0;
-  /** Reference count. */
-  uint64_t d_refs = 0;
-  /** Left child of AND gate. */
-  AigNode d_left;
-  /** Right child of AND gate. */
-  AigNode d_right;
-
-  /** Next pointer for collision chain. */
-  AigNodeData* next = nullptr;
-};
-
 // AigNodeUniqueTable
 
-AigNodeUniqueTable::AigNodeUniqueTable() { d_buckets.resize(16, nullptr); }
+AigNodeUniqueTable::AigNodeUniqueTable(std::vector<AigNodeData>& nodes)
+    : d_nodes(nodes)
+{
+  d_buckets.resize(16, 0);
+}
 
-std::pair<bool, AigNodeData*>
-AigNodeUniqueTable::insert(AigNodeData* d)
+uint32_t
+AigNodeUniqueTable::find(uint32_t left, uint32_t right) const
 {
-  size_t h         = hash(d->d_left, d->d_right);
-  AigNodeData* cur = d_buckets[h];
-  int64_t left_id  = d->d_left.get_id();
-  int64_t right_id = d->d_right.get_id();
+  uint32_t cur = d_buckets[hash(left, right)];
 
   // Check collision chain.
   while (cur)
   {
-    if (cur->d_left.get_id() == left_id && cur->d_right.get_id() == right_id)
+    const AigNodeData& d = d_nodes[cur];
+    if (d.d_left == left && d.d_right == right)
     {
-      return std::make_pair(false, cur);
+      return cur;
     }
-    cur = cur->next;
+    cur = d.d_next;
   }
+  return 0;
+}
 
-  if (d_num_elements == d_buckets.capacity())
+void
+AigNodeUniqueTable::insert(uint32_t id)
+{
+  if (d_num_elements == d_buckets.size())
   {
     resize();
-    h = hash(d->d_left, d->d_right);
   }
-  assert(d->next == nullptr);
-  d->next      = d_buckets[h];
-  d_buckets[h] = d;
-
+  AigNodeData& d = d_nodes[id];
+  size_t h       = hash(d.d_left, d.d_right);
+  assert(d.d_next == 0);
+  d.d_next     = d_buckets[h];
+  d_buckets[h] = id;
   ++d_num_elements;
-  return std::make_pair(true, d);
 }
 
 void
-AigNodeUniqueTable::erase(const AigNodeData* d)
+AigNodeUniqueTable::clear()
 {
-  size_t h          = hash(d->d_left, d->d_right);
-  AigNodeData* cur  = d_buckets[h];
-  AigNodeData* prev = nullptr;
-  assert(cur != nullptr);
-
-  // Should not happen
-  if (cur == nullptr)
-  {
-    return;
-  }
-
-  // Find data in collision chain.
-  int64_t left_id  = d->d_left.get_id();
-  int64_t right_id = d->d_right.get_id();
-  while (cur)
-  {
-    if (cur->d_left.get_id() == left_id && cur->d_right.get_id() == right_id)
-    {
-      break;
-    }
-    prev = cur;
-    cur  = cur->next;
-  }
-  assert(cur);
+  std::fill(d_buckets.begin(), d_buckets.end(), 0);
+  d_num_elements = 0;
+}
 
-  // Update collision chain.
-  if (prev == nullptr)
-  {
-    d_buckets[h] = cur->next;
-  }
-  else
-  {
-    prev->next = cur->next;
-  }
-  --d_num_elements;
+size_t
+AigNodeUniqueTable::memory_usage() const
+{
+  return d_buckets.capacity() * sizeof(uint32_t);
 }
 
 size_t
-AigNodeUniqueTable::hash(const AigNode& left, const AigNode& right)
+AigNodeUniqueTable::hash(uint32_t left, uint32_t right) const
 {
-  size_t lhs = static_cast<size_t>(std::abs(left.get_id()));
-  size_t rhs = static_cast<size_t>(std::abs(right.get_id()));
-  size_t h   = 547789289u * lhs + 786695309u * rhs;
-  return h & (d_buckets.capacity() - 1);
+  size_t h = 547789289u * static_cast<size_t>(left >> 1)
+             + 786695309u * static_cast<size_t>(right >> 1);
+  return h & (d_buckets.size() - 1);
 }
 
 void
 AigNodeUniqueTable::resize()
 {
-  auto buckets = d_buckets;
-
-  d_buckets.clear();
-  d_buckets.resize(d_buckets.capacity() * 2, nullptr);
+  std::vector<uint32_t> buckets(d_buckets.size() * 2, 0);
+  d_buckets.swap(buckets);
 
   // Rehash elements.
-  for (auto cur : buckets)
+  for (uint32_t cur : buckets)
   {
     while (cur)
     {
-      size_t h     = hash(cur->d_left, cur->d_right);
-      auto next    = cur->next;
-      cur->next    = d_buckets[h];
-      d_buckets[h] = cur;
-      cur          = next;
+      AigNodeData& d = d_nodes[cur];
+      size_t h       = hash(d.d_left, d.d_right);
+      uint32_t next  = d.d_next;
+      d.d_next       = d_buckets[h];
+      d_buckets[h]   = cur;
+      cur            = next;
     }
   }
 }
 
-// AigNode
-
-AigNode::AigNode(AigNodeData* data, bool negated)
-    : d_data(data), d_negated(negated)
-{
-  d_data->inc_refs();
-};
-
-AigNode::~AigNode()
-{
-  if (!is_null())
-  {
-    d_data->dec_refs();
-  }
-}
-
-AigNode::AigNode(const AigNode& other)
-    : d_data(other.d_data), d_negated(other.d_negated)
-{
-  assert(!other.is_null());
-  d_data->inc_refs();
-}
-
-AigNode&
-AigNode::operator=(const AigNode& other)
-{
-  if (d_data)
-  {
-    d_data->dec_refs();
-  }
-  d_data    = other.d_data;
-  d_negated = other.d_negated;
-  d_data->inc_refs();
-  return *this;
-}
-
-AigNode::AigNode(AigNode&& other)
-{
-  if (d_data)
-  {
-    d_data->dec_refs();
-  }
-  d_data       = other.d_data;
-  d_negated    = other.d_negated;
-  other.d_data = nullptr;
-}
-
-AigNode&
-AigNode::operator=(AigNode&& other)
-{
-  if (d_data)
-  {
-    d_data->dec_refs();
-  }
-  d_data       = other.d_data;
-  d_negated    = other.d_negated;
-  other.d_data = nullptr;
-  return *this;
-}
-
-bool
-AigNode::is_true() const
-{
-  return d_data->d_id == AigNode::s_true_id && !is_negated();
-}
-
-bool
-AigNode::is_false() const
-{
-  return d_data->d_id == AigNode::s_true_id && is_negated();
-}
-
-bool
-AigNode::is_and() const
-{
-  return !d_data->d_left.is_null();
-}
-
-bool
-AigNode::is_const() const
-{
-  return !is_and() && !is_true() && !is_false();
-}
-
-bool
-AigNode::is_negated() const
-{
-  return d_negated;
-}
-
-const AigNode&
-AigNode::operator[](int index) const
-{
-  assert(is_and());
-  if (index == 0)
-  {
-    return d_data->d_left;
-  }
-  assert(index == 1);
-  return d_data->d_right;
-}
-
-int64_t
-AigNode::get_id() const
-{
-  // only  happens if constructed with default constructor
-  if (is_null())
-  {
-    return 0;
-  }
-  return is_negated() ? -d_data->d_id : d_data->d_id;
-}
-
-bool
-AigNode::is_null() const
-{
-  return d_data == nullptr;
-}
-
-uint64_t
-AigNode::get_refs() const
-{
-  assert(!is_null());
-  return d_data->d_refs;
-}
-
 // BitNodeInterface<AigNode>
 
-AigManager::BitInterface()
-    : d_true(new_data(), false), d_false(d_true.d_data, true)
+AigManager::BitInterface(uint8_t opt_level)
+    : d_nodes(1),
+      d_unique_table(d_nodes),
+      d_true(2 * new_data()),
+      d_opt_level(opt_level)
 {
+  assert(d_opt_level <= OPT_LEVEL_MAX);
+  d_false = mk_not(d_true);
   assert(d_true.get_id() == AigNode::s_true_id);
   assert(d_false.get_id() == -AigNode::s_true_id);
 }
@@ -330,13 +143,13 @@ AigNode
 AigManager::mk_bit()
 {
   ++d_statistics.num_consts;
-  return AigNode(new_data());
+  return AigNode(2 * new_data());
 }
 
 AigNode
 AigManager::mk_not(const AigNode& a)
 {
-  return AigNode(a.d_data, !a.is_negated());
+  return AigNode(a.d_lit ^ 1);
 }
 
 AigNode
@@ -363,39 +176,133 @@ AigManager::mk_ite(const AigNode& c, const AigNode& a, const AigNode& b)
   return mk_or(mk_and(c, a), mk_and(mk_not(c), b));
 }
 
+std::optional<AigNode>
+AigManager::find_and(const AigNode& a, const AigNode& b) const
+{
+  bool swap = std::abs(a.get_id()) > std::abs(b.get_id());
+  uint32_t id =
+      d_unique_table.find(swap ? b.d_lit : a.d_lit, swap ? a.d_lit : b.d_lit);
+  if (id)
+  {
+    return AigNode(2 * id);
+  }
+  return std::nullopt;
+}
+
+void
+AigManager::inc_ref(const AigNode& a)
+{
+  assert(!a.is_null());
+  ++d_nodes[a.d_lit >> 1].d_refs;
+}
+
+void
+AigManager::dec_ref(const AigNode& a)
+{
+  assert(!a.is_null());
+  AigNodeData& d = d_nodes[a.d_lit >> 1];
+  assert(d.d_refs > 0);
+  --d.d_refs;
+}
+
+size_t
+AigManager::garbage_collect()
+{
+  // Released nodes in the free list and the true node are never collected.
+  std::vector<bool> mark(d_nodes.size(), false);
+  mark[AigNode::s_true_id] = true;
+  for (uint32_t id = d_free; id; id = d_nodes[id].d_next)
+  {
+    mark[id] = true;
+  }
+
+  // Mark the cones of referenced nodes.
+  std::vector<uint32_t> visit;
+  for (uint32_t id = 1, size = d_nodes.size(); id < size; ++id)
+  {
+    if (d_nodes[id].d_refs > 0)
+    {
+      visit.push_back(id);
+    }
+  }
+  while (!visit.empty())
+  {
+    uint32_t id = visit.back();
+    visit.pop_back();
+    if (mark[id])
+    {
+      continue;
+    }
+    mark[id]             = true;
+    const AigNodeData& d = d_nodes[id];
+    if (d.d_left)
+    {
+      visit.push_back(d.d_left >> 1);
+      visit.push_back(d.d_right >> 1);
+    }
+  }
+
+  // Release unmarked nodes and rebuild the unique table over the remaining
+  // AND gates.
+  size_t num_released = 0;
+  d_unique_table.clear();
+  for (uint32_t id = 1, size = d_nodes.size(); id < size; ++id)
+  {
+    AigNodeData& d = d_nodes[id];
+    if (mark[id])
+    {
+      if (d.d_left)
+      {
+        d.d_next = 0;
+        d_unique_table.insert(id);
+      }
+      continue;
+    }
+    if (d.d_left)
+    {
+      --d_statistics.num_ands;
+    }
+    else
+    {
+      --d_statistics.num_consts;
+    }
+    d      = {0, 0, d_free, 0};
+    d_free = id;
+    ++num_released;
+  }
+  ++d_statistics.num_gc;
+  d_statistics.num_released += num_released;
+  return num_released;
+}
+
 const AigManager::Statistics&
 AigManager::statistics() const
 {
   return d_statistics;
 }
 
-void
-AigManager::init_id(AigNodeData* d)
+size_t
+AigManager::memory_usage() const
 {
-  assert(d_aig_id_counter < INT64_MAX);
-  assert(d != nullptr);
-  assert(d->d_id == 0);
-  d_node_data.emplace_back(d);
-  assert(d_node_data.size() == static_cast<size_t>(d_aig_id_counter));
-  d->d_id = d_aig_id_counter++;
+  return d_nodes.capacity() * sizeof(AigNodeData)
+         + d_unique_table.memory_usage();
 }
 
-AigNodeData*
+AigNode
 AigManager::find_or_create_and(const AigNode& left, const AigNode& right)
 {
-  assert(std::abs(left.get_id()) < std::abs(right.get_id()));
-  AigNodeData* d          = new AigNodeData(this, left, right);
-  auto [inserted, lookup] = d_unique_table.insert(d);
-  if (!inserted)
+  assert(std::abs(left.get_id()) <= std::abs(right.get_id()));
+  uint32_t id = d_unique_table.find(left.d_lit, right.d_lit);
+  if (id)
   {
     ++d_statistics.num_shared;
-    delete d;
-    return lookup;
+    return AigNode(2 * id);
   }
 
-  init_id(d);
+  id = new_data(left.d_lit, right.d_lit);
+  d_unique_table.insert(id);
   ++d_statistics.num_ands;
-  return d;
+  return AigNode(2 * id);
 }
 
 AigNode
@@ -403,55 +310,73 @@ AigManager::rewrite_and(const AigNode& l, const AigNode& r)
 {
   AigNode left  = l;
   AigNode right = r;
-  do
+  while (d_opt_level > 0)
   {
     /** Optimization level 1 */
 
     // Neutrality rule
     //   shape:  a /\ 1
     //   result: a
-    //
-    // Idempotence rule
-    //   shape:     a /\ b
-    //   condition: a = b
-    //   result:    a
-    if (left.is_true() || left == right)
+    if (left.is_true())
     {
+      ++d_statistics.num_rw_neutrality;
       return right;
     }
     if (right.is_true())
     {
+      ++d_statistics.num_rw_neutrality;
       return left;
     }
+    // Idempotence rule
+    //   shape:     a /\ b
+    //   condition: a = b
+    //   result:    a
+    if (left == right)
+    {
+      ++d_statistics.num_rw_idempotence;
+      return right;
+    }
     // Boundedness rule
     //   shape:  a /\ 0
     //   result: 0
-    //
+    if (left.is_false() || right.is_false())
+    {
+      ++d_statistics.num_rw_boundedness;
+      return d_false;
+    }
     // Contradiction rule
     //   shape:     a /\ ~b
     //   condition: a = b
     //   result:    0
-    if (left.is_false() || right.is_false() || left.get_id() == -right.get_id())
+    if (left.get_id() == -right.get_id())
     {
+      ++d_statistics.num_rw_contradiction;
       return d_false;
     }
 
+    if (d_opt_level < 2)
+    {
+      break;
+    }
+
     /** Optimization level 2 */
 
     // Contradiction rule (assymetric)
     //   shape:     (a /\ b) /\ c
     //   condition: (a = ~c) \/ (b = ~c)
     //   result:    0
-    if (left.is_and() && !left.is_negated()
-        && (left[0].get_id() == -right.get_id()
-            || left[1].get_id() == -right.get_id()))
+    if (is_and(left) && !left.is_negated()
+        && (get_child(left, 0).get_id() == -right.get_id()
+            || get_child(left, 1).get_id() == -right.get_id()))
     {
+      ++d_statistics.num_rw_contradiction;
       return d_false;
     }
-    if (right.is_and() && !right.is_negated()
-        && (right[0].get_id() == -left.get_id()
-            || right[1].get_id() == -left.get_id()))
+    if (is_and(right) && !right.is_negated()
+        && (get_child(right, 0).get_id() == -left.get_id()
+            || get_child(right, 1).get_id() == -left.get_id()))
     {
+      ++d_statistics.num_rw_contradiction;
       return d_false;
     }
 
@@ -459,13 +384,14 @@ AigManager::rewrite_and(const AigNode& l, const AigNode& r)
     //   shape:     (a /\ b) /\ (c /\ d)
     //   condition: (a = ~c) \/ (a = ~d) \/ (b = ~c) \/ (b = ~d)
     //   result:    0
-    if (left.is_and() && !left.is_negated() && right.is_and()
+    if (is_and(left) && !left.is_negated() && is_and(right)
         && !right.is_negated()
-        && (left[0].get_id() == -right[0].get_id()
-            || left[0].get_id() == -right[1].get_id()
-            || left[1].get_id() == -right[0].get_id()
-            || left[1].get_id() == -right[1].get_id()))
+        && (get_child(left, 0).get_id() == -get_child(right, 0).get_id()
+            || get_child(left, 0).get_id() == -get_child(right, 1).get_id()
+            || get_child(left, 1).get_id() == -get_child(right, 0).get_id()
+            || get_child(left, 1).get_id() == -get_child(right, 1).get_id()))
     {
+      ++d_statistics.num_rw_contradiction;
       return d_false;
     }
 
@@ -473,16 +399,18 @@ AigManager::rewrite_and(const AigNode& l, const AigNode& r)
     //   shape:     ~(a /\ b) /\ c
     //   condition: (a = ~c) \/ (b = ~c)
     //   result:    c
-    if (left.is_and() && left.is_negated()
-        && (left[0].get_id() == -right.get_id()
-            || left[1].get_id() == -right.get_id()))
+    if (is_and(left) && left.is_negated()
+        && (get_child(left, 0).get_id() == -right.get_id()
+            || get_child(left, 1).get_id() == -right.get_id()))
     {
+      ++d_statistics.num_rw_subsumption;
       return right;
     }
-    if (right.is_and() && right.is_negated()
-        && (right[0].get_id() == -left.get_id()
-            || right[1].get_id() == -left.get_id()))
+    if (is_and(right) && right.is_negated()
+        && (get_child(right, 0).get_id() == -left.get_id()
+            || get_child(right, 1).get_id() == -left.get_id()))
     {
+      ++d_statistics.num_rw_subsumption;
       return left;
     }
 
@@ -490,22 +418,24 @@ AigManager::rewrite_and(const AigNode& l, const AigNode& r)
     //   shape:     ~(a /\ b) /\ (c /\ d)
     //   condition: (a = ~c) \/ (a = ~d) \/ (b = ~c) \/ (b = ~d)
     //   result:    c /\ d
-    if (left.is_and() && left.is_negated() && right.is_and()
+    if (is_and(left) && left.is_negated() && is_and(right)
         && !right.is_negated()
-        && (left[0].get_id() == -right[0].get_id()
-            || left[0].get_id() == -right[1].get_id()
-            || left[1].get_id() == -right[0].get_id()
-            || left[1].get_id() == -right[1].get_id()))
+        && (get_child(left, 0).get_id() == -get_child(right, 0).get_id()
+            || get_child(left, 0).get_id() == -get_child(right, 1).get_id()
+            || get_child(left, 1).get_id() == -get_child(right, 0).get_id()
+            || get_child(left, 1).get_id() == -get_child(right, 1).get_id()))
     {
+      ++d_statistics.num_rw_subsumption;
       return right;
     }
-    if (right.is_and() && right.is_negated() && left.is_and()
+    if (is_and(right) && right.is_negated() && is_and(left)
         && !left.is_negated()
-        && (right[0].get_id() == -left[0].get_id()
-            || right[0].get_id() == -left[1].get_id()
-            || right[1].get_id() == -left[0].get_id()
-            || right[1].get_id() == -left[1].get_id()))
+        && (get_child(right, 0).get_id() == -get_child(left, 0).get_id()
+            || get_child(right, 0).get_id() == -get_child(left, 1).get_id()
+            || get_child(right, 1).get_id() == -get_child(left, 0).get_id()
+            || get_child(right, 1).get_id() == -get_child(left, 1).get_id()))
     {
+      ++d_statistics.num_rw_subsumption;
       return left;
     }
 
@@ -513,14 +443,16 @@ AigManager::rewrite_and(const AigNode& l, const AigNode& r)
     //   shape:     (a /\ b) /\ c
     //   condition: (a = c) \/ (b = c)
     //   result:    (a /\ b)
-    if (left.is_and() && !left.is_negated()
-        && (left[0] == right || left[1] == right))
+    if (is_and(left) && !left.is_negated()
+        && (get_child(left, 0) == right || get_child(left, 1) == right))
     {
+      ++d_statistics.num_rw_idempotence;
       return left;
     }
-    if (right.is_and() && !right.is_negated()
-        && (right[0] == left || right[1] == left))
+    if (is_and(right) && !right.is_negated()
+        && (get_child(right, 0) == left || get_child(right, 1) == left))
     {
+      ++d_statistics.num_rw_idempotence;
       return right;
     }
 
@@ -528,52 +460,67 @@ AigManager::rewrite_and(const AigNode& l, const AigNode& r)
     //   shape:     ~(a /\ b) /\ ~(c /\ d)
     //   condition: (a = d) /\ (b = ~c)
     //   result:    ~a
-    if (left.is_negated() && left.is_and() && right.is_negated()
-        && right.is_and())
+    if (left.is_negated() && is_and(left) && right.is_negated()
+        && is_and(right))
     {
-      if ((left[0] == right[0] && left[1].get_id() == -right[1].get_id())
-          || (left[0] == right[1] && left[1].get_id() == -right[0].get_id()))
+      if ((get_child(left, 0) == get_child(right, 0)
+           && get_child(left, 1).get_id() == -get_child(right, 1).get_id())
+          || (get_child(left, 0) == get_child(right, 1)
+              && get_child(left, 1).get_id() == -get_child(right, 0).get_id()))
       {
-        return mk_not(left[0]);
+        ++d_statistics.num_rw_resolution;
+        return mk_not(get_child(left, 0));
       }
-      if ((right[1] == left[1] && right[0].get_id() == -left[0].get_id())
-          || (right[1] == left[0] && right[0].get_id() == -left[1].get_id()))
+      if ((get_child(right, 1) == get_child(left, 1)
+           && get_child(right, 0).get_id() == -get_child(left, 0).get_id())
+          || (get_child(right, 1) == get_child(left, 0)
+              && get_child(right, 0).get_id() == -get_child(left, 1).get_id()))
       {
-        return mk_not(right[1]);
+        ++d_statistics.num_rw_resolution;
+        return mk_not(get_child(right, 1));
       }
     }
 
+    if (d_opt_level < 3)
+    {
+      break;
+    }
+
     /** Optimization level 3 **/
 
     // Substitution rule (asymmetric)
     //   shape:     ~(a /\ b) /\ c
     //   condition: b = c
     //   result:    ~a /\ c
-    if (left.is_and() && left.is_negated())
+    if (is_and(left) && left.is_negated())
     {
       // (a = c) -> ~b /\ c
-      if (left[0] == right)
+      if (get_child(left, 0) == right)
       {
-        left = mk_not(left[1]);
+        left = mk_not(get_child(left, 1));
+        ++d_statistics.num_rw_substitution;
         continue;
       }
       // (b = c) -> ~a /\ c
-      if (left[1] == right)
+      if (get_child(left, 1) == right)
       {
-        left = mk_not(left[0]);
+        left = mk_not(get_child(left, 0));
+        ++d_statistics.num_rw_substitution;
         continue;
       }
     }
-    if (right.is_and() && right.is_negated())
+    if (is_and(right) && right.is_negated())
     {
-      if (right[0] == left)
+      if (get_child(right, 0) == left)
       {
-        right = mk_not(right[1]);
+        right = mk_not(get_child(right, 1));
+        ++d_statistics.num_rw_substitution;
         continue;
       }
-      else if (right[1] == left)
+      else if (get_child(right, 1) == left)
       {
-        right = mk_not(right[0]);
+        right = mk_not(get_child(right, 0));
+        ++d_statistics.num_rw_substitution;
         continue;
       }
     }
@@ -582,62 +529,79 @@ AigManager::rewrite_and(const AigNode& l, const AigNode& r)
     //   shape:     ~(a /\ b) /\ (c /\ d)
     //   condition: b = c
     //   result:    ~a /\ (c /\ d)
-    if (left.is_and() && left.is_negated() && right.is_and()
+    if (is_and(left) && left.is_negated() && is_and(right)
         && !right.is_negated())
     {
       // (a = c) \/ (a = d) -> ~b /\ (c /\ d)
-      if (left[0] == right[0] || left[0] == right[1])
+      if (get_child(left, 0) == get_child(right, 0)
+          || get_child(left, 0) == get_child(right, 1))
       {
-        left = mk_not(left[1]);
+        left = mk_not(get_child(left, 1));
+        ++d_statistics.num_rw_substitution;
         continue;
       }
       // (b = c) \/ (b = d) -> ~a /\ (c /\ d)
-      if (left[1] == right[0] || left[1] == right[1])
+      if (get_child(left, 1) == get_child(right, 0)
+          || get_child(left, 1) == get_child(right, 1))
       {
-        left = mk_not(left[0]);
+        left = mk_not(get_child(left, 0));
+        ++d_statistics.num_rw_substitution;
         continue;
       }
     }
-    if (right.is_and() && right.is_negated() && left.is_and()
+    if (is_and(right) && right.is_negated() && is_and(left)
         && !left.is_negated())
     {
       // (a = c) \/ (a = d) -> ~b /\ (c /\ d)
-      if (right[0] == left[0] || right[0] == left[1])
+      if (get_child(right, 0) == get_child(left, 0)
+          || get_child(right, 0) == get_child(left, 1))
       {
-        right = mk_not(right[1]);
+        right = mk_not(get_child(right, 1));
+        ++d_statistics.num_rw_substitution;
         continue;
       }
       // (b = c) \/ (b = d) -> ~a /\ (c /\ d)
-      if (right[1] == left[0] || right[1] == left[1])
+      if (get_child(right, 1) == get_child(left, 0)
+          || get_child(right, 1) == get_child(left, 1))
       {
-        right = mk_not(right[0]);
+        right = mk_not(get_child(right, 0));
+        ++d_statistics.num_rw_substitution;
         continue;
       }
     }
 
+    if (d_opt_level < 4)
+    {
+      break;
+    }
+
     /** Optimization level 4 */
 
     // Idempotence rule
     //   shape: (a /\ b) /\ (c /\ d)
-    if (left.is_and() && !left.is_negated() && right.is_and()
+    if (is_and(left) && !left.is_negated() && is_and(right)
         && !right.is_negated())
     {
       // (a = c) \/ (b = c)
-      if (left[0] == right[0] || left[1] == right[0])
+      if (get_child(left, 0) == get_child(right, 0)
+          || get_child(left, 1) == get_child(right, 0))
       {
-        right = right[1];
+        right = get_child(right, 1);
+        ++d_statistics.num_rw_idempotence;
         continue;
       }
       // (a = d) \/ (b = d)
-      if (left[0] == right[1] || left[1] == right[1])
+      if (get_child(left, 0) == get_child(right, 1)
+          || get_child(left, 1) == get_child(right, 1))
       {
-        right = right[0];
+        right = get_child(right, 0);
+        ++d_statistics.num_rw_idempotence;
         continue;
       }
     }
 
     break;
-  } while (true);
+  }
 
   // Normalize ANDs
   if (std::abs(left.get_id()) > std::abs(right.get_id()))
@@ -646,77 +610,28 @@ AigManager::rewrite_and(const AigNode& l, const AigNode& r)
   }
 
   // create AND with left, right
-  AigNodeData* d = find_or_create_and(left, right);
-  return AigNode(d);
+  return find_or_create_and(left, right);
 }
 
-AigNodeData*
-AigManager::new_data()
+uint32_t
+AigManager::new_data(uint32_t left, uint32_t right)
 {
-  AigNodeData* d = new AigNodeData(this);
-  init_id(d);
-  return d;
-}
-
-void
-AigManager::garbage_collect(AigNodeData* d)
-{
-  assert(d->d_refs == 0);
-
-  if (d_gc_mode)
+  uint32_t id = d_free;
+  if (id)
   {
-    assert(false);
-    return;
+    d_free      = d_nodes[id].d_next;
+    d_nodes[id] = {left, right, 0, 0};
+    return id;
   }
-
-  d_gc_mode = true;
-
-  AigNodeData *cur, *data;
-  std::vector<AigNodeData*> visit{d};
-
-  do
+  // Literals are 2 * id + negated and must fit into 32 bits.
+  if (d_nodes.size() >= (UINT32_C(1) << 31))
   {
-    cur = visit.back();
-    visit.pop_back();
-    assert(cur->d_refs == 0);
-
-    // Decrement reference counts for children of AND nodes
-    if (!cur->d_left.is_null())
-    {
-      assert(!cur->d_right.is_null());
-
-      // Erase node data from unique table before we modify children.
-      d_unique_table.erase(cur);
-
-      data = cur->d_left.d_data;
-      --data->d_refs;
-      cur->d_left.d_data = nullptr;
-      if (data->d_refs == 0)
-      {
-        visit.push_back(data);
-      }
-
-      data = cur->d_right.d_data;
-      --data->d_refs;
-      cur->d_right.d_data = nullptr;
-      if (data->d_refs == 0)
-      {
-        visit.push_back(data);
-      }
-      --d_statistics.num_ands;
-    }
-    else
-    {
-      --d_statistics.num_consts;
-    }
-
-    // Delete node data
-    assert(cur->d_id > 0);
-    assert(d_node_data[static_cast<size_t>(cur->d_id) - 1]->d_id == cur->d_id);
-    d_node_data[static_cast<size_t>(cur->d_id) - 1].reset(nullptr);
-  } while (!visit.empty());
-
-  d_gc_mode = false;
+    fprintf(stderr, "AIG: maximum number of nodes exceeded\n");
+    std::abort();
+  }
+  id = static_cast<uint32_t>(d_nodes.size());
+  d_nodes.push_back({left, right, 0, 0});
+  return id;
 }
 
 }  // namespace bzla::bb
@@ -14,8 +14,10 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "bitblast/bitblaster.h"
 
@@ -23,90 +25,129 @@ namespace bzla::bb {
 
 class AigNode;
 using AigManager = BitInterface<AigNode>;
-class AigNodeData;
-class AigNodeUniqueTable;
 
 /**
- * Wrapper around AigNodeData with automatic reference counting on
- * construction/destruction.
+ * An AIG node, represented as literal `2 * id + negated` of the node data
+ * stored in the AIG manager. Queries on the node data are resolved through
+ * the AIG manager, see AigManager::is_and() and AigManager::get_child().
+ *
+ * AIG nodes are not reference counted. The node data of a node is owned by
+ * the AIG manager and released by AigManager::garbage_collect() if the node
+ * is not in the cone of a node referenced via AigManager::inc_ref().
  */
 class AigNode
 {
   friend AigManager;
-  friend class AigNodeData;
 
  public:
   AigNode() = default;
-  ~AigNode();
-  AigNode(const AigNode& other);
-  AigNode& operator=(const AigNode& other);
-  AigNode(AigNode&& other);
-  AigNode& operator=(AigNode&& other);
 
   bool is_true() const;
 
   bool is_false() const;
 
-  bool is_and() const;
-
-  bool is_const() const;
-
   bool is_negated() const;
 
-  const AigNode& operator[](int index) const;
-
   int64_t get_id() const;
 
+  /** @return The literal of this node, `2 * id + negated`. */
+  uint32_t get_lit() const { return d_lit; }
+
  private:
   static const int64_t s_true_id = 1;
 
   // Should only be constructed via AigManager
-  AigNode(AigNodeData* data, bool negated = false);
+  explicit AigNode(uint32_t lit) : d_lit(lit) {}
 
   bool is_null() const;
-  uint64_t get_refs() const;
 
-  AigNodeData* d_data = nullptr;
-  // TODO: optimization hide flag in d_data pointer
-  bool d_negated = false;
+  /** The literal. */
+  uint32_t d_lit = 0;
 };
 
 bool operator==(const AigNode& a, const AigNode& b);
 
 bool operator<(const AigNode& a, const AigNode& b);
 
+/**
+ * Node data of an AIG node. Children of AND gates are stored as literals,
+ * constants and the true node have no children (literal 0).
+ */
+struct AigNodeData
+{
+  /** Left child of AND gate. */
+  uint32_t d_left = 0;
+  /** Right child of AND gate. */
+  uint32_t d_right = 0;
+  /**
+   * Id of the next node in the collision chain of the unique table, or in
+   * the free list of the AIG manager if the node was released.
+   */
+  uint32_t d_next = 0;
+  /** The number of references via AigManager::inc_ref(). */
+  uint32_t d_refs = 0;
+};
+
 // AigNodeUniqueTable
 class AigNodeUniqueTable
 {
  public:
-  AigNodeUniqueTable();
+  AigNodeUniqueTable(std::vector<AigNodeData>& nodes);
 
-  // AigNodeData* lookup(const AigNode& left, const AigNode& right);
-  std::pair<bool, AigNodeData*> insert(AigNodeData* d);
-  void erase(const AigNodeData* d);
+  /**
+   * Find AND gate with given children.
+   * @return The id of the AND gate, or 0 if no such gate exists.
+   */
+  uint32_t find(uint32_t left, uint32_t right) const;
+  /** Insert AND gate with given id. */
+  void insert(uint32_t id);
+  /** Remove all AND gates. */
+  void clear();
+
+  /** @return The number of bytes allocated by the buckets. */
+  size_t memory_usage() const;
 
  private:
-  size_t hash(const AigNode& left, const AigNode& right);
+  size_t hash(uint32_t left, uint32_t right) const;
   void resize();
 
+  /** The node data, indexed by id. */
+  std::vector<AigNodeData>& d_nodes;
   size_t d_num_elements = 0;
-  std::vector<AigNodeData*> d_buckets;
+  /** The ids of the first node in each collision chain, 0 if empty. */
+  std::vector<uint32_t> d_buckets;
 };
 
 template <>
 class BitInterface<AigNode>
 {
-  friend class AigNodeData;
-
  public:
   struct Statistics
   {
     uint64_t num_ands       = 0;  // Current number of AND gates
     uint64_t num_consts     = 0;  // Current number of AIG constants
     uint64_t num_shared = 0;  // Number of successful AND gate lookups
+    uint64_t num_gc         = 0;  // Number of garbage collections
+    uint64_t num_released   = 0;  // Number of nodes released by GC
+    // Number of applications of the two-level rewriting rules.
+    uint64_t num_rw_neutrality    = 0;
+    uint64_t num_rw_boundedness   = 0;
+    uint64_t num_rw_idempotence   = 0;
+    uint64_t num_rw_contradiction = 0;
+    uint64_t num_rw_subsumption   = 0;
+    uint64_t num_rw_resolution    = 0;
+    uint64_t num_rw_substitution  = 0;
   };
 
-  BitInterface<AigNode>();
+  /** The maximum optimization level of the two-level AIG rewriting. */
+  static constexpr uint8_t OPT_LEVEL_MAX = 4;
+
+  /**
+   * Constructor.
+   * @param opt_level The optimization level of the two-level AIG rewriting
+   *                  applied on AND gate construction, see rewrite_and().
+   */
+  BitInterface<AigNode>(uint8_t opt_level = OPT_LEVEL_MAX);
   ~BitInterface<AigNode>();
 
   AigNode mk_false();
@@ -118,46 +159,88 @@ class BitInterface<AigNode>
   AigNode mk_iff(const AigNode& a, const AigNode& b);
   AigNode mk_ite(const AigNode& c, const AigNode& a, const AigNode& b);
 
+  /**
+   * Find already constructed AND gate with given children, without applying
+   * the two-level rewriting.
+   * @return The AND gate, or no value if no such gate exists.
+   */
+  std::optional<AigNode> find_and(const AigNode& a, const AigNode& b) const;
+
+  /** @return True if given node is an AND gate. */
+  bool is_and(const AigNode& a) const;
+  /** @return True if given node is an AIG constant. */
+  bool is_const(const AigNode& a) const;
+  /**
+   * Get child of AND gate.
+   * @param a The AND gate.
+   * @param index The index of the child, 0 for the left and 1 for the right
+   *              child.
+   * @return The child.
+   */
+  AigNode get_child(const AigNode& a, int index) const;
+
+  /**
+   * Increase the reference count of given node. The cones of referenced
+   * nodes are not released by garbage_collect().
+   */
+  void inc_ref(const AigNode& a);
+  /** Decrease the reference count of given node. */
+  void dec_ref(const AigNode& a);
+
+  /**
+   * Release the node data of all nodes that are not in the cone of a
+   * referenced node. The ids of released nodes are reused for new nodes,
+   * released nodes must not be used after garbage collection.
+   * @return The number of released nodes.
+   */
+  size_t garbage_collect();
+
   /** @return AIG statistics. */
   const Statistics& statistics() const;
 
- private:
-  /** Counter for AIG ids. */
-  int64_t d_aig_id_counter = AigNode::s_true_id;
-
-  /** Returns the next free AIG id. */
-  void init_id(AigNodeData* d);
+  /**
+   * @return The number of bytes allocated by the AIG manager, including the
+   *         node data of all AIG nodes.
+   */
+  size_t memory_usage() const;
 
+ private:
   /**
-   * Find already constructed and gate with given children.
+   * Find already constructed and gate with given children, or create it if
+   * it does not exist yet.
    *
    * @param left Left child of AND gate.
    * @param right Right child of AND gate.
-   * @return Pointer to existing node data or nullptr if AND gate was not yet
-   * constructed.
+   * @return The AND gate.
    */
-  AigNodeData* find_or_create_and(const AigNode& left, const AigNode& right);
+  AigNode find_or_create_and(const AigNode& left, const AigNode& right);
 
   /**
    * Implements two-level AIG rewriting from [1].
    *
+   * Rules are applied up to optimization level `d_opt_level`:
+   *  * 0: no rewriting, only hash consing
+   *  * 1: neutrality, boundedness, idempotence and contradiction rules
+   *  * 2: asymmetric and symmetric contradiction, subsumption, idempotence
+   *       and resolution rules
+   *  * 3: asymmetric and symmetric substitution rules
+   *  * 4: idempotence rule over two AND gates
+   *
    * [1] Local Two-Level And-Inverter Graph Minimization without Blowup.
    *     Robert Brummayer, Armin Biere.
    */
   AigNode rewrite_and(const AigNode& left, const AigNode& right);
 
   /**
-   * Construct a new node data.
+   * Construct new node data with given children.
+   * @return The id of the node.
    */
-  AigNodeData* new_data();
+  uint32_t new_data(uint32_t left = 0, uint32_t right = 0);
 
-  /**
-   * Delete given node data.
-   */
-  void garbage_collect(AigNodeData* d);
-
-  /** Maps node id to node data and stores all created node data. */
-  std::vector<std::unique_ptr<AigNodeData>> d_node_data;
+  /** Stores the node data of all nodes, indexed by id, 0 is unused. */
+  std::vector<AigNodeData> d_nodes;
+  /** The id of the first released node in the free list, 0 if empty. */
+  uint32_t d_free = 0;
   /** AND gate cache used for hash consing. */
   AigNodeUniqueTable d_unique_table;
 
@@ -165,13 +248,73 @@ class BitInterface<AigNode>
   AigNode d_true;
   /** AIG node representing false. */
   AigNode d_false;
-
-  /** Indicates whether AIG manager is in garbage collection mode. */
-  bool d_gc_mode = false;
+  /** The optimization level of rewrite_and(). */
+  uint8_t d_opt_level;
 
   Statistics d_statistics;
 };
 
+/* --- AigNode inline methods ----------------------------------------------- */
+
+inline bool
+AigNode::is_true() const
+{
+  return d_lit == 2 * s_true_id;
+}
+
+inline bool
+AigNode::is_false() const
+{
+  return d_lit == 2 * s_true_id + 1;
+}
+
+inline bool
+AigNode::is_negated() const
+{
+  return d_lit & 1;
+}
+
+inline int64_t
+AigNode::get_id() const
+{
+  // is zero if constructed with default constructor
+  int64_t id = d_lit >> 1;
+  return is_negated() ? -id : id;
+}
+
+inline bool
+AigNode::is_null() const
+{
+  return d_lit == 0;
+}
+
+/* --- AigManager inline methods -------------------------------------------- */
+
+inline bool
+AigManager::is_and(const AigNode& a) const
+{
+  return d_nodes[a.d_lit >> 1].d_left != 0;
+}
+
+inline bool
+AigManager::is_const(const AigNode& a) const
+{
+  return (a.d_lit >> 1) != AigNode::s_true_id && !is_and(a);
+}
+
+inline AigNode
+AigManager::get_child(const AigNode& a, int index) const
+{
+  assert(is_and(a));
+  const AigNodeData& d = d_nodes[a.d_lit >> 1];
+  if (index == 0)
+  {
+    return AigNode(d.d_left);
+  }
+  assert(index == 1);
+  return AigNode(d.d_right);
+}
+
 }  // namespace bzla::bb
 
 namespace std {
@@ -0,0 +1,1150 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "bitblast/aig/aig_optimizer.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <optional>
+#include <unordered_set>
+
+namespace bzla::bb {
+
+namespace {
+
+/** The maximum number of cuts stored per node, without the trivial cut. */
+constexpr size_t s_max_cuts = 8;
+
+/** Truth tables of the 4 inputs. */
+constexpr uint16_t s_var_tt[4] = {0xAAAA, 0xCCCC, 0xF0F0, 0xFF00};
+
+/** @return The positive id of given node. */
+uint32_t
+id(const AigNode& node)
+{
+  return node.get_lit() >> 1;
+}
+
+/** @return Given truth table with input `v` set to 0. */
+uint16_t
+cofactor0(uint16_t tt, uint32_t v)
+{
+  uint16_t t = tt & ~s_var_tt[v];
+  return t | (t << (1u << v));
+}
+
+/** @return Given truth table with input `v` set to 1. */
+uint16_t
+cofactor1(uint16_t tt, uint32_t v)
+{
+  uint16_t t = tt & s_var_tt[v];
+  return t | (t >> (1u << v));
+}
+
+/** @return The inputs given truth table depends on, bit i for input i. */
+uint32_t
+support(uint16_t tt)
+{
+  uint32_t res = 0;
+  for (uint32_t v = 0; v < 4; ++v)
+  {
+    if (cofactor0(tt, v) != cofactor1(tt, v))
+    {
+      res |= 1u << v;
+    }
+  }
+  return res;
+}
+
+/**
+ * Synthesizes AIG structures for functions of up to 4 inputs by recursive
+ * decomposition into AND, OR, XOR and MUX of subfunctions (Shannon
+ * decomposition, unate cofactors and disjoint-support decomposition),
+ * choosing the decomposition with the minimal number of gates. Sharing
+ * between subfunctions is not taken into account when choosing, but is
+ * exploited when the structure is built.
+ */
+class Synthesizer
+{
+ public:
+  using Structure = std::vector<std::pair<uint8_t, uint8_t>>;
+
+  /**
+   * Synthesize given function.
+   * @param tt    The truth table of the function.
+   * @param gates The gates of the structure.
+   * @return The output literal of the structure.
+   */
+  uint8_t synthesize(uint16_t tt, Structure& gates)
+  {
+    d_gates = &gates;
+    return build(tt);
+  }
+
+ private:
+  enum class Kind
+  {
+    LIT,
+    AND,
+    OR,
+    XOR,
+  };
+
+  struct Choice
+  {
+    uint32_t d_cost = s_inf;
+    Kind d_kind     = Kind::LIT;
+    uint16_t d_a    = 0;
+    uint16_t d_b    = 0;
+  };
+
+  static constexpr uint32_t s_inf = std::numeric_limits<uint32_t>::max() / 4;
+
+  /** @return The literal of given truth table if it is a constant or input. */
+  static int32_t literal(uint16_t tt)
+  {
+    if (tt == 0)
+    {
+      return 0;
+    }
+    if (tt == 0xFFFF)
+    {
+      return 1;
+    }
+    for (uint32_t v = 0; v < 4; ++v)
+    {
+      if (tt == s_var_tt[v])
+      {
+        return 2 * (v + 1);
+      }
+      if (tt == static_cast<uint16_t>(~s_var_tt[v]))
+      {
+        return 2 * (v + 1) + 1;
+      }
+    }
+    return -1;
+  }
+
+  /**
+   * Update `best` if the decomposition of given kind into `a` and `b` with
+   * given number of gates is cheaper.
+   */
+  void consider(
+      Choice& best, Kind kind, uint16_t a, uint16_t b, uint32_t gates)
+  {
+    if (gates + 1 >= best.d_cost)
+    {
+      return;
+    }
+    uint32_t cost = gates + cost_of(a);
+    if (cost >= best.d_cost)
+    {
+      return;
+    }
+    cost += cost_of(b);
+    if (cost < best.d_cost)
+    {
+      best = {cost, kind, a, b};
+    }
+  }
+
+  /** @return The cost of the best decomposition of given truth table. */
+  uint32_t cost_of(uint16_t tt) { return choice(tt).d_cost; }
+
+  /** @return The best decomposition of given truth table. */
+  const Choice& choice(uint16_t tt)
+  {
+    auto it = d_choices.find(tt);
+    if (it != d_choices.end())
+    {
+      return it->second;
+    }
+    // Guards against cycles, functions in progress have infinite cost.
+    d_choices.emplace(tt, Choice());
+
+    Choice best;
+    if (literal(tt) >= 0)
+    {
+      best = {0, Kind::LIT, tt, tt};
+    }
+    else
+    {
+      uint32_t sup = support(tt);
+      for (uint32_t v = 0; v < 4; ++v)
+      {
+        if (!(sup & (1u << v)))
+        {
+          continue;
+        }
+        uint16_t x  = s_var_tt[v];
+        uint16_t f0 = cofactor0(tt, v);
+        uint16_t f1 = cofactor1(tt, v);
+        if (f0 == 0)
+        {
+          consider(best, Kind::AND, x, f1, 1);
+        }
+        else if (f1 == 0)
+        {
+          consider(best, Kind::AND, ~x, f0, 1);
+        }
+        else if (f0 == 0xFFFF)
+        {
+          consider(best, Kind::OR, ~x, f1, 1);
+        }
+        else if (f1 == 0xFFFF)
+        {
+          consider(best, Kind::OR, x, f0, 1);
+        }
+        else if (f0 == static_cast<uint16_t>(~f1))
+        {
+          consider(best, Kind::XOR, x, f0, 3);
+        }
+        else if ((f0 & ~f1) == 0)
+        {
+          consider(best, Kind::OR, f0, x & f1, 1);
+        }
+        else if ((f1 & ~f0) == 0)
+        {
+          consider(best, Kind::OR, f1, ~x & f0, 1);
+        }
+        else
+        {
+          consider(best, Kind::OR, x & f1, ~x & f0, 1);
+        }
+      }
+      // Disjoint-support decomposition, the lowest input of the support is
+      // always in the first part.
+      uint32_t low = sup & (~sup + 1);
+      for (uint32_t s1 = sup; s1; s1 = (s1 - 1) & sup)
+      {
+        if (!(s1 & low) || s1 == sup)
+        {
+          continue;
+        }
+        uint32_t s2 = sup & ~s1;
+        uint16_t g_and = tt, h_and = tt, g_or = tt, h_or = tt;
+        uint16_t g0 = tt, h0 = tt;
+        for (uint32_t v = 0; v < 4; ++v)
+        {
+          if (s2 & (1u << v))
+          {
+            g_and = cofactor0(g_and, v) | cofactor1(g_and, v);
+            g_or  = cofactor0(g_or, v) & cofactor1(g_or, v);
+            g0    = cofactor0(g0, v);
+          }
+          else if (s1 & (1u << v))
+          {
+            h_and = cofactor0(h_and, v) | cofactor1(h_and, v);
+            h_or  = cofactor0(h_or, v) & cofactor1(h_or, v);
+            h0    = cofactor0(h0, v);
+          }
+        }
+        if ((g_and & h_and) == tt)
+        {
+          consider(best, Kind::AND, g_and, h_and, 1);
+        }
+        if ((g_or | h_or) == tt)
+        {
+          consider(best, Kind::OR, g_or, h_or, 1);
+        }
+        // f = g0 ^ h0 ^ f(0), where f(0) is the value under all zero inputs
+        uint16_t c = (tt & 1) ? 0xFFFF : 0;
+        if ((g0 ^ h0 ^ c) == tt)
+        {
+          consider(best, Kind::XOR, g0, h0 ^ c, 3);
+        }
+      }
+    }
+    Choice& res = d_choices[tt];
+    res         = best;
+    return res;
+  }
+
+  uint8_t mk_and(uint8_t a, uint8_t b)
+  {
+    if (a > b)
+    {
+      std::swap(a, b);
+    }
+    if (a == 0 || a == (b ^ 1))
+    {
+      return 0;
+    }
+    if (a == 1 || a == b)
+    {
+      return b;
+    }
+    uint8_t lit         = static_cast<uint8_t>(2 * (5 + d_gates->size()));
+    auto [it, inserted] = d_strash.emplace(std::make_pair(a, b), lit);
+    if (inserted)
+    {
+      d_gates->emplace_back(a, b);
+    }
+    return it->second;
+  }
+
+  uint8_t build(uint16_t tt)
+  {
+    const Choice& c = choice(tt);
+    assert(c.d_cost != s_inf);
+    uint16_t a = c.d_a, b = c.d_b;
+    switch (c.d_kind)
+    {
+      case Kind::LIT: return static_cast<uint8_t>(literal(tt));
+      case Kind::AND: return mk_and(build(a), build(b));
+      case Kind::OR: return mk_and(build(a) ^ 1, build(b) ^ 1) ^ 1;
+      case Kind::XOR:
+      {
+        uint8_t la = build(a), lb = build(b);
+        return mk_and(mk_and(la, lb ^ 1) ^ 1, mk_and(la ^ 1, lb) ^ 1) ^ 1;
+      }
+    }
+    assert(false);
+    return 0;
+  }
+
+  /** The best decomposition per truth table. */
+  std::unordered_map<uint16_t, Choice> d_choices;
+  /** Structural hashing of the built gates. */
+  std::map<std::pair<uint8_t, uint8_t>, uint8_t> d_strash;
+  /** The gates of the structure that is built. */
+  Structure* d_gates = nullptr;
+};
+
+/**
+ * @return The truth table of the function of a cut with given leaves as a
+ *         function of a cut with the given superset of leaves.
+ */
+uint16_t
+stretch(uint16_t tt,
+        const std::array<uint32_t, 4>& from,
+        uint8_t from_size,
+        const std::array<uint32_t, 4>& to,
+        uint8_t to_size)
+{
+  std::array<uint32_t, 4> pos{};
+  for (uint8_t i = 0, j = 0; i < from_size; ++i)
+  {
+    while (to[j] != from[i])
+    {
+      ++j;
+      assert(j < to_size);
+    }
+    pos[i] = j;
+  }
+  uint16_t res = 0;
+  for (uint32_t m = 0; m < 16; ++m)
+  {
+    uint32_t mf = 0;
+    for (uint8_t i = 0; i < from_size; ++i)
+    {
+      mf |= ((m >> pos[i]) & 1) << i;
+    }
+    res |= ((tt >> mf) & 1) << m;
+  }
+  return res;
+}
+
+}  // namespace
+
+AigOptimizer::AigOptimizer(AigManager& mgr,
+                           uint64_t max_ands,
+                           uint64_t time_limit_ms)
+    : d_mgr(mgr), d_max_ands(max_ands), d_time_limit(time_limit_ms)
+{
+}
+
+AigNode
+AigOptimizer::optimize(const AigNode& node)
+{
+  return optimize(std::vector<AigNode>{node})[0];
+}
+
+std::vector<AigNode>
+AigOptimizer::optimize(const std::vector<AigNode>& roots)
+{
+  // The intermediate results may refer to nodes that were released by
+  // garbage collection since the last call, only the referenced results of
+  // processed roots are kept.
+  if (d_mgr.statistics().num_gc != d_num_gc)
+  {
+    d_num_gc = d_mgr.statistics().num_gc;
+    d_balanced.clear();
+    d_rewritten.clear();
+    d_levels.clear();
+  }
+
+  // Roots that were already processed are mapped to the same node as
+  // before, independent of the remaining budget.
+  std::vector<AigNode> ands;
+  for (const AigNode& root : roots)
+  {
+    if (d_mgr.is_and(root) && d_results.find(id(root)) == d_results.end())
+    {
+      ands.push_back(root);
+    }
+  }
+  if (ands.empty())
+  {
+    return lookup(d_results, roots);
+  }
+  d_start = std::chrono::steady_clock::now();
+  d_statistics.num_roots += ands.size();
+
+  if (!budget_exhausted())
+  {
+    uint64_t num_skipped          = d_statistics.num_skipped;
+    std::vector<AigNode> balanced = balance(ands);
+    if (num_skipped == d_statistics.num_skipped && !budget_exhausted())
+    {
+      balanced = rewrite(balanced);
+    }
+    for (size_t i = 0; i < ands.size(); ++i)
+    {
+      const AigNode& root = ands[i];
+      const AigNode& opt  = balanced[i];
+      add_result(root, root.is_negated() ? d_mgr.mk_not(opt) : opt);
+    }
+  }
+  for (const AigNode& root : ands)
+  {
+    add_result(root, root.is_negated() ? d_mgr.mk_not(root) : root);
+  }
+  d_time += std::chrono::steady_clock::now() - d_start;
+  return lookup(d_results, roots);
+}
+
+void
+AigOptimizer::add_result(const AigNode& root, const AigNode& res)
+{
+  if (d_results.emplace(id(root), res).second)
+  {
+    d_mgr.inc_ref(root);
+    d_mgr.inc_ref(res);
+  }
+}
+
+bool
+AigOptimizer::budget_exhausted() const
+{
+  if (d_max_ands && d_statistics.num_ands >= d_max_ands)
+  {
+    return true;
+  }
+  return d_time_limit.count()
+         && d_time + (std::chrono::steady_clock::now() - d_start)
+                > d_time_limit;
+}
+
+std::vector<AigNode>
+AigOptimizer::collect_cone(
+    const std::vector<AigNode>& roots,
+    const std::unordered_map<uint32_t, AigNode>& cache) const
+{
+  std::vector<AigNode> res;
+  std::unordered_set<uint32_t> visited;
+  // Pairs of AIG node and flag indicating whether its children were visited.
+  std::vector<std::pair<AigNode, bool>> visit;
+  for (auto it = roots.rbegin(); it != roots.rend(); ++it)
+  {
+    visit.emplace_back(*it, false);
+  }
+  do
+  {
+    auto [cur, expanded] = visit.back();
+    visit.pop_back();
+    if (!d_mgr.is_and(cur) || cache.find(id(cur)) != cache.end())
+    {
+      continue;
+    }
+    if (expanded)
+    {
+      res.push_back(cur.is_negated() ? d_mgr.mk_not(cur) : cur);
+    }
+    else if (visited.insert(id(cur)).second)
+    {
+      visit.emplace_back(cur, true);
+      visit.emplace_back(d_mgr.get_child(cur, 1), false);
+      visit.emplace_back(d_mgr.get_child(cur, 0), false);
+    }
+  } while (!visit.empty());
+  return res;
+}
+
+AigNode
+AigOptimizer::lookup(const std::unordered_map<uint32_t, AigNode>& cache,
+                     const AigNode& node) const
+{
+  auto it = cache.find(id(node));
+  if (it == cache.end())
+  {
+    return node;
+  }
+  return node.is_negated() ? d_mgr.mk_not(it->second) : it->second;
+}
+
+uint32_t
+AigOptimizer::level(const AigNode& node) const
+{
+  uint32_t i = id(node);
+  if (i < d_levels.size() && d_levels[i] != UINT32_MAX)
+  {
+    return d_levels[i];
+  }
+  auto& levels = const_cast<std::vector<uint32_t>&>(d_levels);
+  std::vector<AigNode> visit{node};
+  do
+  {
+    AigNode cur = visit.back();
+    uint32_t j  = id(cur);
+    if (j >= levels.size())
+    {
+      levels.resize(std::max<size_t>(j + 1, 2 * levels.size()), UINT32_MAX);
+    }
+    if (levels[j] != UINT32_MAX)
+    {
+      visit.pop_back();
+      continue;
+    }
+    if (!d_mgr.is_and(cur))
+    {
+      levels[j] = 0;
+      visit.pop_back();
+      continue;
+    }
+    uint32_t l0 = id(d_mgr.get_child(cur, 0));
+    uint32_t l1 = id(d_mgr.get_child(cur, 1));
+    bool done   = true;
+    for (uint32_t c : {l0, l1})
+    {
+      if (c >= levels.size() || levels[c] == UINT32_MAX)
+      {
+        done = false;
+      }
+    }
+    if (done)
+    {
+      levels[j] = 1 + std::max(levels[l0], levels[l1]);
+      visit.pop_back();
+    }
+    else
+    {
+      visit.push_back(d_mgr.get_child(cur, 0));
+      visit.push_back(d_mgr.get_child(cur, 1));
+    }
+  } while (!visit.empty());
+  return levels[i];
+}
+
+std::vector<AigNode>
+AigOptimizer::lookup(const std::unordered_map<uint32_t, AigNode>& cache,
+                     const std::vector<AigNode>& nodes) const
+{
+  std::vector<AigNode> res;
+  for (const AigNode& node : nodes)
+  {
+    res.push_back(lookup(cache, node));
+  }
+  return res;
+}
+
+std::vector<AigNode>
+AigOptimizer::balance(const std::vector<AigNode>& roots)
+{
+  std::vector<AigNode> cone = collect_cone(roots, d_balanced);
+  if (d_max_ands && d_statistics.num_ands + cone.size() > d_max_ands)
+  {
+    d_statistics.num_skipped += roots.size();
+    return lookup(d_balanced, roots);
+  }
+  d_statistics.num_ands += cone.size();
+
+  // Count the fanouts in the cone, nodes with a single non-negated fanout
+  // are internal to the supergate of their parent. Roots are counted as
+  // fanouts.
+  std::unordered_map<uint32_t, uint32_t> refs;
+  std::unordered_set<uint32_t> negated, root_ids;
+  for (const AigNode& root : roots)
+  {
+    refs[id(root)] += 1;
+    root_ids.insert(id(root));
+  }
+  for (const AigNode& n : cone)
+  {
+    for (int32_t i = 0; i < 2; ++i)
+    {
+      AigNode child = d_mgr.get_child(n, i);
+      refs[id(child)] += 1;
+      if (child.is_negated())
+      {
+        negated.insert(id(child));
+      }
+    }
+  }
+  auto is_internal = [&](const AigNode& n) {
+    return !n.is_negated() && d_mgr.is_and(n) && refs[id(n)] == 1
+           && negated.find(id(n)) == negated.end()
+           && root_ids.find(id(n)) == root_ids.end()
+           && d_balanced.find(id(n)) == d_balanced.end();
+  };
+
+  std::vector<AigNode> leaves;
+  std::vector<AigNode> visit;
+  for (const AigNode& n : cone)
+  {
+    if (is_internal(n))
+    {
+      continue;
+    }
+    if (budget_exhausted())
+    {
+      return lookup(d_balanced, roots);
+    }
+
+    // Collect the leaves of the supergate.
+    leaves.clear();
+    visit = {d_mgr.get_child(n, 0), d_mgr.get_child(n, 1)};
+    size_t size = 0;
+    do
+    {
+      AigNode cur = visit.back();
+      visit.pop_back();
+      if (is_internal(cur))
+      {
+        visit.push_back(d_mgr.get_child(cur, 0));
+        visit.push_back(d_mgr.get_child(cur, 1));
+        ++size;
+      }
+      else
+      {
+        leaves.push_back(lookup(d_balanced, cur));
+      }
+    } while (!visit.empty());
+
+    // Remove duplicate leaves, the supergate is false if it contains a leaf
+    // in both polarities.
+    std::sort(leaves.begin(),
+              leaves.end(),
+              [](const AigNode& a, const AigNode& b) {
+                return a.get_lit() < b.get_lit();
+              });
+    leaves.erase(std::unique(leaves.begin(), leaves.end()), leaves.end());
+    bool is_false = false;
+    for (size_t i = 1; i < leaves.size(); ++i)
+    {
+      if (leaves[i - 1].get_lit() == (leaves[i].get_lit() ^ 1))
+      {
+        is_false = true;
+        break;
+      }
+    }
+
+    AigNode res;
+    if (is_false)
+    {
+      res = d_mgr.mk_false();
+    }
+    else if (size == 0 || leaves.size() == 1)
+    {
+      res = leaves.size() == 1 ? leaves[0] : d_mgr.mk_and(leaves[0], leaves[1]);
+    }
+    else
+    {
+      // Combine the two leaves of lowest level until one is left.
+      std::multimap<uint32_t, AigNode> queue;
+      for (const AigNode& leaf : leaves)
+      {
+        queue.emplace(level(leaf), leaf);
+      }
+      while (queue.size() > 1)
+      {
+        AigNode a = queue.begin()->second;
+        queue.erase(queue.begin());
+        AigNode b = queue.begin()->second;
+        queue.erase(queue.begin());
+        AigNode c = d_mgr.mk_and(a, b);
+        queue.emplace(level(c), c);
+      }
+      res = queue.begin()->second;
+      ++d_statistics.num_balanced;
+    }
+    d_balanced.emplace(id(n), res);
+  }
+  return lookup(d_balanced, roots);
+}
+
+void
+AigOptimizer::compute_cuts(const AigNode& node)
+{
+  std::vector<Cut> trivial(1);
+  std::array<const std::vector<Cut>*, 2> child_cuts;
+  std::array<std::vector<Cut>, 2> child_trivial;
+  for (int32_t i = 0; i < 2; ++i)
+  {
+    uint32_t child = id(d_mgr.get_child(node, i));
+    auto it        = d_cuts.find(child);
+    if (it != d_cuts.end())
+    {
+      child_cuts[i] = &it->second;
+    }
+    else
+    {
+      child_trivial[i].push_back({{child, 0, 0, 0}, 1, s_var_tt[0]});
+      child_cuts[i] = &child_trivial[i];
+    }
+  }
+
+  std::vector<Cut> cuts;
+  bool neg0 = d_mgr.get_child(node, 0).is_negated();
+  bool neg1 = d_mgr.get_child(node, 1).is_negated();
+  for (const Cut& a : *child_cuts[0])
+  {
+    for (const Cut& b : *child_cuts[1])
+    {
+      // Merge leaves.
+      Cut c;
+      uint8_t i = 0, j = 0, k = 0;
+      while (i < a.d_size || j < b.d_size)
+      {
+        if (k == 4)
+        {
+          break;
+        }
+        if (j == b.d_size || (i < a.d_size && a.d_leaves[i] < b.d_leaves[j]))
+        {
+          c.d_leaves[k++] = a.d_leaves[i++];
+        }
+        else if (i == a.d_size || b.d_leaves[j] < a.d_leaves[i])
+        {
+          c.d_leaves[k++] = b.d_leaves[j++];
+        }
+        else
+        {
+          c.d_leaves[k++] = a.d_leaves[i++];
+          ++j;
+        }
+      }
+      if (i < a.d_size || j < b.d_size)
+      {
+        continue;
+      }
+      c.d_size = k;
+
+      // Skip dominated cuts.
+      auto subset = [](const Cut& x, const Cut& y) {
+        return std::includes(y.d_leaves.begin(),
+                             y.d_leaves.begin() + y.d_size,
+                             x.d_leaves.begin(),
+                             x.d_leaves.begin() + x.d_size);
+      };
+      if (std::any_of(cuts.begin(), cuts.end(), [&](const Cut& x) {
+            return subset(x, c);
+          }))
+      {
+        continue;
+      }
+      cuts.erase(std::remove_if(cuts.begin(),
+                                cuts.end(),
+                                [&](const Cut& x) { return subset(c, x); }),
+                 cuts.end());
+
+      uint16_t ta = stretch(a.d_tt, a.d_leaves, a.d_size, c.d_leaves, k);
+      uint16_t tb = stretch(b.d_tt, b.d_leaves, b.d_size, c.d_leaves, k);
+      c.d_tt      = (neg0 ? ~ta : ta) & (neg1 ? ~tb : tb);
+      cuts.push_back(c);
+    }
+  }
+  // Prefer small cuts, the cut of the children always comes first.
+  std::stable_sort(cuts.begin(), cuts.end(), [](const Cut& x, const Cut& y) {
+    return x.d_size < y.d_size;
+  });
+  if (cuts.size() > s_max_cuts)
+  {
+    cuts.resize(s_max_cuts);
+  }
+  d_statistics.num_cuts += cuts.size();
+  cuts.push_back({{id(node), 0, 0, 0}, 1, s_var_tt[0]});
+  d_cuts[id(node)] = std::move(cuts);
+}
+
+const AigOptimizer::Npn&
+AigOptimizer::npn(uint16_t tt)
+{
+  auto it = d_npn.find(tt);
+  if (it != d_npn.end())
+  {
+    return it->second;
+  }
+  Npn res{tt, {0, 1, 2, 3}, 0, false};
+  std::array<uint8_t, 4> perm = {0, 1, 2, 3};
+  do
+  {
+    for (uint8_t phase = 0; phase < 16; ++phase)
+    {
+      uint16_t g = 0;
+      for (uint32_t y = 0; y < 16; ++y)
+      {
+        uint32_t x = 0;
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+          x |= (((y >> perm[i]) & 1) ^ ((phase >> i) & 1)) << i;
+        }
+        g |= ((tt >> x) & 1) << y;
+      }
+      if (g < res.d_canon)
+      {
+        res = {g, perm, phase, false};
+      }
+      if (static_cast<uint16_t>(~g) < res.d_canon)
+      {
+        res = {static_cast<uint16_t>(~g), perm, phase, true};
+      }
+    }
+  } while (std::next_permutation(perm.begin(), perm.end()));
+  return d_npn.emplace(tt, res).first->second;
+}
+
+const AigOptimizer::Structure&
+AigOptimizer::structure(uint16_t canon)
+{
+  auto it = d_library.find(canon);
+  if (it != d_library.end())
+  {
+    return it->second;
+  }
+  Structure s;
+  s.d_out = Synthesizer().synthesize(canon, s.d_gates);
+  return d_library.emplace(canon, std::move(s)).first->second;
+}
+
+uint32_t
+AigOptimizer::cost(const Cut& cut,
+                   const std::array<AigNode, 4>& leaves,
+                   const std::vector<uint32_t>& mffc)
+{
+  const Npn& t       = npn(cut.d_tt);
+  const Structure& s = structure(t.d_canon);
+
+  // Nodes of the structure, no value if the node does not exist yet.
+  std::vector<std::optional<AigNode>> nodes(5 + s.d_gates.size());
+  nodes[0] = d_mgr.mk_false();
+  for (uint8_t i = 0; i < cut.d_size; ++i)
+  {
+    nodes[1 + t.d_perm[i]] =
+        (t.d_phase >> i) & 1 ? d_mgr.mk_not(leaves[i]) : leaves[i];
+  }
+  uint32_t res = 0;
+  for (size_t i = 0; i < s.d_gates.size(); ++i)
+  {
+    const auto& [l, r]             = s.d_gates[i];
+    const std::optional<AigNode>& a = nodes[l >> 1];
+    const std::optional<AigNode>& b = nodes[r >> 1];
+    if (a && b)
+    {
+      nodes[5 + i] = d_mgr.find_and(l & 1 ? d_mgr.mk_not(*a) : *a,
+                                    r & 1 ? d_mgr.mk_not(*b) : *b);
+      if (nodes[5 + i]
+          && std::find(mffc.begin(), mffc.end(), id(*nodes[5 + i]))
+                 == mffc.end())
+      {
+        continue;
+      }
+    }
+    ++res;
+  }
+  return res;
+}
+
+AigNode
+AigOptimizer::instantiate(const Cut& cut, const std::array<AigNode, 4>& leaves)
+{
+  const Npn& t       = npn(cut.d_tt);
+  const Structure& s = structure(t.d_canon);
+
+  std::vector<AigNode> nodes(5 + s.d_gates.size());
+  nodes[0] = d_mgr.mk_false();
+  for (uint8_t i = 0; i < cut.d_size; ++i)
+  {
+    nodes[1 + t.d_perm[i]] =
+        (t.d_phase >> i) & 1 ? d_mgr.mk_not(leaves[i]) : leaves[i];
+  }
+  auto node = [&nodes, this](uint8_t lit) {
+    const AigNode& n = nodes[lit >> 1];
+    return lit & 1 ? d_mgr.mk_not(n) : n;
+  };
+  for (size_t i = 0; i < s.d_gates.size(); ++i)
+  {
+    nodes[5 + i] = d_mgr.mk_and(node(s.d_gates[i].first),
+                                node(s.d_gates[i].second));
+  }
+  AigNode res = node(s.d_out);
+  return t.d_neg_out ? d_mgr.mk_not(res) : res;
+}
+
+std::vector<AigNode>
+AigOptimizer::rewrite(const std::vector<AigNode>& roots)
+{
+  std::vector<AigNode> cone = collect_cone(roots, d_rewritten);
+  if (cone.empty())
+  {
+    return lookup(d_rewritten, roots);
+  }
+
+  // Count the fanouts in the cone, roots are counted as fanouts.
+  std::unordered_map<uint32_t, uint32_t> refs;
+  std::unordered_map<uint32_t, AigNode> id2node;
+  std::unordered_set<uint32_t> cone_ids;
+  for (const AigNode& root : roots)
+  {
+    refs[id(root)] += 1;
+  }
+  for (const AigNode& n : cone)
+  {
+    id2node.emplace(id(n), n);
+    cone_ids.insert(id(n));
+    for (int32_t i = 0; i < 2; ++i)
+    {
+      AigNode child = d_mgr.get_child(n, i);
+      refs[id(child)] += 1;
+      id2node.emplace(id(child),
+                      child.is_negated() ? d_mgr.mk_not(child) : child);
+    }
+  }
+  auto in_cone = [&](uint32_t i) { return cone_ids.find(i) != cone_ids.end(); };
+
+  // Dereference the maximum fanout-free cone of given node up to the leaves
+  // of given cut.
+  // @return The number of AND gates in the maximum fanout-free cone.
+  std::vector<uint32_t> visit;
+  auto deref = [&](uint32_t i, const Cut& cut, std::vector<uint32_t>& mffc) {
+    const auto leaves_end = cut.d_leaves.begin() + cut.d_size;
+    visit = {i};
+    mffc.clear();
+    do
+    {
+      uint32_t cur = visit.back();
+      visit.pop_back();
+      mffc.push_back(cur);
+      const AigNode& n = id2node.at(cur);
+      for (int32_t j = 0; j < 2; ++j)
+      {
+        uint32_t c = id(d_mgr.get_child(n, j));
+        if (in_cone(c)
+            && std::find(cut.d_leaves.begin(), leaves_end, c) == leaves_end
+            && --refs[c] == 0)
+        {
+          visit.push_back(c);
+        }
+      }
+    } while (!visit.empty());
+    return static_cast<uint32_t>(mffc.size());
+  };
+  auto reref = [&](const std::vector<uint32_t>& mffc, const Cut& cut) {
+    const auto leaves_end = cut.d_leaves.begin() + cut.d_size;
+    for (uint32_t cur : mffc)
+    {
+      const AigNode& n = id2node.at(cur);
+      for (int32_t j = 0; j < 2; ++j)
+      {
+        uint32_t c = id(d_mgr.get_child(n, j));
+        if (in_cone(c)
+            && std::find(cut.d_leaves.begin(), leaves_end, c) == leaves_end)
+        {
+          ++refs[c];
+        }
+      }
+    }
+  };
+
+  // Select the replacement of maximal gain per node, in topological order.
+  // The gain is the number of AND gates in the maximum fanout-free cone of
+  // the node that is removed, minus the number of AND gates of the structure
+  // that replaces it. Nodes without replacement are rebuilt over the
+  // replacements of their children.
+  std::unordered_map<uint32_t, const Cut*> best;
+  std::vector<uint32_t> mffc;
+  for (const AigNode& n : cone)
+  {
+    if (budget_exhausted())
+    {
+      d_cuts.clear();
+      return roots;
+    }
+    compute_cuts(n);
+    if (refs[id(n)] == 0)
+    {
+      // Removed by the replacement of a node in its transitive fanout.
+      continue;
+    }
+    const std::vector<Cut>& cuts = d_cuts[id(n)];
+    const Cut* cut               = nullptr;
+    int64_t max_gain             = 0;
+    // The last cut is the trivial cut.
+    for (size_t i = 0; i + 1 < cuts.size(); ++i)
+    {
+      const Cut& c = cuts[i];
+      std::array<AigNode, 4> leaves;
+      for (uint8_t j = 0; j < c.d_size; ++j)
+      {
+        const AigNode& leaf = id2node.at(c.d_leaves[j]);
+        leaves[j] = in_cone(c.d_leaves[j]) ? leaf : lookup(d_rewritten, leaf);
+      }
+      int64_t gain = deref(id(n), c, mffc);
+      gain -= cost(c, leaves, mffc);
+      reref(mffc, c);
+      if (gain > max_gain)
+      {
+        max_gain = gain;
+        cut      = &c;
+      }
+    }
+    if (cut)
+    {
+      // Remove the maximum fanout-free cone, the structure references the
+      // leaves of the cut instead.
+      deref(id(n), *cut, mffc);
+      const auto leaves_end = cut->d_leaves.begin() + cut->d_size;
+      for (uint32_t i : mffc)
+      {
+        const AigNode& m = id2node.at(i);
+        for (int32_t j = 0; j < 2; ++j)
+        {
+          uint32_t c = id(d_mgr.get_child(m, j));
+          if (std::find(cut->d_leaves.begin(), leaves_end, c) != leaves_end)
+          {
+            --refs[c];
+          }
+        }
+      }
+      for (uint8_t j = 0; j < cut->d_size; ++j)
+      {
+        ++refs[cut->d_leaves[j]];
+      }
+      best[id(n)] = cut;
+    }
+  }
+
+  // Determine the nodes required to rebuild the roots.
+  std::unordered_set<uint32_t> required;
+  for (const AigNode& root : roots)
+  {
+    required.insert(id(root));
+  }
+  for (auto it = cone.rbegin(); it != cone.rend(); ++it)
+  {
+    if (required.find(id(*it)) == required.end())
+    {
+      continue;
+    }
+    auto bit = best.find(id(*it));
+    if (bit != best.end())
+    {
+      const Cut* c = bit->second;
+      required.insert(c->d_leaves.begin(), c->d_leaves.begin() + c->d_size);
+    }
+    else
+    {
+      required.insert(id(d_mgr.get_child(*it, 0)));
+      required.insert(id(d_mgr.get_child(*it, 1)));
+    }
+  }
+
+  // Rebuild the required nodes.
+  std::unordered_map<uint32_t, AigNode> nodes;
+  auto get = [&](uint32_t i, const AigNode& node) {
+    auto it = nodes.find(i);
+    if (it == nodes.end())
+    {
+      return lookup(d_rewritten, node);
+    }
+    return node.is_negated() ? d_mgr.mk_not(it->second) : it->second;
+  };
+  for (const AigNode& n : cone)
+  {
+    if (required.find(id(n)) == required.end())
+    {
+      continue;
+    }
+    auto it = best.find(id(n));
+    AigNode res;
+    if (it != best.end())
+    {
+      const Cut* c = it->second;
+      std::array<AigNode, 4> leaves;
+      for (uint8_t j = 0; j < c->d_size; ++j)
+      {
+        uint32_t i = c->d_leaves[j];
+        leaves[j]  = get(i, id2node.at(i));
+      }
+      res = instantiate(*c, leaves);
+      ++d_statistics.num_rewritten;
+    }
+    else
+    {
+      AigNode n0 = d_mgr.get_child(n, 0);
+      AigNode n1 = d_mgr.get_child(n, 1);
+      res        = d_mgr.mk_and(get(id(n0), n0), get(id(n1), n1));
+    }
+    nodes.emplace(id(n), res);
+  }
+  d_cuts.clear();
+
+  // Keep the replacement if it requires fewer AND gates than the cone.
+  std::vector<AigNode> res;
+  for (const AigNode& root : roots)
+  {
+    res.push_back(get(id(root), root));
+  }
+  uint64_t num_ands = 0;
+  {
+    // Count the AND gates of the replacement, the replacements of nodes
+    // outside the cone are not counted.
+    std::unordered_set<uint32_t> visited;
+    for (const auto& [i, n] : id2node)
+    {
+      if (!in_cone(i))
+      {
+        visited.insert(id(lookup(d_rewritten, n)));
+      }
+    }
+    std::vector<AigNode> visit(res);
+    while (!visit.empty())
+    {
+      AigNode cur = visit.back();
+      visit.pop_back();
+      if (d_mgr.is_and(cur) && visited.insert(id(cur)).second)
+      {
+        ++num_ands;
+        visit.push_back(d_mgr.get_child(cur, 0));
+        visit.push_back(d_mgr.get_child(cur, 1));
+      }
+    }
+  }
+  if (num_ands < cone.size())
+  {
+    for (const auto& [i, n] : nodes)
+    {
+      d_rewritten.emplace(i, n);
+    }
+    d_statistics.num_ands_opt += num_ands;
+  }
+  else
+  {
+    for (const AigNode& n : cone)
+    {
+      d_rewritten.emplace(id(n), n);
+    }
+    d_statistics.num_ands_opt += cone.size();
+  }
+  return lookup(d_rewritten, roots);
+}
+
+}  // namespace bzla::bb
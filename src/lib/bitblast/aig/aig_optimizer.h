@@ -0,0 +1,226 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA__BITBLAST_AIG_OPTIMIZER_H
+#define BZLA__BITBLAST_AIG_OPTIMIZER_H
+
+#include <array>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+#include "bitblast/aig/aig_manager.h"
+
+namespace bzla::bb {
+
+/**
+ * AIG optimizer, applied to the cones of AIG nodes before CNF encoding.
+ *
+ * Optimizes the cone of a root in two steps:
+ *  1. DAG-aware balancing: multi-input AND gates (supergates), collected
+ *     over non-negated AND gates with a single fanout in the cone, are
+ *     rebuilt as trees of minimal depth.
+ *  2. DAG-aware rewriting: 4-input cuts are enumerated for all AND gates of
+ *     the balanced cone and their truth tables are mapped to NPN classes.
+ *     Each NPN class is implemented by a structure from a library that is
+ *     synthesized on demand. An AND gate is replaced by the structure of one
+ *     of its cuts if this removes more AND gates from its maximum
+ *     fanout-free cone than the structure adds, taking AND gates that
+ *     already exist into account. The rewritten cone is only used if it
+ *     requires fewer AND gates than the balanced cone.
+ *
+ * AIG nodes are immutable, the optimized cone is constructed in the AIG
+ * manager of the root. The results are cached, optimizing the roots of
+ * incrementally added assertions reuses the optimized cones of previous
+ * calls. Nodes that are absorbed into optimized cones of previous calls are
+ * optimized again if they occur in later cones. A cone is left unchanged if
+ * it exceeds the remaining budget of AND gates or if the time limit is
+ * reached. The result for a root is fixed once it was processed, optimizing
+ * it again returns the same node even if the budget is exhausted.
+ *
+ * Processed roots and their results are referenced in the AIG manager. The
+ * intermediate results are dropped after garbage collection.
+ */
+class AigOptimizer
+{
+ public:
+  struct Statistics
+  {
+    uint64_t num_roots     = 0;  // Number of optimized roots
+    uint64_t num_ands      = 0;  // Number of AND gates in processed cones
+    uint64_t num_ands_opt  = 0;  // Number of AND gates in optimized cones
+    uint64_t num_balanced  = 0;  // Number of rebuilt supergates
+    uint64_t num_rewritten = 0;  // Number of nodes replaced by a structure
+    uint64_t num_cuts      = 0;  // Number of enumerated cuts
+    uint64_t num_skipped   = 0;  // Number of roots skipped due to the budget
+  };
+
+  /**
+   * Constructor.
+   * @param mgr           The AIG manager of the nodes to optimize.
+   * @param max_ands      The maximum number of AND gates processed over all
+   *                      calls to optimize(), 0 for no limit.
+   * @param time_limit_ms The maximum time in milliseconds spent in
+   *                      optimize() over all calls, 0 for no limit.
+   */
+  AigOptimizer(AigManager& mgr,
+               uint64_t max_ands      = 0,
+               uint64_t time_limit_ms = 0);
+
+  /**
+   * Optimize the cone of given node.
+   * @param node The root of the cone to optimize.
+   * @return A node equivalent to `node`.
+   */
+  AigNode optimize(const AigNode& node);
+
+  /**
+   * Optimize the cones of given nodes together, nodes shared between the
+   * cones are preserved.
+   * @param roots The roots of the cones to optimize.
+   * @return The nodes equivalent to `roots`.
+   */
+  std::vector<AigNode> optimize(const std::vector<AigNode>& roots);
+
+  /** @return The optimizer statistics. */
+  const Statistics& statistics() const { return d_statistics; }
+
+ private:
+  /** A 4-input cut, leaves are node ids in ascending order. */
+  struct Cut
+  {
+    /** The node ids of the leaves. */
+    std::array<uint32_t, 4> d_leaves;
+    /** The number of leaves. */
+    uint8_t d_size;
+    /** The truth table of the node over the leaves. */
+    uint16_t d_tt;
+  };
+
+  /**
+   * An implementation of a function of 4 inputs as a sequence of AND gates.
+   * Literals are `2 * index + negated`, with index 0 for false, 1 to 4 for
+   * the inputs and 5 + i for gate i.
+   */
+  struct Structure
+  {
+    std::vector<std::pair<uint8_t, uint8_t>> d_gates;
+    /** The literal of the output. */
+    uint8_t d_out = 0;
+  };
+
+  /** The NPN transformation of a truth table into its class representative. */
+  struct Npn
+  {
+    /** The class representative. */
+    uint16_t d_canon;
+    /** The input of the representative per input of the function. */
+    std::array<uint8_t, 4> d_perm;
+    /** The input negations, bit i is set if input i is negated. */
+    uint8_t d_phase;
+    /** True if the output is negated. */
+    bool d_neg_out;
+  };
+
+  /**
+   * Cache the result of given root if it was not processed yet. The root and
+   * the result are referenced.
+   */
+  void add_result(const AigNode& root, const AigNode& res);
+
+  /** @return True if the time or gate budget is exhausted. */
+  bool budget_exhausted() const;
+
+  /**
+   * Collect the AND gates in the cones of given nodes, in topological order.
+   * Nodes in `cache` are not traversed.
+   */
+  std::vector<AigNode> collect_cone(
+      const std::vector<AigNode>& roots,
+      const std::unordered_map<uint32_t, AigNode>& cache) const;
+
+  /** Balance the cones of given AND gates. */
+  std::vector<AigNode> balance(const std::vector<AigNode>& roots);
+
+  /** Rewrite the cones of given (balanced) nodes. */
+  std::vector<AigNode> rewrite(const std::vector<AigNode>& roots);
+
+  /**
+   * @return The node that the given node is mapped to in `cache`, or the
+   *         node itself if it is not cached.
+   */
+  AigNode lookup(const std::unordered_map<uint32_t, AigNode>& cache,
+                 const AigNode& node) const;
+  /** @return The nodes that given nodes are mapped to in `cache`. */
+  std::vector<AigNode> lookup(
+      const std::unordered_map<uint32_t, AigNode>& cache,
+      const std::vector<AigNode>& nodes) const;
+
+  /** @return The level of given node, its maximum distance to an input. */
+  uint32_t level(const AigNode& node) const;
+
+  /** Compute the cuts of the given AND gate from the cuts of its children. */
+  void compute_cuts(const AigNode& node);
+
+  /** @return The NPN transformation of given truth table. */
+  const Npn& npn(uint16_t tt);
+
+  /** @return The library structure of given NPN class representative. */
+  const Structure& structure(uint16_t canon);
+
+  /**
+   * @return The number of AND gates added when instantiating the structure of
+   *         given cut over given leaves. Existing AND gates are not counted
+   *         unless they are in the maximum fanout-free cone `mffc` that is
+   *         removed by the replacement.
+   */
+  uint32_t cost(const Cut& cut,
+                const std::array<AigNode, 4>& leaves,
+                const std::vector<uint32_t>& mffc);
+
+  /** Instantiate the structure of given cut over given leaves. */
+  AigNode instantiate(const Cut& cut, const std::array<AigNode, 4>& leaves);
+
+  /** The associated AIG manager. */
+  AigManager& d_mgr;
+
+  /** The maximum number of processed AND gates, 0 for no limit. */
+  uint64_t d_max_ands;
+  /** The time limit, 0 for no limit. */
+  std::chrono::milliseconds d_time_limit;
+  /** The time spent in optimize(). */
+  std::chrono::steady_clock::duration d_time{0};
+  /** The start time of the current call to optimize(). */
+  std::chrono::steady_clock::time_point d_start;
+
+  /** The number of garbage collections of the manager at the last call. */
+  uint64_t d_num_gc = 0;
+  /** Maps node ids of processed roots to their result (positive). */
+  std::unordered_map<uint32_t, AigNode> d_results;
+  /** Maps node ids to their balanced version (positive). */
+  std::unordered_map<uint32_t, AigNode> d_balanced;
+  /** Maps node ids of balanced nodes to their rewritten version. */
+  std::unordered_map<uint32_t, AigNode> d_rewritten;
+  /** The levels of nodes, indexed by id. */
+  std::vector<uint32_t> d_levels;
+
+  /** The cuts of the nodes in the cone that is currently rewritten. */
+  std::unordered_map<uint32_t, std::vector<Cut>> d_cuts;
+  /** The NPN transformations of truth tables. */
+  std::unordered_map<uint16_t, Npn> d_npn;
+  /** The library of structures, maps class representatives to structures. */
+  std::unordered_map<uint16_t, Structure> d_library;
+
+  Statistics d_statistics;
+};
+
+}  // namespace bzla::bb
+
+#endif
@@ -18,7 +18,9 @@
 namespace bzla::bb::aig {
 
 void
-Smt2Printer::print(std::stringstream& ss, const AigNode& n)
+Smt2Printer::print(std::stringstream& ss,
+                   const AigManager& mgr,
+                   const AigNode& n)
 {
   bool negate = n.is_negated() && !n.is_true() && !n.is_false();
   if (negate)
@@ -33,13 +35,13 @@ Smt2Printer::print(std::stringstream& ss, const AigNode& n)
   {
     ss << "#b1";
   }
-  else if (n.is_const())
+  else if (mgr.is_const(n))
   {
     ss << "x" << std::labs(n.get_id());
   }
   else
   {
-    assert(n.is_and());
+    assert(mgr.is_and(n));
     ss << "a" << std::labs(n.get_id());
   }
   if (negate)
@@ -49,7 +51,9 @@ Smt2Printer::print(std::stringstream& ss, const AigNode& n)
 }
 
 void
-Smt2Printer::print(std::stringstream& ss, const std::vector<AigNode>& bits)
+Smt2Printer::print(std::stringstream& ss,
+                   const AigManager& mgr,
+                   const std::vector<AigNode>& bits)
 {
   std::vector<AigNode> visit{bits.begin(), bits.end()};
   std::unordered_map<int64_t, bool> cache;
@@ -65,24 +69,24 @@ Smt2Printer::print(std::stringstream& ss, const std::vector<AigNode>& bits)
     {
       cache.emplace(id, false);
 
-      if (n.is_and())
+      if (mgr.is_and(n))
       {
         visit.push_back(n);
-        visit.push_back(n[0]);
-        visit.push_back(n[1]);
+        visit.push_back(mgr.get_child(n, 0));
+        visit.push_back(mgr.get_child(n, 1));
       }
     }
     else if (!it->second)
     {
       it->second = true;
-      if (n.is_and())
+      if (mgr.is_and(n))
       {
         ss << "(define-fun a" << id << "() (_ BitVec 1) ";
 
         ss << "(bvand ";
-        print(ss, n[0]);
+        print(ss, mgr, mgr.get_child(n, 0));
         ss << " ";
-        print(ss, n[1]);
+        print(ss, mgr, mgr.get_child(n, 1));
         ss << ")";
         ss << ")\n";
       }
@@ -20,8 +20,12 @@ namespace bzla::bb::aig {
 class Smt2Printer
 {
  public:
-  static void print(std::stringstream& ss, const AigNode& n);
-  static void print(std::stringstream& ss, const std::vector<AigNode>& bits);
+  static void print(std::stringstream& ss,
+                    const AigManager& mgr,
+                    const AigNode& n);
+  static void print(std::stringstream& ss,
+                    const AigManager& mgr,
+                    const std::vector<AigNode>& bits);
 };
 
 }  // namespace bzla::bb::aig
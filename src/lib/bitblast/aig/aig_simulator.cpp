@@ -0,0 +1,225 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "bitblast/aig/aig_simulator.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <unordered_set>
+
+#if (defined(__x86_64__) || defined(__i386__)) \
+    && (defined(__GNUC__) || defined(__clang__))
+#define BZLA_AIG_SIMULATOR_X86
+#include <immintrin.h>
+#endif
+
+namespace bzla::bb {
+
+namespace {
+
+/** @return All ones if given literal is negated, and zero otherwise. */
+inline uint64_t
+neg_mask(uint32_t lit)
+{
+  return -static_cast<uint64_t>(lit & 1);
+}
+
+/**
+ * Compute the signatures of given AND gates, W words per signature.
+ * @param sigs   The signatures, the signatures of the gates start at `res`.
+ * @param res    The signature of the first gate.
+ * @param gates  The gates.
+ * @param n      The number of gates.
+ * @param nwords The number of words per signature, only used if W is 0.
+ */
+template <size_t W, class Gate>
+void
+simulate_gates(const uint64_t* sigs,
+               uint64_t* res,
+               const Gate* gates,
+               size_t n,
+               size_t nwords)
+{
+  size_t num_words = W ? W : nwords;
+  for (size_t i = 0; i < n; ++i)
+  {
+    const Gate& gate  = gates[i];
+    const uint64_t* a = sigs + (gate.d_left >> 1) * num_words;
+    const uint64_t* b = sigs + (gate.d_right >> 1) * num_words;
+    uint64_t ma       = neg_mask(gate.d_left);
+    uint64_t mb       = neg_mask(gate.d_right);
+    for (size_t j = 0; j < num_words; ++j)
+    {
+      res[j] = (a[j] ^ ma) & (b[j] ^ mb);
+    }
+    res += num_words;
+  }
+}
+
+#ifdef BZLA_AIG_SIMULATOR_X86
+/** Compute the signatures of given AND gates with 4 words per signature. */
+template <class Gate>
+__attribute__((target("avx2"))) void
+simulate_gates_avx2(const uint64_t* sigs,
+                    uint64_t* res,
+                    const Gate* gates,
+                    size_t n)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    const Gate& gate = gates[i];
+    __m256i a        = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(sigs + (gate.d_left >> 1) * 4));
+    __m256i b = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(sigs + (gate.d_right >> 1) * 4));
+    a = _mm256_xor_si256(
+        a, _mm256_set1_epi64x(static_cast<int64_t>(neg_mask(gate.d_left))));
+    b = _mm256_xor_si256(
+        b, _mm256_set1_epi64x(static_cast<int64_t>(neg_mask(gate.d_right))));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(res),
+                        _mm256_and_si256(a, b));
+    res += 4;
+  }
+}
+#endif
+
+}  // namespace
+
+AigSimulator::AigSimulator(const AigManager& mgr,
+                           const std::vector<AigNode>& roots,
+                           size_t num_words,
+                           uint32_t seed)
+    : d_num_words(num_words), d_rng(seed)
+{
+  assert(num_words > 0);
+
+  // Collect the inputs and the AND gates in the cones of the roots. Ids of
+  // released nodes are reused, the AND gates are thus collected in DFS
+  // post-order to get a topological order.
+  std::unordered_set<int64_t> cache;
+  std::vector<int64_t> inputs;
+  std::vector<AigNode> gates;
+  // Pairs of AIG node and flag indicating whether its children were visited.
+  std::vector<std::pair<AigNode, bool>> visit;
+  for (auto it = roots.rbegin(); it != roots.rend(); ++it)
+  {
+    visit.emplace_back(*it, false);
+  }
+  while (!visit.empty())
+  {
+    auto [cur, expanded] = visit.back();
+    visit.pop_back();
+    int64_t id = std::abs(cur.get_id());
+    if (expanded)
+    {
+      gates.push_back(cur);
+      continue;
+    }
+    if (!cache.insert(id).second)
+    {
+      continue;
+    }
+    if (mgr.is_and(cur))
+    {
+      visit.emplace_back(cur, true);
+      visit.emplace_back(mgr.get_child(cur, 1), false);
+      visit.emplace_back(mgr.get_child(cur, 0), false);
+    }
+    else if (mgr.is_const(cur))
+    {
+      inputs.push_back(id);
+    }
+    else
+    {
+      assert(cur.is_true() || cur.is_false());
+      d_id_to_index.emplace(id, 0);
+    }
+  }
+
+  // The signature of true comes first, followed by the inputs and the gates.
+  std::sort(inputs.begin(), inputs.end());
+  uint32_t index = 1;
+  for (int64_t id : inputs)
+  {
+    d_id_to_index.emplace(id, index++);
+  }
+  d_num_inputs = index - 1;
+  for (const AigNode& gate : gates)
+  {
+    d_id_to_index.emplace(std::abs(gate.get_id()), index++);
+    d_gates.push_back({literal(mgr.get_child(gate, 0)),
+                       literal(mgr.get_child(gate, 1))});
+  }
+
+  d_signatures.resize(index * d_num_words);
+  std::fill(
+      d_signatures.begin(), d_signatures.begin() + d_num_words, UINT64_MAX);
+}
+
+void
+AigSimulator::simulate()
+{
+  uint64_t* sigs = d_signatures.data();
+  for (size_t i = d_num_words, n = (1 + d_num_inputs) * d_num_words; i < n;
+       ++i)
+  {
+    sigs[i] = d_rng.pick<uint64_t>();
+  }
+
+  uint64_t* res = sigs + (1 + d_num_inputs) * d_num_words;
+  size_t n      = d_gates.size();
+  switch (d_num_words)
+  {
+    case 1: simulate_gates<1>(sigs, res, d_gates.data(), n, 1); break;
+    case 4:
+#ifdef BZLA_AIG_SIMULATOR_X86
+      if (__builtin_cpu_supports("avx2"))
+      {
+        simulate_gates_avx2(sigs, res, d_gates.data(), n);
+        break;
+      }
+#endif
+      simulate_gates<4>(sigs, res, d_gates.data(), n, 4);
+      break;
+    default:
+      simulate_gates<0>(sigs, res, d_gates.data(), n, d_num_words);
+  }
+}
+
+uint64_t
+AigSimulator::signature(const AigNode& node, size_t word) const
+{
+  assert(word < d_num_words);
+  uint32_t lit = literal(node);
+  return d_signatures[(lit >> 1) * d_num_words + word] ^ neg_mask(lit);
+}
+
+bool
+AigSimulator::equal_signatures(const AigNode& a, const AigNode& b) const
+{
+  for (size_t i = 0; i < d_num_words; ++i)
+  {
+    if (signature(a, i) != signature(b, i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+uint32_t
+AigSimulator::literal(const AigNode& node) const
+{
+  auto it = d_id_to_index.find(std::abs(node.get_id()));
+  assert(it != d_id_to_index.end());
+  return (it->second << 1) | (node.is_negated() ? 1 : 0);
+}
+
+}  // namespace bzla::bb
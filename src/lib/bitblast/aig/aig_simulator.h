@@ -0,0 +1,105 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA__BITBLAST_AIG_SIMULATOR_H
+#define BZLA__BITBLAST_AIG_SIMULATOR_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "bitblast/aig/aig_manager.h"
+#include "rng/rng.h"
+
+namespace bzla::bb {
+
+/**
+ * Bit-parallel random simulation of AIGs.
+ *
+ * Assigns random patterns to the AIG constants (the inputs) in the cones of
+ * a set of roots and propagates them through the AND gates, processing 64
+ * patterns per machine word. Each node gets a signature of `64 * num_words`
+ * bits, bit i is the value of the node under pattern i. Nodes with different
+ * signatures are not equivalent, nodes with equal signatures are equivalence
+ * candidates.
+ */
+class AigSimulator
+{
+ public:
+  /**
+   * Constructor.
+   * @param mgr       The AIG manager of the roots.
+   * @param roots     The roots of the AIG cones to simulate.
+   * @param num_words The number of 64-bit words per signature, e.g., 1 to
+   *                  simulate 64 and 4 to simulate 256 patterns per round.
+   * @param seed      The seed of the random patterns.
+   */
+  AigSimulator(const AigManager& mgr,
+               const std::vector<AigNode>& roots,
+               size_t num_words = 1,
+               uint32_t seed    = 42);
+
+  /** Simulate one round of fresh random patterns. */
+  void simulate();
+
+  /** @return The number of patterns simulated per round. */
+  size_t num_patterns() const { return 64 * d_num_words; }
+  /** @return The number of AIG constants in the simulated cones. */
+  size_t num_inputs() const { return d_num_inputs; }
+  /** @return The number of AND gates in the simulated cones. */
+  size_t num_ands() const { return d_gates.size(); }
+
+  /**
+   * Get a word of the signature of given node under the patterns of the last
+   * simulation round.
+   * @param node The node, must be in the cone of the roots.
+   * @param word The index of the word, < `num_words`.
+   * @return The word of the signature, bit i is the value of the node under
+   *         pattern `64 * word + i`.
+   */
+  uint64_t signature(const AigNode& node, size_t word = 0) const;
+
+  /**
+   * @return True if given nodes have the same signature under the patterns
+   *         of the last simulation round.
+   */
+  bool equal_signatures(const AigNode& a, const AigNode& b) const;
+
+ private:
+  /**
+   * An AND gate, its children are given as literals, i.e., the index of the
+   * signature of the child shifted left by one, or'ed with 1 if the child is
+   * negated.
+   */
+  struct Gate
+  {
+    uint32_t d_left;
+    uint32_t d_right;
+  };
+
+  /** @return The literal of given node. */
+  uint32_t literal(const AigNode& node) const;
+
+  /** The number of words per signature. */
+  size_t d_num_words;
+  /** The number of inputs, their signatures follow the one of true. */
+  size_t d_num_inputs = 0;
+  /** The AND gates in topological order, signatures follow the inputs. */
+  std::vector<Gate> d_gates;
+  /** Maps the (positive) ids of AIG nodes to the indices of signatures. */
+  std::unordered_map<int64_t, uint32_t> d_id_to_index;
+  /** The signatures, `d_num_words` words per node. */
+  std::vector<uint64_t> d_signatures;
+  /** The random number generator for the patterns. */
+  RNG d_rng;
+};
+
+}  // namespace bzla::bb
+
+#endif
@@ -12,6 +12,11 @@
 
 namespace bzla::bb {
 
+AigBitblaster::AigBitblaster(uint8_t aig_opt_level)
+    : BitblasterInterface<AigNode>(aig_opt_level)
+{
+}
+
 uint64_t
 AigBitblaster::num_aig_ands() const
 {
@@ -30,4 +35,22 @@ AigBitblaster::num_aig_shared() const
   return d_bit_mgr.statistics().num_shared;
 }
 
+uint64_t
+AigBitblaster::aig_memory_usage() const
+{
+  return d_bit_mgr.memory_usage();
+}
+
+const AigManager::Statistics&
+AigBitblaster::aig_statistics() const
+{
+  return d_bit_mgr.statistics();
+}
+
+AigManager&
+AigBitblaster::aig_manager()
+{
+  return d_bit_mgr;
+}
+
 }  // namespace bzla::bb
@@ -18,12 +18,25 @@ namespace bzla::bb {
 class AigBitblaster : public BitblasterInterface<AigNode>
 {
  public:
+  /**
+   * Constructor.
+   * @param aig_opt_level The optimization level of the two-level AIG
+   *                      rewriting applied by the AIG manager.
+   */
+  AigBitblaster(uint8_t aig_opt_level = AigManager::OPT_LEVEL_MAX);
+
   /** @return Number of created AND gates. */
   uint64_t num_aig_ands() const;
   /** @return Number of AIG constants. */
   uint64_t num_aig_consts() const;
   /** @return Number of shared AND gates. */
   uint64_t num_aig_shared() const;
+  /** @return Number of bytes allocated by the AIG manager. */
+  uint64_t aig_memory_usage() const;
+  /** @return The statistics of the AIG manager. */
+  const AigManager::Statistics& aig_statistics() const;
+  /** @return The AIG manager. */
+  AigManager& aig_manager();
 };
 
 }  // namespace bzla::bb
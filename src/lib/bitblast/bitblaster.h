@@ -14,6 +14,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "bv/bitvector.h"
@@ -46,12 +47,55 @@ class BitInterface
   T mk_ite(const T& c, const T& a, const T& b);
 };
 
+/** The encodings of bit-vector multiplication. */
+enum class MulEncoding
+{
+  /** Array of ripple-carry adders over the shifted partial products. */
+  ARRAY,
+  /** Dadda tree of full and half adders over the partial products. */
+  DADDA,
+  /**
+   * Karatsuba split of the product of the lower halves, which is the only
+   * full-width product of a truncated multiplication, Dadda trees otherwise.
+   */
+  KARATSUBA,
+  /** Encoding chosen based on the bit-width. */
+  AUTO,
+};
+
+/** The encodings of unsigned bit-vector division and remainder. */
+enum class DivEncoding
+{
+  /**
+   * Restoring divider, the divisor is only subtracted from the partial
+   * remainder if the result is non-negative.
+   */
+  RESTORING,
+  /**
+   * Non-restoring divider, the divisor is subtracted from non-negative and
+   * added to negative partial remainders, the final remainder is corrected
+   * if it is negative.
+   */
+  NON_RESTORING,
+};
+
 template <class T>
 class BitblasterInterface
 {
  public:
   using Bits = std::vector<T>;
 
+  /**
+   * The minimum bit-width for which MulEncoding::AUTO uses Karatsuba, the
+   * array multiplier is used below.
+   */
+  static constexpr size_t MUL_KARATSUBA_MIN_SIZE = 64;
+
+  /** Set the encoding of bit-vector multiplication. */
+  void set_mul_encoding(MulEncoding encoding) { d_mul_encoding = encoding; }
+  /** Set the encoding of unsigned bit-vector division and remainder. */
+  void set_div_encoding(DivEncoding encoding) { d_div_encoding = encoding; }
+
   virtual Bits bv_value(const BitVector& bv_value)
   {
     Bits res;
@@ -345,23 +389,37 @@ class BitblasterInterface
     // Normalize operands s.t. operands with fixed bits come first
     if (a > b)
     {
-      return mul_helper(b, a);
+      return mul(b, a);
     }
-    return mul_helper(a, b);
+    return mul(a, b);
   }
 
   virtual Bits bv_udiv(const Bits& a, const Bits& b)
   {
-    auto [res, rem] = udiv_urem_helper(a, b);
+    auto [res, rem] = bv_udiv_urem(a, b);
     return res;
   }
 
   virtual Bits bv_urem(const Bits& a, const Bits& b)
   {
-    auto [res, rem] = udiv_urem_helper(a, b);
+    auto [res, rem] = bv_udiv_urem(a, b);
     return rem;
   }
 
+  /**
+   * Bit-blast unsigned division and remainder of `a` by `b`, which share
+   * one divider circuit.
+   * @return A pair of the quotient and the remainder.
+   */
+  virtual std::pair<Bits, Bits> bv_udiv_urem(const Bits& a, const Bits& b)
+  {
+    if (d_div_encoding == DivEncoding::NON_RESTORING)
+    {
+      return udiv_urem_non_restoring(a, b);
+    }
+    return udiv_urem_helper(a, b);
+  }
+
   /**
    * Bit-blast if-then-else over bit-vectors `a` and `b` of size k, and a
    * condition `cond` of size 1.
@@ -378,10 +436,28 @@ class BitblasterInterface
   }
 
  protected:
+  /** Constructor, forwards given arguments to the bit manager. */
+  template <class... Args>
+  BitblasterInterface(Args&&... args) : d_bit_mgr(std::forward<Args>(args)...)
+  {
+  }
 
   BitInterface<T> d_bit_mgr;
+  /** The encoding of bit-vector multiplication. */
+  MulEncoding d_mul_encoding = MulEncoding::ARRAY;
+  /** The encoding of unsigned bit-vector division and remainder. */
+  DivEncoding d_div_encoding = DivEncoding::RESTORING;
 
  private:
+  /**
+   * Bits of equal weight, `Columns[i]` are the bits of weight 2^i. The
+   * number of columns is the bit-width of their sum.
+   */
+  using Columns = std::vector<Bits>;
+
+  /** The bit-width below which sub-products are not split by Karatsuba. */
+  static constexpr size_t s_karatsuba_split_min_size = 16;
+
   Bits add_helper(const Bits& a, const Bits& b)
   {
     Bits res;
@@ -424,6 +500,266 @@ class BitblasterInterface
     return res;
   }
 
+  /** Multiply `a` and `b` with the configured encoding. */
+  Bits mul(const Bits& a, const Bits& b)
+  {
+    MulEncoding encoding = d_mul_encoding;
+    if (encoding == MulEncoding::AUTO)
+    {
+      encoding = a.size() >= MUL_KARATSUBA_MIN_SIZE ? MulEncoding::KARATSUBA
+                                                    : MulEncoding::ARRAY;
+    }
+    switch (encoding)
+    {
+      case MulEncoding::DADDA: return mul_dadda(a, b);
+      case MulEncoding::KARATSUBA: return mul_karatsuba(a, b);
+      default: return mul_helper(a, b);
+    }
+  }
+
+  /**
+   * Multiply `a` and `b` by summing up the partial products with a Dadda
+   * tree.
+   */
+  Bits mul_dadda(const Bits& a, const Bits& b)
+  {
+    size_t size = a.size();
+    Columns cols(size);
+    // Note: Bits are MSB first, columns are indexed by weight.
+    for (size_t i = 0; i < size; ++i)
+    {
+      for (size_t j = 0; i + j < size; ++j)
+      {
+        cols[i + j].push_back(
+            d_bit_mgr.mk_and(a[size - 1 - i], b[size - 1 - j]));
+      }
+    }
+    Bits res = sum_columns(cols);
+    return Bits(res.rbegin(), res.rend());
+  }
+
+  /**
+   * Multiply `a` and `b` of size n, modulo 2^n.
+   *
+   * With a = a1 * 2^h + a0 and b = b1 * 2^h + b0, for h = n / 2, the
+   * truncated product is a0 * b0 + 2^h * (a1 * b0 + a0 * b1). The product of
+   * the lower halves is computed at full width by Karatsuba multiplication,
+   * the partial products of the truncated cross terms are summed up in the
+   * same Dadda tree.
+   */
+  Bits mul_karatsuba(const Bits& a, const Bits& b)
+  {
+    size_t size = a.size();
+    if (size < 2 * s_karatsuba_split_min_size)
+    {
+      return mul_dadda(a, b);
+    }
+    size_t h = size / 2;
+    // Note: Bits are MSB first, the operands of mul_full() are LSB first.
+    Bits a0(a.rbegin(), a.rbegin() + h), b0(b.rbegin(), b.rbegin() + h);
+    Columns cols(size);
+    Bits z0 = mul_full(a0, b0);
+    for (size_t i = 0; i < z0.size(); ++i)
+    {
+      cols[i].push_back(z0[i]);
+    }
+    for (size_t i = 0; i < h; ++i)
+    {
+      for (size_t j = h; i + j < size; ++j)
+      {
+        cols[i + j].push_back(
+            d_bit_mgr.mk_and(a[size - 1 - i], b[size - 1 - j]));
+        cols[i + j].push_back(
+            d_bit_mgr.mk_and(a[size - 1 - j], b[size - 1 - i]));
+      }
+    }
+    // For odd n, a1 * b1 contributes its lowest bit.
+    if (2 * h < size)
+    {
+      cols[2 * h].push_back(d_bit_mgr.mk_and(a[size - 1 - h], b[size - 1 - h]));
+    }
+    Bits res = sum_columns(cols);
+    return Bits(res.rbegin(), res.rend());
+  }
+
+  /**
+   * Full-width Karatsuba multiplication of `x` and `y` of equal size k, bits
+   * are LSB first.
+   *
+   * With x = x1 * 2^h + x0 and y = y1 * 2^h + y0, for h = k / 2, the product
+   * is z2 * 2^2h + (z1 - z2 - z0) * 2^h + z0, where z0 = x0 * y0,
+   * z2 = x1 * y1 and z1 = (x0 + x1) * (y0 + y1).
+   *
+   * @return The product of size 2k, LSB first.
+   */
+  Bits mul_full(const Bits& x, const Bits& y)
+  {
+    assert(x.size() == y.size());
+    size_t size = x.size();
+    size_t w    = 2 * size;
+    Columns cols(w);
+    if (size < s_karatsuba_split_min_size)
+    {
+      for (size_t i = 0; i < size; ++i)
+      {
+        for (size_t j = 0; j < size; ++j)
+        {
+          cols[i + j].push_back(d_bit_mgr.mk_and(x[i], y[j]));
+        }
+      }
+      return sum_columns(cols);
+    }
+
+    size_t h = size / 2;
+    Bits x0(x.begin(), x.begin() + h), x1(x.begin() + h, x.end());
+    Bits y0(y.begin(), y.begin() + h), y1(y.begin() + h, y.end());
+    Bits z0 = mul_full(x0, y0);
+    Bits z2 = mul_full(x1, y1);
+    // Sums of the halves, of size k - h + 1.
+    Columns xs(size - h + 1), ys(size - h + 1);
+    for (size_t i = 0; i < size - h; ++i)
+    {
+      xs[i].push_back(x1[i]);
+      ys[i].push_back(y1[i]);
+      if (i < h)
+      {
+        xs[i].push_back(x0[i]);
+        ys[i].push_back(y0[i]);
+      }
+    }
+    Bits z1 = mul_full(sum_columns(xs), sum_columns(ys));
+
+    for (size_t i = 0; i < z0.size(); ++i)
+    {
+      cols[i].push_back(z0[i]);
+    }
+    for (size_t i = 0; i < z2.size(); ++i)
+    {
+      cols[2 * h + i].push_back(z2[i]);
+    }
+    for (size_t i = 0; i < z1.size() && h + i < w; ++i)
+    {
+      cols[h + i].push_back(z1[i]);
+    }
+    // Subtract z0 and z2 at weight 2^h as ~z + 1, the constant bits of the
+    // two's complements (the inverted zero extension and the 1) are summed
+    // up into one constant.
+    BitVector cst = BitVector::mk_zero(w);
+    for (const Bits* z : {&z0, &z2})
+    {
+      for (size_t i = 0; i < z->size(); ++i)
+      {
+        cols[h + i].push_back(d_bit_mgr.mk_not((*z)[i]));
+      }
+      cst.ibvadd(BitVector::mk_ones(w).ibvshl(h + z->size()));
+      cst.ibvadd(BitVector::mk_one(w).ibvshl(h));
+    }
+    for (size_t i = 0; i < w; ++i)
+    {
+      if (cst.bit(i))
+      {
+        cols[i].push_back(d_bit_mgr.mk_true());
+      }
+    }
+    return sum_columns(cols);
+  }
+
+  /**
+   * Sum up the bits of given columns modulo 2^n, where n is the number of
+   * columns.
+   *
+   * The columns are reduced to a height of at most two by a Dadda tree of
+   * full and half adders, the two remaining rows are summed up by a
+   * ripple-carry adder.
+   *
+   * @return The sum of size n, LSB first.
+   */
+  Bits sum_columns(Columns& cols)
+  {
+    size_t size   = cols.size();
+    size_t height = 0;
+    for (const Bits& col : cols)
+    {
+      height = std::max(height, col.size());
+    }
+    // The maximum column heights of the stages: d_1 = 2, d_j+1 = 3/2 * d_j.
+    std::vector<size_t> stages{2};
+    while (stages.back() < height)
+    {
+      stages.push_back(stages.back() * 3 / 2);
+    }
+    stages.pop_back();
+
+    for (auto it = stages.rbegin(); it != stages.rend(); ++it)
+    {
+      size_t d = *it;
+      Columns next(size);
+      for (size_t c = 0; c < size; ++c)
+      {
+        const Bits& col = cols[c];
+        // Bits of next[c] are sums and carries of this stage.
+        size_t i = 0;
+        while (col.size() - i + next[c].size() > d && col.size() - i >= 2)
+        {
+          T sum, carry;
+          if (col.size() - i + next[c].size() - d >= 2 && col.size() - i >= 3)
+          {
+            std::tie(sum, carry) = full_adder(col[i], col[i + 1], col[i + 2]);
+            i += 3;
+          }
+          else
+          {
+            std::tie(sum, carry) = half_adder(col[i], col[i + 1]);
+            i += 2;
+          }
+          next[c].push_back(sum);
+          if (c + 1 < size)
+          {
+            next[c + 1].push_back(carry);
+          }
+        }
+        next[c].insert(next[c].end(), col.begin() + i, col.end());
+      }
+      cols = std::move(next);
+    }
+
+    Bits res;
+    res.reserve(size);
+    T carry;
+    bool has_carry = false;
+    for (size_t c = 0; c < size; ++c)
+    {
+      Bits& col = cols[c];
+      if (has_carry)
+      {
+        col.push_back(carry);
+      }
+      assert(col.size() <= 3);
+      has_carry = col.size() >= 2;
+      if (col.empty())
+      {
+        res.push_back(d_bit_mgr.mk_false());
+      }
+      else if (col.size() == 1)
+      {
+        res.push_back(col[0]);
+      }
+      else if (col.size() == 2)
+      {
+        T sum;
+        std::tie(sum, carry) = half_adder(col[0], col[1]);
+        res.push_back(sum);
+      }
+      else
+      {
+        T sum;
+        std::tie(sum, carry) = full_adder(col[0], col[1], col[2]);
+        res.push_back(sum);
+      }
+    }
+    return res;
+  }
+
   T ult_helper(const Bits& a, const Bits& b)
   {
     size_t lsb = a.size() - 1;
@@ -607,6 +943,62 @@ class BitblasterInterface
     Bits r(rem.rbegin(), rem.rend() - 1);
     return std::make_pair(quot, r);
   }
+
+  /**
+   * Encode non-restoring divider circuit.
+   *
+   * Returns a pair of bits consisting of the quotient and remainder of the
+   * division operation.
+   */
+  std::pair<Bits, Bits> udiv_urem_non_restoring(const Bits& a, const Bits& b)
+  {
+    // The partial remainder r satisfies -d <= r < d and is represented in
+    // two's complement with size + 1 bits, which is sufficient to compute
+    // 2 * r + a[i] +/- d modulo 2^(size + 1).
+    //
+    // Note: In the following, bits of remainder and divisor are reversed to
+    //       keep loop indices simpler.
+    size_t size = a.size();
+    Bits d, rem, quot;
+    d.reserve(size + 1);
+    for (auto it = b.rbegin(); it != b.rend(); ++it)
+    {
+      d.push_back(*it);
+    }
+    d.push_back(d_bit_mgr.mk_false());
+    rem.resize(size + 1, d_bit_mgr.mk_false());
+
+    // The initial remainder is non-negative, start with subtraction.
+    T sub = d_bit_mgr.mk_true();
+    for (size_t i = 0; i < size; ++i)
+    {
+      // Shift in the ith bit of the dividend and add (sub = 0) or subtract
+      // (sub = 1) the divisor, -d == ~d + 1.
+      T carry = sub;
+      T prev  = a[i];
+      for (size_t j = 0; j <= size; ++j)
+      {
+        T tmp = rem[j];
+        std::tie(rem[j], carry) =
+            full_adder(prev, mk_xor(d[j], sub), carry);
+        prev = tmp;
+      }
+      // The quotient bit is 1 if the new remainder is non-negative, which
+      // also determines whether the divisor is subtracted in the next step.
+      sub = d_bit_mgr.mk_not(rem[size]);
+      quot.push_back(sub);
+    }
+
+    // Correct the remainder by adding the divisor if it is negative.
+    Bits r(size);
+    T carry = d_bit_mgr.mk_false();
+    for (size_t j = 0; j < size; ++j)
+    {
+      std::tie(r[size - 1 - j], carry) =
+          full_adder(rem[j], d_bit_mgr.mk_and(d[j], rem[size]), carry);
+    }
+    return std::make_pair(quot, r);
+  }
 };
 
 }  // namespace bzla::bb
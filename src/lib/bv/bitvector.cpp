@@ -10,13 +10,14 @@
 
 #include "bv/bitvector.h"
 
-#include <bitset>
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <sstream>
 #include <unordered_set>
 #include <utility>
 
+#include "bv/limb_kernels.h"
 #include "rng/rng.h"
 
 namespace bzla {
@@ -74,6 +75,804 @@ clz_limb(uint64_t nbits_per_limb, mp_limb_t limb)
   return nbits_per_limb - 1 - w;
 }
 #endif
+
+/* -------------------------------------------------------------------------- */
+/* Kernels for bit-vectors represented as fixed number of 64-bit limbs.       */
+/* -------------------------------------------------------------------------- */
+
+/** The number of limbs of bit-vectors represented as limbs. */
+constexpr uint32_t n_limbs = BitVector::s_max_size_limbs / 64;
+
+/** @return The number of leading zeros of given non-zero limb. */
+uint64_t
+clz64(uint64_t limb)
+{
+  assert(limb);
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<uint64_t>(__builtin_clzll(limb));
+#else
+  uint64_t res = 0;
+  for (uint64_t mask = (uint64_t) 1 << 63; !(limb & mask); mask >>= 1) ++res;
+  return res;
+#endif
+}
+
+/** @return The number of trailing zeros of given non-zero limb. */
+uint64_t
+ctz64(uint64_t limb)
+{
+  assert(limb);
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<uint64_t>(__builtin_ctzll(limb));
+#else
+  uint64_t res = 0;
+  for (; !(limb & 1); limb >>= 1) ++res;
+  return res;
+#endif
+}
+
+#ifdef __SIZEOF_INT128__
+/**
+ * Unsigned 128-bit integer for double-limb arithmetic. Declared as extension
+ * since ISO C++ does not support __int128.
+ */
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+/**
+ * Compute the full 128-bit product of two limbs.
+ * @param a  The first limb.
+ * @param b  The second limb.
+ * @param hi The result pointer for the upper 64 bits of the product.
+ * @return The lower 64 bits of the product.
+ */
+uint64_t
+mul64(uint64_t a, uint64_t b, uint64_t* hi)
+{
+#ifdef __SIZEOF_INT128__
+  uint128_t p = static_cast<uint128_t>(a) * b;
+  *hi         = static_cast<uint64_t>(p >> 64);
+  return static_cast<uint64_t>(p);
+#else
+  uint64_t a_lo = a & UINT32_MAX, a_hi = a >> 32;
+  uint64_t b_lo = b & UINT32_MAX, b_hi = b >> 32;
+  uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi;
+  uint64_t hl = a_hi * b_lo, hh = a_hi * b_hi;
+  uint64_t mid = (ll >> 32) + (lh & UINT32_MAX) + (hl & UINT32_MAX);
+  *hi          = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+  return (mid << 32) | (ll & UINT32_MAX);
+#endif
+}
+
+/**
+ * Clear all bits at positions >= size.
+ * @param limbs The limbs to normalize.
+ * @param size  The bit-width.
+ */
+void
+limbs_normalize(uint64_t* limbs, uint64_t size)
+{
+  for (uint32_t i = 0; i < n_limbs; ++i)
+  {
+    uint64_t lo = i * 64;
+    if (lo >= size)
+    {
+      limbs[i] = 0;
+    }
+    else if (size - lo < 64)
+    {
+      limbs[i] &= UINT64_MAX >> (64 - (size - lo));
+    }
+  }
+}
+
+/** @return True if all limbs are zero. */
+bool
+limbs_is_zero(const uint64_t* limbs)
+{
+  uint64_t res = 0;
+  for (uint32_t i = 0; i < n_limbs; ++i)
+  {
+    res |= limbs[i];
+  }
+  return res == 0;
+}
+
+/** @return The number of limbs up to and including the most significant
+ *          non-zero limb. */
+uint32_t
+limbs_size(const uint64_t* limbs)
+{
+  uint32_t n = n_limbs;
+  while (n > 0 && limbs[n - 1] == 0) --n;
+  return n;
+}
+
+/** @return -1, 0 or 1 if `a` is less than, equal to or greater than `b`. */
+int32_t
+limbs_cmp(const uint64_t* a, const uint64_t* b)
+{
+  for (uint32_t i = n_limbs; i-- > 0;)
+  {
+    if (a[i] != b[i])
+    {
+      return a[i] < b[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Compute `res = a + b`.
+ * @return The carry out of the most significant limb.
+ */
+uint64_t
+limbs_add(uint64_t* res, const uint64_t* a, const uint64_t* b)
+{
+  uint64_t carry = 0;
+  for (uint32_t i = 0; i < n_limbs; ++i)
+  {
+    uint64_t s = a[i] + carry;
+    carry      = s < carry;
+    res[i]     = s + b[i];
+    carry += res[i] < s;
+  }
+  return carry;
+}
+
+/** Compute `res = a - b`. */
+void
+limbs_sub(uint64_t* res, const uint64_t* a, const uint64_t* b)
+{
+  uint64_t borrow = 0;
+  for (uint32_t i = 0; i < n_limbs; ++i)
+  {
+    uint64_t d  = a[i] - b[i];
+    uint64_t b1 = a[i] < b[i];
+    res[i]      = d - borrow;
+    borrow      = b1 | (d < borrow);
+  }
+}
+
+/** Compute `res = a + value`. */
+void
+limbs_add_ui(uint64_t* res, const uint64_t* a, uint64_t value)
+{
+  uint64_t carry = value;
+  for (uint32_t i = 0; i < n_limbs; ++i)
+  {
+    res[i] = a[i] + carry;
+    carry  = res[i] < carry;
+  }
+}
+
+/** Compute `res = a - value`. */
+void
+limbs_sub_ui(uint64_t* res, const uint64_t* a, uint64_t value)
+{
+  uint64_t borrow = value;
+  for (uint32_t i = 0; i < n_limbs; ++i)
+  {
+    uint64_t d = a[i] - borrow;
+    borrow     = a[i] < borrow;
+    res[i]     = d;
+  }
+}
+
+/**
+ * Compute the product of `a` and `b` truncated to `n_limbs` limbs (`prod`),
+ * and the limbs above that (`hi`), if `hi` is not null.
+ */
+void
+limbs_mul(uint64_t* prod, uint64_t* hi, const uint64_t* a, const uint64_t* b)
+{
+  uint64_t res[2 * n_limbs] = {0};
+  uint32_t na = limbs_size(a), nb = limbs_size(b);
+  for (uint32_t i = 0; i < na; ++i)
+  {
+    uint64_t carry = 0;
+    // Only the truncated product is needed if hi is null.
+    uint32_t n = hi ? nb : std::min(nb, n_limbs - i);
+    for (uint32_t j = 0; j < n; ++j)
+    {
+      uint64_t h;
+      uint64_t l = mul64(a[i], b[j], &h);
+      l += carry;
+      h += l < carry;
+      res[i + j] += l;
+      h += res[i + j] < l;
+      carry = h;
+    }
+    if (i + n < 2 * n_limbs)
+    {
+      res[i + n] = carry;
+    }
+  }
+  for (uint32_t i = 0; i < n_limbs; ++i)
+  {
+    prod[i] = res[i];
+    if (hi) hi[i] = res[n_limbs + i];
+  }
+}
+
+/** Compute `res = a << shift`. */
+void
+limbs_shl(uint64_t* res, const uint64_t* a, uint64_t shift)
+{
+  uint64_t limb_shift = shift / 64, bit_shift = shift % 64;
+  for (uint32_t i = n_limbs; i-- > 0;)
+  {
+    uint64_t val = 0;
+    if (i >= limb_shift)
+    {
+      uint64_t j = i - limb_shift;
+      val        = a[j] << bit_shift;
+      if (bit_shift && j > 0)
+      {
+        val |= a[j - 1] >> (64 - bit_shift);
+      }
+    }
+    res[i] = val;
+  }
+}
+
+/** Compute `res = a >> shift` (logical shift). */
+void
+limbs_shr(uint64_t* res, const uint64_t* a, uint64_t shift)
+{
+  uint64_t limb_shift = shift / 64, bit_shift = shift % 64;
+  for (uint32_t i = 0; i < n_limbs; ++i)
+  {
+    uint64_t val = 0;
+    if (i + limb_shift < n_limbs)
+    {
+      uint64_t j = i + limb_shift;
+      val        = a[j] >> bit_shift;
+      if (bit_shift && j + 1 < n_limbs)
+      {
+        val |= a[j + 1] << (64 - bit_shift);
+      }
+    }
+    res[i] = val;
+  }
+}
+
+/**
+ * Compute unsigned division with remainder, `quot = a / b` and
+ * `rem = a % b`, with `b` non-zero.
+ *
+ * Implements Knuth's Algorithm D (TAOCP Vol. 2, 4.3.1) on 32-bit digits,
+ * which only requires 64-bit intermediate results.
+ */
+void
+limbs_divrem(uint64_t* quot,
+             uint64_t* rem,
+             const uint64_t* a,
+             const uint64_t* b)
+{
+  constexpr uint32_t n_digits = 2 * n_limbs;
+  constexpr uint64_t base     = (uint64_t) 1 << 32;
+  uint32_t u[n_digits], v[n_digits], q[n_digits] = {0};
+
+  for (uint32_t i = 0; i < n_limbs; ++i)
+  {
+    u[2 * i]     = static_cast<uint32_t>(a[i]);
+    u[2 * i + 1] = static_cast<uint32_t>(a[i] >> 32);
+    v[2 * i]     = static_cast<uint32_t>(b[i]);
+    v[2 * i + 1] = static_cast<uint32_t>(b[i] >> 32);
+  }
+  uint32_t m = n_digits, n = n_digits;
+  while (m > 0 && u[m - 1] == 0) --m;
+  while (n > 0 && v[n - 1] == 0) --n;
+  assert(n > 0);
+
+  if (m < n)
+  {
+    std::copy(a, a + n_limbs, rem);
+    std::fill(quot, quot + n_limbs, 0);
+    return;
+  }
+
+  uint32_t r[n_digits] = {0};
+  if (n == 1)
+  {
+    uint64_t k = 0;
+    for (uint32_t j = m; j-- > 0;)
+    {
+      uint64_t t = k * base + u[j];
+      q[j]       = static_cast<uint32_t>(t / v[0]);
+      k          = t - q[j] * v[0];
+    }
+    r[0] = static_cast<uint32_t>(k);
+  }
+  else
+  {
+    // Normalize such that the most significant digit of the divisor has its
+    // most significant bit set.
+    uint32_t s = static_cast<uint32_t>(clz64(v[n - 1]) - 32);
+    uint32_t vn[n_digits], un[n_digits + 1];
+    for (uint32_t i = n - 1; i > 0; --i)
+    {
+      vn[i] = static_cast<uint32_t>((static_cast<uint64_t>(v[i]) << s)
+                                    | (static_cast<uint64_t>(v[i - 1]) >> (32 - s)));
+    }
+    vn[0] = v[0] << s;
+    un[m] = static_cast<uint32_t>(static_cast<uint64_t>(u[m - 1]) >> (32 - s));
+    for (uint32_t i = m - 1; i > 0; --i)
+    {
+      un[i] = static_cast<uint32_t>((static_cast<uint64_t>(u[i]) << s)
+                                    | (static_cast<uint64_t>(u[i - 1]) >> (32 - s)));
+    }
+    un[0] = u[0] << s;
+
+    for (uint32_t j = m - n + 1; j-- > 0;)
+    {
+      // Estimate quotient digit.
+      uint64_t num  = static_cast<uint64_t>(un[j + n]) * base + un[j + n - 1];
+      uint64_t qhat = num / vn[n - 1];
+      uint64_t rhat = num - qhat * vn[n - 1];
+      while (qhat >= base
+             || qhat * vn[n - 2] > base * rhat + un[j + n - 2])
+      {
+        qhat -= 1;
+        rhat += vn[n - 1];
+        if (rhat >= base) break;
+      }
+      // Multiply and subtract.
+      int64_t k = 0, t;
+      for (uint32_t i = 0; i < n; ++i)
+      {
+        uint64_t p = qhat * vn[i];
+        t          = un[i + j] - k - static_cast<int64_t>(p & UINT32_MAX);
+        un[i + j]  = static_cast<uint32_t>(t);
+        k          = static_cast<int64_t>(p >> 32) - (t >> 32);
+      }
+      t         = un[j + n] - k;
+      un[j + n] = static_cast<uint32_t>(t);
+      q[j]      = static_cast<uint32_t>(qhat);
+      // Add back if we subtracted too much.
+      if (t < 0)
+      {
+        q[j] -= 1;
+        uint64_t c = 0;
+        for (uint32_t i = 0; i < n; ++i)
+        {
+          c         = static_cast<uint64_t>(un[i + j]) + vn[i] + c;
+          un[i + j] = static_cast<uint32_t>(c);
+          c >>= 32;
+        }
+        un[j + n] = static_cast<uint32_t>(un[j + n] + c);
+      }
+    }
+    // Unnormalize remainder.
+    for (uint32_t i = 0; i < n - 1; ++i)
+    {
+      r[i] = static_cast<uint32_t>((static_cast<uint64_t>(un[i]) >> s)
+                                   | (static_cast<uint64_t>(un[i + 1]) << (32 - s)));
+    }
+    r[n - 1] = static_cast<uint32_t>(static_cast<uint64_t>(un[n - 1]) >> s);
+  }
+
+  for (uint32_t i = 0; i < n_limbs; ++i)
+  {
+    quot[i] = static_cast<uint64_t>(q[2 * i])
+              | (static_cast<uint64_t>(q[2 * i + 1]) << 32);
+    rem[i] = static_cast<uint64_t>(r[2 * i])
+             | (static_cast<uint64_t>(r[2 * i + 1]) << 32);
+  }
+}
+
+/** Store the value of given limbs in the given initialized GMP value. */
+void
+limbs_to_mpz(mpz_t res, const uint64_t* limbs)
+{
+  mpz_import(res, n_limbs, -1, sizeof(uint64_t), 0, 0, limbs);
+}
+
+/** Store the value of given GMP value (< 2^256) in given limbs. */
+void
+mpz_to_limbs(uint64_t* limbs, const mpz_t val)
+{
+  assert(mpz_sgn(val) >= 0);
+  assert(mpz_sizeinbase(val, 2) <= BitVector::s_max_size_limbs);
+  std::fill(limbs, limbs + n_limbs, 0);
+  mpz_export(limbs, nullptr, -1, sizeof(uint64_t), 0, 0, val);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Limb-wise operations on GMP values via (vectorized) limb kernels.          */
+/* -------------------------------------------------------------------------- */
+
+/**
+ * True if GMP values are represented as 64-bit limbs without nail bits, and
+ * can thus directly be processed with the limb kernels.
+ */
+constexpr bool gmp_limbs_64 = GMP_LIMB_BITS == 64 && GMP_NAIL_BITS == 0;
+
+/** @return The limbs of given GMP value for reading. */
+const uint64_t*
+gmp_limbs_read(mpz_srcptr val)
+{
+  return reinterpret_cast<const uint64_t*>(mpz_limbs_read(val));
+}
+
+/**
+ * Compute a limb-wise binary operation on given non-negative GMP values.
+ * @param res    The initialized GMP value to store the result in. May alias
+ *               `a` or `b`.
+ * @param a      The first operand.
+ * @param b      The second operand.
+ * @param kernel The limb kernel implementing the operation.
+ * @param is_and True if the operation is a conjunction, i.e., limbs above the
+ *               size of the smaller operand are zero.
+ */
+void
+gmp_bitwise(mpz_ptr res,
+            mpz_srcptr a,
+            mpz_srcptr b,
+            void (*kernel)(uint64_t*, const uint64_t*, const uint64_t*, size_t),
+            bool is_and)
+{
+  size_t na = mpz_size(a), nb = mpz_size(b);
+  if (na < nb)
+  {
+    std::swap(a, b);
+    std::swap(na, nb);
+  }
+  size_t n = is_and ? nb : na;
+  if (n == 0)
+  {
+    mpz_set_ui(res, 0);
+    return;
+  }
+  // Preserve the value of the result if it is also an operand.
+  uint64_t* rp = reinterpret_cast<uint64_t*>(
+      res == a || res == b ? mpz_limbs_modify(res, n)
+                           : mpz_limbs_write(res, n));
+  const uint64_t* ap = gmp_limbs_read(a);
+  kernel(rp, ap, gmp_limbs_read(b), nb);
+  if (!is_and && rp != ap)
+  {
+    std::copy(ap + nb, ap + na, rp + nb);
+  }
+  mpz_limbs_finish(res, n);
+}
+
+/**
+ * Compute the bitwise negation of given non-negative GMP value, truncated to
+ * `size` bits.
+ * @param res  The initialized GMP value to store the result in. May alias
+ *             `a`.
+ * @param a    The operand, must be less than 2^size.
+ * @param size The bit-width.
+ */
+void
+gmp_not(mpz_ptr res, mpz_srcptr a, uint64_t size)
+{
+  size_t na = mpz_size(a), n = (size + 63) / 64;
+  uint64_t* rp = reinterpret_cast<uint64_t*>(
+      res == a ? mpz_limbs_modify(res, n) : mpz_limbs_write(res, n));
+  LimbKernels::get().bvnot(rp, gmp_limbs_read(a), na);
+  std::fill(rp + na, rp + n, UINT64_MAX);
+  if (size % 64)
+  {
+    rp[n - 1] &= UINT64_MAX >> (64 - size % 64);
+  }
+  mpz_limbs_finish(res, n);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Conversion between limbs and binary/hexadecimal strings.                   */
+/* -------------------------------------------------------------------------- */
+
+/** @return The number of bits per digit in given base (2 or 16). */
+uint32_t
+pow2_bits_per_digit(uint32_t base)
+{
+  assert(base == 2 || base == 16);
+  return base == 2 ? 1 : 4;
+}
+
+/** @return The value of given binary or hexadecimal digit. */
+uint64_t
+pow2_digit_value(char c)
+{
+  return c <= '9' ? static_cast<uint64_t>(c - '0')
+                  : static_cast<uint64_t>((c | 0x20) - 'a' + 10);
+}
+
+/**
+ * Determine the number of significant bits of the absolute value of given
+ * binary or hexadecimal string.
+ * @param str     The string, may be preceded by '-'.
+ * @param base    The base, 2 or 16.
+ * @param is_pow2 Set to true if the absolute value is a power of two.
+ * @return The number of significant bits.
+ */
+uint64_t
+pow2_str_num_bits(const std::string& str, uint32_t base, bool& is_pow2)
+{
+  uint32_t bits = pow2_bits_per_digit(base);
+  size_t i = str[0] == '-' ? 1 : 0, n = str.size();
+  while (i < n && str[i] == '0') ++i;
+  if (i == n)
+  {
+    is_pow2 = false;
+    return 0;
+  }
+  uint64_t msd = pow2_digit_value(str[i]);
+  is_pow2      = (msd & (msd - 1)) == 0
+            && str.find_first_not_of('0', i + 1) == std::string::npos;
+  return (n - i - 1) * bits + 64 - clz64(msd);
+}
+
+/**
+ * Store the value of given binary or hexadecimal string, truncated to `size`
+ * bits, in given limbs.
+ * @param limbs The limbs to store the value in, least significant first.
+ * @param n     The number of limbs, must be at least `ceil(size / 64)`.
+ * @param str   The string.
+ * @param base  The base, 2 or 16.
+ * @param size  The bit-width.
+ */
+void
+pow2_str_to_limbs(uint64_t* limbs,
+                  size_t n,
+                  const std::string& str,
+                  uint32_t base,
+                  uint64_t size)
+{
+  uint32_t bits = pow2_bits_per_digit(base);
+  // Digits never cross limb boundaries since the number of bits per digit
+  // divides 64. Digits at positions >= n * 64 are truncated.
+  size_t ndigits = 64 / bits;
+  size_t end     = str.size();
+  for (size_t i = 0; i < n; ++i)
+  {
+    size_t begin = end > ndigits ? end - ndigits : 0;
+    uint64_t val = 0;
+    for (size_t j = begin; j < end; ++j)
+    {
+      val = (val << bits) | pow2_digit_value(str[j]);
+    }
+    limbs[i] = val;
+    end      = begin;
+  }
+  for (size_t i = 0; i < n; ++i)
+  {
+    uint64_t pos = i * 64;
+    if (pos >= size)
+    {
+      limbs[i] = 0;
+    }
+    else if (size - pos < 64)
+    {
+      limbs[i] &= UINT64_MAX >> (64 - (size - pos));
+    }
+  }
+}
+
+/**
+ * Determine the number of digits of the binary or hexadecimal representation
+ * of a bit-vector value. Binary representations are padded with zeros to the
+ * bit-width, hexadecimal representations omit leading zeros.
+ * @param size  The bit-width.
+ * @param nbits The number of significant bits of the value.
+ * @param base  The base, 2 or 16.
+ * @return The number of digits.
+ */
+uint64_t
+pow2_str_num_digits(uint64_t size, uint64_t nbits, uint32_t base)
+{
+  if (base == 2)
+  {
+    return size;
+  }
+  return std::max<uint64_t>((nbits + 3) / 4, 1);
+}
+
+/**
+ * Write `count` binary or hexadecimal digits of given value, starting from the
+ * digit at position `hi` (most significant first).
+ * @param buf   The buffer to write the digits to.
+ * @param limbs The limbs of the value, least significant first.
+ * @param n     The number of limbs, limbs above are zero.
+ * @param hi    The position of the most significant digit to write.
+ * @param count The number of digits to write, at most `hi + 1`.
+ * @param base  The base, 2 or 16.
+ */
+void
+limbs_to_pow2_str(char* buf,
+                  const uint64_t* limbs,
+                  size_t n,
+                  uint64_t hi,
+                  uint64_t count,
+                  uint32_t base)
+{
+  static constexpr char digits[] = "0123456789abcdef";
+  uint32_t bits                  = pow2_bits_per_digit(base);
+  uint64_t mask                  = base - 1;
+  uint64_t pos                   = hi * bits;
+  for (uint64_t i = 0; i < count;)
+  {
+    // Write the digits of the limb at pos, starting at bit pos % 64.
+    uint64_t idx  = pos / 64;
+    uint64_t limb = idx < n ? limbs[idx] : 0;
+    int64_t off   = static_cast<int64_t>(pos % 64);
+    for (; off >= 0 && i < count; off -= bits, ++i)
+    {
+      buf[i] = digits[(limb >> off) & mask];
+    }
+    pos = idx * 64 - bits;
+  }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Modular inverse and division kernels.                                      */
+/* -------------------------------------------------------------------------- */
+
+/**
+ * Compute the inverse of given odd value modulo 2^64 via Newton iteration.
+ *
+ * The initial approximation `(3 * a) ^ 2` is correct in the 5 least
+ * significant bits, each step `x = x * (2 - a * x)` doubles the number of
+ * correct bits.
+ */
+uint64_t
+uint64_modinv(uint64_t a)
+{
+  assert(a & 1);
+  uint64_t x = (3 * a) ^ 2;
+  for (uint32_t i = 0; i < 4; ++i)
+  {
+    x *= 2 - a * x;
+  }
+  assert(a * x == 1);
+  return x;
+}
+
+/**
+ * Compute the inverse of given odd value modulo 2^(64 * n_limbs) via Newton
+ * iteration, starting from the inverse of the least significant limb.
+ */
+void
+limbs_modinv(uint64_t* res, const uint64_t* a)
+{
+  assert(a[0] & 1);
+  uint64_t x[n_limbs] = {uint64_modinv(a[0])};
+  uint64_t two[n_limbs] = {2};
+  for (uint32_t bits = 64; bits < 64 * n_limbs; bits *= 2)
+  {
+    uint64_t t[n_limbs];
+    limbs_mul(t, nullptr, a, x);
+    limbs_sub(t, two, t);
+    limbs_mul(x, nullptr, x, t);
+  }
+  std::copy(x, x + n_limbs, res);
+}
+
+/**
+ * Compute the inverse of given odd GMP value modulo 2^size via Newton
+ * iteration, doubling the precision in each step.
+ * @param res  The initialized GMP value to store the result in, must not
+ *             alias `a`.
+ * @param a    The odd value.
+ * @param size The bit-width.
+ */
+void
+mpz_modinv_2exp(mpz_t res, const mpz_t a, uint64_t size)
+{
+  assert(mpz_odd_p(a));
+  constexpr uint64_t ui_bits = sizeof(unsigned long) * 8;
+  mpz_t t;
+  mpz_init(t);
+  mpz_set_ui(res, static_cast<unsigned long>(uint64_modinv(mpz_get_ui(a))));
+  for (uint64_t bits = std::min<uint64_t>(ui_bits, 64); bits < size;)
+  {
+    bits = std::min(2 * bits, size);
+    mpz_fdiv_r_2exp(t, a, bits);
+    mpz_mul(t, t, res);
+    mpz_fdiv_r_2exp(t, t, bits);
+    mpz_ui_sub(t, 2, t);
+    mpz_mul(res, res, t);
+    mpz_fdiv_r_2exp(res, res, bits);
+  }
+  mpz_fdiv_r_2exp(res, res, size);
+  mpz_clear(t);
+}
+
+/**
+ * @return The exponent k if given limbs represent 2^k, and -1 otherwise.
+ */
+int64_t
+limbs_log2_exact(const uint64_t* limbs)
+{
+  int64_t res = -1;
+  for (uint32_t i = 0; i < n_limbs; ++i)
+  {
+    if (limbs[i])
+    {
+      if (res >= 0 || (limbs[i] & (limbs[i] - 1)))
+      {
+        return -1;
+      }
+      res = i * 64 + ctz64(limbs[i]);
+    }
+  }
+  return res;
+}
+
+/**
+ * @return The exponent k if given non-negative GMP value is 2^k, and -1
+ *         otherwise.
+ */
+int64_t
+mpz_log2_exact(const mpz_t val)
+{
+  if (mpz_sgn(val) == 0)
+  {
+    return -1;
+  }
+  mp_bitcnt_t k = mpz_scan1(val, 0);
+  return mpz_sizeinbase(val, 2) == k + 1 ? static_cast<int64_t>(k) : -1;
+}
+
+/**
+ * Compute unsigned division with remainder by a divisor that fits into a
+ * single limb, `quot = a / b` and `rem = a % b`.
+ */
+void
+limbs_divrem_1(uint64_t* quot, uint64_t* rem, const uint64_t* a, uint64_t b)
+{
+  assert(b);
+#ifdef __SIZEOF_INT128__
+  uint128_t r = 0;
+  for (uint32_t i = n_limbs; i-- > 0;)
+  {
+    uint128_t t = (r << 64) | a[i];
+    quot[i]     = static_cast<uint64_t>(t / b);
+    r           = t % b;
+  }
+  std::fill(rem, rem + n_limbs, 0);
+  rem[0] = static_cast<uint64_t>(r);
+#else
+  uint64_t bb[n_limbs] = {b};
+  limbs_divrem(quot, rem, a, bb);
+#endif
+}
+
+/**
+ * Compute unsigned division with remainder, `quot = a / b` and
+ * `rem = a % b`, with `b` non-zero. Divisions by powers of two reduce to
+ * shifts and masks, divisors that fit into a single limb are handled by
+ * `limbs_divrem_1`. The results may alias the operands.
+ */
+void
+limbs_udivurem(uint64_t* quot,
+               uint64_t* rem,
+               const uint64_t* a,
+               const uint64_t* b)
+{
+  uint64_t q[n_limbs], r[n_limbs];
+  int64_t k = limbs_log2_exact(b);
+  if (k >= 0)
+  {
+    limbs_shr(q, a, static_cast<uint64_t>(k));
+    std::copy(a, a + n_limbs, r);
+    limbs_normalize(r, static_cast<uint64_t>(k));
+  }
+  else if (limbs_size(b) == 1)
+  {
+    limbs_divrem_1(q, r, a, b[0]);
+  }
+  else
+  {
+    limbs_divrem(q, r, a, b);
+  }
+  std::copy(q, q + n_limbs, quot);
+  std::copy(r, r + n_limbs, rem);
+}
+
 }  // namespace
 
 bool
@@ -82,6 +881,18 @@ BitVector::fits_in_size(uint64_t size, const std::string& str, uint32_t base)
   bool is_neg = str[0] == '-';
   bool res;
 
+  if (base == 2 || base == 16)
+  {
+    bool is_pow2;
+    uint64_t n = pow2_str_num_bits(str, base, is_pow2);
+    if (is_neg)
+    {
+      /* -2^(size-1) is the minimum signed value */
+      return n < size || (n == size && is_pow2);
+    }
+    return n <= size;
+  }
+
   mpz_t tmp;
   /* We do not want to normalize to 'size'. */
   mpz_init_set_str(tmp, str.c_str(), base);
@@ -94,6 +905,14 @@ BitVector::fits_in_size(uint64_t size, const std::string& str, uint32_t base)
     {
       res = mpz_cmp(tmp, min.d_val_gmp) <= 0;
     }
+    else if (min.is_limbs())
+    {
+      mpz_t bound;
+      mpz_init(bound);
+      limbs_to_mpz(bound, min.d_val_limbs);
+      res = mpz_cmp(tmp, bound) <= 0;
+      mpz_clear(bound);
+    }
     else
     {
       res = mpz_cmp_ui(tmp, min.d_val_uint64) <= 0;
@@ -106,6 +925,14 @@ BitVector::fits_in_size(uint64_t size, const std::string& str, uint32_t base)
     {
       res = mpz_cmp(tmp, max.d_val_gmp) <= 0;
     }
+    else if (max.is_limbs())
+    {
+      mpz_t bound;
+      mpz_init(bound);
+      limbs_to_mpz(bound, max.d_val_limbs);
+      res = mpz_cmp(tmp, bound) <= 0;
+      mpz_clear(bound);
+    }
     else
     {
       res = mpz_cmp_ui(tmp, max.d_val_uint64) <= 0;
@@ -158,12 +985,17 @@ BitVector
 BitVector::mk_ones(uint64_t size)
 {
   BitVector res(size);
-  if (size > 64)
+  if (res.is_gmp())
   {
     mpz_set_ui(res.d_val_gmp, 1);
     mpz_mul_2exp(res.d_val_gmp, res.d_val_gmp, size);
     mpz_sub_ui(res.d_val_gmp, res.d_val_gmp, 1);
   }
+  else if (res.is_limbs())
+  {
+    std::fill(res.d_val_limbs, res.d_val_limbs + n_limbs, UINT64_MAX);
+    limbs_normalize(res.d_val_limbs, size);
+  }
   else
   {
     res.d_val_uint64 = uint64_fdiv_r_2exp(size, UINT64_MAX);
@@ -207,6 +1039,10 @@ BitVector::BitVector(uint64_t size) : d_size(size), d_val_uint64(0)
   {
     mpz_init(d_val_gmp);
   }
+  else if (is_limbs())
+  {
+    std::fill(d_val_limbs, d_val_limbs + n_limbs, 0);
+  }
 }
 
 BitVector::BitVector(uint64_t size, RNG& rng) : BitVector(size)
@@ -216,6 +1052,16 @@ BitVector::BitVector(uint64_t size, RNG& rng) : BitVector(size)
     mpz_urandomb(d_val_gmp, *rng.get_gmp_state(), size);
     mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
   }
+  else if (is_limbs())
+  {
+    // Use GMP to draw the value in order to preserve the sequence of random
+    // values of the GMP representation.
+    mpz_t tmp;
+    mpz_init(tmp);
+    mpz_urandomb(tmp, *rng.get_gmp_state(), size);
+    mpz_to_limbs(d_val_limbs, tmp);
+    mpz_clear(tmp);
+  }
   else
   {
     d_val_uint64 = uint64_fdiv_r_2exp(
@@ -285,7 +1131,38 @@ BitVector::BitVector(uint64_t size, const std::string& value, uint32_t base)
   assert(base != 10 || is_valid_dec_str(value));
   assert(base != 16 || is_valid_hex_str(value));
   assert(fits_in_size(size, value, base));
-  if (is_gmp())
+  if (base == 2 || base == 16)
+  {
+    if (is_gmp())
+    {
+      mpz_init(d_val_gmp);
+      if (gmp_limbs_64)
+      {
+        size_t n = (size + 63) / 64;
+        pow2_str_to_limbs(reinterpret_cast<uint64_t*>(
+                              mpz_limbs_write(d_val_gmp, n)),
+                          n,
+                          value,
+                          base,
+                          size);
+        mpz_limbs_finish(d_val_gmp, n);
+      }
+      else
+      {
+        mpz_set_str(d_val_gmp, value.c_str(), base);
+        mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+      }
+    }
+    else if (is_limbs())
+    {
+      pow2_str_to_limbs(d_val_limbs, n_limbs, value, base, size);
+    }
+    else
+    {
+      pow2_str_to_limbs(&d_val_uint64, 1, value, base, size);
+    }
+  }
+  else if (is_gmp())
   {
     mpz_init_set_str(d_val_gmp, value.c_str(), base);
     /* BitVector asserts that given string must fit into bv after conversion.
@@ -294,6 +1171,14 @@ BitVector::BitVector(uint64_t size, const std::string& value, uint32_t base)
      * absolute value of 'value') in GMP when created from mpz_init_set_str. */
     mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
   }
+  else if (is_limbs())
+  {
+    mpz_t tmp;
+    mpz_init_set_str(tmp, value.c_str(), base);
+    mpz_fdiv_r_2exp(tmp, tmp, size);
+    mpz_to_limbs(d_val_limbs, tmp);
+    mpz_clear(tmp);
+  }
   else
   {
     d_val_uint64 = uint64_fdiv_r_2exp(
@@ -310,9 +1195,13 @@ BitVector::from_ui(uint64_t size, uint64_t value, bool truncate)
   BitVector res(size);
   if (res.is_gmp())
   {
-    mpz_init_set_ui(res.d_val_gmp, value);
+    mpz_set_ui(res.d_val_gmp, value);
     mpz_fdiv_r_2exp(res.d_val_gmp, res.d_val_gmp, size);
   }
+  else if (res.is_limbs())
+  {
+    res.d_val_limbs[0] = value;
+  }
   else
   {
     res.d_val_uint64 = uint64_fdiv_r_2exp(size, value);
@@ -329,9 +1218,18 @@ BitVector::from_si(uint64_t size, int64_t value, bool truncate)
   BitVector res(size);
   if (res.is_gmp())
   {
-    mpz_init_set_si(res.d_val_gmp, value);
+    mpz_set_si(res.d_val_gmp, value);
     mpz_fdiv_r_2exp(res.d_val_gmp, res.d_val_gmp, size);
   }
+  else if (res.is_limbs())
+  {
+    // Sign extend.
+    std::fill(res.d_val_limbs,
+              res.d_val_limbs + n_limbs,
+              value < 0 ? UINT64_MAX : 0);
+    res.d_val_limbs[0] = static_cast<uint64_t>(value);
+    limbs_normalize(res.d_val_limbs, size);
+  }
   else
   {
     res.d_val_uint64 = uint64_fdiv_r_2exp(size, static_cast<uint64_t>(value));
@@ -339,6 +1237,31 @@ BitVector::from_si(uint64_t size, int64_t value, bool truncate)
   return res;
 }
 
+BitVector
+BitVector::from_limbs(uint64_t size, const uint64_t* limbs)
+{
+  assert(size > 0);
+
+  BitVector res(size);
+  size_t n = (size + 63) / 64;
+  if (res.is_gmp())
+  {
+    mpz_import(res.d_val_gmp, n, -1, sizeof(uint64_t), 0, 0, limbs);
+    mpz_fdiv_r_2exp(res.d_val_gmp, res.d_val_gmp, size);
+  }
+  else if (res.is_limbs())
+  {
+    std::copy(limbs, limbs + n, res.d_val_limbs);
+    std::fill(res.d_val_limbs + n, res.d_val_limbs + n_limbs, 0);
+    limbs_normalize(res.d_val_limbs, size);
+  }
+  else
+  {
+    res.d_val_uint64 = uint64_fdiv_r_2exp(size, limbs[0]);
+  }
+  return res;
+}
+
 BitVector::BitVector(const BitVector& other)
 {
   if (other.is_null())
@@ -356,6 +1279,10 @@ BitVector::BitVector(const BitVector& other)
     {
       mpz_init_set(d_val_gmp, other.d_val_gmp);
     }
+    else if (is_limbs())
+    {
+      std::copy(other.d_val_limbs, other.d_val_limbs + n_limbs, d_val_limbs);
+    }
     else
     {
       d_val_uint64 = other.d_val_uint64;
@@ -365,31 +1292,22 @@ BitVector::BitVector(const BitVector& other)
 
 BitVector::BitVector(BitVector&& other)
 {
-  if (is_gmp())
+  if (other.is_gmp())
   {
-    if (other.is_gmp())
-    {
-      mpz_set(d_val_gmp, other.d_val_gmp);
-      mpz_clear(other.d_val_gmp);
-    }
-    else
-    {
-      mpz_clear(d_val_gmp);
-      d_val_uint64 = std::exchange(other.d_val_uint64, 0);
-    }
+    // Take ownership of the GMP value, other does not clear it since its size
+    // is reset to zero below.
+    d_val_gmp[0] = other.d_val_gmp[0];
+  }
+  else if (other.is_limbs())
+  {
+    std::copy(other.d_val_limbs, other.d_val_limbs + n_limbs, d_val_limbs);
   }
   else
   {
-    if (other.is_gmp())
-    {
-      mpz_init_set(d_val_gmp, other.d_val_gmp);
-    }
-    else
-    {
-      d_val_uint64 = std::exchange(other.d_val_uint64, 0);
-    }
+    d_val_uint64 = other.d_val_uint64;
   }
-  d_size = std::exchange(other.d_size, 0);
+  other.d_val_uint64 = 0;
+  d_size             = std::exchange(other.d_size, 0);
 }
 
 BitVector::~BitVector()
@@ -421,6 +1339,11 @@ BitVector::operator=(const BitVector& other)
       {
         mpz_init_set(d_val_gmp, other.d_val_gmp);
       }
+      else if (other.is_limbs())
+      {
+        std::copy(
+            other.d_val_limbs, other.d_val_limbs + n_limbs, d_val_limbs);
+      }
       else
       {
         d_val_uint64 = other.d_val_uint64;
@@ -431,7 +1354,15 @@ BitVector::operator=(const BitVector& other)
       if (!other.is_gmp())
       {
         mpz_clear(d_val_gmp);
-        d_val_uint64 = other.d_val_uint64;
+        if (other.is_limbs())
+        {
+          std::copy(
+              other.d_val_limbs, other.d_val_limbs + n_limbs, d_val_limbs);
+        }
+        else
+        {
+          d_val_uint64 = other.d_val_uint64;
+        }
       }
       else
       {
@@ -443,6 +1374,33 @@ BitVector::operator=(const BitVector& other)
   return *this;
 }
 
+BitVector&
+BitVector::operator=(BitVector&& other)
+{
+  if (&other == this) return *this;
+  if (is_gmp())
+  {
+    mpz_clear(d_val_gmp);
+  }
+  if (other.is_gmp())
+  {
+    // Take ownership of the GMP value, other does not clear it since its size
+    // is reset to zero below.
+    d_val_gmp[0] = other.d_val_gmp[0];
+  }
+  else if (other.is_limbs())
+  {
+    std::copy(other.d_val_limbs, other.d_val_limbs + n_limbs, d_val_limbs);
+  }
+  else
+  {
+    d_val_uint64 = other.d_val_uint64;
+  }
+  other.d_val_uint64 = 0;
+  d_size             = std::exchange(other.d_size, 0);
+  return *this;
+}
+
 size_t
 BitVector::hash() const
 {
@@ -486,6 +1444,29 @@ BitVector::hash() const
       res = ((x >> 16) ^ x);
     }
   }
+  else if (is_limbs())
+  {
+    // Same as for GMP values with 64-bit limbs.
+    for (i = 0, j = 0, n = limbs_size(d_val_limbs); i < n; ++i)
+    {
+      p0 = s_hash_primes[j++];
+      if (j == s_n_primes) j = 0;
+      p1 = s_hash_primes[j++];
+      if (j == s_n_primes) j = 0;
+      x  = d_val_limbs[i] ^ res;
+      x  = ((x >> 16) ^ x) * p0;
+      x  = ((x >> 16) ^ x) * p1;
+      x  = ((x >> 16) ^ x);
+      p0 = s_hash_primes[j++];
+      if (j == s_n_primes) j = 0;
+      p1 = s_hash_primes[j++];
+      if (j == s_n_primes) j = 0;
+      x   = x ^ (d_val_limbs[i] >> 32);
+      x   = ((x >> 16) ^ x) * p0;
+      x   = ((x >> 16) ^ x) * p1;
+      res = ((x >> 16) ^ x);
+    }
+  }
   else
   {
     p0 = s_hash_primes[j++];
@@ -511,6 +1492,11 @@ BitVector::iset(uint64_t value)
     mpz_set_ui(d_val_gmp, value);
     mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, d_size);
   }
+  else if (is_limbs())
+  {
+    std::fill(d_val_limbs, d_val_limbs + n_limbs, 0);
+    d_val_limbs[0] = value;
+  }
   else
   {
     d_val_uint64 = uint64_fdiv_r_2exp(d_size, value);
@@ -527,6 +1513,10 @@ BitVector::iset(const BitVector& bv)
   {
     mpz_set(d_val_gmp, bv.d_val_gmp);
   }
+  else if (is_limbs())
+  {
+    std::copy(bv.d_val_limbs, bv.d_val_limbs + n_limbs, d_val_limbs);
+  }
   else
   {
     d_val_uint64 = bv.d_val_uint64;
@@ -567,6 +1557,23 @@ BitVector::iset(RNG& rng,
       mpz_add(d_val_gmp, d_val_gmp, from.d_val_gmp);
     }
   }
+  else if (is_limbs())
+  {
+    // Use GMP to draw the value in order to preserve the sequence of random
+    // values of the GMP representation.
+    BitVector _to = to.bvsub(from);
+    mpz_t range, val;
+    mpz_init(range);
+    mpz_init(val);
+    limbs_to_mpz(range, _to.d_val_limbs);
+    mpz_add_ui(range, range, 1);
+    mpz_urandomm(val, *rng.get_gmp_state(), range);
+    mpz_to_limbs(d_val_limbs, val);
+    limbs_add(d_val_limbs, d_val_limbs, from.d_val_limbs);
+    limbs_normalize(d_val_limbs, d_size);
+    mpz_clear(range);
+    mpz_clear(val);
+  }
   else
   {
     if (is_signed)
@@ -601,6 +1608,29 @@ BitVector::str(uint32_t base) const
 {
   if (is_null()) return "(nil)";
 
+  size_t n;
+  const uint64_t* limbs;
+  if ((base == 2 || base == 16) && (limbs = get_limbs(n)))
+  {
+    uint64_t ndigits = pow2_str_num_digits(
+        d_size, base == 2 ? d_size : d_size - count_leading_zeros(), base);
+    std::string res(ndigits, '0');
+    limbs_to_pow2_str(res.data(), limbs, n, ndigits - 1, ndigits, base);
+    return res;
+  }
+
+  if (is_limbs())
+  {
+    mpz_t val;
+    mpz_init(val);
+    limbs_to_mpz(val, d_val_limbs);
+    char* tmp = mpz_get_str(0, base, val);
+    std::string res(tmp);
+    free(tmp);
+    mpz_clear(val);
+    return res;
+  }
+
   if (is_gmp())
   {
     std::stringstream res;
@@ -620,18 +1650,31 @@ BitVector::str(uint32_t base) const
     return res.str();
   }
 
-  if (base == 10)
+  assert(base == 10);
+  return std::to_string(d_val_uint64);
+}
+
+void
+BitVector::print(std::ostream& out, uint32_t base) const
+{
+  size_t n;
+  const uint64_t* limbs;
+  if (is_null() || (base != 2 && base != 16) || !(limbs = get_limbs(n)))
   {
-    return std::to_string(d_val_uint64);
+    out << str(base);
+    return;
   }
-  if (base == 16)
+
+  uint64_t ndigits = pow2_str_num_digits(
+      d_size, base == 2 ? d_size : d_size - count_leading_zeros(), base);
+  char buf[4096];
+  for (uint64_t hi = ndigits; hi > 0;)
   {
-    std::stringstream res;
-    res << std::hex << d_val_uint64;
-    return res.str();
+    uint64_t count = std::min<uint64_t>(hi, sizeof(buf));
+    limbs_to_pow2_str(buf, limbs, n, hi - 1, count, base);
+    out.write(buf, static_cast<std::streamsize>(count));
+    hi -= count;
   }
-  std::string res = std::bitset<64>(d_val_uint64).to_string();
-  return res.substr(64 - d_size);
 }
 
 uint64_t
@@ -643,9 +1686,33 @@ BitVector::to_uint64(bool truncate) const
   {
     return mpz_get_ui(d_val_gmp);
   }
+  if (is_limbs())
+  {
+    return d_val_limbs[0];
+  }
   return d_val_uint64;
 }
 
+void
+BitVector::to_limbs(uint64_t* limbs) const
+{
+  assert(!is_null());
+  size_t n = (d_size + 63) / 64;
+  if (is_gmp())
+  {
+    std::fill(limbs, limbs + n, 0);
+    mpz_export(limbs, nullptr, -1, sizeof(uint64_t), 0, 0, d_val_gmp);
+  }
+  else if (is_limbs())
+  {
+    std::copy(d_val_limbs, d_val_limbs + n, limbs);
+  }
+  else
+  {
+    limbs[0] = d_val_uint64;
+  }
+}
+
 int32_t
 BitVector::compare(const BitVector& bv) const
 {
@@ -659,8 +1726,22 @@ BitVector::compare(const BitVector& bv) const
 
   if (is_gmp())
   {
+    if (gmp_limbs_64)
+    {
+      size_t n = mpz_size(d_val_gmp), nbv = mpz_size(bv.d_val_gmp);
+      if (n != nbv)
+      {
+        return n < nbv ? -1 : 1;
+      }
+      return LimbKernels::get().cmp(
+          gmp_limbs_read(d_val_gmp), gmp_limbs_read(bv.d_val_gmp), n);
+    }
     return mpz_cmp(d_val_gmp, bv.d_val_gmp);
   }
+  if (is_limbs())
+  {
+    return limbs_cmp(d_val_limbs, bv.d_val_limbs);
+  }
 
   if (d_val_uint64 == bv.d_val_uint64)
   {
@@ -707,6 +1788,10 @@ BitVector::bit(uint64_t idx) const
   {
     return mpz_tstbit(d_val_gmp, idx);
   }
+  if (is_limbs())
+  {
+    return (d_val_limbs[idx / 64] >> (idx % 64)) & 1;
+  }
   return (d_val_uint64 >> idx) & 1;
 }
 
@@ -726,6 +1811,17 @@ BitVector::set_bit(uint64_t idx, bool value)
       mpz_clrbit(d_val_gmp, idx);
     }
   }
+  else if (is_limbs())
+  {
+    if (value)
+    {
+      d_val_limbs[idx / 64] |= ((uint64_t) 1 << (idx % 64));
+    }
+    else
+    {
+      d_val_limbs[idx / 64] &= ~((uint64_t) 1 << (idx % 64));
+    }
+  }
   else
   {
     if (value)
@@ -747,6 +1843,10 @@ BitVector::flip_bit(uint64_t idx)
   {
     mpz_combit(d_val_gmp, idx);
   }
+  else if (is_limbs())
+  {
+    d_val_limbs[idx / 64] ^= ((uint64_t) 1 << (idx % 64));
+  }
   else
   {
     set_bit(idx, bit(idx) ? false : true);
@@ -791,6 +1891,10 @@ BitVector::is_zero() const
   {
     return mpz_cmp_ui(d_val_gmp, 0) == 0;
   }
+  if (is_limbs())
+  {
+    return limbs_is_zero(d_val_limbs);
+  }
   return d_val_uint64 == 0;
 }
 
@@ -806,6 +1910,12 @@ BitVector::is_ones() const
     uint64_t m = d_size / static_cast<uint64_t>(mp_bits_per_limb);
     if (d_size % static_cast<uint64_t>(mp_bits_per_limb)) m += 1;
     if (m != n) return false;  // less limbs used than expected, not ones
+    if (gmp_limbs_64)
+    {
+      const uint64_t* limbs = gmp_limbs_read(d_val_gmp);
+      if (!LimbKernels::get().is_ones(limbs, n - 1)) return false;
+      return limbs[n - 1] == (UINT64_MAX >> ((64 - d_size % 64) % 64));
+    }
     uint64_t max = mp_bits_per_limb == 64 ? UINT64_MAX : UINT32_MAX;
     for (uint64_t i = 0; i < n - 1; ++i)
     {
@@ -821,6 +1931,13 @@ BitVector::is_ones() const
         - d_size % static_cast<uint64_t>(mp_bits_per_limb);
     return (static_cast<uint64_t>(limb)) == (max >> m);
   }
+  if (is_limbs())
+  {
+    uint64_t ones[n_limbs];
+    std::fill(ones, ones + n_limbs, UINT64_MAX);
+    limbs_normalize(ones, d_size);
+    return limbs_cmp(d_val_limbs, ones) == 0;
+  }
   return d_val_uint64 == uint64_fdiv_r_2exp(d_size, UINT64_MAX);
 }
 
@@ -832,6 +1949,11 @@ BitVector::is_one() const
   {
     return mpz_cmp_ui(d_val_gmp, 1) == 0;
   }
+  if (is_limbs())
+  {
+    uint64_t one[n_limbs] = {1};
+    return limbs_cmp(d_val_limbs, one) == 0;
+  }
   return d_val_uint64 == 1;
 }
 
@@ -843,6 +1965,12 @@ BitVector::is_min_signed() const
   {
     if (mpz_scan1(d_val_gmp, 0) != d_size - 1) return false;
   }
+  else if (is_limbs())
+  {
+    uint64_t min[n_limbs] = {0};
+    min[(d_size - 1) / 64] = (uint64_t) 1 << ((d_size - 1) % 64);
+    if (limbs_cmp(d_val_limbs, min) != 0) return false;
+  }
   else
   {
     if (d_val_uint64
@@ -862,6 +1990,13 @@ BitVector::is_max_signed() const
   {
     if (mpz_scan0(d_val_gmp, 0) != d_size - 1) return false;
   }
+  else if (is_limbs())
+  {
+    uint64_t max[n_limbs];
+    std::fill(max, max + n_limbs, UINT64_MAX);
+    limbs_normalize(max, d_size - 1);
+    if (limbs_cmp(d_val_limbs, max) != 0) return false;
+  }
   else
   {
     if (d_size == 1 && d_val_uint64 == 0) return true;
@@ -885,6 +2020,13 @@ BitVector::is_uadd_overflow(const BitVector& bv) const
 {
   assert(!is_null());
   assert(d_size == bv.d_size);
+  if (is_limbs())
+  {
+    uint64_t add[n_limbs];
+    uint64_t carry = limbs_add(add, d_val_limbs, bv.d_val_limbs);
+    if (d_size == s_max_size_limbs) return carry;
+    return (add[d_size / 64] >> (d_size % 64)) & 1;
+  }
   mpz_t add;
   if (is_gmp())
   {
@@ -907,6 +2049,15 @@ BitVector::is_umul_overflow(const BitVector& bv) const
 {
   assert(!is_null());
   assert(d_size == bv.d_size);
+  if (is_limbs())
+  {
+    uint64_t mul[n_limbs], hi[n_limbs], lo[n_limbs];
+    limbs_mul(mul, hi, d_val_limbs, bv.d_val_limbs);
+    if (!limbs_is_zero(hi)) return true;
+    std::copy(mul, mul + n_limbs, lo);
+    limbs_normalize(lo, d_size);
+    return limbs_cmp(lo, mul) != 0;
+  }
   if (d_size > 1)
   {
     mpz_t mul;
@@ -938,6 +2089,18 @@ BitVector::count_trailing_zeros() const
     res = mpz_scan1(d_val_gmp, 0);
     if (res > d_size) res = d_size;
   }
+  else if (is_limbs())
+  {
+    res = d_size;
+    for (uint32_t i = 0; i < n_limbs; ++i)
+    {
+      if (d_val_limbs[i])
+      {
+        res = i * 64 + ctz64(d_val_limbs[i]);
+        break;
+      }
+    }
+  }
   else
   {
     for (uint64_t i = 0; i < d_size; ++i)
@@ -968,25 +2131,25 @@ BitVector::count_leading_ones() const
 /* -------------------------------------------------------------------------- */
 
 BitVector
-BitVector::bvneg() const
+BitVector::bvneg() const&
 {
   return BitVector(d_size).ibvneg(*this);
 }
 
 BitVector
-BitVector::bvnot() const
+BitVector::bvnot() const&
 {
   return BitVector(d_size).ibvnot(*this);
 }
 
 BitVector
-BitVector::bvinc() const
+BitVector::bvinc() const&
 {
   return BitVector(d_size).ibvinc(*this);
 }
 
 BitVector
-BitVector::bvdec() const
+BitVector::bvdec() const&
 {
   return BitVector(d_size).ibvdec(*this);
 }
@@ -1004,55 +2167,55 @@ BitVector::bvredor() const
 }
 
 BitVector
-BitVector::bvadd(const BitVector& bv) const
+BitVector::bvadd(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvadd(*this, bv);
 }
 
 BitVector
-BitVector::bvsub(const BitVector& bv) const
+BitVector::bvsub(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvsub(*this, bv);
 }
 
 BitVector
-BitVector::bvand(const BitVector& bv) const
+BitVector::bvand(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvand(*this, bv);
 }
 
 BitVector
-BitVector::bvimplies(const BitVector& bv) const
+BitVector::bvimplies(const BitVector& bv) const&
 {
   return BitVector(1).ibvimplies(*this, bv);
 }
 
 BitVector
-BitVector::bvnand(const BitVector& bv) const
+BitVector::bvnand(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvnand(*this, bv);
 }
 
 BitVector
-BitVector::bvnor(const BitVector& bv) const
+BitVector::bvnor(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvnor(*this, bv);
 }
 
 BitVector
-BitVector::bvor(const BitVector& bv) const
+BitVector::bvor(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvor(*this, bv);
 }
 
 BitVector
-BitVector::bvxnor(const BitVector& bv) const
+BitVector::bvxnor(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvxnor(*this, bv);
 }
 
 BitVector
-BitVector::bvxor(const BitVector& bv) const
+BitVector::bvxor(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvxor(*this, bv);
 }
@@ -1118,101 +2281,337 @@ BitVector::bvsge(const BitVector& bv) const
 }
 
 BitVector
-BitVector::bvshl(uint64_t shift) const
+BitVector::bvshl(uint64_t shift) const&
 {
   return BitVector(d_size).ibvshl(*this, shift);
 }
 
 BitVector
-BitVector::bvshl(const BitVector& bv) const
+BitVector::bvshl(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvshl(*this, bv);
 }
 
 BitVector
-BitVector::bvshr(uint64_t shift) const
+BitVector::bvshr(uint64_t shift) const&
 {
   return BitVector(d_size).ibvshr(*this, shift);
 }
 
 BitVector
-BitVector::bvshr(const BitVector& bv) const
+BitVector::bvshr(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvshr(*this, bv);
 }
 
 BitVector
-BitVector::bvashr(uint64_t shift) const
+BitVector::bvashr(uint64_t shift) const&
 {
   return BitVector(d_size).ibvashr(*this, shift);
 }
 
 BitVector
-BitVector::bvashr(const BitVector& bv) const
+BitVector::bvashr(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvashr(*this, bv);
 }
 
 BitVector
-BitVector::bvmul(const BitVector& bv) const
+BitVector::bvmul(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvmul(*this, bv);
 }
 
 BitVector
-BitVector::bvudiv(const BitVector& bv) const
+BitVector::bvudiv(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvudiv(*this, bv);
 }
 
 BitVector
-BitVector::bvurem(const BitVector& bv) const
+BitVector::bvurem(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvurem(*this, bv);
 }
 
 BitVector
-BitVector::bvsdiv(const BitVector& bv) const
+BitVector::bvsdiv(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvsdiv(*this, bv);
 }
 
 BitVector
-BitVector::bvsrem(const BitVector& bv) const
+BitVector::bvsrem(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvsrem(*this, bv);
 }
 
 BitVector
-BitVector::bvconcat(const BitVector& bv) const
+BitVector::bvconcat(const BitVector& bv) const&
 {
   return BitVector(d_size).ibvconcat(*this, bv);
 }
 
 BitVector
-BitVector::bvextract(uint64_t idx_hi, uint64_t idx_lo) const
+BitVector::bvextract(uint64_t idx_hi, uint64_t idx_lo) const&
 {
   return BitVector(d_size).ibvextract(*this, idx_hi, idx_lo);
 }
 
 BitVector
-BitVector::bvzext(uint64_t n) const
+BitVector::bvzext(uint64_t n) const&
 {
   return BitVector(d_size).ibvzext(*this, n);
 }
 
 BitVector
-BitVector::bvsext(uint64_t n) const
+BitVector::bvsext(uint64_t n) const&
 {
   return BitVector(d_size).ibvsext(*this, n);
 }
 
 BitVector
-BitVector::bvmodinv() const
+BitVector::bvmodinv() const&
 {
   return BitVector(d_size).ibvmodinv(*this);
 }
 
+/* -------------------------------------------------------------------------- */
+/* Bit-vector operations on rvalues, reuse the storage of this bit-vector.    */
+/* -------------------------------------------------------------------------- */
+
+BitVector
+BitVector::bvneg() &&
+{
+  assert(!is_null());
+  ibvneg();
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvnot() &&
+{
+  assert(!is_null());
+  ibvnot();
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvinc() &&
+{
+  assert(!is_null());
+  ibvinc();
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvdec() &&
+{
+  assert(!is_null());
+  ibvdec();
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvadd(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvadd(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvsub(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvsub(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvand(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvand(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvimplies(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvimplies(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvnand(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvnand(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvnor(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvnor(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvor(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvor(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvxnor(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvxnor(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvxor(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvxor(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvshl(uint64_t shift) &&
+{
+  assert(!is_null());
+  ibvshl(shift);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvshl(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvshl(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvshr(uint64_t shift) &&
+{
+  assert(!is_null());
+  ibvshr(shift);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvshr(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvshr(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvashr(uint64_t shift) &&
+{
+  assert(!is_null());
+  ibvashr(shift);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvashr(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvashr(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvmul(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvmul(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvudiv(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvudiv(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvurem(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvurem(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvsdiv(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvsdiv(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvsrem(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvsrem(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvconcat(const BitVector& bv) &&
+{
+  assert(!is_null());
+  ibvconcat(bv);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvextract(uint64_t idx_hi, uint64_t idx_lo) &&
+{
+  assert(!is_null());
+  ibvextract(idx_hi, idx_lo);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvzext(uint64_t n) &&
+{
+  assert(!is_null());
+  ibvzext(n);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvsext(uint64_t n) &&
+{
+  assert(!is_null());
+  ibvsext(n);
+  return std::move(*this);
+}
+
+BitVector
+BitVector::bvmodinv() &&
+{
+  assert(!is_null());
+  ibvmodinv();
+  return std::move(*this);
+}
+
 /* -------------------------------------------------------------------------- */
 /* Bit-vector operations, in-place, requires all operands as arguments.       */
 /* -------------------------------------------------------------------------- */
@@ -1229,6 +2628,11 @@ BitVector::ibvneg(const BitVector& bv)
     mpz_add_ui(d_val_gmp, d_val_gmp, 1);
     mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, d_size);
   }
+  else if (is_limbs())
+  {
+    limbs_add_ui(d_val_limbs, d_val_limbs, 1);
+    limbs_normalize(d_val_limbs, d_size);
+  }
   else
   {
     d_val_uint64 += 1;
@@ -1250,8 +2654,27 @@ BitVector::ibvnot(const BitVector& bv)
     {
       mpz_init(d_val_gmp);
     }
-    mpz_com(d_val_gmp, bv.d_val_gmp);
-    mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+    if (gmp_limbs_64)
+    {
+      gmp_not(d_val_gmp, bv.d_val_gmp, size);
+    }
+    else
+    {
+      mpz_com(d_val_gmp, bv.d_val_gmp);
+      mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+    }
+  }
+  else if (bv.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    for (uint32_t i = 0; i < n_limbs; ++i)
+    {
+      d_val_limbs[i] = ~bv.d_val_limbs[i];
+    }
+    limbs_normalize(d_val_limbs, size);
   }
   else
   {
@@ -1281,6 +2704,15 @@ BitVector::ibvinc(const BitVector& bv)
     mpz_add_ui(d_val_gmp, bv.d_val_gmp, 1);
     mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_add_ui(d_val_limbs, bv.d_val_limbs, 1);
+    limbs_normalize(d_val_limbs, size);
+  }
   else
   {
     if (is_gmp())
@@ -1309,6 +2741,15 @@ BitVector::ibvdec(const BitVector& bv)
     mpz_sub_ui(d_val_gmp, bv.d_val_gmp, 1);
     mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_sub_ui(d_val_limbs, bv.d_val_limbs, 1);
+    limbs_normalize(d_val_limbs, size);
+  }
   else
   {
     if (is_gmp())
@@ -1354,6 +2795,13 @@ BitVector::ibvredor(const BitVector& bv)
       }
     }
   }
+  else if (bv.is_limbs())
+  {
+    if (!limbs_is_zero(bv.d_val_limbs))
+    {
+      val = 1;
+    }
+  }
   else if (bv.d_val_uint64 != 0)
   {
     val = 1;
@@ -1382,6 +2830,15 @@ BitVector::ibvadd(const BitVector& bv0, const BitVector& bv1)
     mpz_add(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
     mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_add(d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+    limbs_normalize(d_val_limbs, size);
+  }
   else
   {
     if (is_gmp())
@@ -1413,6 +2870,15 @@ BitVector::ibvsub(const BitVector& bv0, const BitVector& bv1)
     mpz_sub(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
     mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_sub(d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+    limbs_normalize(d_val_limbs, size);
+  }
   else
   {
     if (is_gmp())
@@ -1441,8 +2907,31 @@ BitVector::ibvand(const BitVector& bv0, const BitVector& bv1)
     {
       mpz_init(d_val_gmp);
     }
-    mpz_and(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
-    mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+    if (gmp_limbs_64)
+    {
+      gmp_bitwise(d_val_gmp,
+                  bv0.d_val_gmp,
+                  bv1.d_val_gmp,
+                  LimbKernels::get().bvand,
+                  true);
+    }
+    else
+    {
+      mpz_and(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
+      mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+    }
+  }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    for (uint32_t i = 0; i < n_limbs; ++i)
+    {
+      d_val_limbs[i] = bv0.d_val_limbs[i] & bv1.d_val_limbs[i];
+    }
+    limbs_normalize(d_val_limbs, size);
   }
   else
   {
@@ -1490,9 +2979,33 @@ BitVector::ibvnand(const BitVector& bv0, const BitVector& bv1)
     {
       mpz_init(d_val_gmp);
     }
-    mpz_and(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
-    mpz_com(d_val_gmp, d_val_gmp);
-    mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+    if (gmp_limbs_64)
+    {
+      gmp_bitwise(d_val_gmp,
+                  bv0.d_val_gmp,
+                  bv1.d_val_gmp,
+                  LimbKernels::get().bvand,
+                  true);
+      gmp_not(d_val_gmp, d_val_gmp, size);
+    }
+    else
+    {
+      mpz_and(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
+      mpz_com(d_val_gmp, d_val_gmp);
+      mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+    }
+  }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    for (uint32_t i = 0; i < n_limbs; ++i)
+    {
+      d_val_limbs[i] = ~(bv0.d_val_limbs[i] & bv1.d_val_limbs[i]);
+    }
+    limbs_normalize(d_val_limbs, size);
   }
   else
   {
@@ -1522,9 +3035,33 @@ BitVector::ibvnor(const BitVector& bv0, const BitVector& bv1)
     {
       mpz_init(d_val_gmp);
     }
-    mpz_ior(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
-    mpz_com(d_val_gmp, d_val_gmp);
-    mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+    if (gmp_limbs_64)
+    {
+      gmp_bitwise(d_val_gmp,
+                  bv0.d_val_gmp,
+                  bv1.d_val_gmp,
+                  LimbKernels::get().bvor,
+                  false);
+      gmp_not(d_val_gmp, d_val_gmp, size);
+    }
+    else
+    {
+      mpz_ior(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
+      mpz_com(d_val_gmp, d_val_gmp);
+      mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+    }
+  }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    for (uint32_t i = 0; i < n_limbs; ++i)
+    {
+      d_val_limbs[i] = ~(bv0.d_val_limbs[i] | bv1.d_val_limbs[i]);
+    }
+    limbs_normalize(d_val_limbs, size);
   }
   else
   {
@@ -1554,8 +3091,31 @@ BitVector::ibvor(const BitVector& bv0, const BitVector& bv1)
     {
       mpz_init(d_val_gmp);
     }
-    mpz_ior(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
-    mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+    if (gmp_limbs_64)
+    {
+      gmp_bitwise(d_val_gmp,
+                  bv0.d_val_gmp,
+                  bv1.d_val_gmp,
+                  LimbKernels::get().bvor,
+                  false);
+    }
+    else
+    {
+      mpz_ior(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
+      mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+    }
+  }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    for (uint32_t i = 0; i < n_limbs; ++i)
+    {
+      d_val_limbs[i] = bv0.d_val_limbs[i] | bv1.d_val_limbs[i];
+    }
+    limbs_normalize(d_val_limbs, size);
   }
   else
   {
@@ -1585,9 +3145,33 @@ BitVector::ibvxnor(const BitVector& bv0, const BitVector& bv1)
     {
       mpz_init(d_val_gmp);
     }
-    mpz_xor(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
-    mpz_com(d_val_gmp, d_val_gmp);
-    mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+    if (gmp_limbs_64)
+    {
+      gmp_bitwise(d_val_gmp,
+                  bv0.d_val_gmp,
+                  bv1.d_val_gmp,
+                  LimbKernels::get().bvxor,
+                  false);
+      gmp_not(d_val_gmp, d_val_gmp, size);
+    }
+    else
+    {
+      mpz_xor(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
+      mpz_com(d_val_gmp, d_val_gmp);
+      mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+    }
+  }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    for (uint32_t i = 0; i < n_limbs; ++i)
+    {
+      d_val_limbs[i] = ~(bv0.d_val_limbs[i] ^ bv1.d_val_limbs[i]);
+    }
+    limbs_normalize(d_val_limbs, size);
   }
   else
   {
@@ -1617,8 +3201,31 @@ BitVector::ibvxor(const BitVector& bv0, const BitVector& bv1)
     {
       mpz_init(d_val_gmp);
     }
-    mpz_xor(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
-    mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+    if (gmp_limbs_64)
+    {
+      gmp_bitwise(d_val_gmp,
+                  bv0.d_val_gmp,
+                  bv1.d_val_gmp,
+                  LimbKernels::get().bvxor,
+                  false);
+    }
+    else
+    {
+      mpz_xor(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
+      mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+    }
+  }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    for (uint32_t i = 0; i < n_limbs; ++i)
+    {
+      d_val_limbs[i] = bv0.d_val_limbs[i] ^ bv1.d_val_limbs[i];
+    }
+    limbs_normalize(d_val_limbs, size);
   }
   else
   {
@@ -1647,6 +3254,13 @@ BitVector::ibveq(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) == 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 == bv1.d_val_uint64)
   {
     val = 1;
@@ -1671,6 +3285,13 @@ BitVector::ibvne(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) != 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 != bv1.d_val_uint64)
   {
     val = 1;
@@ -1695,6 +3316,13 @@ BitVector::ibvult(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) < 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 < bv1.d_val_uint64)
   {
     val = 1;
@@ -1719,6 +3347,13 @@ BitVector::ibvule(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) <= 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 <= bv1.d_val_uint64)
   {
     val = 1;
@@ -1743,6 +3378,13 @@ BitVector::ibvugt(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) > 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 > bv1.d_val_uint64)
   {
     val = 1;
@@ -1767,6 +3409,13 @@ BitVector::ibvuge(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) >= 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 >= bv1.d_val_uint64)
   {
     val = 1;
@@ -1908,6 +3557,22 @@ BitVector::ibvshl(const BitVector& bv, uint64_t shift)
       mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
     }
   }
+  else if (bv.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    if (shift >= size)
+    {
+      std::fill(d_val_limbs, d_val_limbs + n_limbs, 0);
+    }
+    else
+    {
+      limbs_shl(d_val_limbs, bv.d_val_limbs, shift);
+      limbs_normalize(d_val_limbs, size);
+    }
+  }
   else
   {
     if (is_gmp())
@@ -1951,6 +3616,14 @@ BitVector::ibvshl(const BitVector& bv, const BitVector& shift)
       }
       mpz_set_ui(d_val_gmp, 0);
     }
+    else if (bv.is_limbs())
+    {
+      if (is_gmp())
+      {
+        mpz_clear(d_val_gmp);
+      }
+      std::fill(d_val_limbs, d_val_limbs + n_limbs, 0);
+    }
     else
     {
       if (is_gmp())
@@ -1986,6 +3659,21 @@ BitVector::ibvshr(const BitVector& bv, uint64_t shift)
       mpz_fdiv_q_2exp(d_val_gmp, bv.d_val_gmp, shift);
     }
   }
+  else if (bv.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    if (shift >= size)
+    {
+      std::fill(d_val_limbs, d_val_limbs + n_limbs, 0);
+    }
+    else
+    {
+      limbs_shr(d_val_limbs, bv.d_val_limbs, shift);
+    }
+  }
   else
   {
     if (is_gmp())
@@ -2029,6 +3717,14 @@ BitVector::ibvshr(const BitVector& bv, const BitVector& shift)
       }
       mpz_set_ui(d_val_gmp, 0);
     }
+    else if (bv.is_limbs())
+    {
+      if (is_gmp())
+      {
+        mpz_clear(d_val_gmp);
+      }
+      std::fill(d_val_limbs, d_val_limbs + n_limbs, 0);
+    }
     else
     {
       if (is_gmp())
@@ -2103,6 +3799,15 @@ BitVector::ibvmul(const BitVector& bv0, const BitVector& bv1)
     mpz_mul(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
     mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_mul(d_val_limbs, nullptr, bv0.d_val_limbs, bv1.d_val_limbs);
+    limbs_normalize(d_val_limbs, size);
+  }
   else
   {
     if (is_gmp())
@@ -2139,8 +3844,33 @@ BitVector::ibvudiv(const BitVector& bv0, const BitVector& bv1)
     }
     else
     {
-      mpz_fdiv_q(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
-      mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+      int64_t k = mpz_log2_exact(bv1.d_val_gmp);
+      if (k >= 0)
+      {
+        mpz_fdiv_q_2exp(d_val_gmp, bv0.d_val_gmp, static_cast<uint64_t>(k));
+      }
+      else
+      {
+        mpz_fdiv_q(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
+        mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+      }
+    }
+  }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    if (bv1.is_zero())
+    {
+      std::fill(d_val_limbs, d_val_limbs + n_limbs, UINT64_MAX);
+      limbs_normalize(d_val_limbs, size);
+    }
+    else
+    {
+      uint64_t rem[n_limbs];
+      limbs_udivurem(d_val_limbs, rem, bv0.d_val_limbs, bv1.d_val_limbs);
     }
   }
   else
@@ -2179,14 +3909,38 @@ BitVector::ibvurem(const BitVector& bv0, const BitVector& bv1)
     }
     if (!bv1.is_zero())
     {
-      mpz_fdiv_r(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
-      mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+      int64_t k = mpz_log2_exact(bv1.d_val_gmp);
+      if (k >= 0)
+      {
+        mpz_fdiv_r_2exp(d_val_gmp, bv0.d_val_gmp, static_cast<uint64_t>(k));
+      }
+      else
+      {
+        mpz_fdiv_r(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
+        mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
+      }
     }
     else
     {
       mpz_set(d_val_gmp, bv0.d_val_gmp);
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    if (!bv1.is_zero())
+    {
+      uint64_t quot[n_limbs];
+      limbs_udivurem(quot, d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+    }
+    else
+    {
+      std::copy(bv0.d_val_limbs, bv0.d_val_limbs + n_limbs, d_val_limbs);
+    }
+  }
   else
   {
     if (is_gmp())
@@ -2330,24 +4084,25 @@ BitVector::ibvconcat(const BitVector& bv0, const BitVector& bv1)
     b1 = &bv1;
   }
 
-  if (size > 64)
+  if (size > s_max_size_limbs)
   {
     if (!is_gmp())
     {
       mpz_init(d_val_gmp);
     }
-    if (b0->is_gmp())
-    {
-      mpz_set(d_val_gmp, b0->d_val_gmp);
-    }
-    else
-    {
-      mpz_set_ui(d_val_gmp, b0->d_val_uint64);
-    }
+    b0->get_mpz(d_val_gmp);
     mpz_mul_2exp(d_val_gmp, d_val_gmp, b1->d_size);
     if (b1->is_gmp())
     {
-      mpz_add(d_val_gmp, d_val_gmp, b1->d_val_gmp);
+      mpz_add(d_val_gmp, d_val_gmp, b1->d_val_gmp);
+    }
+    else if (b1->is_limbs())
+    {
+      mpz_t tmp;
+      mpz_init(tmp);
+      b1->get_mpz(tmp);
+      mpz_add(d_val_gmp, d_val_gmp, tmp);
+      mpz_clear(tmp);
     }
     else
     {
@@ -2355,6 +4110,18 @@ BitVector::ibvconcat(const BitVector& bv0, const BitVector& bv1)
     }
     mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
   }
+  else if (size > 64)
+  {
+    uint64_t l0[n_limbs], l1[n_limbs];
+    b0->copy_limbs(l0);
+    b1->copy_limbs(l1);
+    limbs_shl(l0, l0, b1->d_size);
+    for (uint32_t i = 0; i < n_limbs; ++i)
+    {
+      l0[i] |= l1[i];
+    }
+    set_limbs(size, l0);
+  }
   else
   {
     if (is_gmp())
@@ -2376,58 +4143,44 @@ BitVector::ibvextract(const BitVector& bv, uint64_t idx_hi, uint64_t idx_lo)
   assert(idx_hi < bv.size());
   uint64_t size = idx_hi - idx_lo + 1;
 
-  if (is_gmp())
+  if (bv.is_gmp())
   {
-    if (bv.is_gmp())
+    if (size > s_max_size_limbs)
     {
-      mpz_set(d_val_gmp, bv.d_val_gmp);
+      if (!is_gmp())
+      {
+        mpz_init(d_val_gmp);
+      }
+      mpz_fdiv_r_2exp(d_val_gmp, bv.d_val_gmp, idx_hi + 1);
+      mpz_fdiv_q_2exp(d_val_gmp, d_val_gmp, idx_lo);
     }
     else
     {
-      mpz_set_ui(d_val_gmp, bv.d_val_uint64);
-    }
-    mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, idx_hi + 1);
-    mpz_fdiv_q_2exp(d_val_gmp, d_val_gmp, idx_lo);
-    if (size <= 64)
-    {
-      uint64_t val = mpz_get_ui(d_val_gmp);
-      mpz_clear(d_val_gmp);
-      d_val_uint64 = val;
+      uint64_t limbs[n_limbs];
+      mpz_t tmp;
+      mpz_init(tmp);
+      mpz_fdiv_r_2exp(tmp, bv.d_val_gmp, idx_hi + 1);
+      mpz_fdiv_q_2exp(tmp, tmp, idx_lo);
+      mpz_to_limbs(limbs, tmp);
+      mpz_clear(tmp);
+      set_limbs(size, limbs);
     }
   }
+  else if (bv.is_limbs())
+  {
+    uint64_t limbs[n_limbs];
+    bv.copy_limbs(limbs);
+    limbs_shr(limbs, limbs, idx_lo);
+    set_limbs(size, limbs);
+  }
   else
   {
-    if (size > 64)
-    {
-      mpz_init(d_val_gmp);
-      if (bv.is_gmp())
-      {
-        mpz_set(d_val_gmp, bv.d_val_gmp);
-      }
-      else
-      {
-        mpz_set_ui(d_val_gmp, bv.d_val_uint64);
-      }
-      mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, idx_hi + 1);
-      mpz_fdiv_q_2exp(d_val_gmp, d_val_gmp, idx_lo);
-    }
-    else
+    if (is_gmp())
     {
-      if (bv.is_gmp())
-      {
-        mpz_t tmp;
-        mpz_init_set(tmp, bv.d_val_gmp);
-        mpz_fdiv_r_2exp(tmp, tmp, idx_hi + 1);
-        mpz_fdiv_q_2exp(tmp, tmp, idx_lo);
-        d_val_uint64 = mpz_get_ui(tmp);
-        mpz_clear(tmp);
-      }
-      else
-      {
-        d_val_uint64 = uint64_fdiv_r_2exp(idx_hi + 1, bv.d_val_uint64);
-        d_val_uint64 >>= idx_lo;
-      }
+      mpz_clear(d_val_gmp);
     }
+    d_val_uint64 = uint64_fdiv_r_2exp(idx_hi + 1, bv.d_val_uint64);
+    d_val_uint64 >>= idx_lo;
   }
   d_size = size;
   return *this;
@@ -2442,53 +4195,41 @@ BitVector::ibvzext(const BitVector& bv, uint64_t n)
 
   uint64_t size = bv.d_size + n;
 
-  if (is_gmp())
+  if (size > s_max_size_limbs)
   {
     if (bv.is_gmp())
     {
+      if (!is_gmp())
+      {
+        mpz_init(d_val_gmp);
+      }
       mpz_set(d_val_gmp, bv.d_val_gmp);
     }
     else
-    {
-      mpz_set_ui(d_val_gmp, bv.d_val_uint64);
-    }
-    if (size <= 64)
-    {
-      uint64_t val = mpz_get_ui(d_val_gmp);
-      mpz_clear(d_val_gmp);
-      d_val_uint64 = val;
-    }
-  }
-  else
-  {
-    if (size > 64)
     {
       /* copy to guard for bv == *this */
-      const BitVector* b;
-      BitVector bb;
-      if (&bv == this)
-      {
-        bb = bv;
-        b  = &bb;
-      }
-      else
-      {
-        b = &bv;
-      }
-      mpz_init(d_val_gmp);
-      if (b->is_gmp())
-      {
-        mpz_set(d_val_gmp, b->d_val_gmp);
-      }
-      else
+      uint64_t limbs[n_limbs];
+      bv.copy_limbs(limbs);
+      if (!is_gmp())
       {
-        mpz_set_ui(d_val_gmp, b->d_val_uint64);
+        mpz_init(d_val_gmp);
       }
+      limbs_to_mpz(d_val_gmp, limbs);
     }
-    else
+  }
+  else if (size > 64)
+  {
+    uint64_t limbs[n_limbs];
+    bv.copy_limbs(limbs);
+    set_limbs(size, limbs);
+  }
+  else
+  {
+    if (is_gmp())
     {
-      d_val_uint64 = bv.d_val_uint64;
+      mpz_clear(d_val_gmp);
     }
+    d_val_uint64 = bv.d_val_uint64;
   }
   d_size = size;
   return *this;
@@ -2517,8 +4258,12 @@ BitVector::ibvsext(const BitVector& bv, uint64_t n)
     {
       uint64_t b_size = b->d_size;
       uint64_t size   = b_size + n;
-      if (is_gmp())
+      if (size > s_max_size_limbs)
       {
+        if (!is_gmp())
+        {
+          mpz_init(d_val_gmp);
+        }
         mpz_set_ui(d_val_gmp, 1);
         mpz_mul_2exp(d_val_gmp, d_val_gmp, n);
         mpz_sub_ui(d_val_gmp, d_val_gmp, 1);
@@ -2527,42 +4272,46 @@ BitVector::ibvsext(const BitVector& bv, uint64_t n)
         {
           mpz_add(d_val_gmp, d_val_gmp, b->d_val_gmp);
         }
+        else if (b->is_limbs())
+        {
+          mpz_t tmp;
+          mpz_init(tmp);
+          b->get_mpz(tmp);
+          mpz_add(d_val_gmp, d_val_gmp, tmp);
+          mpz_clear(tmp);
+        }
         else
         {
           mpz_add_ui(d_val_gmp, d_val_gmp, b->d_val_uint64);
         }
         mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
-        if (size <= 64)
-        {
-          uint64_t val = mpz_get_ui(d_val_gmp);
-          mpz_clear(d_val_gmp);
-          d_val_uint64 = val;
-        }
       }
-      else
+      else if (size > 64)
       {
-        if (size > 64)
+        uint64_t limbs[n_limbs];
+        b->copy_limbs(limbs);
+        for (uint32_t i = 0; i < n_limbs; ++i)
         {
-          mpz_init_set_ui(d_val_gmp, 1);
-          mpz_mul_2exp(d_val_gmp, d_val_gmp, n);
-          mpz_sub_ui(d_val_gmp, d_val_gmp, 1);
-          mpz_mul_2exp(d_val_gmp, d_val_gmp, b_size);
-          if (b->is_gmp())
+          uint64_t lo = i * 64;
+          if (lo >= b_size)
           {
-            mpz_add(d_val_gmp, d_val_gmp, b->d_val_gmp);
+            limbs[i] = UINT64_MAX;
           }
-          else
+          else if (b_size - lo < 64)
           {
-            mpz_add_ui(d_val_gmp, d_val_gmp, b->d_val_uint64);
+            limbs[i] |= UINT64_MAX << (b_size - lo);
           }
-          mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
         }
-        else
+        set_limbs(size, limbs);
+      }
+      else
+      {
+        if (is_gmp())
         {
-          d_val_uint64 = UINT64_MAX << b_size;
-          d_val_uint64 =
-              uint64_fdiv_r_2exp(size, d_val_uint64 + b->d_val_uint64);
+          mpz_clear(d_val_gmp);
         }
+        d_val_uint64 = UINT64_MAX << b_size;
+        d_val_uint64 = uint64_fdiv_r_2exp(size, d_val_uint64 + b->d_val_uint64);
       }
       d_size = size;
     }
@@ -2573,31 +4322,7 @@ BitVector::ibvsext(const BitVector& bv, uint64_t n)
   }
   else if (&bv != this)
   {
-    if (is_gmp())
-    {
-      if (bv.is_gmp())
-      {
-        mpz_set(d_val_gmp, bv.d_val_gmp);
-      }
-      else
-      {
-        mpz_clear(d_val_gmp);
-        d_val_uint64 = bv.d_val_uint64;
-      }
-    }
-    else
-    {
-      if (bv.is_gmp())
-      {
-        mpz_init(d_val_gmp);
-        mpz_set(d_val_gmp, bv.d_val_gmp);
-      }
-      else
-      {
-        d_val_uint64 = bv.d_val_uint64;
-      }
-    }
-    d_size = bv.d_size;
+    *this = bv;
   }
   return *this;
 }
@@ -2611,47 +4336,7 @@ BitVector::ibvite(const BitVector& c, const BitVector& t, const BitVector& e)
   assert(c.d_size == 1);
   assert(e.d_size == t.d_size);
 
-  uint64_t size = t.d_size;
-
-  if (c.is_true())
-  {
-    if (t.is_gmp())
-    {
-      if (!is_gmp())
-      {
-        mpz_init(d_val_gmp);
-      }
-      mpz_set(d_val_gmp, t.d_val_gmp);
-    }
-    else
-    {
-      if (is_gmp())
-      {
-        mpz_clear(d_val_gmp);
-      }
-      d_val_uint64 = t.d_val_uint64;
-    }
-  }
-  else
-  {
-    if (e.is_gmp())
-    {
-      if (!is_gmp())
-      {
-        mpz_init(d_val_gmp);
-      }
-      mpz_set(d_val_gmp, e.d_val_gmp);
-    }
-    else
-    {
-      if (is_gmp())
-      {
-        mpz_clear(d_val_gmp);
-      }
-      d_val_uint64 = e.d_val_uint64;
-    }
-  }
-  d_size = size;
+  *this = c.is_true() ? t : e;
   return *this;
 }
 
@@ -2676,109 +4361,39 @@ BitVector::ibvmodinv(const BitVector& bv)
 
   uint64_t size = pb->d_size;
 
-  if (d_size == 1)
+  if (size == 1)
   {
-    if (pb->is_gmp())
-    {
-      if (!is_gmp())
-      {
-        mpz_init_set_ui(d_val_gmp, 1);
-      }
-      else
-      {
-        mpz_set_ui(d_val_gmp, 1);
-      }
-    }
-    else
+    if (is_gmp())
     {
-      if (is_gmp())
-      {
-        mpz_clear(d_val_gmp);
-      }
-      d_val_uint64 = 1;
+      mpz_clear(d_val_gmp);
     }
+    d_val_uint64 = 1;
   }
-  else
+  else if (pb->is_gmp())
   {
-    if (pb->is_gmp())
-    {
-      if (!is_gmp())
-      {
-        mpz_init(d_val_gmp);
-      }
-      mpz_t two;
-      mpz_init(two);
-      mpz_setbit(two, size);
-      mpz_invert(d_val_gmp, pb->d_val_gmp, two);
-      mpz_fdiv_r_2exp(d_val_gmp, d_val_gmp, size);
-      mpz_clear(two);
-    }
-    else
+    if (!is_gmp())
     {
-      if (is_gmp())
-      {
-        mpz_clear(d_val_gmp);
-      }
-      /* a = 2^bw
-       * b = bv
-       * lx * a + ly * b = gcd (a, b) = 1
-       * -> lx * a = lx * 2^bw = 0 (2^bw_[bw] = 0)
-       * -> ly * b = bv^-1 * bv = 1
-       * -> ly is modular inverse of bv */
-      uint64_t esize = size + 1;
-      BitVector a(esize), b(esize);
-
-      a.set_bit(size, 1); /* 2^d_size */
-      /* b is this bit-vector extended to esize */
-      if (esize > 64)
-      {
-        mpz_set_ui(b.d_val_gmp, pb->d_val_uint64);
-      }
-      else
-      {
-        b.d_val_uint64 = pb->d_val_uint64;
-      }
-
-      BitVector y = mk_one(esize), ty, yq;
-      BitVector ly(esize);
-      BitVector q, r;
-      while (!b.is_zero())
-      {
-        a.bvudivurem(b, &q, &r);
-        a  = b;
-        b  = r;
-        ty = y;
-        yq = y.bvmul(q);
-        y  = ly.bvsub(yq);
-        ly = ty;
-      }
-      d_val_uint64 = ly.bvextract(size - 1, 0).d_val_uint64;
+      mpz_init(d_val_gmp);
     }
+    mpz_modinv_2exp(d_val_gmp, pb->d_val_gmp, size);
   }
-  d_size = size;
-#ifndef NDEBUG
-  mpz_t ty;
-  mpz_init(ty);
-  if (is_gmp())
+  else if (pb->is_limbs())
   {
-    mpz_mul(ty, pb->d_val_gmp, d_val_gmp);
+    uint64_t limbs[n_limbs];
+    limbs_modinv(limbs, pb->d_val_limbs);
+    limbs_normalize(limbs, size);
+    set_limbs(size, limbs);
   }
   else
   {
-    if (pb->is_gmp())
-    {
-      mpz_mul_ui(ty, pb->d_val_gmp, d_val_uint64);
-    }
-    else
+    if (is_gmp())
     {
-      mpz_set_ui(ty, pb->d_val_uint64);
-      mpz_mul_ui(ty, ty, d_val_uint64);
+      mpz_clear(d_val_gmp);
     }
+    d_val_uint64 = uint64_fdiv_r_2exp(size, uint64_modinv(pb->d_val_uint64));
   }
-  mpz_fdiv_r_2exp(ty, ty, size);
-  assert(!mpz_cmp_ui(ty, 1));
-  mpz_clear(ty);
-#endif
+  d_size = size;
+  assert(pb->bvmul(*this).is_one());
   return *this;
 }
 
@@ -3118,9 +4733,29 @@ BitVector::bvudivurem(const BitVector& bv,
       }
       *quot = mk_zero(d_size);
       *rem  = mk_zero(d_size);
-      mpz_fdiv_qr(quot->d_val_gmp, rem->d_val_gmp, a->d_val_gmp, b->d_val_gmp);
-      mpz_fdiv_r_2exp(quot->d_val_gmp, quot->d_val_gmp, d_size);
-      mpz_fdiv_r_2exp(rem->d_val_gmp, rem->d_val_gmp, d_size);
+      int64_t k = mpz_log2_exact(b->d_val_gmp);
+      if (k >= 0)
+      {
+        mpz_fdiv_q_2exp(
+            quot->d_val_gmp, a->d_val_gmp, static_cast<uint64_t>(k));
+        mpz_fdiv_r_2exp(rem->d_val_gmp, a->d_val_gmp, static_cast<uint64_t>(k));
+      }
+      else
+      {
+        mpz_fdiv_qr(
+            quot->d_val_gmp, rem->d_val_gmp, a->d_val_gmp, b->d_val_gmp);
+        mpz_fdiv_r_2exp(quot->d_val_gmp, quot->d_val_gmp, d_size);
+        mpz_fdiv_r_2exp(rem->d_val_gmp, rem->d_val_gmp, d_size);
+      }
+    }
+    else if (is_limbs())
+    {
+      /* compute into temporaries to guard for quot/rem == *this or bv */
+      uint64_t q[n_limbs], r[n_limbs];
+      uint64_t size = d_size;
+      limbs_udivurem(q, r, d_val_limbs, bv.d_val_limbs);
+      quot->set_limbs(size, q);
+      rem->set_limbs(size, r);
     }
     else
     {
@@ -3138,6 +4773,82 @@ BitVector::bvudivurem(const BitVector& bv,
 
 #define BZLA_BV_MASK_BITS_UINT64(size)
 
+void
+BitVector::copy_limbs(uint64_t* limbs) const
+{
+  assert(!is_gmp());
+  if (is_limbs())
+  {
+    std::copy(d_val_limbs, d_val_limbs + n_limbs, limbs);
+  }
+  else
+  {
+    std::fill(limbs, limbs + n_limbs, 0);
+    limbs[0] = d_val_uint64;
+  }
+}
+
+void
+BitVector::set_limbs(uint64_t size, const uint64_t* limbs)
+{
+  assert(size <= s_max_size_limbs);
+  if (is_gmp())
+  {
+    mpz_clear(d_val_gmp);
+  }
+  if (size > 64)
+  {
+    if (limbs != d_val_limbs)
+    {
+      std::copy(limbs, limbs + n_limbs, d_val_limbs);
+    }
+    limbs_normalize(d_val_limbs, size);
+  }
+  else
+  {
+    d_val_uint64 = uint64_fdiv_r_2exp(size, limbs[0]);
+  }
+  d_size = size;
+}
+
+void
+BitVector::get_mpz(mpz_t res) const
+{
+  if (is_gmp())
+  {
+    mpz_set(res, d_val_gmp);
+  }
+  else if (is_limbs())
+  {
+    limbs_to_mpz(res, d_val_limbs);
+  }
+  else
+  {
+    mpz_set_ui(res, d_val_uint64);
+  }
+}
+
+const uint64_t*
+BitVector::get_limbs(size_t& n) const
+{
+  if (is_gmp())
+  {
+    if (!gmp_limbs_64)
+    {
+      return nullptr;
+    }
+    n = mpz_size(d_val_gmp);
+    return gmp_limbs_read(d_val_gmp);
+  }
+  if (is_limbs())
+  {
+    n = n_limbs;
+    return d_val_limbs;
+  }
+  n = 1;
+  return &d_val_uint64;
+}
+
 uint64_t
 BitVector::uint64_fdiv_r_2exp(uint64_t size, uint64_t val)
 {
@@ -3150,6 +4861,20 @@ uint64_t
 BitVector::count_leading(bool zeros) const
 {
   assert(!is_null());
+
+  if (is_limbs())
+  {
+    uint64_t limbs[n_limbs];
+    for (uint32_t i = 0; i < n_limbs; ++i)
+    {
+      limbs[i] = zeros ? d_val_limbs[i] : ~d_val_limbs[i];
+    }
+    limbs_normalize(limbs, d_size);
+    uint32_t n = limbs_size(limbs);
+    if (n == 0) return d_size;
+    return d_size - (n * 64 - clz64(limbs[n - 1]));
+  }
+
   uint64_t res = 0;
   mp_limb_t limb;
 
@@ -3237,6 +4962,24 @@ BitVector::get_limb(void* limb, uint64_t nbits_rem, bool zeros) const
     return n_limbs_total;
   }
   mask = ~((mp_limb_t) 0) << nbits_rem;
+  if (gmp_limbs_64 && is_gmp())
+  {
+    /* check most significant limb, then find the most significant limb that
+     * is not all ones among the remaining limbs */
+    const uint64_t* limbs = gmp_limbs_read(d_val_gmp);
+    res = limbs[n_limbs - 1];
+    if (nbits_rem)
+    {
+      res = res | mask;
+    }
+    if (~res == 0)
+    {
+      n_limbs = LimbKernels::get().find_last_not_ones(limbs, n_limbs - 1);
+      res     = n_limbs ? limbs[n_limbs - 1] : ~((mp_limb_t) 0);
+    }
+    *gmp_limb = ~res;
+    return n_limbs;
+  }
   for (i = 0; i < n_limbs; i++)
   {
     if (is_gmp())
@@ -3280,7 +5023,7 @@ BitVector::shift_is_uint64(uint64_t* res) const
 std::ostream&
 operator<<(std::ostream& out, const BitVector& bv)
 {
-  out << bv.str();
+  bv.print(out);
   return out;
 }
 
@@ -31,6 +31,13 @@ class BitVector
   static constexpr uint32_t s_n_primes =
       ((uint32_t) (sizeof s_hash_primes / sizeof *s_hash_primes));
 
+  /**
+   * The maximum size of bit-vectors that are represented with a fixed number
+   * of 64-bit limbs. Bit-vectors of size <= 64 are represented as a single
+   * uint64_t value, and bit-vectors larger than this size wrap a GMP value.
+   */
+  static constexpr uint64_t s_max_size_limbs = 256;
+
   /**
    * Determine if given string representation of a value in the given numeric
    * base fits into a bit-vector of given size.
@@ -87,6 +94,14 @@ class BitVector
    *                 representable with `size` bits.
    */
   static BitVector from_si(uint64_t size, int64_t value, bool truncate = false);
+  /**
+   * Construct a bit-vector of given size from given array of 64-bit limbs.
+   * @param size  The size of the bit-vector.
+   * @param limbs The `(size + 63) / 64` limbs representing the value, least
+   *              significant limb first. Bits at positions >= `size` are
+   *              ignored.
+   */
+  static BitVector from_limbs(uint64_t size, const uint64_t* limbs);
 
   /**
    * Create a true bit-vector (value 1 of size 1).
@@ -222,6 +237,8 @@ class BitVector
 
   /** Copy assignment operator. */
   BitVector& operator=(const BitVector& other);
+  /** Move assignment operator. */
+  BitVector& operator=(BitVector&& other);
 
   /** @return The hash value of this bit-vector. */
   size_t hash() const;
@@ -270,6 +287,17 @@ class BitVector
    * @return The string representation.
    */
   std::string str(uint32_t base = 2) const;
+  /**
+   * Write the string representation of this bit-vector to given stream.
+   *
+   * Binary and hexadecimal representations are written directly from the
+   * value in chunks, without constructing an intermediate string.
+   *
+   * @param out  The output stream.
+   * @param base 2 for binary representation, 10 for decimal representation, 16
+   *             for hexadecimal representation.
+   */
+  void print(std::ostream& out, uint32_t base = 2) const;
   /**
    * Get the uint64_t representation of this bit-vector.
    * @param size The size of this bit-vector, must be <= 64.
@@ -278,6 +306,12 @@ class BitVector
    * @return The uint64_t representation.
    */
   uint64_t to_uint64(bool truncate = false) const;
+  /**
+   * Store the value of this bit-vector in given array of 64-bit limbs.
+   * @param limbs The array of `(size() + 63) / 64` limbs to store the value
+   *              in, least significant limb first.
+   */
+  void to_limbs(uint64_t* limbs) const;
 
   /** @return the size of this bit-vector. */
   uint64_t size() const { return d_size; }
@@ -372,22 +406,22 @@ class BitVector
    * bit-vector.
    * @return The two's complement of this bit-vector.
    */
-  BitVector bvneg() const;
+  BitVector bvneg() const&;
   /**
    * Create a bit-vector representing the bit-wise negation of this bit-vector.
    * @return The bit-wise negation of this bit-vector.
    */
-  BitVector bvnot() const;
+  BitVector bvnot() const&;
   /**
    * Create a bit-vector representing the increment (+ 1) of this bit-vector.
    * @return The increment of this bit-vector.
    */
-  BitVector bvinc() const;
+  BitVector bvinc() const&;
   /**
    * Create a bit-vector representing the decrement (- 1) of this bit-vector.
    * @return The decrement of this bit-vector.
    */
-  BitVector bvdec() const;
+  BitVector bvdec() const&;
   /**
    * Create a bit-vector representing the and reduction of this bit-vector.
    * @return A bit-vector of size 1, representing the result of the and
@@ -409,63 +443,63 @@ class BitVector
    * @param bv The other bit-vector.
    * @return A bit-vector representing the result of the addition.
    */
-  BitVector bvadd(const BitVector& bv) const;
+  BitVector bvadd(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the subtraction of this bit-vector and
    * the given bit-vector.
    * @param bv The other bit-vector.
    * @return A bit-vector representing the result of the subtraction.
    */
-  BitVector bvsub(const BitVector& bv) const;
+  BitVector bvsub(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the bit-wise and of this bit-vector and
    * the given bit-vector.
    * @param bv The other bit-vector.
    * @return A bit-vector representing the result of the bit-wise and.
    */
-  BitVector bvand(const BitVector& bv) const;
+  BitVector bvand(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the implication of this bit-vector and
    * the given bit-vector.
    * @param bv The other bit-vector.
    * @return A bit-vector representing the result of the implication.
    */
-  BitVector bvimplies(const BitVector& bv) const;
+  BitVector bvimplies(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the bit-wise nand of this bit-vector and
    * the given bit-vector.
    * @param bv The other bit-vector.
    * @return A bit-vector representing the result of the bit-wise nand.
    */
-  BitVector bvnand(const BitVector& bv) const;
+  BitVector bvnand(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the bit-wise nor of this bit-vector and
    * the given bit-vector.
    * @param bv The other bit-vector.
    * @return A bit-vector representing the result of the bit-wise nor.
    */
-  BitVector bvnor(const BitVector& bv) const;
+  BitVector bvnor(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the bit-wise or of this bit-vector and
    * the given bit-vector.
    * @param bv The other bit-vector.
    * @return A bit-vector representing the result of the bit-wise or.
    */
-  BitVector bvor(const BitVector& bv) const;
+  BitVector bvor(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the bit-wise xnor of this bit-vector and
    * the given bit-vector.
    * @param bv The other bit-vector.
    * @return A bit-vector representing the result of the bit-wise xnor.
    */
-  BitVector bvxnor(const BitVector& bv) const;
+  BitVector bvxnor(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the bit-wise xor of this bit-vector and
    * the given bit-vector.
    * @param bv The other bit-vector.
    * @return A bit-vector representing the result of the bit-wise xor.
    */
-  BitVector bvxor(const BitVector& bv) const;
+  BitVector bvxor(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the equality of this bit-vector and
    * the given bit-vector.
@@ -547,7 +581,7 @@ class BitVector
    *              this bit-vector to the left.
    * @return A bit-vector representing the result of the logical left shift.
    */
-  BitVector bvshl(uint64_t shift) const;
+  BitVector bvshl(uint64_t shift) const&;
   /**
    * Create a bit-vector representing the logical left shift of this bit-vector
    * by the given bit-vector shift value.
@@ -555,7 +589,7 @@ class BitVector
    *              bit-vector to the left.
    * @return A bit-vector representing the result of the logical left shift.
    */
-  BitVector bvshl(const BitVector& bv) const;
+  BitVector bvshl(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the logical right shift of this
    * bit-vector by the given unsigned integer shift value.
@@ -563,7 +597,7 @@ class BitVector
    *              this bit-vector to the right.
    * @return A bit-vector representing the result of the logical right shift.
    */
-  BitVector bvshr(uint64_t shift) const;
+  BitVector bvshr(uint64_t shift) const&;
   /**
    * Create a bit-vector representing the logical right shift of this
    * bit-vector by the given bit-vector shift value.
@@ -571,7 +605,7 @@ class BitVector
    *              bit-vector to the right.
    * @return A bit-vector representing the result of the logical right shift.
    */
-  BitVector bvshr(const BitVector& bv) const;
+  BitVector bvshr(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the arithmetic right shift of this
    * bit-vector by the given unsigned integer shift value.
@@ -579,7 +613,7 @@ class BitVector
    *              this bit-vector to the right.
    * @return A bit-vector representing the result of the arithmetic right shift.
    */
-  BitVector bvashr(uint64_t shift) const;
+  BitVector bvashr(uint64_t shift) const&;
   /**
    * Create a bit-vector representing the arithmetic right shift of this
    * bit-vector by the given bit-vector shift value.
@@ -587,42 +621,42 @@ class BitVector
    *              bit-vector to the right.
    * @return A bit-vector representing the result of the arithmetic right shift.
    */
-  BitVector bvashr(const BitVector& bv) const;
+  BitVector bvashr(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the multiplication of this bit-vector and
    * the given bit-vector.
    * @param bv The other bit-vector.
    * @return A bit-vector representing the result of the multiplication.
    */
-  BitVector bvmul(const BitVector& bv) const;
+  BitVector bvmul(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the unsigned division of this bit-vector
    * and the given bit-vector.
    * @param bv The other bit-vector.
    * @return A bit-vector representing the result of the unsigned division.
    */
-  BitVector bvudiv(const BitVector& bv) const;
+  BitVector bvudiv(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the unsigned remainder of this bit-vector
    * and the given bit-vector.
    * @param bv The other bit-vector.
    * @return A bit-vector representing the result of the unsigned remainder.
    */
-  BitVector bvurem(const BitVector& bv) const;
+  BitVector bvurem(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the signed division of this bit-vector
    * and the given bit-vector.
    * @param bv The other bit-vector.
    * @return A bit-vector representing the result of the signed division.
    */
-  BitVector bvsdiv(const BitVector& bv) const;
+  BitVector bvsdiv(const BitVector& bv) const&;
   /**
    * Create a bit-vector representing the signed remainder of this bit-vector
    * and the given bit-vector.
    * @param bv The other bit-vector.
    * @return A bit-vector representing the result of the signed remainder.
    */
-  BitVector bvsrem(const BitVector& bv) const;
+  BitVector bvsrem(const BitVector& bv) const&;
 
   /**
    * Create a bit-vector representing the concatenation of this bit-vector and
@@ -631,7 +665,7 @@ class BitVector
    * @param bv The other bit-vector.
    * @return A bit-vector representing the result of the concatenation.
    */
-  BitVector bvconcat(const BitVector& bv) const;
+  BitVector bvconcat(const BitVector& bv) const&;
 
   /**
    * Create a bit-vector representing the extract of a given bit range from
@@ -640,7 +674,7 @@ class BitVector
    * @param idx_lo The lower bit-index of the range (inclusive).
    * @return A bit-vector representing the extracted bit range.
    */
-  BitVector bvextract(uint64_t idx_hi, uint64_t idx_lo) const;
+  BitVector bvextract(uint64_t idx_hi, uint64_t idx_lo) const&;
 
   /**
    * Create a bit-vector representing the zero extension of this bit-vector
@@ -648,25 +682,65 @@ class BitVector
    * @param n The number of bits to extend this bit-vector with.
    * @return A bit-vector representing the zero extension.
    */
-  BitVector bvzext(uint64_t n) const;
+  BitVector bvzext(uint64_t n) const&;
   /**
    * Create a bit-vector representing the sign extension of this bit-vector
    * by the given number of bits.
    * @param n The number of bits to extend this bit-vector with.
    * @return A bit-vector representing the sign extension.
    */
-  BitVector bvsext(uint64_t n) const;
+  BitVector bvsext(uint64_t n) const&;
 
   /**
-   * Calculate modular inverse for this bit-vector by means of the Extended
-   * Euclidian Algorithm.
+   * Calculate modular inverse for this bit-vector by means of Newton
+   * iteration.
    *
    * @note Bit-vector must be odd. The greatest common divisor gcd (c, 2^bw)
    *       must be (and is, in this case) always 1.
    *
    * @return A bit-vector representing the modular inverse of this bit-vector.
    */
-  BitVector bvmodinv() const;
+  BitVector bvmodinv() const&;
+
+  /* ----------------------------------------------------------------------- */
+  /* Bit-vector operations on rvalues.                                       */
+  /* ----------------------------------------------------------------------- */
+
+  /**
+   * Overloads of the operations above for rvalues, e.g., for the temporaries
+   * of chained operations such as `a.bvadd(b).bvmul(c)`. The result is
+   * computed in-place and this bit-vector is moved into the result, which
+   * reuses its storage instead of allocating a fresh bit-vector.
+   */
+  BitVector bvneg() &&;
+  BitVector bvnot() &&;
+  BitVector bvinc() &&;
+  BitVector bvdec() &&;
+  BitVector bvadd(const BitVector& bv) &&;
+  BitVector bvsub(const BitVector& bv) &&;
+  BitVector bvand(const BitVector& bv) &&;
+  BitVector bvimplies(const BitVector& bv) &&;
+  BitVector bvnand(const BitVector& bv) &&;
+  BitVector bvnor(const BitVector& bv) &&;
+  BitVector bvor(const BitVector& bv) &&;
+  BitVector bvxnor(const BitVector& bv) &&;
+  BitVector bvxor(const BitVector& bv) &&;
+  BitVector bvshl(uint64_t shift) &&;
+  BitVector bvshl(const BitVector& bv) &&;
+  BitVector bvshr(uint64_t shift) &&;
+  BitVector bvshr(const BitVector& bv) &&;
+  BitVector bvashr(uint64_t shift) &&;
+  BitVector bvashr(const BitVector& bv) &&;
+  BitVector bvmul(const BitVector& bv) &&;
+  BitVector bvudiv(const BitVector& bv) &&;
+  BitVector bvurem(const BitVector& bv) &&;
+  BitVector bvsdiv(const BitVector& bv) &&;
+  BitVector bvsrem(const BitVector& bv) &&;
+  BitVector bvconcat(const BitVector& bv) &&;
+  BitVector bvextract(uint64_t idx_hi, uint64_t idx_lo) &&;
+  BitVector bvzext(uint64_t n) &&;
+  BitVector bvsext(uint64_t n) &&;
+  BitVector bvmodinv() &&;
 
   /* ----------------------------------------------------------------------- */
   /* In-place versions of bit-vector operations.                             */
@@ -1610,8 +1684,8 @@ class BitVector
   BitVector& ibvite(const BitVector& c, const BitVector& t, const BitVector& e);
 
   /**
-   * Calculate modular inverse of the given bit-vector by means of the Extended
-   * Euclidian Algorithm (in-place).
+   * Calculate modular inverse of the given bit-vector by means of
+   * Newton iteration (in-place).
    *
    * @note Bit-vector `bv` must be odd. The greatest common divisor
    *       gcd (c, 2^bw) must be (and is, in this case) always 1.
@@ -1624,8 +1698,8 @@ class BitVector
    */
   BitVector& ibvmodinv(const BitVector& bv);
   /**
-   * Calculate modular inverse of this bit-vector by means of the Extended
-   * Euclidian Algorithm (in-place).
+   * Calculate modular inverse of this bit-vector by means of
+   * Newton iteration (in-place).
    *
    * @note This bit-vector must be odd. The greatest common divisor
    *       gcd (c, 2^bw) must be (and is, in this case) always 1.
@@ -1686,8 +1760,45 @@ class BitVector
    */
   uint64_t get_limb(void* limb, uint64_t nbits_rem, bool zeros) const;
 
-  /** @return True if bit-vector is of size > 64 and thus wraps a GMPMpz. */
-  bool is_gmp() const { return d_size > 64; }
+  /**
+   * Get the 64-bit limbs of the value of this bit-vector.
+   * @param n The resulting number of limbs, limbs above are zero.
+   * @return The limbs, least significant limb first, or nullptr if this
+   *         bit-vector wraps a GMP value that is not represented as 64-bit
+   *         limbs.
+   */
+  const uint64_t* get_limbs(size_t& n) const;
+  /**
+   * Copy the value of this bit-vector into the given array of limbs. This
+   * bit-vector must not wrap a GMP value. Unused limbs are set to zero.
+   * @param limbs The array of `s_n_limbs` limbs to store the value in, least
+   *              significant limb first.
+   */
+  void copy_limbs(uint64_t* limbs) const;
+  /**
+   * Set the size and the value of this bit-vector from given array of limbs.
+   * Bits at positions >= `size` are ignored.
+   * @param size  The size of the bit-vector, must be <= s_max_size_limbs.
+   * @param limbs The array of `s_n_limbs` limbs, least significant limb
+   *              first. May point to the limbs of this bit-vector.
+   */
+  void set_limbs(uint64_t size, const uint64_t* limbs);
+  /**
+   * Store the value of this bit-vector in given GMP value.
+   * @param res The initialized GMP value to store the value in.
+   */
+  void get_mpz(mpz_t res) const;
+
+  /** @return True if bit-vector is of size > 256 and thus wraps a GMPMpz. */
+  bool is_gmp() const { return d_size > s_max_size_limbs; }
+  /**
+   * @return True if bit-vector is of size in (64, 256] and thus represented
+   *         as fixed number of limbs.
+   */
+  bool is_limbs() const { return d_size > 64 && d_size <= s_max_size_limbs; }
+
+  /** The number of limbs of bit-vectors represented as limbs. */
+  static constexpr uint32_t s_n_limbs = s_max_size_limbs / 64;
 
   /** The size of this bit-vector. */
   uint64_t d_size = 0;
@@ -1699,10 +1810,16 @@ class BitVector
    *       (the size of the bit-vector, d_size). Further, we do not use a
    *       unique_ptr for d_val_gmp because we don't gain anything if it is in
    *       a union -- we have to manually destruct it anyways.
+   *
+   *       Bit-vectors of size in (64, 256] are stored inline as limbs in order
+   *       to avoid the allocation and call overhead of GMP for common wide
+   *       bit-widths. Limbs are least significant first, and all bits at
+   *       positions >= d_size are zero.
    */
   union
   {
     uint64_t d_val_uint64;
+    uint64_t d_val_limbs[s_n_limbs];
     // GMPMpz* d_val_gmp;
     mpz_t d_val_gmp;
   };
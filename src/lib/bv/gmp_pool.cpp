@@ -0,0 +1,275 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "bv/gmp_pool.h"
+
+#include <gmp.h>
+
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+/**
+ * GMP's default memory functions. Not declared in gmp.h but exported by
+ * libgmp (see gmp-impl.h), used to determine if GMP uses its default
+ * allocator.
+ */
+extern "C" {
+__GMP_DECLSPEC void* __gmp_default_allocate(size_t);
+__GMP_DECLSPEC void* __gmp_default_reallocate(void*, size_t, size_t);
+__GMP_DECLSPEC void __gmp_default_free(void*, size_t);
+}
+
+namespace bzla {
+
+namespace {
+
+/** The granularity of the block sizes cached in the pool. */
+constexpr size_t s_size_class_bytes = sizeof(uint64_t);
+/** The number of block sizes cached in the pool. */
+constexpr size_t s_num_size_classes =
+    GMPPool::s_max_size / s_size_class_bytes;
+
+/** A cached block, links to the next cached block of the same size. */
+struct Block
+{
+  Block* next;
+};
+
+/** The per-thread pool of cached blocks. */
+class Pool
+{
+ public:
+  ~Pool();
+
+  void* allocate(size_t size);
+  void* reallocate(void* ptr, size_t old_size, size_t new_size);
+  void deallocate(void* ptr, size_t size);
+
+  GMPPool::Statistics d_stats;
+
+ private:
+  /**
+   * @return The size class of blocks of given size, or s_num_size_classes if
+   *         blocks of this size are not cached.
+   */
+  static size_t size_class(size_t size)
+  {
+    if (size == 0 || size > GMPPool::s_max_size
+        || size % s_size_class_bytes != 0)
+    {
+      return s_num_size_classes;
+    }
+    return size / s_size_class_bytes - 1;
+  }
+
+  /** The free lists, one per size class. */
+  std::array<Block*, s_num_size_classes> d_free_lists{};
+};
+
+/**
+ * True if the pool of the current thread was already destroyed. Memory that
+ * is allocated or released by GMP on thread exit, e.g., by the destructors of
+ * other thread-local objects, bypasses the pool.
+ */
+thread_local bool s_pool_destroyed = false;
+thread_local Pool s_pool;
+
+[[noreturn]] void
+out_of_memory(size_t size)
+{
+  fprintf(stderr, "GMP: cannot allocate %zu bytes\n", size);
+  std::abort();
+}
+
+void*
+malloc_or_abort(size_t size)
+{
+  void* res = std::malloc(size);
+  if (res == nullptr)
+  {
+    out_of_memory(size);
+  }
+  return res;
+}
+
+Pool::~Pool()
+{
+  for (Block* block : d_free_lists)
+  {
+    while (block)
+    {
+      Block* next = block->next;
+      std::free(block);
+      block = next;
+    }
+  }
+  s_pool_destroyed = true;
+}
+
+void*
+Pool::allocate(size_t size)
+{
+  ++d_stats.num_allocs;
+  size_t sc = size_class(size);
+  if (sc < s_num_size_classes && d_free_lists[sc])
+  {
+    Block* block     = d_free_lists[sc];
+    d_free_lists[sc] = block->next;
+    d_stats.num_bytes_cached -= size;
+    ++d_stats.num_pool_hits;
+    return block;
+  }
+  return malloc_or_abort(size);
+}
+
+void*
+Pool::reallocate(void* ptr, size_t old_size, size_t new_size)
+{
+  if (old_size == new_size)
+  {
+    return ptr;
+  }
+  if (size_class(old_size) == s_num_size_classes
+      && size_class(new_size) == s_num_size_classes)
+  {
+    ++d_stats.num_allocs;
+    void* res = std::realloc(ptr, new_size);
+    if (res == nullptr)
+    {
+      out_of_memory(new_size);
+    }
+    return res;
+  }
+  void* res = allocate(new_size);
+  std::memcpy(res, ptr, old_size < new_size ? old_size : new_size);
+  deallocate(ptr, old_size);
+  return res;
+}
+
+void
+Pool::deallocate(void* ptr, size_t size)
+{
+  size_t sc = size_class(size);
+  if (sc < s_num_size_classes
+      && d_stats.num_bytes_cached + size <= GMPPool::s_max_bytes_cached)
+  {
+    Block* block     = static_cast<Block*>(ptr);
+    block->next      = d_free_lists[sc];
+    d_free_lists[sc] = block;
+    d_stats.num_bytes_cached += size;
+    return;
+  }
+  std::free(ptr);
+}
+
+/* GMP memory functions. */
+
+void*
+pool_allocate(size_t size)
+{
+  if (s_pool_destroyed)
+  {
+    return malloc_or_abort(size);
+  }
+  return s_pool.allocate(size);
+}
+
+void*
+pool_reallocate(void* ptr, size_t old_size, size_t new_size)
+{
+  if (s_pool_destroyed)
+  {
+    void* res = std::realloc(ptr, new_size);
+    if (res == nullptr)
+    {
+      out_of_memory(new_size);
+    }
+    return res;
+  }
+  return s_pool.reallocate(ptr, old_size, new_size);
+}
+
+void
+pool_deallocate(void* ptr, size_t size)
+{
+  if (s_pool_destroyed)
+  {
+    std::free(ptr);
+    return;
+  }
+  s_pool.deallocate(ptr, size);
+}
+
+/* Installation state, shared by all threads. */
+
+std::mutex s_scope_mutex;
+size_t s_num_scopes                               = 0;
+bool s_installed                                  = false;
+void* (*s_prev_allocate)(size_t)                  = nullptr;
+void* (*s_prev_reallocate)(void*, size_t, size_t) = nullptr;
+void (*s_prev_deallocate)(void*, size_t)          = nullptr;
+
+}  // namespace
+
+/* --- GMPPool::Scope public ------------------------------------------------ */
+
+GMPPool::Scope::Scope()
+{
+  std::lock_guard<std::mutex> lock(s_scope_mutex);
+  if (s_num_scopes++ == 0)
+  {
+    mp_get_memory_functions(
+        &s_prev_allocate, &s_prev_reallocate, &s_prev_deallocate);
+    // Do not replace a custom allocator installed by the host application.
+    if (s_prev_allocate == __gmp_default_allocate
+        && s_prev_reallocate == __gmp_default_reallocate
+        && s_prev_deallocate == __gmp_default_free)
+    {
+      mp_set_memory_functions(pool_allocate, pool_reallocate, pool_deallocate);
+      s_installed = true;
+    }
+  }
+}
+
+GMPPool::Scope::~Scope()
+{
+  std::lock_guard<std::mutex> lock(s_scope_mutex);
+  if (--s_num_scopes == 0 && s_installed)
+  {
+    mp_set_memory_functions(
+        s_prev_allocate, s_prev_reallocate, s_prev_deallocate);
+    s_installed = false;
+  }
+}
+
+/* --- GMPPool public ------------------------------------------------------- */
+
+bool
+GMPPool::installed()
+{
+  std::lock_guard<std::mutex> lock(s_scope_mutex);
+  return s_installed;
+}
+
+const GMPPool::Statistics&
+GMPPool::statistics()
+{
+  static const Statistics s_empty;
+  if (s_pool_destroyed)
+  {
+    return s_empty;
+  }
+  return s_pool.d_stats;
+}
+
+}  // namespace bzla
@@ -0,0 +1,85 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA__BV_GMP_POOL_H
+#define BZLA__BV_GMP_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bzla {
+
+/**
+ * Pooled memory allocator for GMP values, installed via
+ * mp_set_memory_functions().
+ *
+ * Wide bit-vectors (and floating-points built on them) wrap GMP values, and
+ * temporaries of such values are created and destroyed at high rates, e.g.,
+ * during local search. The pool caches released blocks in per-thread free
+ * lists, one for each block size that is a multiple of the limb size up to
+ * `s_max_size` bytes, and serves allocations of the same size from them.
+ *
+ * GMP's memory functions are process-wide, thus the pool is opt-in: it is
+ * only installed by the owner of the process (the bitwuzla binary) via a
+ * Scope, before any other thread uses GMP. A Scope does not install the
+ * pool if GMP does not use its default memory functions, e.g., if a host
+ * application installed its own allocator, since blocks allocated by that
+ * allocator must not be released to the pool (and vice versa).
+ *
+ * The pools are thread-local, thus solver instances on different threads use
+ * separate pools. Cached blocks are plain malloc() blocks of exactly the
+ * requested size. Hence, blocks allocated by GMP's default allocator may be
+ * released to the pool, and blocks allocated by the pool may be released
+ * with free() after the allocator was uninstalled.
+ */
+class GMPPool
+{
+ public:
+  /** Allocation statistics of the pool of the current thread. */
+  struct Statistics
+  {
+    /** The number of allocations (including reallocations). */
+    uint64_t num_allocs = 0;
+    /** The number of allocations served from the pool. */
+    uint64_t num_pool_hits = 0;
+    /** The number of bytes currently cached in the pool. */
+    uint64_t num_bytes_cached = 0;
+  };
+
+  /**
+   * Installs the pooled allocator while at least one instance of this class
+   * exists, and restores the previous memory functions when the last
+   * instance is destroyed. The pooled allocator is not installed if GMP does
+   * not use its default memory functions when the first instance is created.
+   */
+  class Scope
+  {
+   public:
+    Scope();
+    ~Scope();
+    Scope(const Scope&)            = delete;
+    Scope& operator=(const Scope&) = delete;
+  };
+
+  /** @return True if the pooled allocator is currently installed. */
+  static bool installed();
+
+  /** @return The allocation statistics of the pool of the current thread. */
+  static const Statistics& statistics();
+
+  /** The maximum size of blocks cached in the pool. */
+  static constexpr size_t s_max_size = 1024;
+  /** The maximum number of bytes cached in the pool of a thread. */
+  static constexpr size_t s_max_bytes_cached = 8 * 1024 * 1024;
+};
+
+}  // namespace bzla
+
+#endif
@@ -0,0 +1,375 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "bv/limb_kernels.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) \
+    && (defined(__GNUC__) || defined(__clang__))
+#define BZLA_LIMB_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace bzla {
+
+namespace {
+
+/* -------------------------------------------------------------------------- */
+/* Portable kernels.                                                          */
+/* -------------------------------------------------------------------------- */
+
+void
+portable_and(uint64_t* res, const uint64_t* a, const uint64_t* b, size_t n)
+{
+  for (size_t i = 0; i < n; ++i) res[i] = a[i] & b[i];
+}
+
+void
+portable_or(uint64_t* res, const uint64_t* a, const uint64_t* b, size_t n)
+{
+  for (size_t i = 0; i < n; ++i) res[i] = a[i] | b[i];
+}
+
+void
+portable_xor(uint64_t* res, const uint64_t* a, const uint64_t* b, size_t n)
+{
+  for (size_t i = 0; i < n; ++i) res[i] = a[i] ^ b[i];
+}
+
+void
+portable_not(uint64_t* res, const uint64_t* a, size_t n)
+{
+  for (size_t i = 0; i < n; ++i) res[i] = ~a[i];
+}
+
+int32_t
+portable_cmp(const uint64_t* a, const uint64_t* b, size_t n)
+{
+  for (size_t i = n; i-- > 0;)
+  {
+    if (a[i] != b[i])
+    {
+      return a[i] < b[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+bool
+portable_is_ones(const uint64_t* a, size_t n)
+{
+  uint64_t res = UINT64_MAX;
+  for (size_t i = 0; i < n; ++i) res &= a[i];
+  return res == UINT64_MAX;
+}
+
+size_t
+portable_find_last_not_ones(const uint64_t* a, size_t n)
+{
+  while (n > 0 && a[n - 1] == UINT64_MAX) --n;
+  return n;
+}
+
+#ifdef BZLA_LIMB_KERNELS_X86
+
+/* -------------------------------------------------------------------------- */
+/* SSE2 kernels, two limbs per vector.                                        */
+/* -------------------------------------------------------------------------- */
+
+#define BZLA_SSE2 __attribute__((target("sse2")))
+
+BZLA_SSE2 void
+sse2_and(uint64_t* res, const uint64_t* a, const uint64_t* b, size_t n)
+{
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(res + i),
+                     _mm_and_si128(va, vb));
+  }
+  portable_and(res + i, a + i, b + i, n - i);
+}
+
+BZLA_SSE2 void
+sse2_or(uint64_t* res, const uint64_t* a, const uint64_t* b, size_t n)
+{
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(res + i),
+                     _mm_or_si128(va, vb));
+  }
+  portable_or(res + i, a + i, b + i, n - i);
+}
+
+BZLA_SSE2 void
+sse2_xor(uint64_t* res, const uint64_t* a, const uint64_t* b, size_t n)
+{
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(res + i),
+                     _mm_xor_si128(va, vb));
+  }
+  portable_xor(res + i, a + i, b + i, n - i);
+}
+
+BZLA_SSE2 void
+sse2_not(uint64_t* res, const uint64_t* a, size_t n)
+{
+  const __m128i ones = _mm_set1_epi32(-1);
+  size_t i           = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(res + i),
+                     _mm_xor_si128(va, ones));
+  }
+  portable_not(res + i, a + i, n - i);
+}
+
+BZLA_SSE2 int32_t
+sse2_cmp(const uint64_t* a, const uint64_t* b, size_t n)
+{
+  // Skip equal blocks starting from the most significant limbs.
+  size_t i = n;
+  for (; i >= 2; i -= 2)
+  {
+    __m128i va =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i - 2));
+    __m128i vb =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i - 2));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) != 0xffff)
+    {
+      return portable_cmp(a + i - 2, b + i - 2, 2);
+    }
+  }
+  return portable_cmp(a, b, i);
+}
+
+BZLA_SSE2 bool
+sse2_is_ones(const uint64_t* a, size_t n)
+{
+  __m128i acc = _mm_set1_epi32(-1);
+  size_t i    = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    acc = _mm_and_si128(
+        acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)));
+  }
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(acc, _mm_set1_epi32(-1))) == 0xffff
+         && portable_is_ones(a + i, n - i);
+}
+
+BZLA_SSE2 size_t
+sse2_find_last_not_ones(const uint64_t* a, size_t n)
+{
+  const __m128i ones = _mm_set1_epi32(-1);
+  size_t i           = n;
+  for (; i >= 2; i -= 2)
+  {
+    __m128i va =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i - 2));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(va, ones)) != 0xffff)
+    {
+      break;
+    }
+  }
+  return portable_find_last_not_ones(a, i);
+}
+
+#undef BZLA_SSE2
+
+/* -------------------------------------------------------------------------- */
+/* AVX2 kernels, four limbs per vector.                                       */
+/* -------------------------------------------------------------------------- */
+
+#define BZLA_AVX2 __attribute__((target("avx2")))
+
+BZLA_AVX2 void
+avx2_and(uint64_t* res, const uint64_t* a, const uint64_t* b, size_t n)
+{
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+    __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(res + i),
+                        _mm256_and_si256(va, vb));
+  }
+  portable_and(res + i, a + i, b + i, n - i);
+}
+
+BZLA_AVX2 void
+avx2_or(uint64_t* res, const uint64_t* a, const uint64_t* b, size_t n)
+{
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+    __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(res + i),
+                        _mm256_or_si256(va, vb));
+  }
+  portable_or(res + i, a + i, b + i, n - i);
+}
+
+BZLA_AVX2 void
+avx2_xor(uint64_t* res, const uint64_t* a, const uint64_t* b, size_t n)
+{
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+    __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(res + i),
+                        _mm256_xor_si256(va, vb));
+  }
+  portable_xor(res + i, a + i, b + i, n - i);
+}
+
+BZLA_AVX2 void
+avx2_not(uint64_t* res, const uint64_t* a, size_t n)
+{
+  const __m256i ones = _mm256_set1_epi64x(-1);
+  size_t i           = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(res + i),
+                        _mm256_xor_si256(va, ones));
+  }
+  portable_not(res + i, a + i, n - i);
+}
+
+BZLA_AVX2 int32_t
+avx2_cmp(const uint64_t* a, const uint64_t* b, size_t n)
+{
+  // Skip equal blocks starting from the most significant limbs.
+  size_t i = n;
+  for (; i >= 4; i -= 4)
+  {
+    __m256i va =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i - 4));
+    __m256i vb =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i - 4));
+    if (_mm256_movemask_epi8(_mm256_cmpeq_epi64(va, vb)) != -1)
+    {
+      return portable_cmp(a + i - 4, b + i - 4, 4);
+    }
+  }
+  return portable_cmp(a, b, i);
+}
+
+BZLA_AVX2 bool
+avx2_is_ones(const uint64_t* a, size_t n)
+{
+  __m256i acc = _mm256_set1_epi64x(-1);
+  size_t i    = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    acc = _mm256_and_si256(
+        acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)));
+  }
+  return _mm256_movemask_epi8(_mm256_cmpeq_epi64(acc, _mm256_set1_epi64x(-1)))
+             == -1
+         && portable_is_ones(a + i, n - i);
+}
+
+BZLA_AVX2 size_t
+avx2_find_last_not_ones(const uint64_t* a, size_t n)
+{
+  const __m256i ones = _mm256_set1_epi64x(-1);
+  size_t i           = n;
+  for (; i >= 4; i -= 4)
+  {
+    __m256i va =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i - 4));
+    if (_mm256_movemask_epi8(_mm256_cmpeq_epi64(va, ones)) != -1)
+    {
+      break;
+    }
+  }
+  return portable_find_last_not_ones(a, i);
+}
+
+#undef BZLA_AVX2
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+const LimbKernels s_portable = {LimbKernels::Isa::PORTABLE,
+                                portable_and,
+                                portable_or,
+                                portable_xor,
+                                portable_not,
+                                portable_cmp,
+                                portable_is_ones,
+                                portable_find_last_not_ones};
+
+#ifdef BZLA_LIMB_KERNELS_X86
+const LimbKernels s_sse2 = {LimbKernels::Isa::SSE2,
+                            sse2_and,
+                            sse2_or,
+                            sse2_xor,
+                            sse2_not,
+                            sse2_cmp,
+                            sse2_is_ones,
+                            sse2_find_last_not_ones};
+
+const LimbKernels s_avx2 = {LimbKernels::Isa::AVX2,
+                            avx2_and,
+                            avx2_or,
+                            avx2_xor,
+                            avx2_not,
+                            avx2_cmp,
+                            avx2_is_ones,
+                            avx2_find_last_not_ones};
+#endif
+
+}  // namespace
+
+const LimbKernels&
+LimbKernels::get()
+{
+  static const LimbKernels* kernels = []() {
+    if (const LimbKernels* res = get(Isa::AVX2)) return res;
+    if (const LimbKernels* res = get(Isa::SSE2)) return res;
+    return &s_portable;
+  }();
+  return *kernels;
+}
+
+const LimbKernels*
+LimbKernels::get(Isa isa)
+{
+  switch (isa)
+  {
+#ifdef BZLA_LIMB_KERNELS_X86
+    case Isa::AVX2:
+      return __builtin_cpu_supports("avx2") ? &s_avx2 : nullptr;
+    case Isa::SSE2:
+      return __builtin_cpu_supports("sse2") ? &s_sse2 : nullptr;
+#else
+    case Isa::AVX2:
+    case Isa::SSE2: return nullptr;
+#endif
+    case Isa::PORTABLE: break;
+  }
+  return &s_portable;
+}
+
+}  // namespace bzla
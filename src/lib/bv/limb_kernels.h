@@ -0,0 +1,79 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA__BV_LIMB_KERNELS_H
+#define BZLA__BV_LIMB_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bzla {
+
+/**
+ * Kernels over arrays of 64-bit limbs (least significant limb first), used
+ * for the limb-wise operations on wide bit-vectors.
+ *
+ * Each kernel is available in a portable version and, on x86-64, in versions
+ * vectorized with SSE2 and AVX2. The best version supported by the CPU is
+ * selected at runtime.
+ */
+struct LimbKernels
+{
+  /** The instruction set a set of kernels is implemented with. */
+  enum class Isa
+  {
+    PORTABLE,
+    SSE2,
+    AVX2,
+  };
+
+  /**
+   * Get the kernels of the most efficient instruction set supported by the
+   * CPU.
+   * @return The kernels.
+   */
+  static const LimbKernels& get();
+  /**
+   * Get the kernels implemented with the given instruction set.
+   * @param isa The instruction set.
+   * @return The kernels, or nullptr if the instruction set is not supported
+   *         by the build or the CPU.
+   */
+  static const LimbKernels* get(Isa isa);
+
+  /** The instruction set of these kernels. */
+  Isa isa;
+
+  /** Compute `res[i] = a[i] & b[i]` for all `i < n`. */
+  void (*bvand)(uint64_t* res, const uint64_t* a, const uint64_t* b, size_t n);
+  /** Compute `res[i] = a[i] | b[i]` for all `i < n`. */
+  void (*bvor)(uint64_t* res, const uint64_t* a, const uint64_t* b, size_t n);
+  /** Compute `res[i] = a[i] ^ b[i]` for all `i < n`. */
+  void (*bvxor)(uint64_t* res, const uint64_t* a, const uint64_t* b, size_t n);
+  /** Compute `res[i] = ~a[i]` for all `i < n`. */
+  void (*bvnot)(uint64_t* res, const uint64_t* a, size_t n);
+  /**
+   * Compare the unsigned values represented by the first `n` limbs of `a`
+   * and `b`.
+   * @return -1, 0 or 1 if `a` is less than, equal to or greater than `b`.
+   */
+  int32_t (*cmp)(const uint64_t* a, const uint64_t* b, size_t n);
+  /** @return True if the first `n` limbs of `a` are all ones. */
+  bool (*is_ones)(const uint64_t* a, size_t n);
+  /**
+   * @return The index of the most significant limb among the first `n` limbs
+   *         of `a` that is not all ones, plus one. Zero if all limbs are ones.
+   */
+  size_t (*find_last_not_ones)(const uint64_t* a, size_t n);
+};
+
+}  // namespace bzla
+
+#endif
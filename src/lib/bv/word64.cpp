@@ -0,0 +1,167 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "bv/word64.h"
+
+#include <iostream>
+
+#include "rng/rng.h"
+
+namespace bzla {
+
+/* -------------------------------------------------------------------------- */
+
+Word64::Word64(uint64_t size, RNG& rng) : Word64(size)
+{
+  // Same sequence of random values as for BitVector of size <= 64.
+  d_val = rng.pick<uint64_t>(0, mask()) & mask();
+}
+
+Word64::Word64(
+    uint64_t size, RNG& rng, const Word64& from, const Word64& to, bool sign)
+    : Word64(size)
+{
+  iset(rng, from, to, sign);
+}
+
+Word64::Word64(uint64_t size,
+               RNG& rng,
+               const Word64& from0,
+               const Word64& to0,
+               const Word64& from1,
+               const Word64& to1,
+               bool sign)
+    : Word64(size)
+{
+  assert(!from0.is_null() || !from1.is_null());
+  assert(from0.is_null() == to0.is_null());
+  assert(from1.is_null() == to1.is_null());
+  if (!from1.is_null())
+  {
+    iset(rng, from1, to1, sign);
+  }
+  else
+  {
+    iset(rng, from0, to0, sign);
+  }
+}
+
+Word64::Word64(uint64_t size, RNG& rng, uint64_t idx_hi, uint64_t idx_lo)
+    : Word64(size, rng)
+{
+  // Clear bits [0, idx_lo) and [idx_hi, size).
+  uint64_t lo = idx_lo >= s_max_size ? ~UINT64_C(0) : mask(idx_lo + 1) >> 1;
+  uint64_t hi = idx_hi >= s_max_size ? ~UINT64_C(0) : mask(idx_hi + 1) >> 1;
+  d_val &= hi & ~lo;
+}
+
+Word64::Word64(uint64_t size, const std::string& value, uint32_t base)
+    : Word64(BitVector(size, value, base))
+{
+}
+
+Word64::Word64(const BitVector& bv)
+{
+  if (!bv.is_null())
+  {
+    assert(bv.size() <= s_max_size);
+    d_size = bv.size();
+    d_val  = bv.to_uint64();
+  }
+}
+
+void
+Word64::iset(RNG& rng, const Word64& from, const Word64& to, bool is_signed)
+{
+  assert(!is_null());
+  assert(d_size == from.d_size);
+  assert(d_size == to.d_size);
+  assert(is_signed || from.compare(to) <= 0);
+  assert(!is_signed || from.signed_compare(to) <= 0);
+  // Same sequence of random values as for BitVector of size <= 64.
+  if (is_signed)
+  {
+    d_val = rng.pick<uint64_t>(0, (to.d_val - from.d_val) & mask());
+    d_val = (d_val + from.d_val) & mask();
+  }
+  else
+  {
+    d_val = rng.pick<uint64_t>(from.d_val, to.d_val);
+  }
+}
+
+std::string
+Word64::str(uint32_t base) const
+{
+  if (is_null()) return "";
+  if (base == 2)
+  {
+    std::string res(d_size, '0');
+    for (uint64_t i = 0; i < d_size; ++i)
+    {
+      res[d_size - 1 - i] += bit(i);
+    }
+    return res;
+  }
+  return to_bitvector().str(base);
+}
+
+void
+Word64::print(std::ostream& out, uint32_t base) const
+{
+  out << str(base);
+}
+
+Word64
+Word64::bvsdiv(const Word64& bv) const
+{
+  bool neg0 = msb(), neg1 = bv.msb();
+  Word64 a  = neg0 ? bvneg() : *this;
+  Word64 b  = neg1 ? bv.bvneg() : bv;
+  Word64 q  = a.bvudiv(b);
+  return neg0 != neg1 ? q.bvneg() : q;
+}
+
+Word64
+Word64::bvsrem(const Word64& bv) const
+{
+  bool neg0 = msb(), neg1 = bv.msb();
+  Word64 a  = neg0 ? bvneg() : *this;
+  Word64 b  = neg1 ? bv.bvneg() : bv;
+  Word64 r  = a.bvurem(b);
+  return neg0 ? r.bvneg() : r;
+}
+
+Word64
+Word64::bvmodinv() const
+{
+  assert(lsb()); /* must be odd */
+  // Newton iteration, the initial approximation is correct in the 5 least
+  // significant bits and each step doubles the number of correct bits.
+  uint64_t x = (3 * d_val) ^ 2;
+  for (uint32_t i = 0; i < 4; ++i)
+  {
+    x *= 2 - d_val * x;
+  }
+  Word64 res = make(x);
+  assert(bvmul(res).is_one());
+  return res;
+}
+
+std::ostream&
+operator<<(std::ostream& out, const Word64& bv)
+{
+  bv.print(out);
+  return out;
+}
+
+/* -------------------------------------------------------------------------- */
+
+}  // namespace bzla
@@ -0,0 +1,499 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA__BV_WORD64_H
+#define BZLA__BV_WORD64_H
+
+#include <cassert>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+#include "bv/bitvector.h"
+
+namespace bzla {
+
+class RNG;
+
+/**
+ * A bit-vector of size <= 64, stored as a single machine word.
+ *
+ * Provides the subset of the BitVector interface that is used by the local
+ * search engine with the same semantics, but without size dependent
+ * representations. All operations are inline and, except for division, free
+ * of data dependent branches. Random values are drawn in the same way as for
+ * BitVector values of size <= 64, i.e., for a given RNG state both produce
+ * the same values.
+ *
+ * Bits at positions >= size() are always zero.
+ */
+class Word64
+{
+ public:
+  /** The maximum size of a Word64 value. */
+  static constexpr uint64_t s_max_size = 64;
+
+  /**
+   * Construct a bit-vector of given size from given uint64 value.
+   * @param size     The size of the bit-vector.
+   * @param value    The value, must be representable with `size` bits if
+   *                 `truncate` is false.
+   * @param truncate True to allow truncating the value.
+   */
+  static Word64 from_ui(uint64_t size, uint64_t value, bool truncate = false)
+  {
+    assert(size > 0 && size <= s_max_size);
+    assert(truncate || (value & ~mask(size)) == 0);
+    (void) truncate;
+    return Word64(size, value & mask(size), 0);
+  }
+  /** @return A true bit-vector (value 1 of size 1). */
+  static Word64 mk_true() { return Word64(1, 1, 0); }
+  /** @return A false bit-vector (value 0 of size 1). */
+  static Word64 mk_false() { return Word64(1, 0, 0); }
+  /** @return A zero bit-vector of given size. */
+  static Word64 mk_zero(uint64_t size) { return Word64(size); }
+  /** @return A one bit-vector of given size. */
+  static Word64 mk_one(uint64_t size) { return Word64(size, 1, 0); }
+  /** @return A ones bit-vector of given size. */
+  static Word64 mk_ones(uint64_t size) { return Word64(size, mask(size), 0); }
+  /** @return The minimum signed value (10..0) of given size. */
+  static Word64 mk_min_signed(uint64_t size)
+  {
+    return Word64(size, UINT64_C(1) << (size - 1), 0);
+  }
+  /** @return The maximum signed value (01..1) of given size. */
+  static Word64 mk_max_signed(uint64_t size)
+  {
+    return Word64(size, mask(size) >> 1, 0);
+  }
+  /** @return An if-then-else over the given bit-vectors. */
+  static Word64 bvite(const Word64& c, const Word64& t, const Word64& e)
+  {
+    assert(c.d_size == 1);
+    assert(t.d_size == e.d_size);
+    return Word64(t.d_size, e.d_val ^ ((t.d_val ^ e.d_val) & (0 - c.d_val)), 0);
+  }
+
+  /** Default constructor, creates a null bit-vector. */
+  Word64() = default;
+  /** Construct a zero bit-vector of given size. */
+  Word64(uint64_t size) : d_size(size)
+  {
+    assert(size > 0 && size <= s_max_size);
+  }
+  /** Construct a random bit-vector of given size. */
+  Word64(uint64_t size, RNG& rng);
+  /**
+   * Construct a random bit-vector of given size within the given range
+   * (inclusive), interpreted as signed if `sign` is true.
+   */
+  Word64(uint64_t size,
+         RNG& rng,
+         const Word64& from,
+         const Word64& to,
+         bool sign = false);
+  /**
+   * Construct a random bit-vector of given size within one of the given
+   * ranges (see the corresponding BitVector constructor).
+   */
+  Word64(uint64_t size,
+         RNG& rng,
+         const Word64& from0,
+         const Word64& to0,
+         const Word64& from1,
+         const Word64& to1,
+         bool sign = false);
+  /**
+   * Construct a bit-vector of given size with random bits in the given index
+   * range and all other bits zero (see the corresponding BitVector
+   * constructor).
+   */
+  Word64(uint64_t size, RNG& rng, uint64_t idx_hi, uint64_t idx_lo);
+  /** Construct a bit-vector of given size from a string in given base. */
+  Word64(uint64_t size, const std::string& value, uint32_t base = 2);
+  /** Construct from a bit-vector of size <= 64. */
+  explicit Word64(const BitVector& bv);
+
+  /** @return The BitVector representation of this bit-vector. */
+  BitVector to_bitvector() const
+  {
+    return is_null() ? BitVector() : BitVector::from_ui(d_size, d_val);
+  }
+
+  /** @return The hash value of this bit-vector. */
+  size_t hash() const
+  {
+    return static_cast<size_t>((d_val ^ (d_size << 58))
+                               * UINT64_C(0x9e3779b97f4a7c15));
+  }
+
+  /** @return True if this is a null bit-vector. */
+  bool is_null() const { return d_size == 0; }
+
+  /** Set the value of this bit-vector to given value, truncated to size. */
+  void iset(uint64_t value) { d_val = value & mask(); }
+  /** Set the value of this bit-vector to the value of `bv`. */
+  void iset(const Word64& bv)
+  {
+    assert(d_size == bv.d_size);
+    d_val = bv.d_val;
+  }
+  /**
+   * Set the value of this bit-vector to a random value within the given
+   * range (inclusive), interpreted as signed if `is_signed` is true.
+   */
+  void iset(RNG& rng, const Word64& from, const Word64& to, bool is_signed);
+
+  bool operator==(const Word64& bv) const { return compare(bv) == 0; }
+  bool operator!=(const Word64& bv) const { return compare(bv) != 0; }
+
+  /** @return The string representation of this bit-vector in given base. */
+  std::string str(uint32_t base = 2) const;
+  /** Print this bit-vector in given base to given output stream. */
+  void print(std::ostream& out, uint32_t base = 2) const;
+
+  /** @return The value of this bit-vector as uint64. */
+  uint64_t to_uint64(bool truncate = false) const
+  {
+    (void) truncate;
+    return d_val;
+  }
+
+  /** @return The size of this bit-vector. */
+  uint64_t size() const { return d_size; }
+
+  /** Unsigned comparison, -1 if the sizes differ (as BitVector::compare). */
+  int32_t compare(const Word64& bv) const
+  {
+    assert(!is_null());
+    assert(!bv.is_null());
+    if (d_size != bv.d_size) return -1;
+    return (d_val > bv.d_val) - (d_val < bv.d_val);
+  }
+  /** Signed comparison, -1 if the sizes differ (as BitVector). */
+  int32_t signed_compare(const Word64& bv) const
+  {
+    assert(!is_null());
+    assert(!bv.is_null());
+    if (d_size != bv.d_size) return -1;
+    int64_t a = sval(), b = bv.sval();
+    return (a > b) - (a < b);
+  }
+
+  bool bit(uint64_t idx) const
+  {
+    assert(idx < d_size);
+    return (d_val >> idx) & 1;
+  }
+  void set_bit(uint64_t idx, bool value)
+  {
+    assert(idx < d_size);
+    d_val = (d_val & ~(UINT64_C(1) << idx)) | (uint64_t{value} << idx);
+  }
+  void flip_bit(uint64_t idx)
+  {
+    assert(idx < d_size);
+    d_val ^= UINT64_C(1) << idx;
+  }
+
+  bool lsb() const { return d_val & 1; }
+  bool msb() const { return d_val >> (d_size - 1); }
+
+  bool is_true() const { return d_size == 1 && d_val == 1; }
+  bool is_false() const { return d_size == 1 && d_val == 0; }
+  bool is_zero() const { return d_val == 0; }
+  bool is_ones() const { return d_val == mask(); }
+  bool is_one() const { return d_val == 1; }
+  bool is_min_signed() const { return d_val == UINT64_C(1) << (d_size - 1); }
+  bool is_max_signed() const { return d_val == mask() >> 1; }
+  bool is_power_of_two() const
+  {
+    return (d_val != 0) & ((d_val & (d_val - 1)) == 0);
+  }
+  bool is_uadd_overflow(const Word64& bv) const
+  {
+    assert(d_size == bv.d_size);
+    uint64_t res;
+    bool ovf = __builtin_add_overflow(d_val, bv.d_val, &res);
+    return ovf | ((res & ~mask()) != 0);
+  }
+  bool is_umul_overflow(const Word64& bv) const
+  {
+    assert(d_size == bv.d_size);
+    uint64_t res;
+    bool ovf = __builtin_mul_overflow(d_val, bv.d_val, &res);
+    return ovf | ((res & ~mask()) != 0);
+  }
+
+  uint64_t count_trailing_zeros() const
+  {
+    return d_val ? static_cast<uint64_t>(__builtin_ctzll(d_val)) : d_size;
+  }
+  uint64_t count_leading_zeros() const
+  {
+    return d_val ? static_cast<uint64_t>(__builtin_clzll(d_val))
+                       - (s_max_size - d_size)
+                 : d_size;
+  }
+  uint64_t count_leading_ones() const
+  {
+    return Word64(d_size, ~d_val & mask(), 0).count_leading_zeros();
+  }
+
+  /* ------------------------------------------------------------------------ */
+  /* Bit-vector operations, semantics as for the corresponding BitVector      */
+  /* operations.                                                              */
+  /* ------------------------------------------------------------------------ */
+
+  Word64 bvneg() const { return make(0 - d_val); }
+  Word64 bvnot() const { return make(~d_val); }
+  Word64 bvinc() const { return make(d_val + 1); }
+  Word64 bvdec() const { return make(d_val - 1); }
+  Word64 bvredand() const { return make_bool(d_val == mask()); }
+  Word64 bvredor() const { return make_bool(d_val != 0); }
+
+  Word64 bvadd(const Word64& bv) const { return make(d_val + bv.d_val); }
+  Word64 bvsub(const Word64& bv) const { return make(d_val - bv.d_val); }
+  Word64 bvand(const Word64& bv) const { return make(d_val & bv.d_val); }
+  Word64 bvimplies(const Word64& bv) const
+  {
+    assert(d_size == 1);
+    return make(~d_val | bv.d_val);
+  }
+  Word64 bvnand(const Word64& bv) const { return make(~(d_val & bv.d_val)); }
+  Word64 bvnor(const Word64& bv) const { return make(~(d_val | bv.d_val)); }
+  Word64 bvor(const Word64& bv) const { return make(d_val | bv.d_val); }
+  Word64 bvxnor(const Word64& bv) const { return make(~(d_val ^ bv.d_val)); }
+  Word64 bvxor(const Word64& bv) const { return make(d_val ^ bv.d_val); }
+
+  Word64 bveq(const Word64& bv) const { return make_bool(d_val == bv.d_val); }
+  Word64 bvne(const Word64& bv) const { return make_bool(d_val != bv.d_val); }
+  Word64 bvult(const Word64& bv) const { return make_bool(d_val < bv.d_val); }
+  Word64 bvule(const Word64& bv) const { return make_bool(d_val <= bv.d_val); }
+  Word64 bvugt(const Word64& bv) const { return make_bool(d_val > bv.d_val); }
+  Word64 bvuge(const Word64& bv) const { return make_bool(d_val >= bv.d_val); }
+  Word64 bvslt(const Word64& bv) const { return make_bool(sval() < bv.sval()); }
+  Word64 bvsle(const Word64& bv) const
+  {
+    return make_bool(sval() <= bv.sval());
+  }
+  Word64 bvsgt(const Word64& bv) const { return make_bool(sval() > bv.sval()); }
+  Word64 bvsge(const Word64& bv) const
+  {
+    return make_bool(sval() >= bv.sval());
+  }
+
+  Word64 bvshl(uint64_t shift) const
+  {
+    return make((d_val << (shift & 63)) & (0 - uint64_t{shift < d_size}));
+  }
+  Word64 bvshl(const Word64& bv) const { return bvshl(bv.d_val); }
+  Word64 bvshr(uint64_t shift) const
+  {
+    return make((d_val >> (shift & 63)) & (0 - uint64_t{shift < d_size}));
+  }
+  Word64 bvshr(const Word64& bv) const { return bvshr(bv.d_val); }
+  Word64 bvashr(uint64_t shift) const
+  {
+    // sval() is sign extended to 64 bits, hence shifting by 63 yields the
+    // same result as shifting by any value >= size.
+    return make(static_cast<uint64_t>(sval() >> (shift < 63 ? shift : 63)));
+  }
+  Word64 bvashr(const Word64& bv) const { return bvashr(bv.d_val); }
+
+  Word64 bvmul(const Word64& bv) const { return make(d_val * bv.d_val); }
+  Word64 bvudiv(const Word64& bv) const
+  {
+    return bv.d_val ? make(d_val / bv.d_val) : make(~UINT64_C(0));
+  }
+  Word64 bvurem(const Word64& bv) const
+  {
+    return bv.d_val ? make(d_val % bv.d_val) : *this;
+  }
+  Word64 bvsdiv(const Word64& bv) const;
+  Word64 bvsrem(const Word64& bv) const;
+
+  Word64 bvconcat(const Word64& bv) const
+  {
+    assert(d_size + bv.d_size <= s_max_size);
+    return Word64(d_size + bv.d_size, (d_val << bv.d_size) | bv.d_val, 0);
+  }
+  Word64 bvextract(uint64_t idx_hi, uint64_t idx_lo) const
+  {
+    assert(idx_hi >= idx_lo);
+    assert(idx_hi < d_size);
+    uint64_t size = idx_hi - idx_lo + 1;
+    return Word64(size, (d_val >> idx_lo) & mask(size), 0);
+  }
+  Word64 bvzext(uint64_t n) const
+  {
+    assert(d_size + n <= s_max_size);
+    return Word64(d_size + n, d_val, 0);
+  }
+  Word64 bvsext(uint64_t n) const
+  {
+    assert(d_size + n <= s_max_size);
+    uint64_t size = d_size + n;
+    return Word64(size, static_cast<uint64_t>(sval()) & mask(size), 0);
+  }
+  Word64 bvmodinv() const;
+
+  /**
+   * Compute the unsigned quotient and remainder of this bit-vector divided
+   * by `bv`.
+   */
+  void bvudivurem(const Word64& bv, Word64* quot, Word64* rem) const
+  {
+    *quot = bvudiv(bv);
+    *rem  = bvurem(bv);
+  }
+
+  /* ------------------------------------------------------------------------ */
+  /* In-place versions, operands may alias this bit-vector.                   */
+  /* ------------------------------------------------------------------------ */
+
+  Word64& ibvneg(const Word64& bv) { return *this = bv.bvneg(); }
+  Word64& ibvneg() { return *this = bvneg(); }
+  Word64& ibvnot(const Word64& bv) { return *this = bv.bvnot(); }
+  Word64& ibvnot() { return *this = bvnot(); }
+  Word64& ibvinc(const Word64& bv) { return *this = bv.bvinc(); }
+  Word64& ibvinc() { return *this = bvinc(); }
+  Word64& ibvdec(const Word64& bv) { return *this = bv.bvdec(); }
+  Word64& ibvdec() { return *this = bvdec(); }
+  Word64& ibvredand(const Word64& bv) { return *this = bv.bvredand(); }
+  Word64& ibvredand() { return *this = bvredand(); }
+  Word64& ibvredor(const Word64& bv) { return *this = bv.bvredor(); }
+  Word64& ibvredor() { return *this = bvredor(); }
+
+#define BZLA_WORD64_IBINOP(op)                                \
+  Word64& i##op(const Word64& bv0, const Word64& bv1)        \
+  {                                                           \
+    return *this = bv0.op(bv1);                               \
+  }                                                           \
+  Word64& i##op(const Word64& bv) { return *this = op(bv); }
+
+  BZLA_WORD64_IBINOP(bvadd)
+  BZLA_WORD64_IBINOP(bvsub)
+  BZLA_WORD64_IBINOP(bvand)
+  BZLA_WORD64_IBINOP(bvimplies)
+  BZLA_WORD64_IBINOP(bvnand)
+  BZLA_WORD64_IBINOP(bvnor)
+  BZLA_WORD64_IBINOP(bvor)
+  BZLA_WORD64_IBINOP(bvxnor)
+  BZLA_WORD64_IBINOP(bvxor)
+  BZLA_WORD64_IBINOP(bveq)
+  BZLA_WORD64_IBINOP(bvne)
+  BZLA_WORD64_IBINOP(bvult)
+  BZLA_WORD64_IBINOP(bvule)
+  BZLA_WORD64_IBINOP(bvugt)
+  BZLA_WORD64_IBINOP(bvuge)
+  BZLA_WORD64_IBINOP(bvslt)
+  BZLA_WORD64_IBINOP(bvsle)
+  BZLA_WORD64_IBINOP(bvsgt)
+  BZLA_WORD64_IBINOP(bvsge)
+  BZLA_WORD64_IBINOP(bvshl)
+  BZLA_WORD64_IBINOP(bvshr)
+  BZLA_WORD64_IBINOP(bvashr)
+  BZLA_WORD64_IBINOP(bvmul)
+  BZLA_WORD64_IBINOP(bvudiv)
+  BZLA_WORD64_IBINOP(bvurem)
+  BZLA_WORD64_IBINOP(bvsdiv)
+  BZLA_WORD64_IBINOP(bvsrem)
+  BZLA_WORD64_IBINOP(bvconcat)
+#undef BZLA_WORD64_IBINOP
+
+  Word64& ibvshl(const Word64& bv, uint64_t shift)
+  {
+    return *this = bv.bvshl(shift);
+  }
+  Word64& ibvshl(uint64_t shift) { return *this = bvshl(shift); }
+  Word64& ibvshr(const Word64& bv, uint64_t shift)
+  {
+    return *this = bv.bvshr(shift);
+  }
+  Word64& ibvshr(uint64_t shift) { return *this = bvshr(shift); }
+  Word64& ibvashr(const Word64& bv, uint64_t shift)
+  {
+    return *this = bv.bvashr(shift);
+  }
+  Word64& ibvashr(uint64_t shift) { return *this = bvashr(shift); }
+  Word64& ibvextract(const Word64& bv, uint64_t idx_hi, uint64_t idx_lo)
+  {
+    return *this = bv.bvextract(idx_hi, idx_lo);
+  }
+  Word64& ibvextract(uint64_t idx_hi, uint64_t idx_lo)
+  {
+    return *this = bvextract(idx_hi, idx_lo);
+  }
+  Word64& ibvzext(const Word64& bv, uint64_t n) { return *this = bv.bvzext(n); }
+  Word64& ibvzext(uint64_t n) { return *this = bvzext(n); }
+  Word64& ibvsext(const Word64& bv, uint64_t n) { return *this = bv.bvsext(n); }
+  Word64& ibvsext(uint64_t n) { return *this = bvsext(n); }
+  Word64& ibvite(const Word64& c, const Word64& t, const Word64& e)
+  {
+    return *this = bvite(c, t, e);
+  }
+  Word64& ibvmodinv(const Word64& bv) { return *this = bv.bvmodinv(); }
+  Word64& ibvmodinv() { return *this = bvmodinv(); }
+
+ private:
+  /** @return The mask of the `size` least significant bits, size in [1, 64]. */
+  static uint64_t mask(uint64_t size)
+  {
+    assert(size > 0 && size <= s_max_size);
+    return ~UINT64_C(0) >> (s_max_size - size);
+  }
+
+  /** Construct a bit-vector of given size and value without checks. */
+  Word64(uint64_t size, uint64_t value, int) : d_size(size), d_val(value)
+  {
+    assert(size > 0 && size <= s_max_size);
+    assert((value & ~mask(size)) == 0);
+  }
+
+  /** @return The mask of this bit-vector. */
+  uint64_t mask() const { return mask(d_size); }
+  /** @return The value of this bit-vector, sign extended to 64 bits. */
+  int64_t sval() const
+  {
+    uint64_t shift = s_max_size - d_size;
+    return static_cast<int64_t>(d_val << shift) >> shift;
+  }
+  /** @return A bit-vector of the size of this bit-vector with given value. */
+  Word64 make(uint64_t value) const
+  {
+    return Word64(d_size, value & mask(), 0);
+  }
+  /** @return A bit-vector of size one with given value. */
+  static Word64 make_bool(bool value) { return Word64(1, value, 0); }
+
+  /** The size of this bit-vector, 0 for null bit-vectors. */
+  uint64_t d_size = 0;
+  /** The value of this bit-vector. */
+  uint64_t d_val = 0;
+};
+
+std::ostream& operator<<(std::ostream& out, const Word64& bv);
+
+}  // namespace bzla
+
+namespace std {
+
+/** Hash function. */
+template <>
+struct hash<bzla::Word64>
+{
+  size_t operator()(const bzla::Word64& bv) const { return bv.hash(); }
+};
+
+}  // namespace std
+
+#endif
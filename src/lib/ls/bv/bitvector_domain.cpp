@@ -14,6 +14,11 @@
 #include <cassert>
 #include <iostream>
 
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
+
+#include "bv/word64.h"
 #include "rng/rng.h"
 #include "util/wheel_factorizer.h"
 
@@ -22,19 +27,21 @@ namespace ls {
 
 /*----------------------------------------------------------------------------*/
 
-BitVectorDomain::BitVectorDomain(uint64_t size)
-    : d_lo(BitVector::mk_zero(size)), d_hi(BitVector::mk_ones(size))
+template <class VALUE>
+BvDomain<VALUE>::BvDomain(uint64_t size)
+    : d_lo(VALUE::mk_zero(size)), d_hi(VALUE::mk_ones(size))
 {
 }
 
-BitVectorDomain::BitVectorDomain(const BitVector &lo, const BitVector &hi)
-    : d_lo(lo), d_hi(hi)
+template <class VALUE>
+BvDomain<VALUE>::BvDomain(const VALUE &lo, const VALUE &hi) : d_lo(lo), d_hi(hi)
 {
   assert(lo.size() == hi.size());
   d_has_fixed_bits = !d_lo.is_zero() || !d_hi.is_ones();
 }
 
-BitVectorDomain::BitVectorDomain(const std::string &value)
+template <class VALUE>
+BvDomain<VALUE>::BvDomain(const std::string &value)
 {
   uint64_t size = value.size();
   assert(size > 0);
@@ -42,106 +49,120 @@ BitVectorDomain::BitVectorDomain(const std::string &value)
   std::string hi(value);
   std::replace(lo.begin(), lo.end(), 'x', '0');
   std::replace(hi.begin(), hi.end(), 'x', '1');
-  d_lo             = BitVector(size, lo);
-  d_hi             = BitVector(size, hi);
+  d_lo             = VALUE(size, lo);
+  d_hi             = VALUE(size, hi);
   d_has_fixed_bits = !d_lo.is_zero() || !d_hi.is_ones();
 }
 
-BitVectorDomain::BitVectorDomain(const BitVector &bv) : d_lo(bv), d_hi(bv)
+template <class VALUE>
+BvDomain<VALUE>::BvDomain(const VALUE &bv) : d_lo(bv), d_hi(bv)
 {
   d_has_fixed_bits = true;
 }
 
-BitVectorDomain::BitVectorDomain(uint64_t size, uint64_t value)
-    : BitVectorDomain(BitVector::from_ui(size, value))
+template <class VALUE>
+BvDomain<VALUE>::BvDomain(uint64_t size, uint64_t value)
+    : BvDomain<VALUE>(VALUE::from_ui(size, value))
 {
 }
 
-BitVectorDomain::BitVectorDomain(const BitVectorDomain &other)
+template <class VALUE>
+BvDomain<VALUE>::BvDomain(const BvDomain<VALUE> &other)
     : d_lo(other.d_lo), d_hi(other.d_hi)
 {
   d_has_fixed_bits = other.d_has_fixed_bits;
   assert(d_has_fixed_bits == (!d_lo.is_zero() || !d_hi.is_ones()));
 }
 
-BitVectorDomain::~BitVectorDomain() {}
+template <class VALUE>
+BvDomain<VALUE>::~BvDomain() {}
 
+template <class VALUE>
 uint64_t
-BitVectorDomain::size() const
+BvDomain<VALUE>::size() const
 {
   assert(!is_null());
   assert(d_lo.size() == d_hi.size());
   return d_lo.size();
 }
 
+template <class VALUE>
 bool
-BitVectorDomain::is_valid() const
+BvDomain<VALUE>::is_valid() const
 {
   assert(!is_null());
   return d_lo.bvnot().ibvor(d_hi).is_ones();
 }
 
+template <class VALUE>
 bool
-BitVectorDomain::is_fixed() const
+BvDomain<VALUE>::is_fixed() const
 {
   assert(!is_null());
   return d_lo.compare(d_hi) == 0;
 }
 
+template <class VALUE>
 bool
-BitVectorDomain::has_fixed_bits() const
+BvDomain<VALUE>::has_fixed_bits() const
 {
   assert(!is_null());
   assert(is_valid());
   return d_has_fixed_bits;
 }
 
+template <class VALUE>
 bool
-BitVectorDomain::has_fixed_bits_true() const
+BvDomain<VALUE>::has_fixed_bits_true() const
 {
   assert(!is_null());
   assert(is_valid());
   return d_has_fixed_bits && !d_lo.is_zero();
 }
 
+template <class VALUE>
 bool
-BitVectorDomain::has_fixed_bits_false() const
+BvDomain<VALUE>::has_fixed_bits_false() const
 {
   assert(!is_null());
   assert(is_valid());
   return d_has_fixed_bits && !d_hi.is_ones();
 }
 
+template <class VALUE>
 bool
-BitVectorDomain::has_fixed_bits_true_only() const
+BvDomain<VALUE>::has_fixed_bits_true_only() const
 {
   assert(!is_null());
   assert(is_valid());
   if (!has_fixed_bits_true()) return false;
-  BitVector lo_not = d_lo.bvnot();
+  VALUE lo_not = d_lo.bvnot();
   return lo_not.bvand(d_hi).compare(lo_not) == 0;
 }
 
+template <class VALUE>
 bool
-BitVectorDomain::has_fixed_bits_false_only() const
+BvDomain<VALUE>::has_fixed_bits_false_only() const
 {
   assert(!is_null());
   assert(is_valid());
   if (!has_fixed_bits_false()) return false;
-  BitVector hi_not = d_hi.bvnot();
+  VALUE hi_not = d_hi.bvnot();
   return hi_not.bvor(d_lo).compare(hi_not) == 0;
 }
 
+template <class VALUE>
 bool
-BitVectorDomain::is_fixed_bit(uint64_t idx) const
+BvDomain<VALUE>::is_fixed_bit(uint64_t idx) const
 {
   assert(!is_null());
   assert(idx < size());
   return d_lo.bit(idx) == d_hi.bit(idx);
 }
 
+template <class VALUE>
 bool
-BitVectorDomain::is_fixed_bit_true(uint64_t idx) const
+BvDomain<VALUE>::is_fixed_bit_true(uint64_t idx) const
 {
   assert(!is_null());
   assert(idx < size());
@@ -150,8 +171,9 @@ BitVectorDomain::is_fixed_bit_true(uint64_t idx) const
   return b == d_hi.bit(idx);
 }
 
+template <class VALUE>
 bool
-BitVectorDomain::is_fixed_bit_false(uint64_t idx) const
+BvDomain<VALUE>::is_fixed_bit_false(uint64_t idx) const
 {
   assert(!is_null());
   assert(idx < size());
@@ -160,8 +182,9 @@ BitVectorDomain::is_fixed_bit_false(uint64_t idx) const
   return b == d_hi.bit(idx);
 }
 
+template <class VALUE>
 void
-BitVectorDomain::fix_bit(uint64_t idx, bool value)
+BvDomain<VALUE>::fix_bit(uint64_t idx, bool value)
 {
   assert(!is_null());
   assert(idx < size());
@@ -170,8 +193,9 @@ BitVectorDomain::fix_bit(uint64_t idx, bool value)
   d_has_fixed_bits = true;
 }
 
+template <class VALUE>
 void
-BitVectorDomain::fix(const BitVector &val)
+BvDomain<VALUE>::fix(const VALUE &val)
 {
   assert(!is_null());
   assert(val.size() == size());
@@ -180,22 +204,25 @@ BitVectorDomain::fix(const BitVector &val)
   d_has_fixed_bits = true;
 }
 
+template <class VALUE>
 bool
-BitVectorDomain::match_fixed_bits(const BitVector &bv) const
+BvDomain<VALUE>::match_fixed_bits(const VALUE &bv) const
 {
   assert(!is_null());
   return bv.bvand(d_hi).ibvor(d_lo).compare(bv) == 0;
 }
 
-BitVector
-BitVectorDomain::get_copy_with_fixed_bits(const BitVector &bv) const
+template <class VALUE>
+VALUE
+BvDomain<VALUE>::get_copy_with_fixed_bits(const VALUE &bv) const
 {
   assert(!is_null());
   return bv.bvand(d_hi).ibvor(d_lo);
 }
 
-BitVectorDomain &
-BitVectorDomain::operator=(const BitVectorDomain &other)
+template <class VALUE>
+BvDomain<VALUE> &
+BvDomain<VALUE>::operator=(const BvDomain<VALUE> &other)
 {
   if (&other == this) return *this;
   assert(!other.is_null());
@@ -205,80 +232,89 @@ BitVectorDomain::operator=(const BitVectorDomain &other)
   return *this;
 }
 
+template <class VALUE>
 bool
-BitVectorDomain::operator==(const BitVectorDomain &other) const
+BvDomain<VALUE>::operator==(const BvDomain<VALUE> &other) const
 {
   assert(!is_null());
   assert(!other.is_null());
   return d_lo.compare(other.d_lo) == 0 && d_hi.compare(other.d_hi) == 0;
 }
 
-BitVectorDomain
-BitVectorDomain::bvnot() const
+template <class VALUE>
+BvDomain<VALUE>
+BvDomain<VALUE>::bvnot() const
 {
   assert(!is_null());
-  return BitVectorDomain(d_hi.bvnot(), d_lo.bvnot());
+  return BvDomain<VALUE>(d_hi.bvnot(), d_lo.bvnot());
 }
 
-BitVectorDomain
-BitVectorDomain::bvshl(const BitVector &shift) const
+template <class VALUE>
+BvDomain<VALUE>
+BvDomain<VALUE>::bvshl(const VALUE &shift) const
 {
   assert(!is_null());
   assert(shift.size() == size());
-  return BitVectorDomain(d_lo.bvshl(shift), d_hi.bvshl(shift));
+  return BvDomain<VALUE>(d_lo.bvshl(shift), d_hi.bvshl(shift));
 }
 
-BitVectorDomain
-BitVectorDomain::bvshr(const BitVector &shift) const
+template <class VALUE>
+BvDomain<VALUE>
+BvDomain<VALUE>::bvshr(const VALUE &shift) const
 {
   assert(!is_null());
   assert(shift.size() == size());
-  return BitVectorDomain(d_lo.bvshr(shift), d_hi.bvshr(shift));
+  return BvDomain<VALUE>(d_lo.bvshr(shift), d_hi.bvshr(shift));
 }
 
-BitVectorDomain
-BitVectorDomain::bvashr(const BitVector &shift) const
+template <class VALUE>
+BvDomain<VALUE>
+BvDomain<VALUE>::bvashr(const VALUE &shift) const
 {
   assert(!is_null());
   assert(shift.size() == size());
-  return BitVectorDomain(d_lo.bvashr(shift), d_hi.bvashr(shift));
+  return BvDomain<VALUE>(d_lo.bvashr(shift), d_hi.bvashr(shift));
 }
 
-BitVectorDomain
-BitVectorDomain::bvconcat(const BitVector &bv) const
+template <class VALUE>
+BvDomain<VALUE>
+BvDomain<VALUE>::bvconcat(const VALUE &bv) const
 {
   assert(!is_null());
-  return BitVectorDomain(d_lo.bvconcat(bv), d_hi.bvconcat(bv));
+  return BvDomain<VALUE>(d_lo.bvconcat(bv), d_hi.bvconcat(bv));
 }
 
-BitVectorDomain
-BitVectorDomain::bvconcat(const BitVectorDomain &d) const
+template <class VALUE>
+BvDomain<VALUE>
+BvDomain<VALUE>::bvconcat(const BvDomain<VALUE> &d) const
 {
   assert(!is_null());
-  return BitVectorDomain(d_lo.bvconcat(d.lo()), d_hi.bvconcat(d.hi()));
+  return BvDomain<VALUE>(d_lo.bvconcat(d.lo()), d_hi.bvconcat(d.hi()));
 }
 
-BitVectorDomain
-BitVectorDomain::bvextract(uint64_t idx_hi, uint64_t idx_lo) const
+template <class VALUE>
+BvDomain<VALUE>
+BvDomain<VALUE>::bvextract(uint64_t idx_hi, uint64_t idx_lo) const
 {
   assert(!is_null());
   assert(idx_hi >= idx_lo);
-  return BitVectorDomain(d_lo.bvextract(idx_hi, idx_lo),
+  return BvDomain<VALUE>(d_lo.bvextract(idx_hi, idx_lo),
                          d_hi.bvextract(idx_hi, idx_lo));
 }
 
-BitVector
-BitVectorDomain::get_factor(RNG *rng,
-                            const BitVector &num,
-                            const BitVector &excl_min,
+template <class VALUE>
+VALUE
+BvDomain<VALUE>::get_factor(RNG *rng,
+                            const VALUE &num,
+                            const VALUE &excl_min,
                             uint64_t limit) const
 {
-  WheelFactorizer wf(num, limit);
-  std::vector<BitVector> factors;
+  WheelFactorizer<VALUE> wf(num, limit);
+  std::vector<VALUE> factors;
 
   while (true)
   {
-    const BitVector *fact = wf.next();
+    const VALUE *fact = wf.next();
     if (!fact) break;
     factors.emplace_back(*fact);
     if (rng == nullptr) break;
@@ -299,7 +335,7 @@ BitVectorDomain::get_factor(RNG *rng,
         /* Move selected factors to front of the stack and combine.
          * This ensures that we don't pick a factor twice, e.g., 2 2 3 can be
          * combined into { 2, 3, 2*2, 2*3, 2*2*3 }. */
-        BitVector mul(num.size());
+        VALUE mul(num.size());
         for (size_t i = 0; i < n; ++i)
         {
           size_t j = rng->pick<size_t>(i, n_factors - 1);
@@ -310,7 +346,7 @@ BitVectorDomain::get_factor(RNG *rng,
           if (!mul.is_zero())
           {
             assert(!factors[i].is_umul_overflow(mul));
-            BitVector tmp = factors[i].bvmul(mul);
+            VALUE tmp = factors[i].bvmul(mul);
             if (tmp.compare(num) > 0)
             {
               continue;
@@ -335,11 +371,12 @@ BitVectorDomain::get_factor(RNG *rng,
       return factors[0];
     }
   }
-  return BitVector();
+  return VALUE();
 }
 
+template <class VALUE>
 std::string
-BitVectorDomain::str() const
+BvDomain<VALUE>::str() const
 {
   assert(!is_null());
   std::string res(d_lo.str());
@@ -364,45 +401,80 @@ BitVectorDomain::str() const
 
 /*----------------------------------------------------------------------------*/
 
-BitVectorDomainGenerator::BitVectorDomainGenerator(
-    const BitVectorDomain &domain)
-    : BitVectorDomainGenerator(domain, nullptr, domain.d_lo, domain.d_hi)
+namespace {
+
+/**
+ * Deposit the least significant bits of `bits` at the positions of the set
+ * bits in `mask`, starting from the least significant bit (parallel bit
+ * deposit).
+ */
+uint64_t
+uint64_deposit(uint64_t bits, uint64_t mask)
+{
+#ifdef __BMI2__
+  return _pdep_u64(bits, mask);
+#else
+  uint64_t res = 0;
+  for (; mask; mask &= mask - 1, bits >>= 1)
+  {
+    res |= mask & (~mask + 1) & (~(bits & 1) + 1);
+  }
+  return res;
+#endif
+}
+
+}  // namespace
+
+template <class VALUE>
+BvDomainGenerator<VALUE>::BvDomainGenerator(const BvDomain<VALUE> &domain)
+    : BvDomainGenerator<VALUE>(domain, nullptr, domain.d_lo, domain.d_hi)
 {
 }
 
-BitVectorDomainGenerator::BitVectorDomainGenerator(
-    const BitVectorDomain &domain, const BitVector &min, const BitVector &max)
-    : BitVectorDomainGenerator(domain, nullptr, min, max)
+template <class VALUE>
+BvDomainGenerator<VALUE>::BvDomainGenerator(const BvDomain<VALUE> &domain,
+                                            const VALUE &min,
+                                            const VALUE &max)
+    : BvDomainGenerator<VALUE>(domain, nullptr, min, max)
 {
 }
 
-BitVectorDomainGenerator::BitVectorDomainGenerator(
-    const BitVectorDomain &domain, RNG *rng)
-    : BitVectorDomainGenerator(domain, rng, domain.d_lo, domain.d_hi)
+template <class VALUE>
+BvDomainGenerator<VALUE>::BvDomainGenerator(const BvDomain<VALUE> &domain,
+                                            RNG *rng)
+    : BvDomainGenerator<VALUE>(domain, rng, domain.d_lo, domain.d_hi)
 {
 }
 
-BitVectorDomainGenerator::BitVectorDomainGenerator(
-    const BitVectorDomain &domain,
-    RNG *rng,
-    const BitVector &min,
-    const BitVector &max)
+template <class VALUE>
+BvDomainGenerator<VALUE>::BvDomainGenerator(const BvDomain<VALUE> &domain,
+                                            RNG *rng,
+                                            const VALUE &min,
+                                            const VALUE &max)
     : d_domain(domain), d_rng(rng)
 {
-  uint64_t cnt          = 0;
-  uint64_t size         = domain.size();
-  const BitVector &hi   = d_domain.d_hi;
-  const BitVector &lo   = d_domain.d_lo;
-  const BitVector &mmin = lo.compare(min) <= 0 ? min : lo;
-  const BitVector &mmax = hi.compare(max) >= 0 ? max : hi;
+  uint64_t cnt      = 0;
+  uint64_t size     = domain.size();
+  const VALUE &hi   = d_domain.d_hi;
+  const VALUE &lo   = d_domain.d_lo;
+  const VALUE &mmin = lo.compare(min) <= 0 ? min : lo;
+  const VALUE &mmax = hi.compare(max) >= 0 ? max : hi;
 
   d_bits.reset(nullptr);
   d_bits_min.reset(nullptr);
   d_bits_max.reset(nullptr);
 
-  for (size_t i = 0; i < size; ++i)
+  if (size <= 64)
   {
-    if (!d_domain.is_fixed_bit(i)) cnt += 1;
+    d_mask = lo.to_uint64() ^ hi.to_uint64();
+    cnt    = static_cast<uint64_t>(__builtin_popcountll(d_mask));
+  }
+  else
+  {
+    for (size_t i = 0; i < size; ++i)
+    {
+      if (!d_domain.is_fixed_bit(i)) cnt += 1;
+    }
   }
 
   if (cnt && mmin.compare(hi) <= 0 && mmax.compare(lo) >= 0)
@@ -412,7 +484,7 @@ BitVectorDomainGenerator::BitVectorDomainGenerator(
 
     /* Set unconstrained bits to the minimum value that corresponds to a
      * generated value >= mmin. */
-    d_bits_min.reset(new BitVector(BitVector::mk_zero(cnt)));
+    d_bits_min.reset(new VALUE(VALUE::mk_zero(cnt)));
     for (uint64_t i = 0, j = 0, j0 = 0; i < size; ++i)
     {
       uint64_t idx_i = size - 1 - i;
@@ -443,7 +515,7 @@ BitVectorDomainGenerator::BitVectorDomainGenerator(
 
     /* Set unconstrained bits to the maximum value that corresponds to a
      * generated value <= mmax. */
-    d_bits_max.reset(new BitVector(BitVector::mk_ones(cnt)));
+    d_bits_max.reset(new VALUE(VALUE::mk_ones(cnt)));
     for (uint64_t i = 0, j = 0, j0 = 0; i < size; ++i)
     {
       uint64_t idx_i = size - 1 - i;
@@ -475,7 +547,7 @@ BitVectorDomainGenerator::BitVectorDomainGenerator(
     /* If bits_min > bits_max, we can't generate any value. */
     if (d_bits_min->compare(*d_bits_max) <= 0)
     {
-      d_bits.reset(new BitVector(*d_bits_min));
+      d_bits.reset(new VALUE(*d_bits_min));
     }
   }
 #ifndef NDEBUG
@@ -484,18 +556,21 @@ BitVectorDomainGenerator::BitVectorDomainGenerator(
 #endif
 }
 
-BitVectorDomainGenerator::~BitVectorDomainGenerator() {}
+template <class VALUE>
+BvDomainGenerator<VALUE>::~BvDomainGenerator() {}
 
+template <class VALUE>
 bool
-BitVectorDomainGenerator::has_next() const
+BvDomainGenerator<VALUE>::has_next() const
 {
   assert(d_bits == nullptr
          || (d_bits_min && d_bits->compare(*d_bits_min) >= 0));
   return d_bits && d_bits->compare(*d_bits_max) <= 0;
 }
 
+template <class VALUE>
 bool
-BitVectorDomainGenerator::has_random() const
+BvDomainGenerator<VALUE>::has_random() const
 {
   assert(d_bits == nullptr
          || (d_bits_min && d_bits_min->compare(*d_bits_min) >= 0));
@@ -503,27 +578,29 @@ BitVectorDomainGenerator::has_random() const
   return d_bits_min && d_bits_min->compare(*d_bits_max) <= 0;
 }
 
-BitVector
-BitVectorDomainGenerator::next()
+template <class VALUE>
+VALUE
+BvDomainGenerator<VALUE>::next()
 {
   assert(has_next());
   return generate_next(false);
 }
 
-BitVector
-BitVectorDomainGenerator::random()
+template <class VALUE>
+VALUE
+BvDomainGenerator<VALUE>::random()
 {
   assert(has_random());
   return generate_next(true);
 }
 
-BitVector
-BitVectorDomainGenerator::generate_next(bool random)
+template <class VALUE>
+VALUE
+BvDomainGenerator<VALUE>::generate_next(bool random)
 {
   assert(random || d_bits);
 
   uint64_t size = d_domain.size();
-  BitVector res(d_domain.d_lo);
 
   /* Random always resets d_bits to a random value between d_bits_min and
    * d_bits_max. */
@@ -532,16 +609,26 @@ BitVectorDomainGenerator::generate_next(bool random)
     assert(d_rng);
     assert(d_bits_min);
     assert(d_bits_max);
-    if (d_bits == nullptr) d_bits.reset(new BitVector(d_bits_min->size()));
+    if (d_bits == nullptr) d_bits.reset(new VALUE(d_bits_min->size()));
     assert(d_bits->size() == d_bits_min->size());
     d_bits->iset(*d_rng, *d_bits_min, *d_bits_max, false);
   }
 
-  for (uint64_t i = 0, j = 0; i < size; ++i)
+  VALUE res;
+  if (size <= 64)
   {
-    if (!d_domain.is_fixed_bit(i))
+    uint64_t bits = uint64_deposit(d_bits->to_uint64(), d_mask);
+    res           = VALUE::from_ui(size, d_domain.d_lo.to_uint64() | bits);
+  }
+  else
+  {
+    res = d_domain.d_lo;
+    for (uint64_t i = 0, j = 0; i < size; ++i)
     {
-      res.set_bit(i, d_bits->bit(j++));
+      if (!d_domain.is_fixed_bit(i))
+      {
+        res.set_bit(i, d_bits->bit(j++));
+      }
     }
   }
 
@@ -573,59 +660,63 @@ BitVectorDomainGenerator::generate_next(bool random)
   return res;
 }
 
-BitVectorDomainDualGenerator::BitVectorDomainDualGenerator(
-    const BitVectorDomain &domain,
-    const BitVector *min_lo,
-    const BitVector *max_lo,
-    const BitVector *min_hi,
-    const BitVector *max_hi)
-    : BitVectorDomainDualGenerator(
+template <class VALUE>
+BvDomainDualGenerator<VALUE>::BvDomainDualGenerator(
+    const BvDomain<VALUE> &domain,
+    const VALUE *min_lo,
+    const VALUE *max_lo,
+    const VALUE *min_hi,
+    const VALUE *max_hi)
+    : BvDomainDualGenerator<VALUE>(
         domain, nullptr, min_lo, max_lo, min_hi, max_hi)
 {
 }
 
-BitVectorDomainDualGenerator::BitVectorDomainDualGenerator(
-    const BitVectorDomain &domain,
+template <class VALUE>
+BvDomainDualGenerator<VALUE>::BvDomainDualGenerator(
+    const BvDomain<VALUE> &domain,
     RNG *rng,
-    const BitVector *min_lo,
-    const BitVector *max_lo,
-    const BitVector *min_hi,
-    const BitVector *max_hi)
+    const VALUE *min_lo,
+    const VALUE *max_lo,
+    const VALUE *min_hi,
+    const VALUE *max_hi)
     : d_rng(rng)
 {
   assert(!max_lo || !min_lo || max_lo->compare(*min_lo) >= 0);
   assert(!max_hi || !min_hi || max_hi->compare(*min_hi) >= 0);
   uint64_t size = domain.size();
-  assert(!max_lo || max_lo->compare(BitVector::mk_max_signed(size)) <= 0);
-  assert(!min_hi || min_hi->compare(BitVector::mk_min_signed(size)) >= 0);
+  assert(!max_lo || max_lo->compare(VALUE::mk_max_signed(size)) <= 0);
+  assert(!min_hi || min_hi->compare(VALUE::mk_min_signed(size)) >= 0);
 
   d_gen_lo.reset(nullptr);
   d_gen_hi.reset(nullptr);
 
   if (min_lo || max_lo)
   {
-    d_gen_lo.reset(new BitVectorDomainGenerator(
+    d_gen_lo.reset(new BvDomainGenerator<VALUE>(
         domain,
         rng,
-        min_lo ? *min_lo : BitVector::mk_zero(size),
-        max_lo ? *max_lo : BitVector::mk_max_signed(size)));
+        min_lo ? *min_lo : VALUE::mk_zero(size),
+        max_lo ? *max_lo : VALUE::mk_max_signed(size)));
     d_gen_cur = d_gen_lo.get();
   }
   if (min_hi || max_hi)
   {
-    d_gen_hi.reset(new BitVectorDomainGenerator(
+    d_gen_hi.reset(new BvDomainGenerator<VALUE>(
         domain,
         rng,
-        min_hi ? *min_hi : BitVector::mk_min_signed(size),
-        max_hi ? *max_hi : BitVector::mk_ones(size)));
+        min_hi ? *min_hi : VALUE::mk_min_signed(size),
+        max_hi ? *max_hi : VALUE::mk_ones(size)));
     if (d_gen_cur == nullptr) d_gen_cur = d_gen_hi.get();
   }
 }
 
-BitVectorDomainDualGenerator::~BitVectorDomainDualGenerator() {}
+template <class VALUE>
+BvDomainDualGenerator<VALUE>::~BvDomainDualGenerator() {}
 
+template <class VALUE>
 bool
-BitVectorDomainDualGenerator::has_next()
+BvDomainDualGenerator<VALUE>::has_next()
 {
   if (d_gen_cur == nullptr) return false;
   if (!d_gen_cur->has_next())
@@ -640,8 +731,9 @@ BitVectorDomainDualGenerator::has_next()
   return true;
 }
 
+template <class VALUE>
 bool
-BitVectorDomainDualGenerator::has_random()
+BvDomainDualGenerator<VALUE>::has_random()
 {
   if (d_gen_cur == nullptr) return false;
   if (!d_gen_cur->has_random())
@@ -656,15 +748,17 @@ BitVectorDomainDualGenerator::has_random()
   return true;
 }
 
-BitVector
-BitVectorDomainDualGenerator::next()
+template <class VALUE>
+VALUE
+BvDomainDualGenerator<VALUE>::next()
 {
   assert(has_next());
   return d_gen_cur->next();
 }
 
-BitVector
-BitVectorDomainDualGenerator::random()
+template <class VALUE>
+VALUE
+BvDomainDualGenerator<VALUE>::random()
 {
   bool has_random_lo = d_gen_lo ? d_gen_lo->has_random() : false;
   bool has_random_hi = d_gen_hi ? d_gen_hi->has_random() : false;
@@ -680,40 +774,44 @@ BitVectorDomainDualGenerator::random()
   return d_gen_hi->random();
 }
 
-BitVectorDomainSignedGenerator::BitVectorDomainSignedGenerator(
-    const BitVectorDomain &domain)
-    : BitVectorDomainSignedGenerator(domain,
+template <class VALUE>
+BvDomainSignedGenerator<VALUE>::BvDomainSignedGenerator(
+    const BvDomain<VALUE> &domain)
+    : BvDomainSignedGenerator<VALUE>(domain,
                                      nullptr,
-                                     BitVector::mk_min_signed(domain.size()),
-                                     BitVector::mk_max_signed(domain.size()))
+                                     VALUE::mk_min_signed(domain.size()),
+                                     VALUE::mk_max_signed(domain.size()))
 {
 }
 
-BitVectorDomainSignedGenerator::BitVectorDomainSignedGenerator(
-    const BitVectorDomain &domain, const BitVector &min, const BitVector &max)
-    : BitVectorDomainSignedGenerator(domain, nullptr, min, max)
+template <class VALUE>
+BvDomainSignedGenerator<VALUE>::BvDomainSignedGenerator(
+    const BvDomain<VALUE> &domain, const VALUE &min, const VALUE &max)
+    : BvDomainSignedGenerator<VALUE>(domain, nullptr, min, max)
 {
 }
 
-BitVectorDomainSignedGenerator::BitVectorDomainSignedGenerator(
-    const BitVectorDomain &domain, RNG *rng)
-    : BitVectorDomainSignedGenerator(domain,
+template <class VALUE>
+BvDomainSignedGenerator<VALUE>::BvDomainSignedGenerator(
+    const BvDomain<VALUE> &domain, RNG *rng)
+    : BvDomainSignedGenerator<VALUE>(domain,
                                      rng,
-                                     BitVector::mk_min_signed(domain.size()),
-                                     BitVector::mk_max_signed(domain.size()))
+                                     VALUE::mk_min_signed(domain.size()),
+                                     VALUE::mk_max_signed(domain.size()))
 {
 }
 
-BitVectorDomainSignedGenerator::BitVectorDomainSignedGenerator(
-    const BitVectorDomain &domain,
+template <class VALUE>
+BvDomainSignedGenerator<VALUE>::BvDomainSignedGenerator(
+    const BvDomain<VALUE> &domain,
     RNG *rng,
-    const BitVector &min,
-    const BitVector &max)
+    const VALUE &min,
+    const VALUE &max)
     : d_rng(rng)
 {
   uint64_t size          = domain.size();
-  BitVector zero         = BitVector::mk_zero(size);
-  BitVector ones         = BitVector::mk_ones(size);
+  VALUE zero             = VALUE::mk_zero(size);
+  VALUE ones             = VALUE::mk_ones(size);
   int32_t min_scomp_zero = min.signed_compare(zero);
   int32_t max_scomp_zero = max.signed_compare(zero);
 
@@ -722,22 +820,24 @@ BitVectorDomainSignedGenerator::BitVectorDomainSignedGenerator(
 
   if (min_scomp_zero < 0)
   {
-    d_gen_lo.reset(new BitVectorDomainGenerator(
+    d_gen_lo.reset(new BvDomainGenerator<VALUE>(
         domain, rng, min, max_scomp_zero < 0 ? max : ones));
     d_gen_cur = d_gen_lo.get();
   }
   if (max_scomp_zero >= 0)
   {
-    d_gen_hi.reset(new BitVectorDomainGenerator(
+    d_gen_hi.reset(new BvDomainGenerator<VALUE>(
         domain, rng, min_scomp_zero >= 0 ? min : zero, max));
     if (d_gen_cur == nullptr) d_gen_cur = d_gen_hi.get();
   }
 }
 
-BitVectorDomainSignedGenerator::~BitVectorDomainSignedGenerator() {}
+template <class VALUE>
+BvDomainSignedGenerator<VALUE>::~BvDomainSignedGenerator() {}
 
+template <class VALUE>
 bool
-BitVectorDomainSignedGenerator::has_next()
+BvDomainSignedGenerator<VALUE>::has_next()
 {
   if (d_gen_cur == nullptr) return false;
   if (!d_gen_cur->has_next())
@@ -752,8 +852,9 @@ BitVectorDomainSignedGenerator::has_next()
   return true;
 }
 
+template <class VALUE>
 bool
-BitVectorDomainSignedGenerator::has_random()
+BvDomainSignedGenerator<VALUE>::has_random()
 {
   if (d_gen_cur == nullptr) return false;
   if (!d_gen_cur->has_random())
@@ -768,15 +869,17 @@ BitVectorDomainSignedGenerator::has_random()
   return true;
 }
 
-BitVector
-BitVectorDomainSignedGenerator::next()
+template <class VALUE>
+VALUE
+BvDomainSignedGenerator<VALUE>::next()
 {
   assert(has_next());
   return d_gen_cur->next();
 }
 
-BitVector
-BitVectorDomainSignedGenerator::random()
+template <class VALUE>
+VALUE
+BvDomainSignedGenerator<VALUE>::random()
 {
   bool has_random_lo = d_gen_lo ? d_gen_lo->has_random() : false;
   bool has_random_hi = d_gen_hi ? d_gen_hi->has_random() : false;
@@ -792,12 +895,28 @@ BitVectorDomainSignedGenerator::random()
   return d_gen_hi->random();
 }
 
+template <class VALUE>
 std::ostream &
-operator<<(std::ostream &out, const BitVectorDomain &d)
+operator<<(std::ostream &out, const BvDomain<VALUE> &d)
 {
   out << d.str();
   return out;
 }
 
+/*----------------------------------------------------------------------------*/
+
+template class BvDomain<BitVector>;
+template class BvDomain<Word64>;
+template class BvDomainGenerator<BitVector>;
+template class BvDomainGenerator<Word64>;
+template class BvDomainDualGenerator<BitVector>;
+template class BvDomainDualGenerator<Word64>;
+template class BvDomainSignedGenerator<BitVector>;
+template class BvDomainSignedGenerator<Word64>;
+
+template std::ostream &operator<<(std::ostream &out,
+                                  const BvDomain<BitVector> &d);
+template std::ostream &operator<<(std::ostream &out, const BvDomain<Word64> &d);
+
 }  // namespace ls
 }  // namespace bzla
@@ -16,13 +16,20 @@
 namespace bzla {
 namespace ls {
 
-class BitVectorDomainGenerator;
+template <class VALUE>
+class BvDomainGenerator;
 
 /*----------------------------------------------------------------------------*/
 
-class BitVectorDomain
+/**
+ * A bit-vector domain, represented by a lower and an upper bound.
+ * VALUE is the bit-vector value type, BitVector or Word64 (for domains of
+ * size <= 64).
+ */
+template <class VALUE>
+class BvDomain
 {
-  friend BitVectorDomainGenerator;
+  friend BvDomainGenerator<VALUE>;
 
  public:
   /**
@@ -30,21 +37,21 @@ class BitVectorDomain
    * @note Creates null (uninitialized) domain. Only to be used for
    * pre-declaration.
    */
-  BitVectorDomain() {}
+  BvDomain() {}
   /** Construct a bit-vector domain of given size. */
-  BitVectorDomain(uint64_t size);
+  BvDomain(uint64_t size);
   /** Construct a bit-vector domain ranging from 'lo' to 'hi'. */
-  BitVectorDomain(const BitVector &lo, const BitVector &hi);
+  BvDomain(const VALUE &lo, const VALUE &hi);
   /** Construct a bit-vector domain from a 3-valued string representation. */
-  BitVectorDomain(const std::string &value);
+  BvDomain(const std::string &value);
   /** Construct a fixed bit-vector domain with lo = 'bv' and hi = 'bv'. */
-  BitVectorDomain(const BitVector &bv);
+  BvDomain(const VALUE &bv);
   /** Construct a fixed bit-vector domain of given size from a uint value. */
-  BitVectorDomain(uint64_t size, uint64_t value);
+  BvDomain(uint64_t size, uint64_t value);
   /** Copy constructor. */
-  BitVectorDomain(const BitVectorDomain &other);
+  BvDomain(const BvDomain<VALUE> &other);
   /** Destructor. */
-  ~BitVectorDomain();
+  ~BvDomain();
 
   /**
    * Determine if this domain is an uninitialized domain.
@@ -62,12 +69,12 @@ class BitVectorDomain
    * Get the lower bound of this domain.
    * @return The lower bound of this domain.
    */
-  const BitVector &lo() const { return d_lo; }
+  const VALUE &lo() const { return d_lo; }
   /**
    * Get the upper bound of this domain.
    * @return The upper bound of this domain.
    */
-  const BitVector &hi() const { return d_hi; }
+  const VALUE &hi() const { return d_hi; }
 
   /**
    * Determine if this bit-vector domain is valid, i.e., `~lo | hi == ones`.
@@ -141,7 +148,7 @@ class BitVectorDomain
    * Fix domain to given value.
    * @param val The value this domain is to be fixed to.
    */
-  void fix(const BitVector &val);
+  void fix(const VALUE &val);
 
   /**
    * Determine if the fixed bits of this bit-vector domain are consistent with
@@ -150,7 +157,7 @@ class BitVectorDomain
    * @param bv The bit-vector to check for consistency against.
    * @return True if the fixed bits of this domain are consistent with `bv`.
    */
-  bool match_fixed_bits(const BitVector &bv) const;
+  bool match_fixed_bits(const VALUE &bv) const;
 
   /**
    * Return a copy of the given bit-vector with all bits that are fixed in
@@ -160,18 +167,18 @@ class BitVectorDomain
    * @return A copy of the given bit-vector, except that all fixed bits of this
    *         domain are set to their fixed value.
    */
-  BitVector get_copy_with_fixed_bits(const BitVector &bv) const;
+  VALUE get_copy_with_fixed_bits(const VALUE &bv) const;
 
   /** Copy assignment operator. */
-  BitVectorDomain &operator=(const BitVectorDomain &other);
+  BvDomain<VALUE> &operator=(const BvDomain<VALUE> &other);
   /** Equality comparison operator. */
-  bool operator==(const BitVectorDomain &other) const;
+  bool operator==(const BvDomain<VALUE> &other) const;
 
   /**
    * Create a bit-vector domain that represents a bit-wise not of this domain.
    * @return A domain representing the bit-wise not of this domain.
    */
-  BitVectorDomain bvnot() const;
+  BvDomain<VALUE> bvnot() const;
   /**
    * Create a bit-vector domain that represents a logial left shift of this
    * domain by the shift value represented as bit-vector `bv`.
@@ -179,7 +186,7 @@ class BitVectorDomain
    * @return A domain representing the logical left shift by `bv` of this
    *         domain.
    */
-  BitVectorDomain bvshl(const BitVector &shift) const;
+  BvDomain<VALUE> bvshl(const VALUE &shift) const;
   /**
    * Create a bit-vector domain that represents a logial right shift of this
    * domain by the shift value represented as bit-vector `bv`.
@@ -187,7 +194,7 @@ class BitVectorDomain
    * @return A domain representing the logical right shift by `bv` of this
    *         domain.
    */
-  BitVectorDomain bvshr(const BitVector &shift) const;
+  BvDomain<VALUE> bvshr(const VALUE &shift) const;
   /**
    * Create a bit-vector domain that represents an arithmetic right shift of
    * this domain by the shift value represented as bit-vector `bv`.
@@ -195,21 +202,21 @@ class BitVectorDomain
    * @return A domain representing the arithmetic right shift by `bv` of this
    *         domain.
    */
-  BitVectorDomain bvashr(const BitVector &shift) const;
+  BvDomain<VALUE> bvashr(const VALUE &shift) const;
   /**
    * Create a bit-vector domain that represents a concatenation of this domain
    * with bit-vector `bv`.
    * @param bv The bit-vector to concatenate this domain with.
    * @return A domain representing a concatenation of this domain with `bv`.
    */
-  BitVectorDomain bvconcat(const BitVector &bv) const;
+  BvDomain<VALUE> bvconcat(const VALUE &bv) const;
   /**
    * Create a bit-vector domain that represents a concatenation of this domain
    * with domain `d`.
    * @param d The bit-vector domain to concatenate this domain with.
    * @return A domain representing a concatenation of this domain with `d`.
    */
-  BitVectorDomain bvconcat(const BitVectorDomain &d) const;
+  BvDomain<VALUE> bvconcat(const BvDomain<VALUE> &d) const;
 
   /**
    * Extract a bit range from this bit-vector domain.
@@ -217,7 +224,7 @@ class BitVectorDomain
    * @param idx_lo The lower bit-index of the range (inclusive).
    * @return A domain representing the given bit range of this domain.
    */
-  BitVectorDomain bvextract(uint64_t idx_hi, uint64_t idx_lo) const;
+  BvDomain<VALUE> bvextract(uint64_t idx_hi, uint64_t idx_lo) const;
 
   /**
    * Determine a random factor of `num > t`.
@@ -228,10 +235,10 @@ class BitVectorDomain
    * @return A null bit-vector if no such factor exists, or if computation
    *         exceeds `limit` iterations in the wheel factorizer.
    */
-  BitVector get_factor(RNG *rng,
-                       const BitVector &num,
-                       const BitVector &excl_min,
-                       uint64_t limit) const;
+  VALUE get_factor(RNG *rng,
+                   const VALUE &num,
+                   const VALUE &excl_min,
+                   uint64_t limit) const;
 
   /**
    * Get a string representation of this bit-vector domain.
@@ -246,22 +253,24 @@ class BitVectorDomain
    * Bits that are not fixed are set to 0. If a bit is `1` in `lo` and `0` in
    * `hi`, the domain is invalid.
    */
-  BitVector d_lo;
+  VALUE d_lo;
   /**
    * The upper bound of this bit-vector domain.
    * Bits that are not fixed are set to 1. If a bit is `1` in `lo` and `0` in
    * `hi`, the domain is invalid.
    */
-  BitVector d_hi;
+  VALUE d_hi;
   /** True if this domain has fixed bits. */
   bool d_has_fixed_bits = false;
 };
 
-std::ostream &operator<<(std::ostream &out, const BitVectorDomain &d);
+template <class VALUE>
+std::ostream &operator<<(std::ostream &out, const BvDomain<VALUE> &d);
 
 /*----------------------------------------------------------------------------*/
 
-class BitVectorDomainGenerator
+template <class VALUE>
+class BvDomainGenerator
 {
  public:
   /**
@@ -269,7 +278,7 @@ class BitVectorDomainGenerator
    * bit-vector domain, interpreted as unsigned.
    * @param domain The domain to enumerate values for.
    */
-  BitVectorDomainGenerator(const BitVectorDomain &domain);
+  BvDomainGenerator(const BvDomain<VALUE> &domain);
   /**
    * Construct generator for values within given range (inclusive),
    * interpreted as unsigned.
@@ -277,16 +286,16 @@ class BitVectorDomainGenerator
    * @param min    The minimum value to start enumeration with.
    * @param max    The maximum value to enumerate until.
    */
-  BitVectorDomainGenerator(const BitVectorDomain &domain,
-                           const BitVector &min,
-                           const BitVector &max);
+  BvDomainGenerator(const BvDomain<VALUE> &domain,
+                    const VALUE &min,
+                    const VALUE &max);
   /**
    * Construct generator for values within the range defined by the given
    * bit-vector domain, interpreted as unsigned.
    * @param domain The domain to enumerate values for.
    * @param rng    The associated random number generator.
    */
-  BitVectorDomainGenerator(const BitVectorDomain &domain, RNG *rng);
+  BvDomainGenerator(const BvDomain<VALUE> &domain, RNG *rng);
   /**
    * Construct generator for values within given range (inclusive),
    * interpreted as unsigned.
@@ -295,12 +304,12 @@ class BitVectorDomainGenerator
    * @param min    The minimum value to start enumeration with.
    * @param max    The maximum value to enumerate until.
    */
-  BitVectorDomainGenerator(const BitVectorDomain &domain,
-                           RNG *rng,
-                           const BitVector &min,
-                           const BitVector &max);
+  BvDomainGenerator(const BvDomain<VALUE> &domain,
+                    RNG *rng,
+                    const VALUE &min,
+                    const VALUE &max);
   /** Destructor. */
-  ~BitVectorDomainGenerator();
+  ~BvDomainGenerator();
 
   /**
    * Determine if there is a next element in the sequence.
@@ -316,37 +325,40 @@ class BitVectorDomainGenerator
    * Generate next element in the sequence.
    * @return The next element in the sequence.
    */
-  BitVector next();
+  VALUE next();
   /**
    * Generate random element in the sequence.
    * @return A random element in the sequence.
    */
-  BitVector random();
+  VALUE random();
 
  private:
   /**
    * Helper for next() and random().
    * @param random True to generate a random value, else get the next value.
    */
-  BitVector generate_next(bool random);
+  VALUE generate_next(bool random);
   /* The domain to enumerate values for. */
-  BitVectorDomain d_domain;
+  BvDomain<VALUE> d_domain;
   /* The associated RNG (may be 0). */
   RNG *d_rng = nullptr;
 #ifndef NDEBUG
   /* We only need to cache these for debugging purposes. */
-  BitVector d_min; /* the min value (in case of ranged init) */
-  BitVector d_max; /* the max value (in case of ranged init) */
+  VALUE d_min; /* the min value (in case of ranged init) */
+  VALUE d_max; /* the max value (in case of ranged init) */
 #endif
   /* Unconstrained bits, most LSB is farthest right. */
-  std::unique_ptr<BitVector> d_bits;
+  std::unique_ptr<VALUE> d_bits;
   /* Min value of unconstrained bits. */
-  std::unique_ptr<BitVector> d_bits_min;
+  std::unique_ptr<VALUE> d_bits_min;
   /* Max value of unconstrained bits. */
-  std::unique_ptr<BitVector> d_bits_max;
+  std::unique_ptr<VALUE> d_bits_max;
+  /* Mask of unconstrained bits, only used for domains of size <= 64. */
+  uint64_t d_mask = 0;
 };
 
-class BitVectorDomainDualGenerator
+template <class VALUE>
+class BvDomainDualGenerator
 {
  public:
   /**
@@ -362,11 +374,11 @@ class BitVectorDomainDualGenerator
    * @param max_hi The maximum value of the upper range (between min_signed
    *               and ones).
    */
-  BitVectorDomainDualGenerator(const BitVectorDomain &domain,
-                               const BitVector *min_lo,
-                               const BitVector *max_lo,
-                               const BitVector *min_hi,
-                               const BitVector *max_hi);
+  BvDomainDualGenerator(const BvDomain<VALUE> &domain,
+                        const VALUE *min_lo,
+                        const VALUE *max_lo,
+                        const VALUE *min_hi,
+                        const VALUE *max_hi);
   /**
    * Construct generator for values within given ranges (inclusive),
    * interpreted as unsigned.
@@ -381,14 +393,14 @@ class BitVectorDomainDualGenerator
    * @param max_hi The maximum value of the upper range (between min_signed
    *               and ones).
    */
-  BitVectorDomainDualGenerator(const BitVectorDomain &domain,
-                               RNG *rng,
-                               const BitVector *min_lo,
-                               const BitVector *max_lo,
-                               const BitVector *min_hi,
-                               const BitVector *max_hi);
+  BvDomainDualGenerator(const BvDomain<VALUE> &domain,
+                        RNG *rng,
+                        const VALUE *min_lo,
+                        const VALUE *max_lo,
+                        const VALUE *min_hi,
+                        const VALUE *max_hi);
   /** Destructor. */
-  ~BitVectorDomainDualGenerator();
+  ~BvDomainDualGenerator();
 
   /**
    * Determine if there is a next element in the sequence.
@@ -404,25 +416,26 @@ class BitVectorDomainDualGenerator
    * Generate next element in the sequence.
    * @return The next element in the sequence.
    */
-  BitVector next();
+  VALUE next();
   /**
    * Generate random element in the sequence.
    * @return A random element in the sequence.
    */
-  BitVector random();
+  VALUE random();
 
  protected:
   /* The associated RNG (may be 0). */
   RNG *d_rng = nullptr;
   /** The generator covering the lower range < 0. */
-  std::unique_ptr<BitVectorDomainGenerator> d_gen_lo;
+  std::unique_ptr<BvDomainGenerator<VALUE>> d_gen_lo;
   /** The generator covering the upper range >= 0. */
-  std::unique_ptr<BitVectorDomainGenerator> d_gen_hi;
+  std::unique_ptr<BvDomainGenerator<VALUE>> d_gen_hi;
   /** The currently active generator. */
-  BitVectorDomainGenerator *d_gen_cur = nullptr;
+  BvDomainGenerator<VALUE> *d_gen_cur = nullptr;
 };
 
-class BitVectorDomainSignedGenerator
+template <class VALUE>
+class BvDomainSignedGenerator
 {
  public:
   /**
@@ -430,7 +443,7 @@ class BitVectorDomainSignedGenerator
    * bit-vector domain, interpreted as signed.
    * @param domain The domain to enumerate values for.
    */
-  BitVectorDomainSignedGenerator(const BitVectorDomain &domain);
+  BvDomainSignedGenerator(const BvDomain<VALUE> &domain);
   /**
    * Construct generator for values within given range (inclusive),
    * interpreted as signed.
@@ -438,16 +451,16 @@ class BitVectorDomainSignedGenerator
    * @param min    The minimum value to start enumeration with.
    * @param max    The maximum value to enumerate until.
    */
-  BitVectorDomainSignedGenerator(const BitVectorDomain &domain,
-                                 const BitVector &min,
-                                 const BitVector &max);
+  BvDomainSignedGenerator(const BvDomain<VALUE> &domain,
+                          const VALUE &min,
+                          const VALUE &max);
   /**
    * Construct generator for values within the range defined by the given
    * bit-vector domain, interpreted as signed.
    * @param domain The domain to enumerate values for.
    * @param rng    The associated random number generator.
    */
-  BitVectorDomainSignedGenerator(const BitVectorDomain &domain, RNG *rng);
+  BvDomainSignedGenerator(const BvDomain<VALUE> &domain, RNG *rng);
   /**
    * Construct generator for values within given range (inclusive),
    * interpreted as signed.
@@ -456,12 +469,12 @@ class BitVectorDomainSignedGenerator
    * @param min    The minimum value to start enumeration with.
    * @param max    The maximum value to enumerate until.
    */
-  BitVectorDomainSignedGenerator(const BitVectorDomain &domain,
-                                 RNG *rng,
-                                 const BitVector &min,
-                                 const BitVector &max);
+  BvDomainSignedGenerator(const BvDomain<VALUE> &domain,
+                          RNG *rng,
+                          const VALUE &min,
+                          const VALUE &max);
   /** Destructor. */
-  ~BitVectorDomainSignedGenerator();
+  ~BvDomainSignedGenerator();
 
   /**
    * Determine if there is a next element in the sequence.
@@ -477,26 +490,33 @@ class BitVectorDomainSignedGenerator
    * Generate next element in the sequence.
    * @return The next element in the sequence.
    */
-  BitVector next();
+  VALUE next();
   /**
    * Generate random element in the sequence.
    * @return A random element in the sequence.
    */
-  BitVector random();
+  VALUE random();
 
  private:
   /* The associated RNG (may be 0). */
   RNG *d_rng = nullptr;
   /** The generator covering the lower range < 0. */
-  std::unique_ptr<BitVectorDomainGenerator> d_gen_lo;
+  std::unique_ptr<BvDomainGenerator<VALUE>> d_gen_lo;
   /** The generator covering the upper range >= 0. */
-  std::unique_ptr<BitVectorDomainGenerator> d_gen_hi;
+  std::unique_ptr<BvDomainGenerator<VALUE>> d_gen_hi;
   /** The currently active generator. */
-  BitVectorDomainGenerator *d_gen_cur = nullptr;
+  BvDomainGenerator<VALUE> *d_gen_cur = nullptr;
 };
 
 /*----------------------------------------------------------------------------*/
 
+using BitVectorDomain                = BvDomain<BitVector>;
+using BitVectorDomainGenerator       = BvDomainGenerator<BitVector>;
+using BitVectorDomainDualGenerator   = BvDomainDualGenerator<BitVector>;
+using BitVectorDomainSignedGenerator = BvDomainSignedGenerator<BitVector>;
+
+/*----------------------------------------------------------------------------*/
+
 }  // namespace ls
 }  // namespace bzla
 
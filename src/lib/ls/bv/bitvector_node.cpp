@@ -14,6 +14,7 @@
 #include <iostream>
 #include <sstream>
 
+#include "bv/word64.h"
 #include "rng/rng.h"
 
 namespace bzla {
@@ -26,8 +27,8 @@ namespace ls {
 //       - for BV_NODE_CACHE_INVERSE_IF, we don't want unnecessary calls to,
 //       e.g., gen.random(), when passed as an argument value (we only want it
 //       evaluated when it is indeed an invertibility check)
-#define BV_NODE_CACHE_CONSISTENT(val) d_consistent.reset(new BitVector(val))
-#define BV_NODE_CACHE_INVERSE(val) d_inverse.reset(new BitVector(val))
+#define BV_NODE_CACHE_CONSISTENT(val) this->d_consistent.reset(new VALUE(val))
+#define BV_NODE_CACHE_INVERSE(val) this->d_inverse.reset(new VALUE(val))
 #define BV_NODE_CACHE_INVERSE_IF(val) \
   if (!is_essential_check)            \
   {                                   \
@@ -36,114 +37,131 @@ namespace ls {
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorNode::BitVectorNode(RNG* rng, uint64_t size)
-    : BitVectorNode(rng, BitVector::mk_zero(size), BitVectorDomain(size))
+template <class VALUE>
+BvNode<VALUE>::BvNode(RNG* rng, uint64_t size)
+    : BvNode<VALUE>(rng, VALUE::mk_zero(size), BvDomain<VALUE>(size))
 {
 }
 
-BitVectorNode::BitVectorNode(RNG* rng, uint64_t size, BitVectorNode* child0)
-    : BitVectorNode(rng, BitVectorDomain(size), child0)
+template <class VALUE>
+BvNode<VALUE>::BvNode(RNG* rng, uint64_t size, BvNode<VALUE>* child0)
+    : BvNode<VALUE>(rng, BvDomain<VALUE>(size), child0)
 {
 }
 
-BitVectorNode::BitVectorNode(RNG* rng,
-                             uint64_t size,
-                             BitVectorNode* child0,
-                             BitVectorNode* child1)
-    : BitVectorNode(rng, BitVectorDomain(size), child0, child1)
+template <class VALUE>
+BvNode<VALUE>::BvNode(RNG* rng,
+                      uint64_t size,
+                      BvNode<VALUE>* child0,
+                      BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, BvDomain<VALUE>(size), child0, child1)
 {
 }
 
-BitVectorNode::BitVectorNode(RNG* rng,
-                             uint64_t size,
-                             BitVectorNode* child0,
-                             BitVectorNode* child1,
-                             BitVectorNode* child2)
-    : BitVectorNode(rng, BitVectorDomain(size), child0, child1, child2)
+template <class VALUE>
+BvNode<VALUE>::BvNode(RNG* rng,
+                      uint64_t size,
+                      BvNode<VALUE>* child0,
+                      BvNode<VALUE>* child1,
+                      BvNode<VALUE>* child2)
+    : BvNode<VALUE>(rng, BvDomain<VALUE>(size), child0, child1, child2)
 {
 }
 
-BitVectorNode::BitVectorNode(RNG* rng,
-                             const BitVector& assignment,
-                             const BitVectorDomain& domain)
-    : Node<BitVector>(rng, assignment, domain.is_fixed()), d_domain(domain)
+template <class VALUE>
+BvNode<VALUE>::BvNode(RNG* rng,
+                      const VALUE& assignment,
+                      const BvDomain<VALUE>& domain)
+    : Node<VALUE>(rng, assignment, domain.is_fixed()), d_domain(domain)
 {
   assert(assignment.size() == domain.size());
   assert(domain.match_fixed_bits(assignment));
 }
 
-BitVectorNode::BitVectorNode(RNG* rng,
-                             const BitVectorDomain& domain,
-                             BitVectorNode* child0)
-    : Node<BitVector>(rng, domain.lo(), child0, domain.is_fixed()),
+template <class VALUE>
+BvNode<VALUE>::BvNode(RNG* rng,
+                      const BvDomain<VALUE>& domain,
+                      BvNode<VALUE>* child0)
+    : Node<VALUE>(rng, domain.lo(), child0, domain.is_fixed()),
       d_domain(domain)
 {
   assert(rng);
 }
 
-BitVectorNode::BitVectorNode(RNG* rng,
-                             const BitVectorDomain& domain,
-                             BitVectorNode* child0,
-                             BitVectorNode* child1)
-    : Node<BitVector>(rng, domain.lo(), child0, child1, domain.is_fixed()),
+template <class VALUE>
+BvNode<VALUE>::BvNode(RNG* rng,
+                      const BvDomain<VALUE>& domain,
+                      BvNode<VALUE>* child0,
+                      BvNode<VALUE>* child1)
+    : Node<VALUE>(rng, domain.lo(), child0, child1, domain.is_fixed()),
       d_domain(domain)
 {
   assert(rng);
 }
 
-BitVectorNode::BitVectorNode(RNG* rng,
-                             const BitVectorDomain& domain,
-                             BitVectorNode* child0,
-                             BitVectorNode* child1,
-                             BitVectorNode* child2)
-    : Node<BitVector>(
+template <class VALUE>
+BvNode<VALUE>::BvNode(RNG* rng,
+                      const BvDomain<VALUE>& domain,
+                      BvNode<VALUE>* child0,
+                      BvNode<VALUE>* child1,
+                      BvNode<VALUE>* child2)
+    : Node<VALUE>(
         rng, domain.lo(), child0, child1, child2, domain.is_fixed()),
       d_domain(domain)
 {
   assert(rng);
 }
 
+template <class VALUE>
 bool
-BitVectorNode::is_inequality() const
+BvNode<VALUE>::is_inequality() const
 {
-  return kind() == NodeKind::BV_SLT || kind() == NodeKind::BV_ULT;
+  return this->kind() == NodeKind::BV_SLT || this->kind() == NodeKind::BV_ULT;
 }
 
+template <class VALUE>
 bool
-BitVectorNode::is_not() const
+BvNode<VALUE>::is_not() const
 {
-  return kind() == NodeKind::BV_NOT;
+  return this->kind() == NodeKind::BV_NOT;
 }
 
+template <class VALUE>
 bool
-BitVectorNode::is_value_false() const
+BvNode<VALUE>::is_value_false() const
 {
-  assert(!d_is_value || d_domain.size() > 1 || !d_domain.is_fixed_bit_true(0));
-  return d_is_value && d_assignment.is_false();
+  assert(!this->d_is_value || d_domain.size() > 1
+         || !d_domain.is_fixed_bit_true(0));
+  return this->d_is_value && this->d_assignment.is_false();
 }
 
+template <class VALUE>
 void
-BitVectorNode::set_assignment(const BitVector& assignment)
+BvNode<VALUE>::set_assignment(const VALUE& assignment)
 {
   assert(d_domain.match_fixed_bits(assignment));
-  d_assignment.iset(assignment);
+  this->d_assignment.iset(assignment);
 }
 
+template <class VALUE>
 std::string
-BitVectorNode::str() const
+BvNode<VALUE>::str() const
 {
-  return (d_symbol ? *d_symbol + " " : "") + "[" + std::to_string(d_id) + "] "
-         + "(" + std::to_string(d_normalized_id) + ") " + std::to_string(kind())
-         + ": " + d_domain.str() + " (" + d_assignment.str() + ")";
+  return (this->d_symbol ? *this->d_symbol + " " : "") + "["
+         + std::to_string(this->d_id) + "] " + "("
+         + std::to_string(this->d_normalized_id) + ") "
+         + std::to_string(this->kind()) + ": " + d_domain.str() + " ("
+         + this->d_assignment.str() + ")";
 }
 
+template <class VALUE>
 std::vector<std::string>
-BitVectorNode::log() const
+BvNode<VALUE>::log() const
 {
   std::vector<std::string> res;
-  for (uint32_t i = 0, n = arity(); i < n; ++i)
+  for (uint32_t i = 0, n = this->arity(); i < n; ++i)
   {
-    BitVectorNode& c = *child(i);
+    BvNode<VALUE>& c = *child(i);
     {
       std::stringstream ss;
       ss << "      |- node[" << i << "]: " << c << std::endl;
@@ -177,30 +195,34 @@ BitVectorNode::log() const
   return res;
 }
 
-BitVectorNode*
-BitVectorNode::child(uint64_t pos) const
+template <class VALUE>
+BvNode<VALUE>*
+BvNode<VALUE>::child(uint64_t pos) const
 {
-  assert(dynamic_cast<BitVectorNode*>(d_children[pos]) != nullptr);
-  return reinterpret_cast<BitVectorNode*>(d_children[pos]);
+  assert(dynamic_cast<BvNode<VALUE>*>(this->d_children[pos]) != nullptr);
+  return reinterpret_cast<BvNode<VALUE>*>(this->d_children[pos]);
 }
 
+template <class VALUE>
 void
-BitVectorNode::register_extract(BitVectorNode* node)
+BvNode<VALUE>::register_extract(BvNode<VALUE>* node)
 {
   assert(node->kind() == NodeKind::BV_EXTRACT);
-  d_extracts.push_back(static_cast<BitVectorExtract*>(node));
+  d_extracts.push_back(static_cast<BvExtract<VALUE>*>(node));
 }
 
+template <class VALUE>
 void
-BitVectorNode::fix_bit(uint64_t idx, bool value)
+BvNode<VALUE>::fix_bit(uint64_t idx, bool value)
 {
   assert(idx < d_domain.size());
   d_domain.fix_bit(idx, value);
 }
 
+template <class VALUE>
 void
-BitVectorNode::update_bounds(const BitVector& min,
-                             const BitVector& max,
+BvNode<VALUE>::update_bounds(const VALUE& min,
+                             const VALUE& max,
                              bool min_is_exclusive,
                              bool max_is_exclusive,
                              bool is_signed)
@@ -219,11 +241,11 @@ BitVectorNode::update_bounds(const BitVector& min,
       if (min_is_exclusive)
       {
         assert(!min.is_max_signed());
-        d_min_s.reset(new BitVector(min.bvinc()));
+        d_min_s.reset(new VALUE(min.bvinc()));
       }
       else
       {
-        d_min_s.reset(new BitVector(min));
+        d_min_s.reset(new VALUE(min));
       }
     }
     if (!d_max_s || d_max_s->signed_compare(max) > 0)
@@ -231,11 +253,11 @@ BitVectorNode::update_bounds(const BitVector& min,
       if (max_is_exclusive)
       {
         assert(!max.is_min_signed());
-        d_max_s.reset(new BitVector(max.bvdec()));
+        d_max_s.reset(new VALUE(max.bvdec()));
       }
       else
       {
-        d_max_s.reset(new BitVector(max));
+        d_max_s.reset(new VALUE(max));
       }
     }
   }
@@ -246,11 +268,11 @@ BitVectorNode::update_bounds(const BitVector& min,
       if (min_is_exclusive)
       {
         assert(!min.is_ones());
-        d_min_u.reset(new BitVector(min.bvinc()));
+        d_min_u.reset(new VALUE(min.bvinc()));
       }
       else
       {
-        d_min_u.reset(new BitVector(min));
+        d_min_u.reset(new VALUE(min));
       }
     }
     if (!d_max_u || d_max_u->compare(max) > 0)
@@ -258,18 +280,19 @@ BitVectorNode::update_bounds(const BitVector& min,
       if (max_is_exclusive)
       {
         assert(!max.is_zero());
-        d_max_u.reset(new BitVector(max.bvdec()));
+        d_max_u.reset(new VALUE(max.bvdec()));
       }
       else
       {
-        d_max_u.reset(new BitVector(max));
+        d_max_u.reset(new VALUE(max));
       }
     }
   }
 }
 
+template <class VALUE>
 void
-BitVectorNode::reset_bounds()
+BvNode<VALUE>::reset_bounds()
 {
   d_min_u = nullptr;
   d_max_u = nullptr;
@@ -277,18 +300,19 @@ BitVectorNode::reset_bounds()
   d_max_s = nullptr;
 }
 
+template <class VALUE>
 void
-BitVectorNode::tighten_bounds(BitVector* min_u,
-                              BitVector* max_u,
-                              BitVector* min_s,
-                              BitVector* max_s,
-                              BitVector& res_min_u,
-                              BitVector& res_max_u,
-                              BitVector& res_min_s,
-                              BitVector& res_max_s)
-{
-  BitVector* mmin;
-  BitVector* mmax;
+BvNode<VALUE>::tighten_bounds(VALUE* min_u,
+                              VALUE* max_u,
+                              VALUE* min_s,
+                              VALUE* max_s,
+                              VALUE& res_min_u,
+                              VALUE& res_max_u,
+                              VALUE& res_min_s,
+                              VALUE& res_max_s)
+{
+  VALUE* mmin;
+  VALUE* mmax;
   // unsigned
   if (min_u)
   {
@@ -306,8 +330,8 @@ BitVectorNode::tighten_bounds(BitVector* min_u,
     if (mmin->compare(*mmax) > 0)
     {
       // conflict
-      res_min_u = BitVector();
-      res_max_u = BitVector();
+      res_min_u = VALUE();
+      res_max_u = VALUE();
     }
     else
     {
@@ -332,8 +356,8 @@ BitVectorNode::tighten_bounds(BitVector* min_u,
     if (mmin->signed_compare(*mmax) > 0)
     {
       // conflict
-      res_min_s = BitVector();
-      res_max_s = BitVector();
+      res_min_s = VALUE();
+      res_max_s = VALUE();
     }
     else
     {
@@ -343,15 +367,16 @@ BitVectorNode::tighten_bounds(BitVector* min_u,
   }
 }
 
+template <class VALUE>
 void
-BitVectorNode::normalize_bounds(BitVector* min_u,
-                                BitVector* max_u,
-                                BitVector* min_s,
-                                BitVector* max_s,
-                                BitVector& res_min_lo,
-                                BitVector& res_max_lo,
-                                BitVector& res_min_hi,
-                                BitVector& res_max_hi)
+BvNode<VALUE>::normalize_bounds(VALUE* min_u,
+                                VALUE* max_u,
+                                VALUE* min_s,
+                                VALUE* max_s,
+                                VALUE& res_min_lo,
+                                VALUE& res_max_lo,
+                                VALUE& res_min_hi,
+                                VALUE& res_max_hi)
 {
   assert(!min_u || min_u->size() == size());
   assert(!max_u || max_u->size() == size());
@@ -363,13 +388,13 @@ BitVectorNode::normalize_bounds(BitVector* min_u,
   assert(res_min_hi.is_null());
   assert(res_max_hi.is_null());
 
-  uint64_t size        = this->size();
-  BitVector zero       = BitVector::mk_zero(size);
-  BitVector ones       = BitVector::mk_ones(size);
-  BitVector min_signed = BitVector::mk_min_signed(size);
-  BitVector max_signed = BitVector::mk_max_signed(size);
-  BitVector *min_lo = nullptr, *max_lo = nullptr;
-  BitVector *min_hi = nullptr, *max_hi = nullptr;
+  uint64_t size    = this->size();
+  VALUE zero       = VALUE::mk_zero(size);
+  VALUE ones       = VALUE::mk_ones(size);
+  VALUE min_signed = VALUE::mk_min_signed(size);
+  VALUE max_signed = VALUE::mk_max_signed(size);
+  VALUE *min_lo = nullptr, *max_lo = nullptr;
+  VALUE *min_hi = nullptr, *max_hi = nullptr;
 
   if (min_u || max_u)
   {
@@ -391,8 +416,8 @@ BitVectorNode::normalize_bounds(BitVector* min_u,
   {
     int32_t min_scomp_zero = min_s ? min_s->signed_compare(zero) : -1;
     int32_t max_scomp_zero = max_s ? max_s->signed_compare(zero) : 1;
-    BitVector *minu = nullptr, *maxu = nullptr;
-    BitVector *mins = nullptr, *maxs = nullptr;
+    VALUE *minu = nullptr, *maxu = nullptr;
+    VALUE *mins = nullptr, *maxs = nullptr;
 
     if (min_scomp_zero < 0)
     {
@@ -520,24 +545,25 @@ BitVectorNode::normalize_bounds(BitVector* min_u,
   assert(res_min_hi.is_null() || !res_max_hi.is_null());
 }
 
+template <class VALUE>
 void
-BitVectorNode::compute_normalized_bounds(const BitVector& s,
-                                         const BitVector& t,
+BvNode<VALUE>::compute_normalized_bounds(const VALUE& s,
+                                         const VALUE& t,
                                          uint64_t pos_x,
-                                         BitVector& res_min_lo,
-                                         BitVector& res_max_lo,
-                                         BitVector& res_min_hi,
-                                         BitVector& res_max_hi)
+                                         VALUE& res_min_lo,
+                                         VALUE& res_max_lo,
+                                         VALUE& res_min_hi,
+                                         VALUE& res_max_hi)
 {
   // the current unsigned bounds on x wrt. s, t and the current bounds on x
-  BitVector min_u, max_u;
+  VALUE min_u, max_u;
   // the current signed bounds on x wrt. s, t and the current bounds on x
-  BitVector min_s, max_s;
+  VALUE min_s, max_s;
 
-  res_min_lo = BitVector();
-  res_max_lo = BitVector();
-  res_min_hi = BitVector();
-  res_max_hi = BitVector();
+  res_min_lo = VALUE();
+  res_max_lo = VALUE();
+  res_min_hi = VALUE();
+  res_max_hi = VALUE();
 
   compute_min_max_bounds(s, t, pos_x, min_u, max_u, min_s, max_s);
   assert(min_u.is_null() == max_u.is_null());
@@ -547,7 +573,7 @@ BitVectorNode::compute_normalized_bounds(const BitVector& s,
     return;  // conflict
   }
 
-  BitVectorNode* op_x = child(pos_x);
+  BvNode<VALUE>* op_x = child(pos_x);
   op_x->normalize_bounds(min_u.is_null() ? op_x->min_u() : &min_u,
                          max_u.is_null() ? op_x->max_u() : &max_u,
                          min_s.is_null() ? op_x->min_s() : &min_s,
@@ -558,14 +584,15 @@ BitVectorNode::compute_normalized_bounds(const BitVector& s,
                          res_max_hi);
 }
 
+template <class VALUE>
 void
-BitVectorNode::compute_min_max_bounds(const BitVector& s,
-                                      const BitVector& t,
+BvNode<VALUE>::compute_min_max_bounds(const VALUE& s,
+                                      const VALUE& t,
                                       uint64_t pos_x,
-                                      BitVector& res_min_u,
-                                      BitVector& res_max_u,
-                                      BitVector& res_min_s,
-                                      BitVector& res_max_s)
+                                      VALUE& res_min_u,
+                                      VALUE& res_max_u,
+                                      VALUE& res_min_s,
+                                      VALUE& res_max_s)
 {
   (void) s;
   (void) t;
@@ -577,12 +604,13 @@ BitVectorNode::compute_min_max_bounds(const BitVector& s,
   assert(false);
 }
 
+template <class VALUE>
 bool
-BitVectorNode::is_in_bounds(const BitVector& bv,
-                            const BitVector& min_lo,
-                            const BitVector& max_lo,
-                            const BitVector& min_hi,
-                            const BitVector& max_hi)
+BvNode<VALUE>::is_in_bounds(const VALUE& bv,
+                            const VALUE& min_lo,
+                            const VALUE& max_lo,
+                            const VALUE& min_hi,
+                            const VALUE& max_hi)
 {
   assert(!min_lo.is_null() || !min_hi.is_null());
   assert(min_lo.is_null() == max_lo.is_null());
@@ -593,8 +621,9 @@ BitVectorNode::is_in_bounds(const BitVector& bv,
              && bv.compare(max_hi) <= 0);
 }
 
+template <class VALUE>
 std::ostream&
-operator<<(std::ostream& out, const BitVectorNode& node)
+operator<<(std::ostream& out, const BvNode<VALUE>& node)
 {
   out << node.str();
   return out;
@@ -602,62 +631,69 @@ operator<<(std::ostream& out, const BitVectorNode& node)
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorAdd::BitVectorAdd(RNG* rng,
-                           uint64_t size,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1)
-    : BitVectorNode(rng, size, child0, child1)
+template <class VALUE>
+BvAdd<VALUE>::BvAdd(RNG* rng,
+                    uint64_t size,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, size, child0, child1)
 {
   assert(size == child0->size());
   assert(child0->size() == child1->size());
   _evaluate_and_set_domain();
 }
 
-BitVectorAdd::BitVectorAdd(RNG* rng,
-                           const BitVectorDomain& domain,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1)
-    : BitVectorNode(rng, domain, child0, child1)
+template <class VALUE>
+BvAdd<VALUE>::BvAdd(RNG* rng,
+                    const BvDomain<VALUE>& domain,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, domain, child0, child1)
 {
   assert(child0->size() == child1->size());
   assert(domain.size() == child0->size());
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorAdd::_evaluate()
+BvAdd<VALUE>::_evaluate()
 {
-  d_assignment.ibvadd(child(0)->assignment(), child(1)->assignment());
+  this->d_assignment.ibvadd(this->child(0)->assignment(),
+                            this->child(1)->assignment());
 }
 
+template <class VALUE>
 void
-BitVectorAdd::_evaluate_and_set_domain()
+BvAdd<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorAdd::evaluate()
+BvAdd<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 bool
-BitVectorAdd::is_invertible(const BitVector& t,
+BvAdd<VALUE>::is_invertible(const VALUE& t,
                             uint64_t pos_x,
                             bool is_essential_check)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * IC_wo: true
@@ -666,13 +702,13 @@ BitVectorAdd::is_invertible(const BitVector& t,
    * Inverse value: t - s
    */
 
-  uint64_t pos_s     = 1 - pos_x;
-  const BitVector& s = child(pos_s)->assignment();
-  BitVector sub      = t.bvsub(s);
+  uint64_t pos_s = 1 - pos_x;
+  const VALUE& s = this->child(pos_s)->assignment();
+  VALUE sub      = t.bvsub(s);
 
-  if (child(pos_x)->domain().has_fixed_bits())
+  if (this->child(pos_x)->domain().has_fixed_bits())
   {
-    const BitVectorDomain& x = child(pos_x)->domain();
+    const BvDomain<VALUE>& x = this->child(pos_x)->domain();
     if (!x.match_fixed_bits(sub))
     {
       return false;
@@ -683,11 +719,12 @@ BitVectorAdd::is_invertible(const BitVector& t,
   return true;
 }
 
+template <class VALUE>
 bool
-BitVectorAdd::is_consistent(const BitVector& t, uint64_t pos_x)
+BvAdd<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * CC_wo: true
@@ -699,7 +736,7 @@ BitVectorAdd::is_consistent(const BitVector& t, uint64_t pos_x)
   (void) t;
   (void) pos_x;
 
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   if (x.has_fixed_bits())
   {
     if (x.is_fixed())
@@ -708,7 +745,7 @@ BitVectorAdd::is_consistent(const BitVector& t, uint64_t pos_x)
     }
     else
     {
-      BitVectorDomainGenerator gen(x, d_rng);
+      BvDomainGenerator<VALUE> gen(x, this->d_rng);
       // Consistent value: random value
       BV_NODE_CACHE_CONSISTENT(gen.random());
     }
@@ -716,106 +753,115 @@ BitVectorAdd::is_consistent(const BitVector& t, uint64_t pos_x)
   else
   {
     // Consistent value: random value
-    BV_NODE_CACHE_CONSISTENT(BitVector(x.size(), *d_rng));
+    BV_NODE_CACHE_CONSISTENT(VALUE(x.size(), *this->d_rng));
   }
   return true;
 }
 
-const BitVector&
-BitVectorAdd::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvAdd<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  uint64_t pos_s     = 1 - pos_x;
-  const BitVector& s = child(pos_s)->assignment();
-  assert(d_inverse);
-  assert(t.compare(d_inverse->bvadd(s)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  uint64_t pos_s = 1 - pos_x;
+  const VALUE& s = this->child(pos_s)->assignment();
+  assert(this->d_inverse);
+  assert(t.compare(this->d_inverse->bvadd(s)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
-const BitVector&
-BitVectorAdd::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvAdd<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  assert(d_consistent);
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(x.match_fixed_bits(*d_consistent));
+  assert(this->d_consistent);
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(x.match_fixed_bits(*this->d_consistent));
 #endif
-  return *d_consistent;
+  return *this->d_consistent;
 }
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorAnd::BitVectorAnd(RNG* rng,
-                           uint64_t size,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1)
-    : BitVectorNode(rng, size, child0, child1)
+template <class VALUE>
+BvAnd<VALUE>::BvAnd(RNG* rng,
+                    uint64_t size,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, size, child0, child1)
 {
   assert(size == child0->size());
   assert(child0->size() == child1->size());
   _evaluate_and_set_domain();
 }
 
-BitVectorAnd::BitVectorAnd(RNG* rng,
-                           const BitVectorDomain& domain,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1)
-    : BitVectorNode(rng, domain, child0, child1)
+template <class VALUE>
+BvAnd<VALUE>::BvAnd(RNG* rng,
+                    const BvDomain<VALUE>& domain,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, domain, child0, child1)
 {
   assert(child0->size() == child1->size());
   assert(domain.size() == child0->size());
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorAnd::_evaluate()
+BvAnd<VALUE>::_evaluate()
 {
-  d_assignment.ibvand(child(0)->assignment(), child(1)->assignment());
+  this->d_assignment.ibvand(this->child(0)->assignment(),
+                            this->child(1)->assignment());
 }
 
+template <class VALUE>
 void
-BitVectorAnd::_evaluate_and_set_domain()
+BvAnd<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorAnd::evaluate()
+BvAnd<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 void
-BitVectorAnd::compute_min_max_bounds(const BitVector& s,
-                                     const BitVector& t,
+BvAnd<VALUE>::compute_min_max_bounds(const VALUE& s,
+                                     const VALUE& t,
                                      uint64_t pos_x,
-                                     BitVector& res_min_u,
-                                     BitVector& res_max_u,
-                                     BitVector& res_min_s,
-                                     BitVector& res_max_s)
+                                     VALUE& res_min_u,
+                                     VALUE& res_max_u,
+                                     VALUE& res_min_s,
+                                     VALUE& res_max_s)
 {
   assert(res_min_u.is_null());
   assert(res_max_u.is_null());
   assert(res_min_s.is_null());
   assert(res_max_s.is_null());
-  BitVectorNode* op_x      = child(pos_x);
-  const BitVectorDomain& x = op_x->domain();
+  BvNode<VALUE>* op_x      = this->child(pos_x);
+  const BvDomain<VALUE>& x = op_x->domain();
   d_lo                     = x.lo().bvor(t);
   d_hi                     = x.hi().bvand(s.bvxnor(t));
   res_min_u                = d_lo;
@@ -830,13 +876,14 @@ BitVectorAnd::compute_min_max_bounds(const BitVector& s,
                        res_max_s);
 }
 
+template <class VALUE>
 bool
-BitVectorAnd::is_invertible(const BitVector& t,
+BvAnd<VALUE>::is_invertible(const VALUE& t,
                             uint64_t pos_x,
                             bool is_essential_check)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * IC_wo: (t & s) = t
@@ -849,13 +896,13 @@ BitVectorAnd::is_invertible(const BitVector& t,
    */
 
   uint64_t pos_s           = 1 - pos_x;
-  const BitVector& s       = child(pos_s)->assignment();
-  BitVectorNode* op_x      = child(pos_x);
-  const BitVectorDomain& x = op_x->domain();
-  BitVector* min_u         = op_x->min_u();
-  BitVector* max_u         = op_x->max_u();
-  BitVector* min_s         = op_x->min_s();
-  BitVector* max_s         = op_x->max_s();
+  const VALUE& s           = this->child(pos_s)->assignment();
+  BvNode<VALUE>* op_x      = this->child(pos_x);
+  const BvDomain<VALUE>& x = op_x->domain();
+  VALUE* min_u             = op_x->min_u();
+  VALUE* max_u             = op_x->max_u();
+  VALUE* min_s             = op_x->min_s();
+  VALUE* max_s             = op_x->max_s();
 
   // IC_wo: (t & s) = t
   bool ic               = t.bvand(s).compare(t) == 0;
@@ -869,16 +916,17 @@ BitVectorAnd::is_invertible(const BitVector& t,
       return false;
     }
     // m = ~(lo_x ^ hi_x)  ... mask out all non-const bits
-    BitVector mask = x.lo().bvxnor(x.hi());
-    ic             = s.bvand(x.hi()).ibvand(mask).compare(t.bvand(mask)) == 0;
+    VALUE mask = x.lo().bvxnor(x.hi());
+    ic         = s.bvand(x.hi()).ibvand(mask).compare(t.bvand(mask)) == 0;
   }
 
   if (ic)
   {
     if (min_u || max_u || min_s || max_s)
     {
-      BitVector min_lo, max_lo, min_hi, max_hi;
-      compute_normalized_bounds(s, t, pos_x, min_lo, max_lo, min_hi, max_hi);
+      VALUE min_lo, max_lo, min_hi, max_hi;
+      this->compute_normalized_bounds(
+          s, t, pos_x, min_lo, max_lo, min_hi, max_hi);
       if (min_hi.is_null() && max_hi.is_null() && min_lo.is_null()
           && max_lo.is_null())
       {
@@ -890,9 +938,9 @@ BitVectorAnd::is_invertible(const BitVector& t,
         BV_NODE_CACHE_INVERSE_IF(d_lo);
         return true;
       }
-      BitVectorDomain tmp(x.lo().bvor(t), x.hi().bvand(s.bvxnor(t)));
-      BitVectorDomainDualGenerator gen(tmp,
-                                       d_rng,
+      BvDomain<VALUE> tmp(x.lo().bvor(t), x.hi().bvand(s.bvxnor(t)));
+      BvDomainDualGenerator<VALUE> gen(tmp,
+                                       this->d_rng,
                                        min_lo.is_null() ? nullptr : &min_lo,
                                        max_lo.is_null() ? nullptr : &max_lo,
                                        min_hi.is_null() ? nullptr : &min_hi,
@@ -907,7 +955,7 @@ BitVectorAnd::is_invertible(const BitVector& t,
 
     if (!is_essential_check)
     {
-      BitVector rand;
+      VALUE rand;
       if (x_has_fixed_bits)
       {
         if (x.is_fixed())
@@ -916,14 +964,14 @@ BitVectorAnd::is_invertible(const BitVector& t,
         }
         else
         {
-          BitVectorDomainGenerator gen(x, d_rng);
+          BvDomainGenerator<VALUE> gen(x, this->d_rng);
           assert(gen.has_random());
           rand = gen.random();
         }
       }
       else
       {
-        rand = BitVector(t.size(), *d_rng);
+        rand = VALUE(t.size(), *this->d_rng);
       }
       BV_NODE_CACHE_INVERSE(t.bvand(s).bvor(s.bvnot().ibvand(rand)));
     }
@@ -933,11 +981,12 @@ BitVectorAnd::is_invertible(const BitVector& t,
   return false;
 }
 
+template <class VALUE>
 bool
-BitVectorAnd::is_consistent(const BitVector& t, uint64_t pos_x)
+BvAnd<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * CC_wo: true
@@ -947,7 +996,7 @@ BitVectorAnd::is_consistent(const BitVector& t, uint64_t pos_x)
    */
 
   // CC: t & hi_x = t
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   if (x.has_fixed_bits())
   {
     if (t.compare(t.bvand(x.hi())) == 0)
@@ -958,102 +1007,111 @@ BitVectorAnd::is_consistent(const BitVector& t, uint64_t pos_x)
       }
       else
       {
-        BitVectorDomainGenerator gen(x, d_rng);
+        BvDomainGenerator<VALUE> gen(x, this->d_rng);
         BV_NODE_CACHE_CONSISTENT(gen.random().ibvor(t));
       }
       return true;
     }
     return false;
   }
-  BV_NODE_CACHE_CONSISTENT(BitVector(x.size(), *d_rng).ibvor(t));
+  BV_NODE_CACHE_CONSISTENT(VALUE(x.size(), *this->d_rng).ibvor(t));
   return true;
 }
 
-const BitVector&
-BitVectorAnd::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvAnd<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  uint64_t pos_s     = 1 - pos_x;
-  const BitVector& s = child(pos_s)->assignment();
-  assert(d_inverse);
-  assert(t.compare(d_inverse->bvand(s)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  uint64_t pos_s = 1 - pos_x;
+  const VALUE& s = this->child(pos_s)->assignment();
+  assert(this->d_inverse);
+  assert(t.compare(this->d_inverse->bvand(s)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
-const BitVector&
-BitVectorAnd::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvAnd<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  assert(d_consistent);
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(x.match_fixed_bits(*d_consistent));
+  assert(this->d_consistent);
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(x.match_fixed_bits(*this->d_consistent));
 #endif
-  return *d_consistent;
+  return *this->d_consistent;
 }
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorConcat::BitVectorConcat(RNG* rng,
-                                 uint64_t size,
-                                 BitVectorNode* child0,
-                                 BitVectorNode* child1)
-    : BitVectorNode(rng, size, child0, child1)
+template <class VALUE>
+BvConcat<VALUE>::BvConcat(RNG* rng,
+                          uint64_t size,
+                          BvNode<VALUE>* child0,
+                          BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, size, child0, child1)
 {
   assert(size == child0->size() + child1->size());
   _evaluate_and_set_domain();
 }
 
-BitVectorConcat::BitVectorConcat(RNG* rng,
-                                 const BitVectorDomain& domain,
-                                 BitVectorNode* child0,
-                                 BitVectorNode* child1)
-    : BitVectorNode(rng, domain, child0, child1)
+template <class VALUE>
+BvConcat<VALUE>::BvConcat(RNG* rng,
+                          const BvDomain<VALUE>& domain,
+                          BvNode<VALUE>* child0,
+                          BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, domain, child0, child1)
 {
   assert(domain.size() == child0->size() + child1->size());
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorConcat::_evaluate()
+BvConcat<VALUE>::_evaluate()
 {
-  d_assignment.ibvconcat(child(0)->assignment(), child(1)->assignment());
+  this->d_assignment.ibvconcat(this->child(0)->assignment(),
+                               this->child(1)->assignment());
 }
 
+template <class VALUE>
 void
-BitVectorConcat::_evaluate_and_set_domain()
+BvConcat<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorConcat::evaluate()
+BvConcat<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 bool
-BitVectorConcat::is_invertible(const BitVector& t,
+BvConcat<VALUE>::is_invertible(const VALUE& t,
                                uint64_t pos_x,
                                bool is_essential_check)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * IC_wo: pos_x = 0: s = t[size(s) - 1 : 0]
@@ -1065,9 +1123,9 @@ BitVectorConcat::is_invertible(const BitVector& t,
    *   pos_x = 1: t[size(x) - 1: 0]
    */
   uint64_t pos_s           = 1 - pos_x;
-  const BitVector& s       = child(pos_s)->assignment();
-  const BitVectorDomain& x = child(pos_x)->domain();
-  BitVector tx;
+  const VALUE& s           = this->child(pos_s)->assignment();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  VALUE tx;
   bool ic_wo;
 
   uint64_t bw_t = t.size();
@@ -1101,11 +1159,12 @@ BitVectorConcat::is_invertible(const BitVector& t,
   return false;
 }
 
+template <class VALUE>
 bool
-BitVectorConcat::is_consistent(const BitVector& t, uint64_t pos_x)
+BvConcat<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * CC_wo: true
@@ -1118,7 +1177,7 @@ BitVectorConcat::is_consistent(const BitVector& t, uint64_t pos_x)
    *   pos_x = 1: t[bw_x - 1, 0]
    */
 
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   uint64_t bw_t            = t.size();
   uint64_t bw_x            = x.size();
 
@@ -1126,112 +1185,121 @@ BitVectorConcat::is_consistent(const BitVector& t, uint64_t pos_x)
   if (pos_x == 0)
   {
     // Consistent value: pos_x = 0: tx = t[size(t) - 1 : size(t) - size(x)]
-    BitVector tx = t.bvextract(bw_t - 1, bw_t - bw_x);
+    VALUE tx = t.bvextract(bw_t - 1, bw_t - bw_x);
     if (!x.has_fixed_bits() || x.match_fixed_bits(tx))
     {
-      d_consistent.reset(new BitVector(tx));
+      this->d_consistent.reset(new VALUE(tx));
       return true;
     }
     return false;
   }
   // Consistent value: pos_x = 1: tx = t[size(x) - 1 : 0]
-  BitVector tx = t.bvextract(bw_x - 1, 0);
+  VALUE tx = t.bvextract(bw_x - 1, 0);
   if (!x.has_fixed_bits() || x.match_fixed_bits(tx))
   {
-    d_consistent.reset(new BitVector(tx));
+    this->d_consistent.reset(new VALUE(tx));
     return true;
   }
   return false;
 }
 
-const BitVector&
-BitVectorConcat::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvConcat<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  uint64_t pos_s     = 1 - pos_x;
-  const BitVector& s = child(pos_s)->assignment();
-  assert(d_inverse);
-  assert(pos_x == 1 || t.compare(d_inverse->bvconcat(s)) == 0);
-  assert(pos_x == 0 || t.compare(s.bvconcat(*d_inverse)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  uint64_t pos_s = 1 - pos_x;
+  const VALUE& s = this->child(pos_s)->assignment();
+  assert(this->d_inverse);
+  assert(pos_x == 1 || t.compare(this->d_inverse->bvconcat(s)) == 0);
+  assert(pos_x == 0 || t.compare(s.bvconcat(*this->d_inverse)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
-const BitVector&
-BitVectorConcat::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvConcat<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  assert(d_consistent);
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(x.match_fixed_bits(*d_consistent));
+  assert(this->d_consistent);
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(x.match_fixed_bits(*this->d_consistent));
 #endif
-  return *d_consistent;
+  return *this->d_consistent;
 }
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorEq::BitVectorEq(RNG* rng,
-                         uint64_t size,
-                         BitVectorNode* child0,
-                         BitVectorNode* child1)
-    : BitVectorNode(rng, size, child0, child1)
+template <class VALUE>
+BvEq<VALUE>::BvEq(RNG* rng,
+                  uint64_t size,
+                  BvNode<VALUE>* child0,
+                  BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, size, child0, child1)
 {
   assert(size == 1);
   assert(child0->size() == child1->size());
   _evaluate_and_set_domain();
 }
 
-BitVectorEq::BitVectorEq(RNG* rng,
-                         const BitVectorDomain& domain,
-                         BitVectorNode* child0,
-                         BitVectorNode* child1)
-    : BitVectorNode(rng, domain, child0, child1)
+template <class VALUE>
+BvEq<VALUE>::BvEq(RNG* rng,
+                  const BvDomain<VALUE>& domain,
+                  BvNode<VALUE>* child0,
+                  BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, domain, child0, child1)
 {
   assert(child0->size() == child1->size());
   assert(domain.size() == 1);
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorEq::_evaluate()
+BvEq<VALUE>::_evaluate()
 {
-  d_assignment.ibveq(child(0)->assignment(), child(1)->assignment());
+  this->d_assignment.ibveq(this->child(0)->assignment(),
+                           this->child(1)->assignment());
 }
 
+template <class VALUE>
 void
-BitVectorEq::_evaluate_and_set_domain()
+BvEq<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorEq::evaluate()
+BvEq<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 bool
-BitVectorEq::is_invertible(const BitVector& t,
+BvEq<VALUE>::is_invertible(const VALUE& t,
                            uint64_t pos_x,
                            bool is_essential_check)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * IC_wo: true
@@ -1244,8 +1312,8 @@ BitVectorEq::is_invertible(const BitVector& t,
    */
 
   uint64_t pos_s           = 1 - pos_x;
-  const BitVector& s       = child(pos_s)->assignment();
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const VALUE& s           = this->child(pos_s)->assignment();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
 
   if (x.has_fixed_bits())
   {
@@ -1264,8 +1332,8 @@ BitVectorEq::is_invertible(const BitVector& t,
     {
       if (x.hi().compare(x.lo()) || x.hi().compare(s))
       {
-        BitVector res;
-        BitVectorDomainGenerator gen(x, d_rng);
+        VALUE res;
+        BvDomainGenerator<VALUE> gen(x, this->d_rng);
         do
         {
           assert(gen.has_random());
@@ -1291,10 +1359,10 @@ BitVectorEq::is_invertible(const BitVector& t,
   {
     if (t.is_false())
     {
-      BitVector res;
+      VALUE res;
       do
       {
-        res = BitVector(x.size(), *d_rng);
+        res = VALUE(x.size(), *this->d_rng);
       } while (s.compare(res) == 0);
       BV_NODE_CACHE_INVERSE(std::move(res));
     }
@@ -1306,11 +1374,12 @@ BitVectorEq::is_invertible(const BitVector& t,
   return true;
 }
 
+template <class VALUE>
 bool
-BitVectorEq::is_consistent(const BitVector& t, uint64_t pos_x)
+BvEq<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * CC_wo: true
@@ -1320,7 +1389,7 @@ BitVectorEq::is_consistent(const BitVector& t, uint64_t pos_x)
    */
 
   (void) t;
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   if (x.has_fixed_bits())
   {
     if (x.is_fixed())
@@ -1329,7 +1398,7 @@ BitVectorEq::is_consistent(const BitVector& t, uint64_t pos_x)
     }
     else
     {
-      BitVectorDomainGenerator gen(x, d_rng);
+      BvDomainGenerator<VALUE> gen(x, this->d_rng);
       // Consistent value: random value
       BV_NODE_CACHE_CONSISTENT(gen.random());
     }
@@ -1337,99 +1406,108 @@ BitVectorEq::is_consistent(const BitVector& t, uint64_t pos_x)
   else
   {
     // Consistent value: random value
-    BV_NODE_CACHE_CONSISTENT(BitVector(x.size(), *d_rng));
+    BV_NODE_CACHE_CONSISTENT(VALUE(x.size(), *this->d_rng));
   }
   return true;
 }
 
-const BitVector&
-BitVectorEq::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvEq<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  uint64_t pos_s     = 1 - pos_x;
-  const BitVector& s = child(pos_s)->assignment();
-  assert(d_inverse);
-  assert(t.compare(d_inverse->bveq(s)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  uint64_t pos_s = 1 - pos_x;
+  const VALUE& s = this->child(pos_s)->assignment();
+  assert(this->d_inverse);
+  assert(t.compare(this->d_inverse->bveq(s)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
-const BitVector&
-BitVectorEq::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvEq<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  assert(d_consistent);
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(x.match_fixed_bits(*d_consistent));
+  assert(this->d_consistent);
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(x.match_fixed_bits(*this->d_consistent));
 #endif
-  return *d_consistent;
+  return *this->d_consistent;
 }
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorMul::BitVectorMul(RNG* rng,
-                           uint64_t size,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1)
-    : BitVectorNode(rng, size, child0, child1)
+template <class VALUE>
+BvMul<VALUE>::BvMul(RNG* rng,
+                    uint64_t size,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, size, child0, child1)
 {
   assert(size == child0->size());
   assert(child0->size() == child1->size());
   _evaluate_and_set_domain();
 }
 
-BitVectorMul::BitVectorMul(RNG* rng,
-                           const BitVectorDomain& domain,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1)
-    : BitVectorNode(rng, domain, child0, child1)
+template <class VALUE>
+BvMul<VALUE>::BvMul(RNG* rng,
+                    const BvDomain<VALUE>& domain,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, domain, child0, child1)
 {
   assert(child0->size() == child1->size());
   assert(domain.size() == child0->size());
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorMul::_evaluate()
+BvMul<VALUE>::_evaluate()
 {
-  d_assignment.ibvmul(child(0)->assignment(), child(1)->assignment());
+  this->d_assignment.ibvmul(this->child(0)->assignment(),
+                            this->child(1)->assignment());
 }
 
+template <class VALUE>
 void
-BitVectorMul::_evaluate_and_set_domain()
+BvMul<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorMul::evaluate()
+BvMul<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 void
-BitVectorMul::compute_min_max_bounds(const BitVector& s,
-                                     const BitVector& t,
+BvMul<VALUE>::compute_min_max_bounds(const VALUE& s,
+                                     const VALUE& t,
                                      uint64_t pos_x,
-                                     BitVector& res_min_u,
-                                     BitVector& res_max_u,
-                                     BitVector& res_min_s,
-                                     BitVector& res_max_s)
+                                     VALUE& res_min_u,
+                                     VALUE& res_max_u,
+                                     VALUE& res_min_s,
+                                     VALUE& res_max_s)
 {
   (void) t;
 
@@ -1439,27 +1517,28 @@ BitVectorMul::compute_min_max_bounds(const BitVector& s,
   assert(res_max_s.is_null());
 
   uint64_t size = s.size();
-  res_min_u     = BitVector::mk_zero(size);
-  res_max_u     = BitVector::mk_ones(size);
+  res_min_u     = VALUE::mk_zero(size);
+  res_max_u     = VALUE::mk_ones(size);
 
   // tighten unsigned bounds wrt. to current unsigned bounds of x
-  child(pos_x)->tighten_bounds(&res_min_u,
-                               &res_max_u,
-                               nullptr,
-                               nullptr,
-                               res_min_u,
-                               res_max_u,
-                               res_min_s,
-                               res_max_s);
+  this->child(pos_x)->tighten_bounds(&res_min_u,
+                                     &res_max_u,
+                                     nullptr,
+                                     nullptr,
+                                     res_min_u,
+                                     res_max_u,
+                                     res_min_s,
+                                     res_max_s);
 }
 
+template <class VALUE>
 bool
-BitVectorMul::is_invertible(const BitVector& t,
+BvMul<VALUE>::is_invertible(const VALUE& t,
                             uint64_t pos_x,
                             bool is_essential_check)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * IC_wo: ((-s | s) & t) = t
@@ -1478,16 +1557,17 @@ BitVectorMul::is_invertible(const BitVector& t,
    * TODO: + bounds
    */
   uint64_t pos_s           = 1 - pos_x;
-  const BitVector& s       = child(pos_s)->assignment();
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const VALUE& s           = this->child(pos_s)->assignment();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
 
   // IC_wo: ((-s | s) & t) = t
   bool ic_wo = s.bvneg().ibvor(s).ibvand(t).compare(t) == 0;
 
   if (ic_wo)
   {
-    BitVector min_lo, max_lo, min_hi, max_hi;
-    compute_normalized_bounds(s, t, pos_x, min_lo, max_lo, min_hi, max_hi);
+    VALUE min_lo, max_lo, min_hi, max_hi;
+    this->compute_normalized_bounds(
+        s, t, pos_x, min_lo, max_lo, min_hi, max_hi);
     if (min_lo.is_null() && min_hi.is_null())
     {
       return false;
@@ -1498,9 +1578,9 @@ BitVectorMul::is_invertible(const BitVector& t,
       // fixed: IC: x * s = t
       if (x.is_fixed())
       {
-        const BitVector& xval = x.lo();
+        const VALUE& xval = x.lo();
         if (xval.bvmul(s).compare(t) == 0
-            && is_in_bounds(xval, min_lo, max_lo, min_hi, max_hi))
+            && this->is_in_bounds(xval, min_lo, max_lo, min_hi, max_hi))
         {
           BV_NODE_CACHE_INVERSE_IF(xval);
           return true;
@@ -1518,9 +1598,9 @@ BitVectorMul::is_invertible(const BitVector& t,
         if (s.lsb())
         {
           // IC: odd: mcb(x, t * s^-1)
-          BitVector inv = s.bvmodinv().ibvmul(t);  // s^-1
+          VALUE inv = s.bvmodinv().ibvmul(t);  // s^-1
           if (x.match_fixed_bits(inv)
-              && is_in_bounds(inv, min_lo, max_lo, min_hi, max_hi))
+              && this->is_in_bounds(inv, min_lo, max_lo, min_hi, max_hi))
           {
             // Inverse value: s^-1
             BV_NODE_CACHE_INVERSE_IF(std::move(inv));
@@ -1537,18 +1617,18 @@ BitVectorMul::is_invertible(const BitVector& t,
         //   y = (t >> ctz(s)) * (s >> ctz(s))^-1
         // match corresponding constant bits of x, i.e.,
         // mcb(x[size - ctz(s) - 1:0], y[size - ctz(s) - 1:0]).
-        uint64_t size   = x.size();
-        uint64_t ctz    = s.count_trailing_zeros();
-        BitVector y_ext = t.bvshr(ctz)
+        uint64_t size = x.size();
+        uint64_t ctz  = s.count_trailing_zeros();
+        VALUE y_ext   = t.bvshr(ctz)
                               .ibvmul(s.bvshr(ctz).ibvmodinv())
                               .ibvextract(size - ctz - 1, 0);
         if (x.bvextract(size - ctz - 1, 0).match_fixed_bits(y_ext))
         {
           // Result domain is x[size - 1:size - ctz] o y[size - ctz(s) - 1:0]
-          BitVectorDomain d(x.bvextract(size - 1, size - ctz).bvconcat(y_ext));
+          BvDomain<VALUE> d(x.bvextract(size - 1, size - ctz).bvconcat(y_ext));
           if (d.is_fixed())
           {
-            if (is_in_bounds(d.lo(), min_lo, max_lo, min_hi, max_hi))
+            if (this->is_in_bounds(d.lo(), min_lo, max_lo, min_hi, max_hi))
             {
               // Inverse value: random value in domain
               //                x[size - 1:size - ctz] o y[size - ctz(s) - 1:0]
@@ -1558,9 +1638,9 @@ BitVectorMul::is_invertible(const BitVector& t,
             }
             return false;
           }
-          BitVectorDomainDualGenerator gen(
+          BvDomainDualGenerator<VALUE> gen(
               d,
-              d_rng,
+              this->d_rng,
               min_lo.is_null() ? nullptr : &min_lo,
               max_lo.is_null() ? nullptr : &max_lo,
               min_hi.is_null() ? nullptr : &min_hi,
@@ -1575,8 +1655,8 @@ BitVectorMul::is_invertible(const BitVector& t,
         return false;
       }
       // IC: IC_wo && s = 0
-      BitVectorDomainDualGenerator gen(x,
-                                       d_rng,
+      BvDomainDualGenerator<VALUE> gen(x,
+                                       this->d_rng,
                                        min_lo.is_null() ? nullptr : &min_lo,
                                        max_lo.is_null() ? nullptr : &max_lo,
                                        min_hi.is_null() ? nullptr : &min_hi,
@@ -1595,13 +1675,13 @@ BitVectorMul::is_invertible(const BitVector& t,
     {
       // Inverse value: s = 0 (=> t = 0): random value
       BV_NODE_CACHE_INVERSE_IF(
-          BitVector(x.size(), *d_rng, min_lo, max_lo, min_hi, max_hi));
+          VALUE(x.size(), *this->d_rng, min_lo, max_lo, min_hi, max_hi));
       return true;
     }
     if (s.lsb())
     {
-      BitVector inv = t.bvmul(s.bvmodinv());
-      if (is_in_bounds(inv, min_lo, max_lo, min_hi, max_hi))
+      VALUE inv = s.bvmodinv().bvmul(t);
+      if (this->is_in_bounds(inv, min_lo, max_lo, min_hi, max_hi))
       {
         // Inverse value: s odd : s^-1 (unique solution)
         BV_NODE_CACHE_INVERSE_IF(std::move(inv));
@@ -1621,7 +1701,7 @@ BitVectorMul::is_invertible(const BitVector& t,
       assert(t.count_trailing_zeros() >= s.count_trailing_zeros());
       uint64_t n    = s.count_trailing_zeros();
       uint64_t size = s.size();
-      BitVector right;
+      VALUE right;
       if (s.is_power_of_two())
       {
         right = t.bvextract(size - 1, n);
@@ -1633,9 +1713,9 @@ BitVectorMul::is_invertible(const BitVector& t,
                     .ibvmul(t.bvshr(n))
                     .ibvextract(size - n - 1, 0);
       }
-      BitVectorDomain d = BitVectorDomain(size - right.size()).bvconcat(right);
-      BitVectorDomainDualGenerator gen(d,
-                                       d_rng,
+      BvDomain<VALUE> d = BvDomain<VALUE>(size - right.size()).bvconcat(right);
+      BvDomainDualGenerator<VALUE> gen(d,
+                                       this->d_rng,
                                        min_lo.is_null() ? nullptr : &min_lo,
                                        max_lo.is_null() ? nullptr : &max_lo,
                                        min_hi.is_null() ? nullptr : &min_hi,
@@ -1656,11 +1736,12 @@ BitVectorMul::is_invertible(const BitVector& t,
   return ic_wo;
 }
 
+template <class VALUE>
 bool
-BitVectorMul::is_consistent(const BitVector& t, uint64_t pos_x)
+BvMul<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * CC_wo: true
@@ -1674,7 +1755,7 @@ BitVectorMul::is_consistent(const BitVector& t, uint64_t pos_x)
    *          t even: random even value > 0 with ctz(x) <= ctz(t)
    */
 
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   uint64_t size            = t.size();
   if (x.has_fixed_bits())
   {
@@ -1705,12 +1786,13 @@ BitVectorMul::is_consistent(const BitVector& t, uint64_t pos_x)
       else
       {
         // Consistent value: t = odd: random odd value
-        BitVectorDomainGenerator gen(x, d_rng, BitVector::mk_one(size), x.hi());
+        BvDomainGenerator<VALUE> gen(
+            x, this->d_rng, VALUE::mk_one(size), x.hi());
         BV_NODE_CACHE_CONSISTENT(gen.random());
-        if (!d_consistent->lsb())
+        if (!this->d_consistent->lsb())
         {
           assert(!x.is_fixed_bit_false(0));
-          d_consistent->set_bit(0, true);
+          this->d_consistent->set_bit(0, true);
         }
       }
       return true;
@@ -1718,13 +1800,13 @@ BitVectorMul::is_consistent(const BitVector& t, uint64_t pos_x)
 
     // CC: t even: \exists y. (mcb(x, y) && ctz(t) >= ctz(y))
     uint64_t ctz_t = t.count_trailing_zeros();
-    BitVectorDomainGenerator gen(
+    BvDomainGenerator<VALUE> gen(
         x,
-        d_rng,
-        t.is_zero() ? BitVector::mk_zero(size) : BitVector::mk_one(size),
+        this->d_rng,
+        t.is_zero() ? VALUE::mk_zero(size) : VALUE::mk_one(size),
         x.hi());
     assert(gen.has_random() || x.is_fixed());
-    BitVector tmp = gen.has_random() ? gen.random() : x.lo();
+    VALUE tmp = gen.has_random() ? gen.random() : x.lo();
 
     bool res = false;
     for (uint64_t i = 0; i < size && i <= ctz_t; ++i)
@@ -1742,12 +1824,12 @@ BitVectorMul::is_consistent(const BitVector& t, uint64_t pos_x)
         uint64_t i;
         do
         {
-          i = d_rng->pick<uint64_t>(0, ctz_t);
+          i = this->d_rng->template pick<uint64_t>(0, ctz_t);
         } while (x.is_fixed_bit_false(i));
         tmp.set_bit(i, true);
       }
       // Consistent value: t = even: random even value > 0 with ctz(x) <= ctz(t)
-      d_consistent.reset(new BitVector(tmp));
+      this->d_consistent.reset(new VALUE(tmp));
       return true;
     }
     return false;
@@ -1757,19 +1839,19 @@ BitVectorMul::is_consistent(const BitVector& t, uint64_t pos_x)
   if (t.is_zero())
   {
     // Consistent value: t = 0: random value
-    BV_NODE_CACHE_CONSISTENT(BitVector(x.size(), *d_rng));
+    BV_NODE_CACHE_CONSISTENT(VALUE(x.size(), *this->d_rng));
   }
   else
   {
-    d_consistent.reset(new BitVector(BitVector(
-        x.size(), *d_rng, BitVector::mk_one(size), BitVector::mk_ones(size))));
+    this->d_consistent.reset(new VALUE(VALUE(
+        x.size(), *this->d_rng, VALUE::mk_one(size), VALUE::mk_ones(size))));
 
     if (t.lsb())
     {
       // Consistent value: t = odd: random odd value
-      if (!d_consistent->lsb())
+      if (!this->d_consistent->lsb())
       {
-        d_consistent->set_bit(0, true);
+        this->d_consistent->set_bit(0, true);
       }
     }
     else
@@ -1778,27 +1860,29 @@ BitVectorMul::is_consistent(const BitVector& t, uint64_t pos_x)
       assert(!x.has_fixed_bits());
       uint64_t ctz_t = t.count_trailing_zeros();
       /* choose consistent value as 2^n with prob 0.1 */
-      if (d_rng->pick_with_prob(100))
+      if (this->d_rng->pick_with_prob(100))
       {
-        d_consistent->iset(0);
-        d_consistent->set_bit(d_rng->pick<uint64_t>(0, ctz_t - 1), true);
+        this->d_consistent->iset(0);
+        this->d_consistent->set_bit(
+            this->d_rng->template pick<uint64_t>(0, ctz_t - 1), true);
       }
       /* choose consistent value as t / 2^n with prob 0.1 */
-      else if (d_rng->pick_with_prob(100))
+      else if (this->d_rng->pick_with_prob(100))
       {
-        d_consistent->iset(t);
-        uint64_t r = d_rng->pick<uint64_t>(0, ctz_t);
+        this->d_consistent->iset(t);
+        uint64_t r = this->d_rng->template pick<uint64_t>(0, ctz_t);
         if (r > 0)
         {
-          d_consistent->ibvshr(r);
+          this->d_consistent->ibvshr(r);
         }
       }
       /* choose random value with ctz(t) >= ctz(res) with prob 0.8 */
       else
       {
-        if (d_consistent->count_trailing_zeros() > ctz_t)
+        if (this->d_consistent->count_trailing_zeros() > ctz_t)
         {
-          d_consistent->set_bit(d_rng->pick<uint64_t>(0, ctz_t - 1), true);
+          this->d_consistent->set_bit(
+              this->d_rng->template pick<uint64_t>(0, ctz_t - 1), true);
         }
       }
     }
@@ -1806,94 +1890,103 @@ BitVectorMul::is_consistent(const BitVector& t, uint64_t pos_x)
   return true;
 }
 
-const BitVector&
-BitVectorMul::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvMul<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  uint64_t pos_s     = 1 - pos_x;
-  const BitVector& s = child(pos_s)->assignment();
-  assert(d_inverse);
-  assert(pos_x == 1 || t.compare(d_inverse->bvmul(s)) == 0);
-  assert(pos_x == 0 || t.compare(s.bvmul(*d_inverse)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  uint64_t pos_s = 1 - pos_x;
+  const VALUE& s = this->child(pos_s)->assignment();
+  assert(this->d_inverse);
+  assert(pos_x == 1 || t.compare(this->d_inverse->bvmul(s)) == 0);
+  assert(pos_x == 0 || t.compare(s.bvmul(*this->d_inverse)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
-const BitVector&
-BitVectorMul::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvMul<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  assert(d_consistent);
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(x.match_fixed_bits(*d_consistent));
+  assert(this->d_consistent);
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(x.match_fixed_bits(*this->d_consistent));
 #endif
-  return *d_consistent;
+  return *this->d_consistent;
 }
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorShl::BitVectorShl(RNG* rng,
-                           uint64_t size,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1)
-    : BitVectorNode(rng, size, child0, child1)
+template <class VALUE>
+BvShl<VALUE>::BvShl(RNG* rng,
+                    uint64_t size,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, size, child0, child1)
 {
   assert(size == child0->size());
   assert(child0->size() == child1->size());
   _evaluate_and_set_domain();
 }
 
-BitVectorShl::BitVectorShl(RNG* rng,
-                           const BitVectorDomain& domain,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1)
-    : BitVectorNode(rng, domain, child0, child1)
+template <class VALUE>
+BvShl<VALUE>::BvShl(RNG* rng,
+                    const BvDomain<VALUE>& domain,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, domain, child0, child1)
 {
   assert(child0->size() == child1->size());
   assert(domain.size() == child0->size());
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorShl::_evaluate()
+BvShl<VALUE>::_evaluate()
 {
-  d_assignment.ibvshl(child(0)->assignment(), child(1)->assignment());
+  this->d_assignment.ibvshl(this->child(0)->assignment(),
+                            this->child(1)->assignment());
 }
 
+template <class VALUE>
 void
-BitVectorShl::_evaluate_and_set_domain()
+BvShl<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorShl::evaluate()
+BvShl<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 bool
-BitVectorShl::is_invertible(const BitVector& t,
+BvShl<VALUE>::is_invertible(const VALUE& t,
                             uint64_t pos_x,
                             bool is_essential_check)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * IC_wo: pos_x = 0: (t >> s) << s = t
@@ -1913,8 +2006,8 @@ BitVectorShl::is_invertible(const BitVector& t,
    */
 
   uint64_t pos_s           = 1 - pos_x;
-  const BitVector& s       = child(pos_s)->assignment();
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const VALUE& s           = this->child(pos_s)->assignment();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   uint64_t ctz_t           = 0;
   uint64_t ctz_s           = 0;
   bool x_has_fixed_bits    = x.has_fixed_bits();
@@ -1941,7 +2034,7 @@ BitVectorShl::is_invertible(const BitVector& t,
     // fixed: x << s = t
     if (x.is_fixed())
     {
-      const BitVector& xval = x.lo();
+      const VALUE& xval = x.lo();
       if ((pos_x == 0 && xval.bvshl(s).compare(t) == 0)
           || (pos_x == 1 && s.bvshl(xval).compare(t) == 0))
       {
@@ -1967,7 +2060,7 @@ BitVectorShl::is_invertible(const BitVector& t,
         uint64_t shift;
         if (size > 64)
         {
-          if (s.compare(BitVector::from_ui(s.size(), UINT64_MAX)) >= 0)
+          if (s.compare(VALUE::from_ui(s.size(), UINT64_MAX)) >= 0)
           {
             shift = UINT64_MAX;
           }
@@ -1988,35 +2081,35 @@ BitVectorShl::is_invertible(const BitVector& t,
           // random value
           if (x_has_fixed_bits)
           {
-            BitVectorDomainGenerator gen(x, d_rng);
+            BvDomainGenerator<VALUE> gen(x, this->d_rng);
             assert(gen.has_random());
             BV_NODE_CACHE_INVERSE(gen.random());
           }
           else
           {
-            BV_NODE_CACHE_INVERSE(BitVector(size, *d_rng));
+            BV_NODE_CACHE_INVERSE(VALUE(size, *this->d_rng));
           }
         }
         else if (shift > 0)
         {
-          BitVector left;
+          VALUE left;
           if (x_has_fixed_bits)
           {
-            BitVectorDomain x_ext = x.bvextract(size - 1, size - shift);
+            BvDomain<VALUE> x_ext = x.bvextract(size - 1, size - shift);
             if (x_ext.is_fixed())
             {
               left = x_ext.lo();
             }
             else
             {
-              BitVectorDomainGenerator gen(x_ext, d_rng);
+              BvDomainGenerator<VALUE> gen(x_ext, this->d_rng);
               assert(gen.has_random());
               left = gen.random();
             }
           }
           else
           {
-            left = BitVector(shift, *d_rng);
+            left = VALUE(shift, *this->d_rng);
           }
           BV_NODE_CACHE_INVERSE(
               std::move(left.ibvconcat(t.bvextract(size - 1, shift))));
@@ -2043,23 +2136,23 @@ BitVectorShl::is_invertible(const BitVector& t,
             // Inverse value: s = 0: random value
             if (x_has_fixed_bits)
             {
-              BitVectorDomainGenerator gen(x, d_rng, x.lo(), x.hi());
+              BvDomainGenerator<VALUE> gen(x, this->d_rng, x.lo(), x.hi());
               assert(gen.has_random());
               BV_NODE_CACHE_INVERSE(gen.random());
             }
             else
             {
-              BV_NODE_CACHE_INVERSE(BitVector(size, *d_rng));
+              BV_NODE_CACHE_INVERSE(VALUE(size, *this->d_rng));
             }
           }
           return true;
         }
-        BitVector min = BitVector::from_ui(size, ctz_t - ctz_s);
+        VALUE min = VALUE::from_ui(size, ctz_t - ctz_s);
         if (x_has_fixed_bits)
         {
           if (x.hi().compare(min) >= 0)
           {
-            BitVectorDomainGenerator gen(x, d_rng, min, x.hi());
+            BvDomainGenerator<VALUE> gen(x, this->d_rng, min, x.hi());
             assert(gen.has_random());
             // Inverse value: t = 0: ctz(t) - ctz(s) <= res < size
             BV_NODE_CACHE_INVERSE(gen.random());
@@ -2070,28 +2163,29 @@ BitVectorShl::is_invertible(const BitVector& t,
         else
         {
           BV_NODE_CACHE_INVERSE(
-              BitVector(size, *d_rng, min, BitVector::mk_ones(size)));
+              VALUE(size, *this->d_rng, min, VALUE::mk_ones(size)));
           return true;
         }
       }
       ic = !x_has_fixed_bits
-           || x.match_fixed_bits(BitVector::from_ui(x.size(), ctz_t - ctz_s));
+           || x.match_fixed_bits(VALUE::from_ui(x.size(), ctz_t - ctz_s));
       if (ic && !is_essential_check)
       {
         // Inverse value: t != 0: ctz(t) - ctz(s)
         uint64_t shift = ctz_t - ctz_s;
-        BV_NODE_CACHE_INVERSE(BitVector::from_ui(size, shift));
+        BV_NODE_CACHE_INVERSE(VALUE::from_ui(size, shift));
       }
     }
   }
   return ic;
 }
 
+template <class VALUE>
 bool
-BitVectorShl::is_consistent(const BitVector& t, uint64_t pos_x)
+BvShl<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * CC_wo: true
@@ -2105,7 +2199,7 @@ BitVectorShl::is_consistent(const BitVector& t, uint64_t pos_x)
    *              t > 0: random value <= ctz(t)
    */
 
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   bool x_has_fixed_bits    = x.has_fixed_bits();
   uint64_t ctz_t           = t.count_trailing_zeros();
   uint64_t size            = t.size();
@@ -2124,13 +2218,13 @@ BitVectorShl::is_consistent(const BitVector& t, uint64_t pos_x)
         }
         else
         {
-          BitVectorDomainGenerator gen(x, d_rng);
+          BvDomainGenerator<VALUE> gen(x, this->d_rng);
           BV_NODE_CACHE_CONSISTENT(gen.random());
         }
       }
       else
       {
-        d_consistent.reset(new BitVector(size, *d_rng));
+        this->d_consistent.reset(new VALUE(size, *this->d_rng));
       }
     }
     else
@@ -2140,38 +2234,39 @@ BitVectorShl::is_consistent(const BitVector& t, uint64_t pos_x)
       {
         if (x.is_fixed())
         {
-          uint64_t ctz_x        = x.lo().count_trailing_zeros();
-          const BitVector& xval = x.lo();
+          uint64_t ctz_x    = x.lo().count_trailing_zeros();
+          const VALUE& xval = x.lo();
           if (xval.bvshl(ctz_t - ctz_x).compare(t) == 0)
           {
-            d_consistent.reset(new BitVector(xval));
+            this->d_consistent.reset(new VALUE(xval));
             return true;
           }
           return false;
         }
 
-        std::vector<BitVector> stack;
+        std::vector<VALUE> stack;
         for (uint64_t i = 0; i <= ctz_t; ++i)
         {
-          BitVectorDomain x_slice = x.bvextract(size - 1 - i, 0);
-          BitVector t_slice       = t.bvextract(size - 1, i);
+          BvDomain<VALUE> x_slice = x.bvextract(size - 1 - i, 0);
+          VALUE t_slice           = t.bvextract(size - 1, i);
           if (x_slice.match_fixed_bits(t_slice)) stack.push_back(t_slice);
         }
         if (!stack.empty())
         {
-          uint64_t i          = d_rng->pick<uint64_t>(0, stack.size() - 1);
-          BitVector& right    = stack[i];
+          uint64_t i =
+              this->d_rng->template pick<uint64_t>(0, stack.size() - 1);
+          VALUE& right        = stack[i];
           uint64_t size_right = right.size();
           if (size == size_right)
           {
-            d_consistent.reset(new BitVector(right));
+            this->d_consistent.reset(new VALUE(right));
           }
           else
           {
-            BitVectorDomainGenerator gen(x, d_rng);
+            BvDomainGenerator<VALUE> gen(x, this->d_rng);
             assert(gen.has_random());
-            d_consistent.reset(
-                new BitVector(gen.random()
+            this->d_consistent.reset(
+                new VALUE(gen.random()
                                   .ibvextract(size - 1, size_right)
                                   .ibvconcat(right)));
           }
@@ -2181,15 +2276,15 @@ BitVectorShl::is_consistent(const BitVector& t, uint64_t pos_x)
       }
       else
       {
-        uint64_t shift = d_rng->pick<uint64_t>(0, ctz_t);
+        uint64_t shift = this->d_rng->template pick<uint64_t>(0, ctz_t);
         if (shift == 0)
         {
-          d_consistent.reset(new BitVector(t));
+          this->d_consistent.reset(new VALUE(t));
         }
         else
         {
-          d_consistent.reset(
-              new BitVector(BitVector(shift, *d_rng)
+          this->d_consistent.reset(
+              new VALUE(VALUE(shift, *this->d_rng)
                                 .ibvconcat(t.bvextract(size - 1, shift))));
         }
         return true;
@@ -2205,7 +2300,7 @@ BitVectorShl::is_consistent(const BitVector& t, uint64_t pos_x)
     {
       if (x.is_fixed())
       {
-        if (BitVector::from_ui(size, max).compare(x.lo()) >= 0)
+        if (VALUE::from_ui(size, max).compare(x.lo()) >= 0)
         {
           BV_NODE_CACHE_CONSISTENT(x.lo());
           return true;
@@ -2213,8 +2308,8 @@ BitVectorShl::is_consistent(const BitVector& t, uint64_t pos_x)
         return false;
       }
 
-      BitVectorDomainGenerator gen(
-          x, d_rng, x.lo(), BitVector::from_ui(size, max));
+      BvDomainGenerator<VALUE> gen(
+          x, this->d_rng, x.lo(), VALUE::from_ui(size, max));
       if (gen.has_random())
       {
         BV_NODE_CACHE_CONSISTENT(gen.random());
@@ -2224,116 +2319,130 @@ BitVectorShl::is_consistent(const BitVector& t, uint64_t pos_x)
     }
     else
     {
-      d_consistent.reset(new BitVector(
-          BitVector::from_ui(size, d_rng->pick<uint64_t>(0, max))));
+      this->d_consistent.reset(new VALUE(
+          VALUE::from_ui(size, this->d_rng->template pick<uint64_t>(0, max))));
     }
   }
   return true;
 }
 
-const BitVector&
-BitVectorShl::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvShl<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  uint64_t pos_s     = 1 - pos_x;
-  const BitVector& s = child(pos_s)->assignment();
-  assert(d_inverse);
-  assert(pos_x == 1 || t.compare(d_inverse->bvshl(s)) == 0);
-  assert(pos_x == 0 || t.compare(s.bvshl(*d_inverse)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  uint64_t pos_s = 1 - pos_x;
+  const VALUE& s = this->child(pos_s)->assignment();
+  assert(this->d_inverse);
+  assert(pos_x == 1 || t.compare(this->d_inverse->bvshl(s)) == 0);
+  assert(pos_x == 0 || t.compare(s.bvshl(*this->d_inverse)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
-const BitVector&
-BitVectorShl::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvShl<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  assert(d_consistent);
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(x.match_fixed_bits(*d_consistent));
+  assert(this->d_consistent);
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(x.match_fixed_bits(*this->d_consistent));
 #endif
-  return *d_consistent;
+  return *this->d_consistent;
 }
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorShr::BitVectorShr(RNG* rng,
-                           uint64_t size,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1)
-    : BitVectorNode(rng, size, child0, child1)
+template <class VALUE>
+BvShr<VALUE>::BvShr(RNG* rng,
+                    uint64_t size,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, size, child0, child1)
 {
   assert(size == child0->size());
   assert(child0->size() == child1->size());
   _evaluate_and_set_domain();
 }
 
-BitVectorShr::BitVectorShr(RNG* rng,
-                           const BitVectorDomain& domain,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1)
-    : BitVectorNode(rng, domain, child0, child1)
+template <class VALUE>
+BvShr<VALUE>::BvShr(RNG* rng,
+                    const BvDomain<VALUE>& domain,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, domain, child0, child1)
 {
   assert(child0->size() == child1->size());
   assert(domain.size() == child0->size());
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorShr::_evaluate()
+BvShr<VALUE>::_evaluate()
 {
-  d_assignment.ibvshr(child(0)->assignment(), child(1)->assignment());
+  this->d_assignment.ibvshr(this->child(0)->assignment(),
+                            this->child(1)->assignment());
 }
 
+template <class VALUE>
 void
-BitVectorShr::_evaluate_and_set_domain()
+BvShr<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorShr::evaluate()
+BvShr<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 bool
-BitVectorShr::is_invertible(const BitVector& t,
+BvShr<VALUE>::is_invertible(const VALUE& t,
                             uint64_t pos_x,
                             bool is_essential_check)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   uint64_t pos_s           = 1 - pos_x;
-  const BitVector& s       = child(pos_s)->assignment();
-  const BitVectorDomain& x = child(pos_x)->domain();
-  return is_invertible(
-      d_rng, t, s, x, pos_x, is_essential_check ? nullptr : &d_inverse);
+  const VALUE& s           = this->child(pos_s)->assignment();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  return is_invertible(this->d_rng,
+                       t,
+                       s,
+                       x,
+                       pos_x,
+                       is_essential_check ? nullptr : &this->d_inverse);
 }
 
+template <class VALUE>
 bool
-BitVectorShr::is_invertible(RNG* rng,
-                            const BitVector& t,
-                            const BitVector& s,
-                            const BitVectorDomain& x,
+BvShr<VALUE>::is_invertible(RNG* rng,
+                            const VALUE& t,
+                            const VALUE& s,
+                            const BvDomain<VALUE>& x,
                             uint64_t pos_x,
-                            std::unique_ptr<BitVector>* inverse)
+                            std::unique_ptr<VALUE>* inverse)
 {
   /**
    * IC_wo: pos_x = 0: (t << s) >> s = t
@@ -2405,13 +2514,13 @@ BitVectorShr::is_invertible(RNG* rng,
       {
         if (x_has_fixed_bits && !s.is_zero())
         {
-          BitVector min = BitVector::from_ui(size, clz_t - clz_s);
-          ic            = x.hi().compare(min) >= 0;
+          VALUE min = VALUE::from_ui(size, clz_t - clz_s);
+          ic        = x.hi().compare(min) >= 0;
         }
       }
       else if (x_has_fixed_bits)
       {
-        ic = x.match_fixed_bits(BitVector::from_ui(x.size(), clz_t - clz_s));
+        ic = x.match_fixed_bits(VALUE::from_ui(x.size(), clz_t - clz_s));
       }
     }
   }
@@ -2422,11 +2531,12 @@ BitVectorShr::is_invertible(RNG* rng,
   return ic;
 }
 
+template <class VALUE>
 bool
-BitVectorShr::is_consistent(const BitVector& t, uint64_t pos_x)
+BvShr<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * CC_wo: true
@@ -2440,7 +2550,7 @@ BitVectorShr::is_consistent(const BitVector& t, uint64_t pos_x)
    *              t > 0: random value <= clz(t)
    */
 
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   uint64_t clz_t = t.count_leading_zeros();
   uint64_t size  = t.size();
   bool x_has_fixed_bits    = x.has_fixed_bits();
@@ -2459,13 +2569,13 @@ BitVectorShr::is_consistent(const BitVector& t, uint64_t pos_x)
         }
         else
         {
-          BitVectorDomainGenerator gen(x, d_rng);
+          BvDomainGenerator<VALUE> gen(x, this->d_rng);
           BV_NODE_CACHE_CONSISTENT(gen.random());
         }
       }
       else
       {
-        d_consistent.reset(new BitVector(size, *d_rng));
+        this->d_consistent.reset(new VALUE(size, *this->d_rng));
       }
     }
     else
@@ -2478,37 +2588,38 @@ BitVectorShr::is_consistent(const BitVector& t, uint64_t pos_x)
         // fixed
         if (x.is_fixed())
         {
-          uint64_t clz_x        = x.lo().count_leading_zeros();
-          const BitVector& xval = x.lo();
+          uint64_t clz_x    = x.lo().count_leading_zeros();
+          const VALUE& xval = x.lo();
           if (xval.bvshr(clz_t - clz_x).compare(t) == 0)
           {
-            d_consistent.reset(new BitVector(xval));
+            this->d_consistent.reset(new VALUE(xval));
             return true;
           }
           return false;
         }
 
-        std::vector<BitVector> stack;
+        std::vector<VALUE> stack;
         for (uint64_t i = 0; i <= clz_t; ++i)
         {
-          BitVectorDomain x_slice = x.bvextract(size - 1, i);
-          BitVector t_slice       = t.bvextract(size - 1 - i, 0);
+          BvDomain<VALUE> x_slice = x.bvextract(size - 1, i);
+          VALUE t_slice           = t.bvextract(size - 1 - i, 0);
           if (x_slice.match_fixed_bits(t_slice)) stack.push_back(t_slice);
         }
         if (!stack.empty())
         {
-          uint64_t i         = d_rng->pick<uint64_t>(0, stack.size() - 1);
-          BitVector& left    = stack[i];
+          uint64_t i =
+              this->d_rng->template pick<uint64_t>(0, stack.size() - 1);
+          VALUE& left        = stack[i];
           uint64_t size_left = left.size();
           if (size == size_left)
           {
-            d_consistent.reset(new BitVector(left));
+            this->d_consistent.reset(new VALUE(left));
           }
           else
           {
-            BitVectorDomainGenerator gen(x, d_rng);
+            BvDomainGenerator<VALUE> gen(x, this->d_rng);
             assert(gen.has_random());
-            d_consistent.reset(new BitVector(left.ibvconcat(
+            this->d_consistent.reset(new VALUE(left.ibvconcat(
                 gen.random().ibvextract(size - 1 - size_left, 0))));
           }
           return true;
@@ -2517,16 +2628,16 @@ BitVectorShr::is_consistent(const BitVector& t, uint64_t pos_x)
       }
       else
       {
-        uint64_t shift = d_rng->pick<uint64_t>(0, clz_t);
+        uint64_t shift = this->d_rng->template pick<uint64_t>(0, clz_t);
         if (shift == 0)
         {
-          d_consistent.reset(new BitVector(t));
+          this->d_consistent.reset(new VALUE(t));
         }
         else
         {
-          d_consistent.reset(
-              new BitVector(t.bvextract(size - shift - 1, 0)
-                                .ibvconcat(BitVector(shift, *d_rng))));
+          this->d_consistent.reset(
+              new VALUE(t.bvextract(size - shift - 1, 0)
+                                .ibvconcat(VALUE(shift, *this->d_rng))));
         }
         return true;
       }
@@ -2540,7 +2651,7 @@ BitVectorShr::is_consistent(const BitVector& t, uint64_t pos_x)
     {
       if (x.is_fixed())
       {
-        if (BitVector::from_ui(size, max).compare(x.lo()) >= 0)
+        if (VALUE::from_ui(size, max).compare(x.lo()) >= 0)
         {
           BV_NODE_CACHE_CONSISTENT(x.lo());
           return true;
@@ -2548,8 +2659,8 @@ BitVectorShr::is_consistent(const BitVector& t, uint64_t pos_x)
         return false;
       }
 
-      BitVectorDomainGenerator gen(
-          x, d_rng, x.lo(), BitVector::from_ui(size, max));
+      BvDomainGenerator<VALUE> gen(
+          x, this->d_rng, x.lo(), VALUE::from_ui(size, max));
       if (gen.has_random())
       {
         BV_NODE_CACHE_CONSISTENT(gen.random());
@@ -2559,37 +2670,39 @@ BitVectorShr::is_consistent(const BitVector& t, uint64_t pos_x)
     }
     else
     {
-      d_consistent.reset(new BitVector(
-          BitVector::from_ui(size, d_rng->pick<uint64_t>(0, max))));
+      this->d_consistent.reset(new VALUE(
+          VALUE::from_ui(size, this->d_rng->template pick<uint64_t>(0, max))));
     }
   }
   return true;
 }
 
-const BitVector&
-BitVectorShr::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvShr<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  uint64_t pos_s     = 1 - pos_x;
-  const BitVector& s = child(pos_s)->assignment();
-  assert(d_inverse);
-  assert(pos_x == 1 || t.compare(d_inverse->bvshr(s)) == 0);
-  assert(pos_x == 0 || t.compare(s.bvshr(*d_inverse)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  uint64_t pos_s = 1 - pos_x;
+  const VALUE& s = this->child(pos_s)->assignment();
+  assert(this->d_inverse);
+  assert(pos_x == 1 || t.compare(this->d_inverse->bvshr(s)) == 0);
+  assert(pos_x == 0 || t.compare(s.bvshr(*this->d_inverse)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
+template <class VALUE>
 void
-BitVectorShr::inverse_value(RNG* rng,
-                            const BitVector& t,
-                            const BitVector& s,
-                            const BitVectorDomain& x,
+BvShr<VALUE>::inverse_value(RNG* rng,
+                            const VALUE& t,
+                            const VALUE& s,
+                            const BvDomain<VALUE>& x,
                             uint64_t pos_x,
-                            std::unique_ptr<BitVector>& inverse)
+                            std::unique_ptr<VALUE>& inverse)
 {
   uint64_t size = x.size();
   if (pos_x == 0)
@@ -2597,7 +2710,7 @@ BitVectorShr::inverse_value(RNG* rng,
     // pos_x = 0: t << s (with bits shifted in set randomly)
     if (x.is_fixed())
     {
-      inverse.reset(new BitVector(x.lo()));
+      inverse.reset(new VALUE(x.lo()));
     }
     else
     {
@@ -2606,7 +2719,7 @@ BitVectorShr::inverse_value(RNG* rng,
       uint64_t shift;
       if (size > 64)
       {
-        if (s.compare(BitVector::from_ui(s.size(), UINT64_MAX)) >= 0)
+        if (s.compare(VALUE::from_ui(s.size(), UINT64_MAX)) >= 0)
         {
           shift = UINT64_MAX;
         }
@@ -2624,42 +2737,42 @@ BitVectorShr::inverse_value(RNG* rng,
         // random value
         if (x.has_fixed_bits())
         {
-          BitVectorDomainGenerator gen(x, rng);
+          BvDomainGenerator<VALUE> gen(x, rng);
           assert(gen.has_random());
-          inverse.reset(new BitVector(gen.random()));
+          inverse.reset(new VALUE(gen.random()));
         }
         else
         {
-          inverse.reset(new BitVector(size, *rng));
+          inverse.reset(new VALUE(size, *rng));
         }
       }
       else if (shift > 0)
       {
-        BitVector right;
+        VALUE right;
         if (x.has_fixed_bits())
         {
-          BitVectorDomain x_ext = x.bvextract(shift - 1, 0);
+          BvDomain<VALUE> x_ext = x.bvextract(shift - 1, 0);
           if (x_ext.is_fixed())
           {
             right = x_ext.lo();
           }
           else
           {
-            BitVectorDomainGenerator gen(x_ext, rng);
+            BvDomainGenerator<VALUE> gen(x_ext, rng);
             assert(gen.has_random());
             right = gen.random();
           }
         }
         else
         {
-          right = BitVector(shift, *rng);
+          right = VALUE(shift, *rng);
         }
-        inverse.reset(new BitVector(
+        inverse.reset(new VALUE(
             std::move(t.bvextract(size - shift - 1, 0).ibvconcat(right))));
       }
       else
       {
-        inverse.reset(new BitVector(t));
+        inverse.reset(new VALUE(t));
       }
     }
   }
@@ -2671,7 +2784,7 @@ BitVectorShr::inverse_value(RNG* rng,
     //                            + else : shift
     if (x.is_fixed())
     {
-      inverse.reset(new BitVector(x.lo()));
+      inverse.reset(new VALUE(x.lo()));
     }
     else
     {
@@ -2681,31 +2794,31 @@ BitVectorShr::inverse_value(RNG* rng,
         // random value
         if (x.has_fixed_bits())
         {
-          BitVectorDomainGenerator gen(x, rng, x.lo(), x.hi());
+          BvDomainGenerator<VALUE> gen(x, rng, x.lo(), x.hi());
           assert(gen.has_random());
-          inverse.reset(new BitVector(gen.random()));
+          inverse.reset(new VALUE(gen.random()));
         }
         else
         {
-          inverse.reset(new BitVector(size, *rng));
+          inverse.reset(new VALUE(size, *rng));
         }
       }
       else if (t_is_zero)
       {
         uint64_t clz_t = t.count_leading_zeros();
         uint64_t clz_s = s.count_leading_zeros();
-        BitVector min  = BitVector::from_ui(size, clz_t - clz_s);
+        VALUE min      = VALUE::from_ui(size, clz_t - clz_s);
         assert(x.hi().compare(min) >= 0);
         if (x.has_fixed_bits())
         {
-          BitVectorDomainGenerator gen(x, rng, min, x.hi());
+          BvDomainGenerator<VALUE> gen(x, rng, min, x.hi());
           assert(gen.has_random());
-          inverse.reset(new BitVector(gen.random()));
+          inverse.reset(new VALUE(gen.random()));
         }
         else
         {
           inverse.reset(
-              new BitVector(size, *rng, min, BitVector::mk_ones(size)));
+              new VALUE(size, *rng, min, VALUE::mk_ones(size)));
         }
       }
       else
@@ -2715,84 +2828,92 @@ BitVectorShr::inverse_value(RNG* rng,
         uint64_t shift = clz_t - clz_s;
         assert(
             !x.has_fixed_bits()
-            || x.match_fixed_bits(BitVector::from_ui(x.size(), clz_t - clz_s)));
-        inverse.reset(new BitVector(BitVector::from_ui(size, shift)));
+            || x.match_fixed_bits(VALUE::from_ui(x.size(), clz_t - clz_s)));
+        inverse.reset(new VALUE(VALUE::from_ui(size, shift)));
       }
     }
   }
 }
 
-const BitVector&
-BitVectorShr::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvShr<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  assert(d_consistent);
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(x.match_fixed_bits(*d_consistent));
+  assert(this->d_consistent);
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(x.match_fixed_bits(*this->d_consistent));
 #endif
-  return *d_consistent;
+  return *this->d_consistent;
 }
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorAshr::BitVectorAshr(RNG* rng,
-                             uint64_t size,
-                             BitVectorNode* child0,
-                             BitVectorNode* child1)
-    : BitVectorNode(rng, size, child0, child1)
+template <class VALUE>
+BvAshr<VALUE>::BvAshr(RNG* rng,
+                      uint64_t size,
+                      BvNode<VALUE>* child0,
+                      BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, size, child0, child1)
 {
   assert(size == child0->size());
   assert(child0->size() == child1->size());
   _evaluate_and_set_domain();
 }
 
-BitVectorAshr::BitVectorAshr(RNG* rng,
-                             const BitVectorDomain& domain,
-                             BitVectorNode* child0,
-                             BitVectorNode* child1)
-    : BitVectorNode(rng, domain, child0, child1)
+template <class VALUE>
+BvAshr<VALUE>::BvAshr(RNG* rng,
+                      const BvDomain<VALUE>& domain,
+                      BvNode<VALUE>* child0,
+                      BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, domain, child0, child1)
 {
   assert(child0->size() == child1->size());
   assert(domain.size() == child0->size());
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorAshr::_evaluate()
+BvAshr<VALUE>::_evaluate()
 {
-  d_assignment.ibvashr(child(0)->assignment(), child(1)->assignment());
+  this->d_assignment.ibvashr(this->child(0)->assignment(),
+                             this->child(1)->assignment());
 }
 
+template <class VALUE>
 void
-BitVectorAshr::_evaluate_and_set_domain()
+BvAshr<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorAshr::evaluate()
+BvAshr<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 bool
-BitVectorAshr::is_invertible(const BitVector& t,
+BvAshr<VALUE>::is_invertible(const VALUE& t,
                              uint64_t pos_x,
                              bool is_essential_check)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * IC_wo: pos_x = 0: (s < size(s) => (t << s) >>a s = t) &&
@@ -2815,16 +2936,16 @@ BitVectorAshr::is_invertible(const BitVector& t,
    */
 
   uint64_t pos_s           = 1 - pos_x;
-  const BitVector& s       = child(pos_s)->assignment();
-  const BitVectorDomain& x = child(pos_x)->domain();
-  BitVector snot, tnot, sshr;
+  const VALUE& s           = this->child(pos_s)->assignment();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  VALUE snot, tnot, sshr;
   bool ic;
 
   if (pos_x == 0)
   {
     uint64_t size = s.size();
     // IC_wo
-    if (s.compare(BitVector::from_ui(size, size)) < 0)
+    if (s.compare(VALUE::from_ui(size, size)) < 0)
     {
       // pos_x = 0: (s < size(s) => (t << s) >>a s = t)
       ic = t.bvshl(s).ibvashr(s).compare(t) == 0;
@@ -2840,8 +2961,8 @@ BitVectorAshr::is_invertible(const BitVector& t,
     if (ic && !is_essential_check)
     {
       // Inverse value: pos_x = 0: IV_shr(x >> s = t) with msb = t[msb]
-      BitVectorShr::inverse_value(d_rng, t, s, x, 0, d_inverse);
-      d_inverse->set_bit(size - 1, t.msb());
+      BvShr<VALUE>::inverse_value(this->d_rng, t, s, x, 0, this->d_inverse);
+      this->d_inverse->set_bit(size - 1, t.msb());
     }
     return ic;
   }
@@ -2850,25 +2971,31 @@ BitVectorAshr::is_invertible(const BitVector& t,
   // IC:    pos_x = 1: IC_wo && (s[msb] = 1 => IC_shr(~s >> x = ~t))
   if (s.msb())
   {
-    return BitVectorShr::is_invertible(
-        d_rng,
+    return BvShr<VALUE>::is_invertible(
+        this->d_rng,
         t.bvnot(),
         s.bvnot(),
         x,
         pos_x,
-        is_essential_check ? nullptr : &d_inverse);
+        is_essential_check ? nullptr : &this->d_inverse);
   }
   // IC_wo: pos_x = 1: (s[msb] = 1 => IC_shr(~s >> x = ~t)
   // IC:    pos_x = 1: IC_wo && (s[msb ] = 0 => IC_shr)
-  return BitVectorShr::is_invertible(
-      d_rng, t, s, x, pos_x, is_essential_check ? nullptr : &d_inverse);
+  return BvShr<VALUE>::is_invertible(
+      this->d_rng,
+      t,
+      s,
+      x,
+      pos_x,
+      is_essential_check ? nullptr : &this->d_inverse);
 }
 
+template <class VALUE>
 bool
-BitVectorAshr::is_consistent(const BitVector& t, uint64_t pos_x)
+BvAshr<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * CC_wo: true
@@ -2890,7 +3017,7 @@ BitVectorAshr::is_consistent(const BitVector& t, uint64_t pos_x)
    *   with cnt = clz if t[msb] = 0 and cnt = clo if t[msb] = 1
    */
 
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   bool is_signed           = t.msb();
   uint64_t cnt_t = is_signed ? t.count_leading_ones() : t.count_leading_zeros();
   uint64_t size  = t.size();
@@ -2915,8 +3042,8 @@ BitVectorAshr::is_consistent(const BitVector& t, uint64_t pos_x)
     {
       if (x.has_fixed_bits())
       {
-        BitVectorDomainSignedGenerator gen(
-            x, d_rng, BitVector::mk_zero(size), BitVector::mk_max_signed(size));
+        BvDomainSignedGenerator<VALUE> gen(
+            x, this->d_rng, VALUE::mk_zero(size), VALUE::mk_max_signed(size));
         if (gen.has_random())
         {
           // Consistent value: pos_x = 0: t = 0: random value
@@ -2930,8 +3057,8 @@ BitVectorAshr::is_consistent(const BitVector& t, uint64_t pos_x)
     {
       if (x.has_fixed_bits())
       {
-        BitVectorDomainSignedGenerator gen(
-            x, d_rng, BitVector::mk_min_signed(size), BitVector::mk_ones(size));
+        BvDomainSignedGenerator<VALUE> gen(
+            x, this->d_rng, VALUE::mk_min_signed(size), VALUE::mk_ones(size));
         if (gen.has_random())
         {
           // Consistent value:
@@ -2948,20 +3075,20 @@ BitVectorAshr::is_consistent(const BitVector& t, uint64_t pos_x)
     {
       if (x.has_fixed_bits())
       {
-        BitVectorDomainGenerator gen(x, d_rng);
+        BvDomainGenerator<VALUE> gen(x, this->d_rng);
         BV_NODE_CACHE_CONSISTENT(gen.random());
       }
       else
       {
-        d_consistent.reset(new BitVector(size, *d_rng));
+        this->d_consistent.reset(new VALUE(size, *this->d_rng));
       }
-      if (is_signed && !d_consistent->msb())
+      if (is_signed && !this->d_consistent->msb())
       {
-        d_consistent->set_bit(size - 1, true);
+        this->d_consistent->set_bit(size - 1, true);
       }
-      else if (!is_signed && d_consistent->msb())
+      else if (!is_signed && this->d_consistent->msb())
       {
-        d_consistent->set_bit(size - 1, false);
+        this->d_consistent->set_bit(size - 1, false);
       }
       return true;
     }
@@ -2972,27 +3099,28 @@ BitVectorAshr::is_consistent(const BitVector& t, uint64_t pos_x)
     //     with c = ((t << y)[msb] = 1)
     if (x.has_fixed_bits())
     {
-      std::vector<BitVector> stack;
+      std::vector<VALUE> stack;
       for (uint64_t i = 0; i < cnt_t; ++i)
       {
-        BitVectorDomain x_slice = x.bvextract(size - 1, i);
-        BitVector t_slice       = t.bvextract(size - 1 - i, 0);
+        BvDomain<VALUE> x_slice = x.bvextract(size - 1, i);
+        VALUE t_slice           = t.bvextract(size - 1 - i, 0);
         if (x_slice.match_fixed_bits(t_slice)) stack.push_back(t_slice);
       }
       if (!stack.empty())
       {
-        uint64_t i         = d_rng->pick<uint64_t>(0, stack.size() - 1);
-        BitVector& left    = stack[i];
+        uint64_t i =
+            this->d_rng->template pick<uint64_t>(0, stack.size() - 1);
+        VALUE& left        = stack[i];
         uint64_t size_left = left.size();
         if (size == size_left)
         {
-          d_consistent.reset(new BitVector(left));
+          this->d_consistent.reset(new VALUE(left));
         }
         else
         {
-          BitVectorDomainGenerator gen(x, d_rng);
+          BvDomainGenerator<VALUE> gen(x, this->d_rng);
           assert(gen.has_random());
-          d_consistent.reset(new BitVector(
+          this->d_consistent.reset(new VALUE(
               left.bvconcat(gen.random().ibvextract(size - 1 - size_left, 0))));
         }
         return true;
@@ -3000,16 +3128,16 @@ BitVectorAshr::is_consistent(const BitVector& t, uint64_t pos_x)
       return false;
     }
 
-    uint64_t shift = d_rng->pick<uint64_t>(0, cnt_t - 1);
+    uint64_t shift = this->d_rng->template pick<uint64_t>(0, cnt_t - 1);
     if (shift == 0)
     {
-      d_consistent.reset(new BitVector(t));
+      this->d_consistent.reset(new VALUE(t));
     }
     else
     {
-      d_consistent.reset(
-          new BitVector(t.bvextract(size - shift - 1, 0)
-                            .ibvconcat(BitVector(shift, *d_rng))));
+      this->d_consistent.reset(
+          new VALUE(t.bvextract(size - shift - 1, 0)
+                            .ibvconcat(VALUE(shift, *this->d_rng))));
     }
     return true;
   }
@@ -3020,7 +3148,7 @@ BitVectorAshr::is_consistent(const BitVector& t, uint64_t pos_x)
   if (x.is_fixed())
   {
     if (t.is_zero() || t.is_ones()
-        || BitVector::from_ui(size, cnt_t).compare(x.lo()) > 0)
+        || VALUE::from_ui(size, cnt_t).compare(x.lo()) > 0)
     {
       BV_NODE_CACHE_CONSISTENT(x.lo());
       return true;
@@ -3033,8 +3161,8 @@ BitVectorAshr::is_consistent(const BitVector& t, uint64_t pos_x)
   uint64_t max = cnt_t < size ? cnt_t - 1 : ((1u << size) - 1);
   if (x.has_fixed_bits())
   {
-    BitVectorDomainGenerator gen(
-        x, d_rng, BitVector::mk_zero(size), BitVector::from_ui(size, max));
+    BvDomainGenerator<VALUE> gen(
+        x, this->d_rng, VALUE::mk_zero(size), VALUE::from_ui(size, max));
     if (gen.has_random())
     {
       BV_NODE_CACHE_CONSISTENT(gen.random());
@@ -3042,99 +3170,108 @@ BitVectorAshr::is_consistent(const BitVector& t, uint64_t pos_x)
     }
     return false;
   }
-  d_consistent.reset(
-      new BitVector(BitVector::from_ui(size, d_rng->pick<uint64_t>(0, max))));
+  this->d_consistent.reset(new VALUE(
+      VALUE::from_ui(size, this->d_rng->template pick<uint64_t>(0, max))));
   return true;
 }
 
-const BitVector&
-BitVectorAshr::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvAshr<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  uint64_t pos_s     = 1 - pos_x;
-  const BitVector& s = child(pos_s)->assignment();
-  assert(d_inverse);
-  assert(pos_x == 1 || t.compare(d_inverse->bvashr(s)) == 0);
-  assert(pos_x == 0 || t.compare(s.bvashr(*d_inverse)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  uint64_t pos_s = 1 - pos_x;
+  const VALUE& s = this->child(pos_s)->assignment();
+  assert(this->d_inverse);
+  assert(pos_x == 1 || t.compare(this->d_inverse->bvashr(s)) == 0);
+  assert(pos_x == 0 || t.compare(s.bvashr(*this->d_inverse)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
-const BitVector&
-BitVectorAshr::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvAshr<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  assert(d_consistent);
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(x.match_fixed_bits(*d_consistent));
+  assert(this->d_consistent);
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(x.match_fixed_bits(*this->d_consistent));
 #endif
-  return *d_consistent;
+  return *this->d_consistent;
 }
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorUdiv::BitVectorUdiv(RNG* rng,
-                             uint64_t size,
-                             BitVectorNode* child0,
-                             BitVectorNode* child1)
-    : BitVectorNode(rng, size, child0, child1)
+template <class VALUE>
+BvUdiv<VALUE>::BvUdiv(RNG* rng,
+                      uint64_t size,
+                      BvNode<VALUE>* child0,
+                      BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, size, child0, child1)
 {
   assert(size == child0->size());
   assert(child0->size() == child1->size());
   _evaluate_and_set_domain();
 }
 
-BitVectorUdiv::BitVectorUdiv(RNG* rng,
-                             const BitVectorDomain& domain,
-                             BitVectorNode* child0,
-                             BitVectorNode* child1)
-    : BitVectorNode(rng, domain, child0, child1)
+template <class VALUE>
+BvUdiv<VALUE>::BvUdiv(RNG* rng,
+                      const BvDomain<VALUE>& domain,
+                      BvNode<VALUE>* child0,
+                      BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, domain, child0, child1)
 {
   assert(child0->size() == child1->size());
   assert(domain.size() == child0->size());
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorUdiv::_evaluate()
+BvUdiv<VALUE>::_evaluate()
 {
-  d_assignment.ibvudiv(child(0)->assignment(), child(1)->assignment());
+  this->d_assignment.ibvudiv(this->child(0)->assignment(),
+                             this->child(1)->assignment());
 }
 
+template <class VALUE>
 void
-BitVectorUdiv::_evaluate_and_set_domain()
+BvUdiv<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorUdiv::evaluate()
+BvUdiv<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 bool
-BitVectorUdiv::is_invertible(const BitVector& t,
+BvUdiv<VALUE>::is_invertible(const VALUE& t,
                              uint64_t pos_x,
                              bool is_essential_check)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * IC_wo: pos_x = 0: (s * t) / s = t
@@ -3166,10 +3303,10 @@ BitVectorUdiv::is_invertible(const BitVector& t,
    */
 
   uint64_t pos_s           = 1 - pos_x;
-  const BitVector& s       = child(pos_s)->assignment();
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const VALUE& s           = this->child(pos_s)->assignment();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   bool x_has_fixed_bits    = x.has_fixed_bits();
-  BitVector s_mul_t, s_udiv_t;
+  VALUE s_mul_t, s_udiv_t;
   bool ic_wo;
 
   // IC_wo
@@ -3193,7 +3330,7 @@ BitVectorUdiv::is_invertible(const BitVector& t,
     // fixed: x / s = t
     if (x.is_fixed())
     {
-      const BitVector& xval = x.lo();
+      const VALUE& xval = x.lo();
       if ((pos_x == 0 && xval.bvudiv(s).compare(t) == 0)
           || (pos_x == 1 && s.bvudiv(xval).compare(t) == 0))
       {
@@ -3226,18 +3363,18 @@ BitVectorUdiv::is_invertible(const BitVector& t,
           // IC: ((t != 0 && s != 0 ) => \exists y. (
           //         mcb(x, y) && (~c => y < s * t + 1) &&
           //         (c => y <= ones)))
-          BitVector& min = s_mul_t;
-          BitVector max  = min.bvadd(s);
+          VALUE& min = s_mul_t;
+          VALUE max  = min.bvadd(s);
           if (max.compare(min) < 0)
           {
-            max = BitVector::mk_ones(s.size());
+            max = VALUE::mk_ones(s.size());
           }
           else
           {
             max.ibvdec();
           }
 
-          BitVectorDomainGenerator gen(x, d_rng, min, max);
+          BvDomainGenerator<VALUE> gen(x, this->d_rng, min, max);
           if (gen.has_next())
           {
             BV_NODE_CACHE_INVERSE_IF(gen.random());
@@ -3256,7 +3393,7 @@ BitVectorUdiv::is_invertible(const BitVector& t,
           {
             // Inverse value: pos_x = 0: t = ones: s = 1: ones
             assert(!x_has_fixed_bits);
-            BV_NODE_CACHE_INVERSE(BitVector::mk_ones(size));
+            BV_NODE_CACHE_INVERSE(VALUE::mk_ones(size));
           }
           else
           {
@@ -3264,13 +3401,13 @@ BitVectorUdiv::is_invertible(const BitVector& t,
             assert(s.is_zero());
             if (x_has_fixed_bits)
             {
-              BitVectorDomainGenerator gen(x, d_rng);
+              BvDomainGenerator<VALUE> gen(x, this->d_rng);
               assert(gen.has_random());
               BV_NODE_CACHE_INVERSE(gen.random());
             }
             else
             {
-              BV_NODE_CACHE_INVERSE(BitVector(size, *d_rng));
+              BV_NODE_CACHE_INVERSE(VALUE(size, *this->d_rng));
             }
           }
         }
@@ -3278,7 +3415,7 @@ BitVectorUdiv::is_invertible(const BitVector& t,
         {
           // Inverse value: pos_x = 0: s * t does not overflow: - s * t
           assert(!s.is_umul_overflow(t));
-          if (d_rng->flip_coin() && x.match_fixed_bits(s_mul_t))
+          if (this->d_rng->flip_coin() && x.match_fixed_bits(s_mul_t))
           {
             BV_NODE_CACHE_INVERSE(std::move(s_mul_t));
           }
@@ -3291,10 +3428,10 @@ BitVectorUdiv::is_invertible(const BitVector& t,
              *       ones
              * min = s * t
              */
-            BitVector max = t.bvinc();
+            VALUE max = t.bvinc();
             if (s.is_umul_overflow(max))
             {
-              max = BitVector::mk_ones(size);
+              max = VALUE::mk_ones(size);
             }
             else
             {
@@ -3302,13 +3439,13 @@ BitVectorUdiv::is_invertible(const BitVector& t,
             }
             if (x_has_fixed_bits)
             {
-              BitVectorDomainGenerator gen(x, d_rng, s_mul_t, max);
+              BvDomainGenerator<VALUE> gen(x, this->d_rng, s_mul_t, max);
               assert(gen.has_random());
               BV_NODE_CACHE_INVERSE(gen.random());
             }
             else
             {
-              BV_NODE_CACHE_INVERSE(BitVector(size, *d_rng, s_mul_t, max));
+              BV_NODE_CACHE_INVERSE(VALUE(size, *this->d_rng, s_mul_t, max));
             }
           }
         }
@@ -3331,15 +3468,15 @@ BitVectorUdiv::is_invertible(const BitVector& t,
       }
 
       uint64_t size = s.size();
-      BitVector min, max;
+      VALUE min, max;
       if (t.is_ones())
       {
-        min = BitVector::mk_zero(size);
-        max = s.is_ones() ? BitVector::mk_one(size) : min;
+        min = VALUE::mk_zero(size);
+        max = s.is_ones() ? VALUE::mk_one(size) : min;
       }
       else if (s.compare(t) == 0)
       {
-        min = BitVector::mk_one(size);
+        min = VALUE::mk_one(size);
         max = min;
       }
       else
@@ -3351,7 +3488,7 @@ BitVectorUdiv::is_invertible(const BitVector& t,
       }
       if (x_has_fixed_bits)
       {
-        BitVectorDomainGenerator gen(x, d_rng, min, max);
+        BvDomainGenerator<VALUE> gen(x, this->d_rng, min, max);
         if (gen.has_random())
         {
           BV_NODE_CACHE_INVERSE_IF(gen.random());
@@ -3360,7 +3497,7 @@ BitVectorUdiv::is_invertible(const BitVector& t,
         return false;
       }
       assert(!is_essential_check);
-      BV_NODE_CACHE_INVERSE(BitVector(size, *d_rng, min, max));
+      BV_NODE_CACHE_INVERSE(VALUE(size, *this->d_rng, min, max));
     }
     else if (!is_essential_check)
     {
@@ -3374,32 +3511,32 @@ BitVectorUdiv::is_invertible(const BitVector& t,
       uint64_t size = s.size();
       if (t.is_ones())
       {
-        BitVector one = BitVector::mk_one(size);
+        VALUE one = VALUE::mk_one(size);
         if (s.compare(t) == 0 && x.match_fixed_bits(one)
-            && (!x.match_fixed_bits(BitVector::mk_zero(size))
-                || d_rng->flip_coin()))
+            && (!x.match_fixed_bits(VALUE::mk_zero(size))
+                || this->d_rng->flip_coin()))
         {
           BV_NODE_CACHE_INVERSE(std::move(one));
         }
         else
         {
-          BV_NODE_CACHE_INVERSE(BitVector::mk_zero(size));
+          BV_NODE_CACHE_INVERSE(VALUE::mk_zero(size));
         }
       }
       else
       {
         assert(t.is_zero() && s.is_zero());
-        BitVector min = BitVector::mk_one(size);
-        BitVector max = BitVector::mk_ones(size);
+        VALUE min = VALUE::mk_one(size);
+        VALUE max = VALUE::mk_ones(size);
         if (x.has_fixed_bits())
         {
-          BitVectorDomainGenerator gen(x, d_rng, min, max);
+          BvDomainGenerator<VALUE> gen(x, this->d_rng, min, max);
           assert(gen.has_random());
           BV_NODE_CACHE_INVERSE(gen.random());
         }
         else
         {
-          BV_NODE_CACHE_INVERSE(BitVector(size, *d_rng, min, max));
+          BV_NODE_CACHE_INVERSE(VALUE(size, *this->d_rng, min, max));
         }
       }
     }
@@ -3409,11 +3546,12 @@ BitVectorUdiv::is_invertible(const BitVector& t,
   return ic_wo;
 }
 
+template <class VALUE>
 bool
-BitVectorUdiv::is_consistent(const BitVector& t, uint64_t pos_x)
+BvUdiv<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * CC_wo: true
@@ -3441,7 +3579,7 @@ BitVectorUdiv::is_consistent(const BitVector& t, uint64_t pos_x)
    *              else    : x * t such that no overflow occurs
    */
 
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   bool t_is_zero = t.is_zero();
   bool t_is_ones = t.is_ones();
   bool x_has_fixed_bits    = x.has_fixed_bits();
@@ -3464,10 +3602,10 @@ BitVectorUdiv::is_consistent(const BitVector& t, uint64_t pos_x)
         else
         {
           // Consistent value: pos_x = 0: t = 0 : random value < ones
-          BitVectorDomainGenerator gen(x,
-                                       d_rng,
-                                       BitVector::mk_zero(size),
-                                       BitVector::mk_ones(size).ibvdec());
+          BvDomainGenerator<VALUE> gen(x,
+                                       this->d_rng,
+                                       VALUE::mk_zero(size),
+                                       VALUE::mk_ones(size).ibvdec());
           assert(gen.has_random());
           BV_NODE_CACHE_CONSISTENT(gen.random());
         }
@@ -3475,10 +3613,10 @@ BitVectorUdiv::is_consistent(const BitVector& t, uint64_t pos_x)
       else
       {
         // Consistent value: pos_x = 0: t = 0 : random value < ones
-        d_consistent.reset(new BitVector(size,
-                                         *d_rng,
-                                         BitVector::mk_zero(size),
-                                         BitVector::mk_ones(size).ibvdec()));
+        this->d_consistent.reset(new VALUE(size,
+                                           *this->d_rng,
+                                           VALUE::mk_zero(size),
+                                           VALUE::mk_ones(size).ibvdec()));
       }
       return true;
     }
@@ -3494,14 +3632,14 @@ BitVectorUdiv::is_consistent(const BitVector& t, uint64_t pos_x)
         }
         else
         {
-          BitVectorDomainGenerator gen(x, d_rng);
+          BvDomainGenerator<VALUE> gen(x, this->d_rng);
           assert(gen.has_random());
           BV_NODE_CACHE_CONSISTENT(gen.random());
         }
       }
       else
       {
-        d_consistent.reset(new BitVector(size, *d_rng));
+        this->d_consistent.reset(new VALUE(size, *this->d_rng));
       }
       return true;
     }
@@ -3522,16 +3660,16 @@ BitVectorUdiv::is_consistent(const BitVector& t, uint64_t pos_x)
         }
         else
         {
-          BitVectorDomainGenerator gen(
-              x, d_rng, BitVector::mk_one(size), x.hi());
+          BvDomainGenerator<VALUE> gen(
+              x, this->d_rng, VALUE::mk_one(size), x.hi());
           assert(gen.has_random());
           BV_NODE_CACHE_CONSISTENT(gen.random());
         }
       }
       else
       {
-        d_consistent.reset(new BitVector(
-            size, *d_rng, BitVector::mk_one(size), BitVector::mk_ones(size)));
+        this->d_consistent.reset(new VALUE(
+            size, *this->d_rng, VALUE::mk_one(size), VALUE::mk_ones(size)));
       }
       return true;
     }
@@ -3541,14 +3679,14 @@ BitVectorUdiv::is_consistent(const BitVector& t, uint64_t pos_x)
     //                              and offset in [0, min(y - 1, ones - y * t)]
     if (x_has_fixed_bits)
     {
-      BitVector bvres = consistent_value_pos0_aux(t);
+      VALUE bvres = consistent_value_pos0_aux(t);
       if (bvres.is_null())
       {
         if (!x.match_fixed_bits(t))
         {
           return false;
         }
-        d_consistent.reset(new BitVector(t));
+        this->d_consistent.reset(new VALUE(t));
       }
       else
       {
@@ -3556,24 +3694,24 @@ BitVectorUdiv::is_consistent(const BitVector& t, uint64_t pos_x)
       }
       return true;
     }
-    BitVector ones = BitVector::mk_ones(size);
+    VALUE ones = VALUE::mk_ones(size);
     /* Compute x = y * t + offset with y in [1, ones / t] and
      * offset in [0, min(y - 1, ones - y * t)].  */
-    BitVector y(size, *d_rng, BitVector::mk_one(size), ones.bvudiv(t));
+    VALUE y(size, *this->d_rng, VALUE::mk_one(size), ones.bvudiv(t));
     assert(!y.is_umul_overflow(t));
     BV_NODE_CACHE_CONSISTENT(y.bvmul(t));
 
     /* Make sure that adding the offset to (y * t) does not overflow.
      * The maximum value of the offset is the minimum of
      * (y - 1, ones - (y * t)).  */
-    BitVector sub = ones.bvsub(*d_consistent);
+    VALUE sub = ones.bvsub(*this->d_consistent);
     /* Compute offset for adding to y * t. */
-    BitVector offset(size,
-                     *d_rng,
-                     BitVector::mk_zero(size),
-                     sub.compare(y.ibvdec()) < 0 ? sub : y);
-    assert(!d_consistent->is_uadd_overflow(offset));
-    d_consistent->ibvadd(offset);
+    VALUE offset(size,
+                 *this->d_rng,
+                 VALUE::mk_zero(size),
+                 sub.compare(y.ibvdec()) < 0 ? sub : y);
+    assert(!this->d_consistent->is_uadd_overflow(offset));
+    this->d_consistent->ibvadd(offset);
   }
   else
   {
@@ -3588,9 +3726,9 @@ BitVectorUdiv::is_consistent(const BitVector& t, uint64_t pos_x)
       return false;
     }
 
-    uint64_t size  = t.size();
-    BitVector zero = BitVector::mk_zero(size);
-    BitVector one  = BitVector::mk_one(size);
+    uint64_t size = t.size();
+    VALUE zero    = VALUE::mk_zero(size);
+    VALUE one     = VALUE::mk_one(size);
 
     if (t.is_ones())
     {
@@ -3602,7 +3740,7 @@ BitVectorUdiv::is_consistent(const BitVector& t, uint64_t pos_x)
         return false;
       }
       // Consistent value: pos_x = 1: t = ones: 0 or 1
-      if (!match_zero || (match_one && d_rng->flip_coin()))
+      if (!match_zero || (match_one && this->d_rng->flip_coin()))
       {
         BV_NODE_CACHE_CONSISTENT(std::move(one));
       }
@@ -3631,13 +3769,13 @@ BitVectorUdiv::is_consistent(const BitVector& t, uint64_t pos_x)
       }
 
       bool res = true;
-      BitVectorDomainGenerator gen(x, d_rng, one, x.hi());
+      BvDomainGenerator<VALUE> gen(x, this->d_rng, one, x.hi());
       assert(gen.has_random());
-      BitVector bvres = gen.random();
+      VALUE bvres = gen.random();
       while (bvres.is_umul_overflow(t))
       {
         bvres.ibvdec();
-        BitVectorDomainGenerator ggen(x, d_rng, one, bvres);
+        BvDomainGenerator<VALUE> ggen(x, this->d_rng, one, bvres);
         if (!ggen.has_random())
         {
           res = false;
@@ -3652,11 +3790,11 @@ BitVectorUdiv::is_consistent(const BitVector& t, uint64_t pos_x)
       }
       return false;
     }
-    BitVector max = BitVector::mk_ones(size);
-    BitVector bvres;
+    VALUE max = VALUE::mk_ones(size);
+    VALUE bvres;
     for (;;)
     {
-      bvres = BitVector(size, *d_rng, one, max);
+      bvres = VALUE(size, *this->d_rng, one, max);
       if (!bvres.is_umul_overflow(t)) break;
       max = bvres.ibvdec();
     }
@@ -3665,49 +3803,52 @@ BitVectorUdiv::is_consistent(const BitVector& t, uint64_t pos_x)
   return true;
 }
 
-const BitVector&
-BitVectorUdiv::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvUdiv<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  uint64_t pos_s     = 1 - pos_x;
-  const BitVector& s = child(pos_s)->assignment();
-  assert(d_inverse);
-  assert(pos_x == 1 || t.compare(d_inverse->bvudiv(s)) == 0);
-  assert(pos_x == 0 || t.compare(s.bvudiv(*d_inverse)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  uint64_t pos_s = 1 - pos_x;
+  const VALUE& s = this->child(pos_s)->assignment();
+  assert(this->d_inverse);
+  assert(pos_x == 1 || t.compare(this->d_inverse->bvudiv(s)) == 0);
+  assert(pos_x == 0 || t.compare(s.bvudiv(*this->d_inverse)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
-const BitVector&
-BitVectorUdiv::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvUdiv<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  assert(d_consistent);
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(x.match_fixed_bits(*d_consistent));
+  assert(this->d_consistent);
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(x.match_fixed_bits(*this->d_consistent));
 #endif
-  return *d_consistent;
+  return *this->d_consistent;
 }
 
-BitVector
-BitVectorUdiv::consistent_value_pos0_aux(const BitVector& t)
+template <class VALUE>
+VALUE
+BvUdiv<VALUE>::consistent_value_pos0_aux(const VALUE& t)
 {
   /* remaining solutions other than x = t:
    * min <= x <= ones with min = x->lo / t * t if x->lo / t > 1 and
    *                       min = 2 * t otherwise */
 
-  const BitVectorDomain& x = child(0)->domain();
+  const BvDomain<VALUE>& x = this->child(0)->domain();
   uint64_t size            = t.size();
-  BitVector one            = BitVector::mk_one(size);
-  BitVector max, res;
+  VALUE one                = VALUE::mk_one(size);
+  VALUE max, res;
 
-  BitVector min = x.lo().bvudiv(t);
+  VALUE min = x.lo().bvudiv(t);
   if (min.compare(one) <= 0)
   {
     if (t.is_uadd_overflow(t))
@@ -3723,23 +3864,23 @@ BitVectorUdiv::consistent_value_pos0_aux(const BitVector& t)
   }
 
   /* min / t <= s <= x->hi / t */
-  BitVector ones  = BitVector::mk_ones(size);
-  BitVector s_min = min.bvudiv(t);
-  BitVector s_max = x.hi().bvudiv(t);
+  VALUE ones  = VALUE::mk_ones(size);
+  VALUE s_min = min.bvudiv(t);
+  VALUE s_max = x.hi().bvudiv(t);
   if (s_min.compare(s_max) > 0)
   {
     s_max = ones;
   }
   for (uint32_t i = 0; i < 20; ++i)
   {
-    BitVector s_tmp(size, *d_rng, s_min, s_max);
+    VALUE s_tmp(size, *this->d_rng, s_min, s_max);
     if (s_tmp.is_umul_overflow(t))
     {
       continue;
     }
     /* for s_tmp, min = s_tmp * t and max = min + s - 1 */
     min = s_tmp.bvmul(t);
-    max = s_tmp.bvadd(min);
+    max = std::move(s_tmp).bvadd(min);
     if (min.compare(max) > 0)
     {
       max = ones;
@@ -3753,7 +3894,7 @@ BitVectorUdiv::consistent_value_pos0_aux(const BitVector& t)
       res = x.lo();
       break;
     }
-    BitVectorDomainGenerator gen(x, d_rng, min, max);
+    BvDomainGenerator<VALUE> gen(x, this->d_rng, min, max);
     if (gen.has_random())
     {
       res = gen.random();
@@ -3765,12 +3906,13 @@ BitVectorUdiv::consistent_value_pos0_aux(const BitVector& t)
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorUlt::BitVectorUlt(RNG* rng,
-                           uint64_t size,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1,
-                           bool opt_concat_sext)
-    : BitVectorNode(rng, size, child0, child1),
+template <class VALUE>
+BvUlt<VALUE>::BvUlt(RNG* rng,
+                    uint64_t size,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1,
+                    bool opt_concat_sext)
+    : BvNode<VALUE>(rng, size, child0, child1),
       d_opt_concat_sext(opt_concat_sext)
 {
   assert(size == 1);
@@ -3778,12 +3920,13 @@ BitVectorUlt::BitVectorUlt(RNG* rng,
   _evaluate_and_set_domain();
 }
 
-BitVectorUlt::BitVectorUlt(RNG* rng,
-                           const BitVectorDomain& domain,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1,
-                           bool opt_concat_sext)
-    : BitVectorNode(rng, domain, child0, child1),
+template <class VALUE>
+BvUlt<VALUE>::BvUlt(RNG* rng,
+                    const BvDomain<VALUE>& domain,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1,
+                    bool opt_concat_sext)
+    : BvNode<VALUE>(rng, domain, child0, child1),
       d_opt_concat_sext(opt_concat_sext)
 {
   assert(child0->size() == child1->size());
@@ -3791,41 +3934,46 @@ BitVectorUlt::BitVectorUlt(RNG* rng,
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorUlt::_evaluate()
+BvUlt<VALUE>::_evaluate()
 {
-  d_assignment.ibvult(child(0)->assignment(), child(1)->assignment());
+  this->d_assignment.ibvult(this->child(0)->assignment(),
+                            this->child(1)->assignment());
 }
 
+template <class VALUE>
 void
-BitVectorUlt::_evaluate_and_set_domain()
+BvUlt<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorUlt::evaluate()
+BvUlt<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 void
-BitVectorUlt::compute_min_max_bounds(const BitVector& s,
-                                     const BitVector& t,
+BvUlt<VALUE>::compute_min_max_bounds(const VALUE& s,
+                                     const VALUE& t,
                                      uint64_t pos_x,
-                                     BitVector& res_min_u,
-                                     BitVector& res_max_u,
-                                     BitVector& res_min_s,
-                                     BitVector& res_max_s)
+                                     VALUE& res_min_u,
+                                     VALUE& res_max_u,
+                                     VALUE& res_min_s,
+                                     VALUE& res_max_s)
 {
   assert(res_min_u.is_null());
   assert(res_max_u.is_null());
@@ -3843,13 +3991,13 @@ BitVectorUlt::compute_min_max_bounds(const BitVector& s,
       {
         return;
       }
-      res_min_u = BitVector::mk_zero(size);
+      res_min_u = VALUE::mk_zero(size);
       res_max_u = s.bvdec();
     }
     else
     {
       res_min_u = s;
-      res_max_u = BitVector::mk_ones(size);
+      res_max_u = VALUE::mk_ones(size);
     }
   }
   else
@@ -3861,45 +4009,46 @@ BitVectorUlt::compute_min_max_bounds(const BitVector& s,
         return;
       }
       res_min_u = s.bvinc();
-      res_max_u = BitVector::mk_ones(size);
+      res_max_u = VALUE::mk_ones(size);
     }
     else
     {
-      res_min_u = BitVector::mk_zero(size);
+      res_min_u = VALUE::mk_zero(size);
       res_max_u = s;
     }
   }
 
   // tighten unsigned bounds wrt. to current unsigned bounds of x
-  child(pos_x)->tighten_bounds(&res_min_u,
-                               &res_max_u,
-                               nullptr,
-                               nullptr,
-                               res_min_u,
-                               res_max_u,
-                               res_min_s,
-                               res_max_s);
+  this->child(pos_x)->tighten_bounds(&res_min_u,
+                                     &res_max_u,
+                                     nullptr,
+                                     nullptr,
+                                     res_min_u,
+                                     res_max_u,
+                                     res_min_s,
+                                     res_max_s);
 }
 
+template <class VALUE>
 bool
-BitVectorUlt::is_invertible(const BitVector& t,
+BvUlt<VALUE>::is_invertible(const VALUE& t,
                             uint64_t pos_x,
                             bool is_essential_check)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   bool res                 = true;
   uint64_t pos_s           = 1 - pos_x;
-  const BitVector& s       = child(pos_s)->assignment();
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const VALUE& s           = this->child(pos_s)->assignment();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   bool is_true             = t.is_true();
 
   uint64_t n = 0, bw_x = 0, bw_xx = 0;
   bool opt_sext =
-      d_opt_concat_sext && child(pos_x)->kind() == NodeKind::BV_SEXT;
-  const BitVectorDomain* dx = &x;
-  BitVectorDomain dxn, dxx, ddx;
+      d_opt_concat_sext && this->child(pos_x)->kind() == NodeKind::BV_SEXT;
+  const BvDomain<VALUE>* dx = &x;
+  BvDomain<VALUE> dxn, dxx, ddx;
 
   /**
    * IC_wo: pos_x = 0: t = 0 || s != 0
@@ -3913,7 +4062,7 @@ BitVectorUlt::is_invertible(const BitVector& t,
 
   if (opt_sext)
   {
-    n = static_cast<BitVectorSignExtend*>(child(pos_x))->get_n();
+    n = static_cast<BvSignExtend<VALUE>*>(this->child(pos_x))->get_n();
     if (n > 0)
     {
       bw_x  = x.size();
@@ -3939,7 +4088,7 @@ BitVectorUlt::is_invertible(const BitVector& t,
           // check for invertibility wrt s and fixed bits
           if (res)
           {
-            dxn.fix(BitVector::mk_ones(dxn.size()));
+            dxn.fix(VALUE::mk_ones(dxn.size()));
             ddx = dxn.bvconcat(dxx);
             ddx.fix_bit(bw_xx - 1, true);
             dx = &ddx;
@@ -3954,7 +4103,7 @@ BitVectorUlt::is_invertible(const BitVector& t,
           // check for invertibility wrt s and fixed bits
           if (res)
           {
-            dxn.fix(BitVector::mk_zero(dxn.size()));
+            dxn.fix(VALUE::mk_zero(dxn.size()));
             ddx = dxn.bvconcat(dxx);
             ddx.fix_bit(bw_xx - 1, false);
             dx = &ddx;
@@ -3964,14 +4113,14 @@ BitVectorUlt::is_invertible(const BitVector& t,
         {
           // we have to check for both cases and make sure to randomly choose
           // from either (if possible) if is_essential_check is false
-          dxn.fix(BitVector::mk_ones(dxn.size()));
+          dxn.fix(VALUE::mk_ones(dxn.size()));
           ddx = dxn.bvconcat(dxx);
           ddx.fix_bit(bw_xx - 1, true);
           dx  = &ddx;
           res = _is_invertible(dx, s, t, pos_x, is_essential_check);
-          if (!res || d_rng->flip_coin())
+          if (!res || this->d_rng->flip_coin())
           {
-            dxn.fix(BitVector::mk_zero(dxn.size()));
+            dxn.fix(VALUE::mk_zero(dxn.size()));
             ddx = dxn.bvconcat(dxx);
             ddx.fix_bit(bw_xx - 1, false);
             dx = &ddx;
@@ -3994,17 +4143,19 @@ BitVectorUlt::is_invertible(const BitVector& t,
   return res;
 }
 
+template <class VALUE>
 bool
-BitVectorUlt::_is_invertible(const BitVectorDomain* d,
-                             const BitVector& s,
-                             const BitVector& t,
+BvUlt<VALUE>::_is_invertible(const BvDomain<VALUE>* d,
+                             const VALUE& s,
+                             const VALUE& t,
                              uint64_t pos_x,
                              bool is_essential_check)
 {
   // IC_wo: pos_x = 0: t = 0 || s != 0
   //        pos_x = 1: t = 0 || s != ones
-  BitVector min_lo, max_lo, min_hi, max_hi;
-  compute_normalized_bounds(s, t, pos_x, min_lo, max_lo, min_hi, max_hi);
+  VALUE min_lo, max_lo, min_hi, max_hi;
+  this->compute_normalized_bounds(
+      s, t, pos_x, min_lo, max_lo, min_hi, max_hi);
   if (min_lo.is_null() && min_hi.is_null())
   {
     return false;
@@ -4012,8 +4163,8 @@ BitVectorUlt::_is_invertible(const BitVectorDomain* d,
 
   if (d->is_fixed())
   {
-    const BitVector& xval = d->lo();
-    if (is_in_bounds(xval, min_lo, max_lo, min_hi, max_hi))
+    const VALUE& xval = d->lo();
+    if (this->is_in_bounds(xval, min_lo, max_lo, min_hi, max_hi))
     {
       BV_NODE_CACHE_INVERSE_IF(xval);
       return true;
@@ -4024,8 +4175,8 @@ BitVectorUlt::_is_invertible(const BitVectorDomain* d,
   //    pos_x = 1: t = 1 => (s != ones && hi_x > s) && t = 0 => (lo_x <= s)
   if (d->has_fixed_bits())
   {
-    BitVectorDomainDualGenerator gen(*d,
-                                     d_rng,
+    BvDomainDualGenerator<VALUE> gen(*d,
+                                     this->d_rng,
                                      min_lo.is_null() ? nullptr : &min_lo,
                                      max_lo.is_null() ? nullptr : &max_lo,
                                      min_hi.is_null() ? nullptr : &min_hi,
@@ -4043,32 +4194,33 @@ BitVectorUlt::_is_invertible(const BitVectorDomain* d,
     if (!min_lo.is_null())
     {
       assert(!max_lo.is_null());
-      if (!min_hi.is_null() && d_rng->flip_coin())
+      if (!min_hi.is_null() && this->d_rng->flip_coin())
       {
         assert(!max_hi.is_null());
         BV_NODE_CACHE_INVERSE(
-            BitVector(d->size(), *d_rng, min_hi, max_hi, false));
+            VALUE(d->size(), *this->d_rng, min_hi, max_hi, false));
       }
       else
       {
         BV_NODE_CACHE_INVERSE(
-            BitVector(d->size(), *d_rng, min_lo, max_lo, false));
+            VALUE(d->size(), *this->d_rng, min_lo, max_lo, false));
       }
     }
     else
     {
       BV_NODE_CACHE_INVERSE(
-          BitVector(d->size(), *d_rng, min_hi, max_hi, false));
+          VALUE(d->size(), *this->d_rng, min_hi, max_hi, false));
     }
   }
   return true;
 }
 
+template <class VALUE>
 bool
-BitVectorUlt::is_consistent(const BitVector& t, uint64_t pos_x)
+BvUlt<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * CC_wo: true
@@ -4082,7 +4234,7 @@ BitVectorUlt::is_consistent(const BitVector& t, uint64_t pos_x)
    *              t = 0: random value
    */
 
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   uint64_t size            = x.size();
 
   if (pos_x == 0)
@@ -4103,10 +4255,10 @@ BitVectorUlt::is_consistent(const BitVector& t, uint64_t pos_x)
         }
         else
         {
-          BitVectorDomainGenerator gen(x,
-                                       d_rng,
-                                       BitVector::mk_zero(size),
-                                       BitVector::mk_ones(size).ibvdec());
+          BvDomainGenerator<VALUE> gen(x,
+                                       this->d_rng,
+                                       VALUE::mk_zero(size),
+                                       VALUE::mk_ones(size).ibvdec());
           assert(gen.has_random());
           BV_NODE_CACHE_CONSISTENT(gen.random());
         }
@@ -4115,11 +4267,11 @@ BitVectorUlt::is_consistent(const BitVector& t, uint64_t pos_x)
       {
         // CC_wo: true
         // Consistent value: pos_x = 0: t = 1: random value < ones
-        d_consistent.reset(
-            new BitVector(BitVector(size,
-                                    *d_rng,
-                                    BitVector::mk_zero(size),
-                                    BitVector::mk_ones(size).ibvdec())));
+        this->d_consistent.reset(
+            new VALUE(VALUE(size,
+                            *this->d_rng,
+                            VALUE::mk_zero(size),
+                            VALUE::mk_ones(size).ibvdec())));
       }
       return true;
     }
@@ -4142,8 +4294,8 @@ BitVectorUlt::is_consistent(const BitVector& t, uint64_t pos_x)
         }
         else
         {
-          BitVectorDomainGenerator gen(
-              x, d_rng, BitVector::mk_one(size), BitVector::mk_ones(size));
+          BvDomainGenerator<VALUE> gen(
+              x, this->d_rng, VALUE::mk_one(size), VALUE::mk_ones(size));
           assert(gen.has_random());
           BV_NODE_CACHE_CONSISTENT(gen.random());
         }
@@ -4152,8 +4304,8 @@ BitVectorUlt::is_consistent(const BitVector& t, uint64_t pos_x)
       {
         // CC_wo: true
         // Consistent value: pos_x = 1: t = 1: random value > 0
-        d_consistent.reset(new BitVector(BitVector(
-            size, *d_rng, BitVector::mk_one(size), BitVector::mk_ones(size))));
+        this->d_consistent.reset(new VALUE(VALUE(
+            size, *this->d_rng, VALUE::mk_one(size), VALUE::mk_ones(size))));
       }
       return true;
     }
@@ -4169,39 +4321,41 @@ BitVectorUlt::is_consistent(const BitVector& t, uint64_t pos_x)
     }
     else
     {
-      BitVectorDomainGenerator gen(x, d_rng);
+      BvDomainGenerator<VALUE> gen(x, this->d_rng);
       assert(gen.has_random());
       BV_NODE_CACHE_CONSISTENT(gen.random());
     }
   }
   else
   {
-    BV_NODE_CACHE_CONSISTENT(BitVector(size, *d_rng));
+    BV_NODE_CACHE_CONSISTENT(VALUE(size, *this->d_rng));
   }
   return true;
 }
 
-const BitVector&
-BitVectorUlt::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvUlt<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  uint64_t pos_s     = 1 - pos_x;
-  const BitVector& s = child(pos_s)->assignment();
-  assert(d_inverse);
-  assert(pos_x == 1 || t.compare(d_inverse->bvult(s)) == 0);
-  assert(pos_x == 0 || t.compare(s.bvult(*d_inverse)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  uint64_t pos_s = 1 - pos_x;
+  const VALUE& s = this->child(pos_s)->assignment();
+  assert(this->d_inverse);
+  assert(pos_x == 1 || t.compare(this->d_inverse->bvult(s)) == 0);
+  assert(pos_x == 0 || t.compare(s.bvult(*this->d_inverse)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
-BitVector
-BitVectorUlt::inverse_value_concat_new_random(const BitVectorDomain& d,
-                                              const BitVector& min,
-                                              const BitVector& max)
+template <class VALUE>
+VALUE
+BvUlt<VALUE>::inverse_value_concat_new_random(const BvDomain<VALUE>& d,
+                                              const VALUE& min,
+                                              const VALUE& max)
 {
   uint64_t size = d.size();
   assert(min.size() == size);
@@ -4209,7 +4363,7 @@ BitVectorUlt::inverse_value_concat_new_random(const BitVectorDomain& d,
 
   if (d.has_fixed_bits())
   {
-    BitVectorDomainGenerator gen(d, d_rng, min, max);
+    BvDomainGenerator<VALUE> gen(d, this->d_rng, min, max);
     if (gen.has_random())
     {
       return gen.random();
@@ -4217,36 +4371,37 @@ BitVectorUlt::inverse_value_concat_new_random(const BitVectorDomain& d,
   }
   else
   {
-    return BitVector(size, *d_rng, min, max);
+    return VALUE(size, *this->d_rng, min, max);
   }
-  return BitVector();
+  return VALUE();
 }
 
-BitVector*
-BitVectorUlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
+template <class VALUE>
+VALUE*
+BvUlt<VALUE>::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
 {
-  BitVectorNode& op_x = *child(pos_x);
+  BvNode<VALUE>& op_x = *this->child(pos_x);
   assert(op_x.kind() == NodeKind::BV_CONCAT);
-  BitVectorNode& op_s = *child(pos_s);
+  BvNode<VALUE>& op_s = *this->child(pos_s);
 
-  const BitVectorDomain& dx = op_x.domain();
+  const BvDomain<VALUE>& dx = op_x.domain();
 
   uint64_t bw_x  = op_x.size();
   uint64_t bw_x0 = op_x.child(0)->size();
   uint64_t bw_x1 = op_x.child(1)->size();
   assert(bw_x - bw_x1 == bw_x0);
 
-  const BitVector x   = op_x.assignment();
-  BitVector x0        = x.bvextract(bw_x - 1, bw_x1);
-  BitVector x1        = x.bvextract(bw_x1 - 1, 0);
-  const BitVector s   = op_s.assignment();
-  BitVector s0        = s.bvextract(bw_x - 1, bw_x1);
-  BitVector s1        = s.bvextract(bw_x1 - 1, 0);
-  BitVectorDomain dx0 = dx.bvextract(bw_x - 1, bw_x1);
-  BitVectorDomain dx1 = dx.bvextract(bw_x1 - 1, 0);
+  const VALUE x       = op_x.assignment();
+  VALUE x0            = x.bvextract(bw_x - 1, bw_x1);
+  VALUE x1            = x.bvextract(bw_x1 - 1, 0);
+  const VALUE s       = op_s.assignment();
+  VALUE s0            = s.bvextract(bw_x - 1, bw_x1);
+  VALUE s1            = s.bvextract(bw_x1 - 1, 0);
+  BvDomain<VALUE> dx0 = dx.bvextract(bw_x - 1, bw_x1);
+  BvDomain<VALUE> dx1 = dx.bvextract(bw_x1 - 1, 0);
 
-  BitVector res_x0, res_x1;
-  BitVector* res = nullptr;
+  VALUE res_x0, res_x1;
+  VALUE* res = nullptr;
 
   if (pos_x == 0)
   {
@@ -4259,11 +4414,11 @@ BitVectorUlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
       if (!s0.is_zero() && x0.compare(s0) >= 0)
       {
         res_x0 = inverse_value_concat_new_random(
-            dx0, BitVector::mk_zero(bw_x0), s0.bvdec());
+            dx0, VALUE::mk_zero(bw_x0), s0.bvdec());
         if (!res_x0.is_null())
         {
           res_x0.ibvconcat(x1);
-          if (res_x0.compare(s) < 0) res = new BitVector(res_x0);
+          if (res_x0.compare(s) < 0) res = new VALUE(res_x0);
         }
       }
 
@@ -4271,11 +4426,11 @@ BitVectorUlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
       if (!s1.is_zero() && x0.compare(s0) == 0 && x1.compare(s1) >= 0)
       {
         res_x1 = inverse_value_concat_new_random(
-            dx1, BitVector::mk_zero(bw_x1), s1.bvdec());
+            dx1, VALUE::mk_zero(bw_x1), s1.bvdec());
         if (!res_x1.is_null())
         {
           res_x1.ibvconcat(x0, res_x1);
-          if (res_x1.compare(s) < 0) res = new BitVector(res_x1);
+          if (res_x1.compare(s) < 0) res = new VALUE(res_x1);
         }
       }
     }
@@ -4286,11 +4441,11 @@ BitVectorUlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
       if (x0.compare(s0) < 0)
       {
         res_x0 =
-            inverse_value_concat_new_random(dx0, s0, BitVector::mk_ones(bw_x0));
+            inverse_value_concat_new_random(dx0, s0, VALUE::mk_ones(bw_x0));
         if (!res_x0.is_null())
         {
           res_x0.ibvconcat(x1);
-          if (res_x0.compare(s) >= 0) res = new BitVector(res_x0);
+          if (res_x0.compare(s) >= 0) res = new VALUE(res_x0);
         }
       }
 
@@ -4298,11 +4453,11 @@ BitVectorUlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
       if (x0.compare(s0) == 0 && x1.compare(s1) < 0)
       {
         res_x1 =
-            inverse_value_concat_new_random(dx1, s1, BitVector::mk_ones(bw_x1));
+            inverse_value_concat_new_random(dx1, s1, VALUE::mk_ones(bw_x1));
         if (!res_x1.is_null())
         {
           res_x1.ibvconcat(x0, res_x1);
-          if (res_x1.compare(s) >= 0) res = new BitVector(res_x1);
+          if (res_x1.compare(s) >= 0) res = new VALUE(res_x1);
         }
       }
     }
@@ -4318,11 +4473,11 @@ BitVectorUlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
       if (!s0.is_ones() && x0.compare(s0) < 0)
       {
         res_x0 = inverse_value_concat_new_random(
-            dx0, s0.bvinc(), BitVector::mk_ones(bw_x0));
+            dx0, s0.bvinc(), VALUE::mk_ones(bw_x0));
         if (!res_x0.is_null())
         {
           res_x0.ibvconcat(x1);
-          if (s.compare(res_x0) < 0) res = new BitVector(res_x0);
+          if (s.compare(res_x0) < 0) res = new VALUE(res_x0);
         }
       }
 
@@ -4331,11 +4486,11 @@ BitVectorUlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
       {
         assert(!s1.is_ones());
         res_x1 = inverse_value_concat_new_random(
-            dx1, s1.bvinc(), BitVector::mk_ones(bw_x1));
+            dx1, s1.bvinc(), VALUE::mk_ones(bw_x1));
         if (!res_x1.is_null())
         {
           res_x1.ibvconcat(x0, res_x1);
-          if (s.compare(res_x1) < 0) res = new BitVector(res_x1);
+          if (s.compare(res_x1) < 0) res = new VALUE(res_x1);
         }
       }
     }
@@ -4346,11 +4501,11 @@ BitVectorUlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
       if (s0.compare(x0) < 0)
       {
         res_x0 =
-            inverse_value_concat_new_random(dx0, BitVector::mk_zero(bw_x0), s0);
+            inverse_value_concat_new_random(dx0, VALUE::mk_zero(bw_x0), s0);
         if (!res_x0.is_null())
         {
           res_x0.ibvconcat(x1);
-          if (s.compare(res_x0) >= 0) res = new BitVector(res_x0);
+          if (s.compare(res_x0) >= 0) res = new VALUE(res_x0);
         }
       }
 
@@ -4358,11 +4513,11 @@ BitVectorUlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
       if (x0.compare(s0) == 0 && s1.compare(x1) < 0)
       {
         res_x1 =
-            inverse_value_concat_new_random(dx1, BitVector::mk_zero(bw_x1), s1);
+            inverse_value_concat_new_random(dx1, VALUE::mk_zero(bw_x1), s1);
         if (!res_x1.is_null())
         {
           res_x1.ibvconcat(x0, res_x1);
-          if (s.compare(res_x1) >= 0) res = new BitVector(res_x1);
+          if (s.compare(res_x1) >= 0) res = new VALUE(res_x1);
         }
       }
     }
@@ -4370,27 +4525,29 @@ BitVectorUlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
   return res;
 }
 
-const BitVector&
-BitVectorUlt::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvUlt<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  assert(d_consistent);
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(x.match_fixed_bits(*d_consistent));
+  assert(this->d_consistent);
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(x.match_fixed_bits(*this->d_consistent));
 #endif
-  return *d_consistent;
+  return *this->d_consistent;
 }
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorSlt::BitVectorSlt(RNG* rng,
-                           uint64_t size,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1,
-                           bool opt_concat_sext)
-    : BitVectorNode(rng, size, child0, child1),
+template <class VALUE>
+BvSlt<VALUE>::BvSlt(RNG* rng,
+                    uint64_t size,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1,
+                    bool opt_concat_sext)
+    : BvNode<VALUE>(rng, size, child0, child1),
       d_opt_concat_sext(opt_concat_sext)
 {
   assert(size == 1);
@@ -4398,12 +4555,13 @@ BitVectorSlt::BitVectorSlt(RNG* rng,
   _evaluate_and_set_domain();
 }
 
-BitVectorSlt::BitVectorSlt(RNG* rng,
-                           const BitVectorDomain& domain,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1,
-                           bool opt_concat_sext)
-    : BitVectorNode(rng, domain, child0, child1),
+template <class VALUE>
+BvSlt<VALUE>::BvSlt(RNG* rng,
+                    const BvDomain<VALUE>& domain,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1,
+                    bool opt_concat_sext)
+    : BvNode<VALUE>(rng, domain, child0, child1),
       d_opt_concat_sext(opt_concat_sext)
 {
   assert(child0->size() == child1->size());
@@ -4411,41 +4569,46 @@ BitVectorSlt::BitVectorSlt(RNG* rng,
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorSlt::_evaluate()
+BvSlt<VALUE>::_evaluate()
 {
-  d_assignment.ibvslt(child(0)->assignment(), child(1)->assignment());
+  this->d_assignment.ibvslt(this->child(0)->assignment(),
+                            this->child(1)->assignment());
 }
 
+template <class VALUE>
 void
-BitVectorSlt::_evaluate_and_set_domain()
+BvSlt<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorSlt::evaluate()
+BvSlt<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 void
-BitVectorSlt::compute_min_max_bounds(const BitVector& s,
-                                     const BitVector& t,
+BvSlt<VALUE>::compute_min_max_bounds(const VALUE& s,
+                                     const VALUE& t,
                                      uint64_t pos_x,
-                                     BitVector& res_min_u,
-                                     BitVector& res_max_u,
-                                     BitVector& res_min_s,
-                                     BitVector& res_max_s)
+                                     VALUE& res_min_u,
+                                     VALUE& res_max_u,
+                                     VALUE& res_min_s,
+                                     VALUE& res_max_s)
 {
   assert(res_min_u.is_null());
   assert(res_max_u.is_null());
@@ -4463,13 +4626,13 @@ BitVectorSlt::compute_min_max_bounds(const BitVector& s,
       {
         return;
       }
-      res_min_s = BitVector::mk_min_signed(size);
+      res_min_s = VALUE::mk_min_signed(size);
       res_max_s = s.bvdec();
     }
     else
     {
       res_min_s = s;
-      res_max_s = BitVector::mk_max_signed(size);
+      res_max_s = VALUE::mk_max_signed(size);
     }
   }
   else
@@ -4481,45 +4644,46 @@ BitVectorSlt::compute_min_max_bounds(const BitVector& s,
         return;
       }
       res_min_s = s.bvinc();
-      res_max_s = BitVector::mk_max_signed(size);
+      res_max_s = VALUE::mk_max_signed(size);
     }
     else
     {
-      res_min_s = BitVector::mk_min_signed(size);
+      res_min_s = VALUE::mk_min_signed(size);
       res_max_s = s;
     }
   }
 
   // tighten signed bounds wrt. to current signed bounds of x
-  child(pos_x)->tighten_bounds(nullptr,
-                               nullptr,
-                               &res_min_s,
-                               &res_max_s,
-                               res_min_u,
-                               res_max_u,
-                               res_min_s,
-                               res_max_s);
+  this->child(pos_x)->tighten_bounds(nullptr,
+                                     nullptr,
+                                     &res_min_s,
+                                     &res_max_s,
+                                     res_min_u,
+                                     res_max_u,
+                                     res_min_s,
+                                     res_max_s);
 }
 
+template <class VALUE>
 bool
-BitVectorSlt::is_invertible(const BitVector& t,
+BvSlt<VALUE>::is_invertible(const VALUE& t,
                             uint64_t pos_x,
                             bool is_essential_check)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   bool res                 = true;
   uint64_t pos_s           = 1 - pos_x;
-  const BitVector& s       = child(pos_s)->assignment();
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const VALUE& s           = this->child(pos_s)->assignment();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   bool is_true             = t.is_true();
 
   uint64_t n = 0, bw_x = 0, bw_xx = 0;
   bool opt_sext =
-      d_opt_concat_sext && child(pos_x)->kind() == NodeKind::BV_SEXT;
-  const BitVectorDomain* dx = &x;
-  BitVectorDomain dxn, dxx, ddx;
+      d_opt_concat_sext && this->child(pos_x)->kind() == NodeKind::BV_SEXT;
+  const BvDomain<VALUE>* dx = &x;
+  BvDomain<VALUE> dxn, dxx, ddx;
 
   /**
    * IC_wo: pos_x = 0: t = 0 || s != min_signed_value
@@ -4541,8 +4705,8 @@ BitVectorSlt::is_invertible(const BitVector& t,
 
   if (opt_sext)
   {
-    assert(child(pos_x)->kind() == NodeKind::BV_SEXT);
-    n = static_cast<BitVectorSignExtend*>(child(pos_x))->get_n();
+    assert(this->child(pos_x)->kind() == NodeKind::BV_SEXT);
+    n = static_cast<BvSignExtend<VALUE>*>(this->child(pos_x))->get_n();
     if (n > 0)
     {
       bw_x  = x.size();
@@ -4568,7 +4732,7 @@ BitVectorSlt::is_invertible(const BitVector& t,
           // check for invertibility wrt s and fixed bits
           if (res)
           {
-            dxn.fix(BitVector::mk_ones(dxn.size()));
+            dxn.fix(VALUE::mk_ones(dxn.size()));
             ddx = dxn.bvconcat(dxx);
             ddx.fix_bit(bw_xx - 1, true);
             dx = &ddx;
@@ -4583,7 +4747,7 @@ BitVectorSlt::is_invertible(const BitVector& t,
           // check for invertibility wrt s and fixed bits
           if (res)
           {
-            dxn.fix(BitVector::mk_zero(dxn.size()));
+            dxn.fix(VALUE::mk_zero(dxn.size()));
             ddx = dxn.bvconcat(dxx);
             ddx.fix_bit(bw_xx - 1, false);
             dx = &ddx;
@@ -4593,14 +4757,14 @@ BitVectorSlt::is_invertible(const BitVector& t,
         {
           // we have to check for both cases and make sure to randomly choose
           // frome either (if possible) if is_essential_check is false
-          dxn.fix(BitVector::mk_ones(dxn.size()));
+          dxn.fix(VALUE::mk_ones(dxn.size()));
           ddx = dxn.bvconcat(dxx);
           ddx.fix_bit(bw_xx - 1, true);
           dx  = &ddx;
           res = _is_invertible(dx, s, t, pos_x, is_essential_check);
-          if (!res || d_rng->flip_coin())
+          if (!res || this->d_rng->flip_coin())
           {
-            dxn.fix(BitVector::mk_zero(dxn.size()));
+            dxn.fix(VALUE::mk_zero(dxn.size()));
             ddx = dxn.bvconcat(dxx);
             ddx.fix_bit(bw_xx - 1, false);
             dx = &ddx;
@@ -4622,17 +4786,19 @@ BitVectorSlt::is_invertible(const BitVector& t,
   return res;
 }
 
+template <class VALUE>
 bool
-BitVectorSlt::_is_invertible(const BitVectorDomain* d,
-                             const BitVector& s,
-                             const BitVector& t,
+BvSlt<VALUE>::_is_invertible(const BvDomain<VALUE>* d,
+                             const VALUE& s,
+                             const VALUE& t,
                              uint64_t pos_x,
                              bool is_essential_check)
 {
   // IC_wo: pos_x = 0: t = 0 || s != min_signed_value
   //        pos_x = 1: t = 0 || s != max_signed_value
-  BitVector min_lo, max_lo, min_hi, max_hi;
-  compute_normalized_bounds(s, t, pos_x, min_lo, max_lo, min_hi, max_hi);
+  VALUE min_lo, max_lo, min_hi, max_hi;
+  this->compute_normalized_bounds(
+      s, t, pos_x, min_lo, max_lo, min_hi, max_hi);
 
   if (min_lo.is_null() && min_hi.is_null())
   {
@@ -4654,8 +4820,8 @@ BitVectorSlt::_is_invertible(const BitVectorDomain* d,
   // TODO: +bounds
   if (d->is_fixed())
   {
-    const BitVector& xval = d->lo();
-    if (is_in_bounds(xval, min_lo, max_lo, min_hi, max_hi))
+    const VALUE& xval = d->lo();
+    if (this->is_in_bounds(xval, min_lo, max_lo, min_hi, max_hi))
     {
       BV_NODE_CACHE_INVERSE_IF(d->lo());
       return true;
@@ -4664,8 +4830,8 @@ BitVectorSlt::_is_invertible(const BitVectorDomain* d,
   }
   if (d->has_fixed_bits())
   {
-    BitVectorDomainDualGenerator gen(*d,
-                                     d_rng,
+    BvDomainDualGenerator<VALUE> gen(*d,
+                                     this->d_rng,
                                      min_lo.is_null() ? nullptr : &min_lo,
                                      max_lo.is_null() ? nullptr : &max_lo,
                                      min_hi.is_null() ? nullptr : &min_hi,
@@ -4684,30 +4850,32 @@ BitVectorSlt::_is_invertible(const BitVectorDomain* d,
     if (!min_lo.is_null())
     {
       assert(!max_lo.is_null());
-      if (!min_hi.is_null() && d_rng->flip_coin())
+      if (!min_hi.is_null() && this->d_rng->flip_coin())
       {
         assert(!max_hi.is_null());
         BV_NODE_CACHE_INVERSE(
-            BitVector(d->size(), *d_rng, min_hi, max_hi, true));
+            VALUE(d->size(), *this->d_rng, min_hi, max_hi, true));
       }
       else
       {
         BV_NODE_CACHE_INVERSE(
-            BitVector(d->size(), *d_rng, min_lo, max_lo, true));
+            VALUE(d->size(), *this->d_rng, min_lo, max_lo, true));
       }
     }
     else
     {
-      BV_NODE_CACHE_INVERSE(BitVector(d->size(), *d_rng, min_hi, max_hi, true));
+      BV_NODE_CACHE_INVERSE(
+          VALUE(d->size(), *this->d_rng, min_hi, max_hi, true));
     }
   }
   return true;
 }
 
-BitVector
-BitVectorSlt::inverse_value_concat_new_random(const BitVectorDomain& d,
-                                              const BitVector& min,
-                                              const BitVector& max)
+template <class VALUE>
+VALUE
+BvSlt<VALUE>::inverse_value_concat_new_random(const BvDomain<VALUE>& d,
+                                              const VALUE& min,
+                                              const VALUE& max)
 {
   uint64_t size = d.size();
   assert(min.size() == size);
@@ -4715,7 +4883,7 @@ BitVectorSlt::inverse_value_concat_new_random(const BitVectorDomain& d,
 
   if (d.has_fixed_bits())
   {
-    BitVectorDomainSignedGenerator gen(d, d_rng, min, max);
+    BvDomainSignedGenerator<VALUE> gen(d, this->d_rng, min, max);
     if (gen.has_random())
     {
       return gen.random();
@@ -4723,36 +4891,37 @@ BitVectorSlt::inverse_value_concat_new_random(const BitVectorDomain& d,
   }
   else
   {
-    return BitVector(size, *d_rng, min, max, true);
+    return VALUE(size, *this->d_rng, min, max, true);
   }
-  return BitVector();
+  return VALUE();
 }
 
-BitVector*
-BitVectorSlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
+template <class VALUE>
+VALUE*
+BvSlt<VALUE>::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
 {
-  BitVectorNode& op_x = *child(pos_x);
+  BvNode<VALUE>& op_x = *this->child(pos_x);
   assert(op_x.kind() == NodeKind::BV_CONCAT);
-  BitVectorNode& op_s = *child(pos_s);
+  BvNode<VALUE>& op_s = *this->child(pos_s);
 
-  const BitVectorDomain& dx = op_x.domain();
+  const BvDomain<VALUE>& dx = op_x.domain();
 
   uint64_t bw_x  = op_x.size();
   uint64_t bw_x0 = op_x.child(0)->size();
   uint64_t bw_x1 = op_x.child(1)->size();
   assert(bw_x - bw_x1 == bw_x0);
 
-  const BitVector x   = op_x.assignment();
-  BitVector x0        = x.bvextract(bw_x - 1, bw_x1);
-  BitVector x1        = x.bvextract(bw_x1 - 1, 0);
-  const BitVector s   = op_s.assignment();
-  BitVector s0        = s.bvextract(bw_x - 1, bw_x1);
-  BitVector s1        = s.bvextract(bw_x1 - 1, 0);
-  BitVectorDomain dx0 = dx.bvextract(bw_x - 1, bw_x1);
-  BitVectorDomain dx1 = dx.bvextract(bw_x1 - 1, 0);
+  const VALUE x       = op_x.assignment();
+  VALUE x0            = x.bvextract(bw_x - 1, bw_x1);
+  VALUE x1            = x.bvextract(bw_x1 - 1, 0);
+  const VALUE s       = op_s.assignment();
+  VALUE s0            = s.bvextract(bw_x - 1, bw_x1);
+  VALUE s1            = s.bvextract(bw_x1 - 1, 0);
+  BvDomain<VALUE> dx0 = dx.bvextract(bw_x - 1, bw_x1);
+  BvDomain<VALUE> dx1 = dx.bvextract(bw_x1 - 1, 0);
 
-  BitVector res_x0, res_x1;
-  BitVector* res = nullptr;
+  VALUE res_x0, res_x1;
+  VALUE* res = nullptr;
 
   if (pos_x == 0)
   {
@@ -4765,11 +4934,11 @@ BitVectorSlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
       if (!s0.is_min_signed() && x0.signed_compare(s0) >= 0)
       {
         res_x0 = inverse_value_concat_new_random(
-            dx0, BitVector::mk_min_signed(bw_x0), s0.bvdec());
+            dx0, VALUE::mk_min_signed(bw_x0), s0.bvdec());
         if (!res_x0.is_null())
         {
           res_x0.ibvconcat(x1);
-          if (res_x0.signed_compare(s) < 0) res = new BitVector(res_x0);
+          if (res_x0.signed_compare(s) < 0) res = new VALUE(res_x0);
         }
       }
 
@@ -4778,11 +4947,11 @@ BitVectorSlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
           && x1.signed_compare(s1) >= 0)
       {
         res_x1 = inverse_value_concat_new_random(
-            dx1, BitVector::mk_min_signed(bw_x1), s1.bvdec());
+            dx1, VALUE::mk_min_signed(bw_x1), s1.bvdec());
         if (!res_x1.is_null())
         {
           res_x1.ibvconcat(x0, res_x1);
-          if (res_x1.signed_compare(s) < 0) res = new BitVector(res_x1);
+          if (res_x1.signed_compare(s) < 0) res = new VALUE(res_x1);
         }
       }
     }
@@ -4793,11 +4962,11 @@ BitVectorSlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
       if (x0.signed_compare(s0) < 0)
       {
         res_x0 = inverse_value_concat_new_random(
-            dx0, s0, BitVector::mk_max_signed(bw_x0));
+            dx0, s0, VALUE::mk_max_signed(bw_x0));
         if (!res_x0.is_null())
         {
           res_x0.ibvconcat(x1);
-          if (res_x0.signed_compare(s) >= 0) res = new BitVector(res_x0);
+          if (res_x0.signed_compare(s) >= 0) res = new VALUE(res_x0);
         }
       }
 
@@ -4805,11 +4974,11 @@ BitVectorSlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
       if (x0.signed_compare(s0) == 0 && x1.signed_compare(s1) < 0)
       {
         res_x1 = inverse_value_concat_new_random(
-            dx1, s1, BitVector::mk_max_signed(bw_x1));
+            dx1, s1, VALUE::mk_max_signed(bw_x1));
         if (!res_x1.is_null())
         {
           res_x1.ibvconcat(x0, res_x1);
-          if (res_x1.signed_compare(s) >= 0) res = new BitVector(res_x1);
+          if (res_x1.signed_compare(s) >= 0) res = new VALUE(res_x1);
         }
       }
     }
@@ -4825,11 +4994,11 @@ BitVectorSlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
       if (!s0.is_max_signed() && x0.signed_compare(s0) < 0)
       {
         res_x0 = inverse_value_concat_new_random(
-            dx0, s0.bvinc(), BitVector::mk_max_signed(bw_x0));
+            dx0, s0.bvinc(), VALUE::mk_max_signed(bw_x0));
         if (!res_x0.is_null())
         {
           res_x0.ibvconcat(x1);
-          if (s.signed_compare(res_x0) < 0) res = new BitVector(res_x0);
+          if (s.signed_compare(res_x0) < 0) res = new VALUE(res_x0);
         }
       }
 
@@ -4839,11 +5008,11 @@ BitVectorSlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
       {
         assert(!s1.is_max_signed());
         res_x1 = inverse_value_concat_new_random(
-            dx1, s1.bvinc(), BitVector::mk_max_signed(bw_x1));
+            dx1, s1.bvinc(), VALUE::mk_max_signed(bw_x1));
         if (!res_x1.is_null())
         {
           res_x1.ibvconcat(x0, res_x1);
-          if (s.signed_compare(res_x1) < 0) res = new BitVector(res_x1);
+          if (s.signed_compare(res_x1) < 0) res = new VALUE(res_x1);
         }
       }
     }
@@ -4854,11 +5023,11 @@ BitVectorSlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
       if (s0.signed_compare(x0) < 0)
       {
         res_x0 = inverse_value_concat_new_random(
-            dx0, BitVector::mk_min_signed(bw_x0), s0);
+            dx0, VALUE::mk_min_signed(bw_x0), s0);
         if (!res_x0.is_null())
         {
           res_x0.ibvconcat(x1);
-          if (s.signed_compare(res_x0) >= 0) res = new BitVector(res_x0);
+          if (s.signed_compare(res_x0) >= 0) res = new VALUE(res_x0);
         }
       }
 
@@ -4866,11 +5035,11 @@ BitVectorSlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
       if (x0.signed_compare(s0) == 0 && s1.signed_compare(x1) < 0)
       {
         res_x1 = inverse_value_concat_new_random(
-            dx1, BitVector::mk_min_signed(bw_x1), s1);
+            dx1, VALUE::mk_min_signed(bw_x1), s1);
         if (!res_x1.is_null())
         {
           res_x1.ibvconcat(x0, res_x1);
-          if (s.signed_compare(res_x1) >= 0) res = new BitVector(res_x1);
+          if (s.signed_compare(res_x1) >= 0) res = new VALUE(res_x1);
         }
       }
     }
@@ -4878,11 +5047,12 @@ BitVectorSlt::inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s)
   return res;
 }
 
+template <class VALUE>
 bool
-BitVectorSlt::is_consistent(const BitVector& t, uint64_t pos_x)
+BvSlt<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * CC_wo: true
@@ -4896,7 +5066,7 @@ BitVectorSlt::is_consistent(const BitVector& t, uint64_t pos_x)
    *              t = 0: random value
    */
 
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   uint64_t size            = x.size();
 
   if (pos_x == 0)
@@ -4919,11 +5089,11 @@ BitVectorSlt::is_consistent(const BitVector& t, uint64_t pos_x)
         {
           // CC_wo: true
           // Consistent value: pos_x = 0: t = 1: random value <s max_signed
-          BitVectorDomainSignedGenerator gen(
+          BvDomainSignedGenerator<VALUE> gen(
               x,
-              d_rng,
-              BitVector::mk_min_signed(size),
-              BitVector::mk_max_signed(size).ibvdec());
+              this->d_rng,
+              VALUE::mk_min_signed(size),
+              VALUE::mk_max_signed(size).ibvdec());
           assert(gen.has_random());
           BV_NODE_CACHE_CONSISTENT(gen.random());
         }
@@ -4932,12 +5102,12 @@ BitVectorSlt::is_consistent(const BitVector& t, uint64_t pos_x)
       {
         // CC_wo: true
         // Consistent value: pos_x = 0: t = 1: random value <s max_signed
-        d_consistent.reset(
-            new BitVector(BitVector(size,
-                                    *d_rng,
-                                    BitVector::mk_min_signed(size),
-                                    BitVector::mk_max_signed(size).ibvdec(),
-                                    true)));
+        this->d_consistent.reset(
+            new VALUE(VALUE(size,
+                            *this->d_rng,
+                            VALUE::mk_min_signed(size),
+                            VALUE::mk_max_signed(size).ibvdec(),
+                            true)));
       }
       return true;
     }
@@ -4962,11 +5132,11 @@ BitVectorSlt::is_consistent(const BitVector& t, uint64_t pos_x)
         {
           // CC_wo: true
           // Consistent value: pos_x = 1: t = 1: random value >s min_signed
-          BitVectorDomainSignedGenerator gen(
+          BvDomainSignedGenerator<VALUE> gen(
               x,
-              d_rng,
-              BitVector::mk_min_signed(size).ibvinc(),
-              BitVector::mk_max_signed(size));
+              this->d_rng,
+              VALUE::mk_min_signed(size).ibvinc(),
+              VALUE::mk_max_signed(size));
           assert(gen.has_random());
           BV_NODE_CACHE_CONSISTENT(gen.random());
         }
@@ -4975,12 +5145,12 @@ BitVectorSlt::is_consistent(const BitVector& t, uint64_t pos_x)
       {
         // CC_wo: true
         // Consistent value: pos_x = 1: t = 1: random value <s max_signed
-        d_consistent.reset(
-            new BitVector(BitVector(size,
-                                    *d_rng,
-                                    BitVector::mk_min_signed(size).ibvinc(),
-                                    BitVector::mk_max_signed(size),
-                                    true)));
+        this->d_consistent.reset(
+            new VALUE(VALUE(size,
+                            *this->d_rng,
+                            VALUE::mk_min_signed(size).ibvinc(),
+                            VALUE::mk_max_signed(size),
+                            true)));
       }
       return true;
     }
@@ -4996,55 +5166,58 @@ BitVectorSlt::is_consistent(const BitVector& t, uint64_t pos_x)
     }
     else
     {
-      BitVectorDomainGenerator gen(x, d_rng);
+      BvDomainGenerator<VALUE> gen(x, this->d_rng);
       assert(gen.has_random());
       BV_NODE_CACHE_CONSISTENT(gen.random());
     }
   }
   else
   {
-    BV_NODE_CACHE_CONSISTENT(BitVector(size, *d_rng));
+    BV_NODE_CACHE_CONSISTENT(VALUE(size, *this->d_rng));
   }
   return true;
 }
 
-const BitVector&
-BitVectorSlt::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvSlt<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  uint64_t pos_s     = 1 - pos_x;
-  const BitVector& s = child(pos_s)->assignment();
-  assert(d_inverse);
-  assert(pos_x == 1 || t.compare(d_inverse->bvslt(s)) == 0);
-  assert(pos_x == 0 || t.compare(s.bvslt(*d_inverse)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  uint64_t pos_s = 1 - pos_x;
+  const VALUE& s = this->child(pos_s)->assignment();
+  assert(this->d_inverse);
+  assert(pos_x == 1 || t.compare(this->d_inverse->bvslt(s)) == 0);
+  assert(pos_x == 0 || t.compare(s.bvslt(*this->d_inverse)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
-const BitVector&
-BitVectorSlt::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvSlt<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  assert(d_consistent);
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(x.match_fixed_bits(*d_consistent));
+  assert(this->d_consistent);
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(x.match_fixed_bits(*this->d_consistent));
 #endif
-  return *d_consistent;
+  return *this->d_consistent;
 }
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorUrem::BitVectorUrem(RNG* rng,
-                             uint64_t size,
-                             BitVectorNode* child0,
-                             BitVectorNode* child1)
-    : BitVectorNode(rng, size, child0, child1)
+template <class VALUE>
+BvUrem<VALUE>::BvUrem(RNG* rng,
+                      uint64_t size,
+                      BvNode<VALUE>* child0,
+                      BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, size, child0, child1)
 {
   assert(size == child0->size());
   assert(child0->size() == child1->size());
@@ -5052,11 +5225,12 @@ BitVectorUrem::BitVectorUrem(RNG* rng,
   _evaluate_and_set_domain();
 }
 
-BitVectorUrem::BitVectorUrem(RNG* rng,
-                             const BitVectorDomain& domain,
-                             BitVectorNode* child0,
-                             BitVectorNode* child1)
-    : BitVectorNode(rng, domain, child0, child1)
+template <class VALUE>
+BvUrem<VALUE>::BvUrem(RNG* rng,
+                      const BvDomain<VALUE>& domain,
+                      BvNode<VALUE>* child0,
+                      BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, domain, child0, child1)
 {
   assert(child0->size() == child1->size());
   assert(domain.size() == child0->size());
@@ -5064,40 +5238,45 @@ BitVectorUrem::BitVectorUrem(RNG* rng,
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorUrem::_evaluate()
+BvUrem<VALUE>::_evaluate()
 {
-  d_assignment.ibvurem(child(0)->assignment(), child(1)->assignment());
+  this->d_assignment.ibvurem(this->child(0)->assignment(),
+                             this->child(1)->assignment());
 }
 
+template <class VALUE>
 void
-BitVectorUrem::_evaluate_and_set_domain()
+BvUrem<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorUrem::evaluate()
+BvUrem<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 bool
-BitVectorUrem::is_invertible(const BitVector& t,
+BvUrem<VALUE>::is_invertible(const VALUE& t,
                              uint64_t pos_x,
                              bool is_essential_check)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * IC_wo: pos_x = 0: ~(-s) >= t
@@ -5114,8 +5293,8 @@ BitVectorUrem::is_invertible(const BitVector& t,
    */
 
   uint64_t pos_s           = 1 - pos_x;
-  const BitVector& s       = child(pos_s)->assignment();
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const VALUE& s           = this->child(pos_s)->assignment();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   bool x_has_fixed_bits    = x.has_fixed_bits();
   bool ic;
 
@@ -5166,8 +5345,8 @@ BitVectorUrem::is_invertible(const BitVector& t,
       assert(s.compare(t) > 0);
       // if simplest solution (0 <= res < s: res = t) does not apply,
       // x = s * n + t with n s.t. (s * n + t) does not overflow
-      uint64_t size  = x.size();
-      BitVector ones = BitVector::mk_ones(size);
+      uint64_t size = x.size();
+      VALUE ones    = VALUE::mk_ones(size);
       if (ones.bvsub(s).compare(t) < 0)
       {
         // overflow for n = 1 -> only simplest solution possible
@@ -5189,11 +5368,11 @@ BitVectorUrem::is_invertible(const BitVector& t,
       // -> ~0 - s * n >= t
 
       // s > t -> n_hi = ~0 / t (subtracting t is redundant)
-      BitVector n_hi = ones.bvudiv(s);
+      VALUE n_hi = ones.bvudiv(s);
       assert(!n_hi.is_zero());
       // ~0 - s * n_hi < t ? decrease n_hi until >= t
-      BitVector mul = s.bvmul(n_hi);
-      BitVector sub = ones.bvsub(mul);
+      VALUE mul = s.bvmul(n_hi);
+      VALUE sub = ones.bvsub(mul);
       while (sub.compare(t) < 0)
       {
         n_hi.ibvdec();
@@ -5201,16 +5380,16 @@ BitVectorUrem::is_invertible(const BitVector& t,
         sub.ibvsub(ones, mul);
       }
       // hi = s * n_hi + t (upper bound for x)
-      BitVector hi = mul.bvadd(t);
+      VALUE hi = std::move(mul).bvadd(t);
       // x->lo <= x <= hi
-      BitVectorDomainGenerator gen(x, d_rng, x.lo(), hi);
+      BvDomainGenerator<VALUE> gen(x, this->d_rng, x.lo(), hi);
       bool res = false;
       if (gen.has_random())
       {
         for (uint32_t cnt = 0; cnt < 10000; ++cnt)
         {
-          BitVector bv  = gen.random();
-          BitVector rem = bv.bvurem(s);
+          VALUE bv  = gen.random();
+          VALUE rem = bv.bvurem(s);
           if (rem.compare(t) == 0)
           {
             res = true;
@@ -5228,7 +5407,7 @@ BitVectorUrem::is_invertible(const BitVector& t,
       uint64_t size = x.size();
       if (t.is_ones())
       {
-        BitVector zero = BitVector::mk_zero(size);
+        VALUE zero = VALUE::mk_zero(size);
         if (x_has_fixed_bits && !x.match_fixed_bits(zero))
         {
           return false;
@@ -5245,8 +5424,8 @@ BitVectorUrem::is_invertible(const BitVector& t,
         {
           if (!is_essential_check)
           {
-            BitVector zero = BitVector::mk_zero(size);
-            if (d_rng->pick_with_prob(250)
+            VALUE zero = VALUE::mk_zero(size);
+            if (this->d_rng->pick_with_prob(250)
                 && (!x_has_fixed_bits || x.match_fixed_bits(zero)))
             {
               BV_NODE_CACHE_INVERSE(std::move(zero));
@@ -5259,8 +5438,8 @@ BitVectorUrem::is_invertible(const BitVector& t,
               }
               else
               {
-                BitVectorDomainGenerator gen(
-                    x, d_rng, t.bvinc(), BitVector::mk_ones(size));
+                BvDomainGenerator<VALUE> gen(
+                    x, this->d_rng, t.bvinc(), VALUE::mk_ones(size));
                 if (!gen.has_random())
                 {
                   assert(x.match_fixed_bits(zero));
@@ -5275,7 +5454,7 @@ BitVectorUrem::is_invertible(const BitVector& t,
             else
             {
               BV_NODE_CACHE_INVERSE(
-                  BitVector(size, *d_rng, t.bvinc(), BitVector::mk_ones(size)));
+                  VALUE(size, *this->d_rng, t.bvinc(), VALUE::mk_ones(size)));
             }
           }
           return true;
@@ -5292,7 +5471,7 @@ BitVectorUrem::is_invertible(const BitVector& t,
        * fixed bits of x may not match s - t. In this case, we look for a
        * factor n s.t. x = (s - t) / n, where fixed bits match. */
       assert(t.compare(s) <= 0);
-      BitVector n = s.bvsub(t);
+      VALUE n = s.bvsub(t);
       /* Is (s - t) a solution?
        *
        * -> if yes we do not immediately cache the result to enforce that
@@ -5302,12 +5481,12 @@ BitVectorUrem::is_invertible(const BitVector& t,
       if (x_has_fixed_bits && !x.match_fixed_bits(n))
       {
         // if (t.is_zero() && x.match_fixed_bits(BitVector::mk_one(size)))
-        if (!t.is_zero() || !x.match_fixed_bits(BitVector::mk_one(size)))
+        if (!t.is_zero() || !x.match_fixed_bits(VALUE::mk_one(size)))
         {
           // s - t does not match const bits of x and one is not a possible
           // solution. Find factor n of (s - t) s.t. n > t and n matches the
           // const bits of x. Pick x = n.
-          BitVector bv = x.get_factor(d_rng, n, t, 10000);
+          VALUE bv = x.get_factor(this->d_rng, n, t, 10000);
           assert(bv.is_null() || x.match_fixed_bits(bv));
           if (bv.is_null())
           {
@@ -5323,27 +5502,27 @@ BitVectorUrem::is_invertible(const BitVector& t,
         assert(s.compare(t) > 0);
         assert(t.is_zero() || t.compare(s.bvdec()) != 0);
 
-        BitVector sub = s.bvsub(t);
+        VALUE sub = s.bvsub(t);
         assert(sub.compare(t) > 0);
         bool x_match_sub = !x_has_fixed_bits || x.match_fixed_bits(sub);
 
-        if (d_rng->flip_coin() && x_match_sub)
+        if (this->d_rng->flip_coin() && x_match_sub)
         {
           BV_NODE_CACHE_INVERSE(std::move(sub));
         }
         else
         {
-          BitVector one = BitVector::mk_one(size);
+          VALUE one = VALUE::mk_one(size);
           bool x_match_one =
               t.is_zero() && (!x_has_fixed_bits || x.match_fixed_bits(one));
 
-          if (d_rng->pick_with_prob(100) && x_match_one)
+          if (this->d_rng->pick_with_prob(100) && x_match_one)
           {
             BV_NODE_CACHE_INVERSE(std::move(one));
           }
           else
           {
-            BitVector bv = x.get_factor(d_rng, sub, t, 10000);
+            VALUE bv = x.get_factor(this->d_rng, sub, t, 10000);
             assert(bv.is_null() || x.match_fixed_bits(bv));
             if (!bv.is_null())
             {
@@ -5354,7 +5533,7 @@ BitVectorUrem::is_invertible(const BitVector& t,
               assert(x_match_one || x_match_sub);
               if (x_match_one && x_match_sub)
               {
-                if (d_rng->flip_coin())
+                if (this->d_rng->flip_coin())
                 {
                   BV_NODE_CACHE_INVERSE(std::move(sub));
                 }
@@ -5382,13 +5561,14 @@ BitVectorUrem::is_invertible(const BitVector& t,
   return ic;
 }
 
+template <class VALUE>
 bool
-BitVectorUrem::is_consistent(const BitVector& t, uint64_t pos_x)
+BvUrem<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   bool t_is_ones           = t.is_ones();
   bool x_has_fixed_bits    = x.has_fixed_bits();
   uint64_t size            = t.size();
@@ -5424,14 +5604,14 @@ BitVectorUrem::is_consistent(const BitVector& t, uint64_t pos_x)
         {
           return false;
         }
-        BV_NODE_CACHE_CONSISTENT(BitVector::mk_ones(size));
+        BV_NODE_CACHE_CONSISTENT(VALUE::mk_ones(size));
         return true;
       }
 
       // mcb(x, t): pick t with probability 0.1
-      if (mcb && d_rng->pick_with_prob(100))
+      if (mcb && this->d_rng->pick_with_prob(100))
       {
-        d_consistent.reset(new BitVector(t));
+        this->d_consistent.reset(new VALUE(t));
         return true;
       }
 
@@ -5439,7 +5619,7 @@ BitVectorUrem::is_consistent(const BitVector& t, uint64_t pos_x)
       //                   (t > (ones - t) => mcb (x, t)) &&
       //                   (t < (ones - t) => mcb(x, t) ||
       //                    \exists y. (mcb(x, y) && y> 2*t))
-      int32_t cmp_t = t.compare(BitVector::mk_ones(size).ibvsub(t));
+      int32_t cmp_t = t.compare(VALUE::mk_ones(size).ibvsub(t));
 
       if (cmp_t > 0 && !mcb)
       {
@@ -5451,10 +5631,10 @@ BitVectorUrem::is_consistent(const BitVector& t, uint64_t pos_x)
         // x > t: pick s > t such that x = s + t does not overflow
         //        -> t < s < ones - t
         //        -> 2*t + 1 <= x <= ones
-        BitVector bvres = consistent_value_pos0_aux(t);
+        VALUE bvres = consistent_value_pos0_aux(t);
         if (!bvres.is_null())
         {
-          d_consistent.reset(new BitVector(bvres));
+          this->d_consistent.reset(new VALUE(bvres));
           return true;
         }
         else if (!mcb)
@@ -5464,13 +5644,13 @@ BitVectorUrem::is_consistent(const BitVector& t, uint64_t pos_x)
       }
 
       assert(mcb);
-      d_consistent.reset(new BitVector(t));
+      this->d_consistent.reset(new VALUE(t));
       return true;
     }
     else
     {
-      BitVector zero = BitVector::mk_zero(size);
-      bool mcb       = x.match_fixed_bits(zero);
+      VALUE zero = VALUE::mk_zero(size);
+      bool mcb   = x.match_fixed_bits(zero);
 
       // CC: pos_x = 1: t = ones => mcb(x, 0)
       if (t_is_ones)
@@ -5479,26 +5659,26 @@ BitVectorUrem::is_consistent(const BitVector& t, uint64_t pos_x)
         {
           return false;
         }
-        d_consistent.reset(new BitVector(zero));
+        this->d_consistent.reset(new VALUE(zero));
         return true;
       }
 
       // mcb(x, 0): pick 0 with probability 0.1
-      if (mcb && d_rng->pick_with_prob(100))
+      if (mcb && this->d_rng->pick_with_prob(100))
       {
-        d_consistent.reset(new BitVector(zero));
+        this->d_consistent.reset(new VALUE(zero));
         return true;
       }
 
       // CC: pos_x = 1: !mcb(x, 0) &&
       //                (t != ones => \exists y. (mcb(x, y) && y > t))
-      BitVector min = t.bvinc();
+      VALUE min = t.bvinc();
       if (x.is_fixed() && x.lo().compare(min) >= 0)
       {
         BV_NODE_CACHE_CONSISTENT(x.lo());
         return true;
       }
-      BitVectorDomainGenerator gen(x, d_rng, min, x.hi());
+      BvDomainGenerator<VALUE> gen(x, this->d_rng, min, x.hi());
       if (gen.has_random())
       {
         BV_NODE_CACHE_CONSISTENT(gen.random());
@@ -5510,7 +5690,7 @@ BitVectorUrem::is_consistent(const BitVector& t, uint64_t pos_x)
       }
 
       assert(mcb);
-      d_consistent.reset(new BitVector(zero));
+      this->d_consistent.reset(new VALUE(zero));
       return true;
     }
   }
@@ -5522,85 +5702,88 @@ BitVectorUrem::is_consistent(const BitVector& t, uint64_t pos_x)
     if (t_is_ones)
     {
       // Consistent value: pos_x = 0: t = ones: ones
-      BV_NODE_CACHE_CONSISTENT(BitVector::mk_ones(size));
+      BV_NODE_CACHE_CONSISTENT(VALUE::mk_ones(size));
     }
-    else if (d_rng->pick_with_prob(100))
+    else if (this->d_rng->pick_with_prob(100))
     {
       // Consistent value: pos_x = 0: t != ones: t
-      d_consistent.reset(new BitVector(t));
+      this->d_consistent.reset(new VALUE(t));
     }
     else
     {
       // Consistent value: pos_x = 0: t != ones: x = s * t with x > t
       //                                         s.t. no overflow occurs
-      BitVector max = BitVector::mk_ones(size).ibvsub(t);
-      BitVector min = t.bvinc();
+      VALUE max = VALUE::mk_ones(size).ibvsub(t);
+      VALUE min = t.bvinc();
       if (min.compare(max) > 0)
       {
-        d_consistent.reset(new BitVector(t));
+        this->d_consistent.reset(new VALUE(t));
       }
       else
       {
-        d_consistent.reset(
-            new BitVector(BitVector(size, *d_rng, min, max).ibvadd(t)));
+        this->d_consistent.reset(
+            new VALUE(VALUE(size, *this->d_rng, min, max).ibvadd(t)));
       }
     }
   }
   else
   {
-    if (t_is_ones || d_rng->pick_with_prob(100))
+    if (t_is_ones || this->d_rng->pick_with_prob(100))
     {
       // Consistent value: pos_x = 1: t = ones: 0
-      BV_NODE_CACHE_CONSISTENT(BitVector::mk_zero(size));
+      BV_NODE_CACHE_CONSISTENT(VALUE::mk_zero(size));
     }
     else
     {
       // Consistent value: pos_x = 1: t != ones: 0 or random value > t
-      d_consistent.reset(
-          new BitVector(size, *d_rng, t.bvinc(), BitVector::mk_ones(size)));
+      this->d_consistent.reset(
+          new VALUE(size, *this->d_rng, t.bvinc(), VALUE::mk_ones(size)));
     }
   }
 
   return true;
 }
 
-const BitVector&
-BitVectorUrem::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvUrem<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  uint64_t pos_s     = 1 - pos_x;
-  const BitVector& s = child(pos_s)->assignment();
-  assert(d_inverse);
-  assert(pos_x == 1 || t.compare(d_inverse->bvurem(s)) == 0);
-  assert(pos_x == 0 || t.compare(s.bvurem(*d_inverse)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  uint64_t pos_s = 1 - pos_x;
+  const VALUE& s = this->child(pos_s)->assignment();
+  assert(this->d_inverse);
+  assert(pos_x == 1 || t.compare(this->d_inverse->bvurem(s)) == 0);
+  assert(pos_x == 0 || t.compare(s.bvurem(*this->d_inverse)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
-const BitVector&
-BitVectorUrem::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvUrem<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(x.match_fixed_bits(*d_consistent));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(x.match_fixed_bits(*this->d_consistent));
 #endif
-  return *d_consistent;
+  return *this->d_consistent;
 }
 
-BitVector
-BitVectorUrem::consistent_value_pos0_aux(const BitVector& t)
+template <class VALUE>
+VALUE
+BvUrem<VALUE>::consistent_value_pos0_aux(const VALUE& t)
 {
   /* x > t:
    * pick s > t such that x = s + t does not overflow -> t < s < ones - t
    * -> 2*t + 1 <= x <= ones */
-  const BitVectorDomain& x = child(0)->domain();
-  BitVector min            = t.bvinc();
+  const BvDomain<VALUE>& x = this->child(0)->domain();
+  VALUE min                = t.bvinc();
   if (!min.is_uadd_overflow(t))
   {
     min.ibvadd(t);
@@ -5608,75 +5791,82 @@ BitVectorUrem::consistent_value_pos0_aux(const BitVector& t)
     {
       return x.lo();
     }
-    BitVectorDomainGenerator gen(x, d_rng, min, x.hi());
+    BvDomainGenerator<VALUE> gen(x, this->d_rng, min, x.hi());
     if (gen.has_random())
     {
       return gen.random();
     }
   }
-  return BitVector();
+  return VALUE();
 }
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorXor::BitVectorXor(RNG* rng,
-                           uint64_t size,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1)
-    : BitVectorNode(rng, size, child0, child1)
+template <class VALUE>
+BvXor<VALUE>::BvXor(RNG* rng,
+                    uint64_t size,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, size, child0, child1)
 {
   assert(size == child0->size());
   assert(child0->size() == child1->size());
   _evaluate_and_set_domain();
 }
 
-BitVectorXor::BitVectorXor(RNG* rng,
-                           const BitVectorDomain& domain,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1)
-    : BitVectorNode(rng, domain, child0, child1)
+template <class VALUE>
+BvXor<VALUE>::BvXor(RNG* rng,
+                    const BvDomain<VALUE>& domain,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1)
+    : BvNode<VALUE>(rng, domain, child0, child1)
 {
   assert(child0->size() == child1->size());
   assert(domain.size() == child0->size());
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorXor::_evaluate()
+BvXor<VALUE>::_evaluate()
 {
-  d_assignment.ibvxor(child(0)->assignment(), child(1)->assignment());
+  this->d_assignment.ibvxor(this->child(0)->assignment(),
+                            this->child(1)->assignment());
 }
 
+template <class VALUE>
 void
-BitVectorXor::_evaluate_and_set_domain()
+BvXor<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorXor::evaluate()
+BvXor<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 bool
-BitVectorXor::is_invertible(const BitVector& t,
+BvXor<VALUE>::is_invertible(const VALUE& t,
                             uint64_t pos_x,
                             bool is_essential_check)
 {
   (void) is_essential_check;
 
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * IC_wo: true
@@ -5685,9 +5875,9 @@ BitVectorXor::is_invertible(const BitVector& t,
    * Inverse value: s ^ t
    */
 
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   uint64_t pos_s           = 1 - pos_x;
-  const BitVector& s       = child(pos_s)->assignment();
+  const VALUE& s           = this->child(pos_s)->assignment();
   if (x.has_fixed_bits())
   {
     if (!x.match_fixed_bits(s.bvxor(t)))
@@ -5699,11 +5889,12 @@ BitVectorXor::is_invertible(const BitVector& t,
   return true;
 }
 
+template <class VALUE>
 bool
-BitVectorXor::is_consistent(const BitVector& t, uint64_t pos_x)
+BvXor<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * CC_wo: true
@@ -5713,7 +5904,7 @@ BitVectorXor::is_consistent(const BitVector& t, uint64_t pos_x)
    */
 
   (void) t;
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   if (x.has_fixed_bits())
   {
     if (x.is_fixed())
@@ -5722,55 +5913,58 @@ BitVectorXor::is_consistent(const BitVector& t, uint64_t pos_x)
     }
     else
     {
-      BitVectorDomainGenerator gen(x, d_rng);
+      BvDomainGenerator<VALUE> gen(x, this->d_rng);
       assert(gen.has_random());
       BV_NODE_CACHE_CONSISTENT(gen.random());
     }
   }
   else
   {
-    d_consistent.reset(new BitVector(x.size(), *d_rng));
+    this->d_consistent.reset(new VALUE(x.size(), *this->d_rng));
   }
   return true;
 }
 
-const BitVector&
-BitVectorXor::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvXor<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  uint64_t pos_s     = 1 - pos_x;
-  const BitVector& s = child(pos_s)->assignment();
-  assert(d_inverse);
-  assert(pos_x == 1 || t.compare(d_inverse->bvxor(s)) == 0);
-  assert(pos_x == 0 || t.compare(s.bvxor(*d_inverse)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  uint64_t pos_s = 1 - pos_x;
+  const VALUE& s = this->child(pos_s)->assignment();
+  assert(this->d_inverse);
+  assert(pos_x == 1 || t.compare(this->d_inverse->bvxor(s)) == 0);
+  assert(pos_x == 0 || t.compare(s.bvxor(*this->d_inverse)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
-const BitVector&
-BitVectorXor::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvXor<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(x.match_fixed_bits(*d_consistent));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(x.match_fixed_bits(*this->d_consistent));
 #endif
-  return *d_consistent;
+  return *this->d_consistent;
 }
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorIte::BitVectorIte(RNG* rng,
-                           uint64_t size,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1,
-                           BitVectorNode* child2)
-    : BitVectorNode(rng, size, child0, child1, child2)
+template <class VALUE>
+BvIte<VALUE>::BvIte(RNG* rng,
+                    uint64_t size,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1,
+                    BvNode<VALUE>* child2)
+    : BvNode<VALUE>(rng, size, child0, child1, child2)
 {
   assert(size == child1->size());
   assert(child0->size() == 1);
@@ -5778,12 +5972,13 @@ BitVectorIte::BitVectorIte(RNG* rng,
   _evaluate_and_set_domain();
 }
 
-BitVectorIte::BitVectorIte(RNG* rng,
-                           const BitVectorDomain& domain,
-                           BitVectorNode* child0,
-                           BitVectorNode* child1,
-                           BitVectorNode* child2)
-    : BitVectorNode(rng, domain, child0, child1, child2)
+template <class VALUE>
+BvIte<VALUE>::BvIte(RNG* rng,
+                    const BvDomain<VALUE>& domain,
+                    BvNode<VALUE>* child0,
+                    BvNode<VALUE>* child1,
+                    BvNode<VALUE>* child2)
+    : BvNode<VALUE>(rng, domain, child0, child1, child2)
 {
   assert(child0->size() == 1);
   assert(child1->size() == child2->size());
@@ -5791,51 +5986,57 @@ BitVectorIte::BitVectorIte(RNG* rng,
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorIte::_evaluate()
+BvIte<VALUE>::_evaluate()
 {
-  d_assignment.ibvite(
-      child(0)->assignment(), child(1)->assignment(), child(2)->assignment());
+  this->d_assignment.ibvite(this->child(0)->assignment(),
+                            this->child(1)->assignment(),
+                            this->child(2)->assignment());
 }
 
+template <class VALUE>
 void
-BitVectorIte::_evaluate_and_set_domain()
+BvIte<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorIte::evaluate()
+BvIte<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 bool
-BitVectorIte::is_essential(const BitVector& t, uint64_t pos_x)
+BvIte<VALUE>::is_essential(const VALUE& t, uint64_t pos_x)
 {
   uint64_t pos_s0 = pos_x == 0 ? 1 : 0;
   uint64_t pos_s1 = pos_x == 2 ? 1 : 2;
   return !is_invertible(t, pos_s0, true) && !is_invertible(t, pos_s1, true);
 }
 
+template <class VALUE>
 bool
-BitVectorIte::is_invertible(const BitVector& t,
+BvIte<VALUE>::is_invertible(const VALUE& t,
                             uint64_t pos_x,
                             bool is_essential_check)
 {
   (void) is_essential_check;
 
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * IC_wo: pos_x = 0: s0 == t || s1 == t
@@ -5865,9 +6066,9 @@ BitVectorIte::is_invertible(const BitVector& t,
 
   uint64_t pos_s0          = pos_x == 0 ? 1 : 0;
   uint64_t pos_s1          = pos_x == 2 ? 1 : 2;
-  const BitVector& s0      = child(pos_s0)->assignment();
-  const BitVector& s1      = child(pos_s1)->assignment();
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const VALUE& s0          = this->child(pos_s0)->assignment();
+  const VALUE& s1          = this->child(pos_s1)->assignment();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   bool x_has_fixed_bits    = x.has_fixed_bits();
 
   if (pos_x == 0)
@@ -5892,37 +6093,37 @@ BitVectorIte::is_invertible(const BitVector& t,
         {
           if (x_has_fixed_bits)
           {
-            if (d_rng->flip_coin())
+            if (this->d_rng->flip_coin())
             {
-              BitVector bv = BitVector::mk_true();
+              VALUE bv = VALUE::mk_true();
               if (x.match_fixed_bits(bv))
               {
                 BV_NODE_CACHE_INVERSE(std::move(bv));
               }
               else
               {
-                BV_NODE_CACHE_INVERSE(BitVector::mk_false());
+                BV_NODE_CACHE_INVERSE(VALUE::mk_false());
               }
             }
             else
             {
-              BV_NODE_CACHE_INVERSE(BitVector::mk_false());
+              BV_NODE_CACHE_INVERSE(VALUE::mk_false());
             }
           }
           else
           {
-            BV_NODE_CACHE_INVERSE(d_rng->flip_coin() ? BitVector::mk_true()
-                                                     : BitVector::mk_false());
+            BV_NODE_CACHE_INVERSE(this->d_rng->flip_coin() ? VALUE::mk_true()
+                                                           : VALUE::mk_false());
           }
         }
         else if (cmp0)
         {
-          BV_NODE_CACHE_INVERSE(BitVector::mk_true());
+          BV_NODE_CACHE_INVERSE(VALUE::mk_true());
         }
         else
         {
           assert(cmp1);
-          BV_NODE_CACHE_INVERSE(BitVector::mk_false());
+          BV_NODE_CACHE_INVERSE(VALUE::mk_false());
         }
       }
       return true;
@@ -5941,7 +6142,7 @@ BitVectorIte::is_invertible(const BitVector& t,
     {
       // return current assignment for disabled branch
       BV_NODE_CACHE_INVERSE_IF(
-          x.get_copy_with_fixed_bits(child(pos_x)->assignment()));
+          x.get_copy_with_fixed_bits(this->child(pos_x)->assignment()));
       return true;
     }
     return false;
@@ -5958,17 +6159,18 @@ BitVectorIte::is_invertible(const BitVector& t,
   {
     // return current assignment for disabled branch
     BV_NODE_CACHE_INVERSE_IF(
-        x.get_copy_with_fixed_bits(child(pos_x)->assignment()));
+        x.get_copy_with_fixed_bits(this->child(pos_x)->assignment()));
     return true;
   }
   return false;
 }
 
+template <class VALUE>
 bool
-BitVectorIte::is_consistent(const BitVector& t, uint64_t pos_x)
+BvIte<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * CC_wo: true
@@ -5980,8 +6182,8 @@ BitVectorIte::is_consistent(const BitVector& t, uint64_t pos_x)
    *              enabled branch : t if bits in x match, else current assignment
    */
 
-  const BitVectorDomain& x = child(pos_x)->domain();
-  const BitVector& s0      = child(0)->assignment();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  const VALUE& s0          = this->child(0)->assignment();
   uint64_t size            = x.size();
 
   if (pos_x == 0)
@@ -5992,9 +6194,9 @@ BitVectorIte::is_consistent(const BitVector& t, uint64_t pos_x)
     }
     else
     {
-      d_consistent.reset(new BitVector(d_rng->flip_coin()
-                                           ? BitVector::mk_one(size)
-                                           : BitVector::mk_zero(size)));
+      this->d_consistent.reset(new VALUE(this->d_rng->flip_coin()
+                                           ? VALUE::mk_one(size)
+                                           : VALUE::mk_zero(size)));
     }
   }
   else if ((pos_x == 1 && s0.is_false()) || (pos_x == 2 && s0.is_true())
@@ -6003,56 +6205,59 @@ BitVectorIte::is_consistent(const BitVector& t, uint64_t pos_x)
     // If the current assignment does not match fixed bits in x, which can
     // happen with const bits propagated from top-level constraints, we fix the
     // assignment of those bits to match these const bits.
-    d_consistent.reset(
-        new BitVector(x.get_copy_with_fixed_bits(child(pos_x)->assignment())));
+    this->d_consistent.reset(new VALUE(
+        x.get_copy_with_fixed_bits(this->child(pos_x)->assignment())));
   }
   else
   {
-    d_consistent.reset(new BitVector(t));
+    this->d_consistent.reset(new VALUE(t));
   }
   return true;
 }
 
-const BitVector&
-BitVectorIte::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvIte<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  uint64_t pos_s0     = pos_x == 0 ? 1 : 0;
-  uint64_t pos_s1     = pos_x == 2 ? 1 : 2;
-  const BitVector& s0 = child(pos_s0)->assignment();
-  const BitVector& s1 = child(pos_s1)->assignment();
-  assert(d_inverse);
-  assert(pos_x != 0 || t.compare(BitVector::bvite(*d_inverse, s0, s1)) == 0);
-  assert(pos_x != 1 || t.compare(BitVector::bvite(s0, *d_inverse, s1)) == 0);
-  assert(pos_x != 2 || t.compare(BitVector::bvite(s0, s1, *d_inverse)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  uint64_t pos_s0 = pos_x == 0 ? 1 : 0;
+  uint64_t pos_s1 = pos_x == 2 ? 1 : 2;
+  const VALUE& s0 = this->child(pos_s0)->assignment();
+  const VALUE& s1 = this->child(pos_s1)->assignment();
+  assert(this->d_inverse);
+  assert(pos_x != 0 || t.compare(VALUE::bvite(*this->d_inverse, s0, s1)) == 0);
+  assert(pos_x != 1 || t.compare(VALUE::bvite(s0, *this->d_inverse, s1)) == 0);
+  assert(pos_x != 2 || t.compare(VALUE::bvite(s0, s1, *this->d_inverse)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
-const BitVector&
-BitVectorIte::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvIte<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(x.match_fixed_bits(*d_consistent));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(x.match_fixed_bits(*this->d_consistent));
 #endif
-  return *d_consistent;
+  return *this->d_consistent;
 }
 
+template <class VALUE>
 uint64_t
-BitVectorIte::select_path_non_const(std::vector<uint64_t>& inputs) const
+BvIte<VALUE>::select_path_non_const(std::vector<uint64_t>& inputs) const
 {
   assert(inputs.empty());
-  bool cond = child(0)->assignment().is_true();
-  for (uint32_t i = 0; i < d_arity; ++i)
+  bool cond = this->child(0)->assignment().is_true();
+  for (uint32_t i = 0; i < this->d_arity; ++i)
   {
-    if (child(i)->is_value()) continue;
+    if (this->child(i)->is_value()) continue;
     if (i == 1 && !cond) continue;
     if (i == 2 && cond) continue;
     inputs.push_back(i);
@@ -6064,8 +6269,9 @@ BitVectorIte::select_path_non_const(std::vector<uint64_t>& inputs) const
   return static_cast<uint64_t>(-1);
 }
 
+template <class VALUE>
 std::tuple<uint64_t, bool, bool>
-BitVectorIte::select_path(const BitVector& t, std::vector<uint64_t>& ess_inputs)
+BvIte<VALUE>::select_path(const VALUE& t, std::vector<uint64_t>& ess_inputs)
 {
   assert(!all_value());
 
@@ -6082,7 +6288,8 @@ BitVectorIte::select_path(const BitVector& t, std::vector<uint64_t>& ess_inputs)
   bool checked_essential = false;
   /* select essential input if any and path selection based on essential
    * inputs is enabled. */
-  if (s_path_sel_essential && d_rng->pick_with_prob(s_prob_pick_ess_input))
+  if (this->s_path_sel_essential
+      && this->d_rng->pick_with_prob(this->s_prob_pick_ess_input))
   {
     /* determine essential inputs, disabled branches are excluded */
     checked_essential = true;
@@ -6092,7 +6299,9 @@ BitVectorIte::select_path(const BitVector& t, std::vector<uint64_t>& ess_inputs)
     }
     if (!ess_inputs.empty())
     {
-      pos_x = d_rng->pick_from_set<std::vector<uint64_t>, uint64_t>(ess_inputs);
+      pos_x = this->d_rng
+                  ->template pick_from_set<std::vector<uint64_t>, uint64_t>(
+                      ess_inputs);
     }
   }
 
@@ -6105,16 +6314,18 @@ BitVectorIte::select_path(const BitVector& t, std::vector<uint64_t>& ess_inputs)
      * in the test setting (when covering all cases), and we guard for this. */
     if (inputs.empty())
     {
-      assert(child(0)->is_value());
-      assert(child(0)->assignment().is_true()
-             || (!child(1)->is_value() && child(2)->is_value()));
-      assert(child(0)->assignment().is_false()
-             || (!child(2)->is_value() && child(1)->is_value()));
-      pos_x = child(0)->assignment().is_true() ? 2 : 1;
+      assert(this->child(0)->is_value());
+      assert(this->child(0)->assignment().is_true()
+             || (!this->child(1)->is_value() && this->child(2)->is_value()));
+      assert(this->child(0)->assignment().is_false()
+             || (!this->child(2)->is_value() && this->child(1)->is_value()));
+      pos_x = this->child(0)->assignment().is_true() ? 2 : 1;
     }
     else
     {
-      pos_x = d_rng->pick_from_set<std::vector<uint64_t>, uint64_t>(inputs);
+      pos_x = this->d_rng
+                  ->template pick_from_set<std::vector<uint64_t>, uint64_t>(
+                      inputs);
     }
   }
 
@@ -6124,64 +6335,71 @@ BitVectorIte::select_path(const BitVector& t, std::vector<uint64_t>& ess_inputs)
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorNot::BitVectorNot(RNG* rng, uint64_t size, BitVectorNode* child0)
-    : BitVectorNode(rng, size, child0)
+template <class VALUE>
+BvNot<VALUE>::BvNot(RNG* rng, uint64_t size, BvNode<VALUE>* child0)
+    : BvNode<VALUE>(rng, size, child0)
 {
   assert(size == child0->size());
   _evaluate_and_set_domain();
 }
 
-BitVectorNot::BitVectorNot(RNG* rng,
-                           const BitVectorDomain& domain,
-                           BitVectorNode* child0)
-    : BitVectorNode(rng, domain, child0)
+template <class VALUE>
+BvNot<VALUE>::BvNot(RNG* rng,
+                    const BvDomain<VALUE>& domain,
+                    BvNode<VALUE>* child0)
+    : BvNode<VALUE>(rng, domain, child0)
 {
   assert(domain.size() == child0->size());
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorNot::_evaluate()
+BvNot<VALUE>::_evaluate()
 {
-  d_assignment.ibvnot(child(0)->assignment());
+  this->d_assignment.ibvnot(this->child(0)->assignment());
 }
 
+template <class VALUE>
 void
-BitVectorNot::_evaluate_and_set_domain()
+BvNot<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorNot::evaluate()
+BvNot<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 bool
-BitVectorNot::is_essential(const BitVector& t, uint64_t pos_x)
+BvNot<VALUE>::is_essential(const VALUE& t, uint64_t pos_x)
 {
   return !is_invertible(t, pos_x, true);
 }
 
+template <class VALUE>
 bool
-BitVectorNot::is_invertible(const BitVector& t,
+BvNot<VALUE>::is_invertible(const VALUE& t,
                             uint64_t pos_x,
                             bool is_essential_check)
 {
   (void) is_essential_check;
 
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * IC_wo: true
@@ -6190,7 +6408,7 @@ BitVectorNot::is_invertible(const BitVector& t,
    * Inverse value: ~t
    */
 
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   if (!x.has_fixed_bits() || x.match_fixed_bits(t.bvnot()))
   {
     BV_NODE_CACHE_INVERSE_IF(t.bvnot());
@@ -6199,42 +6417,46 @@ BitVectorNot::is_invertible(const BitVector& t,
   return false;
 }
 
+template <class VALUE>
 bool
-BitVectorNot::is_consistent(const BitVector& t, uint64_t pos_x)
+BvNot<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
   /** CC: IC */
   return is_invertible(t, pos_x);
 }
 
-const BitVector&
-BitVectorNot::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvNot<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(d_inverse);
-  assert(t.compare(d_inverse->bvnot()) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(this->d_inverse);
+  assert(t.compare(this->d_inverse->bvnot()) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
-const BitVector&
-BitVectorNot::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvNot<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   return inverse_value(t, pos_x);
 }
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorExtract::BitVectorExtract(RNG* rng,
-                                   uint64_t size,
-                                   BitVectorNode* child0,
-                                   uint64_t hi,
-                                   uint64_t lo,
-                                   bool normalize)
-    : BitVectorNode(rng, size, child0), d_hi(hi), d_lo(lo)
+template <class VALUE>
+BvExtract<VALUE>::BvExtract(RNG* rng,
+                            uint64_t size,
+                            BvNode<VALUE>* child0,
+                            uint64_t hi,
+                            uint64_t lo,
+                            bool normalize)
+    : BvNode<VALUE>(rng, size, child0), d_hi(hi), d_lo(lo)
 {
   assert(hi < child0->size());
   assert(lo <= hi);
@@ -6248,13 +6470,14 @@ BitVectorExtract::BitVectorExtract(RNG* rng,
   _evaluate_and_set_domain();
 }
 
-BitVectorExtract::BitVectorExtract(RNG* rng,
-                                   const BitVectorDomain& domain,
-                                   BitVectorNode* child0,
-                                   uint64_t hi,
-                                   uint64_t lo,
-                                   bool normalize)
-    : BitVectorNode(rng, domain, child0), d_hi(hi), d_lo(lo)
+template <class VALUE>
+BvExtract<VALUE>::BvExtract(RNG* rng,
+                            const BvDomain<VALUE>& domain,
+                            BvNode<VALUE>* child0,
+                            uint64_t hi,
+                            uint64_t lo,
+                            bool normalize)
+    : BvNode<VALUE>(rng, domain, child0), d_hi(hi), d_lo(lo)
 {
   assert(hi < child0->size());
   assert(lo <= hi);
@@ -6268,78 +6491,108 @@ BitVectorExtract::BitVectorExtract(RNG* rng,
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 uint64_t
-BitVectorExtract::hi() const
+BvExtract<VALUE>::hi() const
 {
   return d_hi;
 }
 
+template <class VALUE>
 uint64_t
-BitVectorExtract::lo() const
+BvExtract<VALUE>::lo() const
 {
   return d_lo;
 }
 
+template <class VALUE>
 void
-BitVectorExtract::normalize(BitVectorNode* node)
+BvExtract<VALUE>::normalize(BvNode<VALUE>* node)
 {
   assert(!d_child0_original);
-  assert(!node || node->size() == size());
-  assert(!node || node->assignment() == d_assignment);
-  d_child0_original = child(0);
-  d_hi_original     = d_hi;
-  d_lo_original     = d_lo;
-  d_children[0]     = node;
-  d_hi              = size() - 1;
-  d_lo              = 0;
+  assert(!node || node->size() == this->size());
+  assert(!node || node->assignment() == this->d_assignment);
+  d_child0_original   = this->child(0);
+  d_hi_original       = d_hi;
+  d_lo_original       = d_lo;
+  this->d_children[0] = node;
+  d_hi                = this->size() - 1;
+  d_lo                = 0;
 }
 
+template <class VALUE>
 bool
-BitVectorExtract::is_normalized() const
+BvExtract<VALUE>::is_normalized() const
 {
   return d_child0_original != nullptr;
 }
 
+template <class VALUE>
+BvNode<VALUE>*
+BvExtract<VALUE>::child0_original() const
+{
+  return d_child0_original;
+}
+
+template <class VALUE>
+uint64_t
+BvExtract<VALUE>::hi_original() const
+{
+  return d_hi_original;
+}
+
+template <class VALUE>
+uint64_t
+BvExtract<VALUE>::lo_original() const
+{
+  return d_lo_original;
+}
+
+template <class VALUE>
 void
-BitVectorExtract::_evaluate()
+BvExtract<VALUE>::_evaluate()
 {
-  d_assignment.ibvextract(child(0)->assignment(), d_hi, d_lo);
+  this->d_assignment.ibvextract(this->child(0)->assignment(), d_hi, d_lo);
 }
 
+template <class VALUE>
 void
-BitVectorExtract::_evaluate_and_set_domain()
+BvExtract<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorExtract::evaluate()
+BvExtract<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 bool
-BitVectorExtract::is_essential(const BitVector& t, uint64_t pos_x)
+BvExtract<VALUE>::is_essential(const VALUE& t, uint64_t pos_x)
 {
   return !is_invertible(t, pos_x, true);
 }
 
+template <class VALUE>
 bool
-BitVectorExtract::is_invertible(const BitVector& t,
+BvExtract<VALUE>::is_invertible(const VALUE& t,
                                 uint64_t pos_x,
                                 bool is_essential_check)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   /**
    * IC_wo: true
@@ -6354,17 +6607,17 @@ BitVectorExtract::is_invertible(const BitVector& t,
    * constraints, we fix the assignment of those bits to match these const bits.
    */
 
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
 
   if (!x.has_fixed_bits() || x.bvextract(d_hi, d_lo).match_fixed_bits(t))
   {
     if (!is_essential_check)
     {
-      const BitVector& x_val = child(pos_x)->assignment();
-      uint64_t size          = x.size();
-      bool keep              = d_rng->pick_with_prob(s_prob_keep);
-      bool random            = !keep && d_rng->flip_coin();
-      BitVector left, propagated, right;
+      const VALUE& x_val = this->child(pos_x)->assignment();
+      uint64_t size      = x.size();
+      bool keep          = this->d_rng->pick_with_prob(s_prob_keep);
+      bool random        = !keep && this->d_rng->flip_coin();
+      VALUE left, propagated, right;
 
       if (d_hi < size - 1)
       {
@@ -6380,7 +6633,7 @@ BitVectorExtract::is_invertible(const BitVector& t,
             if (d_x_slice_left == nullptr)
             {
               d_x_slice_left.reset(
-                  new BitVectorDomain(x.bvextract(size - 1, d_hi + 1)));
+                  new BvDomain<VALUE>(x.bvextract(size - 1, d_hi + 1)));
             }
             if (d_x_slice_left->is_fixed())
             {
@@ -6394,8 +6647,8 @@ BitVectorExtract::is_invertible(const BitVector& t,
               {
                 if (iszero && isones)
                 {
-                  left = d_rng->flip_coin() ? d_x_slice_left->lo()
-                                            : d_x_slice_left->hi();
+                  left = this->d_rng->flip_coin() ? d_x_slice_left->lo()
+                                                  : d_x_slice_left->hi();
                 }
                 else if (iszero)
                 {
@@ -6408,7 +6661,7 @@ BitVectorExtract::is_invertible(const BitVector& t,
               }
               else
               {
-                BitVectorDomainGenerator gen(*d_x_slice_left, d_rng);
+                BvDomainGenerator<VALUE> gen(*d_x_slice_left, this->d_rng);
                 assert(gen.has_random());
                 left = gen.random();
               }
@@ -6419,12 +6672,12 @@ BitVectorExtract::is_invertible(const BitVector& t,
             uint64_t lsize = size - 1 - d_hi;
             if (random)
             {
-              left = BitVector(lsize, *d_rng);
+              left = VALUE(lsize, *this->d_rng);
             }
             else
             {
-              left = d_rng->flip_coin() ? BitVector::mk_zero(lsize)
-                                        : BitVector::mk_ones(lsize);
+              left = this->d_rng->flip_coin() ? VALUE::mk_zero(lsize)
+                                              : VALUE::mk_ones(lsize);
             }
           }
         }
@@ -6443,7 +6696,7 @@ BitVectorExtract::is_invertible(const BitVector& t,
             if (d_x_slice_right == nullptr)
             {
               d_x_slice_right.reset(
-                  new BitVectorDomain(x.bvextract(d_lo - 1, 0)));
+                  new BvDomain<VALUE>(x.bvextract(d_lo - 1, 0)));
             }
             if (d_x_slice_right->is_fixed())
             {
@@ -6457,8 +6710,8 @@ BitVectorExtract::is_invertible(const BitVector& t,
               {
                 if (iszero && isones)
                 {
-                  right = d_rng->flip_coin() ? d_x_slice_right->lo()
-                                             : d_x_slice_right->hi();
+                  right = this->d_rng->flip_coin() ? d_x_slice_right->lo()
+                                                   : d_x_slice_right->hi();
                 }
                 else if (iszero)
                 {
@@ -6471,7 +6724,7 @@ BitVectorExtract::is_invertible(const BitVector& t,
               }
               else
               {
-                BitVectorDomainGenerator gen(*d_x_slice_right, d_rng);
+                BvDomainGenerator<VALUE> gen(*d_x_slice_right, this->d_rng);
                 assert(gen.has_random());
                 right = gen.random();
               }
@@ -6481,12 +6734,12 @@ BitVectorExtract::is_invertible(const BitVector& t,
           {
             if (random)
             {
-              right = BitVector(d_lo, *d_rng);
+              right = VALUE(d_lo, *this->d_rng);
             }
             else
             {
-              right = d_rng->flip_coin() ? BitVector::mk_zero(d_lo)
-                                         : BitVector::mk_ones(d_lo);
+              right = this->d_rng->flip_coin() ? VALUE::mk_zero(d_lo)
+                                               : VALUE::mk_ones(d_lo);
             }
           }
         }
@@ -6517,115 +6770,126 @@ BitVectorExtract::is_invertible(const BitVector& t,
   return false;
 }
 
+template <class VALUE>
 bool
-BitVectorExtract::is_consistent(const BitVector& t, uint64_t pos_x)
+BvExtract<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
   /** CC: IC */
   return is_invertible(t, pos_x);
 }
 
-const BitVector&
-BitVectorExtract::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvExtract<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
-  assert(d_inverse);
-  assert(t.compare(d_inverse->bvextract(d_hi, d_lo)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
+  assert(this->d_inverse);
+  assert(t.compare(this->d_inverse->bvextract(d_hi, d_lo)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
 #endif
-  return *d_inverse;
+  return *this->d_inverse;
 }
 
-const BitVector&
-BitVectorExtract::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvExtract<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   return inverse_value(t, pos_x);
 }
 
+template <class VALUE>
 std::string
-BitVectorExtract::str() const
+BvExtract<VALUE>::str() const
 {
-  return "[" + std::to_string(d_id) + "] (" + std::to_string(d_normalized_id)
-         + ") " + std::to_string(kind()) + ": "
+  return "[" + std::to_string(this->d_id) + "] ("
+         + std::to_string(this->d_normalized_id) + ") "
+         + std::to_string(kind()) + ": "
          + (is_normalized() ? "(normalized) " : "") + "["
          + std::to_string(d_hi) + ":" + std::to_string(d_lo)
-         + "]: " + d_domain.str() + " (" + d_assignment.str() + ")";
+         + "]: " + this->d_domain.str() + " (" + this->d_assignment.str() + ")";
 }
 
 /* -------------------------------------------------------------------------- */
 
-BitVectorSignExtend::BitVectorSignExtend(RNG* rng,
-                                         uint64_t size,
-                                         BitVectorNode* child0,
-                                         uint64_t n)
-    : BitVectorNode(rng, size, child0), d_n(n)
+template <class VALUE>
+BvSignExtend<VALUE>::BvSignExtend(RNG* rng,
+                                  uint64_t size,
+                                  BvNode<VALUE>* child0,
+                                  uint64_t n)
+    : BvNode<VALUE>(rng, size, child0), d_n(n)
 {
   assert(size == child0->size() + n);
   _evaluate_and_set_domain();
 }
 
-BitVectorSignExtend::BitVectorSignExtend(RNG* rng,
-                                         const BitVectorDomain& domain,
-                                         BitVectorNode* child0,
-                                         uint64_t n)
-    : BitVectorNode(rng, domain, child0), d_n(n)
+template <class VALUE>
+BvSignExtend<VALUE>::BvSignExtend(RNG* rng,
+                                  const BvDomain<VALUE>& domain,
+                                  BvNode<VALUE>* child0,
+                                  uint64_t n)
+    : BvNode<VALUE>(rng, domain, child0), d_n(n)
 {
   assert(domain.size() == child0->size() + n);
   _evaluate_and_set_domain();
 }
 
+template <class VALUE>
 void
-BitVectorSignExtend::_evaluate()
+BvSignExtend<VALUE>::_evaluate()
 {
-  d_assignment.ibvsext(child(0)->assignment(), d_n);
+  this->d_assignment.ibvsext(this->child(0)->assignment(), d_n);
 }
 
+template <class VALUE>
 void
-BitVectorSignExtend::_evaluate_and_set_domain()
+BvSignExtend<VALUE>::_evaluate_and_set_domain()
 {
   _evaluate();
-  if (d_all_value)
+  if (this->d_all_value)
   {
-    if (!d_is_value)
+    if (!this->d_is_value)
     {
-      d_domain.fix(d_assignment);
-      d_is_value = true;
+      this->d_domain.fix(this->d_assignment);
+      this->d_is_value = true;
     }
   }
   // we cannot assert that the assignment matches const bits, see header
 }
 
+template <class VALUE>
 void
-BitVectorSignExtend::evaluate()
+BvSignExtend<VALUE>::evaluate()
 {
   _evaluate();
 }
 
+template <class VALUE>
 void
-BitVectorSignExtend::normalize_bounds(BitVector* min_u,
-                                      BitVector* max_u,
-                                      BitVector* min_s,
-                                      BitVector* max_s,
-                                      BitVector& res_min_lo,
-                                      BitVector& res_max_lo,
-                                      BitVector& res_min_hi,
-                                      BitVector& res_max_hi)
+BvSignExtend<VALUE>::normalize_bounds(VALUE* min_u,
+                                      VALUE* max_u,
+                                      VALUE* min_s,
+                                      VALUE* max_s,
+                                      VALUE& res_min_lo,
+                                      VALUE& res_max_lo,
+                                      VALUE& res_min_hi,
+                                      VALUE& res_max_hi)
 {
   // Sign extension is a bit of a special case in that its bounds are either
   // from 0::x->domain().lo()[msb-1:0] to 0::x->domain().hi()[msb-1:0] or
   // from 1::x->domain().lo()[msb-1:0] to 1::x->domain().hi()[msb-1:0].
   // These two bounds are disjunct.
 
-  res_min_lo = BitVector();
-  res_max_lo = BitVector();
-  res_min_hi = BitVector();
-  res_max_hi = BitVector();
+  res_min_lo = VALUE();
+  res_max_lo = VALUE();
+  res_min_hi = VALUE();
+  res_max_hi = VALUE();
 
   // First, compute the normalized bounds of the current signed and unsigned
   // bounds on x.
-  BitVectorNode::normalize_bounds(min_u,
+  BvNode<VALUE>::normalize_bounds(min_u,
                                   max_u,
                                   min_s,
                                   max_s,
@@ -6642,16 +6906,17 @@ BitVectorSignExtend::normalize_bounds(BitVector* min_u,
   if (d_n > 0)
   {
     // Now, determine the disjunct bounds imposed from the extension.
-    const BitVectorDomain& dx = child(0)->domain();
-    BitVectorDomain dxn       = d_domain.bvextract(this->size() - 1, d_n - 1);
+    const BvDomain<VALUE>& dx = this->child(0)->domain();
+    BvDomain<VALUE> dxn       =
+        this->d_domain.bvextract(this->size() - 1, d_n - 1);
     uint64_t dx_size          = dx.size();
     bool has_fixed_bits       = dxn.has_fixed_bits();
-    BitVector min_0, max_0, min_1, max_1;
+    VALUE min_0, max_0, min_1, max_1;
 
     if (!has_fixed_bits || dxn.has_fixed_bits_false())
     {
-      min_0 = BitVector::mk_zero(d_n + 1);
-      max_0 = BitVector::mk_zero(d_n + 1);
+      min_0 = VALUE::mk_zero(d_n + 1);
+      max_0 = VALUE::mk_zero(d_n + 1);
       if (dx_size > 1)
       {
         min_0.ibvconcat(dx.lo().bvextract(dx_size - 2, 0));
@@ -6660,12 +6925,12 @@ BitVectorSignExtend::normalize_bounds(BitVector* min_u,
     }
     if (!has_fixed_bits || dxn.has_fixed_bits_true())
     {
-      min_1 = BitVector::mk_ones(d_n + 1);
-      max_1 = BitVector::mk_ones(d_n + 1);
+      min_1 = VALUE::mk_ones(d_n + 1);
+      max_1 = VALUE::mk_ones(d_n + 1);
       if (dx_size > 1)
       {
-        min_1.ibvconcat(d_domain.lo().bvextract(dx_size - 2, 0));
-        max_1.ibvconcat(d_domain.hi().bvextract(dx_size - 2, 0));
+        min_1.ibvconcat(this->d_domain.lo().bvextract(dx_size - 2, 0));
+        max_1.ibvconcat(this->d_domain.hi().bvextract(dx_size - 2, 0));
       }
     }
     if (!res_min_lo.is_null())
@@ -6674,13 +6939,13 @@ BitVectorSignExtend::normalize_bounds(BitVector* min_u,
       // Identify conflicts.
       if (!max_0.is_null() && max_0.compare(res_min_lo) < 0)
       {
-        res_min_lo = BitVector();
-        res_max_lo = BitVector();
+        res_min_lo = VALUE();
+        res_max_lo = VALUE();
       }
       else if (!min_0.is_null() && min_0.compare(res_max_lo) > 0)
       {
-        res_min_lo = BitVector();
-        res_max_lo = BitVector();
+        res_min_lo = VALUE();
+        res_max_lo = VALUE();
       }
       // Tighten bounds.
       if (!res_min_lo.is_null())
@@ -6701,13 +6966,13 @@ BitVectorSignExtend::normalize_bounds(BitVector* min_u,
       // Identify conflicts.
       if (!max_1.is_null() && max_1.compare(res_min_hi) < 0)
       {
-        res_min_hi = BitVector();
-        res_max_hi = BitVector();
+        res_min_hi = VALUE();
+        res_max_hi = VALUE();
       }
       else if (!min_1.is_null() && min_1.compare(res_max_hi) > 0)
       {
-        res_min_hi = BitVector();
-        res_max_hi = BitVector();
+        res_min_hi = VALUE();
+        res_max_hi = VALUE();
       }
       if (res_min_lo.is_null() && res_min_hi.is_null())
       {
@@ -6731,26 +6996,28 @@ BitVectorSignExtend::normalize_bounds(BitVector* min_u,
   }
 }
 
+template <class VALUE>
 bool
-BitVectorSignExtend::is_essential(const BitVector& t, uint64_t pos_x)
+BvSignExtend<VALUE>::is_essential(const VALUE& t, uint64_t pos_x)
 {
   return !is_invertible(t, pos_x, true);
 }
 
+template <class VALUE>
 bool
-BitVectorSignExtend::is_invertible(const BitVector& t,
+BvSignExtend<VALUE>::is_invertible(const VALUE& t,
                                    uint64_t pos_x,
                                    bool is_essential_check)
 {
-  d_inverse.reset(nullptr);
-  d_consistent.reset(nullptr);
+  this->d_inverse.reset(nullptr);
+  this->d_consistent.reset(nullptr);
 
   (void) pos_x;
 
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
   uint64_t size            = t.size();
-  BitVector t_x            = t.bvextract(size - 1 - d_n, 0);
-  BitVector t_ext          = t.bvextract(size - 1, size - 1 - d_n);
+  VALUE t_x                = t.bvextract(size - 1 - d_n, 0);
+  VALUE t_ext              = t.bvextract(size - 1, size - 1 - d_n);
 
   /**
    * IC_wo: t_ext == ones || t_ext == zero
@@ -6775,39 +7042,44 @@ BitVectorSignExtend::is_invertible(const BitVector& t,
   return ic_wo;
 }
 
+template <class VALUE>
 bool
-BitVectorSignExtend::is_consistent(const BitVector& t, uint64_t pos_x)
+BvSignExtend<VALUE>::is_consistent(const VALUE& t, uint64_t pos_x)
 {
   /** CC: IC */
   return is_invertible(t, pos_x);
 }
 
-const BitVector&
-BitVectorSignExtend::inverse_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvSignExtend<VALUE>::inverse_value(const VALUE& t, uint64_t pos_x)
 {
-  assert(d_inverse != nullptr);
+  assert(this->d_inverse != nullptr);
   (void) t;
   (void) pos_x;
 #ifndef NDEBUG
-  const BitVectorDomain& x = child(pos_x)->domain();
+  const BvDomain<VALUE>& x = this->child(pos_x)->domain();
 #endif
-  assert(t.compare(d_inverse->bvsext(d_n)) == 0);
-  assert(x.match_fixed_bits(*d_inverse));
-  return *d_inverse;
+  assert(t.compare(this->d_inverse->bvsext(d_n)) == 0);
+  assert(x.match_fixed_bits(*this->d_inverse));
+  return *this->d_inverse;
 }
 
-const BitVector&
-BitVectorSignExtend::consistent_value(const BitVector& t, uint64_t pos_x)
+template <class VALUE>
+const VALUE&
+BvSignExtend<VALUE>::consistent_value(const VALUE& t, uint64_t pos_x)
 {
   return inverse_value(t, pos_x);
 }
 
+template <class VALUE>
 std::string
-BitVectorSignExtend::str() const
+BvSignExtend<VALUE>::str() const
 {
-  return "[" + std::to_string(d_id) + "] (" + std::to_string(d_normalized_id)
-         + ") " + std::to_string(kind()) + ": " + d_domain.str() + " ("
-         + d_assignment.str() + ")";
+  return "[" + std::to_string(this->d_id) + "] ("
+         + std::to_string(this->d_normalized_id) + ") "
+         + std::to_string(kind()) + ": " + this->d_domain.str() + " ("
+         + this->d_assignment.str() + ")";
 }
 
 /* -------------------------------------------------------------------------- */
@@ -6815,5 +7087,49 @@ BitVectorSignExtend::str() const
 #undef BV_NODE_CACHE_INVERSE_IF
 #undef BV_NODE_CACHE_CONSISTENT
 
+/* -------------------------------------------------------------------------- */
+
+template class BvNode<BitVector>;
+template class BvNode<Word64>;
+template class BvAdd<BitVector>;
+template class BvAdd<Word64>;
+template class BvAnd<BitVector>;
+template class BvAnd<Word64>;
+template class BvConcat<BitVector>;
+template class BvConcat<Word64>;
+template class BvEq<BitVector>;
+template class BvEq<Word64>;
+template class BvMul<BitVector>;
+template class BvMul<Word64>;
+template class BvShl<BitVector>;
+template class BvShl<Word64>;
+template class BvShr<BitVector>;
+template class BvShr<Word64>;
+template class BvAshr<BitVector>;
+template class BvAshr<Word64>;
+template class BvUdiv<BitVector>;
+template class BvUdiv<Word64>;
+template class BvUlt<BitVector>;
+template class BvUlt<Word64>;
+template class BvSlt<BitVector>;
+template class BvSlt<Word64>;
+template class BvUrem<BitVector>;
+template class BvUrem<Word64>;
+template class BvXor<BitVector>;
+template class BvXor<Word64>;
+template class BvIte<BitVector>;
+template class BvIte<Word64>;
+template class BvNot<BitVector>;
+template class BvNot<Word64>;
+template class BvExtract<BitVector>;
+template class BvExtract<Word64>;
+template class BvSignExtend<BitVector>;
+template class BvSignExtend<Word64>;
+
+template std::ostream& operator<<(std::ostream& out,
+                                  const BvNode<BitVector>& node);
+template std::ostream& operator<<(std::ostream& out,
+                                  const BvNode<Word64>& node);
+
 }  // namespace ls
 }  // namespace bzla
@@ -26,11 +26,18 @@ namespace ls {
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorExtract;
+template <class VALUE>
+class BvExtract;
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorNode : public Node<BitVector>
+/**
+ * A bit-vector node of the local search engine.
+ * VALUE is the bit-vector value type, BitVector or Word64 (for nodes of size
+ * <= 64).
+ */
+template <class VALUE>
+class BvNode : public Node<VALUE>
 {
  public:
   /**
@@ -38,23 +45,21 @@ class BitVectorNode : public Node<BitVector>
    * @param rng  The associated random number generator.
    * @param size The bit-vector size.
    */
-  BitVectorNode(RNG* rng, uint64_t size);
+  BvNode(RNG* rng, uint64_t size);
   /**
    * Constructor.
    * @param rng        The associated random number generator.
    * @param assignment The current bit-vector assignment.
    * @param size       The bit-vector size.
    */
-  BitVectorNode(RNG* rng,
-                const BitVector& assignment,
-                const BitVectorDomain& domain);
+  BvNode(RNG* rng, const VALUE& assignment, const BvDomain<VALUE>& domain);
   /** Destructor. */
-  virtual ~BitVectorNode() {}
+  virtual ~BvNode() {}
 
   bool is_inequality() const override;
   bool is_not() const override;
   bool is_value_false() const override;
-  void set_assignment(const BitVector& assignment) override;
+  void set_assignment(const VALUE& assignment) override;
   std::string str() const override;
   std::vector<std::string> log() const override;
 
@@ -63,30 +68,30 @@ class BitVectorNode : public Node<BitVector>
    * @param pos The index of the child to get.
    * @return The child at the given index.
    */
-  BitVectorNode* child(uint64_t pos) const;
+  BvNode<VALUE>* child(uint64_t pos) const;
 
   /**
    * Get the domain of this node.
    * @return A reference to the domain of this node.
    */
-  const BitVectorDomain& domain() const { return d_domain; }
+  const BvDomain<VALUE>& domain() const { return d_domain; }
 
   /**
    * Get the bit-vector size of the node.
    * @return The size of this node.
    */
-  uint64_t size() const { return d_assignment.size(); }
+  uint64_t size() const { return this->d_assignment.size(); }
 
   /**
    * Register parent extract for normalization.
    * @param node The parent extract node to register.
    */
-  void register_extract(BitVectorNode* node);
+  void register_extract(BvNode<VALUE>* node);
   /**
    * Get the set of parent extracts for normalization.
    * @return The set of registered extracts.
    */
-  const std::vector<BitVectorExtract*>& get_extracts() { return d_extracts; }
+  const std::vector<BvExtract<VALUE>*>& get_extracts() { return d_extracts; }
 
   /**
    * Tighten signed and/or unsigned bounds of this node wrt. to the given
@@ -102,14 +107,14 @@ class BitVectorNode : public Node<BitVector>
    * @param res_min_s The resulting lower signed bound.
    * @param res_max_s The resulting upper signed bound.
    */
-  void tighten_bounds(BitVector* min_u,
-                      BitVector* max_u,
-                      BitVector* min_s,
-                      BitVector* max_s,
-                      BitVector& res_min_u,
-                      BitVector& res_max_u,
-                      BitVector& res_min_s,
-                      BitVector& res_max_s);
+  void tighten_bounds(VALUE* min_u,
+                      VALUE* max_u,
+                      VALUE* min_s,
+                      VALUE* max_s,
+                      VALUE& res_min_u,
+                      VALUE& res_max_u,
+                      VALUE& res_min_s,
+                      VALUE& res_max_s);
 
   /**
    * Normalize given signed and unsigned bounds into a lower (from min_signed
@@ -131,34 +136,34 @@ class BitVectorNode : public Node<BitVector>
    * @param res_max_hi The maximum value of the resulting upper range, null if
    *                   no values in the upper range are covered.
    */
-  virtual void normalize_bounds(BitVector* min_u,
-                                BitVector* max_u,
-                                BitVector* min_s,
-                                BitVector* max_s,
-                                BitVector& res_min_lo,
-                                BitVector& res_max_lo,
-                                BitVector& res_min_hi,
-                                BitVector& res_max_hi);
+  virtual void normalize_bounds(VALUE* min_u,
+                                VALUE* max_u,
+                                VALUE* min_s,
+                                VALUE* max_s,
+                                VALUE& res_min_lo,
+                                VALUE& res_max_lo,
+                                VALUE& res_min_hi,
+                                VALUE& res_max_hi);
   /**
    * Get the unsigned upper bound (incl) for inverse value computation.
    * @return The upper unsigned bound.
    */
-  BitVector* max_u() { return d_max_u.get(); }
+  VALUE* max_u() { return d_max_u.get(); }
   /**
    * Get the unsigned lower bound (incl) for inverse value computation.
    * @return The lower unsigned bound.
    */
-  BitVector* min_u() { return d_min_u.get(); }
+  VALUE* min_u() { return d_min_u.get(); }
   /**
    * Get the signed upper bound (incl) for inverse value computation.
    * @return The upper signed bound.
    */
-  BitVector* max_s() { return d_max_s.get(); }
+  VALUE* max_s() { return d_max_s.get(); }
   /**
    * Get the signed lower bound (incl) for inverse value computation.
    * @return The lower signed bound.
    */
-  BitVector* min_s() { return d_min_s.get(); }
+  VALUE* min_s() { return d_min_s.get(); }
 
   /**
    * Fix domain bit at index `idx` to `value`.
@@ -177,8 +182,8 @@ class BitVectorNode : public Node<BitVector>
    * case `min - 1` will be used.
    * @param is_signed True if the given bounds are signed bounds.
    */
-  void update_bounds(const BitVector& min,
-                     const BitVector& max,
+  void update_bounds(const VALUE& min,
+                     const VALUE& max,
                      bool min_is_exclusive,
                      bool max_is_exclusive,
                      bool is_signed);
@@ -197,32 +202,29 @@ class BitVectorNode : public Node<BitVector>
    * @param max_hi The maximum value of the upper range, ignored if null.
    * @return True if given bit-vector is within one of the given ranges.
    */
-  static bool is_in_bounds(const BitVector& bv,
-                           const BitVector& min_lo,
-                           const BitVector& max_lo,
-                           const BitVector& min_hi,
-                           const BitVector& max_hi);
-
-  BitVectorNode(RNG* rng, uint64_t size, BitVectorNode* child0);
-  BitVectorNode(RNG* rng,
-                uint64_t size,
-                BitVectorNode* child0,
-                BitVectorNode* child1);
-  BitVectorNode(RNG* rng,
-                uint64_t size,
-                BitVectorNode* child0,
-                BitVectorNode* child1,
-                BitVectorNode* child2);
-  BitVectorNode(RNG* rng, const BitVectorDomain& domain, BitVectorNode* child0);
-  BitVectorNode(RNG* rng,
-                const BitVectorDomain& domain,
-                BitVectorNode* child0,
-                BitVectorNode* child1);
-  BitVectorNode(RNG* rng,
-                const BitVectorDomain& domain,
-                BitVectorNode* child0,
-                BitVectorNode* child1,
-                BitVectorNode* child2);
+  static bool is_in_bounds(const VALUE& bv,
+                           const VALUE& min_lo,
+                           const VALUE& max_lo,
+                           const VALUE& min_hi,
+                           const VALUE& max_hi);
+
+  BvNode(RNG* rng, uint64_t size, BvNode<VALUE>* child0);
+  BvNode(RNG* rng, uint64_t size, BvNode<VALUE>* child0, BvNode<VALUE>* child1);
+  BvNode(RNG* rng,
+         uint64_t size,
+         BvNode<VALUE>* child0,
+         BvNode<VALUE>* child1,
+         BvNode<VALUE>* child2);
+  BvNode(RNG* rng, const BvDomain<VALUE>& domain, BvNode<VALUE>* child0);
+  BvNode(RNG* rng,
+         const BvDomain<VALUE>& domain,
+         BvNode<VALUE>* child0,
+         BvNode<VALUE>* child1);
+  BvNode(RNG* rng,
+         const BvDomain<VALUE>& domain,
+         BvNode<VALUE>* child0,
+         BvNode<VALUE>* child1,
+         BvNode<VALUE>* child2);
   /**
    * Helper to compute the normalized min and max bounds for `x` with respect
    * to `s` and `t` and the current signed and unsigned min/max bounds of `x`,
@@ -243,13 +245,13 @@ class BitVectorNode : public Node<BitVector>
    * @param res_max_hi The maximum value of the resulting upper range, null if
    *                   no values in the upper range are covered.
    */
-  void compute_normalized_bounds(const BitVector& s,
-                                 const BitVector& t,
+  void compute_normalized_bounds(const VALUE& s,
+                                 const VALUE& t,
                                  uint64_t pos_x,
-                                 BitVector& res_min_lo,
-                                 BitVector& res_max_lo,
-                                 BitVector& res_min_hi,
-                                 BitVector& res_max_hi);
+                                 VALUE& res_min_lo,
+                                 VALUE& res_max_lo,
+                                 VALUE& res_min_hi,
+                                 VALUE& res_max_hi);
 
   /**
    * Helper to compute the signed or unsigned min and max bounds for `x` with
@@ -273,45 +275,44 @@ class BitVectorNode : public Node<BitVector>
    * @param res_max_s The maximum value of the resulting signed range, null
    *                  for unsigned operators.
    */
-  virtual void compute_min_max_bounds(const BitVector& s,
-                                      const BitVector& t,
+  virtual void compute_min_max_bounds(const VALUE& s,
+                                      const VALUE& t,
                                       uint64_t pos_x,
-                                      BitVector& res_min_u,
-                                      BitVector& res_max_u,
-                                      BitVector& res_min_s,
-                                      BitVector& res_max_s);
+                                      VALUE& res_min_u,
+                                      VALUE& res_max_u,
+                                      VALUE& res_min_s,
+                                      VALUE& res_max_s);
 
   /** The underlying bit-vector domain representing constant bits. */
-  BitVectorDomain d_domain;
+  BvDomain<VALUE> d_domain;
 
   /** Unsigned upper bound (incl) for inverse value computation. */
-  std::unique_ptr<BitVector> d_max_u;
+  std::unique_ptr<VALUE> d_max_u;
   /** Unsigned lower bound (incl) for inverse value computation. */
-  std::unique_ptr<BitVector> d_min_u;
+  std::unique_ptr<VALUE> d_min_u;
   /** Signed upper bound (incl) for inverse value computation. */
-  std::unique_ptr<BitVector> d_max_s;
+  std::unique_ptr<VALUE> d_max_s;
   /** Signed lower bound (incl) for inverse value computation. */
-  std::unique_ptr<BitVector> d_min_s;
+  std::unique_ptr<VALUE> d_min_s;
 
-  std::vector<BitVectorExtract*> d_extracts;
+  std::vector<BvExtract<VALUE>*> d_extracts;
 };
 
-std::ostream& operator<<(std::ostream& out, const BitVectorNode& node);
+template <class VALUE>
+std::ostream& operator<<(std::ostream& out, const BvNode<VALUE>& node);
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorAdd : public BitVectorNode
+template <class VALUE>
+class BvAdd : public BvNode<VALUE>
 {
  public:
   /** Constructors. */
-  BitVectorAdd(RNG* rng,
-               uint64_t size,
-               BitVectorNode* child0,
-               BitVectorNode* child1);
-  BitVectorAdd(RNG* rng,
-               const BitVectorDomain& domain,
-               BitVectorNode* child0,
-               BitVectorNode* child1);
+  BvAdd(RNG* rng, uint64_t size, BvNode<VALUE>* child0, BvNode<VALUE>* child1);
+  BvAdd(RNG* rng,
+        const BvDomain<VALUE>& domain,
+        BvNode<VALUE>* child0,
+        BvNode<VALUE>* child1);
 
   NodeKind kind() const override { return NodeKind::BV_ADD; }
 
@@ -322,7 +323,7 @@ class BitVectorAdd : public BitVectorNode
    *   w/o  const bits: true
    *   with const bits: mfb(x, t - s)
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -331,12 +332,11 @@ class BitVectorAdd : public BitVectorNode
    *   w/o  const bits: true
    *   with const bits: true
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
  private:
   /**
@@ -371,30 +371,28 @@ class BitVectorAdd : public BitVectorNode
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorAnd : public BitVectorNode
+template <class VALUE>
+class BvAnd : public BvNode<VALUE>
 {
  public:
   /** Constructors. */
-  BitVectorAnd(RNG* rng,
-               uint64_t size,
-               BitVectorNode* child0,
-               BitVectorNode* child1);
-  BitVectorAnd(RNG* rng,
-               const BitVectorDomain& domain,
-               BitVectorNode* child0,
-               BitVectorNode* child1);
+  BvAnd(RNG* rng, uint64_t size, BvNode<VALUE>* child0, BvNode<VALUE>* child1);
+  BvAnd(RNG* rng,
+        const BvDomain<VALUE>& domain,
+        BvNode<VALUE>* child0,
+        BvNode<VALUE>* child1);
 
   NodeKind kind() const override { return NodeKind::BV_AND; }
 
   void evaluate() override;
 
-  void compute_min_max_bounds(const BitVector& s,
-                              const BitVector& t,
+  void compute_min_max_bounds(const VALUE& s,
+                              const VALUE& t,
                               uint64_t pos_x,
-                              BitVector& res_min_u,
-                              BitVector& res_max_u,
-                              BitVector& res_min_s,
-                              BitVector& res_max_s) override;
+                              VALUE& res_min_u,
+                              VALUE& res_max_u,
+                              VALUE& res_min_s,
+                              VALUE& res_max_s) override;
   /**
    * IC:
    *   w/o const bits (IC_wo): (t & s) = t
@@ -405,7 +403,7 @@ class BitVectorAnd : public BitVectorNode
    * 1) x & s = t on all const bits of x
    * 2) s & t = t on all non-const bits of x
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -414,12 +412,11 @@ class BitVectorAnd : public BitVectorNode
    *   w/o  const bits: true
    *   with const bits: t & x_hi = t
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
  private:
   /**
@@ -451,25 +448,26 @@ class BitVectorAnd : public BitVectorNode
    */
   void _evaluate_and_set_domain();
   /** Cache for current lower bound wrt. s and t and fixed bits in x. */
-  BitVector d_lo;
+  VALUE d_lo;
   /** Cache for current upper bound wrt. s and t and fixed bits in x. */
-  BitVector d_hi;
+  VALUE d_hi;
 };
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorConcat : public BitVectorNode
+template <class VALUE>
+class BvConcat : public BvNode<VALUE>
 {
  public:
   /** Constructors. */
-  BitVectorConcat(RNG* rng,
-                  uint64_t size,
-                  BitVectorNode* child0,
-                  BitVectorNode* child1);
-  BitVectorConcat(RNG* rng,
-                  const BitVectorDomain& domain,
-                  BitVectorNode* child0,
-                  BitVectorNode* child1);
+  BvConcat(RNG* rng,
+           uint64_t size,
+           BvNode<VALUE>* child0,
+           BvNode<VALUE>* child1);
+  BvConcat(RNG* rng,
+           const BvDomain<VALUE>& domain,
+           BvNode<VALUE>* child0,
+           BvNode<VALUE>* child1);
 
   NodeKind kind() const override { return NodeKind::BV_CONCAT; }
 
@@ -486,7 +484,7 @@ class BitVectorConcat : public BitVectorNode
    *
    * with const bits: mfb(x, tx) && s = ts
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -498,12 +496,11 @@ class BitVectorConcat : public BitVectorNode
    *     pos_x = 0: tx = t[bw(t) - 1 : bw(t) - bw(x)]
    *     pos_x = 1: tx = t[bw(x) - 1 : 0]
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
  private:
   /**
@@ -538,18 +535,16 @@ class BitVectorConcat : public BitVectorNode
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorEq : public BitVectorNode
+template <class VALUE>
+class BvEq : public BvNode<VALUE>
 {
  public:
   /** Constructors. */
-  BitVectorEq(RNG* rng,
-              uint64_t size,
-              BitVectorNode* child0,
-              BitVectorNode* child1);
-  BitVectorEq(RNG* rng,
-              const BitVectorDomain& domain,
-              BitVectorNode* child0,
-              BitVectorNode* child1);
+  BvEq(RNG* rng, uint64_t size, BvNode<VALUE>* child0, BvNode<VALUE>* child1);
+  BvEq(RNG* rng,
+       const BvDomain<VALUE>& domain,
+       BvNode<VALUE>* child0,
+       BvNode<VALUE>* child1);
 
   NodeKind kind() const override { return NodeKind::EQ; }
 
@@ -562,7 +557,7 @@ class BitVectorEq : public BitVectorNode
    *    t = 0: (x_hi != x_lo) || (x_hi != s)
    *    t = 1: mfb(x, s)
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -571,12 +566,11 @@ class BitVectorEq : public BitVectorNode
    *   w/o  const bits: true
    *   with const bits: true
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
  private:
   /**
@@ -611,18 +605,16 @@ class BitVectorEq : public BitVectorNode
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorMul : public BitVectorNode
+template <class VALUE>
+class BvMul : public BvNode<VALUE>
 {
  public:
   /** Constructors. */
-  BitVectorMul(RNG* rng,
-               uint64_t size,
-               BitVectorNode* child0,
-               BitVectorNode* child1);
-  BitVectorMul(RNG* rng,
-               const BitVectorDomain& domain,
-               BitVectorNode* child0,
-               BitVectorNode* child1);
+  BvMul(RNG* rng, uint64_t size, BvNode<VALUE>* child0, BvNode<VALUE>* child1);
+  BvMul(RNG* rng,
+        const BvDomain<VALUE>& domain,
+        BvNode<VALUE>* child0,
+        BvNode<VALUE>* child1);
 
   NodeKind kind() const override { return NodeKind::BV_MUL; }
 
@@ -637,7 +629,7 @@ class BitVectorMul : public BitVectorNode
    *                             (!odd(s) => mfb (x << c, y << c))))
    *                    with c = ctz(s) and y = (t >> c) * (s >> c)^-1
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -648,20 +640,19 @@ class BitVectorMul : public BitVectorNode
    *                    (odd(t) => x_hi[lsb] != 0) &&
    *                    (!odd(t) => \exists y. (mfb(x, y) && ctz(t) >= ctz(y))
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
-  void compute_min_max_bounds(const BitVector& s,
-                              const BitVector& t,
+  void compute_min_max_bounds(const VALUE& s,
+                              const VALUE& t,
                               uint64_t pos_x,
-                              BitVector& res_min_u,
-                              BitVector& res_max_u,
-                              BitVector& res_min_s,
-                              BitVector& res_max_s) override;
+                              VALUE& res_min_u,
+                              VALUE& res_max_u,
+                              VALUE& res_min_s,
+                              VALUE& res_max_s) override;
 
  private:
   /**
@@ -696,18 +687,16 @@ class BitVectorMul : public BitVectorNode
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorShl : public BitVectorNode
+template <class VALUE>
+class BvShl : public BvNode<VALUE>
 {
  public:
   /** Constructors. */
-  BitVectorShl(RNG* rng,
-               uint64_t size,
-               BitVectorNode* child0,
-               BitVectorNode* child1);
-  BitVectorShl(RNG* rng,
-               const BitVectorDomain& domain,
-               BitVectorNode* child0,
-               BitVectorNode* child1);
+  BvShl(RNG* rng, uint64_t size, BvNode<VALUE>* child0, BvNode<VALUE>* child1);
+  BvShl(RNG* rng,
+        const BvDomain<VALUE>& domain,
+        BvNode<VALUE>* child0,
+        BvNode<VALUE>* child1);
 
   NodeKind kind() const override { return NodeKind::BV_SHL; }
 
@@ -726,7 +715,7 @@ class BitVectorShl : public BitVectorNode
    *                  ((t = 0) => (x_hi >= ctz(t) - ctz(s) || (s = 0))) &&
    *                  ((t != 0) => mfb(x, ctz(t) - ctz(s)))
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -737,12 +726,11 @@ class BitVectorShl : public BitVectorNode
    *     pos_x = 0: \exists y. (y <= ctz(t) && mfb(x << y, t))
    *     pos_x = 1: t = 0 || \exists y. (y <= ctz(t) && mfb(x, y))
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
  private:
   /**
@@ -777,7 +765,8 @@ class BitVectorShl : public BitVectorNode
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorShr : public BitVectorNode
+template <class VALUE>
+class BvShr : public BvNode<VALUE>
 {
  public:
   /**
@@ -785,30 +774,27 @@ class BitVectorShr : public BitVectorNode
    * Cached result is stored in 'inverse_value'.
    */
   static bool is_invertible(RNG* rng,
-                            const BitVector& t,
-                            const BitVector& s,
-                            const BitVectorDomain& x,
+                            const VALUE& t,
+                            const VALUE& s,
+                            const BvDomain<VALUE>& x,
                             uint64_t pos_x,
-                            std::unique_ptr<BitVector>* inverse_value);
+                            std::unique_ptr<VALUE>* inverse_value);
   /**
    * Additional interface / helper for inverse_value.
    * Cached result is stored in `inverse`.
    */
   static void inverse_value(RNG* rng,
-                            const BitVector& t,
-                            const BitVector& s,
-                            const BitVectorDomain& x,
+                            const VALUE& t,
+                            const VALUE& s,
+                            const BvDomain<VALUE>& x,
                             uint64_t pos_x,
-                            std::unique_ptr<BitVector>& inverse);
+                            std::unique_ptr<VALUE>& inverse);
   /** Constructors. */
-  BitVectorShr(RNG* rng,
-               uint64_t size,
-               BitVectorNode* child0,
-               BitVectorNode* child1);
-  BitVectorShr(RNG* rng,
-               const BitVectorDomain& domain,
-               BitVectorNode* child0,
-               BitVectorNode* child1);
+  BvShr(RNG* rng, uint64_t size, BvNode<VALUE>* child0, BvNode<VALUE>* child1);
+  BvShr(RNG* rng,
+        const BvDomain<VALUE>& domain,
+        BvNode<VALUE>* child0,
+        BvNode<VALUE>* child1);
 
   NodeKind kind() const override { return NodeKind::BV_SHR; }
 
@@ -827,7 +813,7 @@ class BitVectorShr : public BitVectorNode
    *                  ((t = 0) => (x_hi >= clz(t) - clz(s) || (s = 0))) &&
    *                  ((t != 0) => mfb(x, clz(t) - clz(s)))
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -838,12 +824,11 @@ class BitVectorShr : public BitVectorNode
    *     pos_x = 0: \exists y. (y <= clz(t) && mfb(x >> y, t))
    *     pos_x = 1: t = 0 || \exists y. (y <= clz(t) && mfb(x, y))
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
  private:
   /**
@@ -878,18 +863,16 @@ class BitVectorShr : public BitVectorNode
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorAshr : public BitVectorNode
+template <class VALUE>
+class BvAshr : public BvNode<VALUE>
 {
  public:
   /** Constructors. */
-  BitVectorAshr(RNG* rng,
-                uint64_t size,
-                BitVectorNode* child0,
-                BitVectorNode* child1);
-  BitVectorAshr(RNG* rng,
-                const BitVectorDomain& domain,
-                BitVectorNode* child0,
-                BitVectorNode* child1);
+  BvAshr(RNG* rng, uint64_t size, BvNode<VALUE>* child0, BvNode<VALUE>* child1);
+  BvAshr(RNG* rng,
+         const BvDomain<VALUE>& domain,
+         BvNode<VALUE>* child0,
+         BvNode<VALUE>* child1);
 
   NodeKind kind() const override { return NodeKind::BV_ASHR; }
 
@@ -909,7 +892,7 @@ class BitVectorAshr : public BitVectorNode
    *                  (s[msb ] = 0 => IC_shr) &&
    *                  (s[msb] = 1 => IC_shr(~s >> x = ~t))
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -928,12 +911,11 @@ class BitVectorAshr : public BitVectorNode
    *     \exists y. (c => y < clo(t) && ~c => y < clz(t) && mfb(x, y)
    *     with c = (t[msb] = 1)
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
  private:
   /**
@@ -968,18 +950,16 @@ class BitVectorAshr : public BitVectorNode
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorUdiv : public BitVectorNode
+template <class VALUE>
+class BvUdiv : public BvNode<VALUE>
 {
  public:
   /** Constructors. */
-  BitVectorUdiv(RNG* rng,
-                uint64_t size,
-                BitVectorNode* child0,
-                BitVectorNode* child1);
-  BitVectorUdiv(RNG* rng,
-                const BitVectorDomain& domain,
-                BitVectorNode* child0,
-                BitVectorNode* child1);
+  BvUdiv(RNG* rng, uint64_t size, BvNode<VALUE>* child0, BvNode<VALUE>* child1);
+  BvUdiv(RNG* rng,
+         const BvDomain<VALUE>& domain,
+         BvNode<VALUE>* child0,
+         BvNode<VALUE>* child1);
 
   NodeKind kind() const override { return NodeKind::BV_UDIV; }
 
@@ -1004,7 +984,7 @@ class BitVectorUdiv : public BitVectorNode
    *                      (t = ones => y <= s / t) &&
    *                      (t != ones => y > t + 1 && y <= s / t)))
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -1025,12 +1005,11 @@ class BitVectorUdiv : public BitVectorNode
    *       (t != ones => (!mulo(x_lo, t) &&
    *                  \exists y. (y > 0 && mfb(x, y) && !mulo(y, t))))
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
  private:
   /**
@@ -1066,12 +1045,13 @@ class BitVectorUdiv : public BitVectorNode
    * Try to find a consistent value for pos_x = 0 other than x = t.
    * Returns a null bit-vector if no such value can be found.
    */
-  BitVector consistent_value_pos0_aux(const BitVector& t);
+  VALUE consistent_value_pos0_aux(const VALUE& t);
 };
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorUlt : public BitVectorNode
+template <class VALUE>
+class BvUlt : public BvNode<VALUE>
 {
  public:
   /**
@@ -1083,11 +1063,11 @@ class BitVectorUlt : public BitVectorNode
    * @param opt_concat_sext True to enable optimization for inverse_value
    *                        computation of concat and sign extension operands.
    */
-  BitVectorUlt(RNG* rng,
-               uint64_t size,
-               BitVectorNode* child0,
-               BitVectorNode* child1,
-               bool opt_concat_sext = false);
+  BvUlt(RNG* rng,
+        uint64_t size,
+        BvNode<VALUE>* child0,
+        BvNode<VALUE>* child1,
+        bool opt_concat_sext = false);
   /**
    * Constructor.
    * @param rng The associated random number generator.
@@ -1097,11 +1077,11 @@ class BitVectorUlt : public BitVectorNode
    * @param opt_concat_sext True to enable optimization for inverse_value
    *                        computation of concat and sign extension operands.
    */
-  BitVectorUlt(RNG* rng,
-               const BitVectorDomain& domain,
-               BitVectorNode* child0,
-               BitVectorNode* child1,
-               bool opt_concat_sext = false);
+  BvUlt(RNG* rng,
+        const BvDomain<VALUE>& domain,
+        BvNode<VALUE>* child0,
+        BvNode<VALUE>* child1,
+        bool opt_concat_sext = false);
 
   NodeKind kind() const override { return NodeKind::BV_ULT; }
 
@@ -1117,7 +1097,7 @@ class BitVectorUlt : public BitVectorNode
    *       pos_x = 0: t = 1 => (s != 0 && x_lo < s) && t = 0 => (x_hi >= s)
    *       pos_x = 1: t = 1 => (s != ones && x_hi > s) && t = 0 => (x_lo <= s)
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -1127,20 +1107,19 @@ class BitVectorUlt : public BitVectorNode
    *   with const bits: pos_x = 0: t = false || x_lo != ones
    *                    pos_x = 1: t = false || x_hi != 0
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
-  void compute_min_max_bounds(const BitVector& s,
-                              const BitVector& t,
+  void compute_min_max_bounds(const VALUE& s,
+                              const VALUE& t,
                               uint64_t pos_x,
-                              BitVector& res_min_u,
-                              BitVector& res_max_u,
-                              BitVector& res_min_s,
-                              BitVector& res_max_s) override;
+                              VALUE& res_min_u,
+                              VALUE& res_max_u,
+                              VALUE& res_min_s,
+                              VALUE& res_max_s) override;
 
  private:
   /**
@@ -1185,9 +1164,9 @@ class BitVectorUlt : public BitVectorNode
    *                           derived from top-level inequalities since this
    *                           may trap us in a cycle (see is_essential()).
    */
-  bool _is_invertible(const BitVectorDomain* d,
-                      const BitVector& s,
-                      const BitVector& t,
+  bool _is_invertible(const BvDomain<VALUE>* d,
+                      const VALUE& s,
+                      const VALUE& t,
                       uint64_t pos_x,
                       bool is_essential_check);
 
@@ -1200,7 +1179,7 @@ class BitVectorUlt : public BitVectorNode
    * @param pos_x The index of operand `x`, which is a concat node.
    * @return The inverse value.
    */
-  BitVector* inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s);
+  VALUE* inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s);
   /**
    * Helper for inverse_value_concat()  to generate a new random value with
    * respect to the given domain and within given min/max range.
@@ -1210,9 +1189,9 @@ class BitVectorUlt : public BitVectorNode
    * @return A random value within the given range, if there is one, else
    *         a null BitVector.
    */
-  BitVector inverse_value_concat_new_random(const BitVectorDomain& d,
-                                            const BitVector& min,
-                                            const BitVector& max);
+  VALUE inverse_value_concat_new_random(const BvDomain<VALUE>& d,
+                                        const VALUE& min,
+                                        const VALUE& max);
   /**
    * True to enable optimization for inverse_value computation of concat
    * and sign extension operands.
@@ -1222,20 +1201,21 @@ class BitVectorUlt : public BitVectorNode
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorSlt : public BitVectorNode
+template <class VALUE>
+class BvSlt : public BvNode<VALUE>
 {
  public:
   /** Constructors. */
-  BitVectorSlt(RNG* rng,
-               uint64_t size,
-               BitVectorNode* child0,
-               BitVectorNode* child1,
-               bool opt_concat_sext = false);
-  BitVectorSlt(RNG* rng,
-               const BitVectorDomain& domain,
-               BitVectorNode* child0,
-               BitVectorNode* child1,
-               bool opt_concat_sext = false);
+  BvSlt(RNG* rng,
+        uint64_t size,
+        BvNode<VALUE>* child0,
+        BvNode<VALUE>* child1,
+        bool opt_concat_sext = false);
+  BvSlt(RNG* rng,
+        const BvDomain<VALUE>& domain,
+        BvNode<VALUE>* child0,
+        BvNode<VALUE>* child1,
+        bool opt_concat_sext = false);
 
   NodeKind kind() const override { return NodeKind::BV_SLT; }
 
@@ -1259,7 +1239,7 @@ class BitVectorSlt : public BitVectorNode
    *                  t = 0 => ((MSB(x) = 0 && s >= x_lo) ||
    *                            (MSB(x) != 0 && s >= 1 o x_lo[bw-2:0])))
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -1269,20 +1249,19 @@ class BitVectorSlt : public BitVectorNode
    *   with const bits: pos_x = 0: t = false || (const(x) => x_lo != smax)
    *                    pos_x = 1: t = false || (const(x) => x_lo != smin)
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
-  void compute_min_max_bounds(const BitVector& s,
-                              const BitVector& t,
+  void compute_min_max_bounds(const VALUE& s,
+                              const VALUE& t,
                               uint64_t pos_x,
-                              BitVector& res_min_u,
-                              BitVector& res_max_u,
-                              BitVector& res_min_s,
-                              BitVector& res_max_s) override;
+                              VALUE& res_min_u,
+                              VALUE& res_max_u,
+                              VALUE& res_min_s,
+                              VALUE& res_max_s) override;
 
  private:
   /**
@@ -1327,9 +1306,9 @@ class BitVectorSlt : public BitVectorNode
    *                           derived from top-level inequalities since this
    *                           may trap us in a cycle (see is_essential()).
    */
-  bool _is_invertible(const BitVectorDomain* d,
-                      const BitVector& s,
-                      const BitVector& t,
+  bool _is_invertible(const BvDomain<VALUE>* d,
+                      const VALUE& s,
+                      const VALUE& t,
                       uint64_t pos_x,
                       bool is_essential_check);
   /**
@@ -1341,7 +1320,7 @@ class BitVectorSlt : public BitVectorNode
    * @param pos_x The index of operand `x`, which is a concat node.
    * @return The inverse value.
    */
-  BitVector* inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s);
+  VALUE* inverse_value_concat(bool t, uint64_t pos_x, uint64_t pos_s);
   /**
    * Helper for inverse_value_concat()  to generate a new random value with
    * respect to the given domain and within given min/max range.
@@ -1351,9 +1330,9 @@ class BitVectorSlt : public BitVectorNode
    * @return A random value within the given range, if there is one, else
    *         a null BitVector.
    */
-  BitVector inverse_value_concat_new_random(const BitVectorDomain& d,
-                                            const BitVector& min,
-                                            const BitVector& max);
+  VALUE inverse_value_concat_new_random(const BvDomain<VALUE>& d,
+                                        const VALUE& min,
+                                        const VALUE& max);
   /**
    * True to enable optimization for inverse_value computation of concat
    * and sign extension operands.
@@ -1363,18 +1342,16 @@ class BitVectorSlt : public BitVectorNode
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorUrem : public BitVectorNode
+template <class VALUE>
+class BvUrem : public BvNode<VALUE>
 {
  public:
   /** Constructors. */
-  BitVectorUrem(RNG* rng,
-                uint64_t size,
-                BitVectorNode* child0,
-                BitVectorNode* child1);
-  BitVectorUrem(RNG* rng,
-                const BitVectorDomain& domain,
-                BitVectorNode* child0,
-                BitVectorNode* child1);
+  BvUrem(RNG* rng, uint64_t size, BvNode<VALUE>* child0, BvNode<VALUE>* child1);
+  BvUrem(RNG* rng,
+         const BvDomain<VALUE>& domain,
+         BvNode<VALUE>* child0,
+         BvNode<VALUE>* child1);
 
   NodeKind kind() const override { return NodeKind::BV_UREM; }
 
@@ -1396,7 +1373,7 @@ class BitVectorUrem : public BitVectorNode
    *                  (s != t => \exists y. (
    *                      mfb(x, y) && y > t && (s - t) mod y = 0)
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -1415,12 +1392,11 @@ class BitVectorUrem : public BitVectorNode
    *                ((t = ones => mfb(x, 0)) &&
    *                 (t != ones => \exists y. (mfb(x, y) && y > t)))
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
  private:
   /**
@@ -1456,25 +1432,23 @@ class BitVectorUrem : public BitVectorNode
    * Pick a consistent value for pos_x = 0 with x > t.
    * Returns a null bit-vector if no such value can be found.
    */
-  BitVector consistent_value_pos0_aux(const BitVector& t);
+  VALUE consistent_value_pos0_aux(const VALUE& t);
   /** Cached inverse_value result. */
-  std::unique_ptr<BitVectorDomain> d_inverse_domain;
+  std::unique_ptr<BvDomain<VALUE>> d_inverse_domain;
 };
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorXor : public BitVectorNode
+template <class VALUE>
+class BvXor : public BvNode<VALUE>
 {
  public:
   /** Constructors. */
-  BitVectorXor(RNG* rng,
-               uint64_t size,
-               BitVectorNode* child0,
-               BitVectorNode* child1);
-  BitVectorXor(RNG* rng,
-               const BitVectorDomain& domain,
-               BitVectorNode* child0,
-               BitVectorNode* child1);
+  BvXor(RNG* rng, uint64_t size, BvNode<VALUE>* child0, BvNode<VALUE>* child1);
+  BvXor(RNG* rng,
+        const BvDomain<VALUE>& domain,
+        BvNode<VALUE>* child0,
+        BvNode<VALUE>* child1);
 
   NodeKind kind() const override { return NodeKind::BV_XOR; }
 
@@ -1485,7 +1459,7 @@ class BitVectorXor : public BitVectorNode
    *   w/o  const bits: true
    *   with const bits: mfb(x, s^t)
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -1494,12 +1468,11 @@ class BitVectorXor : public BitVectorNode
    *   w/o  const bits: true
    *   with const bits: true
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
  private:
   /**
@@ -1534,26 +1507,29 @@ class BitVectorXor : public BitVectorNode
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorIte : public BitVectorNode
+template <class VALUE>
+class BvIte : public BvNode<VALUE>
 {
  public:
   /** Constructors. */
-  BitVectorIte(RNG* rng,
-               uint64_t size,
-               BitVectorNode* child0,
-               BitVectorNode* child1,
-               BitVectorNode* child2);
-  BitVectorIte(RNG* rng,
-               const BitVectorDomain& domain,
-               BitVectorNode* child0,
-               BitVectorNode* child1,
-               BitVectorNode* child2);
+  BvIte(RNG* rng,
+        uint64_t size,
+        BvNode<VALUE>* child0,
+        BvNode<VALUE>* child1,
+        BvNode<VALUE>* child2);
+  BvIte(RNG* rng,
+        const BvDomain<VALUE>& domain,
+        BvNode<VALUE>* child0,
+        BvNode<VALUE>* child1,
+        BvNode<VALUE>* child2);
+
+  using BvNode<VALUE>::all_value;
 
   NodeKind kind() const override { return NodeKind::ITE; }
 
   void evaluate() override;
 
-  bool is_essential(const BitVector& t, uint64_t pos_x) override;
+  bool is_essential(const VALUE& t, uint64_t pos_x) override;
 
   /**
    * ite(_c, _t, _e)
@@ -1578,7 +1554,7 @@ class BitVectorIte : public BitVectorNode
    *       pos_x = 2: s0 == false && mfb(x, t)
    *                  with s0 the value for '_c'
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -1587,15 +1563,14 @@ class BitVectorIte : public BitVectorNode
    *   w/o  const bits: true
    *   with const bits: true
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
   std::tuple<uint64_t, bool, bool> select_path(
-      const BitVector& t, std::vector<uint64_t>& ess_inputs) override;
+      const VALUE& t, std::vector<uint64_t>& ess_inputs) override;
 
  private:
   uint64_t select_path_non_const(std::vector<uint64_t>& inputs) const override;
@@ -1631,25 +1606,26 @@ class BitVectorIte : public BitVectorNode
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorNot : public BitVectorNode
+template <class VALUE>
+class BvNot : public BvNode<VALUE>
 {
  public:
   /** Constructors. */
-  BitVectorNot(RNG* rng, uint64_t size, BitVectorNode* child0);
-  BitVectorNot(RNG* rng, const BitVectorDomain& domain, BitVectorNode* child0);
+  BvNot(RNG* rng, uint64_t size, BvNode<VALUE>* child0);
+  BvNot(RNG* rng, const BvDomain<VALUE>& domain, BvNode<VALUE>* child0);
 
   NodeKind kind() const override { return NodeKind::BV_NOT; }
 
   void evaluate() override;
 
-  bool is_essential(const BitVector& t, uint64_t pos_x) override;
+  bool is_essential(const VALUE& t, uint64_t pos_x) override;
 
   /**
    * IC:
    *   w/o  const bits: true
    *   with const bits: mfb(x, ~t)
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -1658,12 +1634,11 @@ class BitVectorNot : public BitVectorNode
    *   w/o  const bits: true
    *   with const bits: IC
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
  private:
   /**
@@ -1698,7 +1673,8 @@ class BitVectorNot : public BitVectorNode
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorExtract : public BitVectorNode
+template <class VALUE>
+class BvExtract : public BvNode<VALUE>
 {
  public:
   /**
@@ -1711,12 +1687,12 @@ class BitVectorExtract : public BitVectorNode
    * @param normalize True if this extract should be registered in its child
    *                  node for normalization.
    */
-  BitVectorExtract(RNG* rng,
-                   uint64_t size,
-                   BitVectorNode* child0,
-                   uint64_t hi,
-                   uint64_t lo,
-                   bool normalize);
+  BvExtract(RNG* rng,
+            uint64_t size,
+            BvNode<VALUE>* child0,
+            uint64_t hi,
+            uint64_t lo,
+            bool normalize);
   /**
    * Constructor.
    * @param rng       The associated random number generator.
@@ -1727,25 +1703,25 @@ class BitVectorExtract : public BitVectorNode
    * @param normalize True if this extract should be registered in its child
    *                  node for normalization.
    */
-  BitVectorExtract(RNG* rng,
-                   const BitVectorDomain& domain,
-                   BitVectorNode* child0,
-                   uint64_t hi,
-                   uint64_t lo,
-                   bool normalize);
+  BvExtract(RNG* rng,
+            const BvDomain<VALUE>& domain,
+            BvNode<VALUE>* child0,
+            uint64_t hi,
+            uint64_t lo,
+            bool normalize);
 
   NodeKind kind() const override { return NodeKind::BV_EXTRACT; }
 
   void evaluate() override;
 
-  bool is_essential(const BitVector& t, uint64_t pos_x) override;
+  bool is_essential(const VALUE& t, uint64_t pos_x) override;
 
   /**
    * IC:
    *   w/o  const bits: true
    *   with const bits: mfb(x[hi:lo], t)
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -1754,12 +1730,11 @@ class BitVectorExtract : public BitVectorNode
    *   w/o  const bits: true
    *   with const bits: IC
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
   std::string str() const override;
 
@@ -1775,10 +1750,19 @@ class BitVectorExtract : public BitVectorNode
    * (upper index is msb, lower index is lsb).
    * @param node The normalized representation of the child node.
    */
-  void normalize(BitVectorNode* node);
+  void normalize(BvNode<VALUE>* node);
 
   /** @return True if this extract is normalized. */
   bool is_normalized() const;
+  /**
+   * @return The original child that has been replaced with a normalized node,
+   *         nullptr if this extract is not normalized.
+   */
+  BvNode<VALUE>* child0_original() const;
+  /** @return The upper index of this extract before normalization. */
+  uint64_t hi_original() const;
+  /** @return The lower index of this extract before normalization. */
+  uint64_t lo_original() const;
 
  private:
   /**
@@ -1826,19 +1810,19 @@ class BitVectorExtract : public BitVectorNode
    * Nullptr if d_hi = msb.
    * Cache for inverse_value.
    */
-  std::unique_ptr<BitVectorDomain> d_x_slice_left;
+  std::unique_ptr<BvDomain<VALUE>> d_x_slice_left;
   /**
    * Right part of don't care bits, that is, all bits < d_lo.
    * Nullptr if d_lo = 0.
    * Cache for inverse_value.
    */
-  std::unique_ptr<BitVectorDomain> d_x_slice_right;
+  std::unique_ptr<BvDomain<VALUE>> d_x_slice_right;
 
   /**
    * Cache the original child node that has been replaced with a normalized
    * node. We cache to be able to restore in incremental mode.
    */
-  BitVectorNode* d_child0_original = nullptr;
+  BvNode<VALUE>* d_child0_original = nullptr;
   /**
    * Cache the original upper index, replaced by the msb index after
    * normalization. We cache to be able to restore in incremental mode.
@@ -1853,18 +1837,16 @@ class BitVectorExtract : public BitVectorNode
 
 /* -------------------------------------------------------------------------- */
 
-class BitVectorSignExtend : public BitVectorNode
+template <class VALUE>
+class BvSignExtend : public BvNode<VALUE>
 {
  public:
   /** Constructors. */
-  BitVectorSignExtend(RNG* rng,
-                      uint64_t size,
-                      BitVectorNode* child0,
-                      uint64_t n);
-  BitVectorSignExtend(RNG* rng,
-                      const BitVectorDomain& domain,
-                      BitVectorNode* child0,
-                      uint64_t n);
+  BvSignExtend(RNG* rng, uint64_t size, BvNode<VALUE>* child0, uint64_t n);
+  BvSignExtend(RNG* rng,
+               const BvDomain<VALUE>& domain,
+               BvNode<VALUE>* child0,
+               uint64_t n);
 
   /**
    * Get the number of extension bits.
@@ -1876,16 +1858,16 @@ class BitVectorSignExtend : public BitVectorNode
 
   void evaluate() override;
 
-  virtual void normalize_bounds(BitVector* min_u,
-                                BitVector* max_u,
-                                BitVector* min_s,
-                                BitVector* max_s,
-                                BitVector& res_min_lo,
-                                BitVector& res_max_lo,
-                                BitVector& res_min_hi,
-                                BitVector& res_max_hi) override;
+  virtual void normalize_bounds(VALUE* min_u,
+                                VALUE* max_u,
+                                VALUE* min_s,
+                                VALUE* max_s,
+                                VALUE& res_min_lo,
+                                VALUE& res_max_lo,
+                                VALUE& res_min_hi,
+                                VALUE& res_max_hi) override;
 
-  bool is_essential(const BitVector& t, uint64_t pos_x) override;
+  bool is_essential(const VALUE& t, uint64_t pos_x) override;
 
   /**
    * IC:
@@ -1896,7 +1878,7 @@ class BitVectorSignExtend : public BitVectorNode
    *
    *   with const bits: IC_wo && mfb(x, t_x)
    */
-  bool is_invertible(const BitVector& t,
+  bool is_invertible(const VALUE& t,
                      uint64_t pos_x,
                      bool is_essential_check = false) override;
 
@@ -1905,12 +1887,11 @@ class BitVectorSignExtend : public BitVectorNode
    *   w/o  const bits: true
    *   with const bits: IC
    */
-  bool is_consistent(const BitVector& t, uint64_t pos_x) override;
+  bool is_consistent(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& inverse_value(const BitVector& t, uint64_t pos_x) override;
+  const VALUE& inverse_value(const VALUE& t, uint64_t pos_x) override;
 
-  const BitVector& consistent_value(const BitVector& t,
-                                    uint64_t pos_x) override;
+  const VALUE& consistent_value(const VALUE& t, uint64_t pos_x) override;
 
   std::string str() const override;
 
@@ -1950,6 +1931,27 @@ class BitVectorSignExtend : public BitVectorNode
 
 /* -------------------------------------------------------------------------- */
 
+using BitVectorNode       = BvNode<BitVector>;
+using BitVectorAdd        = BvAdd<BitVector>;
+using BitVectorAnd        = BvAnd<BitVector>;
+using BitVectorConcat     = BvConcat<BitVector>;
+using BitVectorEq         = BvEq<BitVector>;
+using BitVectorMul        = BvMul<BitVector>;
+using BitVectorShl        = BvShl<BitVector>;
+using BitVectorShr        = BvShr<BitVector>;
+using BitVectorAshr       = BvAshr<BitVector>;
+using BitVectorUdiv       = BvUdiv<BitVector>;
+using BitVectorUlt        = BvUlt<BitVector>;
+using BitVectorSlt        = BvSlt<BitVector>;
+using BitVectorUrem       = BvUrem<BitVector>;
+using BitVectorXor        = BvXor<BitVector>;
+using BitVectorIte        = BvIte<BitVector>;
+using BitVectorNot        = BvNot<BitVector>;
+using BitVectorExtract    = BvExtract<BitVector>;
+using BitVectorSignExtend = BvSignExtend<BitVector>;
+
+/* -------------------------------------------------------------------------- */
+
 }  // namespace ls
 }  // namespace bzla
 #endif
@@ -15,6 +15,7 @@
 #include <iostream>
 
 #include "bv/bitvector.h"
+#include "bv/word64.h"
 #include "ls/bv/bitvector_node.h"
 #include "rng/rng.h"
 
@@ -69,6 +70,7 @@ struct LocalSearchMove
 };
 
 template struct LocalSearchMove<BitVector>;
+template struct LocalSearchMove<Word64>;
 
 /* -------------------------------------------------------------------------- */
 
@@ -614,6 +616,7 @@ LocalSearch<VALUE>::move()
 }
 
 template class LocalSearch<BitVector>;
+template class LocalSearch<Word64>;
 
 /* -------------------------------------------------------------------------- */
 
@@ -96,6 +96,79 @@ struct LocalSearchMove;
 
 /* -------------------------------------------------------------------------- */
 
+/** The statistics of the local search module. */
+struct LocalSearchStatistics
+{
+  uint64_t d_nprops   = 0;
+  uint64_t d_nupdates = 0;
+  uint64_t d_nmoves   = 0;
+
+  uint64_t d_nprops_inv  = 0;
+  uint64_t d_nprops_cons = 0;
+
+  uint64_t d_nconf_total = 0;
+
+#ifndef NDEBUG
+  std::unordered_map<NodeKind, uint64_t> d_ninv;
+  std::unordered_map<NodeKind, uint64_t> d_ncons;
+  std::unordered_map<NodeKind, uint64_t> d_nconf;
+#endif
+};
+
+/** The configuration options of the local search module. */
+struct LocalSearchOptions
+{
+  /**
+   * True if path is to be selected based on essential inputs, false if it is
+   * to be selected randomly.
+   *
+   * @note If path selection based on essential inputs is enabled, we do not
+   *       always pick an essential input (if there is one) but only with
+   *       probability `prob_pick_ess_input` for completeness (to avoid
+   *       cycles), and else a random input. Consider the following example:
+   *       Assume we have 3 roots:
+   *         y_[64] <= z_[64]
+   *         z_[64] <= sign_extend((1844674407_[32] + x_[32]), 32)
+   *         (844674407_[32] + x_[32]) <= 0_[32]
+   *       Now, assume that the first root and one of the other two are
+   *       satisfied with the initial assignment where all inputs are
+   *       assigned to zero. Now, due to the inequality bounds derived from
+   *       root 1 and 2/3 (depending on which one is satisfied), either the
+   *       sign extension or the addition are essential, but z never is.
+   *       Thus, we never propagate down to z and the first root (and thus
+   *       the bounds of these two terms) remain unchanged. This traps us
+   *       cycling between root 2 and 3 but never reaching a satisfiable
+   *       assignment, which would require us to change the assignments of y
+   *       or z.
+   */
+  bool use_path_sel_essential = true;
+  /**
+   * True to infer bounds for top-level inequalities for invertibility
+   * conditions and inverse value computation.
+   */
+  bool use_ineq_bounds = false;
+  /**
+   * True to enable optimization for inverse value computation of
+   * inequalities over concat and sign extension operands.
+   */
+  bool use_opt_lt_concat_sext = false;
+  /**
+   * Probability for producing an inverse rather than a consistent value when
+   * invertibility condition for operand `x` wrt. to target value `t` and
+   * constant bits is true. We do not always choose an inverse value for
+   * invertible operations for completeness (to avoid cycles), and else a
+   * consistent value. Interpreted as prob_inv_value * 1/10 %.
+   */
+  uint32_t prob_pick_inv_value = 990;
+  /**
+   * Probability for picking an essential input if there is one, and else
+   * a random input (see use_path_sel_essential).
+   */
+  uint32_t prob_pick_ess_input = 990;
+};
+
+/* -------------------------------------------------------------------------- */
+
 template <class VALUE>
 class LocalSearch
 {
@@ -104,75 +177,11 @@ class LocalSearch
   using ParentsSet   = std::unordered_set<uint64_t>;
   using ParentsMap   = std::unordered_map<uint64_t, ParentsSet>;
 
-  struct
-  {
-    uint64_t d_nprops   = 0;
-    uint64_t d_nupdates = 0;
-    uint64_t d_nmoves   = 0;
-
-    uint64_t d_nprops_inv  = 0;
-    uint64_t d_nprops_cons = 0;
-
-    uint64_t d_nconf_total = 0;
-
-#ifndef NDEBUG
-    std::unordered_map<NodeKind, uint64_t> d_ninv;
-    std::unordered_map<NodeKind, uint64_t> d_ncons;
-    std::unordered_map<NodeKind, uint64_t> d_nconf;
-#endif
-  } d_statistics;
+  /** The statistics of the local search module. */
+  LocalSearchStatistics d_statistics;
 
   /** The configuration options of the local search module. */
-  struct
-  {
-    /**
-     * True if path is to be selected based on essential inputs, false if it is
-     * to be selected randomly.
-     *
-     * @note If path selection based on essential inputs is enabled, we do not
-     *       always pick an essential input (if there is one) but only with
-     *       probability `prob_pick_ess_input` for completeness (to avoid
-     *       cycles), and else a random input. Consider the following example:
-     *       Assume we have 3 roots:
-     *         y_[64] <= z_[64]
-     *         z_[64] <= sign_extend((1844674407_[32] + x_[32]), 32)
-     *         (844674407_[32] + x_[32]) <= 0_[32]
-     *       Now, assume that the first root and one of the other two are
-     *       satisfied with the initial assignment where all inputs are
-     *       assigned to zero. Now, due to the inequality bounds derived from
-     *       root 1 and 2/3 (depending on which one is satisfied), either the
-     *       sign extension or the addition are essential, but z never is.
-     *       Thus, we never propagate down to z and the first root (and thus
-     *       the bounds of these two terms) remain unchanged. This traps us
-     *       cycling between root 2 and 3 but never reaching a satisfiable
-     *       assignment, which would require us to change the assignments of y
-     *       or z.
-     */
-    bool use_path_sel_essential = true;
-    /**
-     * True to infer bounds for top-level inequalities for invertibility
-     * conditions and inverse value computation.
-     */
-    bool use_ineq_bounds = false;
-    /**
-     * True to enable optimization for inverse value computation of
-     * inequalities over concat and sign extension operands.
-     */
-    bool use_opt_lt_concat_sext = false;
-    /**
-     * Probability for producing an inverse rather than a consistent value when
-     * invertibility condition for operand `x` wrt. to target value `t` and
-     * constant bits is true. We do not always choose an inverse value for
-     * invertible operations for completeness (to avoid cycles), and else a
-     * consistent value. Interpreted as prob_inv_value * 1/10 %.
-     */
-    uint32_t prob_pick_inv_value = 990;
-    /**
-     * Probability for picking an essential input if there is one, and else
-     * a random input (see use_path_sel_essential).
-     */
-    uint32_t prob_pick_ess_input = 990;
-  } d_options;
+  LocalSearchOptions d_options;
 
   /**
    * Constructor.
@@ -10,120 +10,131 @@
 
 #include "ls/ls_bv.h"
 
+#include <algorithm>
 #include <cassert>
-#include <functional>
 #include <iostream>
 #include <unordered_set>
 
 #include "bv/bitvector.h"
+#include "bv/word64.h"
 #include "ls/bv/bitvector_domain.h"
 #include "ls/bv/bitvector_node.h"
+#include "rng/rng.h"
 
 namespace bzla::ls {
 
-/* LocalSearchBv public ----------------------------------------------------- */
+/* BvLocalSearch public ----------------------------------------------------- */
 
-LocalSearchBV::LocalSearchBV(uint64_t max_nprops,
-                             uint64_t max_nupdates,
-                             uint32_t seed)
-    : LocalSearch<BitVector>(max_nprops, max_nupdates, seed)
+template <class VALUE>
+BvLocalSearch<VALUE>::BvLocalSearch(uint64_t max_nprops,
+                                    uint64_t max_nupdates,
+                                    uint32_t seed)
+    : LocalSearch<VALUE>(max_nprops, max_nupdates, seed)
 
 {
-  d_true.reset(new BitVector(BitVector::mk_true()));
+  this->d_true.reset(new VALUE(VALUE::mk_true()));
 }
 
+template <class VALUE>
 uint64_t
-LocalSearchBV::mk_node(NodeKind kind,
-                       uint64_t size,
-                       const std::vector<uint64_t>& children,
-                       const std::vector<uint64_t>& indices,
-                       const std::optional<std::string>& symbol)
+BvLocalSearch<VALUE>::mk_node(NodeKind kind,
+                              uint64_t size,
+                              const std::vector<uint64_t>& children,
+                              const std::vector<uint64_t>& indices,
+                              const std::optional<std::string>& symbol)
 {
   return _mk_node(kind, size, children, indices, true, symbol);
 }
 
+template <class VALUE>
 uint64_t
-LocalSearchBV::mk_node(NodeKind kind,
-                       const BitVectorDomain& domain,
-                       const std::vector<uint64_t>& children,
-                       const std::vector<uint64_t>& indices,
-                       const std::optional<std::string>& symbol)
+BvLocalSearch<VALUE>::mk_node(NodeKind kind,
+                              const BvDomain<VALUE>& domain,
+                              const std::vector<uint64_t>& children,
+                              const std::vector<uint64_t>& indices,
+                              const std::optional<std::string>& symbol)
 {
   return _mk_node(kind, domain, children, indices, true, symbol);
 }
 
+template <class VALUE>
 uint64_t
-LocalSearchBV::mk_node(const BitVector& assignment,
-                       const BitVectorDomain& domain,
-                       const std::optional<std::string>& symbol)
+BvLocalSearch<VALUE>::mk_node(const VALUE& assignment,
+                              const BvDomain<VALUE>& domain,
+                              const std::optional<std::string>& symbol)
 {
   assert(assignment.size() == domain.size());  // API check
-  uint64_t id = d_nodes.size();
-  std::unique_ptr<BitVectorNode> res(
-      new BitVectorNode(d_rng.get(), assignment, domain));
+  uint64_t id = this->d_nodes.size();
+  std::unique_ptr<BvNode<VALUE>> res(
+      new BvNode<VALUE>(this->d_rng.get(), assignment, domain));
   res->set_id(id);
   res->set_symbol(symbol);
-  d_nodes.push_back(std::move(res));
-  assert(get_node(id) == d_nodes.back().get());
-  assert(d_parents.find(id) == d_parents.end());
-  d_parents[id] = {};
+  this->d_nodes.push_back(std::move(res));
+  assert(get_node(id) == this->d_nodes.back().get());
+  assert(this->d_parents.find(id) == this->d_parents.end());
+  this->d_parents[id] = {};
   return id;
 }
 
+template <class VALUE>
 uint64_t
-LocalSearchBV::invert_node(uint64_t id)
+BvLocalSearch<VALUE>::invert_node(uint64_t id)
 {
-  assert(id < d_nodes.size());  // API check
+  assert(id < this->d_nodes.size());  // API check
   return mk_node(NodeKind::NOT, get_node(id)->domain().bvnot(), {id});
 }
 
-const BitVectorDomain&
-LocalSearchBV::get_domain(uint64_t id) const
+template <class VALUE>
+const BvDomain<VALUE>&
+BvLocalSearch<VALUE>::get_domain(uint64_t id) const
 {
-  assert(id < d_nodes.size());  // API check
+  assert(id < this->d_nodes.size());  // API check
   return get_node(id)->domain();
 }
 
+template <class VALUE>
 void
-LocalSearchBV::fix_bit(uint64_t id, uint32_t idx, bool value)
+BvLocalSearch<VALUE>::fix_bit(uint64_t id, uint32_t idx, bool value)
 {
-  assert(id < d_nodes.size());  // API check
-  BitVectorNode* node = get_node(id);
+  assert(id < this->d_nodes.size());  // API check
+  BvNode<VALUE>* node = get_node(id);
   assert(idx < node->domain().size());  // API check
   node->fix_bit(idx, value);
 }
 
-/* LocalSearchBv private ---------------------------------------------------- */
+/* BvLocalSearch private ---------------------------------------------------- */
 
+template <class VALUE>
 uint64_t
-LocalSearchBV::_mk_node(NodeKind kind,
-                        uint64_t size,
-                        const std::vector<uint64_t>& children,
-                        const std::vector<uint64_t>& indices,
-                        bool normalize,
-                        const std::optional<std::string>& symbol)
+BvLocalSearch<VALUE>::_mk_node(NodeKind kind,
+                               uint64_t size,
+                               const std::vector<uint64_t>& children,
+                               const std::vector<uint64_t>& indices,
+                               bool normalize,
+                               const std::optional<std::string>& symbol)
 {
   return _mk_node(
-      kind, BitVectorDomain(size), children, indices, normalize, symbol);
+      kind, BvDomain<VALUE>(size), children, indices, normalize, symbol);
 }
 
+template <class VALUE>
 uint64_t
-LocalSearchBV::_mk_node(NodeKind kind,
-                        const BitVectorDomain& domain,
-                        const std::vector<uint64_t>& children,
-                        const std::vector<uint64_t>& indices,
-                        bool normalize,
-                        const std::optional<std::string>& symbol)
-{
-  uint64_t id = d_nodes.size();
+BvLocalSearch<VALUE>::_mk_node(NodeKind kind,
+                               const BvDomain<VALUE>& domain,
+                               const std::vector<uint64_t>& children,
+                               const std::vector<uint64_t>& indices,
+                               bool normalize,
+                               const std::optional<std::string>& symbol)
+{
+  uint64_t id = this->d_nodes.size();
   for (uint64_t c : children)
   {
     assert(c < id);  // API check
-    assert(d_parents.find(c) != d_parents.end());
-    d_parents.at(c).insert(id);
+    assert(this->d_parents.find(c) != this->d_parents.end());
+    this->d_parents.at(c).insert(id);
   }
 
-  std::unique_ptr<BitVectorNode> res;
+  std::unique_ptr<BvNode<VALUE>> res;
 
   switch (kind)
   {
@@ -135,13 +146,15 @@ LocalSearchBV::_mk_node(NodeKind kind,
     case NodeKind::EQ:
       assert(children.size() == 2);  // API check
       assert(indices.size() == 0);   // API check
-      res.reset(new BitVectorEq(
-          d_rng.get(), domain, get_node(children[0]), get_node(children[1])));
+      res.reset(new BvEq<VALUE>(this->d_rng.get(),
+                                domain,
+                                get_node(children[0]),
+                                get_node(children[1])));
       break;
     case NodeKind::ITE:
       assert(children.size() == 3);  // API check
       assert(indices.size() == 0);   // API check
-      res.reset(new BitVectorIte(d_rng.get(),
+      res.reset(new BvIte<VALUE>(this->d_rng.get(),
                                  domain,
                                  get_node(children[0]),
                                  get_node(children[1]),
@@ -150,89 +163,110 @@ LocalSearchBV::_mk_node(NodeKind kind,
     case NodeKind::BV_ADD:
       assert(children.size() == 2);  // API check
       assert(indices.size() == 0);   // API check
-      res.reset(new BitVectorAdd(
-          d_rng.get(), domain, get_node(children[0]), get_node(children[1])));
+      res.reset(new BvAdd<VALUE>(this->d_rng.get(),
+                                 domain,
+                                 get_node(children[0]),
+                                 get_node(children[1])));
       break;
 
     case NodeKind::AND:
     case NodeKind::BV_AND:
       assert(children.size() == 2);  // API check
       assert(indices.size() == 0);   // API check
-      res.reset(new BitVectorAnd(
-          d_rng.get(), domain, get_node(children[0]), get_node(children[1])));
+      res.reset(new BvAnd<VALUE>(this->d_rng.get(),
+                                 domain,
+                                 get_node(children[0]),
+                                 get_node(children[1])));
       break;
     case NodeKind::BV_ASHR:
       assert(children.size() == 2);  // API check
       assert(indices.size() == 0);   // API check
-      res.reset(new BitVectorAshr(
-          d_rng.get(), domain, get_node(children[0]), get_node(children[1])));
+      res.reset(new BvAshr<VALUE>(this->d_rng.get(),
+                                  domain,
+                                  get_node(children[0]),
+                                  get_node(children[1])));
       break;
     case NodeKind::BV_CONCAT:
       assert(children.size() == 2);  // API check
       assert(indices.size() == 0);   // API check
-      res.reset(new BitVectorConcat(
-          d_rng.get(), domain, get_node(children[0]), get_node(children[1])));
+      res.reset(new BvConcat<VALUE>(this->d_rng.get(),
+                                    domain,
+                                    get_node(children[0]),
+                                    get_node(children[1])));
       break;
     case NodeKind::BV_MUL:
       assert(children.size() == 2);  // API check
       assert(indices.size() == 0);   // API check
-      res.reset(new BitVectorMul(
-          d_rng.get(), domain, get_node(children[0]), get_node(children[1])));
+      res.reset(new BvMul<VALUE>(this->d_rng.get(),
+                                 domain,
+                                 get_node(children[0]),
+                                 get_node(children[1])));
       break;
     case NodeKind::NOT:
     case NodeKind::BV_NOT:
       assert(children.size() == 1);  // API check
       assert(indices.size() == 0);   // API check
-      res.reset(new BitVectorNot(d_rng.get(), domain, get_node(children[0])));
+      res.reset(new BvNot<VALUE>(
+          this->d_rng.get(), domain, get_node(children[0])));
       break;
     case NodeKind::BV_SHL:
       assert(children.size() == 2);  // API check
       assert(indices.size() == 0);   // API check
-      res.reset(new BitVectorShl(
-          d_rng.get(), domain, get_node(children[0]), get_node(children[1])));
+      res.reset(new BvShl<VALUE>(this->d_rng.get(),
+                                 domain,
+                                 get_node(children[0]),
+                                 get_node(children[1])));
       break;
     case NodeKind::BV_SHR:
       assert(children.size() == 2);  // API check
       assert(indices.size() == 0);   // API check
-      res.reset(new BitVectorShr(
-          d_rng.get(), domain, get_node(children[0]), get_node(children[1])));
+      res.reset(new BvShr<VALUE>(this->d_rng.get(),
+                                 domain,
+                                 get_node(children[0]),
+                                 get_node(children[1])));
       break;
     case NodeKind::BV_SLT:
       assert(children.size() == 2);  // API check
       assert(indices.size() == 0);   // API check
-      res.reset(new BitVectorSlt(d_rng.get(),
+      res.reset(new BvSlt<VALUE>(this->d_rng.get(),
                                  domain,
                                  get_node(children[0]),
                                  get_node(children[1]),
-                                 d_options.use_opt_lt_concat_sext));
+                                 this->d_options.use_opt_lt_concat_sext));
       break;
     case NodeKind::BV_UDIV:
       assert(children.size() == 2);  // API check
       assert(indices.size() == 0);   // API check
-      res.reset(new BitVectorUdiv(
-          d_rng.get(), domain, get_node(children[0]), get_node(children[1])));
+      res.reset(new BvUdiv<VALUE>(this->d_rng.get(),
+                                  domain,
+                                  get_node(children[0]),
+                                  get_node(children[1])));
       break;
     case NodeKind::BV_ULT:
       assert(children.size() == 2);  // API check
       assert(indices.size() == 0);   // API check
-      res.reset(new BitVectorUlt(d_rng.get(),
+      res.reset(new BvUlt<VALUE>(this->d_rng.get(),
                                  domain,
                                  get_node(children[0]),
                                  get_node(children[1]),
-                                 d_options.use_opt_lt_concat_sext));
+                                 this->d_options.use_opt_lt_concat_sext));
       break;
     case NodeKind::BV_UREM:
       assert(children.size() == 2);  // API check
       assert(indices.size() == 0);   // API check
-      res.reset(new BitVectorUrem(
-          d_rng.get(), domain, get_node(children[0]), get_node(children[1])));
+      res.reset(new BvUrem<VALUE>(this->d_rng.get(),
+                                  domain,
+                                  get_node(children[0]),
+                                  get_node(children[1])));
       break;
     case NodeKind::XOR:
     case NodeKind::BV_XOR:
       assert(children.size() == 2);  // API check
       assert(indices.size() == 0);   // API check
-      res.reset(new BitVectorXor(
-          d_rng.get(), domain, get_node(children[0]), get_node(children[1])));
+      res.reset(new BvXor<VALUE>(this->d_rng.get(),
+                                 domain,
+                                 get_node(children[0]),
+                                 get_node(children[1])));
       break;
 
     case NodeKind::BV_EXTRACT: {
@@ -240,9 +274,13 @@ LocalSearchBV::_mk_node(NodeKind kind,
       assert(indices.size() == 2);       // API check
       assert(indices[0] >= indices[1]);  // API check
       assert(indices[0] < get_node(children[0])->size());
-      BitVectorNode* child0 = get_node(children[0]);
-      res.reset(new BitVectorExtract(
-          d_rng.get(), domain, child0, indices[0], indices[1], normalize));
+      BvNode<VALUE>* child0 = get_node(children[0]);
+      res.reset(new BvExtract<VALUE>(this->d_rng.get(),
+                                     domain,
+                                     child0,
+                                     indices[0],
+                                     indices[1],
+                                     normalize));
       if (normalize)
       {
         d_to_normalize_nodes.insert(child0);
@@ -253,52 +291,54 @@ LocalSearchBV::_mk_node(NodeKind kind,
     case NodeKind::BV_SEXT:
       assert(children.size() == 1);  // API check
       assert(indices.size() == 1);   // API check
-      res.reset(new BitVectorSignExtend(
-          d_rng.get(), domain, get_node(children[0]), indices[0]));
+      res.reset(new BvSignExtend<VALUE>(
+          this->d_rng.get(), domain, get_node(children[0]), indices[0]));
       break;
 
     default: assert(0);  // API check
   }
   res->set_id(id);
   res->set_symbol(symbol);
-  d_nodes.push_back(std::move(res));
-  assert(get_node(id) == d_nodes.back().get());
-  assert(d_parents.find(id) == d_parents.end());
-  d_parents[id] = {};
+  this->d_nodes.push_back(std::move(res));
+  assert(get_node(id) == this->d_nodes.back().get());
+  assert(this->d_parents.find(id) == this->d_parents.end());
+  this->d_parents[id] = {};
 
   return id;
 }
 
-BitVectorNode*
-LocalSearchBV::get_node(uint64_t id) const
+template <class VALUE>
+BvNode<VALUE>*
+BvLocalSearch<VALUE>::get_node(uint64_t id) const
 {
-  return reinterpret_cast<BitVectorNode*>(LocalSearch<BitVector>::get_node(id));
+  return reinterpret_cast<BvNode<VALUE>*>(LocalSearch<VALUE>::get_node(id));
 }
 
+template <class VALUE>
 void
-LocalSearchBV::update_bounds_aux(BitVectorNode* root, int32_t pos)
+BvLocalSearch<VALUE>::update_bounds_aux(BvNode<VALUE>* root, int32_t pos)
 {
   assert(root->is_inequality());
   assert(root->arity() == 2);
 
-  BitVectorNode* child0 = root->child(0);
-  BitVectorNode* child1 = root->child(1);
+  BvNode<VALUE>* child0 = root->child(0);
+  BvNode<VALUE>* child1 = root->child(1);
   bool is_signed        = root->kind() == NodeKind::BV_SLT;
   uint64_t size         = child0->size();
-  BitVector min_value, max_value;
+  VALUE min_value, max_value;
 
   if (is_signed)
   {
-    min_value = BitVector::mk_min_signed(size);
-    max_value = BitVector::mk_max_signed(size);
+    min_value = VALUE::mk_min_signed(size);
+    max_value = VALUE::mk_max_signed(size);
   }
   else
   {
-    min_value = BitVector::mk_zero(size);
-    max_value = BitVector::mk_ones(size);
+    min_value = VALUE::mk_zero(size);
+    max_value = VALUE::mk_ones(size);
   }
 
-  bool is_ult = d_roots_ineq.at(root);
+  bool is_ult = this->d_roots_ineq.at(root);
   assert((is_ult && root->assignment().is_true())
          || (!is_ult && root->assignment().is_false()));
   if (is_ult)
@@ -355,23 +395,25 @@ LocalSearchBV::update_bounds_aux(BitVectorNode* root, int32_t pos)
   }
 }
 
+template <class VALUE>
 void
-LocalSearchBV::compute_bounds(Node<BitVector>* node)
+BvLocalSearch<VALUE>::compute_bounds(Node<VALUE>* node)
 {
-  BitVectorNode* n = reinterpret_cast<BitVectorNode*>(node);
+  BvNode<VALUE>* n = reinterpret_cast<BvNode<VALUE>*>(node);
   for (uint32_t i = 0, arity = node->arity(); i < arity; ++i)
   {
     n->child(i)->reset_bounds();
   }
   for (uint32_t i = 0, arity = node->arity(); i < arity; ++i)
   {
-    const BitVectorNode* child                  = n->child(i);
-    const std::unordered_set<uint64_t>& parents = d_parents.at(child->id());
+    const BvNode<VALUE>* child                  = n->child(i);
+    const std::unordered_set<uint64_t>& parents =
+        this->d_parents.at(child->id());
     for (uint64_t pid : parents)
     {
-      BitVectorNode* p = get_node(pid);
-      if (!is_ineq_root(p)) continue;
-      if (p->assignment().is_true() != d_roots_ineq.at(p)) continue;
+      BvNode<VALUE>* p = get_node(pid);
+      if (!this->is_ineq_root(p)) continue;
+      if (p->assignment().is_true() != this->d_roots_ineq.at(p)) continue;
       if (p->kind() == NodeKind::BV_NOT)
       {
         p = p->child(0);
@@ -383,8 +425,9 @@ LocalSearchBV::compute_bounds(Node<BitVector>* node)
   }
 }
 
+template <class VALUE>
 std::vector<std::pair<uint64_t, uint64_t>>
-LocalSearchBV::split_indices(BitVectorNode* node)
+BvLocalSearch<VALUE>::split_indices(BvNode<VALUE>* node)
 {
   std::unordered_set<std::pair<uint64_t, uint64_t>> slices{
       {node->size() - 1, 0}};
@@ -395,7 +438,7 @@ LocalSearchBV::split_indices(BitVectorNode* node)
     return {};
   }
 
-  for (BitVectorExtract* ex : extracts)
+  for (BvExtract<VALUE>* ex : extracts)
   {
     slices.insert({ex->hi(), ex->lo()});
   }
@@ -476,10 +519,11 @@ LocalSearchBV::split_indices(BitVectorNode* node)
   return sorted;
 }
 
-BitVectorNode*
-LocalSearchBV::mk_normalized_extract(BitVectorNode* child,
-                                     uint64_t hi,
-                                     uint64_t lo)
+template <class VALUE>
+BvNode<VALUE>*
+BvLocalSearch<VALUE>::mk_normalized_extract(BvNode<VALUE>* child,
+                                            uint64_t hi,
+                                            uint64_t lo)
 {
   assert(child);
   return get_node(_mk_node(NodeKind::BV_EXTRACT,
@@ -489,9 +533,10 @@ LocalSearchBV::mk_normalized_extract(BitVectorNode* child,
                            false));
 }
 
-BitVectorNode*
-LocalSearchBV::mk_normalized_concat(BitVectorNode* child0,
-                                    BitVectorNode* child1)
+template <class VALUE>
+BvNode<VALUE>*
+BvLocalSearch<VALUE>::mk_normalized_concat(BvNode<VALUE>* child0,
+                                           BvNode<VALUE>* child1)
 {
   assert(child0);
   assert(child1);
@@ -500,21 +545,22 @@ LocalSearchBV::mk_normalized_concat(BitVectorNode* child0,
                           {child0->id(), child1->id()}));
 }
 
+template <class VALUE>
 void
-LocalSearchBV::normalize_extracts(BitVectorNode* node)
+BvLocalSearch<VALUE>::normalize_extracts(BvNode<VALUE>* node)
 {
   const auto& extracts = node->get_extracts();
   if (extracts.size() < 2) return;
 
   std::vector<std::pair<uint64_t, uint64_t>> sorted_idxs = split_indices(node);
 
-  for (BitVectorExtract* ex : extracts)
+  for (BvExtract<VALUE>* ex : extracts)
   {
     if (ex->is_normalized()) continue;
 
     uint64_t hi               = ex->hi();
     uint64_t lo               = ex->lo();
-    BitVectorNode* normalized = nullptr;
+    BvNode<VALUE>* normalized = nullptr;
     for (auto rit = sorted_idxs.rbegin(); rit != sorted_idxs.rend(); ++rit)
     {
       if (rit->first == hi)
@@ -539,26 +585,406 @@ LocalSearchBV::normalize_extracts(BitVectorNode* node)
     if (normalized)
     {
       uint64_t id = normalized->id();
-      assert(d_parents[id].empty());
+      assert(this->d_parents[id].empty());
       // The normalized node is uniquely created for each normalized child1
       // of an extract, thus only that extract is its parent.
-      d_parents[id] = {ex->id()};
+      this->d_parents[id] = {ex->id()};
       // Remove this extract from the parents list of the normalized child
-      assert(!d_parents[ex->child(0)->id()].empty());
-      d_parents[ex->child(0)->id()].erase(ex->id());
+      assert(!this->d_parents[ex->child(0)->id()].empty());
+      this->d_parents[ex->child(0)->id()].erase(ex->id());
       ex->normalize(normalized);
     }
   }
 }
 
+template <class VALUE>
 void
-LocalSearchBV::normalize()
+BvLocalSearch<VALUE>::normalize()
 {
   for (auto& node : d_to_normalize_nodes)
   {
     normalize_extracts(node);
   }
-  normalize_ids();
+  this->normalize_ids();
+}
+
+template class BvLocalSearch<BitVector>;
+template class BvLocalSearch<Word64>;
+
+/* LocalSearchBV public ----------------------------------------------------- */
+
+namespace {
+
+BvDomain<Word64>
+to_word64(const BitVectorDomain& domain)
+{
+  return BvDomain<Word64>(Word64(domain.lo()), Word64(domain.hi()));
+}
+
+BitVectorDomain
+to_bitvector(const BvDomain<Word64>& domain)
+{
+  return BitVectorDomain(domain.lo().to_bitvector(),
+                         domain.hi().to_bitvector());
+}
+
+}  // namespace
+
+LocalSearchBV::LocalSearchBV(uint64_t max_nprops,
+                             uint64_t max_nupdates,
+                             uint32_t seed)
+    : d_ls64(new BvLocalSearch<Word64>(max_nprops, max_nupdates, seed)),
+      d_max_nprops(max_nprops),
+      d_max_nupdates(max_nupdates),
+      d_seed(seed)
+{
+}
+
+LocalSearchBV::~LocalSearchBV() {}
+
+void
+LocalSearchBV::init()
+{
+  d_initialized = true;
+  if (d_ls)
+  {
+    d_ls->d_options = d_options;
+    d_ls->init();
+  }
+  else
+  {
+    d_ls64->d_options = d_options;
+    d_ls64->init();
+  }
+}
+
+void
+LocalSearchBV::set_max_nprops(uint64_t max)
+{
+  d_max_nprops = max;
+  if (d_ls)
+  {
+    d_ls->set_max_nprops(max);
+  }
+  else
+  {
+    d_ls64->set_max_nprops(max);
+  }
+}
+
+void
+LocalSearchBV::set_max_nupdates(uint64_t max)
+{
+  d_max_nupdates = max;
+  if (d_ls)
+  {
+    d_ls->set_max_nupdates(max);
+  }
+  else
+  {
+    d_ls64->set_max_nupdates(max);
+  }
+}
+
+void
+LocalSearchBV::set_log_level(uint32_t level)
+{
+  d_log_level = level;
+  if (d_ls)
+  {
+    d_ls->set_log_level(level);
+  }
+  else
+  {
+    d_ls64->set_log_level(level);
+  }
+}
+
+void
+LocalSearchBV::push()
+{
+  if (d_ls)
+  {
+    d_ls->push();
+  }
+  else
+  {
+    d_ls64->push();
+  }
+}
+
+void
+LocalSearchBV::pop()
+{
+  if (d_ls)
+  {
+    d_ls->pop();
+  }
+  else
+  {
+    d_ls64->pop();
+  }
+}
+
+void
+LocalSearchBV::normalize()
+{
+  if (d_ls)
+  {
+    d_ls->normalize();
+  }
+  else
+  {
+    d_ls64->normalize();
+  }
+}
+
+uint64_t
+LocalSearchBV::mk_node(NodeKind kind,
+                       uint64_t size,
+                       const std::vector<uint64_t>& children,
+                       const std::vector<uint64_t>& indices,
+                       const std::optional<std::string>& symbol)
+{
+  if (!d_ls && size > Word64::s_max_size)
+  {
+    switch_to_bitvector();
+  }
+  if (d_ls)
+  {
+    return d_ls->mk_node(kind, size, children, indices, symbol);
+  }
+  return d_ls64->mk_node(kind, size, children, indices, symbol);
+}
+
+uint64_t
+LocalSearchBV::mk_node(NodeKind kind,
+                       const BitVectorDomain& domain,
+                       const std::vector<uint64_t>& children,
+                       const std::vector<uint64_t>& indices,
+                       const std::optional<std::string>& symbol)
+{
+  if (!d_ls && domain.size() > Word64::s_max_size)
+  {
+    switch_to_bitvector();
+  }
+  if (d_ls)
+  {
+    return d_ls->mk_node(kind, domain, children, indices, symbol);
+  }
+  return d_ls64->mk_node(kind, to_word64(domain), children, indices, symbol);
+}
+
+uint64_t
+LocalSearchBV::mk_node(const BitVector& assignment,
+                       const BitVectorDomain& domain,
+                       const std::optional<std::string>& symbol)
+{
+  if (!d_ls && domain.size() > Word64::s_max_size)
+  {
+    switch_to_bitvector();
+  }
+  if (d_ls)
+  {
+    return d_ls->mk_node(assignment, domain, symbol);
+  }
+  return d_ls64->mk_node(Word64(assignment), to_word64(domain), symbol);
+}
+
+uint64_t
+LocalSearchBV::invert_node(uint64_t id)
+{
+  if (d_ls)
+  {
+    return d_ls->invert_node(id);
+  }
+  return d_ls64->invert_node(id);
+}
+
+void
+LocalSearchBV::fix_bit(uint64_t id, uint32_t idx, bool value)
+{
+  if (d_ls)
+  {
+    d_ls->fix_bit(id, idx, value);
+  }
+  else
+  {
+    d_ls64->fix_bit(id, idx, value);
+  }
+}
+
+BitVectorDomain
+LocalSearchBV::get_domain(uint64_t id) const
+{
+  return d_ls ? d_ls->get_domain(id) : to_bitvector(d_ls64->get_domain(id));
+}
+
+BitVector
+LocalSearchBV::get_assignment(uint64_t id) const
+{
+  return d_ls ? d_ls->get_assignment(id)
+              : d_ls64->get_assignment(id).to_bitvector();
+}
+
+void
+LocalSearchBV::set_assignment(uint64_t id, const BitVector& assignment)
+{
+  if (d_ls)
+  {
+    d_ls->set_assignment(id, assignment);
+  }
+  else
+  {
+    d_ls64->set_assignment(id, Word64(assignment));
+  }
+}
+
+void
+LocalSearchBV::register_root(uint64_t root, bool fixed)
+{
+  if (d_ls)
+  {
+    d_ls->register_root(root, fixed);
+  }
+  else
+  {
+    d_ls64->register_root(root, fixed);
+  }
+}
+
+uint64_t
+LocalSearchBV::get_num_roots_unsat() const
+{
+  return d_ls ? d_ls->get_num_roots_unsat() : d_ls64->get_num_roots_unsat();
+}
+
+uint64_t
+LocalSearchBV::get_num_roots_sat() const
+{
+  return d_ls ? d_ls->get_num_roots_sat() : d_ls64->get_num_roots_sat();
+}
+
+uint64_t
+LocalSearchBV::get_num_roots() const
+{
+  return d_ls ? d_ls->get_num_roots() : d_ls64->get_num_roots();
+}
+
+uint64_t
+LocalSearchBV::get_false_root() const
+{
+  return d_ls ? d_ls->get_false_root() : d_ls64->get_false_root();
+}
+
+Result
+LocalSearchBV::move()
+{
+  return d_ls ? d_ls->move() : d_ls64->move();
+}
+
+const LocalSearchStatistics&
+LocalSearchBV::statistics() const
+{
+  return d_ls ? d_ls->d_statistics : d_ls64->d_statistics;
+}
+
+/* LocalSearchBV private ---------------------------------------------------- */
+
+void
+LocalSearchBV::switch_to_bitvector()
+{
+  assert(!d_ls);
+  d_ls.reset(
+      new BvLocalSearch<BitVector>(d_max_nprops, d_max_nupdates, d_seed));
+  d_ls->d_options = d_options;
+  d_ls->set_log_level(d_log_level);
+  if (d_initialized)
+  {
+    d_ls->init();
+  }
+  // Continue with the current state of the random number generator, must be
+  // set before creating nodes since nodes refer to it.
+  d_ls->d_rng.reset(new RNG(*d_ls64->d_rng));
+
+  // Recreate all nodes in the order of their ids, children always have a
+  // lower id than their parents. Normalized extracts are recreated over their
+  // original child and normalized once all nodes have been created.
+  std::vector<uint64_t> normalized;
+  for (const auto& n : d_ls64->d_nodes)
+  {
+    BvNode<Word64>* node = reinterpret_cast<BvNode<Word64>*>(n.get());
+    BitVectorDomain domain = to_bitvector(node->domain());
+    uint64_t id;
+    if (node->arity() == 0)
+    {
+      id = d_ls->mk_node(
+          node->assignment().to_bitvector(), domain, node->symbol());
+    }
+    else
+    {
+      NodeKind kind = node->kind();
+      std::vector<uint64_t> children;
+      std::vector<uint64_t> indices;
+      bool normalize = true;
+      if (kind == NodeKind::BV_EXTRACT)
+      {
+        BvExtract<Word64>* ex = static_cast<BvExtract<Word64>*>(node);
+        BvNode<Word64>* child = ex->child(0);
+        indices               = {ex->hi(), ex->lo()};
+        if (ex->is_normalized())
+        {
+          child   = ex->child0_original();
+          indices = {ex->hi_original(), ex->lo_original()};
+          normalized.push_back(ex->id());
+        }
+        children = {child->id()};
+        // Extracts created during normalization are not registered in their
+        // child for normalization.
+        const auto& extracts = child->get_extracts();
+        normalize =
+            std::find(extracts.begin(), extracts.end(), ex) != extracts.end();
+      }
+      else
+      {
+        for (uint32_t i = 0, arity = node->arity(); i < arity; ++i)
+        {
+          children.push_back(node->child(i)->id());
+        }
+        if (kind == NodeKind::BV_SEXT)
+        {
+          indices = {static_cast<BvSignExtend<Word64>*>(node)->get_n()};
+        }
+      }
+      id = d_ls->_mk_node(
+          kind, domain, children, indices, normalize, node->symbol());
+      d_ls->get_node(id)->set_assignment(node->assignment().to_bitvector());
+    }
+    assert(id == node->id());
+    d_ls->get_node(id)->set_normalized_id(node->normalized_id());
+  }
+  for (uint64_t id : normalized)
+  {
+    static_cast<BvExtract<BitVector>*>(d_ls->get_node(id))
+        ->normalize(d_ls->get_node(d_ls64->get_node(id)->child(0)->id()));
+  }
+
+  d_ls->d_roots         = d_ls64->d_roots;
+  d_ls->d_roots_control = d_ls64->d_roots_control;
+  d_ls->d_roots_cnt     = d_ls64->d_roots_cnt;
+  d_ls->d_roots_unsat   = d_ls64->d_roots_unsat;
+  d_ls->d_false_root    = d_ls64->d_false_root;
+  d_ls->d_parents       = d_ls64->d_parents;
+  for (const auto& p : d_ls->d_roots_cnt)
+  {
+    d_ls->get_node(p.first)->set_is_root(true);
+  }
+  for (const auto& [root, value] : d_ls64->d_roots_ineq)
+  {
+    d_ls->d_roots_ineq.emplace(d_ls->get_node(root->id()), value);
+  }
+  d_ls->d_statistics = d_ls64->d_statistics;
+  d_ls64.reset(nullptr);
 }
 
 /* -------------------------------------------------------------------------- */
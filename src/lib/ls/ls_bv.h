@@ -19,14 +19,26 @@
 namespace bzla {
 
 class BitVector;
+class Word64;
 
 namespace ls {
 
-class BitVectorDomain;
-class BitVectorNode;
+template <class VALUE>
+class BvDomain;
+template <class VALUE>
+class BvNode;
+class LocalSearchBV;
 
-class LocalSearchBV : public LocalSearch<BitVector>
+/**
+ * Local search engine over bit-vector terms.
+ * VALUE is the bit-vector value type, BitVector or Word64 (if all terms are of
+ * size <= 64).
+ */
+template <class VALUE>
+class BvLocalSearch : public LocalSearch<VALUE>
 {
+  friend class LocalSearchBV;
+
  public:
   /**
    * Constructor.
@@ -36,7 +48,7 @@ class LocalSearchBV : public LocalSearch<BitVector>
    *                     if unlimited.
    * @param seed The initial seed for the random number generator.
    */
-  LocalSearchBV(uint64_t max_nprops,
+  BvLocalSearch(uint64_t max_nprops,
                 uint64_t max_nupdates,
                 uint32_t seed = 1234);
   /**
@@ -65,7 +77,7 @@ class LocalSearchBV : public LocalSearch<BitVector>
    * @return The index of the created node.
    */
   uint64_t mk_node(NodeKind kind,
-                   const BitVectorDomain& domain,
+                   const BvDomain<VALUE>& domain,
                    const std::vector<uint64_t>& children    = {},
                    const std::vector<uint64_t>& indices     = {},
                    const std::optional<std::string>& symbol = std::nullopt);
@@ -77,8 +89,8 @@ class LocalSearchBV : public LocalSearch<BitVector>
    *                   used for logging.
    * @return The index of the created node.
    */
-  uint64_t mk_node(const BitVector& assignment,
-                   const BitVectorDomain& domain,
+  uint64_t mk_node(const VALUE& assignment,
+                   const BvDomain<VALUE>& domain,
                    const std::optional<std::string>& symbol = std::nullopt);
 
   /**
@@ -93,12 +105,12 @@ class LocalSearchBV : public LocalSearch<BitVector>
    * @param id The id of the node to query.
    * @return The domain of the node given by id.
    */
-  const BitVectorDomain& get_domain(uint64_t id) const;
+  const BvDomain<VALUE>& get_domain(uint64_t id) const;
 
   /** Fix domain bit of given node at index 'idx' to 'value'. */
   void fix_bit(uint64_t id, uint32_t idx, bool value);
 
-  void compute_bounds(Node<BitVector>* node) override;
+  void compute_bounds(Node<VALUE>* node) override;
 
   void normalize() override;
 
@@ -134,7 +146,7 @@ class LocalSearchBV : public LocalSearch<BitVector>
    * @return The index of the created node.
    */
   uint64_t _mk_node(NodeKind kind,
-                    const BitVectorDomain& domain,
+                    const BvDomain<VALUE>& domain,
                     const std::vector<uint64_t>& children    = {},
                     const std::vector<uint64_t>& indices     = {},
                     bool normalize                           = true,
@@ -144,14 +156,14 @@ class LocalSearchBV : public LocalSearch<BitVector>
    * @param id The node id.
    * @return The node with the given id.
    */
-  BitVectorNode* get_node(uint64_t id) const;
+  BvNode<VALUE>* get_node(uint64_t id) const;
   /**
    * Helper for computing bounds of children of root inequalities.
    * @param root The root node.
    * @param pos The position of the child to update, -1 for updating all
    *            children.
    */
-  void update_bounds_aux(BitVectorNode* root, int32_t pos);
+  void update_bounds_aux(BvNode<VALUE>* root, int32_t pos);
 
   /**
    * Helper to split index ranges of multiple extracts on the same child such
@@ -159,7 +171,7 @@ class LocalSearchBV : public LocalSearch<BitVector>
    * @param node The node with multiple extract parents.
    * @return A list of extract ranges, not overlapping.
    */
-  std::vector<std::pair<uint64_t, uint64_t>> split_indices(BitVectorNode* node);
+  std::vector<std::pair<uint64_t, uint64_t>> split_indices(BvNode<VALUE>* node);
   /**
    * Normalize extract nodes.
    *
@@ -172,7 +184,7 @@ class LocalSearchBV : public LocalSearch<BitVector>
    *
    * @param node The node with multiple extract parents.
    */
-  void normalize_extracts(BitVectorNode* node);
+  void normalize_extracts(BvNode<VALUE>* node);
   /**
    * Helper to create an extract node during normalization.
    * @param child The child of the extract.
@@ -180,7 +192,7 @@ class LocalSearchBV : public LocalSearch<BitVector>
    * @param lo    The lower index.
    * @return The extract.
    */
-  BitVectorNode* mk_normalized_extract(BitVectorNode* child,
+  BvNode<VALUE>* mk_normalized_extract(BvNode<VALUE>* child,
                                        uint64_t hi,
                                        uint64_t lo);
   /**
@@ -189,14 +201,197 @@ class LocalSearchBV : public LocalSearch<BitVector>
    * @param child1 The child at index 1.
    * @return The concat.
    */
-  BitVectorNode* mk_normalized_concat(BitVectorNode* child0,
-                                      BitVectorNode* child1);
+  BvNode<VALUE>* mk_normalized_concat(BvNode<VALUE>* child0,
+                                      BvNode<VALUE>* child1);
 
   /**
    * Cache nodes that require normalization.
    * Currently, only children of extracts are normalized.
    */
-  std::unordered_set<BitVectorNode*> d_to_normalize_nodes;
+  std::unordered_set<BvNode<VALUE>*> d_to_normalize_nodes;
+};
+
+/**
+ * Local search over bit-vector terms.
+ *
+ * As long as all terms are of size <= 64, local search is performed over
+ * Word64 values. On the creation of the first term of size > 64, the current
+ * state of the Word64 engine (including the assignments computed by move())
+ * is transferred to a local search engine over BitVector values, which is
+ * used from then on.
+ */
+class LocalSearchBV
+{
+ public:
+  /**
+   * The configuration options of the local search module.
+   * Must be configured before calling init().
+   */
+  LocalSearchOptions d_options;
+
+  /**
+   * Constructor.
+   * @param max_nprops The maximum number of propagations to perform. Zero
+   *                   if unlimited.
+   * @param max_nupdates The maximum number of cone updates to perform. Zero
+   *                     if unlimited.
+   * @param seed The initial seed for the random number generator.
+   */
+  LocalSearchBV(uint64_t max_nprops,
+                uint64_t max_nupdates,
+                uint32_t seed = 1234);
+  /** Destructor. */
+  ~LocalSearchBV();
+
+  /**
+   * Initialize local search module.
+   * Must be called after all options are configured and before nodes are
+   * created.
+   */
+  void init();
+
+  /**
+   * Configure the maximum number of propagations to perform.
+   * @param max The maximum number of propagations.
+   */
+  void set_max_nprops(uint64_t max);
+  /**
+   * Configure the maximum number of updates to perform.
+   * @param max The maximum number of updates.
+   */
+  void set_max_nupdates(uint64_t max);
+  /**
+   * Set the log level.
+   * @param level The level to set.
+   */
+  void set_log_level(uint32_t level);
+
+  /** Push assertion level. */
+  void push();
+  /** Pop assertion level. */
+  void pop();
+  /**
+   * Kick off normalization of nodes.
+   * Call this at the beginning of a satisfiability check.
+   */
+  void normalize();
+
+  /**
+   * Create node.
+   * @param kind     The node kind.
+   * @param size     The bit-vector size of the node.
+   * @param children The children, empty for NodeKind::CONST.
+   * @param indices  The set of indices, empty for non-indexed nodes.
+   * @param symbol   Optionally, a symbol string identifying the node, only
+   *                 used for logging.
+   * @return The index of the created node.
+   */
+  uint64_t mk_node(NodeKind kind,
+                   uint64_t size,
+                   const std::vector<uint64_t>& children    = {},
+                   const std::vector<uint64_t>& indices     = {},
+                   const std::optional<std::string>& symbol = std::nullopt);
+  /**
+   * Create node.
+   * @param kind     The node kind.
+   * @param domain   The associated bit-vector domain.
+   * @param children The children, empty for NodeKind::CONST.
+   * @param indices  The set of indices, empty for non-indexed nodes.
+   * @param symbol   Optionally, a symbol string identifying the node, only
+   *                 used for logging.
+   * @return The index of the created node.
+   */
+  uint64_t mk_node(NodeKind kind,
+                   const BvDomain<BitVector>& domain,
+                   const std::vector<uint64_t>& children    = {},
+                   const std::vector<uint64_t>& indices     = {},
+                   const std::optional<std::string>& symbol = std::nullopt);
+  /**
+   * Create const node.
+   * @param assignment The current assignment of the node.
+   * @param domain     The associated bit-vector domain.
+   * @param symbol     Optionally, a symbol string identifying the node, only
+   *                   used for logging.
+   * @return The index of the created node.
+   */
+  uint64_t mk_node(const BitVector& assignment,
+                   const BvDomain<BitVector>& domain,
+                   const std::optional<std::string>& symbol = std::nullopt);
+
+  /**
+   * Invert node given by id.
+   * @param id The id of the node to invert.
+   * @return The inverted node.
+   */
+  uint64_t invert_node(uint64_t id);
+
+  /** Fix domain bit of given node at index 'idx' to 'value'. */
+  void fix_bit(uint64_t id, uint32_t idx, bool value);
+
+  /**
+   * Get the domain of the node given by id.
+   * @param id The id of the node to query.
+   * @return The domain of the node given by id.
+   */
+  BvDomain<BitVector> get_domain(uint64_t id) const;
+  /**
+   * Get the assignment of the node given by id.
+   * @param id The id of the node to query.
+   */
+  BitVector get_assignment(uint64_t id) const;
+  /**
+   * Set the assignment of the node given by id.
+   * @param id The id of the node.
+   * @param assignment The assignment to set.
+   */
+  void set_assignment(uint64_t id, const BitVector& assignment);
+
+  /**
+   * Register node as root.
+   * @param root  The id of the node to register as root.
+   * @param fixed True if this root is a top-level (assertion level 0) root.
+   */
+  void register_root(uint64_t root, bool fixed = false);
+  /** @return The number of unsat roots. */
+  uint64_t get_num_roots_unsat() const;
+  /** @return The number of sat roots. */
+  uint64_t get_num_roots_sat() const;
+  /** @return The number of total roots. */
+  uint64_t get_num_roots() const;
+  /** @return The root responsible for returning unsat. */
+  uint64_t get_false_root() const;
+
+  /** Perform a move. */
+  Result move();
+
+  /** @return The statistics of the local search module. */
+  const LocalSearchStatistics& statistics() const;
+
+ private:
+  /**
+   * Switch from the Word64 to the BitVector engine.
+   *
+   * Recreates all nodes of the Word64 engine with their current domains and
+   * assignments in the BitVector engine, and transfers roots, assertion
+   * levels, normalized extracts and statistics.
+   */
+  void switch_to_bitvector();
+
+  /** The engine over Word64 values, null after switching to d_ls. */
+  std::unique_ptr<BvLocalSearch<Word64>> d_ls64;
+  /** The engine over BitVector values, null until the first wide term. */
+  std::unique_ptr<BvLocalSearch<BitVector>> d_ls;
+
+  /** True if init() has been called. */
+  bool d_initialized = false;
+  /** The log level. */
+  uint32_t d_log_level = 0;
+  /** The maximum number of propagations, 0 for unlimited. */
+  uint64_t d_max_nprops;
+  /** The maximum number of cone updates, 0 for unlimited. */
+  uint64_t d_max_nupdates;
+  /** The seed for the RNG. */
+  uint32_t d_seed;
 };
 
 }  // namespace ls
@@ -15,6 +15,7 @@
 #include <sstream>
 
 #include "bv/bitvector.h"
+#include "bv/word64.h"
 #include "rng/rng.h"
 
 namespace bzla::ls {
@@ -249,13 +250,18 @@ Node<VALUE>::log() const
   }
   return res;
 }
+template <class VALUE>
 std::ostream&
-operator<<(std::ostream& out, const Node<BitVector>& node)
+operator<<(std::ostream& out, const Node<VALUE>& node)
 {
   out << node.str();
   return out;
 }
 
 template class Node<BitVector>;
+template class Node<Word64>;
+template std::ostream& operator<<(std::ostream& out,
+                                  const Node<BitVector>& node);
+template std::ostream& operator<<(std::ostream& out, const Node<Word64>& node);
 
 }  // namespace bzla::ls
@@ -19,7 +19,6 @@
 
 namespace bzla {
 
-class BitVector;
 class RNG;
 
 namespace ls {
@@ -32,13 +31,15 @@ class Node
    * Path selection mode.
    * True if path is to be selected based on essential inputs, false if it is
    * to be selected randomly.
+   * @note Thread-local since these are configured by each LocalSearch
+   *       instance, which may run concurrently on other threads.
    */
-  static inline bool s_path_sel_essential = true;
+  static inline thread_local bool s_path_sel_essential = true;
   /**
    * Probability for picking an essential input if there is one, and else
    * a random input (see use_path_sel_essential).
    */
-  static inline uint32_t s_prob_pick_ess_input = 990;
+  static inline thread_local uint32_t s_prob_pick_ess_input = 990;
 
   /** Destructor. */
   virtual ~Node();
@@ -319,7 +320,8 @@ class Node
   std::optional<std::string> d_symbol;
 };
 
-std::ostream& operator<<(std::ostream& out, const Node<BitVector>& node);
+template <class VALUE>
+std::ostream& operator<<(std::ostream& out, const Node<VALUE>& node);
 
 }  // namespace ls
 }  // namespace bzla
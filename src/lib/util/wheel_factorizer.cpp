@@ -13,7 +13,8 @@
 namespace bzla {
 namespace ls {
 
-WheelFactorizer::WheelFactorizer(const BitVector& n, uint64_t limit)
+template <class VALUE>
+WheelFactorizer<VALUE>::WheelFactorizer(const VALUE& n, uint64_t limit)
     : d_num(n), d_limit(limit)
 {
   uint64_t bw = n.size();
@@ -24,10 +25,10 @@ WheelFactorizer::WheelFactorizer(const BitVector& n, uint64_t limit)
   // size 2 needs special handling and doesn't utilize the wheel
   if (bw > 2)
   {
-    d_one     = BitVector::from_ui(bw, 1);
-    d_two     = BitVector::from_ui(bw, 2);
-    d_four    = BitVector::from_ui(bw, 4);
-    d_six     = BitVector::from_ui(bw, 6);
+    d_one     = VALUE::from_ui(bw, 1);
+    d_two     = VALUE::from_ui(bw, 2);
+    d_four    = VALUE::from_ui(bw, 4);
+    d_six     = VALUE::from_ui(bw, 6);
     d_fact    = d_two;
     d_inc[0]  = &d_one;
     d_inc[1]  = &d_two;
@@ -43,8 +44,9 @@ WheelFactorizer::WheelFactorizer(const BitVector& n, uint64_t limit)
   }
 }
 
-const BitVector*
-WheelFactorizer::next()
+template <class VALUE>
+const VALUE*
+WheelFactorizer<VALUE>::next()
 {
   if (d_done) return nullptr;
 
@@ -77,7 +79,7 @@ WheelFactorizer::next()
       return &d_num;
     }
 
-    BitVector quot, rem;
+    VALUE quot, rem;
     d_num.bvudivurem(d_fact, &quot, &rem);
     if (rem.is_zero())
     {
@@ -85,7 +87,7 @@ WheelFactorizer::next()
       d_num.iset(quot);
       return &d_fact;
     }
-    BitVector tmp = d_fact.bvadd(*d_inc[d_pos]);
+    VALUE tmp = d_fact.bvadd(*d_inc[d_pos]);
     bool done     = tmp.compare(d_fact) <= 0;
     d_fact.iset(tmp);
     d_pos = d_pos == 10 ? 3 : d_pos + 1;
@@ -98,5 +100,8 @@ WheelFactorizer::next()
   return nullptr;
 }
 
+template class WheelFactorizer<BitVector>;
+template class WheelFactorizer<Word64>;
+
 }  // namespace ls
 }  // namespace bzla
@@ -14,11 +14,16 @@
 #include <cstdint>
 
 #include "bv/bitvector.h"
+#include "bv/word64.h"
 
 namespace bzla {
 namespace ls {
 
-/* Wheel factorization for s % x = t with base {2, 3, 5}. */
+/**
+ * Wheel factorization for s % x = t with base {2, 3, 5}.
+ * VALUE is the bit-vector value type, BitVector or Word64.
+ */
+template <class VALUE>
 class WheelFactorizer
 {
  public:
@@ -27,32 +32,32 @@ class WheelFactorizer
    * n    : The bit-vector value to factorize.
    * limit: The limit for max number of iterations.
    */
-  WheelFactorizer(const BitVector& n, uint64_t limit);
+  WheelFactorizer(const VALUE& n, uint64_t limit);
   /**
    * Get next factor.
    * Returns nullptr when no next factor exists.
    */
-  const BitVector* next();
+  const VALUE* next();
 
  private:
   /**
    * The value to factorize.
    * Updated at each call to next() to d_num / d_fact if d_fact is a factor
    * of d_num, i.e., if d_num % d_fact = 0. */
-  BitVector d_num;
+  VALUE d_num;
   /** The current factor. */
-  BitVector d_fact;
+  VALUE d_fact;
   /** Bit-vector value one. */
-  BitVector d_one;
+  VALUE d_one;
   /** Bit-vector value two. */
-  BitVector d_two;
+  VALUE d_two;
   /** Bit-vector value four. */
-  BitVector d_four;
+  VALUE d_four;
   /** Bit-vector value six. */
-  BitVector d_six;
+  VALUE d_six;
 
   /** The increments applied to d_fact for a {2, 3, 5} wheel. */
-  BitVector* d_inc[11];
+  VALUE* d_inc[11];
 
   bool d_done  = false;
   size_t d_pos = 0;
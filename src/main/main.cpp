@@ -19,6 +19,7 @@
 #include <numeric>
 #include <sstream>
 
+#include "bv/gmp_pool.h"
 #include "parser/smt2/lexer.h"
 #include "parser/smt2/parser.h"
 
@@ -147,6 +148,10 @@ print_help(const bitwuzla::Options& options)
                     format_longb("print-formula"),
                     "",
                     "print formula in smt2 format");
+  opts.emplace_back(format_shortb("b"),
+                    format_longb("print-binary"),
+                    "",
+                    "print formula as binary DAG snapshot (.bdag)");
   opts.emplace_back(format_shortb("P"),
                     format_longb("parse-only"),
                     "",
@@ -263,8 +268,13 @@ is_input_file(const std::string& arg, const char* suffix)
 int32_t
 main(int32_t argc, char* argv[])
 {
+  // Use the pooled GMP allocator, installed before any GMP values are
+  // created and before solver threads are started.
+  bzla::GMPPool::Scope gmp_pool_scope;
+
   bitwuzla::Options options;
   bool print = false;
+  bool print_binary = false;
   bool parse_only = false;
 
   std::vector<std::string> args;
@@ -293,18 +303,28 @@ main(int32_t argc, char* argv[])
     {
       print = true;
     }
+    else if (arg == "-b" || arg == "--print-binary")
+    {
+      print        = true;
+      print_binary = true;
+    }
     else if (arg == "-P" || arg == "--parse-only")
     {
       parse_only = true;
     }
     // Check if argument is the intput file.
-    else if (is_input_file(arg, ".smt2") || is_input_file(arg, ".btor2"))
+    else if (is_input_file(arg, ".smt2") || is_input_file(arg, ".btor2")
+             || is_input_file(arg, ".bdag"))
     {
       infile_name = arg;
       if (is_input_file(arg, ".btor2"))
       {
         language = "btor2";
       }
+      else if (is_input_file(arg, ".bdag"))
+      {
+        language = "binary";
+      }
       else
       {
         language = "smt2";
@@ -342,9 +362,9 @@ main(int32_t argc, char* argv[])
       {
         bitwuzla->simplify();
       }
-      bitwuzla->print_formula(std::cout, language);
+      bitwuzla->print_formula(std::cout, print_binary ? "binary" : "smt2");
     }
-    else if (language == "btor2")
+    else if (language == "btor2" || language == "binary")
     {
       bitwuzla::Result res = bitwuzla->check_sat();
       if (res == bitwuzla::Result::SAT)
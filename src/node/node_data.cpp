@@ -13,13 +13,15 @@
 #include "node/kind_info.h"
 #include "node/node.h"
 #include "node/node_manager.h"
+#include "solver/fp/floating_point.h"
+#include "solver/fp/rounding_mode.h"
 
 namespace bzla::node {
 
 size_t
 NodeDataHash::operator()(const NodeData* d) const
 {
-  return d->hash();
+  return d->d_hash;
 }
 
 bool
@@ -30,19 +32,89 @@ NodeDataKeyEqual::operator()(const NodeData* d0, const NodeData* d1) const
 
 /* --- NodeData public ----------------------------------------------------- */
 
-NodeData::NodeData(Kind kind) : d_kind(kind){};
+NodeData::NodeData(Kind kind, Layout layout)
+    : d_hash(static_cast<size_t>(kind)), d_kind(kind), d_layout(layout){};
 
 size_t
-NodeData::hash() const
+NodeData::hash(Kind kind,
+               util::Span<Node> children,
+               util::Span<uint64_t> indices)
 {
-  return static_cast<size_t>(d_kind);
+  const auto& primes = NodeDataHash::s_primes;
+  size_t hash        = static_cast<size_t>(kind);
+  for (size_t i = 0, size = children.size(); i < size; ++i)
+  {
+    hash += primes[i % primes.size()] * children[i].id();
+  }
+  for (size_t i = 0, size = indices.size(); i < size; ++i)
+  {
+    hash += primes[i] * indices[i];
+  }
+  return hash;
+}
+
+bool
+NodeData::equals(Kind kind,
+                 util::Span<Node> children,
+                 util::Span<uint64_t> indices) const
+{
+  if (d_kind != kind || get_num_children() != children.size()
+      || get_num_indices() != indices.size())
+  {
+    return false;
+  }
+  for (size_t i = 0, size = children.size(); i < size; ++i)
+  {
+    if (get_child(i) != children[i])
+    {
+      return false;
+    }
+  }
+  for (size_t i = 0, size = indices.size(); i < size; ++i)
+  {
+    if (get_index(i) != indices[i])
+    {
+      return false;
+    }
+  }
+  return true;
 }
 
 bool
 NodeData::equals(const NodeData& other) const
 {
-  (void) other;
-  return d_kind == other.d_kind;
+  if (d_hash != other.d_hash || d_kind != other.d_kind
+      || d_layout != other.d_layout)
+  {
+    return false;
+  }
+  switch (d_layout)
+  {
+    case Layout::BASE: return true;
+    case Layout::CHILDREN:
+      return static_cast<const NodeDataChildren&>(*this).equals(
+          static_cast<const NodeDataChildren&>(other));
+    case Layout::INDEXED:
+      return static_cast<const NodeDataIndexed&>(*this).equals(
+          static_cast<const NodeDataIndexed&>(other));
+    case Layout::NARY:
+      return static_cast<const NodeDataNary&>(*this).equals(
+          static_cast<const NodeDataNary&>(other));
+    case Layout::VALUE_BOOL:
+      return static_cast<const NodeDataValue<bool>&>(*this).equals(
+          static_cast<const NodeDataValue<bool>&>(other));
+    case Layout::VALUE_BV:
+      return static_cast<const NodeDataValue<BitVector>&>(*this).equals(
+          static_cast<const NodeDataValue<BitVector>&>(other));
+    case Layout::VALUE_RM:
+      return static_cast<const NodeDataValue<RoundingMode>&>(*this).equals(
+          static_cast<const NodeDataValue<RoundingMode>&>(other));
+    case Layout::VALUE_FP:
+      return static_cast<const NodeDataValue<FloatingPoint>&>(*this).equals(
+          static_cast<const NodeDataValue<FloatingPoint>&>(other));
+  }
+  assert(false);
+  return false;
 }
 
 bool
@@ -136,7 +208,11 @@ NodeData::is_nary() const
 std::optional<std::reference_wrapper<const std::string>>
 NodeData::get_symbol() const
 {
-  return NodeManager::get().get_symbol(this);
+  if (d_symbol == util::StringInterner::s_null)
+  {
+    return std::nullopt;
+  }
+  return NodeManager::get().symbols().get(d_symbol);
 }
 
 void
@@ -190,10 +266,49 @@ NodeData::end() const
   return nullptr;
 }
 
+/* --- NodeData private ---------------------------------------------------- */
+
+void
+NodeData::destruct()
+{
+  switch (d_layout)
+  {
+    case Layout::BASE: this->~NodeData(); break;
+    case Layout::CHILDREN:
+      static_cast<NodeDataChildren*>(this)->~NodeDataChildren();
+      break;
+    case Layout::INDEXED:
+      static_cast<NodeDataIndexed*>(this)->~NodeDataIndexed();
+      break;
+    case Layout::NARY: static_cast<NodeDataNary*>(this)->~NodeDataNary(); break;
+    case Layout::VALUE_BOOL:
+      static_cast<NodeDataValue<bool>*>(this)->~NodeDataValue();
+      break;
+    case Layout::VALUE_BV:
+      static_cast<NodeDataValue<BitVector>*>(this)->~NodeDataValue();
+      break;
+    case Layout::VALUE_RM:
+      static_cast<NodeDataValue<RoundingMode>*>(this)->~NodeDataValue();
+      break;
+    case Layout::VALUE_FP:
+      static_cast<NodeDataValue<FloatingPoint>*>(this)->~NodeDataValue();
+      break;
+  }
+}
+
 /* --- NodeDataChildren public --------------------------------------------- */
 
-NodeDataChildren::NodeDataChildren(Kind kind, const std::vector<Node>& children)
-    : NodeData(kind), d_num_children(children.size())
+NodeDataChildren::NodeDataChildren(Kind kind, util::Span<Node> children)
+    : NodeDataChildren(kind, Layout::CHILDREN, children)
+{
+}
+
+/* --- NodeDataChildren protected ------------------------------------------ */
+
+NodeDataChildren::NodeDataChildren(Kind kind,
+                                   Layout layout,
+                                   util::Span<Node> children)
+    : NodeData(kind, layout), d_num_children(children.size())
 {
   assert(d_num_children > 0);
   assert(d_num_children <= s_max_children);
@@ -202,38 +317,22 @@ NodeDataChildren::NodeDataChildren(Kind kind, const std::vector<Node>& children)
   for (auto n : children)
   {
     assert(!n.is_null());
+    d_hash += NodeDataHash::s_primes[i] * n.id();
     d_children[i++] = n;
   }
   assert(i == d_num_children);
 };
 
-size_t
-NodeDataChildren::hash() const
-{
-  size_t hash = NodeData::hash();
-  for (size_t i = 0; i < d_num_children; ++i)
-  {
-    hash += NodeDataHash::s_primes[i] * d_children[i].id();
-  }
-  return hash;
-}
-
 bool
-NodeDataChildren::equals(const NodeData& other) const
+NodeDataChildren::equals(const NodeDataChildren& other) const
 {
-  if (!NodeData::equals(other))
-  {
-    return false;
-  }
-  assert(other.has_children());
-  const NodeDataChildren& o = reinterpret_cast<const NodeDataChildren&>(other);
-  if (d_num_children != o.d_num_children)
+  if (d_num_children != other.d_num_children)
   {
     return false;
   }
   for (size_t i = 0; i < d_num_children; ++i)
   {
-    if (d_children[i] != o.d_children[i])
+    if (d_children[i] != other.d_children[i])
     {
       return false;
     }
@@ -251,43 +350,34 @@ NodeDataChildren::equals(const NodeData& other) const
 /* --- NodeDataIndexed public ---------------------------------------------- */
 
 NodeDataIndexed::NodeDataIndexed(Kind kind,
-                                 const std::vector<Node>& children,
-                                 const std::vector<uint64_t>& indices)
-    : NodeDataChildren(kind, children), d_num_indices(indices.size())
+                                 util::Span<Node> children,
+                                 util::Span<uint64_t> indices)
+    : NodeDataChildren(kind, Layout::INDEXED, children),
+      d_num_indices(indices.size())
 {
   assert(KindInfo::num_indices(kind) == indices.size());
   uint8_t i = 0;
   for (auto idx : indices)
   {
+    d_hash += NodeDataHash::s_primes[i] * idx;
     d_indices[i++] = idx;
   }
   assert(i == d_num_indices);
 };
 
-size_t
-NodeDataIndexed::hash() const
-{
-  size_t hash = NodeDataChildren::hash();
-  for (size_t i = 0; i < d_num_indices; ++i)
-  {
-    hash += NodeDataHash::s_primes[i] * d_indices[i];
-  }
-  return hash;
-}
+/* --- NodeDataIndexed private --------------------------------------------- */
 
 bool
-NodeDataIndexed::equals(const NodeData& other) const
+NodeDataIndexed::equals(const NodeDataIndexed& other) const
 {
   if (!NodeDataChildren::equals(other))
   {
     return false;
   }
-  assert(other.is_indexed());
-  const NodeDataIndexed& o = reinterpret_cast<const NodeDataIndexed&>(other);
-  assert(d_num_indices == o.d_num_indices);
+  assert(d_num_indices == other.d_num_indices);
   for (size_t i = 0; i < d_num_indices; ++i)
   {
-    if (d_indices[i] != o.d_indices[i])
+    if (d_indices[i] != other.d_indices[i])
     {
       return false;
     }
@@ -297,40 +387,29 @@ NodeDataIndexed::equals(const NodeData& other) const
 
 /* --- NodeDataNary public ------------------------------------------------- */
 
-NodeDataNary::NodeDataNary(Kind kind, const std::vector<Node>& children)
-    : NodeData(kind), d_children(children)
+NodeDataNary::NodeDataNary(Kind kind, util::Span<Node> children)
+    : NodeData(kind, Layout::NARY), d_children(children.begin(), children.end())
 {
   assert(is_nary());
-};
-
-size_t
-NodeDataNary::hash() const
-{
-  size_t hash = NodeData::hash();
   for (size_t i = 0, size = d_children.size(); i < size; ++i)
   {
-    hash += NodeDataHash::s_primes[i % NodeDataHash::s_primes.size()]
-            * d_children[i].id();
+    d_hash += NodeDataHash::s_primes[i % NodeDataHash::s_primes.size()]
+              * d_children[i].id();
   }
-  return hash;
-}
+};
+
+/* --- NodeDataNary private ------------------------------------------------ */
 
 bool
-NodeDataNary::equals(const NodeData& other) const
+NodeDataNary::equals(const NodeDataNary& other) const
 {
-  if (!NodeData::equals(other))
-  {
-    return false;
-  }
-  assert(other.is_nary());
-  const NodeDataNary& o = reinterpret_cast<const NodeDataNary&>(other);
-  if (d_children.size() != o.d_children.size())
+  if (d_children.size() != other.d_children.size())
   {
     return false;
   }
   for (size_t i = 0, size = d_children.size(); i < size; ++i)
   {
-    if (d_children[i] != o.d_children[i])
+    if (d_children[i] != other.d_children[i])
     {
       return false;
     }
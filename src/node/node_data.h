@@ -16,10 +16,15 @@
 #include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <type_traits>
+#include <utility>
 
 #include "bv/bitvector.h"
 #include "node/node.h"
+#include "node/node_data_allocator.h"
 #include "type/type.h"
+#include "util/span.h"
+#include "util/string_interner.h"
 
 namespace bzla {
 
@@ -34,31 +39,80 @@ class NodeDataValue;
  * Node data base class.
  *
  * Used for nodes that do not need additional payload, e.g. Kind::CONSTANT.
+ *
+ * Node data classes are not polymorphic. The concrete layout of a node data
+ * object is identified by its layout tag, which is used to dispatch hash
+ * consing comparisons and destruction to the corresponding subclass. The
+ * structural hash value is computed once on construction.
  */
 class NodeData
 {
   friend NodeManager;
+  friend NodeDataAllocator;
   friend struct NodeDataHash;
   friend struct NodeDataKeyEqual;
 
  public:
   using iterator = const Node*;
 
-  NodeData()          = delete;
-  virtual ~NodeData() = default;
-
-  /** Compute hash value. */
-  virtual size_t hash() const;
+  /** The concrete layout of a node data object. */
+  enum class Layout : uint8_t
+  {
+    BASE,
+    CHILDREN,
+    INDEXED,
+    NARY,
+    VALUE_BOOL,
+    VALUE_BV,
+    VALUE_RM,
+    VALUE_FP,
+  };
+
+  NodeData()  = delete;
+  ~NodeData() = default;
+
+  /** @return The structural hash value computed on construction. */
+  size_t hash() const { return d_hash; }
 
   /**
    * Comparison of two node data objects.
    *
+   * Compares the cached hash values first, and the stored data of the
+   * concrete layout only if the hash values match.
+   *
    * @note This method is only used in NodeDataKeyEqual used for hash consing.
    *
    * @param other Other node data to compare to
    * @return True if both objects store the same data.
    */
-  virtual bool equals(const NodeData& other) const;
+  bool equals(const NodeData& other) const;
+
+  /**
+   * Compute the structural hash value of node data of given kind, children
+   * and indices without constructing it.
+   *
+   * Yields the same value as hash() of the corresponding node data object.
+   *
+   * @param kind The node kind.
+   * @param children The children of the node.
+   * @param indices The indices of the node.
+   * @return The structural hash value.
+   */
+  static size_t hash(Kind kind,
+                     util::Span<Node> children,
+                     util::Span<uint64_t> indices);
+
+  /**
+   * Determine if this node data stores given kind, children and indices.
+   *
+   * @param kind The node kind.
+   * @param children The children of the node.
+   * @param indices The indices of the node.
+   * @return True if this node data stores given kind, children and indices.
+   */
+  bool equals(Kind kind,
+              util::Span<Node> children,
+              util::Span<uint64_t> indices) const;
 
   /**
    * @return The node id.
@@ -165,17 +219,32 @@ class NodeData
   iterator end() const;
 
  protected:
-  NodeData(Kind kind);
+  NodeData(Kind kind, Layout layout = Layout::BASE);
+
+  /** The structural hash value. */
+  size_t d_hash;
 
  private:
+  /**
+   * Call the destructor of the concrete layout of this node data.
+   * @note The memory of this node data is released by the allocator.
+   */
+  void destruct();
+
   /** Node id. */
   uint64_t d_id = 0;
   /** Node kind. */
   Kind d_kind;
-  /** Node type. */
-  Type d_type;
+  /** Layout of this node data. */
+  Layout d_layout;
+  /** Size class of the slot this node data was allocated in. */
+  uint8_t d_alloc_class = 0;
   /** Number of references. */
   uint32_t d_refs = 0;
+  /** Handle of the interned symbol of this node, if any. */
+  util::StringInterner::Handle d_symbol = util::StringInterner::s_null;
+  /** Node type. */
+  Type d_type;
 };
 
 /**
@@ -193,10 +262,13 @@ class NodeDataChildren : public NodeData
   NodeDataChildren()  = delete;
   ~NodeDataChildren() = default;
 
-  NodeDataChildren(Kind kind, const std::vector<Node>& children);
+  NodeDataChildren(Kind kind, util::Span<Node> children);
 
-  size_t hash() const override;
-  bool equals(const NodeData& other) const override;
+ protected:
+  NodeDataChildren(Kind kind, Layout layout, util::Span<Node> children);
+
+  /** @return True if `other` stores the same children. */
+  bool equals(const NodeDataChildren& other) const;
 
  private:
   /** The number of stored children. */
@@ -217,14 +289,14 @@ class NodeDataIndexed : public NodeDataChildren
  public:
   NodeDataIndexed() = delete;
   NodeDataIndexed(Kind kind,
-                  const std::vector<Node>& children,
-                  const std::vector<uint64_t>& indices);
+                  util::Span<Node> children,
+                  util::Span<uint64_t> indices);
   ~NodeDataIndexed() = default;
 
-  size_t hash() const override;
-  bool equals(const NodeData& other) const override;
-
  private:
+  /** @return True if `other` stores the same children and indices. */
+  bool equals(const NodeDataIndexed& other) const;
+
   /** The number of stored indices. */
   uint8_t d_num_indices = 0;
   /** Storage for at most 2 indices. */
@@ -242,12 +314,12 @@ class NodeDataNary : public NodeData
   NodeDataNary()  = delete;
   ~NodeDataNary() = default;
 
-  NodeDataNary(Kind kind, const std::vector<Node>& children);
-
-  size_t hash() const override;
-  bool equals(const NodeData& other) const override;
+  NodeDataNary(Kind kind, util::Span<Node> children);
 
  private:
+  /** @return True if `other` stores the same children. */
+  bool equals(const NodeDataNary& other) const;
+
   /** Storage for arbitrary number of children. */
   std::vector<Node> d_children;
 };
@@ -262,30 +334,48 @@ class NodeDataValue : public NodeData
 
  public:
   NodeDataValue() = delete;
-  NodeDataValue(const T& value) : NodeData(Kind::VALUE), d_value(value){};
+  NodeDataValue(const T& value)
+      : NodeData(Kind::VALUE, layout()), d_value(value)
+  {
+    d_hash += std::hash<T>{}(d_value);
+  };
+  NodeDataValue(T&& value)
+      : NodeData(Kind::VALUE, layout()), d_value(std::move(value))
+  {
+    d_hash += std::hash<T>{}(d_value);
+  };
 
   ~NodeDataValue() = default;
 
-  size_t hash() const override
-  {
-    return NodeData::hash() + std::hash<T>{}(d_value);
-  }
-
-  bool equals(const NodeData& other) const override
+ private:
+  /** @return The layout tag for values of type T. */
+  static constexpr Layout layout()
   {
-    if (!NodeData::equals(other))
+    if constexpr (std::is_same_v<T, bool>)
+    {
+      return Layout::VALUE_BOOL;
+    }
+    else if constexpr (std::is_same_v<T, BitVector>)
+    {
+      return Layout::VALUE_BV;
+    }
+    else if constexpr (std::is_same_v<T, RoundingMode>)
     {
-      return false;
+      return Layout::VALUE_RM;
     }
-    if (get_type() != other.get_type())
+    else
     {
-      return false;
+      static_assert(std::is_same_v<T, FloatingPoint>);
+      return Layout::VALUE_FP;
     }
-    const auto& o = reinterpret_cast<const NodeDataValue<T>&>(other);
-    return d_value == o.d_value;
   }
 
- private:
+  /** @return True if `other` stores the same value of the same type. */
+  bool equals(const NodeDataValue<T>& other) const
+  {
+    return get_type() == other.get_type() && d_value == other.d_value;
+  }
+
   T d_value;
 };
 
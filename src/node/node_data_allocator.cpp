@@ -0,0 +1,80 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "node/node_data_allocator.h"
+
+#include <cassert>
+
+#include "node/node_data.h"
+
+namespace bzla::node {
+
+/* --- NodeDataAllocator public -------------------------------------------- */
+
+NodeDataAllocator::~NodeDataAllocator()
+{
+  // All node data is expected to be destroyed by the node manager.
+  assert(d_stats.num_live == 0);
+}
+
+void
+NodeDataAllocator::destroy(NodeData* d)
+{
+  assert(d != nullptr);
+  uint8_t cls = d->d_alloc_class;
+  assert(cls < s_num_size_classes);
+  d->destruct();
+
+  FreeSlot* slot        = reinterpret_cast<FreeSlot*>(d);
+  slot->d_next          = d_classes[cls].d_free;
+  d_classes[cls].d_free = slot;
+  assert(d_stats.num_live > 0);
+  --d_stats.num_live;
+}
+
+size_t
+NodeDataAllocator::slot_size(const NodeData* d)
+{
+  assert(d != nullptr);
+  return (static_cast<size_t>(d->d_alloc_class) + 1) * s_alignment;
+}
+
+/* --- NodeDataAllocator private ------------------------------------------- */
+
+void*
+NodeDataAllocator::allocate(uint8_t cls)
+{
+  SizeClass& sc = d_classes[cls];
+  ++d_stats.num_allocs;
+  ++d_stats.num_live;
+
+  // Reuse slot of previously destroyed node data.
+  if (sc.d_free)
+  {
+    ++d_stats.num_reused;
+    FreeSlot* slot = sc.d_free;
+    sc.d_free      = slot->d_next;
+    return slot;
+  }
+
+  size_t slot_size = (static_cast<size_t>(cls) + 1) * s_alignment;
+  if (sc.d_cur == nullptr || sc.d_cur + slot_size > sc.d_end)
+  {
+    d_slabs.emplace_back(new std::byte[s_slab_size]);
+    ++d_stats.num_slabs;
+    sc.d_cur = d_slabs.back().get();
+    sc.d_end = sc.d_cur + s_slab_size;
+  }
+  void* res = sc.d_cur;
+  sc.d_cur += slot_size;
+  return res;
+}
+
+}  // namespace bzla::node
@@ -0,0 +1,127 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_DATA_ALLOCATOR_H_INCLUDED
+#define BZLA_NODE_NODE_DATA_ALLOCATOR_H_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bzla::node {
+
+class NodeData;
+
+/**
+ * Size-class slab allocator for node data objects.
+ *
+ * Node data objects are placed into fixed-size slots of large slabs, with one
+ * size class per (aligned) object size. Each concrete node data layout thus
+ * gets its own pool of slabs. Slots of garbage collected node data are kept
+ * in a per size class free list and reused by subsequent allocations.
+ */
+class NodeDataAllocator
+{
+ public:
+  struct Statistics
+  {
+    uint64_t num_slabs  = 0;  // Number of allocated slabs
+    uint64_t num_allocs = 0;  // Number of slot allocations
+    uint64_t num_reused = 0;  // Number of slot allocations from free lists
+    uint64_t num_live   = 0;  // Current number of allocated slots
+  };
+
+  NodeDataAllocator() = default;
+  ~NodeDataAllocator();
+  NodeDataAllocator(const NodeDataAllocator&)            = delete;
+  NodeDataAllocator& operator=(const NodeDataAllocator&) = delete;
+
+  /**
+   * Allocate a slot for node data of type T and construct it in place.
+   * @param args The constructor arguments.
+   * @return The constructed node data.
+   */
+  template <class T, class... Args>
+  T* construct(Args&&... args)
+  {
+    static_assert(std::is_base_of_v<NodeData, T>);
+    static_assert(alignof(T) <= s_alignment);
+    constexpr uint8_t cls = size_class(sizeof(T));
+    static_assert(cls < s_num_size_classes);
+    T* d             = new (allocate(cls)) T(std::forward<Args>(args)...);
+    d->d_alloc_class = cls;
+    return d;
+  }
+
+  /**
+   * Destruct given node data and release its slot.
+   * @param d The node data to destroy.
+   */
+  void destroy(NodeData* d);
+
+  /** @return Allocator statistics. */
+  const Statistics& statistics() const { return d_stats; }
+
+  /** @return The number of bytes reserved by all slabs. */
+  size_t bytes_reserved() const { return d_slabs.size() * s_slab_size; }
+
+  /** @return The size of the slot occupied by given node data in bytes. */
+  static size_t slot_size(const NodeData* d);
+
+ private:
+  /** Alignment and granularity of slot sizes. */
+  static constexpr size_t s_alignment = 16;
+  /** Number of size classes, supports objects up to 256 bytes. */
+  static constexpr size_t s_num_size_classes = 16;
+  /** The size of a slab in bytes. */
+  static constexpr size_t s_slab_size = 1 << 16;
+
+  /** @return The size class of an object of given size. */
+  static constexpr uint8_t size_class(size_t size)
+  {
+    return static_cast<uint8_t>((size + s_alignment - 1) / s_alignment - 1);
+  }
+
+  /** Free list entry, stored in the released slot itself. */
+  struct FreeSlot
+  {
+    FreeSlot* d_next;
+  };
+
+  /** Allocation state of a size class. */
+  struct SizeClass
+  {
+    /** Head of free list. */
+    FreeSlot* d_free = nullptr;
+    /** Next unused slot in current slab. */
+    std::byte* d_cur = nullptr;
+    /** End of current slab. */
+    std::byte* d_end = nullptr;
+  };
+
+  /** Allocate slot of given size class. */
+  void* allocate(uint8_t cls);
+
+  /** The size classes. */
+  std::array<SizeClass, s_num_size_classes> d_classes;
+  /** Stores all allocated slabs. */
+  std::vector<std::unique_ptr<std::byte[]>> d_slabs;
+  /** Allocator statistics. */
+  Statistics d_stats;
+};
+
+}  // namespace bzla::node
+
+#endif
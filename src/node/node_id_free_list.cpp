@@ -0,0 +1,92 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "node/node_id_free_list.h"
+
+#include <cassert>
+
+namespace bzla::node {
+
+/* --- NodeIdFreeList public ----------------------------------------------- */
+
+void
+NodeIdFreeList::insert(uint64_t id)
+{
+  assert(id > 0);
+  assert(!contains(id));
+  size_t w = id >> 6;
+  if (w >= d_words.size())
+  {
+    d_words.resize(w + 1, 0);
+    d_summary.resize((w >> 6) + 1, 0);
+  }
+  d_words[w] |= uint64_t(1) << (id & 63);
+  d_summary[w >> 6] |= uint64_t(1) << (w & 63);
+  ++d_size;
+}
+
+void
+NodeIdFreeList::erase(uint64_t id)
+{
+  assert(contains(id));
+  size_t w = id >> 6;
+  d_words[w] &= ~(uint64_t(1) << (id & 63));
+  if (d_words[w] == 0)
+  {
+    d_summary[w >> 6] &= ~(uint64_t(1) << (w & 63));
+  }
+  --d_size;
+}
+
+bool
+NodeIdFreeList::contains(uint64_t id) const
+{
+  size_t w = id >> 6;
+  return w < d_words.size() && (d_words[w] >> (id & 63)) & 1;
+}
+
+uint64_t
+NodeIdFreeList::find(uint64_t min_id) const
+{
+  if (d_size == 0)
+  {
+    return 0;
+  }
+  size_t w = min_id >> 6;
+  if (w >= d_words.size())
+  {
+    return 0;
+  }
+  // Check remaining bits of the word that contains `min_id`.
+  uint64_t bits = d_words[w] & (~uint64_t(0) << (min_id & 63));
+  if (bits)
+  {
+    return (w << 6) + __builtin_ctzll(bits);
+  }
+  // Find next non-zero word via the summary.
+  ++w;
+  for (size_t s = w >> 6, size = d_summary.size(); s < size; ++s)
+  {
+    uint64_t sbits = d_summary[s];
+    if (s == (w >> 6))
+    {
+      sbits &= ~uint64_t(0) << (w & 63);
+    }
+    if (sbits)
+    {
+      size_t nw = (s << 6) + __builtin_ctzll(sbits);
+      assert(d_words[nw]);
+      return (nw << 6) + __builtin_ctzll(d_words[nw]);
+    }
+  }
+  return 0;
+}
+
+}  // namespace bzla::node
@@ -0,0 +1,65 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_ID_FREE_LIST_H_INCLUDED
+#define BZLA_NODE_NODE_ID_FREE_LIST_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "util/memory.h"
+
+namespace bzla::node {
+
+/**
+ * Set of released node ids that can be reused for new nodes.
+ *
+ * Stored as a two-level bitset, where the second level marks the non-zero
+ * words of the first level. This allows to efficiently query the smallest
+ * free id that is greater or equal to a given lower bound, which is required
+ * to preserve the invariant that node ids are greater than the ids of their
+ * children.
+ */
+class NodeIdFreeList
+{
+ public:
+  /** Mark `id` as free. */
+  void insert(uint64_t id);
+  /** Mark `id` as used. */
+  void erase(uint64_t id);
+  /** @return True if `id` is marked as free. */
+  bool contains(uint64_t id) const;
+  /**
+   * Find smallest free id.
+   * @param min_id The lower bound for the id.
+   * @return The smallest free id >= `min_id`, or 0 if there is none.
+   */
+  uint64_t find(uint64_t min_id) const;
+  /** @return The number of free ids. */
+  size_t size() const { return d_size; }
+  /** @return The number of bytes allocated by the free list. */
+  size_t memory_usage() const
+  {
+    return util::memory_usage(d_words) + util::memory_usage(d_summary);
+  }
+
+ private:
+  /** Bit i is set if id i is free. */
+  std::vector<uint64_t> d_words;
+  /** Bit i is set if word i in `d_words` is non-zero. */
+  std::vector<uint64_t> d_summary;
+  /** The number of free ids. */
+  size_t d_size = 0;
+};
+
+}  // namespace bzla::node
+
+#endif
@@ -0,0 +1,106 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_ID_MAP_H_INCLUDED
+#define BZLA_NODE_NODE_ID_MAP_H_INCLUDED
+
+#include "node/node_id_table.h"
+
+namespace bzla::node {
+
+/**
+ * Map from nodes to values of type T, indexed by node id.
+ *
+ * Elements are stored in the paged storage of NodeIdTable, hence iterators
+ * and references to stored elements stay valid when inserting other elements.
+ *
+ * Like std::unordered_map<Node, T>, the map holds a reference to its keys.
+ * Requires T to be default constructible.
+ */
+template <class T>
+class NodeIdMap : public NodeIdTable<std::pair<Node, T>>
+{
+  using Base = NodeIdTable<std::pair<Node, T>>;
+
+ public:
+  using key_type       = Node;
+  using mapped_type    = T;
+  using value_type     = std::pair<Node, T>;
+  using iterator       = NodeIdIterator<NodeIdMap, value_type>;
+  using const_iterator = NodeIdIterator<const NodeIdMap, const value_type>;
+
+  iterator begin() { return iterator(this, Base::next(0)); }
+  iterator end() { return iterator(this, Base::s_end); }
+  const_iterator begin() const { return const_iterator(this, Base::next(0)); }
+  const_iterator end() const { return const_iterator(this, Base::s_end); }
+
+  /** @return An iterator to the element with given key, end() otherwise. */
+  iterator find(const Node& key)
+  {
+    return Base::lookup(key) ? iterator(this, key.id()) : end();
+  }
+  const_iterator find(const Node& key) const
+  {
+    return Base::lookup(key) ? const_iterator(this, key.id()) : end();
+  }
+
+  /**
+   * Insert an element with given key constructed from `args` if the key is
+   * not yet stored.
+   * @return A pair of an iterator to the element with given key and a flag
+   *         that indicates whether the element was inserted.
+   */
+  template <class... Args>
+  std::pair<iterator, bool> emplace(const Node& key, Args&&... args)
+  {
+    bool inserted;
+    value_type& slot = Base::get_or_create(key, inserted);
+    if (inserted)
+    {
+      slot.first  = key;
+      slot.second = T(std::forward<Args>(args)...);
+    }
+    return std::make_pair(iterator(this, key.id()), inserted);
+  }
+
+  /** @return The value mapped to given key, default inserted if not stored. */
+  T& operator[](const Node& key)
+  {
+    bool inserted;
+    value_type& slot = Base::get_or_create(key, inserted);
+    if (inserted)
+    {
+      slot.first = key;
+    }
+    return slot.second;
+  }
+
+  /** @return The value mapped to given key, which must be stored. */
+  T& at(const Node& key)
+  {
+    value_type* slot = Base::lookup(key);
+    assert(slot);
+    return slot->second;
+  }
+  const T& at(const Node& key) const
+  {
+    const value_type* slot = Base::lookup(key);
+    assert(slot);
+    return slot->second;
+  }
+
+ private:
+  friend iterator;
+  friend const_iterator;
+};
+
+}  // namespace bzla::node
+
+#endif
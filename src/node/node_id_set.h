@@ -0,0 +1,64 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_ID_SET_H_INCLUDED
+#define BZLA_NODE_NODE_ID_SET_H_INCLUDED
+
+#include "node/node_id_table.h"
+
+namespace bzla::node {
+
+/**
+ * Set of nodes, indexed by node id.
+ *
+ * Uses the paged storage of NodeIdTable, where each slot stores the node
+ * itself (or a null node if the slot is not occupied).
+ *
+ * Like std::unordered_set<Node>, the set holds a reference to its elements.
+ */
+class NodeIdSet : public NodeIdTable<Node>
+{
+ public:
+  using value_type     = Node;
+  using iterator       = NodeIdIterator<const NodeIdSet, const Node>;
+  using const_iterator = iterator;
+
+  iterator begin() const { return iterator(this, next(0)); }
+  iterator end() const { return iterator(this, s_end); }
+
+  /** @return An iterator to given node if stored, end() otherwise. */
+  iterator find(const Node& node) const
+  {
+    return lookup(node) ? iterator(this, node.id()) : end();
+  }
+
+  /**
+   * Insert node if not yet stored.
+   * @return A pair of an iterator to the node and a flag that indicates
+   *         whether the node was inserted.
+   */
+  std::pair<iterator, bool> insert(const Node& node)
+  {
+    bool inserted;
+    Node& slot = get_or_create(node, inserted);
+    if (inserted)
+    {
+      slot = node;
+    }
+    return std::make_pair(iterator(this, node.id()), inserted);
+  }
+
+ private:
+  friend iterator;
+};
+
+}  // namespace bzla::node
+
+#endif
@@ -0,0 +1,250 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_ID_TABLE_H_INCLUDED
+#define BZLA_NODE_NODE_ID_TABLE_H_INCLUDED
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "node/node.h"
+
+namespace bzla::node {
+
+/**
+ * Forward iterator over the occupied slots of a node id indexed container.
+ *
+ * The container is required to provide `slot(id)` to access an occupied slot
+ * and `next(id)` to determine the id of the next occupied slot.
+ */
+template <class Container, class Slot>
+class NodeIdIterator
+{
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type        = std::remove_const_t<Slot>;
+  using difference_type   = std::ptrdiff_t;
+  using pointer           = Slot*;
+  using reference         = Slot&;
+
+  NodeIdIterator(Container* container, uint64_t id)
+      : d_container(container), d_id(id)
+  {
+  }
+
+  /** Conversion from non-const to const iterator. */
+  template <class C,
+            class S,
+            class = std::enable_if_t<std::is_convertible_v<C*, Container*>>>
+  NodeIdIterator(const NodeIdIterator<C, S>& other)
+      : d_container(other.d_container), d_id(other.d_id)
+  {
+  }
+
+  reference operator*() const { return d_container->slot(d_id); }
+  pointer operator->() const { return &d_container->slot(d_id); }
+
+  NodeIdIterator& operator++()
+  {
+    d_id = d_container->next(d_id + 1);
+    return *this;
+  }
+
+  NodeIdIterator operator++(int)
+  {
+    NodeIdIterator res = *this;
+    ++(*this);
+    return res;
+  }
+
+  bool operator==(const NodeIdIterator& other) const
+  {
+    return d_id == other.d_id;
+  }
+  bool operator!=(const NodeIdIterator& other) const
+  {
+    return d_id != other.d_id;
+  }
+
+ private:
+  template <class C, class S>
+  friend class NodeIdIterator;
+
+  Container* d_container;
+  /** The node id of the current slot. */
+  uint64_t d_id;
+};
+
+/**
+ * Paged storage of slots indexed by node id, the common base of NodeIdMap
+ * and NodeIdSet.
+ *
+ * Node ids are dense, hence the slots are stored as a vector of fixed-size
+ * pages, which are allocated on demand. Lookups are plain index computations
+ * and do not require hashing. Since pages are never moved, references to
+ * slots stay valid when other slots are occupied.
+ *
+ * A slot is either a node or a pair of a node and a value, and is occupied
+ * if its node is not null. Requires Slot to be default constructible.
+ */
+template <class Slot>
+class NodeIdTable
+{
+ public:
+  /** @return The number of occupied slots. */
+  size_t size() const { return d_size; }
+  /** @return True if no slots are occupied. */
+  bool empty() const { return d_size == 0; }
+
+  /** @return The number of bytes allocated by the pages. */
+  size_t memory_usage() const
+  {
+    size_t res = d_pages.capacity() * sizeof(d_pages[0]);
+    for (const auto& page : d_pages)
+    {
+      if (page)
+      {
+        res += s_page_size * sizeof(Slot);
+      }
+    }
+    return res;
+  }
+
+  /** Release all slots and pages. */
+  void clear()
+  {
+    d_pages.clear();
+    d_size = 0;
+  }
+
+  /** @return 1 if the slot of given node is occupied, 0 otherwise. */
+  size_t count(const Node& node) const { return lookup(node) ? 1 : 0; }
+
+  /**
+   * Release the slot of given node.
+   * @return The number of released slots.
+   */
+  size_t erase(const Node& node)
+  {
+    Slot* slot = lookup(node);
+    if (slot == nullptr)
+    {
+      return 0;
+    }
+    *slot = Slot();
+    --d_size;
+    return 1;
+  }
+
+ protected:
+  /** The id of the past-the-end iterator. */
+  static constexpr uint64_t s_end = std::numeric_limits<uint64_t>::max();
+
+  /** @return The node of given slot, null if the slot is not occupied. */
+  static const Node& key(const Node& slot) { return slot; }
+  template <class T>
+  static const Node& key(const std::pair<Node, T>& slot)
+  {
+    return slot.first;
+  }
+
+  /** @return The slot with given id, which must be occupied. */
+  Slot& slot(uint64_t id) const
+  {
+    assert((id >> s_page_bits) < d_pages.size());
+    assert(d_pages[id >> s_page_bits]);
+    return d_pages[id >> s_page_bits][id & s_page_mask];
+  }
+
+  /** @return The id of the first occupied slot >= `id`, or s_end. */
+  uint64_t next(uint64_t id) const
+  {
+    for (uint64_t cap = d_pages.size() * s_page_size; id < cap;)
+    {
+      const auto& page = d_pages[id >> s_page_bits];
+      if (!page)
+      {
+        id = (id | s_page_mask) + 1;
+        continue;
+      }
+      if (!key(page[id & s_page_mask]).is_null())
+      {
+        return id;
+      }
+      ++id;
+    }
+    return s_end;
+  }
+
+  /** @return The slot of given node if occupied, nullptr otherwise. */
+  Slot* lookup(const Node& node) const
+  {
+    assert(!node.is_null());
+    uint64_t id   = node.id();
+    uint64_t page = id >> s_page_bits;
+    if (page >= d_pages.size() || !d_pages[page])
+    {
+      return nullptr;
+    }
+    Slot* slot = &d_pages[page][id & s_page_mask];
+    return key(*slot).is_null() ? nullptr : slot;
+  }
+
+  /**
+   * Get the slot of given node, allocates its page if necessary.
+   * @param node The node.
+   * @param inserted Set to true if the slot was not occupied yet. The caller
+   *                 is responsible for storing `node` in the slot.
+   * @return The slot of given node.
+   */
+  Slot& get_or_create(const Node& node, bool& inserted)
+  {
+    assert(!node.is_null());
+    uint64_t id   = node.id();
+    uint64_t page = id >> s_page_bits;
+    if (page >= d_pages.size())
+    {
+      d_pages.resize(page + 1);
+    }
+    if (!d_pages[page])
+    {
+      d_pages[page] = std::make_unique<Slot[]>(s_page_size);
+    }
+    Slot& slot = d_pages[page][id & s_page_mask];
+    inserted   = key(slot).is_null();
+    if (inserted)
+    {
+      ++d_size;
+    }
+    return slot;
+  }
+
+ private:
+  /** Number of slots per page as power of two. */
+  static constexpr uint64_t s_page_bits = 10;
+  static constexpr uint64_t s_page_size = 1ull << s_page_bits;
+  static constexpr uint64_t s_page_mask = s_page_size - 1;
+
+  /** The pages, nullptr if no slot of a page was used yet. */
+  std::vector<std::unique_ptr<Slot[]>> d_pages;
+  /** The number of occupied slots. */
+  size_t d_size = 0;
+};
+
+}  // namespace bzla::node
+
+#endif
@@ -10,12 +10,14 @@
 
 #include "node/node_manager.h"
 
+#include <algorithm>
 #include <functional>
 
 #include "bv/bitvector.h"
 #include "node/kind_info.h"
 #include "solver/fp/floating_point.h"
 #include "solver/fp/rounding_mode.h"
+#include "util/memory.h"
 
 namespace bzla {
 
@@ -39,7 +41,7 @@ NodeManager::~NodeManager()
   //       destructed after the NodeManager do not get garbage collected before
   //       destructing the NodeManager. Hence, we have to make sure to
   //       invalidate all nodes before destructing the node manager.
-  for (std::unique_ptr<NodeData>& data : d_node_data)
+  for (NodeData* data : d_node_data)
   {
     if (data == nullptr) continue;
     for (size_t i = 0, size = data->get_num_children(); i < size; ++i)
@@ -47,6 +49,7 @@ NodeManager::~NodeManager()
       Node& child  = data->get_child(i);
       child.d_data = nullptr;
     }
+    d_node_data_allocator.destroy(data);
   }
 }
 
@@ -54,12 +57,12 @@ Node
 NodeManager::mk_const(const Type& t, const std::optional<std::string>& symbol)
 {
   assert(!t.is_null());
-  NodeData* data = new NodeData(Kind::CONSTANT);
+  NodeData* data = d_node_data_allocator.construct<NodeData>(Kind::CONSTANT);
   data->d_type   = t;
   init_id(data);
   if (symbol)
   {
-    d_symbol_table.emplace(data, *symbol);
+    data->d_symbol = d_symbols.intern(*symbol);
   }
   return Node(data);
 }
@@ -77,7 +80,7 @@ NodeManager::mk_const_array(const Type& t, const Node& term)
   auto found_data = find_or_insert_node(data);
   if (found_data)
   {
-    delete data;
+    d_node_data_allocator.destroy(data);
     data = found_data;
   }
   return Node(data);
@@ -87,12 +90,12 @@ Node
 NodeManager::mk_var(const Type& t, const std::optional<std::string>& symbol)
 {
   assert(!t.is_null());
-  NodeData* data = new NodeData(Kind::VARIABLE);
+  NodeData* data = d_node_data_allocator.construct<NodeData>(Kind::VARIABLE);
   data->d_type   = t;
   init_id(data);
   if (symbol)
   {
-    d_symbol_table.emplace(data, *symbol);
+    data->d_symbol = d_symbols.intern(*symbol);
   }
   return Node(data);
 }
@@ -100,12 +103,13 @@ NodeManager::mk_var(const Type& t, const std::optional<std::string>& symbol)
 Node
 NodeManager::mk_value(bool value)
 {
-  NodeData* data  = new NodeDataValue(value);
+  NodeData* data =
+      d_node_data_allocator.construct<NodeDataValue<bool>>(value);
   data->d_type    = mk_bool_type();
   auto found_data = find_or_insert_node(data);
   if (found_data)
   {
-    delete data;
+    d_node_data_allocator.destroy(data);
     data = found_data;
   }
   return Node(data);
@@ -114,12 +118,29 @@ NodeManager::mk_value(bool value)
 Node
 NodeManager::mk_value(const BitVector& value)
 {
-  NodeData* data  = new NodeDataValue(value);
+  NodeData* data =
+      d_node_data_allocator.construct<NodeDataValue<BitVector>>(value);
   data->d_type    = mk_bv_type(value.size());
   auto found_data = find_or_insert_node(data);
   if (found_data)
   {
-    delete data;
+    d_node_data_allocator.destroy(data);
+    data = found_data;
+  }
+  return Node(data);
+}
+
+Node
+NodeManager::mk_value(BitVector&& value)
+{
+  Type type = mk_bv_type(value.size());
+  NodeData* data = d_node_data_allocator.construct<NodeDataValue<BitVector>>(
+      std::move(value));
+  data->d_type    = type;
+  auto found_data = find_or_insert_node(data);
+  if (found_data)
+  {
+    d_node_data_allocator.destroy(data);
     data = found_data;
   }
   return Node(data);
@@ -128,12 +149,13 @@ NodeManager::mk_value(const BitVector& value)
 Node
 NodeManager::mk_value(const RoundingMode value)
 {
-  NodeData* data  = new NodeDataValue(value);
+  NodeData* data =
+      d_node_data_allocator.construct<NodeDataValue<RoundingMode>>(value);
   data->d_type    = mk_rm_type();
   auto found_data = find_or_insert_node(data);
   if (found_data)
   {
-    delete data;
+    d_node_data_allocator.destroy(data);
     data = found_data;
   }
   return Node(data);
@@ -142,13 +164,14 @@ NodeManager::mk_value(const RoundingMode value)
 Node
 NodeManager::mk_value(const FloatingPoint& value)
 {
-  NodeData* data = new NodeDataValue(value);
+  NodeData* data =
+      d_node_data_allocator.construct<NodeDataValue<FloatingPoint>>(value);
   data->d_type =
       mk_fp_type(value.get_exponent_size(), value.get_significand_size());
   auto found_data = find_or_insert_node(data);
   if (found_data)
   {
-    delete data;
+    d_node_data_allocator.destroy(data);
     data = found_data;
   }
   return Node(data);
@@ -156,25 +179,25 @@ NodeManager::mk_value(const FloatingPoint& value)
 
 Node
 NodeManager::mk_node(Kind kind,
-                     const std::vector<Node>& children,
-                     const std::vector<uint64_t>& indices)
+                     util::Span<Node> children,
+                     util::Span<uint64_t> indices)
 {
   assert(kind != Kind::CONSTANT);
   assert(kind != Kind::CONST_ARRAY);
   assert(kind != Kind::VALUE);
   assert(kind != Kind::VARIABLE);
-  NodeData* data  = new_data(kind, children, indices);
-  auto found_data = find_or_insert_node(data);
-  if (found_data)
+  // Look up node before constructing node data.
+  NodeData* data = d_unique_nodes.find(kind, children, indices);
+  if (data)
   {
-    delete data;
-    data = found_data;
-  }
-  else
-  {
-    // Compute type for new node
-    data->d_type = compute_type(kind, children, indices);
+    return Node(data);
   }
+  data = new_data(kind, children, indices);
+  assert(data->hash() == NodeData::hash(kind, children, indices));
+  [[maybe_unused]] auto found_data = find_or_insert_node(data);
+  assert(found_data == nullptr);
+  // Compute type for new node
+  data->d_type = compute_type(kind, children, indices);
   return Node(data);
 }
 
@@ -233,8 +256,8 @@ NodeManager::mk_uninterpreted_type(const std::optional<std::string>& symbol)
 
 Type
 NodeManager::compute_type(Kind kind,
-                          const std::vector<Node>& children,
-                          const std::vector<uint64_t>& indices)
+                          util::Span<Node> children,
+                          util::Span<uint64_t> indices)
 {
   assert(check_type(kind, children, indices).first);
 
@@ -393,10 +416,25 @@ NodeManager::compute_type(Kind kind,
   return Type();
 }
 
+void
+NodeManager::reserve(size_t num_nodes)
+{
+  d_node_data.reserve(d_node_data.size() + num_nodes);
+  d_unique_nodes.reserve(d_unique_nodes.size() + num_nodes);
+}
+
+size_t
+NodeManager::memory_usage() const
+{
+  return d_node_data_allocator.bytes_reserved()
+         + util::memory_usage(d_node_data) + d_unique_nodes.memory_usage()
+         + d_free_ids.memory_usage() + d_symbols.memory_usage();
+}
+
 std::pair<bool, std::string>
 NodeManager::check_type(Kind kind,
-                        const std::vector<Node>& children,
-                        const std::vector<uint64_t>& indices)
+                        util::Span<Node> children,
+                        util::Span<uint64_t> indices)
 {
   std::stringstream ss;
 
@@ -826,33 +864,88 @@ NodeManager::check_type(Kind kind,
 void
 NodeManager::init_id(NodeData* data)
 {
-  assert(d_node_id_counter < UINT64_MAX);
   assert(data != nullptr);
   assert(data->d_id == 0);
-  d_node_data.emplace_back(data);
-  assert(d_node_data.size() == static_cast<size_t>(d_node_id_counter));
-  data->d_id = d_node_id_counter++;
+
+  // Node ids are always greater than the ids of their children, which allows
+  // to sort nodes topologically by id. Hence, we can only reuse a released id
+  // if it is greater than all child ids.
+  uint64_t min_id = 1;
+  for (size_t i = 0, size = data->get_num_children(); i < size; ++i)
+  {
+    min_id = std::max(min_id, data->get_child(i).id() + 1);
+  }
+
+  uint64_t id = d_free_ids.find(min_id);
+  if (id > 0)
+  {
+    d_free_ids.erase(id);
+    assert(d_node_data[id - 1] == nullptr);
+    d_node_data[id - 1] = data;
+    ++d_stats.num_ids_reused;
+  }
+  else
+  {
+    assert(d_node_id_counter < UINT64_MAX);
+    id = d_node_id_counter++;
+    d_node_data.emplace_back(data);
+    assert(d_node_data.size() == static_cast<size_t>(id));
+  }
+  data->d_id = id;
+
+  d_stats.num_bytes_per_kind[static_cast<size_t>(data->d_kind)] +=
+      NodeDataAllocator::slot_size(data);
+  ++d_stats.num_nodes_live;
+  d_stats.num_nodes_peak =
+      std::max(d_stats.num_nodes_peak, d_stats.num_nodes_live);
+}
+
+void
+NodeManager::release_id(uint64_t id)
+{
+  assert(id > 0 && id < d_node_id_counter);
+  assert(d_node_data[id - 1] == nullptr);
+  assert(d_stats.num_nodes_live > 0);
+  --d_stats.num_nodes_live;
+
+  if (id + 1 < d_node_id_counter)
+  {
+    d_free_ids.insert(id);
+    return;
+  }
+
+  // Released the maximum id, shrink id range to the maximum used id.
+  d_node_data.pop_back();
+  --d_node_id_counter;
+  while (d_node_id_counter > 1 && d_free_ids.contains(d_node_id_counter - 1))
+  {
+    d_free_ids.erase(d_node_id_counter - 1);
+    d_node_data.pop_back();
+    --d_node_id_counter;
+  }
+  assert(d_node_data.size() + 1 == d_node_id_counter);
 }
 
 NodeData*
 NodeManager::new_data(Kind kind,
-                      const std::vector<Node>& children,
-                      const std::vector<uint64_t>& indices)
+                      util::Span<Node> children,
+                      util::Span<uint64_t> indices)
 {
   assert(children.size() > 0);
 
   NodeData* data;
   if (indices.size() > 0)
   {
-    data = new NodeDataIndexed(kind, children, indices);
+    data = d_node_data_allocator.construct<NodeDataIndexed>(
+        kind, children, indices);
   }
   else if (KindInfo::is_nary(kind))
   {
-    data = new NodeDataNary(kind, children);
+    data = d_node_data_allocator.construct<NodeDataNary>(kind, children);
   }
   else
   {
-    data = new NodeDataChildren(kind, children);
+    data = d_node_data_allocator.construct<NodeDataChildren>(kind, children);
   }
   return data;
 }
@@ -860,14 +953,14 @@ NodeManager::new_data(Kind kind,
 NodeData*
 NodeManager::find_or_insert_node(NodeData* lookup)
 {
-  auto [it, inserted] = d_unique_nodes.insert(lookup);
+  auto [inserted, data] = d_unique_nodes.insert(lookup);
   if (inserted)
   {
     // Initialize new node
     init_id(lookup);
     return nullptr;
   }
-  return *it;
+  return data;
 }
 
 void
@@ -886,8 +979,12 @@ NodeManager::garbage_collect(NodeData* data)
     cur = visit.back();
     visit.pop_back();
 
-    // Erase node data before we modify children.
-    d_unique_nodes.erase(cur);
+    // Erase node data before we modify children. Constants and variables
+    // are not hash consed.
+    if (cur->d_kind != Kind::CONSTANT && cur->d_kind != Kind::VARIABLE)
+    {
+      d_unique_nodes.erase(cur);
+    }
 
     for (size_t i = 0, size = cur->get_num_children(); i < size; ++i)
     {
@@ -906,22 +1003,21 @@ NodeManager::garbage_collect(NodeData* data)
     }
 
     assert(d_node_data[cur->d_id - 1]->d_id == cur->d_id);
-    d_symbol_table.erase(cur);
-    d_node_data[cur->d_id - 1].reset(nullptr);
+    if (cur->d_symbol != util::StringInterner::s_null)
+    {
+      d_symbols.release(cur->d_symbol);
+    }
+    uint64_t& num_bytes =
+        d_stats.num_bytes_per_kind[static_cast<size_t>(cur->d_kind)];
+    assert(num_bytes >= NodeDataAllocator::slot_size(cur));
+    num_bytes -= NodeDataAllocator::slot_size(cur);
+    uint64_t id         = cur->d_id;
+    d_node_data[id - 1] = nullptr;
+    d_node_data_allocator.destroy(cur);
+    release_id(id);
   } while (!visit.empty());
 
   d_in_gc_mode = false;
 }
 
-const std::optional<std::reference_wrapper<const std::string>>
-NodeManager::get_symbol(const NodeData* data) const
-{
-  auto it = d_symbol_table.find(data);
-  if (it == d_symbol_table.end())
-  {
-    return std::nullopt;
-  }
-  return std::optional<std::reference_wrapper<const std::string>>{it->second};
-}
-
 }  // namespace bzla
@@ -11,18 +11,23 @@
 #ifndef BZLA_NODE_NODE_MANAGER_H_INCLUDED
 #define BZLA_NODE_NODE_MANAGER_H_INCLUDED
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 #include "node/node.h"
 #include "node/node_data.h"
+#include "node/node_data_allocator.h"
+#include "node/node_id_free_list.h"
+#include "node/node_unique_table.h"
 #include "type/type_manager.h"
+#include "util/span.h"
+#include "util/string_interner.h"
 
 namespace bzla {
 
@@ -86,6 +91,13 @@ class NodeManager
    * @return Node representing given bit-vector value of given size.
    */
   Node mk_value(const BitVector& value);
+  /**
+   * Create bit-vector value, taking ownership of the given value.
+   *
+   * @param value Bit-vector value to create.
+   * @return Node representing given bit-vector value of given size.
+   */
+  Node mk_value(BitVector&& value);
 
   /**
    * Create rounding mode value.
@@ -106,14 +118,17 @@ class NodeManager
   /**
    * Create node of kind `kind` with given children and indices.
    *
+   * Children and indices can be given as vector, array or braced initializer
+   * list. If the node already exists, no memory is allocated.
+   *
    * @param kind Node kind.
    * @param children The children of the node.
    * @param indices The indices if kind is indexed.
    * @return Node of kind `kind`.
    */
   Node mk_node(node::Kind kind,
-               const std::vector<Node>& children,
-               const std::vector<uint64_t>& indices = {});
+               util::Span<Node> children,
+               util::Span<uint64_t> indices = {});
 
   /**
    * Helper to create an inverted Boolean or bit-vector node.
@@ -177,17 +192,63 @@ class NodeManager
   Type mk_uninterpreted_type(
       const std::optional<std::string>& symbol = std::nullopt);
 
+  /**
+   * Reserve space for creating `num_nodes` additional nodes, e.g., before
+   * loading a large formula.
+   * @param num_nodes The number of additional nodes.
+   */
+  void reserve(size_t num_nodes);
+
   /** Type checking of children and indices based on kind. */
-  std::pair<bool, std::string> check_type(
-      node::Kind kind,
-      const std::vector<Node>& children,
-      const std::vector<uint64_t>& indices = {});
+  std::pair<bool, std::string> check_type(node::Kind kind,
+                                          util::Span<Node> children,
+                                          util::Span<uint64_t> indices = {});
 
 #ifndef NDEBUG
   /** @return Current maximum node id. */
   uint64_t max_node_id() const { return d_node_id_counter; }
 #endif
 
+  /** Node manager statistics. */
+  struct Statistics
+  {
+    /** The number of currently alive nodes. */
+    uint64_t num_nodes_live = 0;
+    /** The maximum number of simultaneously alive nodes. */
+    uint64_t num_nodes_peak = 0;
+    /** The number of nodes that reused the id of a released node. */
+    uint64_t num_ids_reused = 0;
+    /**
+     * The number of bytes of node data slots of currently alive nodes per
+     * kind. Does not include memory allocated by values and symbols.
+     */
+    std::array<uint64_t, static_cast<size_t>(node::Kind::NUM_KINDS)>
+        num_bytes_per_kind{};
+  };
+
+  /** @return Node manager statistics. */
+  const Statistics& statistics() const { return d_stats; }
+
+  /**
+   * @return The number of bytes allocated by the node manager, including
+   *         node data slabs, the node table, the unique table and the
+   *         interned symbols.
+   */
+  size_t memory_usage() const;
+
+  /**
+   * @return The interned symbols of nodes. Parsers use the same storage for
+   *         their symbols, which avoids duplicating symbol strings between
+   *         parser and node manager.
+   */
+  util::StringInterner& symbols() { return d_symbols; }
+
+  /** @return Statistics of the node data allocator. */
+  const node::NodeDataAllocator::Statistics& allocator_statistics() const
+  {
+    return d_node_data_allocator.statistics();
+  }
+
  private:
   /**
    * Constructor, copy constructor, copy assignment and destructor are private
@@ -209,6 +270,16 @@ class NodeManager
    */
   void init_id(node::NodeData* d);
 
+  /**
+   * Release id of garbage collected node data.
+   *
+   * The id is either added to the free ids or, if it is the maximum id, the
+   * id range is shrinked to the maximum used id.
+   *
+   * @param id The released node id.
+   */
+  void release_id(uint64_t id);
+
   /**
    * Create node data object.
    *
@@ -221,8 +292,8 @@ class NodeManager
    * @return Node data.
    */
   node::NodeData* new_data(node::Kind kind,
-                           const std::vector<Node>& children,
-                           const std::vector<uint64_t>& indices);
+                           util::Span<Node> children,
+                           util::Span<uint64_t> indices);
 
   /**
    * Find or insert new node data.
@@ -234,8 +305,8 @@ class NodeManager
 
   /** Compute type for a node. */
   Type compute_type(node::Kind kind,
-                    const std::vector<Node>& children,
-                    const std::vector<uint64_t>& indices = {});
+                    util::Span<Node> children,
+                    util::Span<uint64_t> indices = {});
 
   /**
    * Garbage collect node data.
@@ -247,28 +318,31 @@ class NodeManager
    */
   void garbage_collect(node::NodeData* d);
 
-  const std::optional<std::reference_wrapper<const std::string>> get_symbol(
-      const node::NodeData* d) const;
-
   /** Type manager. */
   type::TypeManager d_tm;
 
-  /** Node id counter. */
+  /** Node id counter, one greater than the maximum used node id. */
   uint64_t d_node_id_counter = 1;
+  /** Released node ids that are below the maximum used node id. */
+  node::NodeIdFreeList d_free_ids;
 
   /** Indicates whether node manager is in garbage collection mode. */
   bool d_in_gc_mode = false;
 
+  /** Slab allocator for node data objects. */
+  node::NodeDataAllocator d_node_data_allocator;
+
   /** Stores all node data objects, accessiable via the node id. */
-  std::vector<std::unique_ptr<node::NodeData>> d_node_data;
+  std::vector<node::NodeData*> d_node_data;
 
   /** Lookup data structure for hash consing of node data. */
-  std::
-      unordered_set<node::NodeData*, node::NodeDataHash, node::NodeDataKeyEqual>
-          d_unique_nodes;
+  node::NodeUniqueTable d_unique_nodes;
+
+  /** Interned symbols of nodes, referenced by handle from the node data. */
+  util::StringInterner d_symbols;
 
-  /** Stores symbols for nodes. */
-  std::unordered_map<const node::NodeData*, std::string> d_symbol_table;
+  /** Node manager statistics. */
+  Statistics d_stats;
 };
 
 }  // namespace bzla
@@ -0,0 +1,298 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "node/node_unique_table.h"
+
+#include <cassert>
+
+#include "node/node_data.h"
+
+namespace bzla::node {
+
+/* --- NodeUniqueTable public ---------------------------------------------- */
+
+NodeUniqueTable::NodeUniqueTable() { d_buckets.resize(s_initial_capacity); }
+
+std::pair<bool, NodeData*>
+NodeUniqueTable::insert(NodeData* d)
+{
+  assert(d != nullptr);
+  migrate(s_migrate_steps);
+
+  size_t h   = hash(d);
+  size_t pos = find(d_buckets, h, d);
+  if (pos < d_buckets.size())
+  {
+    return std::make_pair(false, d_buckets[pos].d_data);
+  }
+  if (!d_old_buckets.empty())
+  {
+    pos = find(d_old_buckets, h, d);
+    if (pos < d_old_buckets.size())
+    {
+      return std::make_pair(false, d_old_buckets[pos].d_data);
+    }
+  }
+
+  if (2 * (d_size + 1) > d_buckets.size())
+  {
+    grow();
+  }
+  insert_bucket(d_buckets, {h, d});
+  ++d_size;
+  return std::make_pair(true, d);
+}
+
+void
+NodeUniqueTable::erase(const NodeData* d)
+{
+  assert(d != nullptr);
+  migrate(s_migrate_steps);
+
+  size_t h   = hash(d);
+  size_t pos = find_ptr(d_buckets, h, d);
+  if (pos < d_buckets.size())
+  {
+    erase_bucket(d_buckets, pos);
+  }
+  else
+  {
+    pos = find_ptr(d_old_buckets, h, d);
+    assert(pos < d_old_buckets.size());
+    erase_bucket(d_old_buckets, pos);
+  }
+  assert(d_size > 0);
+  --d_size;
+}
+
+void
+NodeUniqueTable::reserve(size_t size)
+{
+  size_t capacity = d_buckets.size();
+  while (capacity < 2 * size)
+  {
+    capacity *= 2;
+  }
+  if (capacity == d_buckets.size())
+  {
+    return;
+  }
+
+  // Finish pending migration first.
+  migrate(d_migrate_left);
+  assert(d_old_buckets.empty());
+
+  std::vector<Bucket> buckets(capacity);
+  for (const Bucket& b : d_buckets)
+  {
+    if (b.d_data != nullptr)
+    {
+      insert_bucket(buckets, b);
+    }
+  }
+  d_buckets.swap(buckets);
+}
+
+NodeData*
+NodeUniqueTable::find(Kind kind,
+                      util::Span<Node> children,
+                      util::Span<uint64_t> indices) const
+{
+  size_t h   = mix(NodeData::hash(kind, children, indices));
+  size_t pos = find(d_buckets, h, kind, children, indices);
+  if (pos < d_buckets.size())
+  {
+    return d_buckets[pos].d_data;
+  }
+  if (!d_old_buckets.empty())
+  {
+    pos = find(d_old_buckets, h, kind, children, indices);
+    if (pos < d_old_buckets.size())
+    {
+      return d_old_buckets[pos].d_data;
+    }
+  }
+  return nullptr;
+}
+
+/* --- NodeUniqueTable private --------------------------------------------- */
+
+size_t
+NodeUniqueTable::hash(const NodeData* d)
+{
+  return mix(NodeDataHash()(d));
+}
+
+size_t
+NodeUniqueTable::mix(size_t h)
+{
+  // Mix bits of the node data hash, since the bucket position is determined
+  // by the lower bits only.
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdu;
+  h ^= h >> 33;
+  return static_cast<size_t>(h);
+}
+
+size_t
+NodeUniqueTable::find(const std::vector<Bucket>& buckets,
+                      size_t hash,
+                      const NodeData* d)
+{
+  size_t mask = buckets.size() - 1;
+  for (size_t pos = hash & mask;; pos = (pos + 1) & mask)
+  {
+    const Bucket& b = buckets[pos];
+    if (b.d_data == nullptr)
+    {
+      return buckets.size();
+    }
+    if (b.d_hash == hash && NodeDataKeyEqual()(b.d_data, d))
+    {
+      return pos;
+    }
+  }
+}
+
+size_t
+NodeUniqueTable::find(const std::vector<Bucket>& buckets,
+                      size_t hash,
+                      Kind kind,
+                      util::Span<Node> children,
+                      util::Span<uint64_t> indices)
+{
+  size_t mask = buckets.size() - 1;
+  for (size_t pos = hash & mask;; pos = (pos + 1) & mask)
+  {
+    const Bucket& b = buckets[pos];
+    if (b.d_data == nullptr)
+    {
+      return buckets.size();
+    }
+    if (b.d_hash == hash && b.d_data->equals(kind, children, indices))
+    {
+      return pos;
+    }
+  }
+}
+
+size_t
+NodeUniqueTable::find_ptr(const std::vector<Bucket>& buckets,
+                          size_t hash,
+                          const NodeData* d)
+{
+  if (buckets.empty())
+  {
+    return 0;
+  }
+  size_t mask = buckets.size() - 1;
+  for (size_t pos = hash & mask;; pos = (pos + 1) & mask)
+  {
+    const Bucket& b = buckets[pos];
+    if (b.d_data == nullptr)
+    {
+      return buckets.size();
+    }
+    if (b.d_data == d)
+    {
+      return pos;
+    }
+  }
+}
+
+void
+NodeUniqueTable::insert_bucket(std::vector<Bucket>& buckets,
+                               const Bucket& bucket)
+{
+  size_t mask = buckets.size() - 1;
+  size_t pos  = bucket.d_hash & mask;
+  while (buckets[pos].d_data != nullptr)
+  {
+    pos = (pos + 1) & mask;
+  }
+  buckets[pos] = bucket;
+}
+
+void
+NodeUniqueTable::erase_bucket(std::vector<Bucket>& buckets, size_t pos)
+{
+  size_t mask = buckets.size() - 1;
+  size_t i    = pos;
+  size_t j    = pos;
+  do
+  {
+    j = (j + 1) & mask;
+    if (buckets[j].d_data == nullptr)
+    {
+      break;
+    }
+    // Element at position j can only be moved to position i if its home
+    // bucket k is not cyclically in (i, j].
+    size_t k = buckets[j].d_hash & mask;
+    if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+    {
+      continue;
+    }
+    buckets[i] = buckets[j];
+    i          = j;
+  } while (true);
+  buckets[i] = Bucket();
+}
+
+void
+NodeUniqueTable::grow()
+{
+  // Finish pending migration first.
+  migrate(d_migrate_left);
+  assert(d_old_buckets.empty());
+
+  size_t capacity = d_buckets.size();
+  d_old_buckets.swap(d_buckets);
+  d_buckets.resize(capacity * 2);
+
+  // Start migration at an empty bucket. There is always one since the table
+  // is at most half full.
+  size_t pos = 0;
+  while (d_old_buckets[pos].d_data != nullptr)
+  {
+    ++pos;
+    assert(pos < capacity);
+  }
+  d_migrate_pos  = pos;
+  d_migrate_left = capacity;
+}
+
+void
+NodeUniqueTable::migrate(size_t steps)
+{
+  if (d_migrate_left == 0)
+  {
+    return;
+  }
+
+  size_t mask = d_old_buckets.size() - 1;
+  for (; steps > 0 && d_migrate_left > 0; --steps, --d_migrate_left)
+  {
+    d_migrate_pos = (d_migrate_pos - 1) & mask;
+    Bucket& b     = d_old_buckets[d_migrate_pos];
+    if (b.d_data != nullptr)
+    {
+      insert_bucket(d_buckets, b);
+      b = Bucket();
+    }
+  }
+
+  if (d_migrate_left == 0)
+  {
+    std::vector<Bucket>().swap(d_old_buckets);
+  }
+}
+
+}  // namespace bzla::node
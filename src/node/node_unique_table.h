@@ -0,0 +1,162 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_UNIQUE_TABLE_H_INCLUDED
+#define BZLA_NODE_NODE_UNIQUE_TABLE_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "node/node.h"
+#include "util/memory.h"
+#include "util/span.h"
+
+namespace bzla::node {
+
+enum class Kind;
+class NodeData;
+
+/**
+ * Hash table used for hash consing node data.
+ *
+ * Open-addressing table with linear probing, which stores the hash value of
+ * each node data next to its pointer. Erasing elements shifts back the
+ * remaining elements of the probe sequence, hence no tombstones are needed.
+ *
+ * The table is kept at most half full. When growing, the old buckets are
+ * kept and migrated incrementally to the new buckets (a few buckets on each
+ * insert/erase), which avoids long pauses when rehashing large tables.
+ */
+class NodeUniqueTable
+{
+ public:
+  NodeUniqueTable();
+
+  /**
+   * Insert node data if no structurally equal node data is stored yet.
+   *
+   * @param d The node data to insert.
+   * @return A pair of a flag that indicates whether `d` was inserted, and
+   *         the node data stored in the table (either `d` or the existing
+   *         node data equal to `d`).
+   */
+  std::pair<bool, NodeData*> insert(NodeData* d);
+
+  /**
+   * Erase node data from the table.
+   * @param d The node data to erase, must be stored in the table.
+   */
+  void erase(const NodeData* d);
+
+  /**
+   * Find node data of given kind, children and indices without constructing
+   * a node data object for the lookup.
+   *
+   * @param kind The node kind.
+   * @param children The children of the node.
+   * @param indices The indices of the node.
+   * @return The stored node data, or nullptr if no such node data is stored.
+   */
+  NodeData* find(Kind kind,
+                 util::Span<Node> children,
+                 util::Span<uint64_t> indices) const;
+
+  /** @return The number of stored node data objects. */
+  size_t size() const { return d_size; }
+
+  /**
+   * Grow the table to hold at least `size` node data objects without further
+   * growing.
+   * @param size The number of node data objects to reserve space for.
+   */
+  void reserve(size_t size);
+
+  /** @return The number of bytes allocated by the table. */
+  size_t memory_usage() const
+  {
+    return util::memory_usage(d_buckets) + util::memory_usage(d_old_buckets);
+  }
+
+ private:
+  struct Bucket
+  {
+    /** The (mixed) hash value of `d_data`. */
+    size_t d_hash = 0;
+    /** The stored node data, nullptr if bucket is empty. */
+    NodeData* d_data = nullptr;
+  };
+
+  /** The initial number of buckets, must be a power of two. */
+  static constexpr size_t s_initial_capacity = 64;
+  /** Number of old buckets to migrate per insert/erase. */
+  static constexpr size_t s_migrate_steps = 8;
+
+  /** @return The hash value of `d`. */
+  static size_t hash(const NodeData* d);
+  /** @return The mixed structural hash value `h`. */
+  static size_t mix(size_t h);
+
+  /**
+   * Find bucket of node data of given kind, children and indices.
+   * @return The bucket position or buckets.size() if not found.
+   */
+  static size_t find(const std::vector<Bucket>& buckets,
+                     size_t hash,
+                     Kind kind,
+                     util::Span<Node> children,
+                     util::Span<uint64_t> indices);
+
+  /**
+   * Find bucket of node data structurally equal to `d`.
+   * @return The bucket position or buckets.size() if not found.
+   */
+  static size_t find(const std::vector<Bucket>& buckets,
+                     size_t hash,
+                     const NodeData* d);
+  /**
+   * Find bucket that stores exactly node data `d`.
+   * @return The bucket position or buckets.size() if not found.
+   */
+  static size_t find_ptr(const std::vector<Bucket>& buckets,
+                         size_t hash,
+                         const NodeData* d);
+  /** Insert bucket, which must not yet be stored in `buckets`. */
+  static void insert_bucket(std::vector<Bucket>& buckets,
+                            const Bucket& bucket);
+  /** Clear bucket at `pos` and shift back elements of its probe sequence. */
+  static void erase_bucket(std::vector<Bucket>& buckets, size_t pos);
+
+  /** Double the number of buckets and start migrating old buckets. */
+  void grow();
+  /** Migrate at most `steps` old buckets to the current buckets. */
+  void migrate(size_t steps);
+
+  /** The current buckets. */
+  std::vector<Bucket> d_buckets;
+  /** The old buckets that still need to be migrated after growing. */
+  std::vector<Bucket> d_old_buckets;
+  /**
+   * The old buckets are migrated backwards starting from an empty bucket,
+   * which guarantees that no probe sequence of the remaining old elements
+   * passes through an already migrated bucket. This is the position of the
+   * last migrated bucket.
+   */
+  size_t d_migrate_pos = 0;
+  /** The number of old buckets that still need to be migrated. */
+  size_t d_migrate_left = 0;
+  /** Number of stored elements. */
+  size_t d_size = 0;
+};
+
+}  // namespace bzla::node
+
+#endif
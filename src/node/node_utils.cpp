@@ -10,6 +10,9 @@
 
 #include "node/node_utils.h"
 
+#include <array>
+#include <vector>
+
 #include "bv/bitvector.h"
 #include "node/kind_info.h"
 #include "node/node_manager.h"
@@ -40,6 +43,7 @@ _is_bv_sext_aux(const Node& ite, const Node& ext, size_t idx)
   }
   return false;
 }
+
 }  // namespace
 
 bool
@@ -206,7 +210,7 @@ bool_to_bv1(const Node& node)
 }
 
 Node
-rebuild_node(const Node& node, const std::vector<Node>& children)
+rebuild_node(const Node& node, util::Span<Node> children)
 {
   assert(node.num_children() == children.size());
   if (node.num_children() == 0)
@@ -222,47 +226,54 @@ rebuild_node(const Node& node, const std::vector<Node>& children)
   else
   {
     NodeManager& nm = NodeManager::get();
-    if (node.num_indices() > 0)
+    std::array<uint64_t, 2> indices;
+    size_t num_indices = node.num_indices();
+    assert(num_indices <= indices.size());
+    for (size_t i = 0; i < num_indices; ++i)
     {
-      return nm.mk_node(node.kind(), children, node.indices());
+      indices[i] = node.index(i);
     }
-    return nm.mk_node(node.kind(), children);
+    return nm.mk_node(node.kind(), children, {indices.data(), num_indices});
   }
 }
 
+/**
+ * Nodes with at most NodeDataChildren::s_max_children children are rebuilt
+ * without allocating a temporary vector of children.
+ */
+template <class Cache, class>
 Node
-rebuild_node(const Node& node, const std::unordered_map<Node, Node>& cache)
+rebuild_node(const Node& node, const Cache& cache)
 {
-  std::vector<Node> children;
+  size_t num_children = node.num_children();
+  std::array<Node, NodeDataChildren::s_max_children> buffer;
+  std::vector<Node> large_buffer;
+  Node* children = buffer.data();
+  if (num_children > buffer.size())
+  {
+    large_buffer.resize(num_children);
+    children = large_buffer.data();
+  }
 
   bool changed = false;
-  for (const Node& child : node)
+  for (size_t i = 0; i < num_children; ++i)
   {
-    auto iit = cache.find(child);
+    auto iit = cache.find(node[i]);
     assert(iit != cache.end());
     assert(!iit->second.is_null());
-    children.push_back(iit->second);
-    changed |= iit->second != child;
+    children[i] = iit->second;
+    changed |= iit->second != node[i];
   }
 
-  if (!changed || node.num_children() == 0)
+  if (!changed)
   {
     return node;
   }
-  else if (node.kind() == Kind::CONST_ARRAY)
-  {
-    assert(children.size() == 1);
-    return NodeManager::get().mk_const_array(node.type(), children[0]);
-  }
-  else
-  {
-    NodeManager& nm = NodeManager::get();
-    if (node.num_indices() > 0)
-    {
-      return nm.mk_node(node.kind(), children, node.indices());
-    }
-    return nm.mk_node(node.kind(), children);
-  }
+  return rebuild_node(node, {children, num_children});
 }
 
+template Node rebuild_node(const Node& node,
+                           const std::unordered_map<Node, Node>& cache);
+template Node rebuild_node(const Node& node, const NodeIdMap<Node>& cache);
+
 }  // namespace bzla::node::utils
@@ -14,6 +14,8 @@
 #include <unordered_map>
 
 #include "node/node.h"
+#include "node/node_id_map.h"
+#include "util/span.h"
 
 namespace bzla::node::utils {
 
@@ -64,23 +66,26 @@ Node bv1_to_bool(const Node& node);
 Node bool_to_bv1(const Node& node);
 
 /**
- * Rebuild node with same kind and indices but new vector of children.
+ * Rebuild node with same kind and indices but new children.
  *
  * @param node The node to rebuild.
  * @param children The new children of the node.
  * @return Rebuilt node.
  */
-Node rebuild_node(const Node& node, const std::vector<Node>& children);
+Node rebuild_node(const Node& node, util::Span<Node> children);
 
 /**
  * Rebuild node with same kind and indices but new children taken from cache.
  *
+ * Instantiated for std::unordered_map<Node, Node> and NodeIdMap<Node>.
+ *
  * @param node The node to rebuild.
- * @param cache The node cache for children.
+ * @param cache The node cache for children, maps each child of `node` to its
+ *              new child.
  * @return Rebuilt node.
  */
-Node rebuild_node(const Node& node,
-                  const std::unordered_map<Node, Node>& cache);
+template <class Cache, class = typename Cache::mapped_type>
+Node rebuild_node(const Node& node, const Cache& cache);
 }
 
 #endif
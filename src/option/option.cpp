@@ -120,6 +120,34 @@ Options::Options()
                 "verbose",
                 "v"),
       // Bitwuzla-specific
+      aig_opt_level(this,
+                    Option::AIG_OPT_LEVEL,
+                    AIG_OPT_LEVEL_MAX,
+                    0,
+                    AIG_OPT_LEVEL_MAX,
+                    "optimization level of two-level AIG rewriting",
+                    "aig-opt-level"),
+      aig_rewrite(this,
+                  Option::AIG_REWRITE,
+                  false,
+                  "AIG balancing and rewriting before CNF encoding",
+                  "aig-rewrite"),
+      aig_rewrite_max_ands(this,
+                           Option::AIG_REWRITE_MAX_ANDS,
+                           0,
+                           0,
+                           UINT64_MAX,
+                           "maximum number of AND gates processed by AIG "
+                           "rewriting (0 for no limit)",
+                           "aig-rewrite-max-ands"),
+      aig_rewrite_time_limit(this,
+                             Option::AIG_REWRITE_TIME_LIMIT,
+                             0,
+                             0,
+                             UINT64_MAX,
+                             "time limit in milliseconds for AIG rewriting "
+                             "(0 for no limit)",
+                             "aig-rewrite-time-limit"),
       bv_solver(this,
                 Option::BV_SOLVER,
                 BvSolver::BITBLAST,
@@ -128,6 +156,22 @@ Options::Options()
                  {BvSolver::PREPROP, "preprop"}},
                 "bv solver engine",
                 "bv-solver"),
+      div_encoding(this,
+                   Option::DIV_ENCODING,
+                   DivEncoding::RESTORING,
+                   {{DivEncoding::RESTORING, "restoring"},
+                    {DivEncoding::NON_RESTORING, "non-restoring"}},
+                   "bit-blasting encoding of unsigned division and remainder",
+                   "div-encoding"),
+      mul_encoding(this,
+                   Option::MUL_ENCODING,
+                   MulEncoding::ARRAY,
+                   {{MulEncoding::ARRAY, "array"},
+                    {MulEncoding::DADDA, "dadda"},
+                    {MulEncoding::KARATSUBA, "karatsuba"},
+                    {MulEncoding::AUTO, "auto"}},
+                   "bit-blasting encoding of multiplication",
+                   "mul-encoding"),
       sat_solver(this,
                  Option::SAT_SOLVER,
                  SatSolver::CADICAL,
@@ -538,7 +582,13 @@ Options::data(Option opt)
     case Option::SEED: return &seed;
     case Option::VERBOSITY: return &verbosity;
 
+    case Option::AIG_OPT_LEVEL: return &aig_opt_level;
+    case Option::AIG_REWRITE: return &aig_rewrite;
+    case Option::AIG_REWRITE_MAX_ANDS: return &aig_rewrite_max_ands;
+    case Option::AIG_REWRITE_TIME_LIMIT: return &aig_rewrite_time_limit;
     case Option::BV_SOLVER: return &bv_solver;
+    case Option::DIV_ENCODING: return &div_encoding;
+    case Option::MUL_ENCODING: return &mul_encoding;
     case Option::REWRITE_LEVEL: return &rewrite_level;
     case Option::SMT_COMP_MODE: return &smt_comp_mode;
 
@@ -32,9 +32,15 @@ enum class Option
   SEED,                       // numeric
   VERBOSITY,                  // numeric
 
-  BV_SOLVER,      // enum
-  REWRITE_LEVEL,  // numeric
-  SMT_COMP_MODE,  // bool
+  AIG_OPT_LEVEL,           // numeric
+  AIG_REWRITE,             // bool
+  AIG_REWRITE_MAX_ANDS,    // numeric
+  AIG_REWRITE_TIME_LIMIT,  // numeric
+  BV_SOLVER,               // enum
+  DIV_ENCODING,            // enum
+  MUL_ENCODING,            // enum
+  REWRITE_LEVEL,           // numeric
+  SMT_COMP_MODE,           // bool
 
   PROP_NPROPS,                  // numeric
   PROP_NUPDATES,                // numeric
@@ -77,6 +83,20 @@ enum class BvSolver
   PREPROP,
 };
 
+enum class DivEncoding
+{
+  RESTORING,
+  NON_RESTORING,
+};
+
+enum class MulEncoding
+{
+  ARRAY,
+  DADDA,
+  KARATSUBA,
+  AUTO,
+};
+
 enum class SatSolver
 {
   CADICAL,
@@ -403,6 +423,7 @@ class Options
  public:
   static constexpr uint8_t VERBOSITY_MAX     = 4;
   static constexpr uint8_t REWRITE_LEVEL_MAX = 2;
+  static constexpr uint8_t AIG_OPT_LEVEL_MAX = 4;
   static constexpr uint64_t PROB_100      = 1000;
   static constexpr uint64_t PROB_50       = 500;
 
@@ -418,7 +439,13 @@ class Options
   OptionNumeric verbosity;
 
   // Bitwuzla-specific options
+  OptionNumeric aig_opt_level;
+  OptionBool aig_rewrite;
+  OptionNumeric aig_rewrite_max_ands;
+  OptionNumeric aig_rewrite_time_limit;
   OptionModeT<BvSolver> bv_solver;
+  OptionModeT<DivEncoding> div_encoding;
+  OptionModeT<MulEncoding> mul_encoding;
   OptionModeT<SatSolver> sat_solver;
   OptionNumeric rewrite_level;
   OptionBool smt_comp_mode;
@@ -0,0 +1,554 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "parser/binary/parser.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "bv/bitvector.h"
+#include "node/node_manager.h"
+#include "printer/binary_printer.h"
+#include "solver/fp/floating_point.h"
+#include "solver/fp/rounding_mode.h"
+
+namespace bzla {
+namespace parser::binary {
+
+using namespace node;
+
+/* Parser public ------------------------------------------------------------ */
+
+Parser::Parser(bitwuzla::Options& options, const std::string& infile_name)
+    : bzla::parser::Parser(options, infile_name)
+{
+  init_bitwuzla();
+}
+
+Parser::Parser(bitwuzla::Options& options,
+               const std::string& infile_name,
+               FILE* infile)
+    : bzla::parser::Parser(options, infile_name, infile)
+{
+  init_bitwuzla();
+}
+
+Parser::~Parser()
+{
+  if (d_mapped)
+  {
+    munmap(d_mapped, d_mapped_size);
+  }
+}
+
+std::string
+Parser::parse(bool parse_only)
+{
+  (void) parse_only;
+
+  util::Timer timer(d_statistics.time_parse);
+
+  Log(2) << "parse " << d_infile_name;
+
+  if (!d_error.empty())
+  {
+    return d_error;
+  }
+  if (!load())
+  {
+    return d_error;
+  }
+
+  uint64_t magic, version, num_types, num_nodes, num_assertions;
+  if (!read_word(magic) || !read_word(version))
+  {
+    return d_error;
+  }
+  if (magic != BinaryPrinter::s_magic)
+  {
+    error("invalid binary snapshot");
+    return d_error;
+  }
+  if (version != BinaryPrinter::s_version)
+  {
+    error("unsupported binary snapshot version " + std::to_string(version));
+    return d_error;
+  }
+  if (!read_word(num_types) || !read_word(num_nodes)
+      || !read_word(num_assertions))
+  {
+    return d_error;
+  }
+  // Each type and node record is at least one word, each assertion two.
+  uint64_t num_left = d_num_words - d_pos;
+  if (num_types > num_left || num_nodes > num_left
+      || num_assertions > num_left / 2)
+  {
+    error("unexpected end of file");
+    return d_error;
+  }
+
+  d_types.reserve(num_types);
+  for (uint64_t i = 0; i < num_types; ++i)
+  {
+    if (!parse_type())
+    {
+      return d_error;
+    }
+  }
+
+  NodeManager::get().reserve(num_nodes);
+  d_nodes.reserve(num_nodes);
+  for (uint64_t i = 0; i < num_nodes && !terminate(); ++i)
+  {
+    if (!parse_node())
+    {
+      return d_error;
+    }
+  }
+  d_statistics.num_nodes = d_nodes.size();
+
+  for (uint64_t i = 0; i < num_assertions && !terminate(); ++i)
+  {
+    if (!parse_assertion(num_assertions - i))
+    {
+      return d_error;
+    }
+  }
+  d_done = true;
+
+  Msg(1) << "parsed " << d_statistics.num_nodes << " nodes in "
+         << ((double) d_statistics.time_parse.elapsed() / 1000) << " seconds";
+  return d_error;
+}
+
+/* Parser private ----------------------------------------------------------- */
+
+bool
+Parser::load()
+{
+  int fd = fileno(d_infile);
+  struct stat st;
+  if (fd >= 0 && fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+  {
+    size_t size = static_cast<size_t>(st.st_size);
+    void* addr  = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr != MAP_FAILED)
+    {
+      madvise(addr, size, MADV_SEQUENTIAL);
+      d_mapped      = addr;
+      d_mapped_size = size;
+      d_words       = static_cast<const uint64_t*>(addr);
+      d_num_words   = size / sizeof(uint64_t);
+      if (size % sizeof(uint64_t))
+      {
+        return error("invalid binary snapshot size");
+      }
+      return true;
+    }
+  }
+
+  // Fall back to reading the input file, e.g., if reading from stdin.
+  std::vector<char> bytes;
+  char chunk[1 << 16];
+  size_t n;
+  while ((n = std::fread(chunk, 1, sizeof(chunk), d_infile)) > 0)
+  {
+    bytes.insert(bytes.end(), chunk, chunk + n);
+  }
+  if (bytes.size() % sizeof(uint64_t))
+  {
+    return error("invalid binary snapshot size");
+  }
+  d_buffer.resize(bytes.size() / sizeof(uint64_t));
+  std::memcpy(d_buffer.data(), bytes.data(), bytes.size());
+  d_words     = d_buffer.data();
+  d_num_words = d_buffer.size();
+  return true;
+}
+
+bool
+Parser::read_word(uint64_t& res)
+{
+  if (d_pos >= d_num_words)
+  {
+    return error("unexpected end of file");
+  }
+  res = d_words[d_pos++];
+  return true;
+}
+
+bool
+Parser::read_symbol(std::optional<std::string>& res)
+{
+  uint64_t has_symbol, size;
+  if (!read_word(has_symbol))
+  {
+    return false;
+  }
+  if (has_symbol > 1)
+  {
+    return error("invalid symbol flag");
+  }
+  if (!has_symbol)
+  {
+    res = std::nullopt;
+    return true;
+  }
+  if (!read_word(size))
+  {
+    return false;
+  }
+  uint64_t num_words = size / sizeof(uint64_t) + (size % sizeof(uint64_t) > 0);
+  if (num_words > d_num_words - d_pos)
+  {
+    return error("unexpected end of file");
+  }
+  res.emplace(reinterpret_cast<const char*>(d_words + d_pos), size);
+  d_pos += num_words;
+  return true;
+}
+
+bool
+Parser::read_bv(uint64_t size, BitVector& res)
+{
+  uint64_t num_words = size / 64 + (size % 64 > 0);
+  if (num_words > d_num_words - d_pos)
+  {
+    return error("unexpected end of file");
+  }
+  const uint64_t* words = d_words + d_pos;
+  if (size % 64 > 0 && (words[num_words - 1] >> (size % 64)) != 0)
+  {
+    return error("value exceeds bit-vector size");
+  }
+  res = BitVector::from_limbs(size, words);
+  d_pos += num_words;
+  return true;
+}
+
+bool
+Parser::read_type_ref(Type& res)
+{
+  uint64_t pos;
+  if (!read_word(pos))
+  {
+    return false;
+  }
+  if (pos >= d_types.size())
+  {
+    return error("invalid type reference " + std::to_string(pos));
+  }
+  res = d_types[pos];
+  return true;
+}
+
+bool
+Parser::read_node_ref(Node& res)
+{
+  uint64_t pos;
+  if (!read_word(pos))
+  {
+    return false;
+  }
+  if (pos >= d_nodes.size())
+  {
+    return error("invalid node reference " + std::to_string(pos));
+  }
+  res = d_nodes[pos];
+  return true;
+}
+
+bool
+Parser::parse_type()
+{
+  using TypeTag = BinaryPrinter::TypeTag;
+
+  uint64_t tag;
+  if (!read_word(tag))
+  {
+    return false;
+  }
+  if (tag >= static_cast<uint64_t>(TypeTag::NUM_TAGS))
+  {
+    return error("invalid type tag " + std::to_string(tag));
+  }
+
+  NodeManager& nm = NodeManager::get();
+  switch (static_cast<TypeTag>(tag))
+  {
+    case TypeTag::BOOL: d_types.push_back(nm.mk_bool_type()); break;
+
+    case TypeTag::BV: {
+      uint64_t size;
+      if (!read_word(size))
+      {
+        return false;
+      }
+      if (size == 0)
+      {
+        return error("invalid bit-vector type size");
+      }
+      d_types.push_back(nm.mk_bv_type(size));
+    }
+    break;
+
+    case TypeTag::FP: {
+      uint64_t exp_size, sig_size;
+      if (!read_word(exp_size) || !read_word(sig_size))
+      {
+        return false;
+      }
+      if (exp_size < 2 || sig_size < 2)
+      {
+        return error("invalid floating-point type size");
+      }
+      d_types.push_back(nm.mk_fp_type(exp_size, sig_size));
+    }
+    break;
+
+    case TypeTag::RM: d_types.push_back(nm.mk_rm_type()); break;
+
+    case TypeTag::ARRAY: {
+      Type index, element;
+      if (!read_type_ref(index) || !read_type_ref(element))
+      {
+        return false;
+      }
+      d_types.push_back(nm.mk_array_type(index, element));
+    }
+    break;
+
+    case TypeTag::FUN: {
+      uint64_t size;
+      if (!read_word(size))
+      {
+        return false;
+      }
+      if (size < 2 || size > d_num_words - d_pos)
+      {
+        return error("invalid function type arity");
+      }
+      std::vector<Type> types(size);
+      for (Type& type : types)
+      {
+        if (!read_type_ref(type))
+        {
+          return false;
+        }
+      }
+      d_types.push_back(nm.mk_fun_type(types));
+    }
+    break;
+
+    case TypeTag::UNINTERPRETED: {
+      std::optional<std::string> symbol;
+      if (!read_symbol(symbol))
+      {
+        return false;
+      }
+      d_types.push_back(nm.mk_uninterpreted_type(symbol));
+    }
+    break;
+
+    case TypeTag::NUM_TAGS: assert(false); break;
+  }
+  return true;
+}
+
+bool
+Parser::parse_node()
+{
+  uint64_t k;
+  if (!read_word(k))
+  {
+    return false;
+  }
+  if (k == static_cast<uint64_t>(Kind::NULL_NODE)
+      || k >= static_cast<uint64_t>(Kind::NUM_KINDS))
+  {
+    return error("invalid node kind " + std::to_string(k));
+  }
+
+  NodeManager& nm = NodeManager::get();
+  Kind kind       = static_cast<Kind>(k);
+  if (kind == Kind::CONSTANT || kind == Kind::VARIABLE)
+  {
+    Type type;
+    std::optional<std::string> symbol;
+    if (!read_type_ref(type) || !read_symbol(symbol))
+    {
+      return false;
+    }
+    d_nodes.push_back(kind == Kind::CONSTANT ? nm.mk_const(type, symbol)
+                                             : nm.mk_var(type, symbol));
+  }
+  else if (kind == Kind::VALUE)
+  {
+    Type type;
+    if (!read_type_ref(type))
+    {
+      return false;
+    }
+    if (type.is_bool() || type.is_rm())
+    {
+      uint64_t value;
+      if (!read_word(value))
+      {
+        return false;
+      }
+      if (type.is_bool())
+      {
+        if (value > 1)
+        {
+          return error("invalid Boolean value");
+        }
+        d_nodes.push_back(nm.mk_value(value == 1));
+      }
+      else
+      {
+        if (value >= static_cast<uint64_t>(RoundingMode::NUM_RM))
+        {
+          return error("invalid rounding mode value");
+        }
+        d_nodes.push_back(nm.mk_value(static_cast<RoundingMode>(value)));
+      }
+    }
+    else if (type.is_bv())
+    {
+      BitVector value;
+      if (!read_bv(type.bv_size(), value))
+      {
+        return false;
+      }
+      d_nodes.push_back(nm.mk_value(value));
+    }
+    else if (type.is_fp())
+    {
+      BitVector value;
+      if (!read_bv(type.fp_exp_size() + type.fp_sig_size(), value))
+      {
+        return false;
+      }
+      d_nodes.push_back(nm.mk_value(FloatingPoint(type, value)));
+    }
+    else
+    {
+      return error("invalid value type");
+    }
+  }
+  else if (kind == Kind::CONST_ARRAY)
+  {
+    Type type;
+    Node element;
+    if (!read_type_ref(type) || !read_node_ref(element))
+    {
+      return false;
+    }
+    if (!type.is_array() || type.array_element() != element.type())
+    {
+      return error("invalid constant array type");
+    }
+    d_nodes.push_back(nm.mk_const_array(type, element));
+  }
+  else
+  {
+    uint64_t num_children, num_indices;
+    if (!read_word(num_children) || !read_word(num_indices))
+    {
+      return false;
+    }
+    if (num_children + num_indices > d_num_words - d_pos
+        || num_children + num_indices < num_children)
+    {
+      return error("unexpected end of file");
+    }
+    d_children.resize(num_children);
+    for (Node& child : d_children)
+    {
+      if (!read_node_ref(child))
+      {
+        return false;
+      }
+    }
+    d_indices.resize(num_indices);
+    for (uint64_t& index : d_indices)
+    {
+      if (!read_word(index))
+      {
+        return false;
+      }
+    }
+    auto [ok, msg] = nm.check_type(kind, d_children, d_indices);
+    if (!ok)
+    {
+      return error(msg);
+    }
+    d_nodes.push_back(nm.mk_node(kind, d_children, d_indices));
+  }
+  return true;
+}
+
+bool
+Parser::parse_assertion(uint64_t num_left)
+{
+  uint64_t level;
+  Node node;
+  if (!read_word(level) || !read_node_ref(node))
+  {
+    return false;
+  }
+  if (level < d_level)
+  {
+    return error("assertion levels must be non-decreasing");
+  }
+  if (!node.type().is_bool())
+  {
+    return error("expected Boolean assertion");
+  }
+  if (level - d_level > num_left)
+  {
+    return error("invalid assertion level " + std::to_string(level));
+  }
+  if (level > d_level)
+  {
+    d_bitwuzla->push(level - d_level);
+    d_level = level;
+  }
+  d_bitwuzla->assert_formula(bitwuzla::Term(node));
+  ++d_statistics.num_assertions;
+  return true;
+}
+
+bool
+Parser::error(const std::string& error_msg)
+{
+  d_error = d_infile_name + ": " + error_msg;
+  return false;
+}
+
+/* Parser::Statistics ------------------------------------------------------- */
+
+Parser::Statistics::Statistics()
+    : num_nodes(d_stats.new_stat<uint64_t>("parser::binary::num_nodes")),
+      num_assertions(
+          d_stats.new_stat<uint64_t>("parser::binary::num_assertions")),
+      time_parse(
+          d_stats.new_stat<util::TimerStatistic>("parser::binary::time_parse"))
+{
+}
+
+/* -------------------------------------------------------------------------- */
+
+}  // namespace parser::binary
+}  // namespace bzla
@@ -0,0 +1,135 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_PARSER_BINARY_PARSER_H_INCLUDED
+#define BZLA_PARSER_BINARY_PARSER_H_INCLUDED
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "node/node.h"
+#include "parser/parser.h"
+#include "type/type.h"
+
+namespace bzla {
+
+class BitVector;
+
+namespace parser::binary {
+
+/**
+ * Parser for binary DAG snapshots as printed by BinaryPrinter.
+ *
+ * The input file is memory-mapped if possible (and read into a buffer
+ * otherwise, e.g., when reading from stdin). Nodes are directly created via
+ * the node manager in the order they are stored in the snapshot, which
+ * avoids any lexing and symbol resolution overhead.
+ */
+class Parser : public bzla::parser::Parser
+{
+ public:
+  /**
+   * Constructor.
+   * @param options The associated Bitwuzla options. Parser creates Bitwuzla
+   *                instance from these options.
+   * @param infile_name The name of the input file.
+   */
+  Parser(bitwuzla::Options& options, const std::string& infile_name);
+  /**
+   * Constructor.
+   * @param options The associated Bitwuzla options. Parser creates Bitwuzla
+   *                instance from these options.
+   * @param infile_name The name of the input file.
+   * @param infile      The input file.
+   */
+  Parser(bitwuzla::Options& options,
+         const std::string& infile_name,
+         FILE* infile);
+  /** Destructor. */
+  ~Parser();
+  /**
+   * Parse input file.
+   * @param parse_only Unused, snapshots do not contain any commands.
+   */
+  std::string parse(bool parse_only) override;
+
+ private:
+  /**
+   * Map the input file into memory, or read it into d_buffer if it can not be
+   * mapped.
+   * @return False on error.
+   */
+  bool load();
+
+  bool read_word(uint64_t& res);
+  bool read_symbol(std::optional<std::string>& res);
+  bool read_bv(uint64_t size, BitVector& res);
+  bool read_type_ref(Type& res);
+  bool read_node_ref(Node& res);
+
+  bool parse_type();
+  bool parse_node();
+  /**
+   * Parse an assertion record.
+   * @param num_left The number of assertion records left, including this
+   *                 one. Bounds the increment of the assertion level.
+   */
+  bool parse_assertion(uint64_t num_left);
+
+  bool error(const std::string& error_msg);
+
+  /** The words of the snapshot. */
+  const uint64_t* d_words = nullptr;
+  /** The number of words of the snapshot. */
+  size_t d_num_words = 0;
+  /** The position of the next word to read. */
+  size_t d_pos = 0;
+
+  /** The memory-mapped input file, nullptr if not mapped. */
+  void* d_mapped = nullptr;
+  /** The size of the memory-mapped input file in bytes. */
+  size_t d_mapped_size = 0;
+  /** The input file contents if the input file can not be mapped. */
+  std::vector<uint64_t> d_buffer;
+
+  /** The types of the type table. */
+  std::vector<Type> d_types;
+  /** The nodes of the node table. */
+  std::vector<Node> d_nodes;
+  /** Buffer for the children of the current node. */
+  std::vector<Node> d_children;
+  /** Buffer for the indices of the current node. */
+  std::vector<uint64_t> d_indices;
+  /** The current assertion level. */
+  uint64_t d_level = 0;
+
+  /** Parse statistics. */
+  struct Statistics
+  {
+    Statistics();
+
+    util::Statistics d_stats;
+
+    /** The number of loaded nodes. */
+    uint64_t& num_nodes;
+    /** The number of loaded assertions. */
+    uint64_t& num_assertions;
+
+    /** The time required for parsing. */
+    util::TimerStatistic& time_parse;
+
+  } d_statistics;
+};
+
+}  // namespace parser::binary
+}  // namespace bzla
+
+#endif
@@ -12,6 +12,8 @@
 
 #include <cassert>
 
+#include "node/node_manager.h"
+
 namespace bzla {
 namespace parser::smt2 {
 
@@ -19,12 +21,15 @@ SymbolTable::Node::Node(Token token,
                         const std::string& symbol,
                         uint64_t assertion_level)
     : d_token(token),
-      d_symbol(symbol),
+      d_handle(NodeManager::get().symbols().intern(symbol)),
+      d_symbol(NodeManager::get().symbols().get(d_handle)),
       d_assertion_level(assertion_level),
       d_coo({0, 0})
 {
 }
 
+SymbolTable::Node::~Node() { NodeManager::get().symbols().release(d_handle); }
+
 SymbolTable::SymbolTable()
 {
   init_reserved_words();
@@ -33,6 +38,16 @@ SymbolTable::SymbolTable()
   init_core_symbols();
 }
 
+SymbolTable::~SymbolTable() { clear(); }
+
+SymbolTable&
+SymbolTable::operator=(SymbolTable&& other)
+{
+  clear();
+  d_table.swap(other.d_table);
+  return *this;
+}
+
 bool
 SymbolTable::Node::has_symbol() const
 {
@@ -45,7 +60,7 @@ SymbolTable::insert(Token token,
                     uint64_t assertion_level)
 {
   Node* node          = new Node(token, symbol, assertion_level);
-  auto [it, inserted] = d_table.emplace(symbol, node);
+  auto [it, inserted] = d_table.emplace(node->d_symbol, node);
   if (!inserted)
   {
     node->d_next = it->second;
@@ -68,34 +83,36 @@ SymbolTable::remove(const std::string& symbol)
   Node* n = it->second;
   assert(n->d_symbol == symbol);
   it->second = n->d_next;
-  delete n;
+  // The key refers to the symbol of the last node in the chain, erase it
+  // before the symbol is released.
   if (!it->second)
   {
     d_table.erase(it);
   }
+  delete n;
 }
 
 void
 SymbolTable::pop_level(uint64_t assertion_level)
 {
-  std::vector<std::string> erase;
-  for (auto& p : d_table)
+  for (auto it = d_table.begin(); it != d_table.end();)
   {
-    assert(p.second);
-    while (p.second && p.second->d_assertion_level >= assertion_level)
+    assert(it->second);
+    while (it->second && it->second->d_assertion_level >= assertion_level)
     {
-      Node* n  = p.second;
-      p.second = n->d_next;
+      Node* n    = it->second;
+      it->second = n->d_next;
       delete n;
     }
-    if (!p.second)
+    // Erasing by iterator does not access the (possibly released) key.
+    if (!it->second)
     {
-      erase.push_back(p.first);
+      it = d_table.erase(it);
+    }
+    else
+    {
+      ++it;
     }
-  }
-  for (auto& s : erase)
-  {
-    d_table.erase(s);
   }
 }
 
@@ -113,8 +130,23 @@ SymbolTable::find(const std::string& symbol) const
 
 /* SymbolTable private ------------------------------------------------------ */
 
+void
+SymbolTable::clear()
+{
+  for (auto& p : d_table)
+  {
+    for (Node* n = p.second; n;)
+    {
+      Node* next = n->d_next;
+      delete n;
+      n = next;
+    }
+  }
+  d_table.clear();
+}
+
 std::size_t
-SymbolTable::SymbolHash::operator()(const std::string& s) const
+SymbolTable::SymbolHash::operator()(std::string_view s) const
 {
   size_t res  = 0;
   size_t pos  = 0;
@@ -138,8 +170,8 @@ SymbolTable::SymbolHash::operator()(const std::string& s) const
 }
 
 bool
-SymbolTable::SymbolEqual::operator()(const std::string& lhs,
-                                     const std::string& rhs) const
+SymbolTable::SymbolEqual::operator()(std::string_view lhs,
+                                     std::string_view rhs) const
 {
   size_t lhs_max = lhs.size() - 1;
   if (lhs[0] == '|' && lhs[lhs_max] == '|' && rhs[0] != '|')
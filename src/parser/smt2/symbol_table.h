@@ -12,9 +12,11 @@
 #define BZLA_PARSER_SMT2_SYMBOL_TABLE_H_INCLUDED
 
 #include <array>
+#include <string_view>
 
 #include "bitwuzla/cpp/bitwuzla.h"
 #include "parser/smt2/lexer.h"
+#include "util/string_interner.h"
 
 namespace bzla {
 namespace parser::smt2 {
@@ -32,12 +34,21 @@ class SymbolTable
      * @param assertion_level The assertion level (push/pop) of the symbol.
      */
     Node(Token token, const std::string& symbol, uint64_t assertion_level);
+    /** Destructor, releases the interned symbol. */
+    ~Node();
+    Node(const Node&)            = delete;
+    Node& operator=(const Node&) = delete;
     /** @return True if the symbol is non-empty() (for dbg purposes). */
     bool has_symbol() const;
     /** The token of the symbol. Serves as a kind. */
     Token d_token;
-    /** The string representation of the symbol. */
-    std::string d_symbol;
+    /** The handle of the symbol in the interned symbols of the node manager. */
+    util::StringInterner::Handle d_handle;
+    /**
+     * The string representation of the symbol. Refers to the interned symbol
+     * storage, which is shared with the symbols of the created terms.
+     */
+    const std::string& d_symbol;
     /** The assertion level of the symbol. */
     uint64_t d_assertion_level;
     /** The coordinate (in the input file) of the symbol. */
@@ -63,6 +74,12 @@ class SymbolTable
 
   /** Constructor. */
   SymbolTable();
+  /** Destructor. */
+  ~SymbolTable();
+  SymbolTable(const SymbolTable&)            = delete;
+  SymbolTable& operator=(const SymbolTable&) = delete;
+  /** Move assignment, removes all symbols of this table. */
+  SymbolTable& operator=(SymbolTable&& other);
 
   /**
    * Find a given symbol in the symbol table.
@@ -125,7 +142,7 @@ class SymbolTable
    */
   struct SymbolHash
   {
-    std::size_t operator()(const std::string& s) const;
+    std::size_t operator()(std::string_view s) const;
   };
   /**
    * The comparator for symbol strings.
@@ -133,7 +150,7 @@ class SymbolTable
    */
   struct SymbolEqual
   {
-    bool operator()(const std::string& lhs, const std::string& rhs) const;
+    bool operator()(std::string_view lhs, std::string_view rhs) const;
   };
 
   /** Insert symbol node for given token. */
@@ -146,14 +163,19 @@ class SymbolTable
   void init_keywords();
   /** Add core theory symbols to table. */
   void init_core_symbols();
+  /** Remove all symbols. */
+  void clear();
 
   /**
    * The symbol table. Maps the string representation of the symbol to a
    * symbol node (chain). Shadowed symbols are represented as a node chain,
    * where the first node is the currently declared symbol, and a shadowed
    * symbol is linked via Node::d_next.
+   *
+   * The keys refer to the symbol of the last node of the chain, which is the
+   * last node to be removed from the chain.
    */
-  std::unordered_map<std::string, Node*, SymbolHash, SymbolEqual> d_table;
+  std::unordered_map<std::string_view, Node*, SymbolHash, SymbolEqual> d_table;
 };
 
 }  // namespace parser::smt2
@@ -14,6 +14,7 @@
 #include "node/node_manager.h"
 #include "node/node_ref_vector.h"
 #include "node/unordered_node_ref_map.h"
+#include "util/memory.h"
 
 namespace bzla::preprocess::pass {
 
@@ -161,6 +162,13 @@ PassContradictingAnds::process(const Node& node)
   return res;
 }
 
+size_t
+PassContradictingAnds::memory_usage() const
+{
+  return PreprocessingPass::memory_usage() + d_substitutions.memory_usage()
+         + util::memory_usage(d_cache);
+}
+
 /* --- PassContradictingAnds pricate----------------------------------------- */
 
 PassContradictingAnds::Statistics::Statistics(util::Statistics& stats)
@@ -28,6 +28,7 @@ class PassContradictingAnds : public PreprocessingPass
 
   void apply(AssertionVector& assertions) override;
   Node process(const Node& node) override;
+  size_t memory_usage() const override;
 
  private:
   /**
@@ -18,6 +18,7 @@
 #include "node/node_utils.h"
 #include "node/unordered_node_ref_map.h"
 #include "node/unordered_node_ref_set.h"
+#include "util/memory.h"
 
 namespace {
 /**
@@ -134,6 +135,12 @@ PassElimExtract::process(const Node& term)
   return term;
 }
 
+size_t
+PassElimExtract::memory_usage() const
+{
+  return PreprocessingPass::memory_usage() + util::memory_usage(d_cache);
+}
+
 /* --- PassElimExtract private -----------------------------------------------
  */
 
@@ -29,6 +29,7 @@ class PassElimExtract : public PreprocessingPass
   void apply(AssertionVector& assertions) override;
 
   Node process(const Node& term) override;
+  size_t memory_usage() const override;
 
  private:
   std::unordered_set<Node> d_cache;
@@ -15,6 +15,7 @@
 #include "node/node_ref_vector.h"
 #include "node/node_utils.h"
 #include "node/unordered_node_ref_map.h"
+#include "util/memory.h"
 
 namespace bzla::preprocess::pass {
 
@@ -89,6 +90,12 @@ PassElimLambda::process(const Node& term)
   return d_cache.at(term);
 }
 
+size_t
+PassElimLambda::memory_usage() const
+{
+  return PreprocessingPass::memory_usage() + util::memory_usage(d_cache);
+}
+
 /* --- PassElimLambda private ----------------------------------------------- */
 
 Node
@@ -29,6 +29,7 @@ class PassElimLambda : public PreprocessingPass
   void apply(AssertionVector& assertions) override;
 
   Node process(const Node& term) override;
+  size_t memory_usage() const override;
 
  private:
   Node reduce(const Node& node) const;
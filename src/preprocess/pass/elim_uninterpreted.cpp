@@ -16,6 +16,7 @@
 #include "node/node_manager.h"
 #include "node/node_ref_vector.h"
 #include "node/unordered_node_ref_set.h"
+#include "util/memory.h"
 
 namespace bzla::preprocess::pass {
 
@@ -199,6 +200,13 @@ PassElimUninterpreted::process(const Node& node)
   return res;
 }
 
+size_t
+PassElimUninterpreted::memory_usage() const
+{
+  return PreprocessingPass::memory_usage() + d_substitutions.memory_usage()
+         + util::memory_usage(d_cache);
+}
+
 /* --- PassEmbeddedConstraints private -------------------------------------- */
 
 PassElimUninterpreted::Statistics::Statistics(util::Statistics& stats)
@@ -27,6 +27,7 @@ class PassElimUninterpreted : public PreprocessingPass
 
   void apply(AssertionVector& assertions) override;
   Node process(const Node& node) override;
+  size_t memory_usage() const override;
 
  private:
   /** Backtrackable substitution map. */
@@ -13,6 +13,7 @@
 #include "env.h"
 #include "node/node_manager.h"
 #include "node/node_ref_vector.h"
+#include "util/memory.h"
 
 namespace bzla::preprocess::pass {
 
@@ -101,6 +102,13 @@ PassEmbeddedConstraints::process(const Node& node)
   return res;
 }
 
+size_t
+PassEmbeddedConstraints::memory_usage() const
+{
+  return PreprocessingPass::memory_usage() + d_substitutions.memory_usage()
+         + util::memory_usage(d_cache);
+}
+
 /* --- PassEmbeddedConstraints private -------------------------------------- */
 
 PassEmbeddedConstraints::Statistics::Statistics(util::Statistics& stats)
@@ -19,6 +19,7 @@
 #include "node/unordered_node_ref_map.h"
 #include "node/unordered_node_ref_set.h"
 #include "util/logger.h"
+#include "util/memory.h"
 
 namespace bzla::preprocess::pass {
 
@@ -1201,6 +1202,15 @@ PassNormalize::process(const Node& node)
   return d_env.rewriter().rewrite(it->second);
 }
 
+size_t
+PassNormalize::memory_usage() const
+{
+  return PreprocessingPass::memory_usage() + d_cache.memory_usage()
+         + util::memory_usage(d_parents_cache)
+         + util::memory_usage(d_adder_chains)
+         + util::memory_usage(d_adder_chains_cache);
+}
+
 /* --- PassNormalize private ------------------------------------------------ */
 
 PassNormalize::Statistics::Statistics(util::Statistics& stats)
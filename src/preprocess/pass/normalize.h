@@ -14,6 +14,7 @@
 #include <unordered_map>
 
 #include "backtrack/unordered_map.h"
+#include "node/node_id_map.h"
 #include "preprocess/preprocessing_pass.h"
 #include "util/statistics.h"
 
@@ -29,6 +30,7 @@ class PassNormalize : public PreprocessingPass
 
   void apply(AssertionVector& assertions) override;
   Node process(const Node& node) override;
+  size_t memory_usage() const override;
 
  private:
   /**
@@ -215,7 +217,7 @@ class PassNormalize : public PreprocessingPass
    * Cache of processed nodes that maybe shared across substitutions.
    * Clear after a call to process to avoid sharing.
    */
-  std::unordered_map<Node, Node> d_cache;
+  node::NodeIdMap<Node> d_cache;
 
   /**
    * Cache of parents count for currently reachable nodes, populated for the
@@ -19,6 +19,7 @@
 #include "node/unordered_node_ref_set.h"
 #include "rewrite/rewriter.h"
 #include "util/logger.h"
+#include "util/memory.h"
 
 namespace bzla::preprocess::pass {
 
@@ -622,6 +623,15 @@ PassVariableSubstitution::substitution_assertion(const Node& var) const
   return it->second.second;
 }
 
+size_t
+PassVariableSubstitution::memory_usage() const
+{
+  return PreprocessingPass::memory_usage() + d_substitutions.memory_usage()
+         + d_substitution_assertions.memory_usage()
+         + d_first_seen.memory_usage() + d_first_seen_cache.memory_usage()
+         + d_cache.memory_usage();
+}
+
 /* --- PassVariableSubstitution private ------------------------------------- */
 
 void
@@ -902,4 +912,19 @@ PassVariableSubstitution::Cache::cache()
   return d_cache.back();
 }
 
+size_t
+PassVariableSubstitution::Cache::memory_usage() const
+{
+  size_t res = util::memory_usage(d_map) + util::memory_usage(d_cache);
+  for (const auto& map : d_map)
+  {
+    res += util::memory_usage(map);
+  }
+  for (const auto& cache : d_cache)
+  {
+    res += util::memory_usage(cache);
+  }
+  return res;
+}
+
 }  // namespace bzla::preprocess::pass
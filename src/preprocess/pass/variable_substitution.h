@@ -34,6 +34,8 @@ class PassVariableSubstitution : public PreprocessingPass
   /** Process term and apply currently cached substitutions. */
   Node process(const Node& term) override;
 
+  size_t memory_usage() const override;
+
   /** Get current set of substitutions. */
   const std::unordered_map<Node, Node>& substitutions() const;
 
@@ -104,6 +106,9 @@ class PassVariableSubstitution : public PreprocessingPass
     /** @return Current substitution cache. */
     std::unordered_map<Node, Node>& cache();
 
+    /** @return The number of bytes allocated by all scope levels. */
+    size_t memory_usage() const;
+
    private:
     /** Backtrackable substitution map. One map per scope level. */
     std::vector<std::unordered_map<Node, Node>> d_map;
@@ -15,6 +15,7 @@
 #include "node/node_manager.h"
 #include "node/node_ref_vector.h"
 #include "node/node_utils.h"
+#include "util/memory.h"
 
 namespace bzla::preprocess {
 
@@ -32,6 +33,12 @@ PreprocessingPass::clear_cache()
   d_processed_assertions.clear();
 }
 
+size_t
+PreprocessingPass::memory_usage() const
+{
+  return util::memory_usage(d_processed_assertions);
+}
+
 /* --- PreprocessingPass protected ------------------------------------------ */
 
 void
@@ -57,6 +57,9 @@ class PreprocessingPass
 
   void clear_cache();
 
+  /** @return The number of bytes allocated by the caches of this pass. */
+  virtual size_t memory_usage() const;
+
  protected:
   /**
    * Count number of parents for all nodes reachable from `node`.
@@ -95,6 +95,9 @@ Preprocessor::preprocess()
   // that do not contain any assertions.
   sync_scope(d_global_backtrack_mgr.num_levels());
 
+  d_stats.memory_rewriter = d_env.rewriter().memory_usage();
+  d_stats.memory_passes   = memory_usage_passes();
+
   // Clear rewriter and preprocessing pass caches
   d_env.rewriter().clear_cache();
   d_pass_rewrite.clear_cache();
@@ -326,12 +329,28 @@ Preprocessor::sync_scope(size_t level)
   }
 }
 
+size_t
+Preprocessor::memory_usage_passes() const
+{
+  return d_pass_rewrite.memory_usage() + d_pass_contr_ands.memory_usage()
+         + d_pass_elim_lambda.memory_usage()
+         + d_pass_elim_uninterpreted.memory_usage()
+         + d_pass_embedded_constraints.memory_usage()
+         + d_pass_variable_substitution.memory_usage()
+         + d_pass_flatten_and.memory_usage()
+         + d_pass_skeleton_preproc.memory_usage()
+         + d_pass_normalize.memory_usage() + d_pass_elim_extract.memory_usage();
+}
+
 Preprocessor::Statistics::Statistics(util::Statistics& stats)
     : time_preprocess(
         stats.new_stat<util::TimerStatistic>("preprocessor::time_preprocess")),
       time_process(
           stats.new_stat<util::TimerStatistic>("preprocessor::time_process")),
-      num_iterations(stats.new_stat<uint64_t>("preprocessor::num_iterations"))
+      num_iterations(stats.new_stat<uint64_t>("preprocessor::num_iterations")),
+      memory_rewriter(
+          stats.new_stat<uint64_t>("preprocessor::memory::rewriter_cache")),
+      memory_passes(stats.new_stat<uint64_t>("preprocessor::memory::passes"))
 {
 }
 
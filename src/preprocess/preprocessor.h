@@ -68,6 +68,9 @@ class Preprocessor
   /** Synchronize d_backtrack_mgr up to given level. */
   void sync_scope(size_t level);
 
+  /** @return The number of bytes allocated by the preprocessing passes. */
+  size_t memory_usage_passes() const;
+
   Env& d_env;
   util::Logger& d_logger;
 
@@ -104,6 +107,10 @@ class Preprocessor
     util::TimerStatistic& time_preprocess;
     util::TimerStatistic& time_process;
     uint64_t& num_iterations;
+    /** Memory allocated by the rewriter cache before clearing it. */
+    uint64_t& memory_rewriter;
+    /** Memory allocated by the preprocessing passes before clearing them. */
+    uint64_t& memory_passes;
   } d_stats;
 };
 
@@ -0,0 +1,247 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "printer/binary_printer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "backtrack/assertion_stack.h"
+#include "bv/bitvector.h"
+#include "node/node_id_map.h"
+#include "node/node_ref_vector.h"
+#include "solver/fp/floating_point.h"
+#include "solver/fp/rounding_mode.h"
+
+namespace bzla {
+
+using namespace node;
+
+namespace {
+
+using TypeTag = BinaryPrinter::TypeTag;
+
+/** Write symbol flag, length and characters padded to full words. */
+void
+write_symbol(std::vector<uint64_t>& words, const std::string* symbol)
+{
+  words.push_back(symbol ? 1 : 0);
+  if (symbol)
+  {
+    words.push_back(symbol->size());
+    size_t pos = words.size();
+    words.resize(pos + (symbol->size() + 7) / 8, 0);
+    std::memcpy(words.data() + pos, symbol->data(), symbol->size());
+  }
+}
+
+/** Write bit-vector as ceil(size / 64) words, least significant first. */
+void
+write_bv(std::vector<uint64_t>& words, const BitVector& bv)
+{
+  uint64_t size = bv.size();
+  if (size <= 64)
+  {
+    words.push_back(bv.to_uint64());
+    return;
+  }
+  size_t pos = words.size();
+  words.resize(pos + size / 64 + (size % 64 > 0));
+  bv.to_limbs(words.data() + pos);
+}
+
+/**
+ * Add type and its component types to the type table if not yet added.
+ * @return The position of the type in the type table.
+ */
+uint64_t
+write_type(std::vector<uint64_t>& words,
+           std::unordered_map<Type, uint64_t>& types,
+           const Type& type)
+{
+  auto it = types.find(type);
+  if (it != types.end())
+  {
+    return it->second;
+  }
+
+  if (type.is_bool())
+  {
+    words.push_back(static_cast<uint64_t>(TypeTag::BOOL));
+  }
+  else if (type.is_bv())
+  {
+    words.push_back(static_cast<uint64_t>(TypeTag::BV));
+    words.push_back(type.bv_size());
+  }
+  else if (type.is_fp())
+  {
+    words.push_back(static_cast<uint64_t>(TypeTag::FP));
+    words.push_back(type.fp_exp_size());
+    words.push_back(type.fp_sig_size());
+  }
+  else if (type.is_rm())
+  {
+    words.push_back(static_cast<uint64_t>(TypeTag::RM));
+  }
+  else if (type.is_array())
+  {
+    uint64_t index   = write_type(words, types, type.array_index());
+    uint64_t element = write_type(words, types, type.array_element());
+    words.push_back(static_cast<uint64_t>(TypeTag::ARRAY));
+    words.push_back(index);
+    words.push_back(element);
+  }
+  else if (type.is_fun())
+  {
+    std::vector<uint64_t> fun_types;
+    for (const Type& t : type.fun_types())
+    {
+      fun_types.push_back(write_type(words, types, t));
+    }
+    words.push_back(static_cast<uint64_t>(TypeTag::FUN));
+    words.push_back(fun_types.size());
+    words.insert(words.end(), fun_types.begin(), fun_types.end());
+  }
+  else
+  {
+    assert(type.is_uninterpreted());
+    const auto& symbol = type.uninterpreted_symbol();
+    words.push_back(static_cast<uint64_t>(TypeTag::UNINTERPRETED));
+    write_symbol(words, symbol ? &*symbol : nullptr);
+  }
+
+  uint64_t pos = types.size();
+  types.emplace(type, pos);
+  return pos;
+}
+
+void
+write(std::ostream& os, const std::vector<uint64_t>& words)
+{
+  os.write(reinterpret_cast<const char*>(words.data()),
+           static_cast<std::streamsize>(words.size() * sizeof(uint64_t)));
+}
+
+}  // namespace
+
+/* --- BinaryPrinter public ------------------------------------------------- */
+
+void
+BinaryPrinter::print_formula(std::ostream& os,
+                             const backtrack::AssertionView& assertions)
+{
+  // Collect all nodes, including nodes below binders.
+  std::vector<Node> nodes;
+  NodeIdMap<uint64_t> cache;
+  node_ref_vector visit;
+  for (size_t i = 0, n = assertions.size(); i < n; ++i)
+  {
+    visit.emplace_back(assertions[i]);
+  }
+  while (!visit.empty())
+  {
+    const Node& cur = visit.back();
+    visit.pop_back();
+    if (cache.emplace(cur, 0).second)
+    {
+      nodes.push_back(cur);
+      visit.insert(visit.end(), cur.begin(), cur.end());
+    }
+  }
+
+  // Node ids are topologically ordered.
+  std::sort(nodes.begin(), nodes.end(), [](const Node& a, const Node& b) {
+    return a.id() < b.id();
+  });
+
+  std::vector<uint64_t> type_words, node_words;
+  std::unordered_map<Type, uint64_t> types;
+  for (size_t i = 0, size = nodes.size(); i < size; ++i)
+  {
+    const Node& cur = nodes[i];
+    Kind kind       = cur.kind();
+    cache.at(cur)   = i;
+
+    node_words.push_back(static_cast<uint64_t>(kind));
+    if (kind == Kind::CONSTANT || kind == Kind::VARIABLE)
+    {
+      node_words.push_back(write_type(type_words, types, cur.type()));
+      auto symbol = cur.symbol();
+      write_symbol(node_words, symbol ? &symbol->get() : nullptr);
+    }
+    else if (kind == Kind::VALUE)
+    {
+      const Type& type = cur.type();
+      node_words.push_back(write_type(type_words, types, type));
+      if (type.is_bool())
+      {
+        node_words.push_back(cur.value<bool>());
+      }
+      else if (type.is_bv())
+      {
+        write_bv(node_words, cur.value<BitVector>());
+      }
+      else if (type.is_rm())
+      {
+        node_words.push_back(static_cast<uint64_t>(cur.value<RoundingMode>()));
+      }
+      else
+      {
+        assert(type.is_fp());
+        write_bv(node_words, cur.value<FloatingPoint>().as_bv());
+      }
+    }
+    else if (kind == Kind::CONST_ARRAY)
+    {
+      node_words.push_back(write_type(type_words, types, cur.type()));
+      node_words.push_back(cache.at(cur[0]));
+    }
+    else
+    {
+      node_words.push_back(cur.num_children());
+      node_words.push_back(cur.num_indices());
+      for (const Node& child : cur)
+      {
+        node_words.push_back(cache.at(child));
+      }
+      for (size_t j = 0, n = cur.num_indices(); j < n; ++j)
+      {
+        node_words.push_back(cur.index(j));
+      }
+    }
+  }
+
+  // The parser bounds each level increment by the number of remaining
+  // assertions, empty assertion levels beyond that bound are dropped.
+  size_t prev_level = 0;
+  uint64_t level    = 0;
+  for (size_t i = 0, n = assertions.size(); i < n; ++i)
+  {
+    size_t l = assertions.level(i);
+    if (l > prev_level)
+    {
+      level += std::min<uint64_t>(l - prev_level, n - i);
+      prev_level = l;
+    }
+    node_words.push_back(level);
+    node_words.push_back(cache.at(assertions[i]));
+  }
+
+  write(os,
+        {s_magic, s_version, types.size(), nodes.size(), assertions.size()});
+  write(os, type_words);
+  write(os, node_words);
+}
+
+}  // namespace bzla
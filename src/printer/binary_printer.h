@@ -0,0 +1,89 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_PRINTER_BINARY_PRINTER_H_INCLUDED
+#define BZLA_PRINTER_BINARY_PRINTER_H_INCLUDED
+
+#include <cstdint>
+#include <ostream>
+
+namespace bzla {
+
+namespace backtrack {
+class AssertionView;
+}
+
+/**
+ * Printer for binary DAG snapshots of the current formula.
+ *
+ * A snapshot is a sequence of 64-bit words in native byte order, which
+ * allows to read it directly from a memory-mapped file. It consists of
+ *
+ *   header:     s_magic, s_version, #types, #nodes, #assertions
+ *   types:      #types type records, components precede the types they occur
+ *               in, referenced by their position in the type table
+ *   nodes:      #nodes node records in topological order, children are
+ *               referenced by their position in the node table
+ *   assertions: #assertions pairs of assertion level and node position,
+ *               levels are non-decreasing and each level exceeds the
+ *               previous one by at most the number of remaining assertions
+ *
+ * A type record starts with its TypeTag, followed by
+ *   BOOL, RM:      -
+ *   BV:            size
+ *   FP:            exponent size, significand size
+ *   ARRAY:         index type, element type
+ *   FUN:           #types, types (codomain last)
+ *   UNINTERPRETED: symbol
+ *
+ * A node record starts with its kind, followed by
+ *   CONSTANT, VARIABLE: type, symbol
+ *   VALUE:              type, value (Boolean and rounding mode values are
+ *                       one word, bit-vector and floating-point values are
+ *                       stored as bit-vector of ceil(size / 64) words,
+ *                       least significant word first)
+ *   CONST_ARRAY:        type, element node
+ *   otherwise:          #children, #indices, children, indices
+ *
+ * Symbols are stored as a flag word (0 if the symbol is not set), followed by
+ * the length of the symbol in bytes and its characters, padded to full words.
+ */
+class BinaryPrinter
+{
+ public:
+  /** Magic number at the start of a snapshot ("BZLADAG" + '\0'). */
+  static constexpr uint64_t s_magic = 0x00474144414c5a42;
+  /** The version of the snapshot format. */
+  static constexpr uint64_t s_version = 1;
+
+  /** Type record tags. */
+  enum class TypeTag : uint64_t
+  {
+    BOOL,
+    BV,
+    FP,
+    RM,
+    ARRAY,
+    FUN,
+    UNINTERPRETED,
+    NUM_TAGS,
+  };
+
+  /**
+   * Print snapshot of given assertions.
+   * @param os The output stream, should be opened in binary mode.
+   * @param assertions The assertions to print.
+   */
+  static void print_formula(std::ostream& os,
+                            const backtrack::AssertionView& assertions);
+};
+
+}  // namespace bzla
+#endif
@@ -0,0 +1,451 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "rewrite/batch_evaluator.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace bzla {
+
+using namespace node;
+
+namespace {
+
+/** @return A mask of the `size` least significant bits, `size` <= 64. */
+uint64_t
+mask(uint64_t size)
+{
+  assert(size > 0 && size <= 64);
+  return size == 64 ? UINT64_MAX : (static_cast<uint64_t>(1) << size) - 1;
+}
+
+/** Sign extend value `a` of given size to 64 bits. */
+inline int64_t
+sext(uint64_t a, uint64_t size)
+{
+  uint64_t shift = 64 - size;
+  return static_cast<int64_t>(a << shift) >> shift;
+}
+
+/*
+ * Kernels over arrays of n values of size <= 64. Each is a single loop
+ * without branches on the values, which allows the compiler to vectorize it
+ * across assignments.
+ */
+
+template <class F>
+void
+map1(uint64_t* res, const uint64_t* a, size_t n, F f)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    res[i] = f(a[i]);
+  }
+}
+
+template <class F>
+void
+map2(uint64_t* res, const uint64_t* a, const uint64_t* b, size_t n, F f)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    res[i] = f(a[i], b[i]);
+  }
+}
+
+template <class F>
+void
+map3(uint64_t* res,
+     const uint64_t* a,
+     const uint64_t* b,
+     const uint64_t* c,
+     size_t n,
+     F f)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    res[i] = f(a[i], b[i], c[i]);
+  }
+}
+
+}  // namespace
+
+/* --- BatchEvaluator public ------------------------------------------------ */
+
+BatchEvaluator::BatchEvaluator(const std::vector<Node>& nodes)
+{
+  for (const Node& node : nodes)
+  {
+    if (d_node_to_slot.find(node) != d_node_to_slot.end())
+    {
+      continue;
+    }
+    const Type& type = node.type();
+    assert(type.is_bool() || type.is_bv());
+    Slot slot;
+    slot.d_node      = node;
+    slot.d_size      = type.is_bool() ? 1 : type.bv_size();
+    slot.d_num_limbs = num_limbs(node);
+    slot.d_narrow    = slot.d_size <= 64;
+    if (node.is_value())
+    {
+      // Values are broadcast to all assignments.
+    }
+    else if (is_supported(node))
+    {
+      for (const Node& child : node)
+      {
+        auto it = d_node_to_slot.find(child);
+        assert(it != d_node_to_slot.end());
+        slot.d_children.push_back(it->second);
+        slot.d_narrow = slot.d_narrow && d_slots[it->second].d_size <= 64;
+      }
+    }
+    else
+    {
+      d_inputs.push_back(node);
+    }
+    d_node_to_slot.emplace(node, d_slots.size());
+    d_slots.push_back(std::move(slot));
+  }
+}
+
+void
+BatchEvaluator::evaluate(size_t num_assignments,
+                         const std::vector<const uint64_t*>& assignments)
+{
+  assert(assignments.size() == d_inputs.size());
+
+  d_num_assignments = num_assignments;
+  size_t offset     = 0;
+  for (Slot& slot : d_slots)
+  {
+    slot.d_offset = offset;
+    offset += slot.d_num_limbs * num_assignments;
+  }
+  d_values.resize(offset);
+
+  size_t n = num_assignments;
+  auto it  = assignments.begin();
+  for (const Slot& slot : d_slots)
+  {
+    if (!slot.d_children.empty())
+    {
+      if (slot.d_narrow)
+      {
+        evaluate_narrow(slot);
+      }
+      else
+      {
+        evaluate_wide(slot);
+      }
+      continue;
+    }
+
+    uint64_t* res = data(slot);
+    size_t nlimbs = slot.d_num_limbs;
+    if (slot.d_node.is_value())
+    {
+      if (slot.d_node.type().is_bool())
+      {
+        res[0] = slot.d_node.value<bool>() ? 1 : 0;
+      }
+      else
+      {
+        slot.d_node.value<BitVector>().to_limbs(res);
+      }
+      for (size_t i = 1; i < n; ++i)
+      {
+        std::copy(res, res + nlimbs, res + i * nlimbs);
+      }
+    }
+    else
+    {
+      const uint64_t* input = *it++;
+      std::copy(input, input + nlimbs * n, res);
+      uint64_t rem = slot.d_size % 64;
+      if (rem)
+      {
+        // Clear the bits above the size of the input.
+        uint64_t m = mask(rem);
+        for (size_t i = nlimbs - 1, size = nlimbs * n; i < size; i += nlimbs)
+        {
+          res[i] &= m;
+        }
+      }
+    }
+  }
+}
+
+const uint64_t*
+BatchEvaluator::values(const Node& node) const
+{
+  auto it = d_node_to_slot.find(node);
+  assert(it != d_node_to_slot.end());
+  return data(d_slots[it->second]);
+}
+
+BitVector
+BatchEvaluator::value(const Node& node, size_t assignment) const
+{
+  assert(assignment < d_num_assignments);
+  auto it = d_node_to_slot.find(node);
+  assert(it != d_node_to_slot.end());
+  const Slot& slot = d_slots[it->second];
+  return BitVector::from_limbs(slot.d_size,
+                               data(slot) + assignment * slot.d_num_limbs);
+}
+
+size_t
+BatchEvaluator::num_limbs(const Node& node)
+{
+  const Type& type = node.type();
+  return type.is_bool() ? 1 : (type.bv_size() + 63) / 64;
+}
+
+/* --- BatchEvaluator private ----------------------------------------------- */
+
+bool
+BatchEvaluator::is_supported(const Node& node)
+{
+  switch (node.kind())
+  {
+    case Kind::EQUAL: {
+      const Type& type = node[0].type();
+      return type.is_bool() || type.is_bv();
+    }
+    case Kind::ITE:
+    case Kind::NOT:
+    case Kind::AND:
+    case Kind::OR:
+    case Kind::BV_NOT:
+    case Kind::BV_DEC:
+    case Kind::BV_INC:
+    case Kind::BV_AND:
+    case Kind::BV_XOR:
+    case Kind::BV_EXTRACT:
+    case Kind::BV_COMP:
+    case Kind::BV_ADD:
+    case Kind::BV_MUL:
+    case Kind::BV_ULT:
+    case Kind::BV_SHL:
+    case Kind::BV_SLT:
+    case Kind::BV_SHR:
+    case Kind::BV_ASHR:
+    case Kind::BV_UDIV:
+    case Kind::BV_UREM:
+    case Kind::BV_CONCAT: return true;
+    default: return false;
+  }
+}
+
+void
+BatchEvaluator::evaluate_narrow(const Slot& slot)
+{
+  size_t n          = d_num_assignments;
+  uint64_t* res     = data(slot);
+  const Slot& slot0 = d_slots[slot.d_children[0]];
+  const uint64_t* a = data(slot0);
+  const uint64_t* b =
+      slot.d_children.size() > 1 ? data(d_slots[slot.d_children[1]]) : nullptr;
+  uint64_t size  = slot.d_size;
+  uint64_t size0 = slot0.d_size;
+  uint64_t m     = mask(size);
+  Kind kind      = slot.d_node.kind();
+
+  switch (kind)
+  {
+    case Kind::NOT: map1(res, a, n, [](uint64_t x) { return x ^ 1; }); break;
+
+    case Kind::AND:
+    case Kind::BV_AND:
+      map2(res, a, b, n, [](uint64_t x, uint64_t y) { return x & y; });
+      break;
+
+    case Kind::OR:
+      map2(res, a, b, n, [](uint64_t x, uint64_t y) { return x | y; });
+      break;
+
+    case Kind::BV_XOR:
+      map2(res, a, b, n, [](uint64_t x, uint64_t y) { return x ^ y; });
+      break;
+
+    case Kind::EQUAL:
+    case Kind::BV_COMP:
+      map2(res, a, b, n, [](uint64_t x, uint64_t y) {
+        return static_cast<uint64_t>(x == y);
+      });
+      break;
+
+    case Kind::ITE: {
+      const uint64_t* c = data(d_slots[slot.d_children[2]]);
+      // Select `b` if the condition is 1 and `c` if it is 0.
+      map3(res, a, b, c, n, [](uint64_t x, uint64_t y, uint64_t z) {
+        return y ^ ((y ^ z) & (x - 1));
+      });
+    }
+    break;
+
+    case Kind::BV_NOT:
+      map1(res, a, n, [m](uint64_t x) { return x ^ m; });
+      break;
+
+    case Kind::BV_DEC:
+      map1(res, a, n, [m](uint64_t x) { return (x - 1) & m; });
+      break;
+
+    case Kind::BV_INC:
+      map1(res, a, n, [m](uint64_t x) { return (x + 1) & m; });
+      break;
+
+    case Kind::BV_EXTRACT: {
+      uint64_t lo = slot.d_node.index(1);
+      map1(res, a, n, [m, lo](uint64_t x) { return (x >> lo) & m; });
+    }
+    break;
+
+    case Kind::BV_ADD:
+      map2(res, a, b, n, [m](uint64_t x, uint64_t y) { return (x + y) & m; });
+      break;
+
+    case Kind::BV_MUL:
+      map2(res, a, b, n, [m](uint64_t x, uint64_t y) { return (x * y) & m; });
+      break;
+
+    case Kind::BV_ULT:
+      map2(res, a, b, n, [](uint64_t x, uint64_t y) {
+        return static_cast<uint64_t>(x < y);
+      });
+      break;
+
+    case Kind::BV_SLT:
+      map2(res, a, b, n, [size0](uint64_t x, uint64_t y) {
+        return static_cast<uint64_t>(sext(x, size0) < sext(y, size0));
+      });
+      break;
+
+    case Kind::BV_SHL:
+      map2(res, a, b, n, [m, size](uint64_t x, uint64_t y) {
+        return y >= size ? 0 : (x << y) & m;
+      });
+      break;
+
+    case Kind::BV_SHR:
+      map2(res, a, b, n, [size](uint64_t x, uint64_t y) {
+        return y >= size ? 0 : x >> y;
+      });
+      break;
+
+    case Kind::BV_ASHR:
+      map2(res, a, b, n, [m, size](uint64_t x, uint64_t y) {
+        return static_cast<uint64_t>(sext(x, size) >> (y >= size ? 63 : y))
+               & m;
+      });
+      break;
+
+    case Kind::BV_UDIV:
+      map2(res, a, b, n, [m](uint64_t x, uint64_t y) {
+        return y == 0 ? m : x / y;
+      });
+      break;
+
+    case Kind::BV_UREM:
+      map2(res, a, b, n, [](uint64_t x, uint64_t y) {
+        return y == 0 ? x : x % y;
+      });
+      break;
+
+    case Kind::BV_CONCAT: {
+      uint64_t size1 = size - size0;
+      map2(res, a, b, n, [size1](uint64_t x, uint64_t y) {
+        return (x << size1) | y;
+      });
+    }
+    break;
+
+    default: assert(false);
+  }
+}
+
+void
+BatchEvaluator::evaluate_wide(const Slot& slot)
+{
+  size_t n          = d_num_assignments;
+  uint64_t* res     = data(slot);
+  const Slot& slot0 = d_slots[slot.d_children[0]];
+  Kind kind         = slot.d_node.kind();
+
+  // Equality and if-then-else only compare and copy limbs.
+  if (kind == Kind::EQUAL || kind == Kind::BV_COMP)
+  {
+    const uint64_t* a = data(slot0);
+    const uint64_t* b = data(d_slots[slot.d_children[1]]);
+    size_t nlimbs     = slot0.d_num_limbs;
+    for (size_t i = 0; i < n; ++i)
+    {
+      size_t offset = i * nlimbs;
+      res[i]        = std::equal(a + offset, a + offset + nlimbs, b + offset);
+    }
+    return;
+  }
+  if (kind == Kind::ITE)
+  {
+    const uint64_t* c = data(slot0);
+    const uint64_t* a = data(d_slots[slot.d_children[1]]);
+    const uint64_t* b = data(d_slots[slot.d_children[2]]);
+    size_t nlimbs     = slot.d_num_limbs;
+    for (size_t i = 0; i < n; ++i)
+    {
+      size_t offset       = i * nlimbs;
+      const uint64_t* val = (c[i] ? a : b) + offset;
+      std::copy(val, val + nlimbs, res + offset);
+    }
+    return;
+  }
+
+  std::vector<BitVector> args(slot.d_children.size());
+  BitVector val;
+  for (size_t i = 0; i < n; ++i)
+  {
+    for (size_t j = 0, size = args.size(); j < size; ++j)
+    {
+      const Slot& child = d_slots[slot.d_children[j]];
+      args[j] = BitVector::from_limbs(child.d_size,
+                                      data(child) + i * child.d_num_limbs);
+    }
+    switch (kind)
+    {
+      case Kind::BV_NOT: val = args[0].bvnot(); break;
+      case Kind::BV_DEC: val = args[0].bvdec(); break;
+      case Kind::BV_INC: val = args[0].bvinc(); break;
+      case Kind::BV_EXTRACT:
+        val = args[0].bvextract(slot.d_node.index(0), slot.d_node.index(1));
+        break;
+      case Kind::BV_AND: val = args[0].bvand(args[1]); break;
+      case Kind::BV_XOR: val = args[0].bvxor(args[1]); break;
+      case Kind::BV_ADD: val = args[0].bvadd(args[1]); break;
+      case Kind::BV_MUL: val = args[0].bvmul(args[1]); break;
+      case Kind::BV_ULT: val = args[0].bvult(args[1]); break;
+      case Kind::BV_SLT: val = args[0].bvslt(args[1]); break;
+      case Kind::BV_SHL: val = args[0].bvshl(args[1]); break;
+      case Kind::BV_SHR: val = args[0].bvshr(args[1]); break;
+      case Kind::BV_ASHR: val = args[0].bvashr(args[1]); break;
+      case Kind::BV_UDIV: val = args[0].bvudiv(args[1]); break;
+      case Kind::BV_UREM: val = args[0].bvurem(args[1]); break;
+      case Kind::BV_CONCAT: val = args[0].bvconcat(args[1]); break;
+      default: assert(false);
+    }
+    assert(val.size() == slot.d_size);
+    val.to_limbs(res + i * slot.d_num_limbs);
+  }
+}
+
+}  // namespace bzla
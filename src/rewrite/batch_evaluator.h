@@ -0,0 +1,133 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_REWRITE_BATCH_EVALUATOR_H_INCLUDED
+#define BZLA_REWRITE_BATCH_EVALUATOR_H_INCLUDED
+
+#include <unordered_map>
+#include <vector>
+
+#include "bv/bitvector.h"
+#include "node/node.h"
+
+namespace bzla {
+
+/**
+ * Evaluates a DAG slice of Boolean and bit-vector terms under many input
+ * assignments at once.
+ *
+ * Values are stored as structure-of-arrays: for each node, the values under
+ * all N assignments are stored contiguously, each as `num_limbs()` 64-bit
+ * limbs (least significant limb first), Boolean values as 0 or 1. Nodes of
+ * size <= 64 are thus stored as arrays of N words and are evaluated with
+ * loops over all assignments that the compiler vectorizes, wider nodes are
+ * evaluated per assignment via BitVector.
+ *
+ * Supports the kinds that remain after rewriting (the kinds evaluated by
+ * SolverEngine::value()), nodes of other kinds are inputs of the slice.
+ */
+class BatchEvaluator
+{
+ public:
+  /**
+   * Constructor.
+   * @param nodes The DAG slice to evaluate, in topological order, i.e., each
+   *              node occurs after its children. Values and nodes of
+   *              unsupported kinds (e.g., constants) are the inputs of the
+   *              slice, all children of other nodes must occur in the slice.
+   */
+  BatchEvaluator(const std::vector<Node>& nodes);
+
+  /**
+   * @return The inputs of the slice that are not values, in the order given
+   *         to the constructor.
+   */
+  const std::vector<Node>& inputs() const { return d_inputs; }
+
+  /**
+   * Evaluate all nodes of the slice under given assignments.
+   * @param num_assignments The number of assignments N.
+   * @param assignments     The values of the inputs, one array per input in
+   *                        the order of inputs(). Each array holds the N
+   *                        values of the input, stored as described above.
+   *                        Bits at positions >= the size of the input are
+   *                        ignored.
+   */
+  void evaluate(size_t num_assignments,
+                const std::vector<const uint64_t*>& assignments);
+
+  /**
+   * Get the values of a node of the slice under all assignments of the last
+   * evaluate() call.
+   * @param node The node.
+   * @return The N values of the node, stored as described above.
+   */
+  const uint64_t* values(const Node& node) const;
+
+  /**
+   * Get the value of a node of the slice under one assignment of the last
+   * evaluate() call.
+   * @param node       The node.
+   * @param assignment The index of the assignment.
+   * @return The value, Boolean values as bit-vectors of size one.
+   */
+  BitVector value(const Node& node, size_t assignment) const;
+
+  /** @return The number of limbs used to store a value of given node. */
+  static size_t num_limbs(const Node& node);
+
+ private:
+  /** A node of the slice. */
+  struct Slot
+  {
+    /** The node. */
+    Node d_node;
+    /** The size of the values of the node, 1 for Boolean nodes. */
+    uint64_t d_size;
+    /** The number of limbs per value. */
+    size_t d_num_limbs;
+    /** The indices of the slots of the children, empty for inputs. */
+    std::vector<size_t> d_children;
+    /** True if the node and all its children are of size <= 64. */
+    bool d_narrow;
+    /** The offset of the values of the node in d_values. */
+    size_t d_offset = 0;
+  };
+
+  /** @return True if given node is evaluated, rather than an input. */
+  static bool is_supported(const Node& node);
+
+  /** Evaluate slot of size <= 64 with children of size <= 64. */
+  void evaluate_narrow(const Slot& slot);
+  /** Evaluate slot with a node or children of size > 64. */
+  void evaluate_wide(const Slot& slot);
+
+  /** @return The values of given slot. */
+  uint64_t* data(const Slot& slot) { return d_values.data() + slot.d_offset; }
+  const uint64_t* data(const Slot& slot) const
+  {
+    return d_values.data() + slot.d_offset;
+  }
+
+  /** The slots, in topological order. */
+  std::vector<Slot> d_slots;
+  /** Maps nodes to the indices of their slots. */
+  std::unordered_map<Node, size_t> d_node_to_slot;
+  /** The inputs that are not values. */
+  std::vector<Node> d_inputs;
+  /** The number of assignments of the last evaluate() call. */
+  size_t d_num_assignments = 0;
+  /** The values of all nodes. */
+  std::vector<uint64_t> d_values;
+};
+
+}  // namespace bzla
+
+#endif
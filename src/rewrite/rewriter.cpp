@@ -149,8 +149,8 @@ Rewriter::rewrite(const Node& node)
 
 const Node&
 Rewriter::mk_node(node::Kind kind,
-                  const std::vector<Node>& children,
-                  const std::vector<uint64_t>& indices)
+                  util::Span<Node> children,
+                  util::Span<uint64_t> indices)
 {
 #ifndef NDEBUG
   uint64_t max_id = NodeManager::get().max_node_id();
@@ -352,6 +352,12 @@ Rewriter::clear_cache()
   d_cache.clear();
 }
 
+size_t
+Rewriter::memory_usage() const
+{
+  return d_cache.memory_usage();
+}
+
 /* === Rewriter private ===================================================== */
 
 const Node&
@@ -504,10 +510,9 @@ Rewriter::_rewrite(const Node& node)
   assert(!res.is_null());
   assert(res.type() == node.type());
 
-  // Get iterator again in case a recursive call changed the size of d_cache
-  // and invalidated the iterator.
-  it = d_cache.find(node);
-  assert(it != d_cache.end());
+  // Note: Recursive calls do not invalidate the iterator since cache entries
+  //       are never moved.
+  assert(it == d_cache.find(node));
   assert(it->second.is_null());
 
   // Cache result
@@ -17,6 +17,8 @@
 #endif
 
 #include "node/node.h"
+#include "node/node_id_map.h"
+#include "util/span.h"
 #include "util/statistics.h"
 
 namespace bzla {
@@ -56,8 +58,8 @@ class Rewriter
    * @return The created, rewritten node.
    */
   const Node& mk_node(node::Kind kind,
-                      const std::vector<Node>& children,
-                      const std::vector<uint64_t>& indices = {});
+                      util::Span<Node> children,
+                      util::Span<uint64_t> indices = {});
 
   /**
    * Helper to create an inverted Boolean or bit-vector node.
@@ -126,6 +128,9 @@ class Rewriter
   /** Clear rewrite cache. */
   void clear_cache();
 
+  /** @return The number of bytes allocated by the rewrite cache. */
+  size_t memory_usage() const;
+
  private:
   /** The limit for recursive calls to _rewrite(). */
   static constexpr uint64_t RECURSION_LIMIT = 4096;
@@ -252,7 +257,7 @@ class Rewriter
   /** True to enable rewriting, false to only enable operator elimination. */
   uint8_t d_level;
   /** Cache for rewritten nodes, maps node to its rewritten form. */
-  std::unordered_map<Node, Node> d_cache;
+  node::NodeIdMap<Node> d_cache;
 #ifndef NDEBUG
   /** Cache for detecting rewrite cycles in debug mode. */
   std::unordered_set<Node> d_rec_cache;
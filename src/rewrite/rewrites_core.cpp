@@ -788,7 +788,7 @@ _rw_eq_const_bv_mul(Rewriter& rewriter, const Node& node, size_t idx)
             Kind::EQUAL,
             {node[idx0][1],
              NodeManager::get().mk_value(
-                 node[idx1].value<BitVector>().bvmul(val.bvmodinv()))});
+                 val.bvmodinv().bvmul(node[idx1].value<BitVector>()))});
       }
     }
     if (node[idx0][1].is_value())
@@ -800,7 +800,7 @@ _rw_eq_const_bv_mul(Rewriter& rewriter, const Node& node, size_t idx)
             Kind::EQUAL,
             {node[idx0][0],
              NodeManager::get().mk_value(
-                 node[idx1].value<BitVector>().bvmul(val.bvmodinv()))});
+                 val.bvmodinv().bvmul(node[idx1].value<BitVector>()))});
       }
     }
   }
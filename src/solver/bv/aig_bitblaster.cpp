@@ -160,12 +160,12 @@ AigBitblaster::bitblast(const Node& t)
 
         case Kind::BV_UDIV:
           assert(type.is_bv());
-          it->second = d_bitblaster.bv_udiv(bits(cur[0]), bits(cur[1]));
+          it->second = udiv_urem(cur[0], cur[1]).first;
           break;
 
         case Kind::BV_UREM:
           assert(type.is_bv());
-          it->second = d_bitblaster.bv_urem(bits(cur[0]), bits(cur[1]));
+          it->second = udiv_urem(cur[0], cur[1]).second;
           break;
 
         case Kind::BV_CONCAT:
@@ -182,6 +182,10 @@ AigBitblaster::bitblast(const Node& t)
         // We should never reach other kinds.
         default: assert(false); break;
       }
+      d_num_cached_bits += it->second.size();
+      // Cached bits are referenced, their cones are not released on garbage
+      // collection.
+      inc_ref(it->second);
     }
     visit.pop_back();
   } while (!visit.empty());
@@ -190,35 +194,53 @@ AigBitblaster::bitblast(const Node& t)
 const bb::AigBitblaster::Bits&
 AigBitblaster::bits(const Node& term) const
 {
-  if (d_bitblaster_cache.find(term) == d_bitblaster_cache.end())
+  auto it = d_bitblaster_cache.find(term);
+  if (it == d_bitblaster_cache.end())
   {
     return d_empty;
   }
-  return d_bitblaster_cache.at(term);
+  return it->second;
+}
+
+uint64_t
+AigBitblaster::cache_memory_usage() const
+{
+  uint64_t num_bits = d_num_cached_bits;
+  for (const auto& p : d_udiv_urem_cache)
+  {
+    num_bits += p.second.first.size() + p.second.second.size();
+  }
+  return d_bitblaster_cache.memory_usage() + num_bits * sizeof(bb::AigNode);
+}
+
+void
+AigBitblaster::garbage_collect()
+{
+  d_udiv_urem_cache.clear();
+  aig_manager().garbage_collect();
 }
 
 uint64_t
 AigBitblaster::count_aig_ands(const Node& term, AigNodeRefSet& cache)
 {
-  std::vector<std::reference_wrapper<const bb::AigNode>> visit;
   bitblast(term);
-  const auto& b = bits(term);
-  visit.insert(visit.end(), b.begin(), b.end());
+  std::vector<bb::AigNode> visit(bits(term));
   assert(!visit.empty());
 
-  uint64_t res = 0;
+  const bb::AigManager& mgr = aig_manager();
+  uint64_t res              = 0;
   do
   {
-    const bb::AigNode& cur = visit.back();
+    bb::AigNode cur = visit.back();
     visit.pop_back();
 
     if (cache.insert(cur).second)
     {
-      if (cur.is_and())
+      if (mgr.is_and(cur))
       {
         ++res;
-        visit.push_back(cur[0]);
-        visit.push_back(cur[1]);
+        visit.push_back(mgr.get_child(cur, 0));
+        visit.push_back(mgr.get_child(cur, 1));
       }
     }
   } while (!visit.empty());
@@ -226,4 +248,41 @@ AigBitblaster::count_aig_ands(const Node& term, AigNodeRefSet& cache)
   return res;
 }
 
+/* --- AigBitblaster private ------------------------------------------------ */
+
+std::pair<bb::AigBitblaster::Bits, bb::AigBitblaster::Bits>
+AigBitblaster::udiv_urem(const Node& a, const Node& b)
+{
+  auto key = std::make_pair(a.id(), b.id());
+  auto it  = d_udiv_urem_cache.find(key);
+  if (it != d_udiv_urem_cache.end())
+  {
+    // The sibling operation was already bit-blasted, this is the last use of
+    // the cached circuit.
+    auto res = std::move(it->second);
+    d_udiv_urem_cache.erase(it);
+    ++d_num_shared_udiv_urem;
+    return res;
+  }
+  auto res = d_bitblaster.bv_udiv_urem(bits(a), bits(b));
+  d_udiv_urem_cache.emplace(key, res);
+  return res;
+}
+
+void
+AigBitblaster::inc_ref(const bb::AigBitblaster::Bits& bits)
+{
+  for (const bb::AigNode& bit : bits)
+  {
+    aig_manager().inc_ref(bit);
+  }
+}
+
+size_t
+AigBitblaster::HashPair::operator()(
+    const std::pair<uint64_t, uint64_t>& p) const
+{
+  return std::hash<uint64_t>()(p.first) * 31 + std::hash<uint64_t>()(p.second);
+}
+
 }  // namespace bzla::bv
@@ -11,17 +11,35 @@
 #ifndef BZLA_SOLVER_BV_AIG_BITBLASTER_H_INCLUDED
 #define BZLA_SOLVER_BV_AIG_BITBLASTER_H_INCLUDED
 
+#include <unordered_map>
+
 #include "bitblast/aig_bitblaster.h"
 #include "node/node.h"
+#include "node/node_id_map.h"
 
 namespace bzla::bv {
 
 class AigBitblaster
 {
  public:
-  using AigNodeRefSet =
-      std::unordered_set<std::reference_wrapper<const bb::AigNode>,
-                         std::hash<bb::AigNode>>;
+  using AigNodeRefSet = std::unordered_set<bb::AigNode>;
+
+  /**
+   * Constructor.
+   * @param aig_opt_level The optimization level of the two-level AIG
+   *                      rewriting.
+   * @param mul_encoding  The encoding of bit-vector multiplication.
+   * @param div_encoding  The encoding of unsigned bit-vector division and
+   *                      remainder.
+   */
+  AigBitblaster(uint8_t aig_opt_level = bb::AigManager::OPT_LEVEL_MAX,
+                bb::MulEncoding mul_encoding = bb::MulEncoding::ARRAY,
+                bb::DivEncoding div_encoding = bb::DivEncoding::RESTORING)
+      : d_bitblaster(aig_opt_level)
+  {
+    d_bitblaster.set_mul_encoding(mul_encoding);
+    d_bitblaster.set_div_encoding(div_encoding);
+  }
 
   /** Recursively bit-blast `term`. */
   void bitblast(const Node& term);
@@ -35,14 +53,81 @@ class AigBitblaster
   uint64_t num_aig_ands() const { return d_bitblaster.num_aig_ands(); }
   uint64_t num_aig_consts() const { return d_bitblaster.num_aig_consts(); }
   uint64_t num_aig_shared() const { return d_bitblaster.num_aig_shared(); }
+  /**
+   * @return The number of unsigned divisions and remainders that reused the
+   *         divider circuit of a remainder or division over the same operands.
+   */
+  uint64_t num_shared_udiv_urem() const { return d_num_shared_udiv_urem; }
+  const bb::AigManager::Statistics& aig_statistics() const
+  {
+    return d_bitblaster.aig_statistics();
+  }
+  bb::AigManager& aig_manager() { return d_bitblaster.aig_manager(); }
+
+  /** @return The number of bytes allocated by the AIG manager. */
+  uint64_t aig_memory_usage() const { return d_bitblaster.aig_memory_usage(); }
+  /** @return The number of bytes allocated by the bit-blaster cache. */
+  uint64_t cache_memory_usage() const;
+
+  /**
+   * Release the AIG nodes that are not referenced, e.g., by the bit-blaster
+   * cache. Drops the pending divider circuits of the division cache, which
+   * are not referenced.
+   */
+  void garbage_collect();
 
  private:
+  /** Hash ordered pair (a, b) of node ids. */
+  struct HashPair
+  {
+    size_t operator()(const std::pair<uint64_t, uint64_t>& p) const;
+  };
+
+  /**
+   * Bit-blast unsigned division and remainder of `a` by `b`. The divider
+   * circuit is shared between bvudiv and bvurem over the same operands.
+   * @return A pair of the quotient and the remainder.
+   */
+  std::pair<bb::AigBitblaster::Bits, bb::AigBitblaster::Bits> udiv_urem(
+      const Node& a, const Node& b);
+
+  /**
+   * Increase the reference counts of given bits in the AIG manager, their
+   * cones are not released on garbage collection.
+   */
+  void inc_ref(const bb::AigBitblaster::Bits& bits);
+
   bb::AigBitblaster::Bits d_empty;
 
   /** AIG bit-blaster. */
   bb::AigBitblaster d_bitblaster;
-  /** Cached to store bit-blasted terms and their encoded bits. */
-  std::unordered_map<Node, bb::AigBitblaster::Bits> d_bitblaster_cache;
+  /**
+   * Cached to store bit-blasted terms and their encoded bits. The bits are
+   * referenced in the AIG manager.
+   */
+  node::NodeIdMap<bb::AigBitblaster::Bits> d_bitblaster_cache;
+  /** The total number of bits stored in the bit-blaster cache. */
+  uint64_t d_num_cached_bits = 0;
+  /**
+   * Maps the ids of operand pairs of unsigned divisions and remainders to
+   * their encoded quotient and remainder. An entry is removed when its
+   * sibling operation is bit-blasted, since both are then stored in the
+   * bit-blaster cache.
+   *
+   * Entries persist across calls to bitblast(), divider circuits are shared
+   * between assertions. Keyed by node ids rather than nodes to not keep
+   * the operands alive. The ids stay valid since the operands are stored in
+   * the bit-blaster cache, which is never cleared. The pending halves of
+   * divider circuits are not referenced in the AIG manager, thus the cache
+   * is cleared on garbage_collect().
+   */
+  std::unordered_map<
+      std::pair<uint64_t, uint64_t>,
+      std::pair<bb::AigBitblaster::Bits, bb::AigBitblaster::Bits>,
+      HashPair>
+      d_udiv_urem_cache;
+  /** The number of divider circuits reused from the division cache. */
+  uint64_t d_num_shared_udiv_urem = 0;
 };
 
 }  // namespace bzla::bv
@@ -49,17 +49,57 @@ class BvBitblastSolver::BitblastSatSolver : public bb::SatInterface
   sat::SatSolver& d_solver;
 };
 
+namespace {
+
+bb::MulEncoding
+mul_encoding(option::MulEncoding encoding)
+{
+  switch (encoding)
+  {
+    case option::MulEncoding::DADDA: return bb::MulEncoding::DADDA;
+    case option::MulEncoding::KARATSUBA: return bb::MulEncoding::KARATSUBA;
+    case option::MulEncoding::AUTO: return bb::MulEncoding::AUTO;
+    default: return bb::MulEncoding::ARRAY;
+  }
+}
+
+bb::DivEncoding
+div_encoding(option::DivEncoding encoding)
+{
+  switch (encoding)
+  {
+    case option::DivEncoding::NON_RESTORING:
+      return bb::DivEncoding::NON_RESTORING;
+    default: return bb::DivEncoding::RESTORING;
+  }
+}
+
+}  // namespace
+
 /* --- BvBitblastSolver public ---------------------------------------------- */
 
 BvBitblastSolver::BvBitblastSolver(Env& env, SolverState& state)
     : Solver(env, state),
       d_assumptions(state.backtrack_mgr()),
+      d_assumption_bits(state.backtrack_mgr()),
+      d_bitblaster(env.options().aig_opt_level(),
+                   mul_encoding(env.options().mul_encoding()),
+                   div_encoding(env.options().div_encoding())),
       d_last_result(Result::UNKNOWN),
       d_stats(env.statistics())
 {
   d_sat_solver.reset(sat::new_sat_solver(env.options().sat_solver()));
   d_bitblast_sat_solver.reset(new BitblastSatSolver(*d_sat_solver));
-  d_cnf_encoder.reset(new bb::AigCnfEncoder(*d_bitblast_sat_solver));
+  d_cnf_encoder.reset(new bb::AigCnfEncoder(d_bitblaster.aig_manager(),
+                                            *d_bitblast_sat_solver));
+  const option::Options& opts = env.options();
+  if (opts.aig_rewrite())
+  {
+    d_aig_optimizer.reset(
+        new bb::AigOptimizer(d_bitblaster.aig_manager(),
+                             opts.aig_rewrite_max_ands(),
+                             opts.aig_rewrite_time_limit()));
+  }
 }
 
 BvBitblastSolver::~BvBitblastSolver() {}
@@ -69,13 +109,12 @@ BvBitblastSolver::solve()
 {
   d_sat_solver->configure_terminator(d_env.terminator());
 
-  for (const Node& assumption : d_assumptions)
+  for (const bb::AigNode& bit : d_assumption_bits)
   {
-    const auto& bits = d_bitblaster.bits(assumption);
-    assert(!bits.empty());
-    d_sat_solver->assume(bits[0].get_id());
+    d_sat_solver->assume(bit.get_id());
   }
 
+  garbage_collect();
   update_statistics();
   util::Timer timer(d_stats.time_sat);
   d_last_result = d_sat_solver->solve();
@@ -93,15 +132,17 @@ BvBitblastSolver::register_assertion(const Node& assertion,
     top_level = false;
   }
 
+  d_bitblaster.bitblast(assertion);
+  const auto& bits = d_bitblaster.bits(assertion);
+  assert(!bits.empty());
+  bb::AigNode bit = encoded_bit(bits[0]);
+  d_cnf_encoder->encode(bit, top_level);
+
   if (!top_level)
   {
     d_assumptions.push_back(assertion);
+    d_assumption_bits.push_back(bit);
   }
-
-  d_bitblaster.bitblast(assertion);
-  const auto& bits = d_bitblaster.bits(assertion);
-  assert(!bits.empty());
-  d_cnf_encoder->encode(bits[0], top_level);
 }
 
 Node
@@ -139,29 +180,76 @@ BvBitblastSolver::unsat_core(std::vector<Node>& core) const
   assert(d_last_result == Result::UNSAT);
   assert(d_env.options().produce_unsat_cores());
 
-  for (const Node& assumption : d_assumptions)
+  assert(d_assumptions.size() == d_assumption_bits.size());
+  for (size_t i = 0, size = d_assumptions.size(); i < size; ++i)
   {
-    const auto& bits = d_bitblaster.bits(assumption);
-    assert(bits.size() == 1);
-    if (d_sat_solver->failed(bits[0].get_id()))
+    if (d_sat_solver->failed(d_assumption_bits[i].get_id()))
     {
-      core.push_back(assumption);
+      core.push_back(d_assumptions[i]);
     }
   }
 }
 
 /* --- BvBitblastSolver private --------------------------------------------- */
 
+bb::AigNode
+BvBitblastSolver::encoded_bit(const bb::AigNode& bit) const
+{
+  if (!d_aig_optimizer)
+  {
+    return bit;
+  }
+  util::Timer timer(d_stats.time_aig_opt);
+  return d_aig_optimizer->optimize(bit);
+}
+
+void
+BvBitblastSolver::garbage_collect()
+{
+  // Collect only if the number of AIG nodes doubled since the last garbage
+  // collection, which amortizes the cost of marking the live nodes.
+  bb::AigManager& mgr                 = d_bitblaster.aig_manager();
+  const bb::AigManager::Statistics& s = mgr.statistics();
+  if (s.num_ands + s.num_consts < d_aig_gc_limit)
+  {
+    return;
+  }
+  d_bitblaster.garbage_collect();
+  d_aig_gc_limit = 2 * (s.num_ands + s.num_consts);
+}
+
 void
 BvBitblastSolver::update_statistics()
 {
   d_stats.num_aig_ands = d_bitblaster.num_aig_ands();
   d_stats.num_aig_consts = d_bitblaster.num_aig_consts();
   d_stats.num_aig_shared   = d_bitblaster.num_aig_shared();
+  d_stats.num_shared_udiv_urem = d_bitblaster.num_shared_udiv_urem();
+  auto& aig_stats                  = d_bitblaster.aig_statistics();
+  d_stats.num_aig_rw_neutrality    = aig_stats.num_rw_neutrality;
+  d_stats.num_aig_rw_boundedness   = aig_stats.num_rw_boundedness;
+  d_stats.num_aig_rw_idempotence   = aig_stats.num_rw_idempotence;
+  d_stats.num_aig_rw_contradiction = aig_stats.num_rw_contradiction;
+  d_stats.num_aig_rw_subsumption   = aig_stats.num_rw_subsumption;
+  d_stats.num_aig_rw_resolution    = aig_stats.num_rw_resolution;
+  d_stats.num_aig_rw_substitution  = aig_stats.num_rw_substitution;
+  d_stats.num_aig_released         = aig_stats.num_released;
+  if (d_aig_optimizer)
+  {
+    auto& opt_stats               = d_aig_optimizer->statistics();
+    d_stats.num_aig_opt_ands      = opt_stats.num_ands;
+    d_stats.num_aig_opt_ands_opt  = opt_stats.num_ands_opt;
+    d_stats.num_aig_opt_balanced  = opt_stats.num_balanced;
+    d_stats.num_aig_opt_rewritten = opt_stats.num_rewritten;
+    d_stats.num_aig_opt_skipped   = opt_stats.num_skipped;
+  }
   auto& cnf_stats = d_cnf_encoder->statistics();
   d_stats.num_cnf_vars = cnf_stats.num_vars;
   d_stats.num_cnf_clauses = cnf_stats.num_clauses;
   d_stats.num_cnf_literals = cnf_stats.num_literals;
+  d_stats.memory_bitblaster_cache = d_bitblaster.cache_memory_usage();
+  d_stats.memory_aig              = d_bitblaster.aig_memory_usage();
+  d_stats.memory_cnf              = d_cnf_encoder->memory_usage();
   Msg(1) << d_stats.num_aig_consts << " AIG consts, " << d_stats.num_aig_ands
          << " AIG ands, " << d_stats.num_cnf_vars << " CNF vars, "
          << d_stats.num_cnf_clauses << " CNF clauses";
@@ -173,11 +261,45 @@ BvBitblastSolver::Statistics::Statistics(util::Statistics& stats)
       num_aig_ands(stats.new_stat<uint64_t>("bv::bitblast::aig::num_ands")),
       num_aig_consts(stats.new_stat<uint64_t>("bv::bitblast::aig::num_consts")),
       num_aig_shared(stats.new_stat<uint64_t>("bv::bitblast::aig::num_shared")),
+      num_aig_released(
+          stats.new_stat<uint64_t>("bv::bitblast::aig::num_released")),
+      num_shared_udiv_urem(
+          stats.new_stat<uint64_t>("bv::bitblast::num_shared_udiv_urem")),
+      num_aig_rw_neutrality(
+          stats.new_stat<uint64_t>("bv::bitblast::aig::rewrite::neutrality")),
+      num_aig_rw_boundedness(
+          stats.new_stat<uint64_t>("bv::bitblast::aig::rewrite::boundedness")),
+      num_aig_rw_idempotence(
+          stats.new_stat<uint64_t>("bv::bitblast::aig::rewrite::idempotence")),
+      num_aig_rw_contradiction(stats.new_stat<uint64_t>(
+          "bv::bitblast::aig::rewrite::contradiction")),
+      num_aig_rw_subsumption(
+          stats.new_stat<uint64_t>("bv::bitblast::aig::rewrite::subsumption")),
+      num_aig_rw_resolution(
+          stats.new_stat<uint64_t>("bv::bitblast::aig::rewrite::resolution")),
+      num_aig_rw_substitution(stats.new_stat<uint64_t>(
+          "bv::bitblast::aig::rewrite::substitution")),
+      time_aig_opt(stats.new_stat<util::TimerStatistic>(
+          "bv::bitblast::aig::opt::time_optimize")),
+      num_aig_opt_ands(
+          stats.new_stat<uint64_t>("bv::bitblast::aig::opt::num_ands")),
+      num_aig_opt_ands_opt(
+          stats.new_stat<uint64_t>("bv::bitblast::aig::opt::num_ands_opt")),
+      num_aig_opt_balanced(
+          stats.new_stat<uint64_t>("bv::bitblast::aig::opt::num_balanced")),
+      num_aig_opt_rewritten(
+          stats.new_stat<uint64_t>("bv::bitblast::aig::opt::num_rewritten")),
+      num_aig_opt_skipped(
+          stats.new_stat<uint64_t>("bv::bitblast::aig::opt::num_skipped")),
       num_cnf_vars(stats.new_stat<uint64_t>("bv::bitblast::cnf::num_vars")),
       num_cnf_clauses(
           stats.new_stat<uint64_t>("bv::bitblast::cnf::num_clauses")),
       num_cnf_literals(
-          stats.new_stat<uint64_t>("bv::bitblast::cnf::num_literals"))
+          stats.new_stat<uint64_t>("bv::bitblast::cnf::num_literals")),
+      memory_bitblaster_cache(
+          stats.new_stat<uint64_t>("bv::bitblast::memory::bitblaster_cache")),
+      memory_aig(stats.new_stat<uint64_t>("bv::bitblast::memory::aig")),
+      memory_cnf(stats.new_stat<uint64_t>("bv::bitblast::memory::cnf"))
 {
 }
 
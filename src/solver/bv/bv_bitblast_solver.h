@@ -16,6 +16,7 @@
 #include "backtrack/assertion_stack.h"
 #include "backtrack/vector.h"
 #include "bitblast/aig/aig_cnf.h"
+#include "bitblast/aig/aig_optimizer.h"
 #include "sat/sat_solver.h"
 #include "solver/bv/aig_bitblaster.h"
 #include "solver/bv/bv_solver_interface.h"
@@ -51,14 +52,36 @@ class BvBitblastSolver : public Solver, public BvSolverInterface
   /** Update AIG and CNF statistics. */
   void update_statistics();
 
+  /**
+   * Release the AIG nodes that are neither referenced by the bit-blaster
+   * cache, the CNF encoder nor the AIG optimizer, e.g., the intermediate
+   * nodes of AIG optimization.
+   */
+  void garbage_collect();
+
+  /**
+   * Get the AIG node that is encoded to CNF for given bit of an assertion.
+   * @param bit The bit-blasted assertion.
+   * @return The optimized AIG node if AIG rewriting is enabled, and `bit`
+   *         otherwise.
+   */
+  bb::AigNode encoded_bit(const bb::AigNode& bit) const;
+
   /** Sat interface used for d_cnf_encoder. */
   class BitblastSatSolver;
 
   /** The current set of assertions. */
   backtrack::vector<Node> d_assumptions;
+  /**
+   * The AIG nodes encoded to CNF for the assumptions in `d_assumptions`, at
+   * the same index.
+   */
+  backtrack::vector<bb::AigNode> d_assumption_bits;
 
   /** AIG bit-blaster. */
   AigBitblaster d_bitblaster;
+  /** AIG optimizer, only created if AIG rewriting is enabled. */
+  std::unique_ptr<bb::AigOptimizer> d_aig_optimizer;
 
   /** CNF encoder for AIGs. */
   std::unique_ptr<bb::AigCnfEncoder> d_cnf_encoder;
@@ -68,6 +91,8 @@ class BvBitblastSolver : public Solver, public BvSolverInterface
   std::unique_ptr<BitblastSatSolver> d_bitblast_sat_solver;
   /** Result of last solve() call. */
   Result d_last_result;
+  /** The number of AIG nodes that triggers the next garbage collection. */
+  uint64_t d_aig_gc_limit = 0;
 
   struct Statistics
   {
@@ -76,9 +101,27 @@ class BvBitblastSolver : public Solver, public BvSolverInterface
     uint64_t& num_aig_ands;
     uint64_t& num_aig_consts;
     uint64_t& num_aig_shared;
+    uint64_t& num_aig_released;
+    uint64_t& num_shared_udiv_urem;
+    uint64_t& num_aig_rw_neutrality;
+    uint64_t& num_aig_rw_boundedness;
+    uint64_t& num_aig_rw_idempotence;
+    uint64_t& num_aig_rw_contradiction;
+    uint64_t& num_aig_rw_subsumption;
+    uint64_t& num_aig_rw_resolution;
+    uint64_t& num_aig_rw_substitution;
+    util::TimerStatistic& time_aig_opt;
+    uint64_t& num_aig_opt_ands;
+    uint64_t& num_aig_opt_ands_opt;
+    uint64_t& num_aig_opt_balanced;
+    uint64_t& num_aig_opt_rewritten;
+    uint64_t& num_aig_opt_skipped;
     uint64_t& num_cnf_vars;
     uint64_t& num_cnf_clauses;
     uint64_t& num_cnf_literals;
+    uint64_t& memory_bitblaster_cache;
+    uint64_t& memory_aig;
+    uint64_t& memory_cnf;
   } d_stats;
 };
 
@@ -84,22 +84,22 @@ BvPropSolver::solve()
   // incremental: increase limit by given nprops/nupdates
   if (nprops)
   {
-    nprops += d_ls->d_statistics.d_nprops;
+    nprops += d_ls->statistics().d_nprops;
   }
   d_ls->set_max_nprops(nprops);
   Log(1) << "set propagation limit to " << nprops;
 
   if (nupdates)
   {
-    nupdates += d_ls->d_statistics.d_nupdates;
+    nupdates += d_ls->statistics().d_nupdates;
   }
   d_ls->set_max_nupdates(nupdates);
   Log(1) << "set cone update limit to " << nupdates;
 
   for (uint32_t j = 0;; ++j)
   {
-    if (d_env.terminate() || (nprops && d_ls->d_statistics.d_nprops >= nprops)
-        || (nupdates && d_ls->d_statistics.d_nupdates >= nupdates))
+    if (d_env.terminate() || (nprops && d_ls->statistics().d_nprops >= nprops)
+        || (nupdates && d_ls->statistics().d_nupdates >= nupdates))
     {
       assert(sat_result == Result::UNKNOWN);
       goto DONE;
@@ -134,16 +134,16 @@ SAT:
 UNSAT:
   sat_result = Result::UNSAT;
 DONE:
-  d_stats.num_moves += d_ls->d_statistics.d_nmoves;
-  d_stats.num_props += d_ls->d_statistics.d_nprops;
-  d_stats.num_props_inv += d_ls->d_statistics.d_nprops_inv;
-  d_stats.num_props_cons += d_ls->d_statistics.d_nprops_cons;
-  d_stats.num_updates += d_ls->d_statistics.d_nupdates;
-  d_stats.num_conflicts += d_ls->d_statistics.d_nconf_total;
+  d_stats.num_moves += d_ls->statistics().d_nmoves;
+  d_stats.num_props += d_ls->statistics().d_nprops;
+  d_stats.num_props_inv += d_ls->statistics().d_nprops_inv;
+  d_stats.num_props_cons += d_ls->statistics().d_nprops_cons;
+  d_stats.num_updates += d_ls->statistics().d_nupdates;
+  d_stats.num_conflicts += d_ls->statistics().d_nconf_total;
 #ifndef NDEBUG
-  d_stats.num_props_inv_per_kind.import_map(d_ls->d_statistics.d_ninv);
-  d_stats.num_props_cons_per_kind.import_map(d_ls->d_statistics.d_ncons);
-  d_stats.num_props_conflicts_per_kind.import_map(d_ls->d_statistics.d_nconf);
+  d_stats.num_props_inv_per_kind.import_map(d_ls->statistics().d_ninv);
+  d_stats.num_props_cons_per_kind.import_map(d_ls->statistics().d_ncons);
+  d_stats.num_props_conflicts_per_kind.import_map(d_ls->statistics().d_nconf);
 #endif
 
   print_progress();
@@ -465,9 +465,9 @@ BvPropSolver::print_progress() const
     double perc_sat     = static_cast<double>(nroots_sat) / nroots_total * 100;
     Msg(1) << nroots_sat << "/" << nroots_total << " roots satisfied ("
            << std::setprecision(3) << perc_sat
-           << "%), moves: " << d_ls->d_statistics.d_nmoves
-           << ", propagation steps: " << d_ls->d_statistics.d_nprops
-           << ", updates: " << d_ls->d_statistics.d_nupdates;
+           << "%), moves: " << d_ls->statistics().d_nmoves
+           << ", propagation steps: " << d_ls->statistics().d_nprops
+           << ", updates: " << d_ls->statistics().d_nupdates;
   }
 }
 
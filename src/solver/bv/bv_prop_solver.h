@@ -14,6 +14,7 @@
 #include "backtrack/assertion_stack.h"
 #include "backtrack/backtrackable.h"
 #include "ls/ls_bv.h"
+#include "node/node_id_map.h"
 #include "node/node_ref_vector.h"
 #include "solver/bv/bv_bitblast_solver.h"
 #include "solver/bv/bv_solver_interface.h"
@@ -80,7 +81,7 @@ class BvPropSolver : public Solver, public BvSolverInterface
   /** The backtrack manager for the local search engine. */
   LsBacktrack d_ls_backtrack;
   /** Map Bitwuzla node to LocalSearchBV bit-vector node id. */
-  std::unordered_map<Node, uint64_t> d_node_map;
+  node::NodeIdMap<uint64_t> d_node_map;
   /** Map LocalSearchBV root id to Bitwuzla node for unsat cores. */
   std::unordered_map<uint64_t, Node> d_root_id_node_map;
   /** True to enable constant bits propagation. */
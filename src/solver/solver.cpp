@@ -11,12 +11,19 @@
 #include "solver.h"
 
 #include "env.h"
+#include "util/memory.h"
 
 namespace bzla {
 
 Solver::Solver(Env& env, SolverState& state)
     : d_env(env), d_logger(env.logger()), d_solver_state(state){};
 
+size_t
+Solver::value_cache_memory_usage() const
+{
+  return util::memory_usage(d_value_cache);
+}
+
 void
 Solver::cache_value(const Node& term, const Node& value)
 {
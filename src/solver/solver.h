@@ -48,6 +48,9 @@ class Solver
     assert(false);
   }
 
+  /** @return The number of bytes allocated by the value cache. */
+  size_t value_cache_memory_usage() const;
+
  protected:
   /** Associated environment. */
   Env& d_env;
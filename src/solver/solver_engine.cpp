@@ -92,6 +92,16 @@ SolverEngine::solve()
   } while (!d_lemmas.empty() || d_new_terms_registered);
   d_in_solving_mode = false;
 
+  d_stats.memory_value_cache =
+      d_value_cache.memory_usage() + d_bv_solver.value_cache_memory_usage()
+      + d_fp_solver.value_cache_memory_usage()
+      + d_fun_solver.value_cache_memory_usage()
+      + d_array_solver.value_cache_memory_usage()
+      + d_quant_solver.value_cache_memory_usage();
+  d_stats.memory_caches = d_register_assertion_cache.memory_usage()
+                          + d_register_term_cache.memory_usage()
+                          + d_lemma_cache.memory_usage();
+
   Log(1);
   Log(1) << "Solver engine determined: " << d_sat_state;
   return d_sat_state;
@@ -680,7 +690,10 @@ SolverEngine::Statistics::Statistics(util::Statistics& stats)
     : num_lemmas(stats.new_stat<uint64_t>("solver::lemmas")),
       time_register_term(
           stats.new_stat<util::TimerStatistic>("solver::time_register_term")),
-      time_solve(stats.new_stat<util::TimerStatistic>("solver::time_solve"))
+      time_solve(stats.new_stat<util::TimerStatistic>("solver::time_solve")),
+      memory_value_cache(
+          stats.new_stat<uint64_t>("solver::memory::value_cache")),
+      memory_caches(stats.new_stat<uint64_t>("solver::memory::caches"))
 {
 }
 
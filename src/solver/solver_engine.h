@@ -13,9 +13,11 @@
 
 #include "backtrack/assertion_stack.h"
 #include "backtrack/backtrackable.h"
+#include "backtrack/node_id_set.h"
 #include "backtrack/pop_callback.h"
 #include "backtrack/unordered_set.h"
 #include "node/node.h"
+#include "node/node_id_map.h"
 #include "rewrite/rewriter.h"
 #include "solver/array/array_solver.h"
 #include "solver/bv/bv_solver.h"
@@ -109,7 +111,7 @@ class SolverEngine
   const Node& cached_value(const Node& term) const;
 
   /** Model value cache for _value(). */
-  std::unordered_map<Node, Node> d_value_cache;
+  node::NodeIdMap<Node> d_value_cache;
 
   /** Associated solving context. */
   SolvingContext& d_context;
@@ -123,7 +125,7 @@ class SolverEngine
   /** Assertion cache used by process_assertion(). */
   backtrack::unordered_set<Node> d_register_assertion_cache;
   /** Term cache used by process_term(). */
-  backtrack::unordered_set<Node> d_register_term_cache;
+  backtrack::NodeIdSet d_register_term_cache;
 
   /** Lemmas added via lemma(). */
   std::vector<Node> d_lemmas;
@@ -149,6 +151,8 @@ class SolverEngine
     uint64_t& num_lemmas;
     util::TimerStatistic& time_register_term;
     util::TimerStatistic& time_solve;
+    uint64_t& memory_value_cache;
+    uint64_t& memory_caches;
   } d_stats;
 
   /** Environment. */
@@ -10,10 +10,14 @@
 
 #include "solving_context.h"
 
+#include <sys/resource.h>
+
 #include <cassert>
 
+#include "bv/gmp_pool.h"
 #include "check/check_model.h"
 #include "check/check_unsat_core.h"
+#include "node/node_manager.h"
 #include "node/node_ref_vector.h"
 #include "node/unordered_node_ref_set.h"
 
@@ -66,6 +70,12 @@ SolvingContext::solve()
     Warn(!res) << "unsat core check failed";
   }
 
+  const auto& nm_stats        = NodeManager::get().statistics();
+  d_stats.num_nodes_live      = nm_stats.num_nodes_live;
+  d_stats.num_nodes_peak      = nm_stats.num_nodes_peak;
+  d_stats.num_node_ids_reused = nm_stats.num_ids_reused;
+  update_memory_statistics();
+
   return d_sat_state;
 }
 
@@ -264,6 +274,38 @@ SolvingContext::compute_formula_statistics(util::HistogramStatistic& stat)
   }
 }
 
+void
+SolvingContext::update_memory_statistics()
+{
+  const NodeManager& nm      = NodeManager::get();
+  const auto& bytes_per_kind = nm.statistics().num_bytes_per_kind;
+  d_stats.memory_node_manager = nm.memory_usage();
+  for (size_t i = 0, size = bytes_per_kind.size(); i < size; ++i)
+  {
+    d_stats.memory_nodes.set(static_cast<Kind>(i), bytes_per_kind[i]);
+  }
+
+  // Maximum resident set size of the process, which includes the memory of
+  // components that do not provide their own accounting, e.g., SAT solvers.
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+  {
+#ifdef __APPLE__
+    d_stats.memory_max_rss = static_cast<uint64_t>(usage.ru_maxrss);
+#else
+    d_stats.memory_max_rss = static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+  }
+
+  // Allocations of GMP values on this thread, including those of other
+  // solving contexts on this thread. Only recorded if the pooled allocator is
+  // installed (by the bitwuzla binary, see GMPPool).
+  const auto& gmp_stats     = GMPPool::statistics();
+  d_stats.gmp_num_allocs    = gmp_stats.num_allocs;
+  d_stats.gmp_num_pool_hits = gmp_stats.num_pool_hits;
+  d_stats.gmp_memory_cached = gmp_stats.num_bytes_cached;
+}
+
 void
 SolvingContext::ensure_model()
 {
@@ -308,7 +350,19 @@ SolvingContext::Statistics::Statistics(util::Statistics& stats)
       formula_kinds_pre(
           stats.new_stat<util::HistogramStatistic>("formula::pre::node")),
       formula_kinds_post(
-          stats.new_stat<util::HistogramStatistic>("formula::post::node"))
+          stats.new_stat<util::HistogramStatistic>("formula::post::node")),
+      num_nodes_live(stats.new_stat<uint64_t>("node_manager::num_nodes_live")),
+      num_nodes_peak(stats.new_stat<uint64_t>("node_manager::num_nodes_peak")),
+      num_node_ids_reused(
+          stats.new_stat<uint64_t>("node_manager::num_node_ids_reused")),
+      memory_node_manager(
+          stats.new_stat<uint64_t>("node_manager::memory::total")),
+      memory_nodes(stats.new_stat<util::HistogramStatistic>(
+          "node_manager::memory::kind")),
+      memory_max_rss(stats.new_stat<uint64_t>("memory::max_rss")),
+      gmp_num_allocs(stats.new_stat<uint64_t>("gmp::num_allocs")),
+      gmp_num_pool_hits(stats.new_stat<uint64_t>("gmp::num_pool_hits")),
+      gmp_memory_cached(stats.new_stat<uint64_t>("gmp::memory::cached"))
 {
 }
 
@@ -83,6 +83,12 @@ class SolvingContext
 
   void ensure_model();
 
+  /**
+   * Sample memory statistics of the node manager, the process and the GMP
+   * allocator.
+   */
+  void update_memory_statistics();
+
   /** Solving context environment. */
   Env d_env;
   /** Logger instance. */
@@ -112,6 +118,15 @@ class SolvingContext
     util::TimerStatistic& time_solve;
     util::HistogramStatistic& formula_kinds_pre;
     util::HistogramStatistic& formula_kinds_post;
+    uint64_t& num_nodes_live;
+    uint64_t& num_nodes_peak;
+    uint64_t& num_node_ids_reused;
+    uint64_t& memory_node_manager;
+    util::HistogramStatistic& memory_nodes;
+    uint64_t& memory_max_rss;
+    uint64_t& gmp_num_allocs;
+    uint64_t& gmp_num_pool_hits;
+    uint64_t& gmp_memory_cached;
   } d_stats;
 };
 
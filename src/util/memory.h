@@ -0,0 +1,73 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_UTIL_MEMORY_H_INCLUDED
+#define BZLA_UTIL_MEMORY_H_INCLUDED
+
+#include <cstddef>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Estimates of the heap memory allocated by standard containers.
+ *
+ * The estimates only consider the memory directly owned by the container and
+ * not memory owned by its elements. Node based containers are assumed to
+ * store a next pointer and the cached hash value with each element, which is
+ * the layout of libstdc++ and libc++.
+ */
+namespace bzla::util {
+
+/** @return The number of bytes allocated by given vector. */
+template <class T, class A>
+size_t
+memory_usage(const std::vector<T, A>& vector)
+{
+  return vector.capacity() * sizeof(T);
+}
+
+/** @return The number of bytes allocated by given bit vector. */
+template <class A>
+size_t
+memory_usage(const std::vector<bool, A>& vector)
+{
+  return vector.capacity() / 8;
+}
+
+/** @return The number of bytes allocated by a hash table with given size. */
+template <class V>
+size_t
+memory_usage_hash_table(size_t size, size_t bucket_count)
+{
+  return bucket_count * sizeof(void*)
+         + size * (sizeof(V) + sizeof(void*) + sizeof(size_t));
+}
+
+/** @return The number of bytes allocated by given unordered map. */
+template <class K, class V, class H, class E, class A>
+size_t
+memory_usage(const std::unordered_map<K, V, H, E, A>& map)
+{
+  return memory_usage_hash_table<std::pair<const K, V>>(map.size(),
+                                                        map.bucket_count());
+}
+
+/** @return The number of bytes allocated by given unordered set. */
+template <class K, class H, class E, class A>
+size_t
+memory_usage(const std::unordered_set<K, H, E, A>& set)
+{
+  return memory_usage_hash_table<K>(set.size(), set.bucket_count());
+}
+
+}  // namespace bzla::util
+
+#endif
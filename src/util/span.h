@@ -0,0 +1,95 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_UTIL_SPAN_H_INCLUDED
+#define BZLA_UTIL_SPAN_H_INCLUDED
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace bzla::util {
+
+/**
+ * Non-owning view of a contiguous sequence of constant elements (subset of
+ * C++20 std::span).
+ *
+ * Implicitly constructible from std::vector, std::array and braced
+ * initializer lists, which allows to pass small sequences of elements
+ * without allocating a temporary vector.
+ *
+ * @note Spans constructed from an initializer list must not outlive the full
+ *       expression the list was created in, hence spans should only be used
+ *       as function parameters.
+ */
+template <class T>
+class Span
+{
+ public:
+  using value_type     = std::remove_cv_t<T>;
+  using const_iterator = const value_type*;
+  using iterator       = const_iterator;
+
+  Span() = default;
+  Span(const value_type* data, size_t size) : d_data(data), d_size(size) {}
+  Span(std::initializer_list<value_type> list)
+      : d_data(std::data(list)), d_size(list.size())
+  {
+  }
+  Span(const std::vector<value_type>& vector)
+      : d_data(vector.data()), d_size(vector.size())
+  {
+  }
+  template <size_t N>
+  Span(const std::array<value_type, N>& array)
+      : d_data(array.data()), d_size(N)
+  {
+  }
+
+  /** @return The number of elements. */
+  size_t size() const { return d_size; }
+  /** @return True if the span is empty. */
+  bool empty() const { return d_size == 0; }
+  /** @return Pointer to the first element. */
+  const value_type* data() const { return d_data; }
+
+  const value_type& operator[](size_t i) const
+  {
+    assert(i < d_size);
+    return d_data[i];
+  }
+  const value_type& back() const
+  {
+    assert(d_size > 0);
+    return d_data[d_size - 1];
+  }
+
+  iterator begin() const { return d_data; }
+  iterator end() const { return d_data + d_size; }
+
+  /** @return A span of the first `size` elements. */
+  Span first(size_t size) const
+  {
+    assert(size <= d_size);
+    return Span(d_data, size);
+  }
+
+ private:
+  const value_type* d_data = nullptr;
+  size_t d_size            = 0;
+};
+
+}  // namespace bzla::util
+
+#endif
@@ -32,19 +32,14 @@ class HistogramStatistic
   template <typename T>
   void operator<<(const T& val)
   {
-    size_t index = static_cast<size_t>(val);
-    if (index >= d_values.size())
-    {
-      d_values.resize(index + 1);
-      d_names.resize(index + 1);
-    }
-    if (d_names[index].empty())
-    {
-      std::stringstream ss;
-      ss << val;
-      d_names[index] = ss.str();
-    }
-    ++d_values[index];
+    ++d_values[index(val)];
+  }
+
+  /** Set counter for val. */
+  template <typename T>
+  void set(const T& val, uint64_t count)
+  {
+    d_values[index(val)] = count;
   }
 
   template <typename K, typename V>
@@ -64,6 +59,25 @@ class HistogramStatistic
   const std::vector<std::string>& names() const { return d_names; }
 
  private:
+  /** @return The index of the counter for val, created if necessary. */
+  template <typename T>
+  size_t index(const T& val)
+  {
+    size_t index = static_cast<size_t>(val);
+    if (index >= d_values.size())
+    {
+      d_values.resize(index + 1);
+      d_names.resize(index + 1);
+    }
+    if (d_names[index].empty())
+    {
+      std::stringstream ss;
+      ss << val;
+      d_names[index] = ss.str();
+    }
+    return index;
+  }
+
   /** Stores counters for values added via operator<<. */
   std::vector<uint64_t> d_values;
   /** Stores names for values added via operator<<. */
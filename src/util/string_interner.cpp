@@ -0,0 +1,175 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "util/string_interner.h"
+
+#include <functional>
+
+namespace bzla::util {
+
+namespace {
+
+/** @return The number of heap allocated bytes of given string. */
+size_t
+heap_bytes(const std::string& str)
+{
+  const char* data = str.data();
+  const char* obj  = reinterpret_cast<const char*>(&str);
+  // Short strings are stored in the string object itself.
+  if (data >= obj && data < obj + sizeof(std::string))
+  {
+    return 0;
+  }
+  return str.capacity() + 1;
+}
+
+}  // namespace
+
+/* --- StringInterner public ------------------------------------------------ */
+
+StringInterner::Handle
+StringInterner::intern(std::string_view str)
+{
+  if ((d_size + 1) * 2 > d_index.size())
+  {
+    grow();
+  }
+
+  uint32_t h = hash(str);
+  size_t pos = find_slot(str, h);
+  if (d_index[pos] != s_null)
+  {
+    Entry& entry = d_entries[d_index[pos] - 1];
+    assert(entry.d_refs > 0);
+    ++entry.d_refs;
+    return d_index[pos];
+  }
+
+  Handle handle;
+  if (d_free.empty())
+  {
+    assert(d_entries.size() < UINT32_MAX);
+    d_entries.emplace_back();
+    handle = static_cast<Handle>(d_entries.size());
+  }
+  else
+  {
+    handle = d_free.back();
+    d_free.pop_back();
+  }
+  Entry& entry = d_entries[handle - 1];
+  entry.d_str.assign(str.data(), str.size());
+  entry.d_hash = h;
+  entry.d_refs = 1;
+  d_heap_bytes += heap_bytes(entry.d_str);
+  d_index[pos] = handle;
+  ++d_size;
+  return handle;
+}
+
+void
+StringInterner::acquire(Handle handle)
+{
+  assert(handle != s_null && handle <= d_entries.size());
+  assert(d_entries[handle - 1].d_refs > 0);
+  ++d_entries[handle - 1].d_refs;
+}
+
+void
+StringInterner::release(Handle handle)
+{
+  assert(handle != s_null && handle <= d_entries.size());
+  Entry& entry = d_entries[handle - 1];
+  assert(entry.d_refs > 0);
+  if (--entry.d_refs > 0)
+  {
+    return;
+  }
+
+  // Remove from index and shift back elements of the probe sequence.
+  size_t mask = d_index.size() - 1;
+  size_t pos  = find_slot(entry.d_str, entry.d_hash);
+  assert(d_index[pos] == handle);
+  size_t next = (pos + 1) & mask;
+  while (d_index[next] != s_null)
+  {
+    size_t home = d_entries[d_index[next] - 1].d_hash & mask;
+    // Move element if its home slot is not in the cyclic range (pos, next].
+    if (((next - home) & mask) >= ((next - pos) & mask))
+    {
+      d_index[pos] = d_index[next];
+      pos          = next;
+    }
+    next = (next + 1) & mask;
+  }
+  d_index[pos] = s_null;
+
+  d_heap_bytes -= heap_bytes(entry.d_str);
+  std::string().swap(entry.d_str);
+  d_free.push_back(handle);
+  --d_size;
+}
+
+size_t
+StringInterner::memory_usage() const
+{
+  return d_entries.size() * sizeof(Entry) + d_free.capacity() * sizeof(Handle)
+         + d_index.capacity() * sizeof(Handle) + d_heap_bytes;
+}
+
+/* --- StringInterner private ----------------------------------------------- */
+
+uint32_t
+StringInterner::hash(std::string_view str)
+{
+  uint64_t h = std::hash<std::string_view>{}(str);
+  return static_cast<uint32_t>(h ^ (h >> 32));
+}
+
+size_t
+StringInterner::find_slot(std::string_view str, uint32_t hash) const
+{
+  assert(!d_index.empty());
+  size_t mask = d_index.size() - 1;
+  size_t pos  = hash & mask;
+  while (d_index[pos] != s_null)
+  {
+    const Entry& entry = d_entries[d_index[pos] - 1];
+    if (entry.d_hash == hash && entry.d_str == str)
+    {
+      break;
+    }
+    pos = (pos + 1) & mask;
+  }
+  return pos;
+}
+
+void
+StringInterner::grow()
+{
+  std::vector<Handle> index(d_index.empty() ? 64 : d_index.size() * 2,
+                            s_null);
+  size_t mask = index.size() - 1;
+  for (Handle handle : d_index)
+  {
+    if (handle != s_null)
+    {
+      size_t pos = d_entries[handle - 1].d_hash & mask;
+      while (index[pos] != s_null)
+      {
+        pos = (pos + 1) & mask;
+      }
+      index[pos] = handle;
+    }
+  }
+  d_index.swap(index);
+}
+
+}  // namespace bzla::util
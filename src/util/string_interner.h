@@ -0,0 +1,110 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_UTIL_STRING_INTERNER_H_INCLUDED
+#define BZLA_UTIL_STRING_INTERNER_H_INCLUDED
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace bzla::util {
+
+/**
+ * Reference counted storage of unique strings.
+ *
+ * Each distinct string is stored once and identified by a 32-bit handle,
+ * which allows to attach strings to objects without a separate lookup
+ * table. Handle 0 represents no string. References to stored strings stay
+ * valid until the last reference to the handle is released, after which the
+ * handle is reused for subsequently interned strings.
+ */
+class StringInterner
+{
+ public:
+  using Handle = uint32_t;
+
+  /** The handle that represents no string. */
+  static constexpr Handle s_null = 0;
+
+  /**
+   * Intern string and acquire a reference to it.
+   * @param str The string to intern.
+   * @return The handle of the stored string.
+   */
+  Handle intern(std::string_view str);
+  /**
+   * Acquire an additional reference to given handle.
+   * @param handle The handle of a stored string.
+   */
+  void acquire(Handle handle);
+  /**
+   * Release a reference to given handle. The string is removed if this was
+   * the last reference.
+   * @param handle The handle of a stored string.
+   */
+  void release(Handle handle);
+
+  /**
+   * @param handle The handle of a stored string.
+   * @return The stored string.
+   */
+  const std::string& get(Handle handle) const
+  {
+    assert(handle != s_null && handle <= d_entries.size());
+    return d_entries[handle - 1].d_str;
+  }
+
+  /** @return The number of stored strings. */
+  size_t size() const { return d_size; }
+
+  /** @return The number of bytes allocated by the interner. */
+  size_t memory_usage() const;
+
+ private:
+  struct Entry
+  {
+    /** The stored string, empty if the entry is unused. */
+    std::string d_str;
+    /** The hash value of the stored string. */
+    uint32_t d_hash = 0;
+    /** The number of references, 0 if the entry is unused. */
+    uint32_t d_refs = 0;
+  };
+
+  static uint32_t hash(std::string_view str);
+
+  /**
+   * Find position of given string in the index, or the position of the empty
+   * slot it would be stored in if it is not stored.
+   */
+  size_t find_slot(std::string_view str, uint32_t hash) const;
+  /** Double the size of the index. */
+  void grow();
+
+  /** The stored strings, indexed by handle - 1. */
+  std::deque<Entry> d_entries;
+  /** Handles of unused entries. */
+  std::vector<Handle> d_free;
+  /** Linear probing hash index over handles, s_null marks empty slots. */
+  std::vector<Handle> d_index;
+  /** The number of stored strings. */
+  size_t d_size = 0;
+  /** The number of bytes of string data allocated on the heap. */
+  size_t d_heap_bytes = 0;
+};
+
+}  // namespace bzla::util
+
+#endif
@@ -0,0 +1,108 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "bitblast/aig/aig_cnf.h"
+#include "bitblast/aig_bitblaster.h"
+
+/* -------------------------------------------------------------------------- */
+
+// Measures bit-blasting chains of multiplications and divisions into AIGs,
+// and encoding them to CNF, together with the memory used by the AIG manager
+// per AND gate.
+
+namespace bzla::bench {
+
+namespace {
+
+/** SAT interface that only counts the added literals. */
+class CountingSat : public bb::SatInterface
+{
+ public:
+  void add(int64_t lit) override { d_num_lits += lit != 0; }
+  void add_clause(const std::initializer_list<int64_t>& literals) override
+  {
+    d_num_lits += literals.size();
+  }
+  bool value(int64_t lit) override
+  {
+    (void) lit;
+    return false;
+  }
+  uint64_t d_num_lits = 0;
+};
+
+/** Bit-blast a chain of `depth` multiplications and divisions. */
+bb::AigBitblaster::Bits
+mk_chain(bb::AigBitblaster& bb, uint64_t size, uint64_t depth)
+{
+  auto a   = bb.bv_constant(size);
+  auto b   = bb.bv_constant(size);
+  auto res = bb.bv_mul(a, b);
+  for (uint64_t i = 1; i < depth; ++i)
+  {
+    res = i % 2 ? bb.bv_udiv(res, a) : bb.bv_mul(res, b);
+  }
+  return res;
+}
+
+void
+BM_aig_bitblast(benchmark::State& state)
+{
+  uint64_t size  = static_cast<uint64_t>(state.range(0));
+  uint64_t depth = static_cast<uint64_t>(state.range(1));
+  uint64_t ands = 0, bytes = 0;
+  for (auto _ : state)
+  {
+    bb::AigBitblaster bb;
+    auto bits = mk_chain(bb, size, depth);
+    benchmark::DoNotOptimize(bits);
+    ands  = bb.num_aig_ands();
+    bytes = bb.aig_memory_usage();
+  }
+  state.counters["ands"]           = static_cast<double>(ands);
+  state.counters["bytes_per_and"] = static_cast<double>(bytes) / ands;
+}
+
+void
+BM_aig_cnf_encode(benchmark::State& state)
+{
+  uint64_t size  = static_cast<uint64_t>(state.range(0));
+  uint64_t depth = static_cast<uint64_t>(state.range(1));
+  bb::AigBitblaster bb;
+  auto bits = mk_chain(bb, size, depth);
+  for (auto _ : state)
+  {
+    CountingSat sat;
+    bb::AigCnfEncoder cnf(bb.aig_manager(), sat);
+    for (const auto& bit : bits)
+    {
+      cnf.encode(bit);
+    }
+    benchmark::DoNotOptimize(sat.d_num_lits);
+  }
+  state.SetItemsProcessed(state.iterations() * bb.num_aig_ands());
+}
+
+}  // namespace
+
+/* -------------------------------------------------------------------------- */
+
+BENCHMARK(BM_aig_bitblast)
+    ->ArgsProduct({{32, 64}, {4, 16}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_aig_cnf_encode)
+    ->ArgsProduct({{32, 64}, {4, 16}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace bzla::bench
+
+BENCHMARK_MAIN();
@@ -0,0 +1,65 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "bitblast/aig/aig_simulator.h"
+#include "bitblast/aig_bitblaster.h"
+
+/* -------------------------------------------------------------------------- */
+
+// Measures the throughput of bit-parallel random simulation in patterns per
+// second over bit-blasted multiplications and divisions, with 1 (64 patterns)
+// and 4 (256 patterns) words per signature.
+
+namespace bzla::bench {
+
+namespace {
+
+enum class Op
+{
+  MUL,
+  UDIV,
+};
+
+template <Op op>
+void
+BM_aig_simulate(benchmark::State& state)
+{
+  bb::AigBitblaster bb;
+  uint64_t size = static_cast<uint64_t>(state.range(1));
+  auto a        = bb.bv_constant(size);
+  auto b        = bb.bv_constant(size);
+  auto bits     = op == Op::MUL ? bb.bv_mul(a, b) : bb.bv_udiv(a, b);
+  std::vector<bb::AigNode> roots(bits.begin(), bits.end());
+
+  bb::AigSimulator sim(
+      bb.aig_manager(), roots, static_cast<size_t>(state.range(0)));
+  for (auto _ : state)
+  {
+    sim.simulate();
+    benchmark::DoNotOptimize(sim.signature(roots.back()));
+  }
+  state.SetItemsProcessed(state.iterations() * sim.num_patterns());
+  state.counters["ands"] = sim.num_ands();
+}
+
+}  // namespace
+
+/* -------------------------------------------------------------------------- */
+
+BENCHMARK(BM_aig_simulate<Op::MUL>)->ArgsProduct({{1, 4}, {16, 32, 64}});
+BENCHMARK(BM_aig_simulate<Op::UDIV>)->ArgsProduct({{1, 4}, {16, 32, 64}});
+
+}  // namespace bzla::bench
+
+BENCHMARK_MAIN();
@@ -0,0 +1,184 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+#include <bitwuzla/cpp/bitwuzla.h>
+#include <bitwuzla/cpp/parser.h>
+
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include "bitblast/aig/aig_cnf.h"
+#include "bitblast/aig_bitblaster.h"
+
+/* -------------------------------------------------------------------------- */
+
+// Measures bit-blasting multiplications with the different multiplier
+// encodings, together with the size of the resulting AIG and CNF.
+// The first argument selects the encoding (array, Dadda, Karatsuba), the
+// second the bit-width.
+//
+// BM_mul_regress solves the regression instances with multiplications via
+// the API with each value of option mul-encoding, and reports the size of the
+// CNF and the SAT solving time. The first argument selects the encoding
+// (array, Dadda, Karatsuba, auto), the second the instance.
+
+namespace bzla::bench {
+
+namespace {
+
+/** SAT interface that only counts the added clauses and literals. */
+class CountingSat : public bb::SatInterface
+{
+ public:
+  void add(int64_t lit) override
+  {
+    d_num_lits += lit != 0;
+    d_num_clauses += lit == 0;
+  }
+  void add_clause(const std::initializer_list<int64_t>& literals) override
+  {
+    d_num_lits += literals.size();
+    d_num_clauses += 1;
+  }
+  bool value(int64_t lit) override
+  {
+    (void) lit;
+    return false;
+  }
+  uint64_t d_num_lits    = 0;
+  uint64_t d_num_clauses = 0;
+};
+
+const bb::MulEncoding s_encodings[] = {
+    bb::MulEncoding::ARRAY, bb::MulEncoding::DADDA, bb::MulEncoding::KARATSUBA};
+
+/** The values of option mul-encoding. */
+const char* s_encoding_names[] = {"array", "dadda", "karatsuba", "auto"};
+
+/**
+ * Regression instances with multiplications of different bit-widths,
+ * relative to test/regress/solver/bv.
+ */
+const char* s_regress_instances[] = {
+    "mul4mod.btor.smt2",
+    "calprob14sat5ksimp.btor.smt2",
+    "davidcokchallenge.smt2",
+    "sqrt18446744073709551617.btor.smt2",
+    "palsqr58.smt2",
+    "factor18446744073709551617.btor.smt2",
+    "distri4.btor.smt2",
+};
+
+void
+BM_mul_bitblast(benchmark::State& state)
+{
+  bb::MulEncoding encoding = s_encodings[state.range(0)];
+  uint64_t size            = static_cast<uint64_t>(state.range(1));
+  uint64_t ands            = 0;
+  for (auto _ : state)
+  {
+    bb::AigBitblaster bb;
+    bb.set_mul_encoding(encoding);
+    auto a    = bb.bv_constant(size);
+    auto b    = bb.bv_constant(size);
+    auto bits = bb.bv_mul(a, b);
+    benchmark::DoNotOptimize(bits);
+    ands = bb.num_aig_ands();
+  }
+  state.counters["ands"] = static_cast<double>(ands);
+}
+
+void
+BM_mul_cnf_encode(benchmark::State& state)
+{
+  bb::MulEncoding encoding = s_encodings[state.range(0)];
+  uint64_t size            = static_cast<uint64_t>(state.range(1));
+  bb::AigBitblaster bb;
+  bb.set_mul_encoding(encoding);
+  auto a    = bb.bv_constant(size);
+  auto b    = bb.bv_constant(size);
+  auto bits = bb.bv_mul(a, b);
+  uint64_t clauses = 0, lits = 0;
+  for (auto _ : state)
+  {
+    CountingSat sat;
+    bb::AigCnfEncoder cnf(bb.aig_manager(), sat);
+    for (const auto& bit : bits)
+    {
+      cnf.encode(bit);
+    }
+    clauses = sat.d_num_clauses;
+    lits    = sat.d_num_lits;
+  }
+  state.counters["clauses"] = static_cast<double>(clauses);
+  state.counters["lits"]    = static_cast<double>(lits);
+}
+
+void
+BM_mul_regress(benchmark::State& state)
+{
+  const char* encoding = s_encoding_names[state.range(0)];
+  const char* instance = s_regress_instances[state.range(1)];
+  std::string infile_name =
+      std::string(BZLA_REGRESS_DIR) + "/solver/bv/" + instance;
+  state.SetLabel(std::string(encoding) + " " + instance);
+
+  std::map<std::string, std::string> stats;
+  uint64_t solve_ms = 0;
+  // The parser prints check-sat results to std::cout.
+  std::stringstream out;
+  std::streambuf* cout_buf = std::cout.rdbuf(out.rdbuf());
+  for (auto _ : state)
+  {
+    bitwuzla::Options options;
+    options.set(bitwuzla::Option::MUL_ENCODING, encoding);
+    bitwuzla::parser::Parser parser(options, infile_name);
+    std::string err = parser.parse();
+    if (!err.empty())
+    {
+      std::cout.rdbuf(cout_buf);
+      state.SkipWithError(err.c_str());
+      return;
+    }
+    stats = parser.bitwuzla()->statistics();
+    solve_ms += std::stoull(stats["bv::bitblast::sat::time_solve"]);
+  }
+  std::cout.rdbuf(cout_buf);
+  state.counters["vars"] =
+      static_cast<double>(std::stoull(stats["bv::bitblast::cnf::num_vars"]));
+  state.counters["clauses"] = static_cast<double>(
+      std::stoull(stats["bv::bitblast::cnf::num_clauses"]));
+  state.counters["solve_ms"] = benchmark::Counter(
+      static_cast<double>(solve_ms), benchmark::Counter::kAvgIterations);
+}
+
+}  // namespace
+
+/* -------------------------------------------------------------------------- */
+
+BENCHMARK(BM_mul_bitblast)
+    ->ArgsProduct({{0, 1, 2}, {16, 32, 64, 128, 256}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_mul_cnf_encode)
+    ->ArgsProduct({{0, 1, 2}, {16, 32, 64, 128, 256}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_mul_regress)
+    ->ArgsProduct({{0, 1, 2, 3},
+                   benchmark::CreateDenseRange(
+                       0, std::size(s_regress_instances) - 1, 1)})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace bzla::bench
+
+BENCHMARK_MAIN();
@@ -0,0 +1,339 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+#include <gmpxx.h>
+
+#include <cassert>
+#include <vector>
+
+#include "bv/bitvector.h"
+#include "bv/gmp_pool.h"
+#include "bv/limb_kernels.h"
+#include "rng/rng.h"
+
+/* -------------------------------------------------------------------------- */
+
+// Compares the throughput of bit-vector operations on the fixed-limb
+// representation (sizes 65 to 256) against the same operations on GMP values
+// as performed for bit-vectors that wrap a GMP value. The GMP baseline mirrors
+// the non-inplace BitVector operations, i.e., it initializes a fresh result
+// value, applies the operation and truncates the result to the bit-width.
+//
+// Further measures limb-wise operations on wide bit-vectors, the limb
+// kernels of each supported instruction set, and the GMP allocations of
+// chained operations on lvalues and rvalues.
+
+namespace bzla::bench {
+
+namespace {
+
+constexpr size_t s_num_values = 1024;
+
+enum class Op
+{
+  ADD,
+  MUL,
+  UDIV,
+  SHL,
+  ULT,
+  AND,
+  OR,
+  XOR,
+  NOT,
+  COMPARE,
+  IS_ONES,
+  CLO,
+  MODINV,
+  UDIV_POW2,
+  UREM_CONST,
+};
+
+/** Generate `s_num_values` random bit-vectors of given size. */
+std::vector<BitVector>
+mk_values(uint64_t size, uint32_t seed)
+{
+  RNG rng(seed);
+  std::vector<BitVector> res;
+  res.reserve(s_num_values);
+  for (size_t i = 0; i < s_num_values; ++i)
+  {
+    // Divide by small and large values.
+    BitVector bv(size, rng);
+    if (i % 2)
+    {
+      bv.ibvshr(rng.pick<uint64_t>(0, size - 1));
+    }
+    res.push_back(bv);
+  }
+  return res;
+}
+
+template <Op op>
+void
+BM_bv(benchmark::State& state)
+{
+  uint64_t size              = static_cast<uint64_t>(state.range(0));
+  std::vector<BitVector> lhs = mk_values(size, 42);
+  std::vector<BitVector> rhs = mk_values(size, 7);
+  uint64_t shift             = size / 3;
+  BitVector pow2             = BitVector::mk_one(size).ibvshl(shift);
+  BitVector cst              = BitVector::from_ui(size, 10, true);
+  if (op == Op::MODINV)
+  {
+    for (BitVector& bv : lhs)
+    {
+      bv.set_bit(0, true);
+    }
+  }
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < s_num_values; ++i)
+    {
+      const BitVector& a = lhs[i];
+      const BitVector& b = rhs[i];
+      switch (op)
+      {
+        case Op::ADD: benchmark::DoNotOptimize(a.bvadd(b)); break;
+        case Op::MUL: benchmark::DoNotOptimize(a.bvmul(b)); break;
+        case Op::UDIV: benchmark::DoNotOptimize(a.bvudiv(b)); break;
+        case Op::SHL: benchmark::DoNotOptimize(a.bvshl(shift)); break;
+        case Op::ULT: benchmark::DoNotOptimize(a.bvult(b)); break;
+        case Op::AND: benchmark::DoNotOptimize(a.bvand(b)); break;
+        case Op::OR: benchmark::DoNotOptimize(a.bvor(b)); break;
+        case Op::XOR: benchmark::DoNotOptimize(a.bvxor(b)); break;
+        case Op::NOT: benchmark::DoNotOptimize(a.bvnot()); break;
+        case Op::COMPARE: benchmark::DoNotOptimize(a.compare(b)); break;
+        case Op::IS_ONES: benchmark::DoNotOptimize(a.is_ones()); break;
+        case Op::CLO: benchmark::DoNotOptimize(a.count_leading_ones()); break;
+        case Op::MODINV: benchmark::DoNotOptimize(a.bvmodinv()); break;
+        case Op::UDIV_POW2: benchmark::DoNotOptimize(a.bvudiv(pow2)); break;
+        case Op::UREM_CONST: benchmark::DoNotOptimize(a.bvurem(cst)); break;
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * s_num_values);
+}
+
+template <Op op>
+void
+BM_gmp(benchmark::State& state)
+{
+  uint64_t size = static_cast<uint64_t>(state.range(0));
+  std::vector<mpz_class> lhs, rhs;
+  for (const BitVector& bv : mk_values(size, 42))
+  {
+    lhs.emplace_back(bv.str(16), 16);
+  }
+  for (const BitVector& bv : mk_values(size, 7))
+  {
+    rhs.emplace_back(bv.str(16), 16);
+  }
+  uint64_t shift = size / 3;
+  mpz_class mod, pow2, cst(10);
+  mpz_ui_pow_ui(mod.get_mpz_t(), 2, size);
+  mpz_ui_pow_ui(pow2.get_mpz_t(), 2, shift);
+  if (op == Op::MODINV)
+  {
+    for (mpz_class& val : lhs)
+    {
+      mpz_setbit(val.get_mpz_t(), 0);
+    }
+  }
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < s_num_values; ++i)
+    {
+      mpz_srcptr a = lhs[i].get_mpz_t();
+      mpz_srcptr b = rhs[i].get_mpz_t();
+      mpz_t res;
+      mpz_init(res);
+      switch (op)
+      {
+        case Op::ADD:
+          mpz_add(res, a, b);
+          mpz_fdiv_r_2exp(res, res, size);
+          break;
+        case Op::MUL:
+          mpz_mul(res, a, b);
+          mpz_fdiv_r_2exp(res, res, size);
+          break;
+        case Op::UDIV:
+          if (mpz_sgn(b))
+          {
+            mpz_fdiv_q(res, a, b);
+          }
+          break;
+        case Op::SHL:
+          mpz_mul_2exp(res, a, shift);
+          mpz_fdiv_r_2exp(res, res, size);
+          break;
+        case Op::ULT: mpz_set_ui(res, mpz_cmp(a, b) < 0); break;
+        case Op::MODINV: mpz_invert(res, a, mod.get_mpz_t()); break;
+        case Op::UDIV_POW2: mpz_fdiv_q(res, a, pow2.get_mpz_t()); break;
+        case Op::UREM_CONST: mpz_fdiv_r(res, a, cst.get_mpz_t()); break;
+        default: assert(false);
+      }
+      benchmark::DoNotOptimize(res);
+      mpz_clear(res);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * s_num_values);
+}
+
+/**
+ * Apply the limb kernels of the instruction set given as first argument to
+ * arrays of limbs of the bit-width given as second argument.
+ */
+template <Op op>
+void
+BM_limb_kernel(benchmark::State& state)
+{
+  const LimbKernels* k =
+      LimbKernels::get(static_cast<LimbKernels::Isa>(state.range(0)));
+  if (k == nullptr)
+  {
+    state.SkipWithError("instruction set not supported");
+    return;
+  }
+  size_t n = static_cast<size_t>(state.range(1)) / 64;
+  RNG rng(42);
+  std::vector<uint64_t> a(n), b(n), res(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    // Only differ in the least significant limb to compare all limbs.
+    a[i] = rng.pick<uint64_t>();
+    b[i] = i > 0 ? a[i] : rng.pick<uint64_t>();
+  }
+  for (auto _ : state)
+  {
+    switch (op)
+    {
+      case Op::AND: k->bvand(res.data(), a.data(), b.data(), n); break;
+      case Op::XOR: k->bvxor(res.data(), a.data(), b.data(), n); break;
+      case Op::NOT: k->bvnot(res.data(), a.data(), n); break;
+      case Op::COMPARE:
+        benchmark::DoNotOptimize(k->cmp(a.data(), b.data(), n));
+        break;
+      case Op::IS_ONES:
+        benchmark::DoNotOptimize(k->is_ones(a.data(), n));
+        break;
+      default: assert(false);
+    }
+    benchmark::DoNotOptimize(res.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+/** Arguments for the limb kernel benchmarks, instruction set and bit-width. */
+/**
+ * Compute `((a + b) * b - a) >> 1` for bit-vectors of the given size, either
+ * on named intermediate results (lvalues), or chained on rvalues, and report
+ * the number of GMP allocations per computation.
+ */
+template <bool rvalue>
+void
+BM_chain(benchmark::State& state)
+{
+  GMPPool::Scope scope;
+  uint64_t size              = static_cast<uint64_t>(state.range(0));
+  std::vector<BitVector> lhs = mk_values(size, 42);
+  std::vector<BitVector> rhs = mk_values(size, 7);
+  uint64_t num_allocs        = GMPPool::statistics().num_allocs;
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < s_num_values; ++i)
+    {
+      const BitVector& a = lhs[i];
+      const BitVector& b = rhs[i];
+      if (rvalue)
+      {
+        benchmark::DoNotOptimize(a.bvadd(b).bvmul(b).bvsub(a).bvshr(1));
+      }
+      else
+      {
+        BitVector add = a.bvadd(b);
+        BitVector mul = add.bvmul(b);
+        BitVector sub = mul.bvsub(a);
+        benchmark::DoNotOptimize(sub.bvshr(1));
+      }
+    }
+  }
+  uint64_t num_items = state.iterations() * s_num_values;
+  state.SetItemsProcessed(num_items);
+  state.counters["allocs"] = benchmark::Counter(
+      static_cast<double>(GMPPool::statistics().num_allocs - num_allocs)
+      / num_items);
+}
+
+void
+limb_kernel_args(benchmark::internal::Benchmark* b)
+{
+  for (auto isa : {LimbKernels::Isa::PORTABLE,
+                   LimbKernels::Isa::SSE2,
+                   LimbKernels::Isa::AVX2})
+  {
+    for (int64_t size = 64; size <= 4096; size *= 2)
+    {
+      b->Args({static_cast<int64_t>(isa), size});
+    }
+  }
+}
+
+}  // namespace
+
+/* -------------------------------------------------------------------------- */
+
+#define BZLA_BENCH_BV_OP(op)                                               \
+  BENCHMARK(BM_bv<op>)->Arg(128)->Arg(192)->Arg(256)->Arg(320)->Arg(512); \
+  BENCHMARK(BM_gmp<op>)->Arg(128)->Arg(192)->Arg(256)->Arg(320)->Arg(512);
+
+BZLA_BENCH_BV_OP(Op::ADD)
+BZLA_BENCH_BV_OP(Op::MUL)
+BZLA_BENCH_BV_OP(Op::UDIV)
+BZLA_BENCH_BV_OP(Op::SHL)
+BZLA_BENCH_BV_OP(Op::ULT)
+
+// Modular inverse via Newton iteration and divisions by constants, compared
+// against GMP's generic inverse and division, over widths 8 to 1024.
+#define BZLA_BENCH_BV_CONST_OP(op)                                      \
+  BENCHMARK(BM_bv<op>)->RangeMultiplier(2)->Range(8, 1024)->Arg(192); \
+  BENCHMARK(BM_gmp<op>)->RangeMultiplier(2)->Range(8, 1024)->Arg(192);
+
+BZLA_BENCH_BV_CONST_OP(Op::MODINV)
+BZLA_BENCH_BV_CONST_OP(Op::UDIV_POW2)
+BZLA_BENCH_BV_CONST_OP(Op::UREM_CONST)
+
+// Limb-wise operations over widths 64 to 4096, bit-vectors of size > 256 wrap
+// a GMP value and use the limb kernels.
+#define BZLA_BENCH_BV_LIMBWISE_OP(op) \
+  BENCHMARK(BM_bv<op>)->RangeMultiplier(2)->Range(64, 4096);
+
+BZLA_BENCH_BV_LIMBWISE_OP(Op::AND)
+BZLA_BENCH_BV_LIMBWISE_OP(Op::OR)
+BZLA_BENCH_BV_LIMBWISE_OP(Op::XOR)
+BZLA_BENCH_BV_LIMBWISE_OP(Op::NOT)
+BZLA_BENCH_BV_LIMBWISE_OP(Op::COMPARE)
+BZLA_BENCH_BV_LIMBWISE_OP(Op::IS_ONES)
+BZLA_BENCH_BV_LIMBWISE_OP(Op::CLO)
+
+BENCHMARK(BM_chain<false>)->Arg(64)->Arg(256)->Arg(512)->Arg(2048);
+BENCHMARK(BM_chain<true>)->Arg(64)->Arg(256)->Arg(512)->Arg(2048);
+
+BENCHMARK(BM_limb_kernel<Op::AND>)->Apply(limb_kernel_args);
+BENCHMARK(BM_limb_kernel<Op::XOR>)->Apply(limb_kernel_args);
+BENCHMARK(BM_limb_kernel<Op::NOT>)->Apply(limb_kernel_args);
+BENCHMARK(BM_limb_kernel<Op::COMPARE>)->Apply(limb_kernel_args);
+BENCHMARK(BM_limb_kernel<Op::IS_ONES>)->Apply(limb_kernel_args);
+
+}  // namespace bzla::bench
+
+BENCHMARK_MAIN();
@@ -0,0 +1,361 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include "bv/bitvector.h"
+#include "rng/rng.h"
+
+/* -------------------------------------------------------------------------- */
+
+// Measures the throughput of all BitVector operations at bit-widths 8, 32, 64
+// (single 64-bit value), 128, 256 (fixed number of limbs) and 1024 (GMP
+// value), in their non-inplace and in-place versions. Intended for tracking
+// performance across versions, e.g., via
+// `--benchmark_out=bv.json --benchmark_out_format=json`.
+
+namespace bzla::bench {
+
+namespace {
+
+constexpr size_t s_num_values = 256;
+
+enum class Op
+{
+  NEG,
+  NOT,
+  INC,
+  DEC,
+  REDAND,
+  REDOR,
+  ADD,
+  SUB,
+  AND,
+  NAND,
+  NOR,
+  OR,
+  XNOR,
+  XOR,
+  EQ,
+  NE,
+  ULT,
+  ULE,
+  UGT,
+  UGE,
+  SLT,
+  SLE,
+  SGT,
+  SGE,
+  SHL,
+  SHL_UINT,
+  SHR,
+  SHR_UINT,
+  ASHR,
+  ASHR_UINT,
+  MUL,
+  UDIV,
+  UREM,
+  SDIV,
+  SREM,
+  UDIVUREM,
+  CONCAT,
+  EXTRACT,
+  ZEXT,
+  SEXT,
+  MODINV,
+  ITE,
+  COMPARE,
+  SIGNED_COMPARE,
+  IS_UADD_OVERFLOW,
+  IS_UMUL_OVERFLOW,
+  COUNT_LEADING_ZEROS,
+  COUNT_TRAILING_ZEROS,
+  HASH,
+  STR_BIN,
+  STR_DEC,
+  STR_HEX,
+  FROM_STR_BIN,
+  FROM_STR_DEC,
+  FROM_STR_HEX,
+};
+
+/** Operands for bit-vector operations of a given size. */
+struct Operands
+{
+  Operands(uint64_t size)
+  {
+    RNG rng(42);
+    for (size_t i = 0; i < s_num_values; ++i)
+    {
+      BitVector a(size, rng), b(size, rng);
+      // Divide by small and large values.
+      if (i % 2)
+      {
+        b.ibvshr(rng.pick<uint64_t>(0, size - 1));
+      }
+      d_lhs.push_back(a);
+      d_rhs.push_back(b);
+      d_odd.push_back(a);
+      d_odd.back().set_bit(0, true);
+      d_cond.push_back(BitVector::from_ui(1, rng.flip_coin()));
+      d_shift.push_back(rng.pick<uint64_t>(0, size));
+      d_str_bin.push_back(a.str(2));
+      d_str_dec.push_back(a.str(10));
+      d_str_hex.push_back(a.str(16));
+    }
+  }
+  std::vector<BitVector> d_lhs;
+  std::vector<BitVector> d_rhs;
+  std::vector<BitVector> d_odd;
+  std::vector<BitVector> d_cond;
+  std::vector<uint64_t> d_shift;
+  std::vector<std::string> d_str_bin;
+  std::vector<std::string> d_str_dec;
+  std::vector<std::string> d_str_hex;
+};
+
+template <Op op>
+void
+BM_bv_op(benchmark::State& state)
+{
+  uint64_t size = static_cast<uint64_t>(state.range(0));
+  Operands ops(size);
+  uint64_t hi = size - 1, lo = size / 2;
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < s_num_values; ++i)
+    {
+      const BitVector& a = ops.d_lhs[i];
+      const BitVector& b = ops.d_rhs[i];
+      uint64_t shift     = ops.d_shift[i];
+      switch (op)
+      {
+        case Op::NEG: benchmark::DoNotOptimize(a.bvneg()); break;
+        case Op::NOT: benchmark::DoNotOptimize(a.bvnot()); break;
+        case Op::INC: benchmark::DoNotOptimize(a.bvinc()); break;
+        case Op::DEC: benchmark::DoNotOptimize(a.bvdec()); break;
+        case Op::REDAND: benchmark::DoNotOptimize(a.bvredand()); break;
+        case Op::REDOR: benchmark::DoNotOptimize(a.bvredor()); break;
+        case Op::ADD: benchmark::DoNotOptimize(a.bvadd(b)); break;
+        case Op::SUB: benchmark::DoNotOptimize(a.bvsub(b)); break;
+        case Op::AND: benchmark::DoNotOptimize(a.bvand(b)); break;
+        case Op::NAND: benchmark::DoNotOptimize(a.bvnand(b)); break;
+        case Op::NOR: benchmark::DoNotOptimize(a.bvnor(b)); break;
+        case Op::OR: benchmark::DoNotOptimize(a.bvor(b)); break;
+        case Op::XNOR: benchmark::DoNotOptimize(a.bvxnor(b)); break;
+        case Op::XOR: benchmark::DoNotOptimize(a.bvxor(b)); break;
+        case Op::EQ: benchmark::DoNotOptimize(a.bveq(b)); break;
+        case Op::NE: benchmark::DoNotOptimize(a.bvne(b)); break;
+        case Op::ULT: benchmark::DoNotOptimize(a.bvult(b)); break;
+        case Op::ULE: benchmark::DoNotOptimize(a.bvule(b)); break;
+        case Op::UGT: benchmark::DoNotOptimize(a.bvugt(b)); break;
+        case Op::UGE: benchmark::DoNotOptimize(a.bvuge(b)); break;
+        case Op::SLT: benchmark::DoNotOptimize(a.bvslt(b)); break;
+        case Op::SLE: benchmark::DoNotOptimize(a.bvsle(b)); break;
+        case Op::SGT: benchmark::DoNotOptimize(a.bvsgt(b)); break;
+        case Op::SGE: benchmark::DoNotOptimize(a.bvsge(b)); break;
+        case Op::SHL: benchmark::DoNotOptimize(a.bvshl(b)); break;
+        case Op::SHL_UINT: benchmark::DoNotOptimize(a.bvshl(shift)); break;
+        case Op::SHR: benchmark::DoNotOptimize(a.bvshr(b)); break;
+        case Op::SHR_UINT: benchmark::DoNotOptimize(a.bvshr(shift)); break;
+        case Op::ASHR: benchmark::DoNotOptimize(a.bvashr(b)); break;
+        case Op::ASHR_UINT: benchmark::DoNotOptimize(a.bvashr(shift)); break;
+        case Op::MUL: benchmark::DoNotOptimize(a.bvmul(b)); break;
+        case Op::UDIV: benchmark::DoNotOptimize(a.bvudiv(b)); break;
+        case Op::UREM: benchmark::DoNotOptimize(a.bvurem(b)); break;
+        case Op::SDIV: benchmark::DoNotOptimize(a.bvsdiv(b)); break;
+        case Op::SREM: benchmark::DoNotOptimize(a.bvsrem(b)); break;
+        case Op::UDIVUREM:
+        {
+          BitVector q, r;
+          a.bvudivurem(b, &q, &r);
+          benchmark::DoNotOptimize(q);
+          benchmark::DoNotOptimize(r);
+        }
+        break;
+        case Op::CONCAT: benchmark::DoNotOptimize(a.bvconcat(b)); break;
+        case Op::EXTRACT: benchmark::DoNotOptimize(a.bvextract(hi, lo)); break;
+        case Op::ZEXT: benchmark::DoNotOptimize(a.bvzext(size)); break;
+        case Op::SEXT: benchmark::DoNotOptimize(a.bvsext(size)); break;
+        case Op::MODINV:
+          benchmark::DoNotOptimize(ops.d_odd[i].bvmodinv());
+          break;
+        case Op::ITE:
+          benchmark::DoNotOptimize(BitVector::bvite(ops.d_cond[i], a, b));
+          break;
+        case Op::COMPARE: benchmark::DoNotOptimize(a.compare(b)); break;
+        case Op::SIGNED_COMPARE:
+          benchmark::DoNotOptimize(a.signed_compare(b));
+          break;
+        case Op::IS_UADD_OVERFLOW:
+          benchmark::DoNotOptimize(a.is_uadd_overflow(b));
+          break;
+        case Op::IS_UMUL_OVERFLOW:
+          benchmark::DoNotOptimize(a.is_umul_overflow(b));
+          break;
+        case Op::COUNT_LEADING_ZEROS:
+          benchmark::DoNotOptimize(a.count_leading_zeros());
+          break;
+        case Op::COUNT_TRAILING_ZEROS:
+          benchmark::DoNotOptimize(a.count_trailing_zeros());
+          break;
+        case Op::HASH: benchmark::DoNotOptimize(a.hash()); break;
+        case Op::STR_BIN: benchmark::DoNotOptimize(a.str(2)); break;
+        case Op::STR_DEC: benchmark::DoNotOptimize(a.str(10)); break;
+        case Op::STR_HEX: benchmark::DoNotOptimize(a.str(16)); break;
+        case Op::FROM_STR_BIN:
+          benchmark::DoNotOptimize(BitVector(size, ops.d_str_bin[i], 2));
+          break;
+        case Op::FROM_STR_DEC:
+          benchmark::DoNotOptimize(BitVector(size, ops.d_str_dec[i], 10));
+          break;
+        case Op::FROM_STR_HEX:
+          benchmark::DoNotOptimize(BitVector(size, ops.d_str_hex[i], 16));
+          break;
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * s_num_values);
+}
+
+/** The in-place versions of the operations, result in a preallocated value. */
+template <Op op>
+void
+BM_bv_iop(benchmark::State& state)
+{
+  uint64_t size = static_cast<uint64_t>(state.range(0));
+  Operands ops(size);
+  BitVector res = BitVector::mk_zero(size);
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < s_num_values; ++i)
+    {
+      const BitVector& a = ops.d_lhs[i];
+      const BitVector& b = ops.d_rhs[i];
+      switch (op)
+      {
+        case Op::NEG: res.ibvneg(a); break;
+        case Op::NOT: res.ibvnot(a); break;
+        case Op::INC: res.ibvinc(a); break;
+        case Op::DEC: res.ibvdec(a); break;
+        case Op::ADD: res.ibvadd(a, b); break;
+        case Op::SUB: res.ibvsub(a, b); break;
+        case Op::AND: res.ibvand(a, b); break;
+        case Op::OR: res.ibvor(a, b); break;
+        case Op::XOR: res.ibvxor(a, b); break;
+        case Op::SHL: res.ibvshl(a, b); break;
+        case Op::SHR: res.ibvshr(a, b); break;
+        case Op::ASHR: res.ibvashr(a, b); break;
+        case Op::MUL: res.ibvmul(a, b); break;
+        case Op::UDIV: res.ibvudiv(a, b); break;
+        case Op::UREM: res.ibvurem(a, b); break;
+        case Op::SDIV: res.ibvsdiv(a, b); break;
+        case Op::SREM: res.ibvsrem(a, b); break;
+        case Op::MODINV: res.ibvmodinv(ops.d_odd[i]); break;
+        default: assert(false);
+      }
+      benchmark::DoNotOptimize(res);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * s_num_values);
+}
+
+}  // namespace
+
+/* -------------------------------------------------------------------------- */
+
+#define BZLA_BENCH_BV_WIDTHS \
+  Arg(8)->Arg(32)->Arg(64)->Arg(128)->Arg(256)->Arg(1024)
+
+#define BZLA_BENCH_BV_OP(op) BENCHMARK(BM_bv_op<op>)->BZLA_BENCH_BV_WIDTHS;
+#define BZLA_BENCH_BV_IOP(op) BENCHMARK(BM_bv_iop<op>)->BZLA_BENCH_BV_WIDTHS;
+
+BZLA_BENCH_BV_OP(Op::NEG)
+BZLA_BENCH_BV_OP(Op::NOT)
+BZLA_BENCH_BV_OP(Op::INC)
+BZLA_BENCH_BV_OP(Op::DEC)
+BZLA_BENCH_BV_OP(Op::REDAND)
+BZLA_BENCH_BV_OP(Op::REDOR)
+BZLA_BENCH_BV_OP(Op::ADD)
+BZLA_BENCH_BV_OP(Op::SUB)
+BZLA_BENCH_BV_OP(Op::AND)
+BZLA_BENCH_BV_OP(Op::NAND)
+BZLA_BENCH_BV_OP(Op::NOR)
+BZLA_BENCH_BV_OP(Op::OR)
+BZLA_BENCH_BV_OP(Op::XNOR)
+BZLA_BENCH_BV_OP(Op::XOR)
+BZLA_BENCH_BV_OP(Op::EQ)
+BZLA_BENCH_BV_OP(Op::NE)
+BZLA_BENCH_BV_OP(Op::ULT)
+BZLA_BENCH_BV_OP(Op::ULE)
+BZLA_BENCH_BV_OP(Op::UGT)
+BZLA_BENCH_BV_OP(Op::UGE)
+BZLA_BENCH_BV_OP(Op::SLT)
+BZLA_BENCH_BV_OP(Op::SLE)
+BZLA_BENCH_BV_OP(Op::SGT)
+BZLA_BENCH_BV_OP(Op::SGE)
+BZLA_BENCH_BV_OP(Op::SHL)
+BZLA_BENCH_BV_OP(Op::SHL_UINT)
+BZLA_BENCH_BV_OP(Op::SHR)
+BZLA_BENCH_BV_OP(Op::SHR_UINT)
+BZLA_BENCH_BV_OP(Op::ASHR)
+BZLA_BENCH_BV_OP(Op::ASHR_UINT)
+BZLA_BENCH_BV_OP(Op::MUL)
+BZLA_BENCH_BV_OP(Op::UDIV)
+BZLA_BENCH_BV_OP(Op::UREM)
+BZLA_BENCH_BV_OP(Op::SDIV)
+BZLA_BENCH_BV_OP(Op::SREM)
+BZLA_BENCH_BV_OP(Op::UDIVUREM)
+BZLA_BENCH_BV_OP(Op::CONCAT)
+BZLA_BENCH_BV_OP(Op::EXTRACT)
+BZLA_BENCH_BV_OP(Op::ZEXT)
+BZLA_BENCH_BV_OP(Op::SEXT)
+BZLA_BENCH_BV_OP(Op::MODINV)
+BZLA_BENCH_BV_OP(Op::ITE)
+BZLA_BENCH_BV_OP(Op::COMPARE)
+BZLA_BENCH_BV_OP(Op::SIGNED_COMPARE)
+BZLA_BENCH_BV_OP(Op::IS_UADD_OVERFLOW)
+BZLA_BENCH_BV_OP(Op::IS_UMUL_OVERFLOW)
+BZLA_BENCH_BV_OP(Op::COUNT_LEADING_ZEROS)
+BZLA_BENCH_BV_OP(Op::COUNT_TRAILING_ZEROS)
+BZLA_BENCH_BV_OP(Op::HASH)
+BZLA_BENCH_BV_OP(Op::STR_BIN)
+BZLA_BENCH_BV_OP(Op::STR_DEC)
+BZLA_BENCH_BV_OP(Op::STR_HEX)
+BZLA_BENCH_BV_OP(Op::FROM_STR_BIN)
+BZLA_BENCH_BV_OP(Op::FROM_STR_DEC)
+BZLA_BENCH_BV_OP(Op::FROM_STR_HEX)
+
+BZLA_BENCH_BV_IOP(Op::NEG)
+BZLA_BENCH_BV_IOP(Op::NOT)
+BZLA_BENCH_BV_IOP(Op::INC)
+BZLA_BENCH_BV_IOP(Op::DEC)
+BZLA_BENCH_BV_IOP(Op::ADD)
+BZLA_BENCH_BV_IOP(Op::SUB)
+BZLA_BENCH_BV_IOP(Op::AND)
+BZLA_BENCH_BV_IOP(Op::OR)
+BZLA_BENCH_BV_IOP(Op::XOR)
+BZLA_BENCH_BV_IOP(Op::SHL)
+BZLA_BENCH_BV_IOP(Op::SHR)
+BZLA_BENCH_BV_IOP(Op::ASHR)
+BZLA_BENCH_BV_IOP(Op::MUL)
+BZLA_BENCH_BV_IOP(Op::UDIV)
+BZLA_BENCH_BV_IOP(Op::UREM)
+BZLA_BENCH_BV_IOP(Op::SDIV)
+BZLA_BENCH_BV_IOP(Op::SREM)
+BZLA_BENCH_BV_IOP(Op::MODINV)
+
+}  // namespace bzla::bench
+
+BENCHMARK_MAIN();
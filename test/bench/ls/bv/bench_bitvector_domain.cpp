@@ -0,0 +1,227 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cassert>
+#include <vector>
+
+#include "bv/bitvector.h"
+#include "ls/bv/bitvector_domain.h"
+#include "rng/rng.h"
+
+/* -------------------------------------------------------------------------- */
+
+// Measures the throughput of BitVectorDomain operations and of the value
+// generators used for inverse and consistent value computation in local
+// search, at bit-widths 8, 32, 64, 128, 256 and 1024. Domains have about
+// half of their bits fixed.
+
+namespace bzla::bench {
+
+using namespace ls;
+
+namespace {
+
+constexpr size_t s_num_values = 256;
+
+enum class Op
+{
+  NOT,
+  SHL,
+  SHR,
+  ASHR,
+  CONCAT,
+  CONCAT_DOMAIN,
+  EXTRACT,
+  IS_VALID,
+  IS_FIXED,
+  HAS_FIXED_BITS,
+  FIX,
+  MATCH_FIXED_BITS,
+  GET_COPY_WITH_FIXED_BITS,
+  GET_FACTOR,
+};
+
+enum class Gen
+{
+  UNSIGNED,
+  SIGNED,
+  DUAL,
+};
+
+/** Domains and values of a given size. */
+struct Operands
+{
+  Operands(uint64_t size) : d_rng(42)
+  {
+    for (size_t i = 0; i < s_num_values; ++i)
+    {
+      BitVector v(size, d_rng), mask(size, d_rng);
+      d_domains.emplace_back(v.bvand(mask), v.bvor(mask.bvnot()));
+      d_values.emplace_back(size, d_rng);
+      d_shifts.push_back(
+          BitVector::from_ui(size, d_rng.pick<uint64_t>(0, size)));
+    }
+  }
+  RNG d_rng;
+  std::vector<BitVectorDomain> d_domains;
+  std::vector<BitVector> d_values;
+  std::vector<BitVector> d_shifts;
+};
+
+template <Op op>
+void
+BM_domain_op(benchmark::State& state)
+{
+  uint64_t size = static_cast<uint64_t>(state.range(0));
+  Operands ops(size);
+  uint64_t hi = size - 1, lo = size / 2;
+  BitVector one = BitVector::mk_one(size);
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < s_num_values; ++i)
+    {
+      const BitVectorDomain& d = ops.d_domains[i];
+      const BitVector& v       = ops.d_values[i];
+      switch (op)
+      {
+        case Op::NOT: benchmark::DoNotOptimize(d.bvnot()); break;
+        case Op::SHL:
+          benchmark::DoNotOptimize(d.bvshl(ops.d_shifts[i]));
+          break;
+        case Op::SHR:
+          benchmark::DoNotOptimize(d.bvshr(ops.d_shifts[i]));
+          break;
+        case Op::ASHR:
+          benchmark::DoNotOptimize(d.bvashr(ops.d_shifts[i]));
+          break;
+        case Op::CONCAT: benchmark::DoNotOptimize(d.bvconcat(v)); break;
+        case Op::CONCAT_DOMAIN:
+          benchmark::DoNotOptimize(
+              d.bvconcat(ops.d_domains[(i + 1) % s_num_values]));
+          break;
+        case Op::EXTRACT: benchmark::DoNotOptimize(d.bvextract(hi, lo)); break;
+        case Op::IS_VALID: benchmark::DoNotOptimize(d.is_valid()); break;
+        case Op::IS_FIXED: benchmark::DoNotOptimize(d.is_fixed()); break;
+        case Op::HAS_FIXED_BITS:
+          benchmark::DoNotOptimize(d.has_fixed_bits());
+          break;
+        case Op::FIX:
+        {
+          BitVectorDomain tmp(d);
+          tmp.fix(v);
+          benchmark::DoNotOptimize(tmp);
+        }
+        break;
+        case Op::MATCH_FIXED_BITS:
+          benchmark::DoNotOptimize(d.match_fixed_bits(v));
+          break;
+        case Op::GET_COPY_WITH_FIXED_BITS:
+          benchmark::DoNotOptimize(d.get_copy_with_fixed_bits(v));
+          break;
+        case Op::GET_FACTOR:
+          benchmark::DoNotOptimize(d.get_factor(&ops.d_rng, v, one, 100));
+          break;
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * s_num_values);
+}
+
+/**
+ * Generate values in the given domains, in random order if `random` is true
+ * and else in sequence. Includes the construction of the generator.
+ */
+template <Gen gen, bool random>
+void
+BM_domain_gen(benchmark::State& state)
+{
+  uint64_t size = static_cast<uint64_t>(state.range(0));
+  Operands ops(size);
+  RNG* rng           = random ? &ops.d_rng : nullptr;
+  BitVector zero     = BitVector::mk_zero(size);
+  BitVector ones     = BitVector::mk_ones(size);
+  BitVector min_sig  = BitVector::mk_min_signed(size);
+  BitVector max_sig  = BitVector::mk_max_signed(size);
+  constexpr size_t n = 8;
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < s_num_values; ++i)
+    {
+      const BitVectorDomain& d = ops.d_domains[i];
+      if constexpr (gen == Gen::UNSIGNED)
+      {
+        BitVectorDomainGenerator g(d, rng);
+        for (size_t j = 0; j < n && (random ? g.has_random() : g.has_next());
+             ++j)
+        {
+          benchmark::DoNotOptimize(random ? g.random() : g.next());
+        }
+      }
+      else if constexpr (gen == Gen::SIGNED)
+      {
+        BitVectorDomainSignedGenerator g(d, rng);
+        for (size_t j = 0; j < n && (random ? g.has_random() : g.has_next());
+             ++j)
+        {
+          benchmark::DoNotOptimize(random ? g.random() : g.next());
+        }
+      }
+      else
+      {
+        BitVectorDomainDualGenerator g(
+            d, rng, &zero, &max_sig, &min_sig, &ones);
+        for (size_t j = 0; j < n && (random ? g.has_random() : g.has_next());
+             ++j)
+        {
+          benchmark::DoNotOptimize(random ? g.random() : g.next());
+        }
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * s_num_values);
+}
+
+}  // namespace
+
+/* -------------------------------------------------------------------------- */
+
+#define BZLA_BENCH_BV_WIDTHS \
+  Arg(8)->Arg(32)->Arg(64)->Arg(128)->Arg(256)->Arg(1024)
+
+#define BZLA_BENCH_DOMAIN_OP(op) \
+  BENCHMARK(BM_domain_op<op>)->BZLA_BENCH_BV_WIDTHS;
+
+BZLA_BENCH_DOMAIN_OP(Op::NOT)
+BZLA_BENCH_DOMAIN_OP(Op::SHL)
+BZLA_BENCH_DOMAIN_OP(Op::SHR)
+BZLA_BENCH_DOMAIN_OP(Op::ASHR)
+BZLA_BENCH_DOMAIN_OP(Op::CONCAT)
+BZLA_BENCH_DOMAIN_OP(Op::CONCAT_DOMAIN)
+BZLA_BENCH_DOMAIN_OP(Op::EXTRACT)
+BZLA_BENCH_DOMAIN_OP(Op::IS_VALID)
+BZLA_BENCH_DOMAIN_OP(Op::IS_FIXED)
+BZLA_BENCH_DOMAIN_OP(Op::HAS_FIXED_BITS)
+BZLA_BENCH_DOMAIN_OP(Op::FIX)
+BZLA_BENCH_DOMAIN_OP(Op::MATCH_FIXED_BITS)
+BZLA_BENCH_DOMAIN_OP(Op::GET_COPY_WITH_FIXED_BITS)
+BZLA_BENCH_DOMAIN_OP(Op::GET_FACTOR)
+
+BENCHMARK(BM_domain_gen<Gen::UNSIGNED, false>)->BZLA_BENCH_BV_WIDTHS;
+BENCHMARK(BM_domain_gen<Gen::UNSIGNED, true>)->BZLA_BENCH_BV_WIDTHS;
+BENCHMARK(BM_domain_gen<Gen::SIGNED, false>)->BZLA_BENCH_BV_WIDTHS;
+BENCHMARK(BM_domain_gen<Gen::SIGNED, true>)->BZLA_BENCH_BV_WIDTHS;
+BENCHMARK(BM_domain_gen<Gen::DUAL, false>)->BZLA_BENCH_BV_WIDTHS;
+BENCHMARK(BM_domain_gen<Gen::DUAL, true>)->BZLA_BENCH_BV_WIDTHS;
+
+}  // namespace bzla::bench
+
+BENCHMARK_MAIN();
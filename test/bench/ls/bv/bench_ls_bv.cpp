@@ -0,0 +1,170 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "bv/bitvector.h"
+#include "ls/bv/bitvector_domain.h"
+#include "ls/ls_bv.h"
+#include "rng/rng.h"
+
+/* -------------------------------------------------------------------------- */
+
+// Measures the throughput of bit-vector local search in moves per second on
+// random satisfiable sets of equalities and inequalities over bit-vector
+// terms of a given size, as produced by program analysis.
+
+namespace bzla::bench {
+
+using namespace ls;
+
+namespace {
+
+constexpr uint32_t s_num_vars  = 8;
+constexpr uint32_t s_num_terms = 48;
+constexpr uint32_t s_num_roots = 8;
+constexpr uint64_t s_max_moves = 2000;
+
+/** Term structure, shared between the model and the search instance. */
+struct Term
+{
+  NodeKind d_kind;
+  std::vector<uint64_t> d_children;
+};
+
+/** Generate terms over `s_num_vars` variables (terms 0 to s_num_vars - 1). */
+std::vector<Term>
+mk_terms(RNG& rng)
+{
+  static const std::vector<NodeKind> kinds = {NodeKind::BV_ADD,
+                                              NodeKind::BV_AND,
+                                              NodeKind::BV_MUL,
+                                              NodeKind::BV_NOT,
+                                              NodeKind::BV_SHL,
+                                              NodeKind::BV_SHR,
+                                              NodeKind::BV_ASHR,
+                                              NodeKind::BV_UDIV,
+                                              NodeKind::BV_UREM,
+                                              NodeKind::BV_XOR};
+  std::vector<Term> terms(s_num_vars, {NodeKind::CONST, {}});
+  for (uint32_t i = 0; i < s_num_terms; ++i)
+  {
+    NodeKind kind = rng.pick_from_set<std::vector<NodeKind>, NodeKind>(kinds);
+    uint64_t n    = terms.size();
+    if (kind == NodeKind::BV_NOT)
+    {
+      terms.push_back({kind, {rng.pick<uint64_t>(0, n - 1)}});
+    }
+    else
+    {
+      terms.push_back(
+          {kind,
+           {rng.pick<uint64_t>(0, n - 1), rng.pick<uint64_t>(0, n - 1)}});
+    }
+  }
+  return terms;
+}
+
+/**
+ * Create given terms in given local search instance.
+ * @param model The values of the variables, nullptr to create unassigned
+ *              variables.
+ */
+std::vector<uint64_t>
+mk_nodes(LocalSearchBV& ls,
+         uint64_t size,
+         const std::vector<Term>& terms,
+         const std::vector<BitVector>* model)
+{
+  std::vector<uint64_t> ids;
+  for (const Term& term : terms)
+  {
+    if (term.d_kind == NodeKind::CONST)
+    {
+      ids.push_back(model ? ls.mk_node((*model)[ids.size()],
+                                       BitVectorDomain(size))
+                          : ls.mk_node(NodeKind::CONST, size));
+      continue;
+    }
+    std::vector<uint64_t> children;
+    for (uint64_t c : term.d_children)
+    {
+      children.push_back(ids[c]);
+    }
+    ids.push_back(ls.mk_node(term.d_kind, size, children));
+  }
+  return ids;
+}
+
+void
+BM_ls_move(benchmark::State& state)
+{
+  uint64_t size = static_cast<uint64_t>(state.range(0));
+  RNG rng(42);
+  uint64_t nmoves = 0, nsat = 0;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    std::vector<Term> terms = mk_terms(rng);
+    std::vector<BitVector> model;
+    for (uint32_t i = 0; i < s_num_vars; ++i)
+    {
+      model.emplace_back(size, rng);
+    }
+    // Determine target values of the roots under a random model.
+    LocalSearchBV ls_model(0, 0);
+    std::vector<uint64_t> ids = mk_nodes(ls_model, size, terms, &model);
+    std::vector<std::tuple<NodeKind, uint64_t, BitVector>> roots;
+    for (uint32_t i = 0; i < s_num_roots; ++i)
+    {
+      uint64_t t = rng.pick<uint64_t>(s_num_vars, ids.size() - 1);
+      roots.emplace_back(i % 2 ? NodeKind::EQ : NodeKind::BV_ULT,
+                         t,
+                         ls_model.get_assignment(ids[t]));
+    }
+
+    LocalSearchBV ls(0, 0);
+    ids = mk_nodes(ls, size, terms, nullptr);
+    for (const auto& [kind, t, val] : roots)
+    {
+      // t < val + 1, or t = val if val + 1 overflows
+      bool ult    = kind == NodeKind::BV_ULT && !val.is_ones();
+      BitVector c = ult ? val.bvinc() : val;
+      uint64_t id = ls.mk_node(c, BitVectorDomain(c));
+      ls.register_root(
+          ls.mk_node(ult ? NodeKind::BV_ULT : NodeKind::EQ, 1, {ids[t], id}));
+    }
+    state.ResumeTiming();
+
+    Result res;
+    do
+    {
+      res = ls.move();
+    } while (res == Result::UNKNOWN
+             && ls.statistics().d_nmoves < s_max_moves);
+    nmoves += ls.statistics().d_nmoves;
+    nsat += res == Result::SAT;
+  }
+  state.counters["moves"] = benchmark::Counter(static_cast<double>(nmoves),
+                                               benchmark::Counter::kIsRate);
+  state.counters["sat"] = static_cast<double>(nsat);
+}
+
+}  // namespace
+
+/* -------------------------------------------------------------------------- */
+
+BENCHMARK(BM_ls_move)->Arg(8)->Arg(32)->Arg(64)->Arg(128);
+
+}  // namespace bzla::bench
+
+BENCHMARK_MAIN();
@@ -0,0 +1,170 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <vector>
+
+#include "node/node.h"
+#include "node/node_manager.h"
+#include "node/node_ref_vector.h"
+#include "rng/rng.h"
+
+/* -------------------------------------------------------------------------- */
+
+// Count heap allocations to measure the allocator traffic of node
+// construction. Only relies on the public node manager interface, hence the
+// same benchmark can be used to compare against older revisions.
+
+static uint64_t s_num_allocs = 0;
+
+void*
+operator new(size_t size)
+{
+  ++s_num_allocs;
+  if (void* p = std::malloc(size ? size : 1))
+  {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void
+operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete(void* p, size_t) noexcept
+{
+  std::free(p);
+}
+
+/* -------------------------------------------------------------------------- */
+
+namespace bzla::bench {
+
+using namespace node;
+
+namespace {
+
+/**
+ * Create a random DAG of `num_nodes` bit-vector nodes over `num_consts`
+ * constants.
+ */
+std::vector<Node>
+mk_dag(size_t num_consts, size_t num_nodes, uint32_t seed)
+{
+  static constexpr Kind kinds[] = {
+      Kind::BV_ADD, Kind::BV_MUL, Kind::BV_AND, Kind::BV_XOR, Kind::BV_SHL};
+  NodeManager& nm = NodeManager::get();
+  RNG rng(seed);
+  Type bv32 = nm.mk_bv_type(32);
+
+  std::vector<Node> nodes;
+  nodes.reserve(num_consts + num_nodes);
+  for (size_t i = 0; i < num_consts; ++i)
+  {
+    nodes.push_back(nm.mk_const(bv32));
+  }
+  for (size_t i = 0; i < num_nodes; ++i)
+  {
+    size_t size = nodes.size();
+    // Prefer recently created nodes to obtain deep DAGs.
+    size_t recent = std::min<size_t>(size, 64);
+    const Node& a = nodes[size - 1 - rng.pick<size_t>(0, recent - 1)];
+    const Node& b = nodes[rng.pick<size_t>(0, size - 1)];
+    Kind k        = kinds[rng.pick<size_t>(0, std::size(kinds) - 1)];
+    nodes.push_back(nm.mk_node(k, {a, b}));
+  }
+  return nodes;
+}
+
+/** Count the nodes in the DAG rooted at `root` via depth-first search. */
+uint64_t
+traverse(const Node& root)
+{
+  std::vector<bool> cache;
+  node_ref_vector visit{root};
+  uint64_t res = 0;
+  do
+  {
+    const Node& cur = visit.back();
+    visit.pop_back();
+    uint64_t id = cur.id();
+    if (id >= cache.size())
+    {
+      cache.resize(id * 2, false);
+    }
+    if (!cache[id])
+    {
+      cache[id] = true;
+      res += static_cast<uint64_t>(cur.kind()) + 1;
+      visit.insert(visit.end(), cur.begin(), cur.end());
+    }
+  } while (!visit.empty());
+  return res;
+}
+
+}  // namespace
+
+/* -------------------------------------------------------------------------- */
+
+static void
+BM_mk_node(benchmark::State& state)
+{
+  size_t num_nodes = static_cast<size_t>(state.range(0));
+  uint64_t allocs  = 0;
+  for (auto _ : state)
+  {
+    uint64_t num_allocs = s_num_allocs;
+    // Nodes are garbage collected at the end of each iteration, which
+    // exercises reuse of released node data.
+    std::vector<Node> nodes = mk_dag(100, num_nodes, 42);
+    allocs += s_num_allocs - num_allocs;
+    benchmark::DoNotOptimize(nodes.back());
+  }
+  state.counters["allocs/node"] = benchmark::Counter(
+      static_cast<double>(allocs)
+      / static_cast<double>(num_nodes * state.iterations()));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void
+BM_traverse(benchmark::State& state)
+{
+  std::vector<Node> nodes =
+      mk_dag(1000, static_cast<size_t>(state.range(0)), 42);
+  // Drop some nodes to fragment the heap before building the traversed DAG.
+  for (size_t i = 1000; i < nodes.size(); i += 2)
+  {
+    nodes[i] = Node();
+  }
+  std::vector<Node> dag = mk_dag(1000, static_cast<size_t>(state.range(0)), 7);
+  Node root             = NodeManager::get().mk_node(
+      Kind::BV_ADD, {dag[dag.size() - 1], dag[dag.size() - 2]});
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(traverse(root));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_mk_node)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_traverse)->RangeMultiplier(10)->Range(1000, 1000000);
+
+}  // namespace bzla::bench
+
+BENCHMARK_MAIN();
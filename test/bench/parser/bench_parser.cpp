@@ -0,0 +1,123 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+#include <bitwuzla/cpp/bitwuzla.h>
+#include <bitwuzla/cpp/parser.h>
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include "rng/rng.h"
+
+/* -------------------------------------------------------------------------- */
+
+// Measures parsing and printing of huge bit-vector literals, as they occur,
+// e.g., in memory images.
+
+namespace bzla::bench {
+
+namespace {
+
+/** The size of the bit-vector literals. */
+constexpr uint64_t s_literal_size = 1000000;
+
+/**
+ * Write an SMT-LIB v2 file with `num_literals` random literals of size
+ * `s_literal_size` in given base to a temporary file.
+ */
+FILE*
+mk_input(uint32_t base, uint64_t num_literals)
+{
+  static constexpr char digits[] = "0123456789abcdef";
+  RNG rng(42);
+  std::stringstream ss;
+  ss << "(set-logic QF_BV)\n";
+  ss << "(declare-const x (_ BitVec " << s_literal_size << "))\n";
+  for (uint64_t i = 0; i < num_literals; ++i)
+  {
+    std::string lit(base == 2 ? s_literal_size : s_literal_size / 4, '0');
+    for (char& c : lit)
+    {
+      c = digits[rng.pick<uint32_t>(0, base - 1)];
+    }
+    ss << "(assert (distinct x " << (base == 2 ? "#b" : "#x") << lit
+       << "))\n";
+  }
+  std::string str = ss.str();
+  FILE* res       = std::tmpfile();
+  std::fwrite(str.data(), 1, str.size(), res);
+  return res;
+}
+
+}  // namespace
+
+/* -------------------------------------------------------------------------- */
+
+static void
+BM_parse_literals(benchmark::State& state)
+{
+  uint32_t base = static_cast<uint32_t>(state.range(0));
+  FILE* infile  = mk_input(base, static_cast<uint64_t>(state.range(1)));
+  for (auto _ : state)
+  {
+    std::rewind(infile);
+    bitwuzla::Options options;
+    bitwuzla::parser::Parser parser(options, "<bench>", infile, "smt2");
+    std::string err = parser.parse(true);
+    if (!err.empty())
+    {
+      state.SkipWithError(err.c_str());
+      break;
+    }
+  }
+  std::fclose(infile);
+  state.SetBytesProcessed(state.iterations() * state.range(1)
+                          * static_cast<int64_t>(s_literal_size) / 8);
+}
+
+static void
+BM_print_literals(benchmark::State& state)
+{
+  uint32_t base = static_cast<uint32_t>(state.range(0));
+  FILE* infile  = mk_input(base, static_cast<uint64_t>(state.range(1)));
+  bitwuzla::Options options;
+  bitwuzla::parser::Parser parser(options, "<bench>", infile, "smt2");
+  std::string err = parser.parse(true);
+  if (!err.empty())
+  {
+    state.SkipWithError(err.c_str());
+  }
+  for (auto _ : state)
+  {
+    std::stringstream ss;
+    parser.bitwuzla()->print_formula(ss, "smt2");
+    benchmark::DoNotOptimize(ss.tellp());
+  }
+  std::fclose(infile);
+  state.SetBytesProcessed(state.iterations() * state.range(1)
+                          * static_cast<int64_t>(s_literal_size) / 8);
+}
+
+BENCHMARK(BM_parse_literals)
+    ->Args({2, 1})
+    ->Args({2, 16})
+    ->Args({16, 1})
+    ->Args({16, 16})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_print_literals)
+    ->Args({2, 16})
+    ->Args({16, 16})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace bzla::bench
+
+BENCHMARK_MAIN();
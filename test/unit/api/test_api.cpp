@@ -1874,11 +1874,16 @@ TEST_F(TestApi, statistics)
   bitwuzla::Options options;
   bitwuzla::Bitwuzla bitwuzla(options);
   bitwuzla.assert_formula(d_bool_const);
+  bitwuzla.check_sat();
   auto stats = bitwuzla.statistics();
   for (auto [name, val] : stats)
   {
     std::cout << name << ": " << val << std::endl;
   }
+  ASSERT_NE(stats.find("node_manager::memory::total"), stats.end());
+  ASSERT_NE(stats.find("node_manager::memory::kind::CONSTANT"), stats.end());
+  ASSERT_NE(stats.find("bv::bitblast::memory::aig"), stats.end());
+  ASSERT_NE(stats.find("memory::max_rss"), stats.end());
 }
 
 /* -------------------------------------------------------------------------- */
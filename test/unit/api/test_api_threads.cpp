@@ -0,0 +1,107 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <bitwuzla/cpp/bitwuzla.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace bzla::test {
+
+class TestApiThreads : public ::testing::Test
+{
+ protected:
+  /**
+   * Factor `value` into two non-trivial factors of width `size` via solver
+   * instances that are each created, used and destroyed on the calling
+   * thread.
+   */
+  static void factor(uint64_t size,
+                     uint64_t value,
+                     uint64_t rewrite_level,
+                     size_t num_iterations)
+  {
+    for (size_t i = 0; i < num_iterations; ++i)
+    {
+      bitwuzla::Options options;
+      options.set(bitwuzla::Option::PRODUCE_MODELS, true);
+      options.set(bitwuzla::Option::REWRITE_LEVEL, rewrite_level);
+      bitwuzla::Bitwuzla bitwuzla(options);
+
+      bitwuzla::Sort bv_sort = bitwuzla::mk_bv_sort(size);
+      bitwuzla::Term x       = bitwuzla::mk_const(bv_sort, "x");
+      bitwuzla::Term y       = bitwuzla::mk_const(bv_sort, "y");
+      bitwuzla::Term one     = bitwuzla::mk_bv_one(bv_sort);
+      bitwuzla::Term val     = bitwuzla::mk_bv_value_uint64(bv_sort, value);
+      bitwuzla.assert_formula(bitwuzla::mk_term(
+          bitwuzla::Kind::EQUAL,
+          {bitwuzla::mk_term(bitwuzla::Kind::BV_MUL, {x, y}), val}));
+      bitwuzla.assert_formula(
+          bitwuzla::mk_term(bitwuzla::Kind::DISTINCT, {x, one}));
+      bitwuzla.assert_formula(
+          bitwuzla::mk_term(bitwuzla::Kind::DISTINCT, {y, one}));
+      bitwuzla.assert_formula(bitwuzla::mk_term(
+          bitwuzla::Kind::NOT,
+          {bitwuzla::mk_term(bitwuzla::Kind::BV_UMUL_OVERFLOW, {x, y})}));
+      bitwuzla.assert_formula(
+          bitwuzla::mk_term(bitwuzla::Kind::BV_ULT, {x, y}));
+
+      EXPECT_EQ(bitwuzla.check_sat(), bitwuzla::Result::SAT);
+      uint64_t vx =
+          std::stoull(bitwuzla.get_value(x).value<std::string>(10), 0, 10);
+      uint64_t vy =
+          std::stoull(bitwuzla.get_value(y).value<std::string>(10), 0, 10);
+      EXPECT_EQ(vx * vy, value);
+      EXPECT_NE(vx, 1);
+      EXPECT_NE(vy, 1);
+    }
+  }
+};
+
+TEST_F(TestApiThreads, parallel_solvers)
+{
+  size_t num_threads = std::max(4u, std::thread::hardware_concurrency());
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < num_threads; ++i)
+  {
+    // 64777 = 211 * 307
+    threads.emplace_back(factor, 16, 64777, i % 3, 20);
+  }
+  for (auto& t : threads)
+  {
+    t.join();
+  }
+}
+
+TEST_F(TestApiThreads, parallel_solvers_main_thread)
+{
+  // Terms created on the main thread are unaffected by solvers running
+  // concurrently on other threads.
+  bitwuzla::Sort bv_sort = bitwuzla::mk_bv_sort(8);
+  bitwuzla::Term x       = bitwuzla::mk_const(bv_sort, "x");
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < 4; ++i)
+  {
+    threads.emplace_back(factor, 8, 143, 2, 50);
+  }
+  factor(8, 143, 2, 50);
+  for (auto& t : threads)
+  {
+    t.join();
+  }
+  ASSERT_EQ(x.symbol()->get(), "x");
+  ASSERT_EQ(x.sort(), bv_sort);
+}
+
+}  // namespace bzla::test
@@ -0,0 +1,91 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "backtrack/node_id_map.h"
+#include "backtrack/node_id_set.h"
+#include "gtest/gtest.h"
+#include "node/node_manager.h"
+
+namespace bzla::test {
+
+using namespace node;
+
+class TestNodeIdMap : public ::testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    NodeManager& nm = NodeManager::get();
+    Type bv_type    = nm.mk_bv_type(8);
+    for (size_t i = 0; i < 5; ++i)
+    {
+      d_nodes.push_back(nm.mk_const(bv_type));
+    }
+  }
+
+  std::vector<Node> d_nodes;
+};
+
+TEST_F(TestNodeIdMap, ctor_dtor)
+{
+  backtrack::BacktrackManager mgr;
+  backtrack::NodeIdMap<bool> map(&mgr);
+  backtrack::NodeIdSet set(&mgr);
+}
+
+TEST_F(TestNodeIdMap, push_pop)
+{
+  backtrack::BacktrackManager mgr;
+  backtrack::NodeIdMap<bool> map(&mgr);
+  map.emplace(d_nodes[0], true);
+  map.emplace(d_nodes[1], false);
+  map.emplace(d_nodes[2], true);
+  mgr.push();
+  ASSERT_EQ(map.size(), 3);
+  ASSERT_FALSE(map.empty());
+  map.emplace(d_nodes[3], true);
+  map.emplace(d_nodes[4], true);
+  map.emplace(d_nodes[3], true);  // duplicate
+  ASSERT_EQ(map.size(), 5);
+  mgr.pop();
+  ASSERT_EQ(map.size(), 3);
+  ASSERT_EQ(map.find(d_nodes[3]), map.end());
+  ASSERT_EQ(map.find(d_nodes[4]), map.end());
+  ASSERT_NE(map.find(d_nodes[0]), map.end());
+  ASSERT_NE(map.find(d_nodes[1]), map.end());
+  ASSERT_NE(map.find(d_nodes[2]), map.end());
+  ASSERT_DEATH(mgr.pop(), "d_scope_levels > 0");
+}
+
+TEST_F(TestNodeIdMap, push_pop_set)
+{
+  backtrack::BacktrackManager mgr;
+  backtrack::NodeIdSet set(&mgr);
+  set.insert(d_nodes[0]);
+  set.insert(d_nodes[1]);
+  set.insert(d_nodes[2]);
+  mgr.push();
+  ASSERT_EQ(set.size(), 3);
+  ASSERT_FALSE(set.empty());
+  set.insert(d_nodes[3]);
+  set.insert(d_nodes[4]);
+  set.insert(d_nodes[3]);  // duplicate
+  ASSERT_EQ(set.size(), 5);
+  mgr.pop();
+  ASSERT_EQ(set.size(), 3);
+  ASSERT_EQ(set.find(d_nodes[3]), set.end());
+  ASSERT_EQ(set.find(d_nodes[4]), set.end());
+  ASSERT_NE(set.find(d_nodes[0]), set.end());
+  ASSERT_NE(set.find(d_nodes[1]), set.end());
+  ASSERT_NE(set.find(d_nodes[2]), set.end());
+  ASSERT_DEATH(mgr.pop(), "d_scope_levels > 0");
+}
+
+}  // namespace bzla::test
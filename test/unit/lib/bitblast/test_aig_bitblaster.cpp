@@ -13,7 +13,9 @@
 #include <filesystem>
 
 #include "bitblast/aig/aig_printer.h"
+#include "bitblast/aig/aig_simulator.h"
 #include "bitblast/aig_bitblaster.h"
+#include "rng/rng.h"
 #include "test_lib.h"
 
 static const char* s_solver_binary = std::getenv("SOLVER_BINARY");
@@ -59,7 +61,8 @@ class TestAigBitblaster : public TestCommon
     return result.substr(0, newline_pos);
   }
 
-  static void test_binary(const std::string& op,
+  static void test_binary(const bb::AigManager& mgr,
+                          const std::string& op,
                           const std::vector<bb::AigNode>& res,
                           const std::vector<bb::AigNode>& a,
                           const std::vector<bb::AigNode>& b)
@@ -69,12 +72,12 @@ class TestAigBitblaster : public TestCommon
       GTEST_SKIP_("SOLVER_BINARY environment variable not set.");
     }
     std::stringstream ss;
-    declare_const(ss, a);
-    declare_const(ss, b);
-    bb::aig::Smt2Printer::print(ss, res);
-    define_const(ss, "a", a);
-    define_const(ss, "b", b);
-    define_const(ss, "res", res);
+    declare_const(ss, mgr, a);
+    declare_const(ss, mgr, b);
+    bb::aig::Smt2Printer::print(ss, mgr, res);
+    define_const(ss, mgr, "a", a);
+    define_const(ss, mgr, "b", b);
+    define_const(ss, mgr, "res", res);
     ss << "(declare-const expected (_ BitVec " << res.size() << "))\n";
     ss << "(assert (= expected (" << op << " a b)))\n";
     ss << "(assert (distinct res expected))\n";
@@ -82,17 +85,19 @@ class TestAigBitblaster : public TestCommon
   }
 
   static void declare_const(std::stringstream& ss,
-                           const std::vector<bb::AigNode>& bits)
+                            const bb::AigManager& mgr,
+                            const std::vector<bb::AigNode>& bits)
   {
     for (size_t i = 0; i < bits.size(); ++i)
     {
       ss << "(declare-const ";
-      bb::aig::Smt2Printer::print(ss, bits[i]);
+      bb::aig::Smt2Printer::print(ss, mgr, bits[i]);
       ss << " (_ BitVec 1))\n";
     }
   }
 
   static void define_const(std::stringstream& ss,
+                           const bb::AigManager& mgr,
                            const std::string& name,
                            const std::vector<bb::AigNode>& bits)
   {
@@ -102,19 +107,19 @@ class TestAigBitblaster : public TestCommon
       size_t pos = bits.size() - 1 - i;
       ss << "(assert (= ((_ extract " << pos << " " << pos << ") " << name
          << ") ";
-      bb::aig::Smt2Printer::print(ss, bits[i]);
+      bb::aig::Smt2Printer::print(ss, mgr, bits[i]);
       ss << "))\n";
     }
   }
 };
 
-#define TEST_BIN_OP(size, op, func)  \
-  {                                  \
-    bb::AigBitblaster bb;            \
-    auto a   = bb.bv_constant(size); \
-    auto b   = bb.bv_constant(size); \
-    auto res = bb.func(a, b);        \
-    test_binary(op, res, a, b);      \
+#define TEST_BIN_OP(size, op, func)               \
+  {                                               \
+    bb::AigBitblaster bb;                         \
+    auto a   = bb.bv_constant(size);              \
+    auto b   = bb.bv_constant(size);              \
+    auto res = bb.func(a, b);                     \
+    test_binary(bb.aig_manager(), op, res, a, b); \
   }
 
 TEST_F(TestAigBitblaster, ctor_dtor) { bb::AigBitblaster bb; }
@@ -323,6 +328,135 @@ TEST_F(TestAigBitblaster, bv_mul4) { TEST_BIN_OP(4, "bvmul", bv_mul); }
 
 TEST_F(TestAigBitblaster, bv_mul8) { TEST_BIN_OP(8, "bvmul", bv_mul); }
 
+TEST_F(TestAigBitblaster, bv_mul_encodings)
+{
+  RNG rng(42);
+  for (auto encoding : {bb::MulEncoding::ARRAY,
+                        bb::MulEncoding::DADDA,
+                        bb::MulEncoding::KARATSUBA,
+                        bb::MulEncoding::AUTO})
+  {
+    bb::AigBitblaster bb;
+    bb.set_mul_encoding(encoding);
+    for (uint64_t size : {1, 2, 3, 5, 8, 31, 32, 33, 64, 65, 128})
+    {
+      for (size_t i = 0; i < 10; ++i)
+      {
+        BitVector x(size, rng);
+        BitVector y(size, rng);
+        BitVector expected = x.bvmul(y);
+        auto res = bb.bv_mul(bb.bv_value(x), bb.bv_value(y));
+        ASSERT_EQ(res.size(), size);
+        for (size_t j = 0; j < size; ++j)
+        {
+          ASSERT_EQ(res[j].is_true(), expected.bit(size - 1 - j));
+          ASSERT_TRUE(res[j].is_true() || res[j].is_false());
+        }
+      }
+    }
+  }
+
+  // MulEncoding::AUTO uses the array multiplier below 64 bits.
+  for (uint64_t size : {8, 32, 63})
+  {
+    bb::AigBitblaster bb;
+    auto a = bb.bv_constant(size);
+    auto b = bb.bv_constant(size);
+    bb.set_mul_encoding(bb::MulEncoding::ARRAY);
+    auto expected     = bb.bv_mul(a, b);
+    uint64_t num_ands = bb.num_aig_ands();
+    bb.set_mul_encoding(bb::MulEncoding::AUTO);
+    ASSERT_EQ(bb.bv_mul(a, b), expected);
+    ASSERT_EQ(bb.num_aig_ands(), num_ands);
+  }
+
+  // Symbolic check of the encodings against the array multiplier over the
+  // same inputs, by random simulation of the AIGs.
+  using Bits = bb::AigBitblaster::Bits;
+  for (uint64_t size : {64, 65})
+  {
+    bb::AigBitblaster bb;
+    auto a = bb.bv_constant(size);
+    auto b = bb.bv_constant(size);
+    bb.set_mul_encoding(bb::MulEncoding::ARRAY);
+    auto expected = bb.bv_mul(a, b);
+    // The full-width Karatsuba product of mul_full(), which sums up the
+    // partial products with sum_columns(), against the array multiplier
+    // over the zero extended inputs. The operands and the result of
+    // mul_full() are LSB first.
+    auto zero = bb.bv_value(BitVector::mk_zero(size));
+    auto expected_full =
+        bb.bv_mul(bb.bv_concat(zero, a), bb.bv_concat(zero, b));
+    Bits full = bb.mul_full(Bits(a.rbegin(), a.rend()),
+                            Bits(b.rbegin(), b.rend()));
+    std::vector<std::pair<Bits, Bits>> pairs;
+    pairs.emplace_back(Bits(full.rbegin(), full.rend()), expected_full);
+    for (auto encoding : {bb::MulEncoding::DADDA,
+                          bb::MulEncoding::KARATSUBA,
+                          bb::MulEncoding::AUTO})
+    {
+      bb.set_mul_encoding(encoding);
+      pairs.emplace_back(bb.bv_mul(a, b), expected);
+    }
+
+    std::vector<bb::AigNode> roots;
+    for (const auto& [res, exp] : pairs)
+    {
+      roots.insert(roots.end(), res.begin(), res.end());
+      roots.insert(roots.end(), exp.begin(), exp.end());
+    }
+    bb::AigSimulator sim(bb.aig_manager(), roots, 4);
+    ASSERT_EQ(sim.num_inputs(), 2 * size);
+    for (size_t round = 0; round < 64; ++round)
+    {
+      sim.simulate();
+      for (const auto& [res, exp] : pairs)
+      {
+        ASSERT_EQ(res.size(), exp.size());
+        for (size_t i = 0; i < res.size(); ++i)
+        {
+          ASSERT_TRUE(sim.equal_signatures(res[i], exp[i]));
+        }
+      }
+    }
+  }
+}
+
+TEST_F(TestAigBitblaster, bv_udiv_urem_encodings)
+{
+  RNG rng(42);
+  for (auto encoding :
+       {bb::DivEncoding::RESTORING, bb::DivEncoding::NON_RESTORING})
+  {
+    bb::AigBitblaster bb;
+    bb.set_div_encoding(encoding);
+    for (uint64_t size : {1, 2, 3, 5, 8, 31, 32, 33, 64, 65})
+    {
+      for (size_t i = 0; i < 20; ++i)
+      {
+        BitVector x(size, rng);
+        // Include division by zero and by one.
+        BitVector y = i == 0   ? BitVector::mk_zero(size)
+                      : i == 1 ? BitVector::mk_one(size)
+                               : BitVector(size, rng);
+        BitVector quot = x.bvudiv(y);
+        BitVector rem  = x.bvurem(y);
+        auto [res_quot, res_rem] =
+            bb.bv_udiv_urem(bb.bv_value(x), bb.bv_value(y));
+        ASSERT_EQ(res_quot.size(), size);
+        ASSERT_EQ(res_rem.size(), size);
+        for (size_t j = 0; j < size; ++j)
+        {
+          ASSERT_TRUE(res_quot[j].is_true() || res_quot[j].is_false());
+          ASSERT_TRUE(res_rem[j].is_true() || res_rem[j].is_false());
+          ASSERT_EQ(res_quot[j].is_true(), quot.bit(size - 1 - j));
+          ASSERT_EQ(res_rem[j].is_true(), rem.bit(size - 1 - j));
+        }
+      }
+    }
+  }
+}
+
 TEST_F(TestAigBitblaster, bv_udiv)
 {
   bb::AigBitblaster bb;
@@ -380,14 +514,15 @@ TEST_F(TestAigBitblaster, bv_ite) {
       GTEST_SKIP_("SOLVER_BINARY environment variable not set.");
     }
     std::stringstream ss;
-    declare_const(ss, a);
-    declare_const(ss, b);
-    declare_const(ss, c);
-    bb::aig::Smt2Printer::print(ss, bb_ite);
-    define_const(ss, "a", a);
-    define_const(ss, "b", b);
-    define_const(ss, "c", c);
-    define_const(ss, "res", bb_ite);
+    const bb::AigManager& mgr = bb.aig_manager();
+    declare_const(ss, mgr, a);
+    declare_const(ss, mgr, b);
+    declare_const(ss, mgr, c);
+    bb::aig::Smt2Printer::print(ss, mgr, bb_ite);
+    define_const(ss, mgr, "a", a);
+    define_const(ss, mgr, "b", b);
+    define_const(ss, mgr, "c", c);
+    define_const(ss, mgr, "res", bb_ite);
     ss << "(assert (distinct res (ite c a b)))\n";
     ASSERT_EQ("unsat", check_sat(ss));
 }
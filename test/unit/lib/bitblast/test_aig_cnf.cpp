@@ -131,10 +131,9 @@ class TestAigCnf : public TestCommon
   // a * -1 != ~a + 1
   static std::string perf_test1(size_t bw)
   {
-    bb::AigManager aigmgr;
     bb::AigBitblaster bb;
     DummySatSolver solver;
-    bb::AigCnfEncoder enc(solver);
+    bb::AigCnfEncoder enc(bb.aig_manager(), solver);
 
     auto a       = bb.bv_constant(bw);
     auto one     = bb.bv_value(BitVector(bw, "1", 10));
@@ -153,10 +152,9 @@ class TestAigCnf : public TestCommon
   // a + b + c != c + b + a
   static std::string perf_test2(size_t bw)
   {
-    bb::AigManager aigmgr;
     bb::AigBitblaster bb;
     DummySatSolver solver;
-    bb::AigCnfEncoder enc(solver);
+    bb::AigCnfEncoder enc(bb.aig_manager(), solver);
 
     auto a = bb.bv_constant(bw);
     auto b = bb.bv_constant(bw);
@@ -177,10 +175,9 @@ class TestAigCnf : public TestCommon
   // x * (a + b) != x * a + x * b
   static std::string perf_test3(size_t bw)
   {
-    bb::AigManager aigmgr;
     bb::AigBitblaster bb;
     DummySatSolver solver;
-    bb::AigCnfEncoder enc(solver);
+    bb::AigCnfEncoder enc(bb.aig_manager(), solver);
 
     auto a = bb.bv_constant(bw);
     auto b = bb.bv_constant(bw);
@@ -202,15 +199,16 @@ class TestAigCnf : public TestCommon
 
 TEST_F(TestAigCnf, ctor_dtor)
 {
+  bb::AigManager aigmgr;
   DummySatSolver solver;
-  bb::AigCnfEncoder enc(solver);
+  bb::AigCnfEncoder enc(aigmgr, solver);
 }
 
 TEST_F(TestAigCnf, enc_false)
 {
   bb::AigManager aigmgr;
   DummySatSolver solver;
-  bb::AigCnfEncoder enc(solver);
+  bb::AigCnfEncoder enc(aigmgr, solver);
 
   bb::AigNode false_aig = aigmgr.mk_false();
   enc.encode(false_aig);
@@ -222,7 +220,7 @@ TEST_F(TestAigCnf, enc_true)
 {
   bb::AigManager aigmgr;
   DummySatSolver solver;
-  bb::AigCnfEncoder enc(solver);
+  bb::AigCnfEncoder enc(aigmgr, solver);
 
   bb::AigNode false_aig = aigmgr.mk_true();
   enc.encode(false_aig);
@@ -234,7 +232,7 @@ TEST_F(TestAigCnf, enc_const)
 {
   bb::AigManager aigmgr;
   DummySatSolver solver;
-  bb::AigCnfEncoder enc(solver);
+  bb::AigCnfEncoder enc(aigmgr, solver);
 
   bb::AigNode aig = aigmgr.mk_bit();
   enc.encode(aig);
@@ -245,7 +243,7 @@ TEST_F(TestAigCnf, enc_and)
 {
   bb::AigManager aigmgr;
   DummySatSolver solver;
-  bb::AigCnfEncoder enc(solver);
+  bb::AigCnfEncoder enc(aigmgr, solver);
 
   bb::AigNode a       = aigmgr.mk_bit();
   bb::AigNode b       = aigmgr.mk_bit();
@@ -261,7 +259,7 @@ TEST_F(TestAigCnf, enc_and_top)
 {
   bb::AigManager aigmgr;
   DummySatSolver solver;
-  bb::AigCnfEncoder enc(solver);
+  bb::AigCnfEncoder enc(aigmgr, solver);
 
   bb::AigNode a       = aigmgr.mk_bit();
   bb::AigNode b       = aigmgr.mk_bit();
@@ -274,7 +272,7 @@ TEST_F(TestAigCnf, enc_and_top2)
 {
   bb::AigManager aigmgr;
   DummySatSolver solver;
-  bb::AigCnfEncoder enc(solver);
+  bb::AigCnfEncoder enc(aigmgr, solver);
 
   bb::AigNode a        = aigmgr.mk_bit();
   bb::AigNode b        = aigmgr.mk_bit();
@@ -293,7 +291,7 @@ TEST_F(TestAigCnf, enc_or)
 {
   bb::AigManager aigmgr;
   DummySatSolver solver;
-  bb::AigCnfEncoder enc(solver);
+  bb::AigCnfEncoder enc(aigmgr, solver);
 
   bb::AigNode a      = aigmgr.mk_bit();
   bb::AigNode b      = aigmgr.mk_bit();
@@ -311,7 +309,7 @@ TEST_F(TestAigCnf, enc_or_top)
 {
   bb::AigManager aigmgr;
   DummySatSolver solver;
-  bb::AigCnfEncoder enc(solver);
+  bb::AigCnfEncoder enc(aigmgr, solver);
 
   bb::AigNode a      = aigmgr.mk_bit();
   bb::AigNode b      = aigmgr.mk_bit();
@@ -324,7 +322,7 @@ TEST_F(TestAigCnf, enc_or_top2)
 {
   bb::AigManager aigmgr;
   DummySatSolver solver;
-  bb::AigCnfEncoder enc(solver);
+  bb::AigCnfEncoder enc(aigmgr, solver);
 
   bb::AigNode a       = aigmgr.mk_bit();
   bb::AigNode b       = aigmgr.mk_bit();
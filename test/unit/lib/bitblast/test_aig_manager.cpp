@@ -27,13 +27,13 @@ TEST_F(TestAigMgr, false_true_aig)
 
   ASSERT_TRUE(false_aig.is_false());
   ASSERT_FALSE(false_aig.is_true());
-  ASSERT_FALSE(false_aig.is_const());
-  ASSERT_FALSE(false_aig.is_and());
+  ASSERT_FALSE(aigmgr.is_const(false_aig));
+  ASSERT_FALSE(aigmgr.is_and(false_aig));
   ASSERT_TRUE(false_aig.is_negated());
   ASSERT_TRUE(true_aig.is_true());
   ASSERT_FALSE(true_aig.is_false());
-  ASSERT_FALSE(true_aig.is_const());
-  ASSERT_FALSE(true_aig.is_and());
+  ASSERT_FALSE(aigmgr.is_const(true_aig));
+  ASSERT_FALSE(aigmgr.is_and(true_aig));
   ASSERT_FALSE(true_aig.is_negated());
   ASSERT_EQ(aigmgr.mk_not(true_aig), false_aig);
 }
@@ -44,10 +44,10 @@ TEST_F(TestAigMgr, const_aig)
 
   auto const_aig = aigmgr.mk_bit();
 
-  ASSERT_TRUE(const_aig.is_const());
+  ASSERT_TRUE(aigmgr.is_const(const_aig));
   ASSERT_FALSE(const_aig.is_false());
   ASSERT_FALSE(const_aig.is_true());
-  ASSERT_FALSE(const_aig.is_and());
+  ASSERT_FALSE(aigmgr.is_and(const_aig));
   ASSERT_FALSE(const_aig.is_negated());
 }
 
@@ -58,10 +58,10 @@ TEST_F(TestAigMgr, not_aig)
   auto bit     = aigmgr.mk_bit();
   auto not_aig = aigmgr.mk_not(bit);
 
-  ASSERT_FALSE(not_aig.is_and());
+  ASSERT_FALSE(aigmgr.is_and(not_aig));
   ASSERT_FALSE(not_aig.is_false());
   ASSERT_FALSE(not_aig.is_true());
-  ASSERT_TRUE(not_aig.is_const());
+  ASSERT_TRUE(aigmgr.is_const(not_aig));
   ASSERT_TRUE(not_aig.is_negated());
   ASSERT_FALSE(aigmgr.mk_not(not_aig).is_negated());
   ASSERT_EQ(bit, aigmgr.mk_not(not_aig));
@@ -73,10 +73,10 @@ TEST_F(TestAigMgr, and_aig)
 
   auto and_aig = aigmgr.mk_and(aigmgr.mk_bit(), aigmgr.mk_bit());
 
-  ASSERT_TRUE(and_aig.is_and());
+  ASSERT_TRUE(aigmgr.is_and(and_aig));
   ASSERT_FALSE(and_aig.is_false());
   ASSERT_FALSE(and_aig.is_true());
-  ASSERT_FALSE(and_aig.is_const());
+  ASSERT_FALSE(aigmgr.is_const(and_aig));
   ASSERT_FALSE(and_aig.is_negated());
 }
 
@@ -88,10 +88,10 @@ TEST_F(TestAigMgr, and_unique_aig)
   auto right   = aigmgr.mk_bit();
   auto and_aig = aigmgr.mk_and(left, right);
 
-  ASSERT_TRUE(and_aig.is_and());
+  ASSERT_TRUE(aigmgr.is_and(and_aig));
   ASSERT_FALSE(and_aig.is_false());
   ASSERT_FALSE(and_aig.is_true());
-  ASSERT_FALSE(and_aig.is_const());
+  ASSERT_FALSE(aigmgr.is_const(and_aig));
   ASSERT_FALSE(and_aig.is_negated());
   ASSERT_EQ(and_aig, aigmgr.mk_and(left, right));
   ASSERT_EQ(and_aig, aigmgr.mk_and(right, left));
@@ -103,10 +103,10 @@ TEST_F(TestAigMgr, or_aig)
 
   auto and_aig = aigmgr.mk_or(aigmgr.mk_bit(), aigmgr.mk_bit());
 
-  ASSERT_TRUE(and_aig.is_and());
+  ASSERT_TRUE(aigmgr.is_and(and_aig));
   ASSERT_FALSE(and_aig.is_false());
   ASSERT_FALSE(and_aig.is_true());
-  ASSERT_FALSE(and_aig.is_const());
+  ASSERT_FALSE(aigmgr.is_const(and_aig));
   ASSERT_TRUE(and_aig.is_negated());
 }
 
@@ -118,10 +118,10 @@ TEST_F(TestAigMgr, or_unique_aig)
   auto right  = aigmgr.mk_bit();
   auto or_aig = aigmgr.mk_or(left, right);
 
-  ASSERT_TRUE(or_aig.is_and());
+  ASSERT_TRUE(aigmgr.is_and(or_aig));
   ASSERT_FALSE(or_aig.is_false());
   ASSERT_FALSE(or_aig.is_true());
-  ASSERT_FALSE(or_aig.is_const());
+  ASSERT_FALSE(aigmgr.is_const(or_aig));
   ASSERT_TRUE(or_aig.is_negated());
   ASSERT_EQ(or_aig, aigmgr.mk_or(left, right));
   ASSERT_EQ(or_aig, aigmgr.mk_or(right, left));
@@ -133,10 +133,10 @@ TEST_F(TestAigMgr, iff_aig)
 
   auto iff_aig = aigmgr.mk_iff(aigmgr.mk_bit(), aigmgr.mk_bit());
 
-  ASSERT_TRUE(iff_aig.is_and());
+  ASSERT_TRUE(aigmgr.is_and(iff_aig));
   ASSERT_FALSE(iff_aig.is_false());
   ASSERT_FALSE(iff_aig.is_true());
-  ASSERT_FALSE(iff_aig.is_const());
+  ASSERT_FALSE(aigmgr.is_const(iff_aig));
 }
 
 TEST_F(TestAigMgr, iff_unique_aig)
@@ -147,10 +147,10 @@ TEST_F(TestAigMgr, iff_unique_aig)
   auto right   = aigmgr.mk_bit();
   auto iff_aig = aigmgr.mk_iff(left, right);
 
-  ASSERT_TRUE(iff_aig.is_and());
+  ASSERT_TRUE(aigmgr.is_and(iff_aig));
   ASSERT_FALSE(iff_aig.is_false());
   ASSERT_FALSE(iff_aig.is_true());
-  ASSERT_FALSE(iff_aig.is_const());
+  ASSERT_FALSE(aigmgr.is_const(iff_aig));
   ASSERT_EQ(iff_aig, aigmgr.mk_iff(left, right));
   ASSERT_EQ(iff_aig, aigmgr.mk_iff(right, left));
 }
@@ -162,10 +162,10 @@ TEST_F(TestAigMgr, ite_aig)
   auto ite_aig =
       aigmgr.mk_ite(aigmgr.mk_bit(), aigmgr.mk_bit(), aigmgr.mk_bit());
 
-  ASSERT_TRUE(ite_aig.is_and());
+  ASSERT_TRUE(aigmgr.is_and(ite_aig));
   ASSERT_FALSE(ite_aig.is_false());
   ASSERT_FALSE(ite_aig.is_true());
-  ASSERT_FALSE(ite_aig.is_const());
+  ASSERT_FALSE(aigmgr.is_const(ite_aig));
 }
 
 TEST_F(TestAigMgr, ite_unique_aig)
@@ -177,10 +177,10 @@ TEST_F(TestAigMgr, ite_unique_aig)
   auto right   = aigmgr.mk_bit();
   auto ite_aig = aigmgr.mk_ite(cond, left, right);
 
-  ASSERT_TRUE(ite_aig.is_and());
+  ASSERT_TRUE(aigmgr.is_and(ite_aig));
   ASSERT_FALSE(ite_aig.is_false());
   ASSERT_FALSE(ite_aig.is_true());
-  ASSERT_FALSE(ite_aig.is_const());
+  ASSERT_FALSE(aigmgr.is_const(ite_aig));
   ASSERT_EQ(ite_aig, aigmgr.mk_ite(cond, left, right));
   ASSERT_EQ(ite_aig, aigmgr.mk_ite(aigmgr.mk_not(cond), right, left));
 }
@@ -465,7 +465,6 @@ TEST_F(TestAigMgr, idempotence4_3)
   auto a = mgr.mk_bit();
   auto b = mgr.mk_bit();
   auto c = mgr.mk_bit();
-  auto d = mgr.mk_bit();
 
   {
     auto d = a;
@@ -480,4 +479,128 @@ TEST_F(TestAigMgr, idempotence4_3)
   }
 }
 
+TEST_F(TestAigMgr, opt_level0)
+{
+  bb::AigManager mgr(0);
+
+  auto a = mgr.mk_bit();
+  auto b = mgr.mk_bit();
+
+  auto and_aig = mgr.mk_and(a, mgr.mk_true());
+  ASSERT_TRUE(mgr.is_and(and_aig));
+  ASSERT_EQ(mgr.get_child(and_aig, 1), a);
+  and_aig = mgr.mk_and(a, mgr.mk_not(a));
+  ASSERT_TRUE(mgr.is_and(and_aig));
+  ASSERT_TRUE(mgr.is_and(mgr.mk_and(a, a)));
+  ASSERT_TRUE(mgr.is_and(mgr.mk_and(mgr.mk_and(a, b), mgr.mk_not(a))));
+  ASSERT_EQ(mgr.statistics().num_ands, 5);
+}
+
+TEST_F(TestAigMgr, opt_level1)
+{
+  bb::AigManager mgr(1);
+
+  auto a = mgr.mk_bit();
+  auto b = mgr.mk_bit();
+
+  ASSERT_EQ(mgr.mk_and(a, mgr.mk_true()), a);
+  ASSERT_EQ(mgr.mk_and(a, mgr.mk_not(a)), mgr.mk_false());
+  // Contradiction rule (asymmetric) is only applied at level 2.
+  ASSERT_TRUE(mgr.is_and(mgr.mk_and(mgr.mk_and(a, b), mgr.mk_not(a))));
+}
+
+TEST_F(TestAigMgr, opt_level2)
+{
+  bb::AigManager mgr(2);
+
+  auto a = mgr.mk_bit();
+  auto b = mgr.mk_bit();
+  auto d = mgr.mk_bit();
+
+  ASSERT_EQ(mgr.mk_and(mgr.mk_and(a, b), mgr.mk_not(a)), mgr.mk_false());
+  // Substitution rule is only applied at level 3.
+  auto and_aig = mgr.mk_and(mgr.mk_not(mgr.mk_and(a, b)), b);
+  ASSERT_FALSE(and_aig == mgr.mk_and(mgr.mk_not(a), b));
+  // Idempotence rule over two AND gates is only applied at level 4.
+  ASSERT_FALSE(mgr.mk_and(mgr.mk_and(a, b), mgr.mk_and(a, d))
+               == mgr.mk_and(mgr.mk_and(a, b), d));
+}
+
+TEST_F(TestAigMgr, opt_level3)
+{
+  bb::AigManager mgr(3);
+
+  auto a = mgr.mk_bit();
+  auto b = mgr.mk_bit();
+  auto d = mgr.mk_bit();
+
+  ASSERT_EQ(mgr.mk_and(mgr.mk_not(mgr.mk_and(a, b)), b),
+            mgr.mk_and(mgr.mk_not(a), b));
+  ASSERT_FALSE(mgr.mk_and(mgr.mk_and(a, b), mgr.mk_and(a, d))
+               == mgr.mk_and(mgr.mk_and(a, b), d));
+}
+
+TEST_F(TestAigMgr, rewrite_statistics)
+{
+  bb::AigManager mgr;
+
+  auto a = mgr.mk_bit();
+  auto b = mgr.mk_bit();
+  auto c = mgr.mk_bit();
+  auto d = mgr.mk_bit();
+
+  mgr.mk_and(a, mgr.mk_true());
+  ASSERT_EQ(mgr.statistics().num_rw_neutrality, 1);
+  mgr.mk_and(mgr.mk_false(), a);
+  ASSERT_EQ(mgr.statistics().num_rw_boundedness, 1);
+  mgr.mk_and(a, a);
+  ASSERT_EQ(mgr.statistics().num_rw_idempotence, 1);
+  mgr.mk_and(a, mgr.mk_not(a));
+  mgr.mk_and(mgr.mk_and(a, b), mgr.mk_not(a));
+  ASSERT_EQ(mgr.statistics().num_rw_contradiction, 2);
+  mgr.mk_and(mgr.mk_not(mgr.mk_and(a, b)), mgr.mk_not(a));
+  ASSERT_EQ(mgr.statistics().num_rw_subsumption, 1);
+  mgr.mk_and(mgr.mk_not(mgr.mk_and(a, b)),
+             mgr.mk_not(mgr.mk_and(a, mgr.mk_not(b))));
+  ASSERT_EQ(mgr.statistics().num_rw_resolution, 1);
+  mgr.mk_and(mgr.mk_not(mgr.mk_and(c, d)), d);
+  ASSERT_EQ(mgr.statistics().num_rw_substitution, 1);
+  mgr.mk_and(mgr.mk_and(a, b), mgr.mk_and(a, c));
+  ASSERT_EQ(mgr.statistics().num_rw_idempotence, 2);
+}
+
+TEST_F(TestAigMgr, garbage_collect)
+{
+  bb::AigManager mgr;
+
+  auto a       = mgr.mk_bit();
+  auto b       = mgr.mk_bit();
+  auto c       = mgr.mk_bit();
+  auto and_ab  = mgr.mk_and(a, b);
+  auto and_abc = mgr.mk_and(and_ab, c);
+  auto dead    = mgr.mk_and(mgr.mk_not(and_ab), c);
+
+  mgr.inc_ref(mgr.mk_not(and_abc));
+  ASSERT_EQ(mgr.garbage_collect(), 1);
+  ASSERT_EQ(mgr.statistics().num_ands, 2);
+  ASSERT_EQ(mgr.statistics().num_consts, 3);
+  // The unique table still contains the remaining AND gates.
+  ASSERT_EQ(mgr.mk_and(and_ab, c), and_abc);
+  ASSERT_EQ(mgr.statistics().num_ands, 2);
+
+  // The id of the released AND gate is reused.
+  auto and_bc = mgr.mk_and(b, c);
+  ASSERT_EQ(and_bc.get_id(), dead.get_id());
+  ASSERT_EQ(mgr.get_child(and_bc, 0), b);
+  ASSERT_EQ(mgr.get_child(and_bc, 1), c);
+
+  mgr.dec_ref(mgr.mk_not(and_abc));
+  ASSERT_EQ(mgr.garbage_collect(), 6);
+  ASSERT_EQ(mgr.statistics().num_ands, 0);
+  ASSERT_EQ(mgr.statistics().num_consts, 0);
+  ASSERT_EQ(mgr.statistics().num_gc, 2);
+  ASSERT_EQ(mgr.statistics().num_released, 7);
+  ASSERT_TRUE(mgr.mk_and(mgr.mk_true(), mgr.mk_false()).is_false());
+}
+
 }  // namespace bzla::test
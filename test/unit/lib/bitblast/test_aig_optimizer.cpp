@@ -0,0 +1,269 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "bitblast/aig/aig_optimizer.h"
+#include "bitblast/aig/aig_simulator.h"
+#include "bitblast/aig_bitblaster.h"
+#include "rng/rng.h"
+#include "test_lib.h"
+
+namespace bzla::test {
+
+class TestAigOptimizer : public TestCommon
+{
+ protected:
+  /** @return The number of AND gates in the cones of given roots. */
+  static size_t num_ands(const bb::AigManager& mgr,
+                         const std::vector<bb::AigNode>& roots)
+  {
+    return bb::AigSimulator(mgr, roots).num_ands();
+  }
+
+  /**
+   * Optimize given roots and check that the optimized roots are equivalent
+   * under random simulation and do not require more AND gates.
+   * @return The optimized roots.
+   */
+  static std::vector<bb::AigNode> optimize(
+      const bb::AigManager& mgr,
+      bb::AigOptimizer& opt,
+      const std::vector<bb::AigNode>& roots)
+  {
+    std::vector<bb::AigNode> res = opt.optimize(roots);
+    std::vector<bb::AigNode> all(roots);
+    all.insert(all.end(), res.begin(), res.end());
+    bb::AigSimulator sim(mgr, all, 4);
+    for (size_t i = 0; i < 16; ++i)
+    {
+      sim.simulate();
+      for (size_t j = 0; j < roots.size(); ++j)
+      {
+        EXPECT_TRUE(sim.equal_signatures(roots[j], res[j]));
+      }
+    }
+    EXPECT_LE(num_ands(mgr, res), num_ands(mgr, roots));
+    return res;
+  }
+};
+
+TEST_F(TestAigOptimizer, consts)
+{
+  bb::AigManager aigmgr;
+  bb::AigOptimizer opt(aigmgr);
+  bb::AigNode a = aigmgr.mk_bit();
+  ASSERT_EQ(opt.optimize(aigmgr.mk_true()), aigmgr.mk_true());
+  ASSERT_EQ(opt.optimize(aigmgr.mk_false()), aigmgr.mk_false());
+  ASSERT_EQ(opt.optimize(a), a);
+  ASSERT_EQ(opt.optimize(aigmgr.mk_not(a)), aigmgr.mk_not(a));
+  ASSERT_EQ(opt.statistics().num_roots, 0);
+}
+
+TEST_F(TestAigOptimizer, balance)
+{
+  bb::AigManager aigmgr(0);
+  bb::AigOptimizer opt(aigmgr);
+  std::vector<bb::AigNode> bits;
+  for (size_t i = 0; i < 16; ++i)
+  {
+    bits.push_back(aigmgr.mk_bit());
+  }
+  // A chain of 15 AND gates of depth 15 is rebuilt as tree of depth 4, the
+  // duplicate leaf is removed.
+  bb::AigNode chain = bits[0];
+  for (size_t i = 1; i < bits.size(); ++i)
+  {
+    chain = aigmgr.mk_and(chain, bits[i]);
+  }
+  chain = aigmgr.mk_and(chain, bits[3]);
+  auto res = optimize(aigmgr, opt, {chain});
+  ASSERT_EQ(num_ands(aigmgr, res), 15);
+  ASSERT_EQ(opt.statistics().num_balanced, 1);
+
+  // A leaf in both polarities.
+  bb::AigOptimizer opt2(aigmgr);
+  chain = aigmgr.mk_and(chain, aigmgr.mk_not(bits[7]));
+  res   = optimize(aigmgr, opt2, {chain});
+  ASSERT_EQ(res[0], aigmgr.mk_false());
+}
+
+TEST_F(TestAigOptimizer, rewrite)
+{
+  bb::AigManager aigmgr(0);
+  bb::AigOptimizer opt(aigmgr);
+  bb::AigNode a = aigmgr.mk_bit();
+  bb::AigNode b = aigmgr.mk_bit();
+  bb::AigNode c = aigmgr.mk_bit();
+  // (a & b) | (a & c) requires 3 AND gates, a & (b | c) requires 2.
+  bb::AigNode f =
+      aigmgr.mk_or(aigmgr.mk_and(a, b), aigmgr.mk_and(a, c));
+  ASSERT_EQ(num_ands(aigmgr, {f}), 3);
+  auto res = optimize(aigmgr, opt, {f});
+  ASSERT_EQ(num_ands(aigmgr, res), 2);
+  ASSERT_GE(opt.statistics().num_rewritten, 1);
+  // Optimizing an already optimized node is the identity.
+  ASSERT_EQ(opt.optimize(f), res[0]);
+  ASSERT_EQ(opt.optimize(res[0]), res[0]);
+}
+
+TEST_F(TestAigOptimizer, all_functions3)
+{
+  // All functions over 3 inputs, constructed as sum of minterms.
+  bb::AigManager aigmgr(0);
+  bb::AigOptimizer opt(aigmgr);
+  std::vector<bb::AigNode> inputs = {
+      aigmgr.mk_bit(), aigmgr.mk_bit(), aigmgr.mk_bit()};
+  std::vector<bb::AigNode> roots;
+  for (uint32_t tt = 0; tt < 256; ++tt)
+  {
+    bb::AigNode f = aigmgr.mk_false();
+    for (uint32_t m = 0; m < 8; ++m)
+    {
+      if ((tt >> m) & 1)
+      {
+        bb::AigNode minterm = aigmgr.mk_true();
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+          minterm = aigmgr.mk_and(minterm,
+                                  (m >> i) & 1 ? inputs[i]
+                                               : aigmgr.mk_not(inputs[i]));
+        }
+        f = aigmgr.mk_or(f, minterm);
+      }
+    }
+    roots.push_back(f);
+  }
+  ASSERT_LT(num_ands(aigmgr, optimize(aigmgr, opt, roots)),
+            num_ands(aigmgr, roots));
+}
+
+TEST_F(TestAigOptimizer, bitblast)
+{
+  for (uint8_t level : {0, 2, 4})
+  {
+    bb::AigBitblaster bb(level);
+    bb::AigManager& aigmgr = bb.aig_manager();
+    bb::AigOptimizer opt(aigmgr);
+    auto a = bb.bv_constant(8);
+    auto b = bb.bv_constant(8);
+    std::vector<bb::AigNode> roots;
+    for (const auto& bits : {bb.bv_add(a, b),
+                             bb.bv_mul(a, b),
+                             bb.bv_udiv(a, b),
+                             bb.bv_urem(a, b),
+                             bb.bv_shl(a, b),
+                             bb.bv_ult(a, b)})
+    {
+      roots.insert(roots.end(), bits.begin(), bits.end());
+    }
+    size_t ands = num_ands(aigmgr, roots);
+    auto res    = optimize(aigmgr, opt, roots);
+    ASSERT_EQ(opt.statistics().num_roots, roots.size());
+    ASSERT_EQ(opt.statistics().num_skipped, 0);
+    ASSERT_LT(num_ands(aigmgr, res), ands);
+  }
+}
+
+TEST_F(TestAigOptimizer, random)
+{
+  RNG rng(42);
+  for (size_t k = 0; k < 20; ++k)
+  {
+    bb::AigManager aigmgr(static_cast<uint8_t>(k % 5));
+    bb::AigOptimizer opt(aigmgr);
+    std::vector<bb::AigNode> nodes;
+    for (size_t i = 0; i < 8; ++i)
+    {
+      nodes.push_back(aigmgr.mk_bit());
+    }
+    for (size_t i = 0; i < 200; ++i)
+    {
+      bb::AigNode l = nodes[rng.pick<size_t>(0, nodes.size() - 1)];
+      bb::AigNode r = nodes[rng.pick<size_t>(0, nodes.size() - 1)];
+      nodes.push_back(aigmgr.mk_and(rng.flip_coin() ? aigmgr.mk_not(l) : l,
+                                    rng.flip_coin() ? aigmgr.mk_not(r) : r));
+    }
+    optimize(aigmgr, opt, {nodes.end() - 10, nodes.end()});
+  }
+}
+
+TEST_F(TestAigOptimizer, incremental)
+{
+  bb::AigBitblaster bb;
+  bb::AigManager& aigmgr = bb.aig_manager();
+  bb::AigOptimizer opt(aigmgr);
+  auto a   = bb.bv_constant(8);
+  auto b   = bb.bv_constant(8);
+  auto mul = bb.bv_mul(a, b);
+  auto res = optimize(aigmgr, opt, mul);
+  uint64_t ands = opt.statistics().num_ands;
+  // Optimizing the same roots again does not process any AND gates.
+  ASSERT_EQ(optimize(aigmgr, opt, mul), res);
+  ASSERT_EQ(opt.statistics().num_ands, ands);
+  // Only the AND gates of the new cones are processed.
+  auto add = bb.bv_add(mul, a);
+  optimize(aigmgr, opt, add);
+  ASSERT_GT(opt.statistics().num_ands, ands);
+  ASSERT_LT(opt.statistics().num_ands, ands + num_ands(aigmgr, add));
+}
+
+TEST_F(TestAigOptimizer, budget)
+{
+  bb::AigBitblaster bb;
+  bb::AigManager& aigmgr = bb.aig_manager();
+  bb::AigOptimizer opt(aigmgr, 100);
+  auto a   = bb.bv_constant(8);
+  auto b   = bb.bv_constant(8);
+  auto mul = bb.bv_mul(a, b);
+  auto res = optimize(aigmgr, opt, mul);
+  ASSERT_GT(opt.statistics().num_skipped, 0);
+  ASSERT_LE(opt.statistics().num_ands, 100);
+  // Skipped roots are not optimized.
+  ASSERT_EQ(res.back(), mul.back());
+}
+
+TEST_F(TestAigOptimizer, budget_exhausted)
+{
+  bb::AigManager aigmgr(0);
+  bb::AigOptimizer opt(aigmgr, 5);
+  bb::AigNode a = aigmgr.mk_bit();
+  bb::AigNode b = aigmgr.mk_bit();
+  bb::AigNode c = aigmgr.mk_bit();
+  bb::AigNode d = aigmgr.mk_bit();
+  bb::AigNode f = aigmgr.mk_and(aigmgr.mk_and(aigmgr.mk_and(a, b), c), d);
+  bb::AigNode g = aigmgr.mk_and(aigmgr.mk_and(b, c), aigmgr.mk_not(d));
+  bb::AigNode opt_f = opt.optimize(f);
+  ASSERT_FALSE(opt_f == f);
+  opt.optimize(g);
+  ASSERT_GE(opt.statistics().num_ands, 5);
+  // Processed roots are mapped to the same node after the budget is
+  // exhausted.
+  ASSERT_EQ(opt.optimize(f), opt_f);
+  ASSERT_EQ(opt.optimize(aigmgr.mk_not(f)), aigmgr.mk_not(opt_f));
+  ASSERT_EQ(opt.optimize(std::vector<bb::AigNode>{g, f})[1], opt_f);
+}
+
+TEST_F(TestAigOptimizer, garbage_collect)
+{
+  bb::AigBitblaster bb;
+  bb::AigManager& aigmgr = bb.aig_manager();
+  bb::AigOptimizer opt(aigmgr);
+  auto a   = bb.bv_constant(8);
+  auto b   = bb.bv_constant(8);
+  auto mul = bb.bv_mul(a, b);
+  auto res = optimize(aigmgr, opt, mul);
+  // The processed roots and their results are referenced, the intermediate
+  // results of the optimization are released.
+  ASSERT_GT(aigmgr.garbage_collect(), 0);
+  ASSERT_EQ(opt.optimize(mul), res);
+  auto add = bb.bv_add(mul, a);
+  optimize(aigmgr, opt, add);
+}
+
+}  // namespace bzla::test
@@ -0,0 +1,129 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <unordered_map>
+
+#include "bitblast/aig/aig_simulator.h"
+#include "bitblast/aig_bitblaster.h"
+#include "test_lib.h"
+
+namespace bzla::test {
+
+class TestAigSimulator : public TestCommon
+{
+ protected:
+  /** Evaluate given node under pattern `i` of the last simulation round. */
+  static bool eval(const bb::AigManager& mgr,
+                   const bb::AigSimulator& sim,
+                   const bb::AigNode& node,
+                   size_t i,
+                   std::unordered_map<int64_t, bool>& cache)
+  {
+    auto it = cache.find(node.get_id());
+    if (it != cache.end())
+    {
+      return it->second;
+    }
+    bool res;
+    if (node.is_true() || node.is_false() || mgr.is_const(node))
+    {
+      res = (sim.signature(node, i / 64) >> (i % 64)) & 1;
+    }
+    else
+    {
+      res = eval(mgr, sim, mgr.get_child(node, 0), i, cache)
+            && eval(mgr, sim, mgr.get_child(node, 1), i, cache);
+      if (node.is_negated())
+      {
+        res = !res;
+      }
+    }
+    cache.emplace(node.get_id(), res);
+    return res;
+  }
+};
+
+TEST_F(TestAigSimulator, consts)
+{
+  bb::AigManager aigmgr;
+  bb::AigNode a = aigmgr.mk_bit();
+  bb::AigSimulator sim(aigmgr, {aigmgr.mk_true(), aigmgr.mk_false(), a});
+  sim.simulate();
+  ASSERT_EQ(sim.num_inputs(), 1);
+  ASSERT_EQ(sim.num_ands(), 0);
+  ASSERT_EQ(sim.signature(aigmgr.mk_true()), UINT64_MAX);
+  ASSERT_EQ(sim.signature(aigmgr.mk_false()), 0);
+  ASSERT_EQ(sim.signature(aigmgr.mk_not(a)), ~sim.signature(a));
+}
+
+TEST_F(TestAigSimulator, bitblast)
+{
+  for (size_t num_words : {1, 2, 4, 5})
+  {
+    bb::AigBitblaster bb;
+    auto a   = bb.bv_constant(16);
+    auto b   = bb.bv_constant(16);
+    auto mul = bb.bv_mul(a, b);
+    auto add = bb.bv_add(a, b);
+    auto sub = bb.bv_add(b, a);
+    auto urem = bb.bv_urem(a, b);
+    std::vector<bb::AigNode> roots;
+    for (const auto& bits : {mul, add, sub, urem})
+    {
+      roots.insert(roots.end(), bits.begin(), bits.end());
+    }
+    bb::AigSimulator sim(bb.aig_manager(), roots, num_words);
+    ASSERT_EQ(sim.num_patterns(), 64 * num_words);
+    ASSERT_EQ(sim.num_inputs(), 32);
+    for (uint32_t round = 0; round < 3; ++round)
+    {
+      sim.simulate();
+      // Signatures agree with the values of the nodes.
+      for (size_t i = 0; i < sim.num_patterns(); i += 7)
+      {
+        std::unordered_map<int64_t, bool> cache;
+        for (const bb::AigNode& root : roots)
+        {
+          ASSERT_EQ(eval(bb.aig_manager(), sim, root, i, cache),
+                    static_cast<bool>((sim.signature(root, i / 64) >> (i % 64))
+                                      & 1));
+        }
+      }
+      // a + b and b + a are equivalence candidates, a * b and a + b are not.
+      for (size_t i = 0; i < 16; ++i)
+      {
+        ASSERT_TRUE(sim.equal_signatures(add[i], sub[i]));
+      }
+      ASSERT_FALSE(sim.equal_signatures(mul[15], add[15]));
+    }
+  }
+}
+
+TEST_F(TestAigSimulator, reused_ids)
+{
+  bb::AigManager aigmgr;
+  aigmgr.mk_and(aigmgr.mk_bit(), aigmgr.mk_bit());
+  ASSERT_EQ(aigmgr.garbage_collect(), 3);
+
+  // Released ids are reused in reverse order, the AND gate gets a smaller id
+  // than its children.
+  bb::AigNode a      = aigmgr.mk_bit();
+  bb::AigNode b      = aigmgr.mk_bit();
+  bb::AigNode and_ab = aigmgr.mk_and(a, aigmgr.mk_not(b));
+  ASSERT_LT(and_ab.get_id(), b.get_id());
+
+  bb::AigSimulator sim(aigmgr, {and_ab});
+  sim.simulate();
+  ASSERT_EQ(sim.num_inputs(), 2);
+  ASSERT_EQ(sim.num_ands(), 1);
+  ASSERT_EQ(sim.signature(and_ab), sim.signature(a) & ~sim.signature(b));
+}
+
+}  // namespace bzla::test
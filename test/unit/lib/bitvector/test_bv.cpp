@@ -3386,6 +3386,60 @@ TEST_F(TestBitVector, str)
   ASSERT_EQ(BitVector::from_ui(68, 3).str(16), "3");
 }
 
+TEST_F(TestBitVector, str_pow2)
+{
+  // Binary and hexadecimal strings are converted without GMP, check against
+  // GMP for large values of all representations.
+  for (uint64_t size : {1, 7, 64, 65, 200, 256, 257, 1000, 4096, 20000})
+  {
+    for (uint32_t i = 0; i < 20; ++i)
+    {
+      uint64_t nbits = d_rng->pick<uint64_t>(1, size);
+      std::string bin(nbits, '0');
+      for (char& c : bin)
+      {
+        c = d_rng->flip_coin() ? '1' : '0';
+      }
+      mpz_class val(bin, 2);
+      std::string hex = val.get_str(16);
+      if (i % 2)
+      {
+        // Upper case and leading zeros.
+        for (char& c : hex) c = static_cast<char>(std::toupper(c));
+        hex = std::string(i, '0') + hex;
+      }
+      std::string expected = std::string(size - nbits, '0') + bin;
+
+      ASSERT_TRUE(BitVector::fits_in_size(size, bin, 2));
+      ASSERT_TRUE(BitVector::fits_in_size(size, hex, 16));
+      if (size > 1)
+      {
+        ASSERT_EQ(BitVector::fits_in_size(size - 1, bin, 2),
+                  val == 0 || mpz_sizeinbase(val.get_mpz_t(), 2) < size);
+      }
+      BitVector bv(size, bin);
+      ASSERT_EQ(bv.str(), expected);
+      ASSERT_EQ(BitVector(size, hex, 16), bv);
+      ASSERT_EQ(bv.str(16), val.get_str(16));
+      ASSERT_EQ(bv.str(10), val.get_str(10));
+      std::stringstream ss;
+      bv.print(ss, 16);
+      ss << " " << bv;
+      ASSERT_EQ(ss.str(), val.get_str(16) + " " + expected);
+    }
+  }
+  ASSERT_TRUE(BitVector::fits_in_size(8, "-10000000", 2));
+  ASSERT_FALSE(BitVector::fits_in_size(8, "-10000001", 2));
+  ASSERT_TRUE(BitVector::fits_in_size(8, "-80", 16));
+  ASSERT_FALSE(BitVector::fits_in_size(8, "-81", 16));
+  ASSERT_FALSE(BitVector::fits_in_size(8, "100", 16));
+  ASSERT_TRUE(BitVector::fits_in_size(8, "0000000ff", 16));
+  ASSERT_TRUE(BitVector::fits_in_size(300, std::string(1000, '0'), 2));
+  ASSERT_FALSE(BitVector::fits_in_size(300, "1" + std::string(300, '0'), 2));
+  ASSERT_EQ(BitVector(300, std::string(300, '1')).str(16),
+            std::string(75, 'f'));
+}
+
 TEST_F(TestBitVector, to_uint64)
 {
   for (uint64_t i = 0; i < N_TESTS; ++i)
@@ -3400,6 +3454,27 @@ TEST_F(TestBitVector, to_uint64)
   ASSERT_DEATH(BitVector(128).to_uint64(), "d_size <= 64");
 }
 
+TEST_F(TestBitVector, limbs_roundtrip)
+{
+  for (uint64_t size : {1, 33, 64, 65, 128, 200, 256, 257, 1000})
+  {
+    size_t n = (size + 63) / 64;
+    for (uint32_t i = 0; i < 20; ++i)
+    {
+      BitVector bv(size, *d_rng);
+      std::vector<uint64_t> limbs(n);
+      bv.to_limbs(limbs.data());
+      ASSERT_EQ(BitVector::from_limbs(size, limbs.data()), bv);
+      if (size % 64)
+      {
+        // Bits above the size are ignored.
+        limbs.back() |= UINT64_MAX << (size % 64);
+        ASSERT_EQ(BitVector::from_limbs(size, limbs.data()), bv);
+      }
+    }
+  }
+}
+
 TEST_F(TestBitVector, compare)
 {
   for (uint64_t i = 0; i < 15; ++i)
@@ -4697,6 +4772,256 @@ TEST_F(TestBitVector, udivurem)
   test_udivurem(127);
 }
 
+TEST_F(TestBitVector, limbs)
+{
+  // Bit-vectors of size 65 to 256 are represented as fixed number of limbs,
+  // check against results computed on zero-extended GMP bit-vectors.
+  uint64_t ext = 2 * BitVector::s_max_size_limbs + 1;
+  for (uint32_t i = 0; i < N_TESTS; ++i)
+  {
+    uint64_t size = d_rng->pick<uint64_t>(65, BitVector::s_max_size_limbs);
+    BitVector a, b;
+    switch (i % 8)
+    {
+      case 0: a = BitVector::mk_ones(size); break;
+      case 1: a = BitVector::mk_min_signed(size); break;
+      default: a = BitVector(size, *d_rng);
+    }
+    switch (i % 5)
+    {
+      case 0: b = BitVector::mk_one(size); break;
+      case 1: b = BitVector::from_ui(size, d_rng->pick<uint64_t>()); break;
+      case 2: b = BitVector::mk_ones(size).ibvshr(size - 70); break;
+      default: b = BitVector(size, *d_rng);
+    }
+    if (i % 7 == 0)
+    {
+      b.ibvshr(d_rng->pick<uint64_t>(0, size - 1));
+    }
+    BitVector ea = a.bvzext(ext - size);
+    BitVector eb = b.bvzext(ext - size);
+
+    ASSERT_EQ(a.bvadd(b), ea.bvadd(eb).ibvextract(size - 1, 0));
+    ASSERT_EQ(a.bvsub(b), ea.bvsub(eb).ibvextract(size - 1, 0));
+    ASSERT_EQ(a.bvmul(b), ea.bvmul(eb).ibvextract(size - 1, 0));
+    ASSERT_EQ(a.bvneg(), ea.bvneg().ibvextract(size - 1, 0));
+    ASSERT_EQ(a.bvudiv(b), ea.bvudiv(eb).ibvextract(size - 1, 0));
+    ASSERT_EQ(a.bvurem(b), ea.bvurem(eb).ibvextract(size - 1, 0));
+    ASSERT_EQ(a.bvult(b), ea.bvult(eb));
+    ASSERT_EQ(a.bvslt(b), ea.bvsext(0).bvshl(ext - size).bvslt(
+                              eb.bvsext(0).bvshl(ext - size)));
+    ASSERT_EQ(a.is_umul_overflow(b),
+              !ea.bvmul(eb).ibvshr(size).is_zero());
+    ASSERT_EQ(a.is_uadd_overflow(b),
+              !ea.bvadd(eb).ibvshr(size).is_zero());
+    ASSERT_EQ(a.count_leading_zeros(),
+              ea.count_leading_zeros() - (ext - size));
+    ASSERT_EQ(a.count_trailing_zeros(),
+              a.is_zero() ? size : ea.count_trailing_zeros());
+
+    uint64_t shift = d_rng->pick<uint64_t>(0, size);
+    ASSERT_EQ(a.bvshl(shift), ea.bvshl(shift).ibvextract(size - 1, 0));
+    ASSERT_EQ(a.bvshr(shift), ea.bvshr(shift).ibvextract(size - 1, 0));
+    ASSERT_EQ(a.bvashr(shift).str(),
+              a.bvsext(ext - size).ibvashr(shift).ibvextract(size - 1, 0).str());
+
+    std::string sa = a.str(), sb = b.str();
+    ASSERT_EQ(a.bvconcat(b).str(), sa + sb);
+    uint64_t lo = d_rng->pick<uint64_t>(0, size - 1);
+    uint64_t hi = d_rng->pick<uint64_t>(lo, size - 1);
+    ASSERT_EQ(a.bvextract(hi, lo).str(), sa.substr(size - 1 - hi, hi - lo + 1));
+    uint64_t n = d_rng->pick<uint64_t>(0, 2 * size);
+    ASSERT_EQ(a.bvzext(n).str(), std::string(n, '0') + sa);
+    ASSERT_EQ(a.bvsext(n).str(), std::string(n, sa[0]) + sa);
+    ASSERT_EQ(a.str(10), ea.str(10));
+    ASSERT_EQ(a.str(16), ea.str(16));
+    ASSERT_EQ(BitVector(size, sa), a);
+    if (a.lsb())
+    {
+      ASSERT_TRUE(a.bvmodinv().ibvmul(a).is_one());
+    }
+  }
+}
+
+TEST_F(TestBitVector, gmp_bitwise)
+{
+  // Bitwise operations on bit-vectors that wrap a GMP value are computed via
+  // limb kernels, check against their string representation.
+  for (uint32_t i = 0; i < N_TESTS / 10; ++i)
+  {
+    uint64_t size =
+        d_rng->pick<uint64_t>(BitVector::s_max_size_limbs + 1, 4096);
+    BitVector a, b;
+    switch (i % 4)
+    {
+      case 0: a = BitVector::mk_ones(size); break;
+      case 1:
+        a = BitVector::mk_ones(size).ibvshr(d_rng->pick<uint64_t>(0, size));
+        break;
+      default: a = BitVector(size, *d_rng);
+    }
+    b = i % 3 ? BitVector(size, *d_rng)
+              : a.bvxor(BitVector::mk_one(size).ibvshl(
+                  d_rng->pick<uint64_t>(0, size - 1)));
+    if (i % 5 == 0)
+    {
+      b.ibvshr(d_rng->pick<uint64_t>(0, size));
+    }
+
+    std::string sa = a.str(), sb = b.str();
+    std::string sand(size, '0'), sor(size, '0'), sxor(size, '0');
+    std::string snot(size, '0'), snand(size, '0');
+    for (uint64_t j = 0; j < size; ++j)
+    {
+      bool ba = sa[j] == '1', bb = sb[j] == '1';
+      sand[j]  = ba && bb ? '1' : '0';
+      sor[j]   = ba || bb ? '1' : '0';
+      sxor[j]  = ba != bb ? '1' : '0';
+      snot[j]  = ba ? '0' : '1';
+      snand[j] = ba && bb ? '0' : '1';
+    }
+    ASSERT_EQ(a.bvand(b).str(), sand);
+    ASSERT_EQ(a.bvor(b).str(), sor);
+    ASSERT_EQ(a.bvxor(b).str(), sxor);
+    ASSERT_EQ(a.bvnot().str(), snot);
+    ASSERT_EQ(a.bvnand(b).str(), snand);
+    ASSERT_EQ(BitVector(a).ibvand(b).str(), sand);
+    ASSERT_EQ(BitVector(b).ibvor(a).str(), sor);
+    ASSERT_EQ(BitVector(a).ibvnot().str(), snot);
+    ASSERT_EQ(a.compare(b), sa.compare(sb) < 0 ? -1 : (sa == sb ? 0 : 1));
+    ASSERT_EQ(a.is_ones(), sa == std::string(size, '1'));
+    size_t ones = sa.find('0');
+    ASSERT_EQ(a.count_leading_ones(), ones == std::string::npos ? size : ones);
+    size_t zeros = sa.find('1');
+    ASSERT_EQ(a.count_leading_zeros(),
+              zeros == std::string::npos ? size : zeros);
+  }
+}
+
+TEST_F(TestBitVector, modinv_newton)
+{
+  // The modular inverse is computed via Newton iteration, check against the
+  // inverse computed by GMP for all representations.
+  for (uint32_t i = 0; i < N_TESTS; ++i)
+  {
+    uint64_t size = i % 3 == 0   ? d_rng->pick<uint64_t>(1, 64)
+                    : i % 3 == 1 ? d_rng->pick<uint64_t>(65, 256)
+                                 : d_rng->pick<uint64_t>(257, 1024);
+    BitVector a =
+        i % 7 == 0 ? BitVector::mk_ones(size) : BitVector(size, *d_rng);
+    a.set_bit(0, true);
+    mpz_class ea(a.str(), 2), mod, inv;
+    mpz_ui_pow_ui(mod.get_mpz_t(), 2, size);
+    mpz_invert(inv.get_mpz_t(), ea.get_mpz_t(), mod.get_mpz_t());
+    BitVector expected(size, inv.get_str(2));
+    ASSERT_EQ(a.bvmodinv(), expected);
+    ASSERT_EQ(BitVector(a).ibvmodinv(), expected);
+  }
+}
+
+TEST_F(TestBitVector, udivurem_special)
+{
+  // Divisions by powers of two and by divisors that fit into a single limb
+  // take dedicated paths, check against the results computed by GMP.
+  for (uint32_t i = 0; i < N_TESTS; ++i)
+  {
+    uint64_t size = i % 3 == 0   ? d_rng->pick<uint64_t>(1, 64)
+                    : i % 3 == 1 ? d_rng->pick<uint64_t>(65, 256)
+                                 : d_rng->pick<uint64_t>(257, 512);
+    BitVector a(size, *d_rng), b;
+    if (i % 2 == 0)
+    {
+      b = BitVector::mk_one(size).ibvshl(d_rng->pick<uint64_t>(0, size - 1));
+    }
+    else
+    {
+      b = BitVector(size, *d_rng, std::min<uint64_t>(size, 64) - 1, 0);
+      if (b.is_zero())
+      {
+        b = BitVector::mk_one(size);
+      }
+    }
+    mpz_class ea(a.str(), 2), eb(b.str(), 2);
+    BitVector quot(size, mpz_class(ea / eb).get_str(2));
+    BitVector rem(size, mpz_class(ea % eb).get_str(2));
+    ASSERT_EQ(a.bvudiv(b), quot);
+    ASSERT_EQ(a.bvurem(b), rem);
+    ASSERT_EQ(BitVector(a).ibvudiv(b), quot);
+    ASSERT_EQ(BitVector(a).ibvurem(b), rem);
+    BitVector q, r;
+    a.bvudivurem(b, &q, &r);
+    ASSERT_EQ(q, quot);
+    ASSERT_EQ(r, rem);
+    // Divisor aliases the result.
+    BitVector c(b);
+    ASSERT_EQ(c.ibvudiv(a, c), quot);
+    c = b;
+    ASSERT_EQ(c.ibvurem(a, c), rem);
+  }
+}
+
+TEST_F(TestBitVector, rvalue)
+{
+  // Operations on rvalues compute the result in-place, check against the
+  // results of the corresponding operations on lvalues.
+  for (uint32_t i = 0; i < N_TESTS; ++i)
+  {
+    uint64_t size = i % 3 == 0   ? d_rng->pick<uint64_t>(1, 64)
+                    : i % 3 == 1 ? d_rng->pick<uint64_t>(65, 256)
+                                 : d_rng->pick<uint64_t>(257, 512);
+    BitVector a(size, *d_rng), b(size, *d_rng);
+    BitVector odd(a);
+    odd.set_bit(0, true);
+    uint64_t shift = d_rng->pick<uint64_t>(0, size);
+    uint64_t hi    = d_rng->pick<uint64_t>(0, size - 1);
+    uint64_t lo    = d_rng->pick<uint64_t>(0, hi);
+
+    ASSERT_EQ(BitVector(a).bvneg(), a.bvneg());
+    ASSERT_EQ(BitVector(a).bvnot(), a.bvnot());
+    ASSERT_EQ(BitVector(a).bvinc(), a.bvinc());
+    ASSERT_EQ(BitVector(a).bvdec(), a.bvdec());
+    ASSERT_EQ(BitVector(a).bvadd(b), a.bvadd(b));
+    ASSERT_EQ(BitVector(a).bvsub(b), a.bvsub(b));
+    ASSERT_EQ(BitVector(a).bvand(b), a.bvand(b));
+    BitVector a1 = a.bvextract(0, 0), b1 = b.bvextract(0, 0);
+    ASSERT_EQ(BitVector(a1).bvimplies(b1), a1.bvimplies(b1));
+    ASSERT_EQ(BitVector(a).bvnand(b), a.bvnand(b));
+    ASSERT_EQ(BitVector(a).bvnor(b), a.bvnor(b));
+    ASSERT_EQ(BitVector(a).bvor(b), a.bvor(b));
+    ASSERT_EQ(BitVector(a).bvxnor(b), a.bvxnor(b));
+    ASSERT_EQ(BitVector(a).bvxor(b), a.bvxor(b));
+    ASSERT_EQ(BitVector(a).bvshl(shift), a.bvshl(shift));
+    ASSERT_EQ(BitVector(a).bvshl(b), a.bvshl(b));
+    ASSERT_EQ(BitVector(a).bvshr(shift), a.bvshr(shift));
+    ASSERT_EQ(BitVector(a).bvshr(b), a.bvshr(b));
+    ASSERT_EQ(BitVector(a).bvashr(shift), a.bvashr(shift));
+    ASSERT_EQ(BitVector(a).bvashr(b), a.bvashr(b));
+    ASSERT_EQ(BitVector(a).bvmul(b), a.bvmul(b));
+    ASSERT_EQ(BitVector(a).bvudiv(b), a.bvudiv(b));
+    ASSERT_EQ(BitVector(a).bvurem(b), a.bvurem(b));
+    ASSERT_EQ(BitVector(a).bvsdiv(b), a.bvsdiv(b));
+    ASSERT_EQ(BitVector(a).bvsrem(b), a.bvsrem(b));
+    ASSERT_EQ(BitVector(a).bvconcat(b), a.bvconcat(b));
+    ASSERT_EQ(BitVector(a).bvextract(hi, lo), a.bvextract(hi, lo));
+    ASSERT_EQ(BitVector(a).bvzext(shift), a.bvzext(shift));
+    ASSERT_EQ(BitVector(a).bvsext(shift), a.bvsext(shift));
+    ASSERT_EQ(BitVector(odd).bvmodinv(), odd.bvmodinv());
+    ASSERT_EQ(a.bvadd(b).bvmul(b).bvsub(a), a.bvadd(b).ibvmul(b).ibvsub(a));
+
+    // Moved-from bit-vectors are null.
+    BitVector c(a);
+    BitVector d = std::move(c).bvadd(b);
+    ASSERT_TRUE(c.is_null());
+    ASSERT_EQ(d, a.bvadd(b));
+    c = std::move(d);
+    ASSERT_TRUE(d.is_null());
+    ASSERT_EQ(c, a.bvadd(b));
+    c = BitVector::mk_one(size + 300);
+    c = a.bvmul(b);
+    ASSERT_EQ(c, a.bvmul(b));
+  }
+}
+
 /* -------------------------------------------------------------------------- */
 
 }  // namespace bzla::test
@@ -0,0 +1,135 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <gmp.h>
+
+#include <cstdlib>
+#include <thread>
+
+#include "bv/gmp_pool.h"
+#include "test_lib.h"
+
+namespace bzla::test {
+
+class TestGMPPool : public TestCommon
+{
+};
+
+TEST_F(TestGMPPool, scope)
+{
+  void* (*alloc)(size_t);
+  void* (*realloc)(void*, size_t, size_t);
+  void (*free)(void*, size_t);
+  mp_get_memory_functions(&alloc, &realloc, &free);
+  {
+    GMPPool::Scope scope;
+    ASSERT_TRUE(GMPPool::installed());
+    void* (*pool_alloc)(size_t);
+    mp_get_memory_functions(&pool_alloc, nullptr, nullptr);
+    ASSERT_NE(pool_alloc, alloc);
+    {
+      GMPPool::Scope nested;
+      void* (*nested_alloc)(size_t);
+      mp_get_memory_functions(&nested_alloc, nullptr, nullptr);
+      ASSERT_EQ(nested_alloc, pool_alloc);
+    }
+    mp_get_memory_functions(&pool_alloc, nullptr, nullptr);
+    ASSERT_NE(pool_alloc, alloc);
+  }
+  void* (*restored)(size_t);
+  mp_get_memory_functions(&restored, nullptr, nullptr);
+  ASSERT_EQ(restored, alloc);
+  ASSERT_FALSE(GMPPool::installed());
+}
+
+TEST_F(TestGMPPool, custom_allocator)
+{
+  // A custom allocator installed by the host application is not replaced.
+  static uint64_t s_num_allocs = 0;
+  void* (*alloc)(size_t);
+  void* (*realloc)(void*, size_t, size_t);
+  void (*free)(void*, size_t);
+  mp_get_memory_functions(&alloc, &realloc, &free);
+  void* (*custom_alloc)(size_t) = [](size_t size) {
+    ++s_num_allocs;
+    return std::malloc(size);
+  };
+  mp_set_memory_functions(custom_alloc, realloc, free);
+  {
+    GMPPool::Scope scope;
+    ASSERT_FALSE(GMPPool::installed());
+    void* (*scope_alloc)(size_t);
+    mp_get_memory_functions(&scope_alloc, nullptr, nullptr);
+    ASSERT_EQ(scope_alloc, custom_alloc);
+    BitVector a = BitVector::mk_ones(1024).ibvshr(3);
+    ASSERT_GT(s_num_allocs, 0);
+  }
+  void* (*restored)(size_t);
+  mp_get_memory_functions(&restored, nullptr, nullptr);
+  ASSERT_EQ(restored, custom_alloc);
+  mp_set_memory_functions(alloc, realloc, free);
+  GMPPool::Scope scope;
+  ASSERT_TRUE(GMPPool::installed());
+}
+
+TEST_F(TestGMPPool, reuse)
+{
+  // Allocated before the pool is installed, released to the pool.
+  BitVector pre = BitVector::from_ui(1024, 1).ibvshl(1000);
+  GMPPool::Scope scope;
+  const GMPPool::Statistics& stats = GMPPool::statistics();
+  uint64_t num_allocs              = stats.num_allocs;
+  uint64_t num_pool_hits           = stats.num_pool_hits;
+  BitVector a                      = BitVector::mk_ones(1024);
+  for (uint32_t i = 0; i < 100; ++i)
+  {
+    BitVector b = a.bvadd(pre).bvmul(a).bvudiv(pre);
+    ASSERT_EQ(b, a.bvadd(pre).bvmul(a).bvudiv(pre));
+  }
+  ASSERT_GT(stats.num_allocs, num_allocs);
+  ASSERT_GT(stats.num_pool_hits, num_pool_hits);
+  ASSERT_LE(stats.num_bytes_cached, GMPPool::s_max_bytes_cached);
+  ASSERT_EQ(a.str(16), std::string(256, 'f'));
+}
+
+TEST_F(TestGMPPool, uninstall)
+{
+  // Values allocated from the pool outlive the scope.
+  BitVector a;
+  {
+    GMPPool::Scope scope;
+    a = BitVector::mk_ones(2048).ibvshr(7);
+  }
+  BitVector b = a.bvadd(BitVector::mk_one(2048));
+  ASSERT_EQ(b.bvsub(BitVector::mk_one(2048)), a);
+}
+
+TEST_F(TestGMPPool, threads)
+{
+  GMPPool::Scope scope;
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([t]() {
+      BitVector a = BitVector::mk_ones(512 + 64 * t);
+      for (uint32_t i = 0; i < 1000; ++i)
+      {
+        a = a.bvmul(a).bvadd(BitVector::mk_one(a.size()));
+      }
+      ASSERT_GT(GMPPool::statistics().num_pool_hits, 0);
+    });
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+}  // namespace bzla::test
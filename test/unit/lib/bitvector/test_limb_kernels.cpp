@@ -0,0 +1,139 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <vector>
+
+#include "bv/limb_kernels.h"
+#include "test_lib.h"
+
+namespace bzla::test {
+
+class TestLimbKernels : public TestCommon
+{
+ protected:
+  static constexpr size_t N_LIMBS = 67;
+
+  void SetUp() override { d_rng.reset(new RNG(1234)); }
+
+  /** Generate random limbs, with runs of all ones and all zeros limbs. */
+  std::vector<uint64_t> mk_limbs(size_t n)
+  {
+    std::vector<uint64_t> res(n);
+    for (uint64_t& limb : res)
+    {
+      switch (d_rng->pick<uint32_t>(0, 3))
+      {
+        case 0: limb = 0; break;
+        case 1: limb = UINT64_MAX; break;
+        default: limb = d_rng->pick<uint64_t>();
+      }
+    }
+    return res;
+  }
+
+  /** Get the kernels of all instruction sets supported on this machine. */
+  static std::vector<const LimbKernels*> get_kernels()
+  {
+    std::vector<const LimbKernels*> res;
+    for (auto isa : {LimbKernels::Isa::PORTABLE,
+                     LimbKernels::Isa::SSE2,
+                     LimbKernels::Isa::AVX2})
+    {
+      if (const LimbKernels* k = LimbKernels::get(isa))
+      {
+        res.push_back(k);
+      }
+    }
+    return res;
+  }
+
+  std::unique_ptr<RNG> d_rng;
+};
+
+TEST_F(TestLimbKernels, get)
+{
+  ASSERT_NE(LimbKernels::get(LimbKernels::Isa::PORTABLE), nullptr);
+  ASSERT_EQ(LimbKernels::get(LimbKernels::get().isa), &LimbKernels::get());
+}
+
+TEST_F(TestLimbKernels, bitwise)
+{
+  const LimbKernels& p = *LimbKernels::get(LimbKernels::Isa::PORTABLE);
+  for (const LimbKernels* k : get_kernels())
+  {
+    for (size_t n = 0; n <= N_LIMBS; ++n)
+    {
+      // Use unaligned offsets into the arrays.
+      std::vector<uint64_t> a = mk_limbs(n + 1), b = mk_limbs(n + 1);
+      std::vector<uint64_t> expected(n + 1), res(n + 1);
+      p.bvand(expected.data() + 1, a.data() + 1, b.data() + 1, n);
+      k->bvand(res.data() + 1, a.data() + 1, b.data() + 1, n);
+      ASSERT_EQ(res, expected);
+      p.bvor(expected.data() + 1, a.data() + 1, b.data() + 1, n);
+      k->bvor(res.data() + 1, a.data() + 1, b.data() + 1, n);
+      ASSERT_EQ(res, expected);
+      p.bvxor(expected.data() + 1, a.data() + 1, b.data() + 1, n);
+      k->bvxor(res.data() + 1, a.data() + 1, b.data() + 1, n);
+      ASSERT_EQ(res, expected);
+      p.bvnot(expected.data() + 1, a.data() + 1, n);
+      k->bvnot(res.data() + 1, a.data() + 1, n);
+      ASSERT_EQ(res, expected);
+      // In-place.
+      std::vector<uint64_t> c = a;
+      k->bvxor(c.data(), c.data(), b.data(), n + 1);
+      p.bvxor(a.data(), a.data(), b.data(), n + 1);
+      ASSERT_EQ(c, a);
+    }
+  }
+}
+
+TEST_F(TestLimbKernels, cmp)
+{
+  const LimbKernels& p = *LimbKernels::get(LimbKernels::Isa::PORTABLE);
+  for (const LimbKernels* k : get_kernels())
+  {
+    for (size_t n = 0; n <= N_LIMBS; ++n)
+    {
+      std::vector<uint64_t> a = mk_limbs(n);
+      std::vector<uint64_t> b = a;
+      ASSERT_EQ(k->cmp(a.data(), b.data(), n), 0);
+      for (size_t i = 0; i < n; ++i)
+      {
+        b[i] = d_rng->pick<uint64_t>();
+        int32_t expected = p.cmp(a.data(), b.data(), n);
+        ASSERT_EQ(k->cmp(a.data(), b.data(), n), expected);
+        ASSERT_EQ(k->cmp(b.data(), a.data(), n), -expected);
+        b[i] = a[i];
+      }
+    }
+  }
+}
+
+TEST_F(TestLimbKernels, ones)
+{
+  for (const LimbKernels* k : get_kernels())
+  {
+    for (size_t n = 0; n <= N_LIMBS; ++n)
+    {
+      std::vector<uint64_t> a(n, UINT64_MAX);
+      ASSERT_TRUE(k->is_ones(a.data(), n));
+      ASSERT_EQ(k->find_last_not_ones(a.data(), n), 0);
+      for (size_t i = 0; i < n; ++i)
+      {
+        a[i] = UINT64_MAX << d_rng->pick<uint32_t>(1, 63);
+        ASSERT_FALSE(k->is_ones(a.data(), n));
+        ASSERT_EQ(k->find_last_not_ones(a.data(), n), i + 1);
+        a[i] = UINT64_MAX;
+      }
+    }
+  }
+}
+
+}  // namespace bzla::test
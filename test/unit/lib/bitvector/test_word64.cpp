@@ -0,0 +1,252 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <vector>
+
+#include "bv/word64.h"
+#include "test_lib.h"
+
+namespace bzla::test {
+
+class TestWord64 : public TestCommon
+{
+ protected:
+  static constexpr uint64_t N_VALUES = 12;
+
+  void SetUp() override { d_rng.reset(new RNG(1234)); }
+
+  /** Generate values of given size, including corner case values. */
+  std::vector<BitVector> mk_values(uint64_t size)
+  {
+    std::vector<BitVector> res = {BitVector::mk_zero(size),
+                                  BitVector::mk_one(size),
+                                  BitVector::mk_ones(size),
+                                  BitVector::mk_min_signed(size),
+                                  BitVector::mk_max_signed(size)};
+    while (res.size() < N_VALUES)
+    {
+      res.emplace_back(size, *d_rng);
+    }
+    return res;
+  }
+
+  static void expect_eq(const Word64& w, const BitVector& bv)
+  {
+    ASSERT_EQ(w.size(), bv.size());
+    ASSERT_EQ(w.to_uint64(), bv.to_uint64());
+    ASSERT_EQ(w.to_bitvector(), bv);
+  }
+
+  std::unique_ptr<RNG> d_rng;
+};
+
+TEST_F(TestWord64, ctor)
+{
+  ASSERT_TRUE(Word64().is_null());
+  for (uint64_t size = 1; size <= 64; ++size)
+  {
+    expect_eq(Word64(size), BitVector(size));
+    expect_eq(Word64::mk_zero(size), BitVector::mk_zero(size));
+    expect_eq(Word64::mk_one(size), BitVector::mk_one(size));
+    expect_eq(Word64::mk_ones(size), BitVector::mk_ones(size));
+    expect_eq(Word64::mk_min_signed(size), BitVector::mk_min_signed(size));
+    expect_eq(Word64::mk_max_signed(size), BitVector::mk_max_signed(size));
+    for (const BitVector& bv : mk_values(size))
+    {
+      expect_eq(Word64(bv), bv);
+      expect_eq(Word64(size, bv.str()), bv);
+      expect_eq(Word64::from_ui(size, bv.to_uint64()), bv);
+      ASSERT_EQ(Word64(bv).str(), bv.str());
+      ASSERT_EQ(Word64(bv).str(10), bv.str(10));
+      ASSERT_EQ(Word64(bv).str(16), bv.str(16));
+    }
+  }
+  expect_eq(Word64::mk_true(), BitVector::mk_true());
+  expect_eq(Word64::mk_false(), BitVector::mk_false());
+}
+
+TEST_F(TestWord64, random)
+{
+  // Word64 and BitVector draw the same random values from the same RNG state.
+  RNG rng_bv(42), rng_w(42);
+  for (uint64_t size = 1; size <= 64; ++size)
+  {
+    expect_eq(Word64(size, rng_w), BitVector(size, rng_bv));
+
+    BitVector from(size, rng_bv), to(size, rng_bv);
+    Word64 wfrom(size, rng_w), wto(size, rng_w);
+    if (from.compare(to) > 0) std::swap(from, to);
+    if (wfrom.compare(wto) > 0) std::swap(wfrom, wto);
+    expect_eq(Word64(size, rng_w, wfrom, wto),
+              BitVector(size, rng_bv, from, to));
+
+    if (from.signed_compare(to) > 0) std::swap(from, to);
+    if (wfrom.signed_compare(wto) > 0) std::swap(wfrom, wto);
+    expect_eq(Word64(size, rng_w, wfrom, wto, true),
+              BitVector(size, rng_bv, from, to, true));
+
+    uint64_t lo = size / 3, hi = size - size / 4;
+    expect_eq(Word64(size, rng_w, hi, lo), BitVector(size, rng_bv, hi, lo));
+  }
+}
+
+TEST_F(TestWord64, predicates)
+{
+  for (uint64_t size = 1; size <= 64; ++size)
+  {
+    std::vector<BitVector> values = mk_values(size);
+    for (const BitVector& a : values)
+    {
+      Word64 wa(a);
+      ASSERT_EQ(wa.is_true(), a.is_true());
+      ASSERT_EQ(wa.is_false(), a.is_false());
+      ASSERT_EQ(wa.is_zero(), a.is_zero());
+      ASSERT_EQ(wa.is_ones(), a.is_ones());
+      ASSERT_EQ(wa.is_one(), a.is_one());
+      ASSERT_EQ(wa.is_min_signed(), a.is_min_signed());
+      ASSERT_EQ(wa.is_max_signed(), a.is_max_signed());
+      ASSERT_EQ(wa.is_power_of_two(), a.is_power_of_two());
+      ASSERT_EQ(wa.lsb(), a.lsb());
+      ASSERT_EQ(wa.msb(), a.msb());
+      ASSERT_EQ(wa.count_trailing_zeros(), a.count_trailing_zeros());
+      ASSERT_EQ(wa.count_leading_zeros(), a.count_leading_zeros());
+      ASSERT_EQ(wa.count_leading_ones(), a.count_leading_ones());
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        ASSERT_EQ(wa.bit(i), a.bit(i));
+      }
+      for (const BitVector& b : values)
+      {
+        Word64 wb(b);
+        ASSERT_EQ(wa.compare(wb), a.compare(b));
+        ASSERT_EQ(wa.signed_compare(wb), a.signed_compare(b));
+        ASSERT_EQ(wa.is_uadd_overflow(wb), a.is_uadd_overflow(b));
+        ASSERT_EQ(wa.is_umul_overflow(wb), a.is_umul_overflow(b));
+      }
+    }
+  }
+}
+
+TEST_F(TestWord64, unary)
+{
+  for (uint64_t size = 1; size <= 64; ++size)
+  {
+    for (const BitVector& a : mk_values(size))
+    {
+      Word64 wa(a);
+      expect_eq(wa.bvneg(), a.bvneg());
+      expect_eq(wa.bvnot(), a.bvnot());
+      expect_eq(wa.bvinc(), a.bvinc());
+      expect_eq(wa.bvdec(), a.bvdec());
+      expect_eq(wa.bvredand(), a.bvredand());
+      expect_eq(wa.bvredor(), a.bvredor());
+      if (a.lsb())
+      {
+        expect_eq(wa.bvmodinv(), a.bvmodinv());
+      }
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        BitVector b = a;
+        Word64 wb   = wa;
+        b.flip_bit(i);
+        wb.flip_bit(i);
+        expect_eq(wb, b);
+        b.set_bit(i, true);
+        wb.set_bit(i, true);
+        expect_eq(wb, b);
+      }
+      for (uint64_t hi = 0; hi < size; ++hi)
+      {
+        for (uint64_t lo = 0; lo <= hi; lo += 1 + hi / 4)
+        {
+          expect_eq(wa.bvextract(hi, lo), a.bvextract(hi, lo));
+        }
+      }
+      for (uint64_t n = 0; size + n <= 64; n += 1 + n)
+      {
+        expect_eq(wa.bvzext(n), a.bvzext(n));
+        expect_eq(wa.bvsext(n), a.bvsext(n));
+      }
+      for (uint64_t n = 0; n <= 66; ++n)
+      {
+        expect_eq(wa.bvshl(n), a.bvshl(n));
+        expect_eq(wa.bvshr(n), a.bvshr(n));
+        expect_eq(wa.bvashr(n), a.bvashr(n));
+      }
+    }
+  }
+}
+
+TEST_F(TestWord64, binary)
+{
+  for (uint64_t size = 1; size <= 64; ++size)
+  {
+    std::vector<BitVector> values = mk_values(size);
+    for (uint64_t i = 0; i < size && i < 8; ++i)
+    {
+      values.push_back(BitVector::from_ui(size, i));
+    }
+    for (const BitVector& a : values)
+    {
+      Word64 wa(a);
+      for (const BitVector& b : values)
+      {
+        Word64 wb(b);
+        expect_eq(wa.bvadd(wb), a.bvadd(b));
+        expect_eq(wa.bvsub(wb), a.bvsub(b));
+        expect_eq(wa.bvand(wb), a.bvand(b));
+        expect_eq(wa.bvnand(wb), a.bvnand(b));
+        expect_eq(wa.bvnor(wb), a.bvnor(b));
+        expect_eq(wa.bvor(wb), a.bvor(b));
+        expect_eq(wa.bvxnor(wb), a.bvxnor(b));
+        expect_eq(wa.bvxor(wb), a.bvxor(b));
+        expect_eq(wa.bveq(wb), a.bveq(b));
+        expect_eq(wa.bvne(wb), a.bvne(b));
+        expect_eq(wa.bvult(wb), a.bvult(b));
+        expect_eq(wa.bvule(wb), a.bvule(b));
+        expect_eq(wa.bvugt(wb), a.bvugt(b));
+        expect_eq(wa.bvuge(wb), a.bvuge(b));
+        expect_eq(wa.bvslt(wb), a.bvslt(b));
+        expect_eq(wa.bvsle(wb), a.bvsle(b));
+        expect_eq(wa.bvsgt(wb), a.bvsgt(b));
+        expect_eq(wa.bvsge(wb), a.bvsge(b));
+        expect_eq(wa.bvshl(wb), a.bvshl(b));
+        expect_eq(wa.bvshr(wb), a.bvshr(b));
+        expect_eq(wa.bvashr(wb), a.bvashr(b));
+        expect_eq(wa.bvmul(wb), a.bvmul(b));
+        expect_eq(wa.bvudiv(wb), a.bvudiv(b));
+        expect_eq(wa.bvurem(wb), a.bvurem(b));
+        expect_eq(wa.bvsdiv(wb), a.bvsdiv(b));
+        expect_eq(wa.bvsrem(wb), a.bvsrem(b));
+        if (size == 1)
+        {
+          expect_eq(wa.bvimplies(wb), a.bvimplies(b));
+        }
+        if (2 * size <= 64)
+        {
+          expect_eq(wa.bvconcat(wb), a.bvconcat(b));
+        }
+        // in-place versions with aliasing operands
+        Word64 wc = wa;
+        expect_eq(wc.ibvsub(wc, wb), a.bvsub(b));
+        wc = wb;
+        expect_eq(wc.ibvsdiv(wa, wc), a.bvsdiv(b));
+      }
+      expect_eq(Word64::bvite(Word64::mk_true(), wa, Word64::mk_zero(size)),
+                BitVector::bvite(
+                    BitVector::mk_true(), a, BitVector::mk_zero(size)));
+      expect_eq(Word64::bvite(Word64::mk_false(), wa, Word64::mk_zero(size)),
+                BitVector::bvite(
+                    BitVector::mk_false(), a, BitVector::mk_zero(size)));
+    }
+  }
+}
+
+}  // namespace bzla::test
@@ -382,6 +382,29 @@ TEST_F(TestBvDomainGen, random)
                "has_random");
 }
 
+TEST_F(TestBvDomainGen, random_sizes)
+{
+  for (uint64_t size : {1, 7, 32, 63, 64, 65, 128, 300})
+  {
+    for (uint32_t i = 0; i < 20; ++i)
+    {
+      BitVector v(size, *d_rng), mask(size, *d_rng);
+      BitVectorDomain d(v.bvand(mask), v.bvor(mask.bvnot()));
+      BitVector min(size, *d_rng, d.lo(), d.hi());
+      BitVector max(size, *d_rng, min, d.hi());
+      BitVectorDomainGenerator gen(d, d_rng.get(), min, max);
+      if (!gen.has_random()) continue;
+      for (uint32_t j = 0; j < 10; ++j)
+      {
+        BitVector res = gen.random();
+        ASSERT_TRUE(d.match_fixed_bits(res));
+        ASSERT_GE(res.compare(min), 0);
+        ASSERT_LE(res.compare(max), 0);
+      }
+    }
+  }
+}
+
 TEST_F(TestBvDomainGen, ctor_dtor_signed)
 {
   for (uint64_t size = 1; size <= 16; ++size)
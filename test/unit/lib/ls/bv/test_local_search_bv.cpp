@@ -10,6 +10,7 @@
 
 #include <map>
 
+#include "bv/word64.h"
 #include "ls/ls_bv.h"
 #include "test_bvnode.h"
 
@@ -44,7 +45,7 @@ class TestLsBv : public TestBvNodeCommon
   {
     TestBvNodeCommon::SetUp();
 
-    d_ls.reset(new LocalSearchBV(100, 100));
+    d_ls.reset(new BvLocalSearch<BitVector>(100, 100));
 
     d_two4  = BitVector(4, "0010");
     d_for4  = BitVector(4, "0100");
@@ -106,28 +107,41 @@ class TestLsBv : public TestBvNodeCommon
    * Create a mapping from nodes to their parents to compare against the
    * mapping created internally on node creation.
    */
-  LocalSearchBV::ParentsMap get_expected_parents();
+  BvLocalSearch<BitVector>::ParentsMap get_expected_parents();
   /**
-   * Get a reference of the parents map of the LocalSearchBV object.
-   * Note: LocalSearchBV::d_parents is private and only the main test class has
+   * Get a reference of the parents map of the BvLocalSearch object.
+   * Note: BvLocalSearch::d_parents is private and only the main test class has
    *       access to it.
    */
-  const LocalSearchBV::ParentsMap& get_parents() { return d_ls->d_parents; }
+  const BvLocalSearch<BitVector>::ParentsMap& get_parents()
+  {
+    return d_ls->d_parents;
+  }
 
   /**
-   * Wrapper for LocalSearchBV::update_cone().
-   * Note: LocalSearchBV::update_cone() is private and only the main test class
+   * Wrapper for BvLocalSearch::update_cone().
+   * Note: BvLocalSearch::update_cone() is private and only the main test class
    * has access to it.
    */
   void update_cone(uint64_t id, const BitVector& assignment);
 
+  /**
+   * Create roots over terms of the size of the given model that are satisfied
+   * by the model.
+   * @param ls    The local search engine.
+   * @param model The model, the values of three variables.
+   */
+  template <class VALUE>
+  static void mk_roots(BvLocalSearch<VALUE>& ls,
+                       const std::vector<BitVector>& model);
+
   void test_move_binary(NodeKind kind, uint32_t pos_x);
   void test_move_ite(uint32_t pos_x);
   void test_move_not();
   void test_move_extract();
   void test_move_sext();
 
-  std::unique_ptr<LocalSearchBV> d_ls;
+  std::unique_ptr<BvLocalSearch<BitVector>> d_ls;
 
   BitVector d_two4, d_for4, d_fiv4, d_six4, d_sev4;
   BitVector d_egt4, d_ten4, d_ele4, d_twe4, d_thi4;
@@ -143,10 +157,10 @@ class TestLsBv : public TestBvNodeCommon
   uint64_t d_root1, d_root2;
 };
 
-LocalSearchBV::ParentsMap
+BvLocalSearch<BitVector>::ParentsMap
 TestLsBv::get_expected_parents()
 {
-  LocalSearchBV::ParentsMap parents;
+  BvLocalSearch<BitVector>::ParentsMap parents;
   std::vector<uint64_t> to_visit = {d_root1, d_root2};
   while (!to_visit.empty())
   {
@@ -179,6 +193,45 @@ TestLsBv::update_cone(uint64_t id, const BitVector& assignment)
   d_ls->update_cone(d_ls->get_node(id), assignment);
 }
 
+template <class VALUE>
+void
+TestLsBv::mk_roots(BvLocalSearch<VALUE>& ls,
+                   const std::vector<BitVector>& model)
+{
+  uint64_t size     = model[0].size();
+  uint64_t hi       = size - 1;
+  uint64_t mid      = size / 2;
+  const BitVector& x = model[0];
+  const BitVector& y = model[1];
+  const BitVector& z = model[2];
+
+  uint64_t vx     = ls.mk_node(NodeKind::CONST, size);
+  uint64_t vy     = ls.mk_node(NodeKind::CONST, size);
+  uint64_t vz     = ls.mk_node(NodeKind::CONST, size);
+  uint64_t add    = ls.mk_node(NodeKind::BV_ADD, size, {vx, vy});
+  uint64_t mul    = ls.mk_node(NodeKind::BV_MUL, size, {add, vz});
+  uint64_t urem   = ls.mk_node(NodeKind::BV_UREM, size, {vx, vz});
+  uint64_t ex_hi  =
+      ls.mk_node(NodeKind::BV_EXTRACT, size - mid, {mul}, {hi, mid});
+  uint64_t ex_lo  = ls.mk_node(NodeKind::BV_EXTRACT, mid, {vy}, {mid - 1, 0});
+  uint64_t concat = ls.mk_node(NodeKind::BV_CONCAT, size, {ex_hi, ex_lo});
+  uint64_t slt    = ls.mk_node(NodeKind::BV_SLT, 1, {vx, vy});
+
+  auto mk_const = [&ls](const BitVector& val) {
+    return ls.mk_node(VALUE(val), BvDomain<VALUE>(VALUE(val)));
+  };
+  BitVector val_mul = x.bvadd(y).ibvmul(z);
+  uint64_t c_mul    = mk_const(val_mul);
+  uint64_t c_urem   = mk_const(x.bvurem(z));
+  uint64_t c_concat = mk_const(
+      val_mul.bvextract(hi, mid).ibvconcat(y.bvextract(mid - 1, 0)));
+
+  ls.register_root(ls.mk_node(NodeKind::EQ, 1, {mul, c_mul}));
+  ls.register_root(ls.mk_node(NodeKind::EQ, 1, {urem, c_urem}));
+  ls.register_root(ls.mk_node(NodeKind::EQ, 1, {concat, c_concat}));
+  ls.register_root(x.signed_compare(y) < 0 ? slt : ls.invert_node(slt));
+}
+
 void
 TestLsBv::test_move_binary(NodeKind kind, uint32_t pos_x)
 {
@@ -217,7 +270,7 @@ TestLsBv::test_move_binary(NodeKind kind, uint32_t pos_x)
           {
             BitVector rx_val = genrx.has_random() ? genrx.random() : x.lo();
 
-            LocalSearchBV ls(1, 1);
+            BvLocalSearch<BitVector> ls(1, 1);
             uint64_t op_s = ls.mk_node(s_val, s);
             uint64_t op_x = ls.mk_node(rx_val, x);
             uint64_t op =
@@ -250,7 +303,7 @@ TestLsBv::test_move_binary(NodeKind kind, uint32_t pos_x)
             BitVector rx_val = genrx.has_random() ? genrx.random() : x.lo();
             BitVector rs_val = genrs.has_random() ? genrs.random() : s.lo();
 
-            LocalSearchBV ls(100, 100);
+            BvLocalSearch<BitVector> ls(100, 100);
             uint64_t op_s = ls.mk_node(rs_val, s);
             uint64_t op_x = ls.mk_node(rx_val, x);
             uint64_t op =
@@ -359,7 +412,7 @@ TestLsBv::test_move_ite(uint32_t pos_x)
               {
                 BitVector rx_val = genrx.has_random() ? genrx.random() : x.lo();
 
-                LocalSearchBV ls(100, 100);
+                BvLocalSearch<BitVector> ls(100, 100);
                 uint64_t op_s0 = ls.mk_node(s0_val, s0);
                 uint64_t op_s1 = ls.mk_node(s1_val, s1);
                 uint64_t op_x  = ls.mk_node(rx_val, x);
@@ -396,7 +449,7 @@ TestLsBv::test_move_ite(uint32_t pos_x)
                 BitVector rs1_val =
                     genrs1.has_random() ? genrs1.random() : s1.lo();
 
-                LocalSearchBV ls(100, 100);
+                BvLocalSearch<BitVector> ls(100, 100);
                 uint64_t op_s0 = ls.mk_node(rs0_val, s0);
                 uint64_t op_s1 = ls.mk_node(rs1_val, s1);
                 uint64_t op_x  = ls.mk_node(rx_val, x);
@@ -464,7 +517,7 @@ TestLsBv::test_move_not()
       BitVectorDomainGenerator genrx(x, d_rng.get());
       BitVector rx_val = genrx.has_random() ? genrx.random() : x.lo();
 
-      LocalSearchBV ls(100, 100);
+      BvLocalSearch<BitVector> ls(100, 100);
       uint64_t op_x = ls.mk_node(rx_val, x);
       uint64_t op   = ls.mk_node(NodeKind::NOT, BitVectorDomain(bw_t), {op_x});
       uint64_t t    = ls.mk_node(t_val, BitVectorDomain(t_val));
@@ -513,7 +566,7 @@ TestLsBv::test_move_extract()
             BitVectorDomainGenerator genrx(x, d_rng.get());
             BitVector rx_val = genrx.has_random() ? genrx.random() : x.lo();
 
-            LocalSearchBV ls(100, 100);
+            BvLocalSearch<BitVector> ls(100, 100);
             uint64_t op_x = ls.mk_node(rx_val, x);
             uint64_t op   = ls.mk_node(
                 NodeKind::BV_EXTRACT, BitVectorDomain(bw_t), {op_x}, {hi, lo});
@@ -565,7 +618,7 @@ TestLsBv::test_move_sext()
         BitVectorDomainGenerator genrx(x, d_rng.get());
         BitVector rx_val = genrx.has_random() ? genrx.random() : x.lo();
 
-        LocalSearchBV ls(100, 100);
+        BvLocalSearch<BitVector> ls(100, 100);
         uint64_t op_x = ls.mk_node(rx_val, x);
         uint64_t op =
             ls.mk_node(NodeKind::BV_SEXT, BitVectorDomain(bw_t), {op_x}, {n});
@@ -588,8 +641,9 @@ TEST_F(TestLsBv, parents)
   d_ls->register_root(d_root1);
   d_ls->register_root(d_root2);
 
-  const LocalSearchBV::ParentsMap& parents   = get_parents();
-  LocalSearchBV::ParentsMap parents_expected = get_expected_parents();
+  const BvLocalSearch<BitVector>::ParentsMap& parents = get_parents();
+  BvLocalSearch<BitVector>::ParentsMap parents_expected =
+      get_expected_parents();
 
   {
     const std::unordered_set<uint64_t>& p  = parents.at(d_c1);
@@ -915,4 +969,110 @@ TEST_F(TestLsBv, extract) { test_move_extract(); }
 
 TEST_F(TestLsBv, sext) { test_move_sext(); }
 
+TEST_F(TestLsBv, word64)
+{
+  // The engine over Word64 values performs the same moves as the engine over
+  // BitVector values.
+  for (uint64_t size : {2, 8, 31, 64})
+  {
+    std::vector<BitVector> model;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+      model.emplace_back(size, *d_rng);
+    }
+    BvLocalSearch<BitVector> ls(0, 0, 42);
+    BvLocalSearch<Word64> ls64(0, 0, 42);
+    mk_roots(ls, model);
+    mk_roots(ls64, model);
+    ASSERT_EQ(ls.d_nodes.size(), ls64.d_nodes.size());
+    Result res;
+    do
+    {
+      res = ls.move();
+      ASSERT_EQ(res, ls64.move());
+      for (uint64_t id = 0; id < ls.d_nodes.size(); ++id)
+      {
+        ASSERT_EQ(ls.get_assignment(id),
+                  ls64.get_assignment(id).to_bitvector());
+      }
+    } while (res == Result::UNKNOWN && ls.d_statistics.d_nmoves < 1000);
+    ASSERT_EQ(ls.d_statistics.d_nmoves, ls64.d_statistics.d_nmoves);
+    ASSERT_EQ(ls.d_statistics.d_nprops, ls64.d_statistics.d_nprops);
+    ASSERT_EQ(ls.d_statistics.d_nupdates, ls64.d_statistics.d_nupdates);
+  }
+}
+
+TEST_F(TestLsBv, word64_switch)
+{
+  LocalSearchBV ls(0, 0);
+  ls.init();
+  std::vector<BitVector> model;
+  for (uint32_t i = 0; i < 3; ++i)
+  {
+    model.emplace_back(32, *d_rng);
+  }
+  uint64_t x = ls.mk_node(NodeKind::CONST, 32);
+  uint64_t y = ls.mk_node(NodeKind::CONST, 32);
+  uint64_t c = ls.mk_node(model[0], BitVectorDomain(model[0]));
+  ls.register_root(ls.mk_node(NodeKind::EQ, 1, {x, c}));
+  ls.push();
+  ls.register_root(ls.mk_node(NodeKind::BV_ULT, 1, {x, y}));
+  // overlapping extracts on y, normalized before switching
+  uint64_t e0 = ls.mk_node(NodeKind::BV_EXTRACT, 16, {y}, {20, 5});
+  uint64_t e1 = ls.mk_node(NodeKind::BV_EXTRACT, 16, {y}, {15, 0});
+  ls.register_root(ls.mk_node(
+      NodeKind::NOT, 1, {ls.mk_node(NodeKind::BV_ULT, 1, {e0, e1})}));
+  ls.normalize();
+  ASSERT_NE(ls.d_ls64, nullptr);
+  ASSERT_EQ(ls.d_ls, nullptr);
+  ls.move();
+  uint64_t nmoves = ls.statistics().d_nmoves;
+  ASSERT_EQ(ls.get_num_roots(), 3);
+
+  // Creating a term of size > 64 switches to the BitVector engine, node ids,
+  // assignments, normalized extracts and roots are preserved.
+  uint64_t n = ls.mk_node(NodeKind::BV_CONCAT, 64, {x, y});
+  ASSERT_NE(ls.d_ls64, nullptr);
+  std::vector<BitVector> assignments;
+  for (uint64_t id = 0; id <= n; ++id)
+  {
+    assignments.push_back(ls.get_assignment(id));
+  }
+  auto parents = ls.d_ls64->d_parents;
+  uint64_t z   = ls.mk_node(NodeKind::BV_CONCAT, 96, {n, x});
+  ASSERT_EQ(ls.d_ls64, nullptr);
+  ASSERT_NE(ls.d_ls, nullptr);
+  ASSERT_EQ(z, n + 1);
+  ASSERT_EQ(ls.get_num_roots(), 3);
+  ASSERT_EQ(ls.get_domain(z).size(), 96);
+  ASSERT_EQ(ls.statistics().d_nmoves, nmoves);
+  for (uint64_t id = 0; id <= n; ++id)
+  {
+    ASSERT_EQ(ls.get_assignment(id), assignments[id]);
+    auto p = ls.d_ls->d_parents.at(id);
+    p.erase(z);
+    ASSERT_EQ(p, parents.at(id));
+  }
+  for (uint64_t id : {e0, e1})
+  {
+    auto ex = static_cast<BvExtract<BitVector>*>(ls.d_ls->get_node(id));
+    ASSERT_TRUE(ex->is_normalized());
+    ASSERT_EQ(ex->child0_original()->id(), y);
+    ASSERT_GT(ex->child(0)->id(), e1);
+    ASSERT_EQ(ls.d_ls->d_parents.at(ex->child(0)->id()),
+              std::unordered_set<uint64_t>{id});
+  }
+
+  Result res;
+  do
+  {
+    res = ls.move();
+  } while (res == Result::UNKNOWN && ls.statistics().d_nmoves < 1000);
+  ASSERT_EQ(res, Result::SAT);
+  ASSERT_EQ(ls.get_assignment(x), model[0]);
+  ASSERT_LT(ls.get_assignment(x).compare(ls.get_assignment(y)), 0);
+  ls.pop();
+  ASSERT_EQ(ls.get_num_roots(), 1);
+}
+
 }  // namespace bzla::ls::test
@@ -21,7 +21,7 @@ class TestLsBvNormalize : public ::testing::Test
  protected:
   void SetUp() override
   {
-    d_ls.reset(new LocalSearchBV(100, 100));
+    d_ls.reset(new BvLocalSearch<BitVector>(100, 100));
     d_id   = d_ls->mk_node(NodeKind::CONST, 8);
     d_node = d_ls->get_node(d_id);
   }
@@ -93,7 +93,7 @@ class TestLsBvNormalize : public ::testing::Test
     }
   }
 
-  std::unique_ptr<LocalSearchBV> d_ls;
+  std::unique_ptr<BvLocalSearch<BitVector>> d_ls;
   BitVectorNode* d_node;
   uint64_t d_id;
 };
@@ -0,0 +1,162 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "node/node_id_map.h"
+#include "node/node_id_set.h"
+#include "node/node_manager.h"
+#include "test/unit/test.h"
+
+namespace bzla::test {
+
+using namespace bzla::node;
+
+class TestNodeIdMap : public TestCommon
+{
+ protected:
+  void SetUp() override
+  {
+    NodeManager& nm = NodeManager::get();
+    Type bv_type    = nm.mk_bv_type(8);
+    // Create enough nodes to span several pages.
+    for (size_t i = 0; i < 5000; ++i)
+    {
+      d_nodes.push_back(nm.mk_const(bv_type));
+    }
+  }
+
+  std::vector<Node> d_nodes;
+};
+
+TEST_F(TestNodeIdMap, emplace_find)
+{
+  NodeIdMap<size_t> map;
+  ASSERT_TRUE(map.empty());
+  ASSERT_EQ(map.begin(), map.end());
+  for (size_t i = 0; i < d_nodes.size(); i += 2)
+  {
+    auto [it, inserted] = map.emplace(d_nodes[i], i);
+    ASSERT_TRUE(inserted);
+    ASSERT_EQ(it->first, d_nodes[i]);
+    ASSERT_EQ(it->second, i);
+  }
+  ASSERT_EQ(map.size(), d_nodes.size() / 2);
+  for (size_t i = 0; i < d_nodes.size(); ++i)
+  {
+    auto it = map.find(d_nodes[i]);
+    if (i % 2 == 0)
+    {
+      ASSERT_NE(it, map.end());
+      ASSERT_EQ(it->second, i);
+      ASSERT_EQ(map.at(d_nodes[i]), i);
+      ASSERT_EQ(map.count(d_nodes[i]), 1);
+      auto [iti, inserted] = map.emplace(d_nodes[i], 0);
+      ASSERT_FALSE(inserted);
+      ASSERT_EQ(iti, it);
+      ASSERT_EQ(iti->second, i);
+    }
+    else
+    {
+      ASSERT_EQ(it, map.end());
+      ASSERT_EQ(map.count(d_nodes[i]), 0);
+    }
+  }
+  map[d_nodes[1]] = 42;
+  ASSERT_EQ(map.at(d_nodes[1]), 42);
+  ASSERT_EQ(map.size(), d_nodes.size() / 2 + 1);
+}
+
+TEST_F(TestNodeIdMap, iterator_stability)
+{
+  NodeIdMap<Node> map;
+  auto [it, inserted] = map.emplace(d_nodes[0], d_nodes[0]);
+  const Node* value   = &it->second;
+  for (size_t i = 1; i < d_nodes.size(); ++i)
+  {
+    map.emplace(d_nodes[i], d_nodes[i]);
+  }
+  ASSERT_EQ(&it->second, value);
+  ASSERT_EQ(it, map.find(d_nodes[0]));
+  ASSERT_EQ(*value, d_nodes[0]);
+}
+
+TEST_F(TestNodeIdMap, iterate_erase)
+{
+  NodeIdMap<bool> map;
+  for (size_t i = 0; i < d_nodes.size(); ++i)
+  {
+    map[d_nodes[i]] = true;
+  }
+  for (size_t i = 0; i < d_nodes.size(); i += 3)
+  {
+    ASSERT_EQ(map.erase(d_nodes[i]), 1);
+    ASSERT_EQ(map.erase(d_nodes[i]), 0);
+  }
+  size_t num       = 0;
+  uint64_t prev_id = 0;
+  for (const auto& [node, value] : map)
+  {
+    ASSERT_TRUE(value);
+    ASSERT_GT(node.id(), prev_id);
+    prev_id = node.id();
+    ++num;
+  }
+  ASSERT_EQ(num, map.size());
+  ASSERT_EQ(num, d_nodes.size() - (d_nodes.size() + 2) / 3);
+  map.clear();
+  ASSERT_TRUE(map.empty());
+  ASSERT_EQ(map.begin(), map.end());
+  ASSERT_EQ(map.find(d_nodes[1]), map.end());
+}
+
+TEST_F(TestNodeIdMap, set)
+{
+  NodeIdSet set;
+  for (size_t i = 0; i < d_nodes.size(); i += 2)
+  {
+    ASSERT_TRUE(set.insert(d_nodes[i]).second);
+    ASSERT_FALSE(set.insert(d_nodes[i]).second);
+  }
+  ASSERT_EQ(set.size(), d_nodes.size() / 2);
+  for (size_t i = 0; i < d_nodes.size(); ++i)
+  {
+    ASSERT_EQ(set.count(d_nodes[i]), i % 2 == 0 ? 1 : 0);
+    ASSERT_EQ(set.find(d_nodes[i]) != set.end(), i % 2 == 0);
+  }
+  size_t num = 0;
+  for (const Node& node : set)
+  {
+    ASSERT_EQ(set.count(node), 1);
+    ++num;
+  }
+  ASSERT_EQ(num, set.size());
+  ASSERT_EQ(set.erase(d_nodes[0]), 1);
+  ASSERT_EQ(set.erase(d_nodes[1]), 0);
+  ASSERT_EQ(set.size(), d_nodes.size() / 2 - 1);
+  set.clear();
+  ASSERT_TRUE(set.empty());
+  ASSERT_EQ(set.begin(), set.end());
+}
+
+TEST_F(TestNodeIdMap, keeps_keys_alive)
+{
+  NodeManager& nm = NodeManager::get();
+  NodeIdMap<Node> map;
+  uint64_t id;
+  {
+    Node n = nm.mk_node(Kind::BV_ADD, {d_nodes[0], d_nodes[1]});
+    id     = n.id();
+    map.emplace(n, d_nodes[0]);
+  }
+  Node n = nm.mk_node(Kind::BV_ADD, {d_nodes[0], d_nodes[1]});
+  ASSERT_EQ(n.id(), id);
+  ASSERT_EQ(map.at(n), d_nodes[0]);
+}
+
+}  // namespace bzla::test
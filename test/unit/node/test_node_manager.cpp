@@ -195,6 +195,136 @@ TEST_F(TestNodeManager, mk_node)
   ASSERT_EQ(or_z, nm.mk_node(Kind::OR, {nm.mk_node(Kind::AND, {x, y}), z}));
 };
 
+TEST_F(TestNodeManager, mk_node_existing)
+{
+  NodeManager& nm = NodeManager::get();
+
+  Type bv_type = nm.mk_bv_type(8);
+
+  Node x = nm.mk_const(bv_type);
+  Node y = nm.mk_const(bv_type);
+
+  Node add      = nm.mk_node(Kind::BV_ADD, {x, y});
+  Node extract  = nm.mk_node(Kind::BV_EXTRACT, {add}, {3, 0});
+  uint64_t live = nm.statistics().num_nodes_live;
+
+  std::vector<Node> children{x, y};
+  std::array<Node, 2> children_array{x, y};
+  std::array<uint64_t, 2> indices{3, 0};
+  ASSERT_EQ(add, nm.mk_node(Kind::BV_ADD, children));
+  ASSERT_EQ(add, nm.mk_node(Kind::BV_ADD, children_array));
+  ASSERT_EQ(extract, nm.mk_node(Kind::BV_EXTRACT, {add}, indices));
+  ASSERT_NE(extract, nm.mk_node(Kind::BV_EXTRACT, {add}, {4, 0}));
+  ASSERT_NE(add, nm.mk_node(Kind::BV_ADD, {y, x}));
+  ASSERT_EQ(nm.statistics().num_nodes_live, live);
+
+  Node distinct = nm.mk_node(Kind::DISTINCT, {x, y, x, y, x});
+  ASSERT_EQ(distinct.num_children(), 5);
+  ASSERT_EQ(distinct, nm.mk_node(Kind::DISTINCT, {x, y, x, y, x}));
+  ASSERT_NE(distinct, nm.mk_node(Kind::DISTINCT, {x, y, x, y, y}));
+}
+
+TEST_F(TestNodeManager, node_id_reuse)
+{
+  NodeManager& nm = NodeManager::get();
+
+  Type bool_type = nm.mk_bool_type();
+
+  Node x       = nm.mk_const(bool_type);
+  Node y       = nm.mk_const(bool_type);
+  Node z       = nm.mk_const(bool_type);
+  Node x_and_y = nm.mk_node(Kind::AND, {x, y});
+
+  uint64_t live = nm.statistics().num_nodes_live;
+  ASSERT_GE(nm.statistics().num_nodes_peak, live);
+
+  // Released id is reused for nodes with smaller children ids.
+  uint64_t z_id = z.id();
+  z             = Node();
+  ASSERT_EQ(nm.statistics().num_nodes_live, live - 1);
+  Node w = nm.mk_const(bool_type);
+  ASSERT_EQ(w.id(), z_id);
+  ASSERT_EQ(nm.statistics().num_nodes_live, live);
+
+  // Released id is not reused if it is smaller than the ids of the children.
+  uint64_t w_id = w.id();
+  w             = Node();
+  Node x_or_xy  = nm.mk_node(Kind::OR, {x, x_and_y});
+  ASSERT_GT(x_or_xy.id(), x_and_y.id());
+  ASSERT_NE(x_or_xy.id(), w_id);
+  Node v = nm.mk_node(Kind::NOT, {y});
+  ASSERT_EQ(v.id(), w_id);
+  ASSERT_GT(v.id(), y.id());
+
+  // Releasing the maximum id allows to reuse it.
+  uint64_t max_id = x_or_xy.id();
+  x_or_xy         = Node();
+  Node u          = nm.mk_const(bool_type);
+  ASSERT_EQ(u.id(), max_id);
+  ASSERT_GE(nm.statistics().num_nodes_peak, nm.statistics().num_nodes_live);
+}
+
+TEST_F(TestNodeManager, memory_per_kind)
+{
+  NodeManager& nm = NodeManager::get();
+
+  Type bv_type        = nm.mk_bv_type(8);
+  const auto& bytes   = nm.statistics().num_bytes_per_kind;
+  size_t add          = static_cast<size_t>(Kind::BV_ADD);
+  uint64_t bytes_add  = bytes[add];
+  size_t memory_usage = nm.memory_usage();
+
+  Node x = nm.mk_const(bv_type);
+  Node y = nm.mk_const(bv_type);
+  Node a = nm.mk_node(Kind::BV_ADD, {x, y});
+  ASSERT_GT(bytes[add], bytes_add);
+  ASSERT_GT(bytes[static_cast<size_t>(Kind::CONSTANT)], 0);
+  ASSERT_GE(nm.memory_usage(), memory_usage);
+
+  // Existing nodes do not require additional memory.
+  uint64_t bytes_add_xy = bytes[add];
+  Node b                = nm.mk_node(Kind::BV_ADD, {x, y});
+  ASSERT_EQ(bytes[add], bytes_add_xy);
+
+  a = Node();
+  b = Node();
+  ASSERT_EQ(bytes[add], bytes_add);
+}
+
+TEST_F(TestNodeManager, symbols)
+{
+  NodeManager& nm = NodeManager::get();
+
+  Type bv_type                  = nm.mk_bv_type(8);
+  util::StringInterner& symbols = nm.symbols();
+  size_t size                   = symbols.size();
+
+  Node x  = nm.mk_const(bv_type, "x");
+  Node x2 = nm.mk_const(bv_type, "x");
+  Node y  = nm.mk_var(bv_type, "y");
+  Node z  = nm.mk_const(bv_type);
+  ASSERT_NE(x, x2);
+  ASSERT_EQ(symbols.size(), size + 2);
+  ASSERT_EQ(x.symbol()->get(), "x");
+  ASSERT_EQ(x2.symbol()->get(), "x");
+  ASSERT_EQ(&x.symbol()->get(), &x2.symbol()->get());
+  ASSERT_EQ(y.symbol()->get(), "y");
+  ASSERT_FALSE(z.symbol());
+
+  // Symbols are released with the last node referring to them.
+  x = Node();
+  ASSERT_EQ(symbols.size(), size + 2);
+  x2 = Node();
+  ASSERT_EQ(symbols.size(), size + 1);
+  Node w = nm.mk_const(bv_type, "w");
+  ASSERT_EQ(symbols.size(), size + 2);
+  ASSERT_EQ(w.symbol()->get(), "w");
+  ASSERT_EQ(y.symbol()->get(), "y");
+  y = Node();
+  w = Node();
+  ASSERT_EQ(symbols.size(), size);
+}
+
 TEST_F(TestNodeManager, mk_apply)
 {
   NodeManager& nm = NodeManager::get();
@@ -0,0 +1,111 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "node/node_manager.h"
+#include "node/node_unique_table.h"
+#include "test/unit/test.h"
+
+namespace bzla::test {
+
+using namespace bzla::node;
+
+class TestNodeUniqueTable : public TestCommon
+{
+ protected:
+  void SetUp() override
+  {
+    NodeManager& nm = NodeManager::get();
+    Type bv_type    = nm.mk_bv_type(8);
+    Node a          = nm.mk_const(bv_type);
+    Node b          = nm.mk_const(bv_type);
+    d_nodes.push_back(a);
+    d_nodes.push_back(b);
+    // Create enough nodes to trigger several resizes of the table.
+    for (size_t i = 0; i < 5000; ++i)
+    {
+      const Node& x = d_nodes[d_nodes.size() - 1];
+      const Node& y = d_nodes[i];
+      d_nodes.push_back(
+          nm.mk_node(i % 2 ? Kind::BV_ADD : Kind::BV_MUL, {x, y}));
+    }
+  }
+
+  std::vector<Node> d_nodes;
+};
+
+TEST_F(TestNodeUniqueTable, insert)
+{
+  NodeUniqueTable table;
+  for (size_t i = 2; i < d_nodes.size(); ++i)
+  {
+    auto [inserted, data] = table.insert(d_nodes[i].d_data);
+    ASSERT_TRUE(inserted);
+    ASSERT_EQ(data, d_nodes[i].d_data);
+  }
+  ASSERT_EQ(table.size(), d_nodes.size() - 2);
+  for (size_t i = 2; i < d_nodes.size(); ++i)
+  {
+    auto [inserted, data] = table.insert(d_nodes[i].d_data);
+    ASSERT_FALSE(inserted);
+    ASSERT_EQ(data, d_nodes[i].d_data);
+  }
+  ASSERT_EQ(table.size(), d_nodes.size() - 2);
+}
+
+TEST_F(TestNodeUniqueTable, erase)
+{
+  NodeUniqueTable table;
+  for (size_t i = 2; i < d_nodes.size(); ++i)
+  {
+    table.insert(d_nodes[i].d_data);
+    // Interleave erase with growing the table.
+    if (i % 3 == 0)
+    {
+      table.erase(d_nodes[i - 1].d_data);
+    }
+  }
+  for (size_t i = 2; i < d_nodes.size(); ++i)
+  {
+    auto [inserted, data] = table.insert(d_nodes[i].d_data);
+    ASSERT_EQ(inserted, (i + 1) % 3 == 0 && i + 1 < d_nodes.size());
+    ASSERT_EQ(data, d_nodes[i].d_data);
+  }
+  for (size_t i = 2; i < d_nodes.size(); ++i)
+  {
+    table.erase(d_nodes[i].d_data);
+  }
+  ASSERT_EQ(table.size(), 0);
+}
+
+TEST_F(TestNodeUniqueTable, hash_consing)
+{
+  NodeManager& nm = NodeManager::get();
+  for (size_t i = 2; i < d_nodes.size(); ++i)
+  {
+    Node n = nm.mk_node(d_nodes[i].kind(), {d_nodes[i][0], d_nodes[i][1]});
+    ASSERT_EQ(n, d_nodes[i]);
+  }
+  // Garbage collect half of the nodes and recreate them.
+  size_t size = d_nodes.size();
+  d_nodes.resize(size / 2);
+  for (size_t i = d_nodes.size() - 2; i < size - 2; ++i)
+  {
+    const Node& x = d_nodes[d_nodes.size() - 1];
+    const Node& y = d_nodes[i];
+    d_nodes.push_back(nm.mk_node(i % 2 ? Kind::BV_ADD : Kind::BV_MUL, {x, y}));
+  }
+  for (size_t i = 2; i < d_nodes.size(); ++i)
+  {
+    Node n = nm.mk_node(d_nodes[i].kind(), {d_nodes[i][0], d_nodes[i][1]});
+    ASSERT_EQ(n, d_nodes[i]);
+  }
+}
+
+}  // namespace bzla::test
@@ -0,0 +1,206 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <bitwuzla/cpp/bitwuzla.h>
+#include <bitwuzla/cpp/parser.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include "test/unit/test.h"
+
+namespace bzla::test {
+
+class TestBinaryParser : public TestCommon
+{
+ protected:
+  /** Write binary snapshot of the formula of `bitwuzla` to `filename`. */
+  static void write_snapshot(const bitwuzla::Bitwuzla& bitwuzla,
+                             const char* filename)
+  {
+    std::ofstream out(filename, std::ios::binary);
+    bitwuzla.print_formula(out, "binary");
+  }
+
+  /** @return The formula of `bitwuzla` in SMT-LIB v2 format. */
+  static std::string smt2(const bitwuzla::Bitwuzla& bitwuzla)
+  {
+    std::stringstream ss;
+    bitwuzla.print_formula(ss, "smt2");
+    return ss.str();
+  }
+};
+
+TEST_F(TestBinaryParser, round_trip)
+{
+  const char* filename = "round_trip.bdag";
+  bitwuzla::Options options;
+  bitwuzla::Bitwuzla bitwuzla(options);
+
+  bitwuzla::Sort bv8    = bitwuzla::mk_bv_sort(8);
+  bitwuzla::Sort bv100  = bitwuzla::mk_bv_sort(100);
+  bitwuzla::Sort ar8_8  = bitwuzla::mk_array_sort(bv8, bv8);
+  bitwuzla::Sort fun8_8 = bitwuzla::mk_fun_sort({bv8, bv8}, bv8);
+  bitwuzla::Term x      = bitwuzla::mk_const(bv8, "x");
+  bitwuzla::Term y      = bitwuzla::mk_const(bv8, "y");
+  bitwuzla::Term w      = bitwuzla::mk_const(bv100, "w");
+  bitwuzla::Term a      = bitwuzla::mk_const(ar8_8, "a");
+  bitwuzla::Term f      = bitwuzla::mk_const(fun8_8, "f");
+  bitwuzla::Term q      = bitwuzla::mk_var(bv8, "q");
+  bitwuzla::Term z      = bitwuzla::mk_var(bv8, "z");
+  bitwuzla::Term wide   = bitwuzla::mk_bv_value(
+      bv100, "1234567890123456789012345678", 10);
+  bitwuzla::Term add = bitwuzla::mk_term(bitwuzla::Kind::BV_ADD, {x, y});
+
+  bitwuzla.assert_formula(bitwuzla::mk_term(
+      bitwuzla::Kind::EQUAL,
+      {bitwuzla::mk_term(bitwuzla::Kind::APPLY, {f, add, add}),
+       bitwuzla::mk_term(bitwuzla::Kind::ARRAY_SELECT, {a, add})}));
+  bitwuzla.assert_formula(bitwuzla::mk_term(
+      bitwuzla::Kind::BV_ULT,
+      {bitwuzla::mk_term(bitwuzla::Kind::BV_EXTRACT, {w}, {7, 0}), add}));
+  bitwuzla.push(2);
+  bitwuzla.assert_formula(
+      bitwuzla::mk_term(bitwuzla::Kind::DISTINCT, {w, wide}));
+  bitwuzla.assert_formula(bitwuzla::mk_term(
+      bitwuzla::Kind::EXISTS,
+      {q,
+       bitwuzla::mk_term(
+           bitwuzla::Kind::EQUAL,
+           {bitwuzla::mk_term(
+                bitwuzla::Kind::APPLY,
+                {bitwuzla::mk_term(
+                     bitwuzla::Kind::LAMBDA,
+                     {z, bitwuzla::mk_term(bitwuzla::Kind::BV_MUL, {z, q})}),
+                 x}),
+            y})}));
+
+  write_snapshot(bitwuzla, filename);
+
+  bitwuzla::parser::Parser parser(options, filename, "binary");
+  std::string err = parser.parse(false);
+  ASSERT_TRUE(err.empty()) << err;
+  ASSERT_EQ(smt2(*parser.bitwuzla()), smt2(bitwuzla));
+  std::remove(filename);
+}
+
+TEST_F(TestBinaryParser, read_file)
+{
+  const char* filename = "read_file.bdag";
+  bitwuzla::Options options;
+  bitwuzla::Bitwuzla bitwuzla(options);
+
+  bitwuzla::Sort bv8 = bitwuzla::mk_bv_sort(8);
+  bitwuzla::Term x   = bitwuzla::mk_const(bv8, "x");
+  bitwuzla::Term y   = bitwuzla::mk_const(bv8, "y");
+  bitwuzla.assert_formula(bitwuzla::mk_term(
+      bitwuzla::Kind::EQUAL,
+      {bitwuzla::mk_term(bitwuzla::Kind::BV_MUL, {x, y}),
+       bitwuzla::mk_bv_value_uint64(bv8, 143)}));
+  bitwuzla.assert_formula(bitwuzla::mk_term(
+      bitwuzla::Kind::BV_ULT, {bitwuzla::mk_bv_one(bv8), x}));
+  bitwuzla.assert_formula(bitwuzla::mk_term(bitwuzla::Kind::BV_ULT, {x, y}));
+  write_snapshot(bitwuzla, filename);
+
+  // Snapshots that can not be memory-mapped are read into a buffer.
+  FILE* infile = std::fopen(filename, "r");
+  std::vector<char> bytes(1 << 16);
+  bytes.resize(std::fread(bytes.data(), 1, bytes.size(), infile));
+  std::fclose(infile);
+  infile = fmemopen(bytes.data(), bytes.size(), "r");
+
+  bitwuzla::parser::Parser parser(options, filename, infile, "binary");
+  std::string err = parser.parse(false);
+  ASSERT_TRUE(err.empty()) << err;
+  ASSERT_EQ(smt2(*parser.bitwuzla()), smt2(bitwuzla));
+  ASSERT_EQ(parser.bitwuzla()->check_sat(), bitwuzla::Result::SAT);
+  std::fclose(infile);
+  std::remove(filename);
+}
+
+TEST_F(TestBinaryParser, invalid)
+{
+  const char* filename = "invalid.bdag";
+  bitwuzla::Options options;
+  {
+    std::ofstream out(filename, std::ios::binary);
+    out << "(set-logic QF_BV)\n" << std::flush;
+  }
+  {
+    bitwuzla::parser::Parser parser(options, filename, "binary");
+    ASSERT_FALSE(parser.parse(false).empty());
+  }
+
+  // Truncated snapshot.
+  {
+    bitwuzla::Bitwuzla bitwuzla(options);
+    bitwuzla::Sort bv8 = bitwuzla::mk_bv_sort(8);
+    bitwuzla.assert_formula(
+        bitwuzla::mk_term(bitwuzla::Kind::EQUAL,
+                          {bitwuzla::mk_const(bv8, "x"),
+                           bitwuzla::mk_const(bv8, "y")}));
+    std::stringstream ss;
+    bitwuzla.print_formula(ss, "binary");
+    std::string snapshot = ss.str();
+    std::ofstream out(filename, std::ios::binary);
+    out.write(snapshot.data(), snapshot.size() - 8);
+  }
+  {
+    bitwuzla::parser::Parser parser(options, filename, "binary");
+    ASSERT_FALSE(parser.parse(false).empty());
+  }
+
+  // Assertion level increment exceeds the number of remaining assertions.
+  {
+    bitwuzla::Bitwuzla bitwuzla(options);
+    bitwuzla.push(1);
+    bitwuzla.assert_formula(bitwuzla::mk_const(bitwuzla::mk_bool_sort()));
+    std::stringstream ss;
+    bitwuzla.print_formula(ss, "binary");
+    std::string snapshot = ss.str();
+    // The level of the last assertion precedes its node position.
+    uint64_t level = uint64_t{1} << 32;
+    std::memcpy(snapshot.data() + snapshot.size() - 16, &level, 8);
+    std::ofstream out(filename, std::ios::binary);
+    out.write(snapshot.data(), snapshot.size());
+  }
+  {
+    bitwuzla::parser::Parser parser(options, filename, "binary");
+    ASSERT_FALSE(parser.parse(false).empty());
+  }
+  std::remove(filename);
+}
+
+TEST_F(TestBinaryParser, empty_levels)
+{
+  // Empty assertion levels exceeding the number of remaining assertions are
+  // dropped.
+  const char* filename = "empty_levels.bdag";
+  bitwuzla::Options options;
+  bitwuzla::Bitwuzla bitwuzla(options);
+  bitwuzla::Sort bool_sort = bitwuzla::mk_bool_sort();
+  bitwuzla.assert_formula(bitwuzla::mk_const(bool_sort, "a"));
+  bitwuzla.push(1000);
+  bitwuzla.assert_formula(bitwuzla::mk_const(bool_sort, "b"));
+  bitwuzla.assert_formula(bitwuzla::mk_const(bool_sort, "c"));
+  write_snapshot(bitwuzla, filename);
+
+  bitwuzla::parser::Parser parser(options, filename, "binary");
+  std::string err = parser.parse(false);
+  ASSERT_TRUE(err.empty()) << err;
+  std::string expected = smt2(bitwuzla);
+  size_t pos           = expected.find("(push 1000)");
+  ASSERT_NE(pos, std::string::npos);
+  expected.replace(pos, 11, "(push 2)");
+  ASSERT_EQ(smt2(*parser.bitwuzla()), expected);
+  std::remove(filename);
+}
+
+}  // namespace bzla::test
@@ -0,0 +1,200 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <unordered_map>
+
+#include "env.h"
+#include "gtest/gtest.h"
+#include "node/node_manager.h"
+#include "rewrite/batch_evaluator.h"
+#include "rewrite/rewriter.h"
+#include "rng/rng.h"
+
+namespace bzla::test {
+
+using namespace bzla::node;
+
+class TestBatchEvaluator : public ::testing::Test
+{
+ protected:
+  static constexpr size_t N_ASSIGNMENTS = 37;
+
+  TestBatchEvaluator() : d_rewriter(d_env.rewriter()), d_rng(1234) {}
+
+  /**
+   * Generate a random value of given size, with a bias towards values that
+   * hit corner cases of division, shifts and signed comparisons.
+   */
+  BitVector mk_value(uint64_t size)
+  {
+    switch (d_rng.pick<uint32_t>(0, 5))
+    {
+      case 0: return BitVector::mk_zero(size);
+      case 1: return BitVector::mk_ones(size);
+      case 2: return BitVector::mk_min_signed(size);
+      case 3:
+        return BitVector::from_ui(size, d_rng.pick<uint64_t>(0, size), true);
+      default: return BitVector(size, d_rng);
+    }
+  }
+
+  /** Evaluate given node by rewriting it with values substituted. */
+  Node evaluate(const Node& node, std::unordered_map<Node, Node>& cache)
+  {
+    if (node.is_value())
+    {
+      return node;
+    }
+    auto it = cache.find(node);
+    if (it != cache.end())
+    {
+      return it->second;
+    }
+    std::vector<Node> children;
+    for (const Node& child : node)
+    {
+      children.push_back(evaluate(child, cache));
+    }
+    Node res = d_rewriter.rewrite(
+        d_nm.mk_node(node.kind(), children, node.indices()));
+    assert(res.is_value());
+    cache.emplace(node, res);
+    return res;
+  }
+
+  /**
+   * Build terms over constants of given size, evaluate them with the batch
+   * evaluator and compare against the values computed by the rewriter.
+   */
+  void test_size(uint64_t size)
+  {
+    Type type  = d_nm.mk_bv_type(size);
+    Node x     = d_nm.mk_const(type);
+    Node y     = d_nm.mk_const(type);
+    Node c     = d_nm.mk_const(d_nm.mk_bool_type());
+    Node val   = d_nm.mk_value(BitVector::from_ui(size, 3, true));
+    Node add   = d_nm.mk_node(Kind::BV_ADD, {x, y});
+    Node mul   = d_nm.mk_node(Kind::BV_MUL, {x, y});
+    Node udiv  = d_nm.mk_node(Kind::BV_UDIV, {x, y});
+    Node urem  = d_nm.mk_node(Kind::BV_UREM, {x, y});
+    Node shl   = d_nm.mk_node(Kind::BV_SHL, {x, y});
+    Node shr   = d_nm.mk_node(Kind::BV_SHR, {x, y});
+    Node ashr  = d_nm.mk_node(Kind::BV_ASHR, {x, y});
+    Node band  = d_nm.mk_node(Kind::BV_AND, {x, add});
+    Node bxor  = d_nm.mk_node(Kind::BV_XOR, {x, val});
+    Node bnot  = d_nm.mk_node(Kind::BV_NOT, {mul});
+    Node inc   = d_nm.mk_node(Kind::BV_INC, {udiv});
+    Node dec   = d_nm.mk_node(Kind::BV_DEC, {urem});
+    Node ult   = d_nm.mk_node(Kind::BV_ULT, {x, y});
+    Node slt   = d_nm.mk_node(Kind::BV_SLT, {x, y});
+    Node eq    = d_nm.mk_node(Kind::EQUAL, {add, mul});
+    Node comp  = d_nm.mk_node(Kind::BV_COMP, {shl, shr});
+    Node ite   = d_nm.mk_node(Kind::ITE, {c, ashr, bnot});
+    Node ite2  = d_nm.mk_node(Kind::ITE, {ult, ite, val});
+    Node ext   = d_nm.mk_node(Kind::BV_EXTRACT, {ite2}, {size - 1, size / 2});
+    Node cat   = d_nm.mk_node(Kind::BV_CONCAT, {ext, inc});
+    Node cat2  = d_nm.mk_node(Kind::BV_CONCAT, {ext, dec});
+    Node cmp   = d_nm.mk_node(Kind::BV_ULT, {cat, cat2});
+    Node bnot2 = d_nm.mk_node(Kind::NOT, {slt});
+    Node band2 = d_nm.mk_node(Kind::AND, {bnot2, eq});
+    Node bor   = d_nm.mk_node(Kind::OR, {band2, cmp});
+    Node beq   = d_nm.mk_node(Kind::EQUAL, {bor, c});
+
+    std::vector<Node> nodes = {x,   y,    c,    val,  add,  mul,   udiv,  urem,
+                               shl, shr,  ashr, band, bxor, bnot,  inc,   dec,
+                               ult, slt,  eq,   comp, ite,  ite2,  ext,   cat,
+                               cat2, cmp, bnot2, band2, bor, beq};
+    BatchEvaluator evaluator(nodes);
+    ASSERT_EQ(evaluator.inputs(), std::vector<Node>({x, y, c}));
+
+    std::vector<std::vector<uint64_t>> inputs;
+    std::vector<std::unordered_map<Node, Node>> expected(N_ASSIGNMENTS);
+    for (const Node& input : evaluator.inputs())
+    {
+      size_t nlimbs = BatchEvaluator::num_limbs(input);
+      inputs.emplace_back(N_ASSIGNMENTS * nlimbs);
+      for (size_t i = 0; i < N_ASSIGNMENTS; ++i)
+      {
+        uint64_t* limbs = inputs.back().data() + i * nlimbs;
+        if (input.type().is_bool())
+        {
+          bool value = d_rng.flip_coin();
+          limbs[0]   = value;
+          expected[i].emplace(input, d_nm.mk_value(value));
+        }
+        else
+        {
+          BitVector value = mk_value(size);
+          value.to_limbs(limbs);
+          expected[i].emplace(input, d_nm.mk_value(value));
+        }
+      }
+    }
+    std::vector<const uint64_t*> assignments;
+    for (const auto& values : inputs)
+    {
+      assignments.push_back(values.data());
+    }
+
+    evaluator.evaluate(N_ASSIGNMENTS, assignments);
+    for (size_t i = 0; i < N_ASSIGNMENTS; ++i)
+    {
+      for (const Node& node : nodes)
+      {
+        Node value = evaluate(node, expected[i]);
+        BitVector bv = value.type().is_bool()
+                           ? BitVector::from_ui(1, value.value<bool>())
+                           : value.value<BitVector>();
+        ASSERT_EQ(evaluator.value(node, i), bv);
+      }
+    }
+  }
+
+  NodeManager& d_nm = NodeManager::get();
+  Env d_env;
+  Rewriter& d_rewriter;
+  RNG d_rng;
+};
+
+TEST_F(TestBatchEvaluator, narrow)
+{
+  test_size(1);
+  test_size(8);
+  test_size(31);
+  test_size(64);
+}
+
+TEST_F(TestBatchEvaluator, wide)
+{
+  test_size(65);
+  test_size(128);
+  test_size(200);
+  test_size(300);
+}
+
+TEST_F(TestBatchEvaluator, num_assignments)
+{
+  Type type = d_nm.mk_bv_type(16);
+  Node x    = d_nm.mk_const(type);
+  Node add  = d_nm.mk_node(Kind::BV_ADD, {x, x});
+  BatchEvaluator evaluator({x, add});
+  for (size_t n : {0, 1, 3, 1000})
+  {
+    // Bits above the size of the input are ignored.
+    std::vector<uint64_t> values(n, 0xffff0000 + 0x8001);
+    evaluator.evaluate(n, {values.data()});
+    for (size_t i = 0; i < n; ++i)
+    {
+      ASSERT_EQ(evaluator.values(add)[i], 2);
+    }
+  }
+}
+
+}  // namespace bzla::test
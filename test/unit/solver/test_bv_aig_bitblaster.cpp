@@ -0,0 +1,57 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "node/node_manager.h"
+#include "solver/bv/aig_bitblaster.h"
+#include "test/unit/test.h"
+
+namespace bzla::test {
+
+using namespace node;
+
+class TestBvAigBitblaster : public TestCommon
+{
+};
+
+TEST_F(TestBvAigBitblaster, udiv_urem_shared)
+{
+  NodeManager& nm = NodeManager::get();
+  Type bv8        = nm.mk_bv_type(8);
+  Node x          = nm.mk_const(bv8);
+  Node y          = nm.mk_const(bv8);
+
+  bv::AigBitblaster bb;
+  // bvudiv and bvurem over the same operands in separate assertions share
+  // the divider circuit.
+  bb.bitblast(nm.mk_node(Kind::EQUAL, {nm.mk_node(Kind::BV_UDIV, {x, y}), x}));
+  ASSERT_EQ(bb.num_shared_udiv_urem(), 0);
+  uint64_t num_ands = bb.num_aig_ands();
+  Node urem         = nm.mk_node(Kind::BV_UREM, {x, y});
+  bb.bitblast(urem);
+  ASSERT_EQ(bb.num_shared_udiv_urem(), 1);
+  ASSERT_EQ(bb.num_aig_ands(), num_ands);
+  bb.bitblast(nm.mk_node(Kind::EQUAL, {urem, y}));
+  ASSERT_EQ(bb.num_shared_udiv_urem(), 1);
+
+  // Operands are ordered.
+  bb.bitblast(nm.mk_node(Kind::BV_UREM, {y, x}));
+  ASSERT_EQ(bb.num_shared_udiv_urem(), 1);
+  bb.bitblast(nm.mk_node(Kind::BV_UDIV, {y, x}));
+  ASSERT_EQ(bb.num_shared_udiv_urem(), 2);
+
+  // Pending divider circuits are dropped on garbage collection.
+  Node z = nm.mk_const(bv8);
+  bb.bitblast(nm.mk_node(Kind::BV_UDIV, {x, z}));
+  bb.garbage_collect();
+  bb.bitblast(nm.mk_node(Kind::BV_UREM, {x, z}));
+  ASSERT_EQ(bb.num_shared_udiv_urem(), 2);
+}
+
+}  // namespace bzla::test